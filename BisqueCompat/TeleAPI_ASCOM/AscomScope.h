@@ -47,6 +47,8 @@ extern void SetLatitude(double lat);
 extern void SetLongitude(double lng);
 extern char *GetName(void);
 extern bool IsSlewing(void);
+extern bool PredictRaDec(double &ra, double &dec);
+extern void NoteRaDec(unsigned long tick, double ra, double dec);
 extern short SlewScope(double dRA, double dDec);
 extern void AbortSlew(void);
 extern short SyncScope(double dRA, double dDec);
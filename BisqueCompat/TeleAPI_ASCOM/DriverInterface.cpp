@@ -65,6 +65,10 @@
 //						calls on a single thread) then the cross thread 
 //						logic can be disabled, allowing exe/LocalServer 
 //						COM servers to be released successfully.
+// 17-Oct-26	asc		PointingPredictor carries RA/Dec forward between
+//						driver reads for up to Predict Limit ms, resyncing
+//						on its own thread through the GIT. Commands that
+//						move the mount invalidate it.
 //========================================================================
 
 /* #include "AscomScope.h" */
@@ -76,6 +80,9 @@
 #define OUR_REGISTRY_BASE HKEY_LOCAL_MACHINE
 #define OUR_REGISTRY_AREA "Software\\SPACE.com\\TheSky TeleAPI-ASCOM Plugin"
 #define OUR_DRIVER_SEL "ASCOM Driver ID"
+#define OUR_PREDICT_LIMIT "Predict Limit"
+
+#define PREDICT_LIMIT 2000										// Default RA/Dec extrapolation limit, ms (0 = off)
 
 #define TELEAPI_REGISTRY_AREA_6 "Software\\Software Bisque\\TheSky6\\TELEAPI"
 #define TELEAPI_REGISTRY_AREA_X "Software\\Software Bisque\\TheSkyX\\TELEAPI"
@@ -86,6 +93,9 @@ static void set_double(OLECHAR *name, double val);
 static bool get_bool(OLECHAR *name);
 static void set_bool(OLECHAR *name, bool val);
 static void switchThreadIf();
+#ifdef CROSS_THREAD
+static bool source_get(IDispatch *pDisp, OLECHAR *name, VARTYPE vt, VARIANT *pv);
+#endif
 
 static IDispatch *_p_DrvDisp = NULL;							// [sentinel] Pointer to driver interface
 #ifdef CROSS_THREAD
@@ -95,6 +105,27 @@ static DWORD dCurrIntfcThreadId;								// ID of thread on which the interface i
 #endif
 static bool bSyncSlewing = false;								// True if scope is doing a sync slew
 
+#ifdef CROSS_THREAD
+//
+// The predictor's view of the driver. It runs on the predictor's thread
+// in the MTA with its own proxy from the GIT, and never alerts; a read
+// that fails is simply not used, and TheSky's next tapiGetRaDec() goes
+// to the driver and reports the error in the usual way.
+//
+class RaDecSource : public PointingSource
+{
+public:
+	IDispatch *pDisp;
+	RaDecSource() : pDisp(NULL) {}
+	void Attach();
+	void Detach();
+	bool Read(PointingFix &fix);
+};
+
+static RaDecSource _raDecSource;
+#endif
+static PointingPredictor _predictor;
+
 // -------------
 // InitDrivers()
 // -------------
@@ -154,6 +185,7 @@ short InitScope(void)
 	OLECHAR *ocProgID = NULL;
 	DWORD dwType;
 	DWORD dwGemVal;
+	DWORD dwPredict;
 
 	__try {
 		_bScopeActive = false;									// Assume failure
@@ -184,6 +216,14 @@ short InitScope(void)
 				"Failed to read the driver ID from the registry.",
 				NULL, true);
 		}
+		dwSize = sizeof(dwPredict);
+		if(RegQueryValueEx(hKey, 
+				   OUR_PREDICT_LIMIT,
+				   NULL,
+				   &dwType,
+				   (BYTE *)&dwPredict,
+				   &dwSize) != ERROR_SUCCESS || dwType != REG_DWORD)
+			dwPredict = PREDICT_LIMIT;							// Optional
 		RegCloseKey(hKey);
 
 		ocProgID = ansi_to_uni(szProgID);
@@ -343,6 +383,18 @@ short InitScope(void)
 		//
 		if(get_bool(L"CanSetTracking"))
 			set_bool(L"Tracking", true);
+#ifdef CROSS_THREAD
+		//
+		// TheSky polls RA/Dec as fast as its crosshair updates. Answer
+		// from the last reading carried forward, and have the predictor's
+		// thread read the driver again at half the limit.
+		//
+		if(_bScopeHasEqu && dwPredict > 0)
+		{
+			_raDecSource.pDisp = NULL;
+			_predictor.Start(&_raDecSource, dwPredict, dwPredict / 2);
+		}
+#endif
 		//
 		// Done!
 		//
@@ -373,6 +425,8 @@ void TermScope(bool fatal)
 	short iRes = 0;												// Assume success (our retval)
 	HRESULT hr;
 
+	_predictor.Stop();											// Before the driver goes away
+
 	if(_p_DrvDisp != NULL)										// Just in case! (see termPlugin())
 	{
 #ifdef CROSS_THREAD
@@ -659,6 +713,42 @@ bool IsSlewing(void)
 	return((vRes.boolVal != VARIANT_FALSE) ? true : false);
 }
 
+// ------------
+// PredictRaDec
+// ------------
+//
+// RA/Dec now, carried forward from the last reading by the tracking state
+// and rates. Never blocks; if this returns false, read the driver and
+// pass the result to NoteRaDec().
+//
+bool PredictRaDec(double &ra, double &dec)
+{
+	if(!_bScopeActive)
+		return false;
+	return _predictor.Predict(PointingPredictor::TickCount(), ra, dec);
+}
+
+// ---------
+// NoteRaDec
+// ---------
+//
+// A direct RA/Dec read, taken at tick. The predictor keeps the tracking
+// state from its own last reading.
+//
+void NoteRaDec(unsigned long tick, double ra, double dec)
+{
+	PointingFix fix;
+
+	if(!_predictor.IsRunning())
+		return;
+	memset(&fix, 0, sizeof(fix));
+	fix.valid = PointingFix::PF_POSITION;
+	fix.tick = tick;
+	fix.ra = ra;
+	fix.dec = dec;
+	_predictor.Update(fix);
+}
+
 //
 //	----
 //	Slew
@@ -748,6 +838,7 @@ short SlewScope(double dRA, double dDec)
 	}
 
 	bSyncSlewing = false;
+	_predictor.Invalidate();									// Mount has moved
 
 	return(iRes);
 }
@@ -800,6 +891,7 @@ void AbortSlew(void)
 				     &excep, 
 				     NULL)))
 		drvFail("AbortSlew failed internally.", &excep, true);
+	_predictor.Invalidate();									// Mount has stopped
 		
 }
 
@@ -875,6 +967,7 @@ short SyncScope(double dRA, double dDec)
 			iRes = -1;
 		}
 
+	_predictor.Invalidate();									// Coordinates have changed
 	return(iRes);
 }	
 
@@ -926,6 +1019,7 @@ void UnparkScope(void)
 				     &excep, 
 				     NULL)))
 		drvFail("Unpark failed internally.", &excep, true);
+	_predictor.Invalidate();									// Mount may start tracking
 		
 }
 
@@ -1481,4 +1575,121 @@ static void switchThreadIf()
 		_p_DrvDisp = pTemp;
 	}
 }
-#endif
\ No newline at end of file
+#endif
+
+#ifdef CROSS_THREAD
+// --------------------
+// RaDecSource::Attach()
+// RaDecSource::Detach()
+// --------------------
+//
+// The predictor's thread joins the MTA; its proxy is taken from the GIT
+// on the first Read() and released when the thread ends.
+//
+void RaDecSource::Attach()
+{
+	CoInitializeEx(NULL, COINIT_MULTITHREADED);
+}
+
+void RaDecSource::Detach()
+{
+	if(pDisp != NULL)
+		pDisp->Release();
+	pDisp = NULL;
+	CoUninitialize();
+}
+
+// -------------------
+// RaDecSource::Read()
+// -------------------
+//
+// RA/Dec are required. A driver without Tracking is taken to be tracking
+// at the sidereal rate, and one without rate offsets to have none.
+// Slewing is only asked for if the driver can slew asynchronously, as in
+// IsSlewing().
+//
+bool RaDecSource::Read(PointingFix &fix)
+{
+	VARIANT v;
+
+	if(pDisp == NULL && FAILED(_p_GIT->GetInterfaceFromGlobal(dwIntfcCookie, 
+					IID_IDispatch, 
+					(void **)&pDisp)))
+	{
+		pDisp = NULL;
+		return false;
+	}
+
+	if(!source_get(pDisp, L"RightAscension", VT_R8, &v))
+		return false;
+	fix.ra = v.dblVal;
+	if(!source_get(pDisp, L"Declination", VT_R8, &v))
+		return false;
+	fix.dec = v.dblVal;
+	fix.valid = PointingFix::PF_POSITION;
+
+	fix.tracking = true;
+	if(source_get(pDisp, L"Tracking", VT_BOOL, &v))
+		fix.tracking = (v.boolVal != VARIANT_FALSE);
+	if(!_bScopeCanSlewAsync)
+		fix.slewing = bSyncSlewing;
+	else if(source_get(pDisp, L"Slewing", VT_BOOL, &v))
+		fix.slewing = (v.boolVal != VARIANT_FALSE);
+	else
+		return true;											// Position only
+	fix.raRate = fix.decRate = 0.0;
+	if(fix.tracking)
+	{
+		if(source_get(pDisp, L"RightAscensionRate", VT_R8, &v))
+			fix.raRate = v.dblVal;
+		if(source_get(pDisp, L"DeclinationRate", VT_R8, &v))
+			fix.decRate = v.dblVal;
+	}
+	fix.valid |= PointingFix::PF_MOTION;
+	return true;
+}
+
+// ------------
+// source_get()
+// ------------
+//
+// Read a named property through the given proxy, coerced to vt. Unlike
+// get_xxx() above this never alerts or raises; false on any failure.
+//
+static bool source_get(IDispatch *pDisp, OLECHAR *name, VARTYPE vt, VARIANT *pv)
+{
+	DISPID dispid;
+	DISPPARAMS dispparms;
+	EXCEPINFO excep;
+
+	VariantInit(pv);
+	if(FAILED(pDisp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid)))
+		return false;
+
+	dispparms.cArgs = 0;
+	dispparms.rgvarg = NULL;
+	dispparms.cNamedArgs = 0;
+	dispparms.rgdispidNamedArgs = NULL;
+	memset(&excep, 0, sizeof(excep));
+	if(FAILED(pDisp->Invoke(dispid, 
+				     IID_NULL, 
+				     LOCALE_USER_DEFAULT, 
+				     DISPATCH_PROPERTYGET,
+				     &dispparms, 
+				     pv, 
+				     &excep, 
+				     NULL)))
+	{
+		SysFreeString(excep.bstrSource);						// NULL is OK
+		SysFreeString(excep.bstrDescription);
+		SysFreeString(excep.bstrHelpFile);
+		return false;
+	}
+	if(pv->vt != vt && FAILED(VariantChangeType(pv, pv, 0, vt)))
+	{
+		VariantClear(pv);
+		return false;
+	}
+	return true;
+}
+#endif
@@ -24,6 +24,8 @@
 
 #include <windows.h>
 #include <stdio.h>
+#include <string.h>
+#include "../../PluginCommon/PointingPredictor.h"
 #include "AscomScope.h"
 #include "teleapi.h"
 
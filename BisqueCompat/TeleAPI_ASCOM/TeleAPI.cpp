@@ -96,9 +96,14 @@ TELEAPIEXPORT int CALLBACK tapiGetRaDec(double* ra, double* dec)
 		return(TS_E_NOSCOPE);							// Forget this
 	}
 
+	if(PredictRaDec(*ra, *dec))							// Carried forward from the
+		return iRes;									// last reading
+
 	__try {
+		unsigned long tick = PointingPredictor::TickCount();
 		*ra = GetRightAscension();
 		*dec = GetDeclination();
+		NoteRaDec(tick, *ra, *dec);
 	} __except(EXCEPTION_EXECUTE_HANDLER) {
 		iRes = TS_E_NOSCOPE;
 	}
@@ -30,6 +30,12 @@
 // 17-Feb-12	rbd		1.0.2 - Assure that changes to tracking rate offsets
 //						happen only while tracking is on. Change tracking
 //						state only if really needed.
+// 17-Oct-26	asc		Status reads (position, slewing, tracking, park,
+//						pier side) come from the background snapshot when
+//						it is fresh. raDec() uses it only when bCached.
+// 17-Oct-26	asc		raDec() with bCached takes the predicted position
+//						first; direct reads are passed back to the
+//						predictor.
 //========================================================================
 
 #include "StdAfx.h"
@@ -320,15 +326,27 @@ void X2Mount::deviceInfoModel(BasicStringInterface& str)
 int	X2Mount::raDec(double& ra, double& dec, const bool& bCached)
 {
 	int iRes = SB_OK;
+	MountSnapshot snap;
 
 	if(!_bScopeActive)	{							// No scope hookup?
 		ra = dec = 0.0;
 		return(ERR_COMMNOLINK);						// Forget this
 	}
 
+	if(bCached && PredictRaDec(ra, dec))			// Carried forward from the last
+		return iRes;								// reading by the tracking rates
+	if(bCached && GetSnapshot(snap, MountSnapshot::MS_RADEC))
+	{
+		ra = snap.ra;								// TheSky will take the poller's
+		dec = snap.dec;								// last reading
+		return iRes;
+	}
+
 	__try {
+		unsigned long tick = PointingPredictor::TickCount();
 		ra = GetRightAscension();
 		dec = GetDeclination();
+		NoteRaDec(tick, ra, dec);
 	} __except(EXCEPTION_EXECUTE_HANDLER) {
 		iRes = ERR_COMMNOLINK;
 	}
@@ -405,6 +423,7 @@ int X2Mount::startSlewTo(const double& ra, const double& dec)
 int X2Mount::isCompleteSlewTo(bool& bComplete) const
 {
 	int iRes = SB_OK;								// Assume success
+	MountSnapshot snap;
 
 	if(!_bScopeActive)								// No scope hookup?
 		return(ERR_COMMNOLINK);						// Forget this
@@ -412,6 +431,8 @@ int X2Mount::isCompleteSlewTo(bool& bComplete) const
 	__try {
 		if(!_bScopeCanSlew && !_bScopeCanSlewAsync)
 			bComplete = true;
+		else if(GetSnapshot(snap, MountSnapshot::MS_SLEWING))
+			bComplete = !snap.slewing;				// Taken after the slew started
 		else
 			bComplete = !IsSlewing();
 	} __except(EXCEPTION_EXECUTE_HANDLER) {
@@ -498,6 +519,7 @@ int X2Mount::setTrackingRates( const bool& bTrackingOn, const bool& bIgnoreRates
 int X2Mount::trackingRates( bool& bTrackingOn, double& dRaRateArcSecPerSec, double& dDecRateArcSecPerSec)
 {
 	int iRes = SB_OK;								// Assume success
+	MountSnapshot snap;
 
 	if(!_bScopeActive)								// No scope hookup?
 		return(ERR_COMMNOLINK);						// Forget this
@@ -506,7 +528,20 @@ int X2Mount::trackingRates( bool& bTrackingOn, double& dRaRateArcSecPerSec, doub
 	dRaRateArcSecPerSec = dDecRateArcSecPerSec = -1000.0;
 
 	__try {
-		if(_bScopeCanSetTracking)
+		//
+		// The snapshot has the offsets only if tracking with offsets
+		//
+		if(_bScopeCanSetTracking && GetSnapshot(snap, MountSnapshot::MS_TRACKING) &&
+				(!snap.tracking || !_bScopeCanSetTrackRates || (snap.valid & MountSnapshot::MS_RATES)))
+		{
+			bTrackingOn = snap.tracking;
+			if(bTrackingOn && _bScopeCanSetTrackRates)
+			{
+				dRaRateArcSecPerSec = snap.raRate / SIDRATE;
+				dDecRateArcSecPerSec = snap.decRate;
+			}
+		}
+		else if(_bScopeCanSetTracking)
 		{
 			bTrackingOn = GetTracking();
 			if(bTrackingOn && _bScopeCanSetTrackRates)
@@ -527,10 +562,13 @@ int X2Mount::trackingRates( bool& bTrackingOn, double& dRaRateArcSecPerSec, doub
 //WTF Why this and isCompletePark?
 bool X2Mount::isParked(void)
 {
-	if(_bScopeActive && _bScopeCanPark)
-		return GetAtPark();
-	else
+	MountSnapshot snap;
+
+	if(!_bScopeActive || !_bScopeCanPark)
 		return false;
+	if(GetSnapshot(snap, MountSnapshot::MS_ATPARK))
+		return snap.atPark;
+	return GetAtPark();
 }
 
 /*!Initiate the park process. */
@@ -580,6 +618,7 @@ int X2Mount::startPark(const double& az, const double& alt)
 int X2Mount::isCompletePark(bool& bComplete) const
 {
 	int iRes = SB_OK;								// Assume success
+	MountSnapshot snap;
 
 	if(!_bScopeActive)								// No scope hookup?
 		return(ERR_COMMNOLINK);						// Forget this
@@ -587,6 +626,8 @@ int X2Mount::isCompletePark(bool& bComplete) const
 	__try {
 		if(!_bScopeCanPark)
 			bComplete = true;
+		else if(GetSnapshot(snap, MountSnapshot::MS_ATPARK))
+			bComplete = snap.atPark;
 		else
 			bComplete = GetAtPark();
 	} __except(EXCEPTION_EXECUTE_HANDLER) {
@@ -626,6 +667,7 @@ int X2Mount::startUnpark(void)
 int X2Mount::isCompleteUnpark(bool& bComplete) const
 {
 	int iRes = SB_OK;								// Assume success
+	MountSnapshot snap;
 
 	if(!_bScopeActive)								// No scope hookup?
 		return(ERR_COMMNOLINK);						// Forget this
@@ -633,6 +675,8 @@ int X2Mount::isCompleteUnpark(bool& bComplete) const
 	__try {
 		if(!_bScopeCanUnpark)
 			bComplete = true;
+		else if(GetSnapshot(snap, MountSnapshot::MS_ATPARK))
+			bComplete = !snap.atPark;
 		else
 			bComplete = !GetAtPark();
 	} __except(EXCEPTION_EXECUTE_HANDLER) {
@@ -686,12 +730,17 @@ is lower than the counterweights.
 */
 int X2Mount::beyondThePole(bool& bYes)
 {
+	MountSnapshot snap;
+
 	if(!_bScopeActive)									// No scope hookup?
 		return(ERR_COMMNOLINK);							// Forget this
 	if (!GetCanPierSide())
 		return(ERR_NOT_IMPL);							// Safety valve, should not happen
 
-	bYes = (IsPierWest());
+	if(GetSnapshot(snap, MountSnapshot::MS_SIDEOFPIER))
+		bYes = (snap.sideOfPier == 1);
+	else
+		bYes = (IsPierWest());
 	return 0;
 }
 
@@ -203,6 +203,9 @@ extern void TermDrivers(void);
 extern short InitScope(void);
 extern void TermScope(bool);
 extern short ConfigScope();
+extern bool GetSnapshot(MountSnapshot &snap, unsigned fields);
+extern bool PredictRaDec(double &ra, double &dec);
+extern void NoteRaDec(unsigned long tick, double ra, double dec);
 extern bool GetCanPierSide(void);
 extern bool GetAtPark(void);
 extern double GetRightAscension(void);
@@ -224,6 +227,7 @@ extern void ParkScope(void);
 extern void UnparkScope(void);
 extern void SetParkScope(void);
 extern void SaveDriverID(char *id);
+extern void LogLines(const char *lines[], int count);
 
 // -------------
 // Utilities.cpp
@@ -0,0 +1,224 @@
+//========================================================================
+//
+// TITLE:		DispatchInvoker.cpp
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Typed calls into the Telescope driver with a per-driver
+//				DISPID table. See DispatchInvoker.h.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#include <stddef.h>
+#include "DispatchInvoker.h"
+
+#define WIDEN2(s) L ## s
+#define WIDEN(s) WIDEN2(s)
+
+#define DRIVER_MEMBER_NAME(n) { WIDEN(#n), #n },
+static const struct
+{
+	const wchar_t *wide;
+	const char *ansi;
+} _names[DM_COUNT] =
+{
+	DRIVER_MEMBERS(DRIVER_MEMBER_NAME)
+};
+#undef DRIVER_MEMBER_NAME
+
+DispatchInvoker::DispatchInvoker()
+{
+	_lookups = 0;
+	_invokes = 0;
+	Reset();
+}
+
+// -----
+// Reset
+// -----
+//
+// Call whenever the driver instance changes. DISPIDs are only stable for
+// one object.
+//
+void DispatchInvoker::Reset()
+{
+	for(int i = 0; i < DM_COUNT; i++)
+	{
+		_dispids[i] = 0;
+		_state[i] = ID_UNKNOWN;
+	}
+}
+
+const char *DispatchInvoker::Name(DriverMember m)
+{
+	return _names[m].ansi;
+}
+
+const wchar_t *DispatchInvoker::WideName(DriverMember m)
+{
+	return _names[m].wide;
+}
+
+// ------
+// Lookup
+// ------
+//
+// DISPID from the table, asking the driver only the first time.
+//
+int DispatchInvoker::Lookup(DispatchTarget &target, DriverMember m, long &dispid)
+{
+	if(_state[m] == ID_UNKNOWN)
+	{
+		_lookups++;
+		if(target.GetID(_names[m].wide, _dispids[m]))
+			_state[m] = ID_RESOLVED;
+		else
+			_state[m] = ID_MISSING;
+	}
+	dispid = _dispids[m];
+	return (_state[m] == ID_RESOLVED ? DI_OK : DI_NOTFOUND);
+}
+
+int DispatchInvoker::Invoke(DispatchTarget &target, DriverMember m, int kind,
+							const DispatchValue *args, int nArgs, DispatchValue *result)
+{
+	long dispid;
+	int status = Lookup(target, m, dispid);
+
+	result->type = DispatchValue::DV_EMPTY;
+	result->strVal = NULL;
+	if(status != DI_OK)
+		return status;
+	_invokes++;
+	return target.Invoke(dispid, kind, args, nArgs, result);
+}
+
+// ------------------
+// Typed entry points
+// ------------------
+//
+// Numeric results are converted between int, double and bool the way
+// VariantChangeType would, so a driver that returns a Single or an
+// Integer for a Double property still works.
+//
+int DispatchInvoker::GetInteger(DispatchTarget &target, DriverMember m, int &val)
+{
+	DispatchValue res;
+	int status = Invoke(target, m, DK_GET, NULL, 0, &res);
+
+	if(status != DI_OK)
+		return status;
+	switch(res.type)
+	{
+		case DispatchValue::DV_INT:		val = res.intVal; break;
+		case DispatchValue::DV_DOUBLE:	val = (int)(res.dblVal < 0 ? res.dblVal - 0.5 : res.dblVal + 0.5); break;
+		case DispatchValue::DV_BOOL:	val = (res.boolVal ? -1 : 0); break;
+		default:
+			delete[] res.strVal;
+			return DI_FAILED;
+	}
+	return DI_OK;
+}
+
+int DispatchInvoker::GetDouble(DispatchTarget &target, DriverMember m, double &val)
+{
+	DispatchValue res;
+	int status = Invoke(target, m, DK_GET, NULL, 0, &res);
+
+	if(status != DI_OK)
+		return status;
+	switch(res.type)
+	{
+		case DispatchValue::DV_DOUBLE:	val = res.dblVal; break;
+		case DispatchValue::DV_INT:		val = res.intVal; break;
+		default:
+			delete[] res.strVal;
+			return DI_FAILED;
+	}
+	return DI_OK;
+}
+
+int DispatchInvoker::SetDouble(DispatchTarget &target, DriverMember m, double val)
+{
+	DispatchValue arg, res;
+
+	arg.type = DispatchValue::DV_DOUBLE;
+	arg.dblVal = val;
+	return Invoke(target, m, DK_PUT, &arg, 1, &res);
+}
+
+int DispatchInvoker::GetBool(DispatchTarget &target, DriverMember m, bool &val)
+{
+	DispatchValue res;
+	int status = Invoke(target, m, DK_GET, NULL, 0, &res);
+
+	if(status != DI_OK)
+		return status;
+	switch(res.type)
+	{
+		case DispatchValue::DV_BOOL:	val = res.boolVal; break;
+		case DispatchValue::DV_INT:		val = (res.intVal != 0); break;
+		default:
+			delete[] res.strVal;
+			return DI_FAILED;
+	}
+	return DI_OK;
+}
+
+int DispatchInvoker::SetBool(DispatchTarget &target, DriverMember m, bool val)
+{
+	DispatchValue arg, res;
+
+	arg.type = DispatchValue::DV_BOOL;
+	arg.boolVal = val;
+	return Invoke(target, m, DK_PUT, &arg, 1, &res);
+}
+
+//
+// On success val is new[]'ed and the caller must delete[] it.
+//
+int DispatchInvoker::GetString(DispatchTarget &target, DriverMember m, char *&val)
+{
+	DispatchValue res;
+	int status = Invoke(target, m, DK_GET, NULL, 0, &res);
+
+	if(status != DI_OK)
+		return status;
+	if(res.type != DispatchValue::DV_STRING || res.strVal == NULL)
+		return DI_FAILED;
+	val = res.strVal;
+	return DI_OK;
+}
+
+int DispatchInvoker::Call(DispatchTarget &target, DriverMember m)
+{
+	DispatchValue res;
+	int status = Invoke(target, m, DK_METHOD, NULL, 0, &res);
+
+	if(status == DI_OK)
+		delete[] res.strVal;									// Methods used here return nothing
+	return status;
+}
+
+int DispatchInvoker::CallWithRaDec(DispatchTarget &target, DriverMember m, double dRA, double dDec)
+{
+	DispatchValue args[2], res;
+	int status;
+
+	args[0].type = DispatchValue::DV_DOUBLE;
+	args[0].dblVal = dRA;
+	args[1].type = DispatchValue::DV_DOUBLE;
+	args[1].dblVal = dDec;
+	status = Invoke(target, m, DK_METHOD, args, 2, &res);
+	if(status == DI_OK)
+		delete[] res.strVal;
+	return status;
+}
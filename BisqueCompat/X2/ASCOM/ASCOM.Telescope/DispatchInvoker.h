@@ -0,0 +1,167 @@
+//========================================================================
+//
+// TITLE:		DispatchInvoker.h
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Typed calls into the Telescope driver by member number. The
+//				DISPID of each member is looked up once per connected driver
+//				and kept in a table; members the driver does not have are
+//				remembered too, so optional V2 properties are not looked up
+//				again on every poll.
+//
+// USING:		Portable C++, no Windows or COM headers. The COM side is the
+//				DispatchTarget implementation in DriverInterface.cpp, which
+//				converts to and from VARIANTs. DispatchInvokerTest.cpp runs
+//				the invoker against a fake target.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef DISPATCHINVOKER_H
+#define DISPATCHINVOKER_H
+
+//
+// Telescope members used by the plug-in. Add new ones here; the enum and
+// the name table are both generated from this list.
+//
+#define DRIVER_MEMBERS(X) \
+	X(AbortSlew) \
+	X(AlignmentMode) \
+	X(AtPark) \
+	X(CanPark) \
+	X(CanSetDeclinationRate) \
+	X(CanSetPark) \
+	X(CanSetRightAscensionRate) \
+	X(CanSetTracking) \
+	X(CanSlew) \
+	X(CanSlewAltAz) \
+	X(CanSlewAsync) \
+	X(CanSync) \
+	X(CanUnpark) \
+	X(Connected) \
+	X(Declination) \
+	X(DeclinationRate) \
+	X(Description) \
+	X(DoesRefraction) \
+	X(DriverInfo) \
+	X(DriverVersion) \
+	X(InterfaceVersion) \
+	X(Name) \
+	X(Park) \
+	X(RightAscension) \
+	X(RightAscensionRate) \
+	X(SetPark) \
+	X(SideOfPier) \
+	X(SiteLatitude) \
+	X(SiteLongitude) \
+	X(SlewToCoordinates) \
+	X(SlewToCoordinatesAsync) \
+	X(Slewing) \
+	X(SyncToCoordinates) \
+	X(Tracking) \
+	X(Unpark)
+
+#define DRIVER_MEMBER_ENUM(n) DM_##n,
+enum DriverMember
+{
+	DRIVER_MEMBERS(DRIVER_MEMBER_ENUM)
+	DM_COUNT
+};
+#undef DRIVER_MEMBER_ENUM
+
+//
+// Call status
+//
+enum
+{
+	DI_OK = 0,
+	DI_NOTFOUND,												// Driver has no such member
+	DI_NOTIMPL,													// Driver raised the not-implemented error
+	DI_FAILED													// Any other failure
+};
+
+//
+// Kind of call
+//
+enum
+{
+	DK_GET = 0,
+	DK_PUT,
+	DK_METHOD
+};
+
+//
+// Argument or result. Plain data so it can live inside __try blocks.
+//
+struct DispatchValue
+{
+	enum { DV_EMPTY = 0, DV_INT, DV_DOUBLE, DV_BOOL, DV_STRING };
+	int type;
+	int intVal;
+	double dblVal;
+	bool boolVal;
+	char *strVal;												// new[]'ed ANSI; receiver must delete[]
+};
+
+// --------------
+// DispatchTarget
+// --------------
+//
+// What the invoker needs from the driver's IDispatch. Arguments are
+// passed in left to right order.
+//
+class DispatchTarget
+{
+public:
+	virtual bool GetID(const wchar_t *name, long &dispid) = 0;
+	virtual int Invoke(long dispid, int kind, const DispatchValue *args, int nArgs, DispatchValue *result) = 0;
+};
+
+// ---------------
+// DispatchInvoker
+// ---------------
+//
+// Not thread safe; DriverInterface.cpp calls it under its critical section.
+//
+class DispatchInvoker
+{
+public:
+	DispatchInvoker();
+
+	void Reset();												// Forget all DISPIDs (new driver)
+
+	int GetInteger(DispatchTarget &target, DriverMember m, int &val);
+	int GetDouble(DispatchTarget &target, DriverMember m, double &val);
+	int SetDouble(DispatchTarget &target, DriverMember m, double val);
+	int GetBool(DispatchTarget &target, DriverMember m, bool &val);
+	int SetBool(DispatchTarget &target, DriverMember m, bool val);
+	int GetString(DispatchTarget &target, DriverMember m, char *&val);
+	int Call(DispatchTarget &target, DriverMember m);
+	int CallWithRaDec(DispatchTarget &target, DriverMember m, double dRA, double dDec);
+
+	unsigned long Lookups() const { return _lookups; }
+	unsigned long Invokes() const { return _invokes; }
+
+	static const char *Name(DriverMember m);
+	static const wchar_t *WideName(DriverMember m);
+
+protected:
+	int Lookup(DispatchTarget &target, DriverMember m, long &dispid);
+	int Invoke(DispatchTarget &target, DriverMember m, int kind, const DispatchValue *args, int nArgs, DispatchValue *result);
+
+	enum { ID_UNKNOWN = 0, ID_RESOLVED, ID_MISSING };
+	long _dispids[DM_COUNT];
+	char _state[DM_COUNT];
+	unsigned long _lookups;										// GetID calls made
+	unsigned long _invokes;										// Invoke calls made
+};
+
+#endif
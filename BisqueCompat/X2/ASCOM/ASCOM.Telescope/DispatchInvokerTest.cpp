@@ -0,0 +1,226 @@
+//========================================================================
+//
+// TITLE:		DispatchInvokerTest.cpp
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Test program for DispatchInvoker against a fake dispatch
+//				table that counts lookups and calls. Not part of the plug-in
+//				build; on Linux:
+//
+//				g++ -o DispatchInvokerTest DispatchInvoker.cpp DispatchInvokerTest.cpp
+//				./DispatchInvokerTest
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		PASS/FAIL reporting from TestCheck.h
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+#include <time.h>
+#include "DispatchInvoker.h"
+#include "../../../../PluginCommon/TestCheck.h"
+
+// ------------
+// FakeDispatch
+// ------------
+//
+// A mount with a few properties. Members not in the table are missing;
+// RightAscensionRate raises not-implemented, as a V2 driver may.
+//
+class FakeDispatch : public DispatchTarget
+{
+public:
+	enum { ID_RA = 101, ID_DEC, ID_SLEWING, ID_TRACKING, ID_SOP, ID_NAME, ID_SYNC, ID_RARATE, ID_ALIGN };
+
+	unsigned long getIDCalls;
+	unsigned long invokeCalls;
+	double ra, dec;
+	bool tracking;
+	double syncRA, syncDec;
+	int lastKind;
+
+	FakeDispatch()
+	{
+		getIDCalls = invokeCalls = 0;
+		ra = 12.5;
+		dec = -30.25;
+		tracking = false;
+		syncRA = syncDec = 0.0;
+		lastKind = -1;
+	}
+
+	bool GetID(const wchar_t *name, long &dispid)
+	{
+		static const struct { const wchar_t *name; long id; } table[] =
+		{
+			{ L"RightAscension", ID_RA },
+			{ L"Declination", ID_DEC },
+			{ L"Slewing", ID_SLEWING },
+			{ L"Tracking", ID_TRACKING },
+			{ L"SideOfPier", ID_SOP },
+			{ L"Name", ID_NAME },
+			{ L"SyncToCoordinates", ID_SYNC },
+			{ L"RightAscensionRate", ID_RARATE },
+			{ L"AlignmentMode", ID_ALIGN }
+		};
+
+		getIDCalls++;
+		for(unsigned i = 0; i < sizeof(table) / sizeof(table[0]); i++)
+		{
+			if(wcscmp(name, table[i].name) == 0)
+			{
+				dispid = table[i].id;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int Invoke(long dispid, int kind, const DispatchValue *args, int nArgs, DispatchValue *result)
+	{
+		invokeCalls++;
+		lastKind = kind;
+		switch(dispid)
+		{
+			case ID_RA:
+				result->type = DispatchValue::DV_DOUBLE;
+				result->dblVal = ra;
+				return DI_OK;
+			case ID_DEC:
+				result->type = DispatchValue::DV_DOUBLE;
+				result->dblVal = dec;
+				return DI_OK;
+			case ID_SLEWING:
+				result->type = DispatchValue::DV_BOOL;
+				result->boolVal = false;
+				return DI_OK;
+			case ID_TRACKING:
+				if(kind == DK_PUT)
+				{
+					if(nArgs != 1 || args[0].type != DispatchValue::DV_BOOL)
+						return DI_FAILED;
+					tracking = args[0].boolVal;
+					return DI_OK;
+				}
+				result->type = DispatchValue::DV_BOOL;
+				result->boolVal = tracking;
+				return DI_OK;
+			case ID_SOP:
+				result->type = DispatchValue::DV_INT;
+				result->intVal = 1;
+				return DI_OK;
+			case ID_ALIGN:
+				result->type = DispatchValue::DV_DOUBLE;			// Driver returns the wrong type
+				result->dblVal = 2.0;
+				return DI_OK;
+			case ID_NAME:
+				result->type = DispatchValue::DV_STRING;
+				result->strVal = new char[8];
+				strcpy(result->strVal, "FakeMnt");
+				return DI_OK;
+			case ID_SYNC:
+				if(kind != DK_METHOD || nArgs != 2)
+					return DI_FAILED;
+				syncRA = args[0].dblVal;
+				syncDec = args[1].dblVal;
+				return DI_OK;
+			case ID_RARATE:
+				return DI_NOTIMPL;
+		}
+		return DI_FAILED;
+	}
+};
+
+int main()
+{
+	FakeDispatch fake;
+	DispatchInvoker invoker;
+	double ra = 0.0, dec = 0.0;
+	bool b = true;
+	int i = 0;
+	char *s = NULL;
+	int n;
+
+	//
+	// Names come from the member list
+	//
+	check(strcmp(DispatchInvoker::Name(DM_RightAscension), "RightAscension") == 0 &&
+			wcscmp(DispatchInvoker::WideName(DM_SyncToCoordinates), L"SyncToCoordinates") == 0,
+			"names: generated from the member list");
+
+	//
+	// The first read looks the DISPID up, later reads do not
+	//
+	check(invoker.GetDouble(fake, DM_RightAscension, ra) == DI_OK && ra == 12.5, "get: RightAscension");
+	check(fake.getIDCalls == 1 && fake.invokeCalls == 1 && fake.lastKind == DK_GET, "get: one lookup, one call");
+	for(n = 0; n < 1000; n++)
+	{
+		invoker.GetDouble(fake, DM_RightAscension, ra);
+		invoker.GetDouble(fake, DM_Declination, dec);
+		invoker.GetBool(fake, DM_Slewing, b);
+	}
+	check(dec == -30.25 && !b, "get: Declination and Slewing");
+	check(fake.getIDCalls == 3, "poll: each DISPID looked up once");
+	check(fake.invokeCalls == 3001 && invoker.Invokes() == 3001, "poll: one call per read");
+
+	//
+	// Put passes one typed argument
+	//
+	check(invoker.SetBool(fake, DM_Tracking, true) == DI_OK && fake.tracking && fake.lastKind == DK_PUT, "put: Tracking");
+	check(invoker.GetBool(fake, DM_Tracking, b) == DI_OK && b, "put: read back");
+
+	//
+	// Integer, coerced integer and string results
+	//
+	check(invoker.GetInteger(fake, DM_SideOfPier, i) == DI_OK && i == 1, "get: SideOfPier");
+	check(invoker.GetInteger(fake, DM_AlignmentMode, i) == DI_OK && i == 2, "get: double result coerced to integer");
+	check(invoker.GetString(fake, DM_Name, s) == DI_OK && s != NULL && strcmp(s, "FakeMnt") == 0, "get: Name");
+	delete[] s;
+	check(invoker.GetString(fake, DM_RightAscension, s) == DI_FAILED, "get: wrong type is a failure");
+
+	//
+	// Methods with arguments keep their left to right order
+	//
+	check(invoker.CallWithRaDec(fake, DM_SyncToCoordinates, 5.5, 45.0) == DI_OK &&
+			fake.syncRA == 5.5 && fake.syncDec == 45.0 && fake.lastKind == DK_METHOD, "call: SyncToCoordinates(ra, dec)");
+
+	//
+	// Missing members are remembered, not looked up again
+	//
+	unsigned long lookups = fake.getIDCalls;
+	unsigned long invokes = fake.invokeCalls;
+	check(invoker.GetBool(fake, DM_AtPark, b) == DI_NOTFOUND, "missing: AtPark not found");
+	for(n = 0; n < 100; n++)
+		invoker.GetBool(fake, DM_AtPark, b);
+	check(fake.getIDCalls == lookups + 1 && fake.invokeCalls == invokes, "missing: looked up once, never invoked");
+
+	//
+	// Not-implemented comes back as such
+	//
+	check(invoker.GetDouble(fake, DM_RightAscensionRate, ra) == DI_NOTIMPL, "notimpl: RightAscensionRate");
+
+	//
+	// Reset forgets the table for the next driver
+	//
+	lookups = fake.getIDCalls;
+	invoker.Reset();
+	invoker.GetDouble(fake, DM_RightAscension, ra);
+	invoker.GetDouble(fake, DM_RightAscension, ra);
+	check(fake.getIDCalls == lookups + 1, "reset: looked up again once");
+
+	//
+	// Cost of a cached read against the fake
+	//
+	clock_t start = clock();
+	for(n = 0; n < 1000000; n++)
+		invoker.GetDouble(fake, DM_RightAscension, ra);
+	printf("      cached read: %.1f ns\n", (double)(clock() - start) / CLOCKS_PER_SEC * 1.0e9 / 1000000.0);
+
+	return check_summary();
+}
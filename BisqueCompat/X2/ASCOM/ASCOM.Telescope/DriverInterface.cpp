@@ -58,9 +58,34 @@
 // 17-Oct-12    pwgs    1.0.3 - Ensure that SideofPier value pierUnknown
 //                      is treated as "cannot supply SideOfPier", it was being
 //                      treated as "can supply SideOfPier".
+// 17-Oct-26	asc		Route driver calls through DispatchInvoker, which
+//						looks up each DISPID once per connected driver.
+//						Property reads are only logged at Log Level 2.
+// 17-Oct-26	asc		Background MountPoller reads position and state in
+//						one batch per Poll Interval; commands invalidate
+//						its snapshot.
+// 17-Oct-26	asc		Calls are logged through the shared CallLog: records
+//						are posted without formatting and written to
+//						TheSky's log from a background thread. Polled reads
+//						are logged at most once a second per property.
+// 17-Oct-26	asc		RA/Dec reads are carried forward from the last
+//						snapshot by the shared PointingPredictor, for up to
+//						Predict Limit ms, so a slow poll does not send
+//						TheSky X back to the driver.
+// 18-Oct-26	asc		The poller no longer holds the driver lock across its
+//						calls, which with an apartment-threaded driver need
+//						the UI thread that may be waiting for that lock.
+// 18-Oct-26	asc		Lines from the log thread and error blocks from
+//						drvFail() are written to TheSky's log under one
+//						lock, so they never interleave.
+// 18-Oct-26	asc		The marshal stream is cleared as soon as it is
+//						consumed, so a failed re-marshal leaves it NULL
+//						rather than pointing at a released stream.
 //========================================================================
 
 #include "StdAfx.h"
+#include "DispatchInvoker.h"
+#include "../../../../PluginCommon/CallLog.h"
 
 #define CROSS_THREAD_GIT_OFF //MAY REQUIRE LinkFromUIThreadInterface // Use GIT cross-thread based marshalling
 #define CROSS_THREAD_CO											// Use CoMarshalXxx() based marshalling
@@ -68,6 +93,16 @@
 #define OUR_REGISTRY_BASE HKEY_LOCAL_MACHINE
 #define OUR_REGISTRY_AREA "Software\\ASCOM\\TheSky X2\\Mount"
 #define OUR_DRIVER_SEL "Current Driver ID"
+#define OUR_LOG_LEVEL "Log Level"
+#define OUR_POLL_INTERVAL "Poll Interval"
+#define OUR_PREDICT_LIMIT "Predict Limit"
+
+#define LOG_COMMANDS 1											// Log sets and method calls
+#define LOG_READS 2												// Also log property reads (very chatty)
+#define LOG_READ_INTERVAL 1000									// ms between logged reads of a polled property
+
+#define POLL_INTERVAL 250										// Default snapshot interval, ms (0 = off)
+#define PREDICT_LIMIT 2000										// Default RA/Dec extrapolation limit, ms (0 = off)
 
 const char *_szAlertTitle = "ASCOM Standard Telescope";
 const char *_szGidFailMsg = "[%s] lost link to ASCOM driver.";
@@ -102,26 +137,76 @@ bool _bDoingInit = false;										// For MaxPoint track rates hack
 LoggerInterface *_pLogger = NULL;
 static bool isParkedForV1 = false;
 static CRITICAL_SECTION _cs;
+static CRITICAL_SECTION _csLog;									// One writer at a time to TheSky's logger
+static int _iLogLevel = LOG_COMMANDS;
+static int _iPollInterval = POLL_INTERVAL;
+static int _iPredictLimit = PREDICT_LIMIT;
+
+//
+// The invoker's view of the driver. There is one static instance, pointed
+// at the current dispatch pointer under _cs, so nothing that needs
+// unwinding lives inside the __try blocks.
+//
+class DriverDispatch : public DispatchTarget
+{
+public:
+	IDispatch *pDisp;
+	EXCEPINFO excep;											// From the last failed Invoke
+	bool GetID(const wchar_t *name, long &dispid);
+	int Invoke(long dispid, int kind, const DispatchValue *args, int nArgs, DispatchValue *result);
+};
+
+static DispatchInvoker _invoker;								// DISPID table, guarded by _cs
+static DriverDispatch _target;
+
+//
+// The poller's view of the driver. It runs on the poller thread with its
+// own proxy, invoker and target, so it needs _cs only to get the proxy
+// and never holds it across a call into the driver. It never alerts;
+// anything that fails is left out of the snapshot and read directly by
+// the caller, which reports the error in the usual way.
+//
+class DriverSource : public MountSource
+{
+public:
+	IDispatch *pDisp;											// This thread's proxy, from poller_dispatch()
+	DispatchInvoker invoker;									// DISPID table, poller thread only
+	DriverDispatch target;										// Poller thread only
+	void Attach();
+	void Detach();
+	int Read(MountSnapshot &snap);
+};
+
+static MountPoller _poller;
+static DriverSource _source;
+static PointingPredictor _predictor;							// Fed from the poller, no worker of its own
+static unsigned long _lastBatch = 0;							// Poller batch last fed to it
+
+static CallLog _log;											// Formatted and written on its own thread
 
 //
 // Forward declarations
 //
-static int get_integer(OLECHAR *name, bool noAlert);
-static double get_double(OLECHAR *name);
-static void set_double(OLECHAR *name, double val);
-static bool get_bool(OLECHAR *name);
-static void set_bool(OLECHAR *name, bool val);
-static char *get_string(OLECHAR *name);
+static int get_integer(DriverMember m, bool noAlert);
+static double get_double(DriverMember m);
+static void set_double(DriverMember m, double val);
+static bool get_bool(DriverMember m);
+static void set_bool(DriverMember m, bool val);
+static char *get_string(DriverMember m);
 #ifdef CROSS_THREAD_GIT
 static void switchThreadIf();
 #endif
 #ifdef CROSS_THREAD_CO
 static IDispatch *get_dispatch();
 #endif
+static IDispatch *poller_dispatch(void);
 static void get_driverid(char *id, bool forConfig);
 static void save_driverid(char *id);
-static void call(OLECHAR *name);
-static void call_with_ra_dec(OLECHAR *name, double dRA, double dDec);
+static void call(DriverMember m);
+static void call_with_ra_dec(DriverMember m, double dRA, double dDec);
+static int get_reg_dword(const char *name, int dflt);
+static void log_sink(void *context, const char *line);
+static const char *log_name(int member);
 
 static IDispatch *_p_DrvDisp = NULL;							// [sentinel] Pointer to driver interface
 
@@ -166,6 +251,8 @@ bool InitDrivers(LoggerInterface *pLogger)
 			get_driverid(_szDriverID, true);					// Get any saved ProgID or ""
 
 			InitializeCriticalSection(&_cs);
+			InitializeCriticalSection(&_csLog);
+			_log.Start(1024, log_sink, NULL, log_name, 100);
 		}
 		__except(EXCEPTION_EXECUTE_HANDLER)
 		{
@@ -182,6 +269,8 @@ bool InitDrivers(LoggerInterface *pLogger)
 void TermDrivers(void)
 {
 	TermScope(true);
+	_log.Stop();
+	DeleteCriticalSection(&_csLog);
 	DeleteCriticalSection(&_cs);
 #ifdef CROSS_THREAD_GIT
 	if (_p_GIT != NULL)
@@ -211,6 +300,18 @@ short InitScope(void)
 		// OLESTR format.
 		//
 		get_driverid(_szDriverID, false);						// false -> must have an ID saved
+		_iLogLevel = get_reg_dword(OUR_LOG_LEVEL, LOG_COMMANDS);
+		_iPollInterval = get_reg_dword(OUR_POLL_INTERVAL, POLL_INTERVAL);
+		_iPredictLimit = get_reg_dword(OUR_PREDICT_LIMIT, PREDICT_LIMIT);
+		_log.SetRateLimit(DM_RightAscension, LOG_READ_INTERVAL);	// What TheSky X polls
+		_log.SetRateLimit(DM_Declination, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_Slewing, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_Tracking, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_AtPark, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_SideOfPier, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_RightAscensionRate, LOG_READ_INTERVAL);
+		_log.SetRateLimit(DM_DeclinationRate, LOG_READ_INTERVAL);
+		_invoker.Reset();										// New driver, new DISPIDs
 		ocProgID = ansi_to_uni(_szDriverID);
 
 		//
@@ -263,7 +364,7 @@ short InitScope(void)
 		// Connected property to TRUE.
 		//
 		_pLogger->packetsRetriesFailuresChanged(0, 0, 0);
-		set_bool(L"Connected", true);
+		set_bool(DM_Connected, true);
 
 		//
 		// At this point we should be able to call into the ASCOM scope
@@ -271,24 +372,24 @@ short InitScope(void)
 		// We call GetName, because the driver MUST support that, then
 		// grab the capabilities we need (these also MUST be supported).
 		//
-		_szScopeName = get_string(L"Name");						// Indicator label/name
-		_szScopeDescription = get_string(L"Description");
-		_szScopeDriverInfo = get_string(L"DriverInfo");
-		_bScopeCanSync = get_bool(L"CanSync");					// Can it sync?
-		_bScopeCanSlew = get_bool(L"CanSlew");					// Can it slew at all?	
-		_bScopeCanSlewAsync = get_bool(L"CanSlewAsync");		// Can it slew asynchronously?
-		_bScopeIsGEM = (get_integer(L"AlignmentMode", false) == 2);	// Is it a GEM?
-		_bScopeCanSetTracking = get_bool(L"CanSetTracking");	// Can we control its tracking?
-		_bScopeCanPark = get_bool(L"CanPark");
-		_bScopeCanUnpark = get_bool(L"CanUnpark");
-		_bScopeCanSetPark = get_bool(L"CanSetPark");
+		_szScopeName = get_string(DM_Name);						// Indicator label/name
+		_szScopeDescription = get_string(DM_Description);
+		_szScopeDriverInfo = get_string(DM_DriverInfo);
+		_bScopeCanSync = get_bool(DM_CanSync);					// Can it sync?
+		_bScopeCanSlew = get_bool(DM_CanSlew);					// Can it slew at all?	
+		_bScopeCanSlewAsync = get_bool(DM_CanSlewAsync);		// Can it slew asynchronously?
+		_bScopeIsGEM = (get_integer(DM_AlignmentMode, false) == 2);	// Is it a GEM?
+		_bScopeCanSetTracking = get_bool(DM_CanSetTracking);	// Can we control its tracking?
+		_bScopeCanPark = get_bool(DM_CanPark);
+		_bScopeCanUnpark = get_bool(DM_CanUnpark);
+		_bScopeCanSetPark = get_bool(DM_CanSetPark);
 		__try {
-			_iScopeInterfaceVersion = get_integer(L"InterfaceVersion", true);	// *SILENT* If it's there it must be at least 2
-			_szScopeDriverVersion = get_string(L"DriverVersion");
-			_bScopeCanSlewAltAz = get_bool(L"CanSlewAltAz");
-			_bScopeCanSetTrackRates = get_bool(L"CanSetRightAscensionRate") &&
-								get_bool(L"CanSetDeclinationRate");	// Too bad for mounts that can't do both
-			_bScopeDoesRefraction = get_bool(L"DoesRefraction");
+			_iScopeInterfaceVersion = get_integer(DM_InterfaceVersion, true);	// *SILENT* If it's there it must be at least 2
+			_szScopeDriverVersion = get_string(DM_DriverVersion);
+			_bScopeCanSlewAltAz = get_bool(DM_CanSlewAltAz);
+			_bScopeCanSetTrackRates = get_bool(DM_CanSetRightAscensionRate) &&
+								get_bool(DM_CanSetDeclinationRate);	// Too bad for mounts that can't do both
+			_bScopeDoesRefraction = get_bool(DM_DoesRefraction);
 		} __except(EXCEPTION_EXECUTE_HANDLER) {
 			_iScopeInterfaceVersion = 1;
 			_szScopeDriverVersion = uni_to_ansi(L"V1 Interface");
@@ -311,7 +412,7 @@ short InitScope(void)
 		// Determine if it reports SOP (pointing state)
 		//
 		__try {
-			if (get_integer(L"SideOfPier", true) == -1)         // *SILENT*
+			if (get_integer(DM_SideOfPier, true) == -1)         // *SILENT*
 			{
 				_bScopeCanSideOfPier = false;                   // Received pierUnknown (-1) so flag as cannot determine SideOfPier
 			}					
@@ -328,7 +429,7 @@ short InitScope(void)
 		//
 		if(_iScopeInterfaceVersion == 1 && _bScopeCanUnpark)
 		{
-			call(L"Unpark");
+			call(DM_Unpark);
 			isParkedForV1 = false;
 		}
 
@@ -338,8 +439,8 @@ short InitScope(void)
 		//
 		if(_bScopeCanSetTracking && 
 					(!_bScopeCanPark || !GetAtPark()) &&		// GetAtPark is V1/V2 aware
-					!get_bool(L"Tracking"))
-			set_bool(L"Tracking", true);
+					!get_bool(DM_Tracking))
+			set_bool(DM_Tracking, true);
 		//
 		// If the scope has tracking rates, turn them off. But don't
 		// do this if parked.
@@ -352,9 +453,9 @@ short InitScope(void)
 			//
 			__try {
 				_bDoingInit = true;								// Silence errors temporatily
-				get_double(L"RightAscensionRate");
-				set_double(L"RightAscensionRate", 0.0);
-				set_double(L"DeclinationRate", 0.0);
+				get_double(DM_RightAscensionRate);
+				set_double(DM_RightAscensionRate, 0.0);
+				set_double(DM_DeclinationRate, 0.0);
 			} __except(EXCEPTION_EXECUTE_HANDLER) {
 				_bScopeCanSetTrackRates = false;
 			}
@@ -364,6 +465,26 @@ short InitScope(void)
 		// Done!
 		//
 		_bScopeActive = true;									// We're off and running!
+
+		//
+		// Start the snapshot poller. A stale snapshot is worse than a
+		// slow one, so nothing older than a few intervals is used.
+		//
+		if(_iPollInterval > 0)
+		{
+			_source.pDisp = NULL;
+			_poller.Start(&_source, _iPollInterval, _iPollInterval * 3 + 500);
+		}
+
+		//
+		// Between snapshots, RA/Dec is carried forward from the last one
+		// for up to Predict Limit. The poller is what resyncs it.
+		//
+		if(_iPredictLimit > 0)
+		{
+			_lastBatch = 0;
+			_predictor.Start(NULL, _iPredictLimit, _iPredictLimit);
+		}
 	}
 	__except(EXCEPTION_EXECUTE_HANDLER)
 	{
@@ -385,14 +506,10 @@ short InitScope(void)
 //
 void TermScope(bool bestEfforts)
 {
-	OLECHAR *name = L"Connected";
-	DISPID dispid;
-	DISPID didPut = DISPID_PROPERTYPUT;
-	DISPPARAMS dispParms;
-	VARIANTARG rgvarg[1];
-	EXCEPINFO excep;
-	VARIANT vRes;
-	HRESULT hr;
+	int status;
+
+	_poller.Stop();												// Before the driver goes away
+	_predictor.Stop();
 
 	if(_p_DrvDisp != NULL)										// Just in case! (see termPlugin())
 	{
@@ -412,31 +529,17 @@ void TermScope(bool bestEfforts)
 		// US because its call to TermScope() passses true, while all
 		// others pass false.
 		//
-		if(!bestEfforts && FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-			drvFail(
-				"Connected = False failed.",
-				NULL, false);
-
-		rgvarg[0].vt = VT_BOOL;
-		rgvarg[0].boolVal = VARIANT_FALSE;
-		dispParms.cArgs = 1;
-		dispParms.rgvarg = rgvarg;
-		dispParms.cNamedArgs = 1;								// PropPut kludge
-		dispParms.rgdispidNamedArgs = &didPut;
-		if(!bestEfforts && FAILED(hr = _p_DrvDisp->Invoke(
-			dispid,
-			IID_NULL, 
-			LOCALE_USER_DEFAULT, 
-			DISPATCH_PROPERTYPUT, 
-			&dispParms, 
-			&vRes,
-			&excep, NULL)))
-			drvFail("Connected = False failed.", &excep, true);	// Don't call us back!
+		if(!bestEfforts)
+		{
+			_target.pDisp = _p_DrvDisp;
+			status = _invoker.SetBool(_target, DM_Connected, false);
+			if(status == DI_NOTFOUND)
+				drvFail(
+					"Connected = False failed.",
+					NULL, false);
+			else if(status != DI_OK)
+				drvFail("Connected = False failed.", &_target.excep, true);	// Don't call us back!
+		}
 
 #ifdef CROSS_THREAD_GIT
 		_p_GIT->RevokeInterfaceFromGlobal(dwIntfcCookie);		// We're done with this driver/object
@@ -445,7 +548,9 @@ void TermScope(bool bestEfforts)
 #endif
 #ifdef CROSS_THREAD_CO
 		// Best efforts
-		if(CoGetInterfaceAndReleaseStream(_pMarshalStream, IID_IDispatch, (LPVOID *)&_p_DrvDisp) == S_OK)
+		LPSTREAM pStream = _pMarshalStream;
+		_pMarshalStream = NULL;
+		if(pStream != NULL && CoGetInterfaceAndReleaseStream(pStream, IID_IDispatch, (LPVOID *)&_p_DrvDisp) == S_OK)
 		{
 			//** TODO ** WTF? I could never get the refcounts right on the GIT method.
 			// Using these CoXxx() calls, I'm close, but I end up with an extra reference
@@ -483,9 +588,90 @@ void TermScope(bool bestEfforts)
 		delete[] _szScopeDriverVersion;
 	_szScopeDriverVersion = NULL;
 
+	_invoker.Reset();
 	_bScopeActive = false;
 }
 
+// -----------
+// GetSnapshot
+// -----------
+//
+// Latest poller snapshot, if it is fresh and has all of the given fields.
+// Never blocks; if this returns false, read the driver directly.
+//
+bool GetSnapshot(MountSnapshot &snap, unsigned fields)
+{
+	if(!_bScopeActive || !_poller.Get(snap))
+		return false;
+	return ((snap.valid & fields) == fields);
+}
+
+// ------------
+// PredictRaDec
+// ------------
+//
+// RA/Dec now, carried forward from the last snapshot or direct read by
+// the tracking state and rates. Feeds the predictor any new snapshot
+// first. Never blocks; if this returns false, read the driver directly
+// and pass the result to NoteRaDec().
+//
+bool PredictRaDec(double &ra, double &dec)
+{
+	MountSnapshot snap;
+	unsigned need = MountSnapshot::MS_RADEC | MountSnapshot::MS_SLEWING | MountSnapshot::MS_TRACKING;
+
+	if(!_bScopeActive || !_predictor.IsRunning())
+		return false;
+	if(_poller.Get(snap) && snap.batch != _lastBatch && (snap.valid & MountSnapshot::MS_RADEC))
+	{
+		PointingFix fix;
+
+		_lastBatch = snap.batch;
+		memset(&fix, 0, sizeof(fix));
+		fix.valid = PointingFix::PF_POSITION;
+		fix.tick = snap.tick;
+		fix.ra = snap.ra;
+		fix.dec = snap.dec;
+		if((snap.valid & need) == need)
+		{
+			fix.slewing = snap.slewing;
+			fix.tracking = snap.tracking;
+			if(!fix.tracking || !_bScopeCanSetTrackRates)		// Sidereal, or drifting
+				fix.valid |= PointingFix::PF_MOTION;
+			else if(snap.valid & MountSnapshot::MS_RATES)
+			{
+				fix.raRate = snap.raRate;
+				fix.decRate = snap.decRate;
+				fix.valid |= PointingFix::PF_MOTION;
+			}
+		}
+		_predictor.Update(fix);
+	}
+	return _predictor.Predict(PointingPredictor::TickCount(), ra, dec);
+}
+
+// ---------
+// NoteRaDec
+// ---------
+//
+// A direct RA/Dec read, taken at tick. Keeps the predictor current when
+// the poller is off or behind; the tracking state comes from the last
+// snapshot.
+//
+void NoteRaDec(unsigned long tick, double ra, double dec)
+{
+	PointingFix fix;
+
+	if(!_predictor.IsRunning())
+		return;
+	memset(&fix, 0, sizeof(fix));
+	fix.valid = PointingFix::PF_POSITION;
+	fix.tick = tick;
+	fix.ra = ra;
+	fix.dec = dec;
+	_predictor.Update(fix);
+}
+
 // --------------
 // GetCanPierSide
 // --------------
@@ -501,7 +687,7 @@ bool GetCanPierSide(void)
 //
 double GetRightAscension(void)
 {
-	return(get_double(L"RightAscension"));
+	return(get_double(DM_RightAscension));
 }
 
 // ---------------------
@@ -510,7 +696,7 @@ double GetRightAscension(void)
 //
 double GetRightAscensionRate(void)
 {
-	return(get_double(L"RightAscensionRate"));
+	return(get_double(DM_RightAscensionRate));
 }
 
 // --------------
@@ -519,7 +705,7 @@ double GetRightAscensionRate(void)
 //
 double GetDeclination(void)
 {
-	return(get_double(L"Declination"));
+	return(get_double(DM_Declination));
 }
 
 // ------------------
@@ -528,7 +714,7 @@ double GetDeclination(void)
 //
 double GetDeclinationRate(void)
 {
-	return(get_double(L"DeclinationRate"));
+	return(get_double(DM_DeclinationRate));
 }
 
 // ---------
@@ -538,7 +724,7 @@ double GetDeclinationRate(void)
 bool GetAtPark(void)
 {
 	if (_iScopeInterfaceVersion > 1)
-		return(get_bool(L"AtPark"));
+		return(get_bool(DM_AtPark));
 	else
 		return isParkedForV1;
 }
@@ -548,7 +734,7 @@ bool GetAtPark(void)
 // -----------
 bool GetTracking(void)
 {
-	return(get_bool(L"Tracking"));
+	return(get_bool(DM_Tracking));
 }
 
 // -----------
@@ -556,7 +742,7 @@ bool GetTracking(void)
 // -----------
 void SetTracking(bool state)
 {
-	set_bool(L"Tracking", state);
+	set_bool(DM_Tracking, state);
 }
 
 // ---------------------
@@ -565,7 +751,7 @@ void SetTracking(bool state)
 //
 void SetRightAscensionRate(double rate)
 {
-	set_double(L"RightAscensionRate", rate);
+	set_double(DM_RightAscensionRate, rate);
 }
 
 // ------------------
@@ -574,7 +760,7 @@ void SetRightAscensionRate(double rate)
 //
 void SetDeclinationRate(double rate)
 {
-	set_double(L"DeclinationRate", rate);
+	set_double(DM_DeclinationRate, rate);
 }
 
 // -----------
@@ -583,7 +769,7 @@ void SetDeclinationRate(double rate)
 //
 void SetLatitude(double lat)
 {
-	set_double(L"SiteLatitude", lat);
+	set_double(DM_SiteLatitude, lat);
 }
 
 // ------------
@@ -592,7 +778,7 @@ void SetLatitude(double lat)
 //
 void SetLongitude(double lng)
 {
-	set_double(L"SiteLongitude", lng);
+	set_double(DM_SiteLongitude, lng);
 }
 
 // ----------
@@ -601,7 +787,7 @@ void SetLongitude(double lng)
 //
 bool IsPierWest(void)
 {
-	int sp = get_integer(L"SideOfPier", false);
+	int sp = get_integer(DM_SideOfPier, false);
 	return(sp == 1);
 }
 
@@ -611,7 +797,7 @@ bool IsPierWest(void)
 //
 bool IsSlewing(void)
 {
-	return get_bool(L"Slewing");
+	return get_bool(DM_Slewing);
 }
 
 //
@@ -623,7 +809,7 @@ bool IsSlewing(void)
 //
 void SlewScope(double dRA, double dDec)
 {
-	OLECHAR *name;
+	DriverMember m;
 
 	if(!_bScopeActive)											// No scope hookup?
 		ABORT;
@@ -632,11 +818,11 @@ void SlewScope(double dRA, double dDec)
 	// Fall back to sync slewing if async not supported.
 	//
 	if(_bScopeCanSlewAsync)
-		name = L"SlewToCoordinatesAsync";
+		m = DM_SlewToCoordinatesAsync;
 	else
-		name = L"SlewToCoordinates";
+		m = DM_SlewToCoordinates;
 
-	call_with_ra_dec(name, dRA, dDec);
+	call_with_ra_dec(m, dRA, dDec);
 }
 
 // ---------
@@ -648,7 +834,7 @@ void AbortSlew(void)
 	if(!_bScopeActive)										// No scope hookup?
 		ABORT;												// Forget this
 
-	call(L"AbortSlew");
+	call(DM_AbortSlew);
 }
 
 //	---------
@@ -664,7 +850,7 @@ void SyncScope(double dRA, double dDec)
 	if(!_bScopeActive)										// No scope hookup?
 		ABORT;												// Forget this
 
-	call_with_ra_dec(L"SyncToCoordinates", dRA, dDec);
+	call_with_ra_dec(DM_SyncToCoordinates, dRA, dDec);
 }	
 
 // ---------
@@ -676,9 +862,11 @@ void ParkScope(void)
 	if(!_bScopeActive)										// No scope hookup?
 		ABORT;												// Forget this
 
-	call(L"Park");
+	call(DM_Park);
 	
 	isParkedForV1 = true;
+	_poller.Invalidate();									// V1 park state is ours, see DriverSource::Read()
+	_predictor.Invalidate();
 }
 
 // -----------
@@ -690,9 +878,11 @@ void UnparkScope(void)
 	if(!_bScopeActive)										// No scope hookup?
 		ABORT;												// Forget this
 
-	call(L"Unpark");
+	call(DM_Unpark);
 	
 	isParkedForV1 = false;
+	_poller.Invalidate();									// V1 park state is ours, see DriverSource::Read()
+	_predictor.Invalidate();
 }
 
 // ------------
@@ -704,7 +894,7 @@ void SetParkScope(void)
 	if(!_bScopeActive)										// No scope hookup?
 		ABORT;												// Forget this
 
-	call(L"SetPark");
+	call(DM_SetPark);
 }
 
 // -----------
@@ -856,6 +1046,26 @@ void SaveDriverID(char *id)
 	save_driverid(id);
 }
 
+// --------
+// LogLines
+// --------
+//
+// Write lines to TheSky's log directly (see drvFail()). Queued call
+// records are let out first; the lines go out under the log lock, so
+// even if the flush times out they are not interleaved with lines
+// from the log thread.
+//
+void LogLines(const char *lines[], int count)
+{
+	int i;
+
+	_log.Flush(500);
+	EnterCriticalSection(&_csLog);
+	for(i = 0; i < count; i++)
+		_pLogger->out(lines[i]);
+	LeaveCriticalSection(&_csLog);
+}
+
 
 // ===============
 // LOCAL UTILITIES
@@ -952,97 +1162,263 @@ static void save_driverid(char *id)
 
 }
 
-// -------------
-// get_integer()
-// -------------
+// ---------------
+// get_reg_dword()
+// ---------------
 //
-// Get a named integer property. The optional argument
-// allows trying silently for a property, only raising
-// an exception.
+// Optional tuning value from the registry (a DWORD in our area), such as
+// the "Log Level" and "Poll Interval". Property reads are polled several
+// times a second by TheSky X, so by default only commands are logged.
 //
-static int get_integer(OLECHAR *name, bool noAlert)
+static int get_reg_dword(const char *name, int dflt)
 {
-	DISPID dispid;
-	VARIANT result;
+	HKEY hKey;
+	DWORD dwType;
+	DWORD dwSize = sizeof(DWORD);
+	DWORD dwVal = (DWORD)dflt;
+
+	if(RegOpenKeyEx(OUR_REGISTRY_BASE, OUR_REGISTRY_AREA, 0, KEY_READ, &hKey) == ERROR_SUCCESS)
+	{
+		if(RegQueryValueEx(hKey, name, NULL, &dwType, (BYTE *)&dwVal, &dwSize) != ERROR_SUCCESS ||
+				dwType != REG_DWORD)
+			dwVal = (DWORD)dflt;
+		RegCloseKey(hKey);
+	}
+	return (int)dwVal;
+}
+
+// ----------
+// log_sink()
+// log_name()
+// ----------
+//
+// CallLog callbacks, called on the log thread. Lines are written under
+// the same lock as LogLines().
+//
+static void log_sink(void *context, const char *line)
+{
+	EnterCriticalSection(&_csLog);
+	_pLogger->out(line);
+	LeaveCriticalSection(&_csLog);
+}
+
+static const char *log_name(int member)
+{
+	return DispatchInvoker::Name((DriverMember)member);
+}
+
+// ---------------------------
+// DriverDispatch::GetID()
+// DriverDispatch::Invoke()
+// ---------------------------
+//
+// DispatchTarget over the driver's IDispatch, for the invoker. Arguments
+// come in left to right and go to COM right to left.
+//
+bool DriverDispatch::GetID(const wchar_t *name, long &dispid)
+{
+	OLECHAR *on = (OLECHAR *)name;
+	DISPID did;
+
+	if(FAILED(pDisp->GetIDsOfNames(
+		IID_NULL, 
+		&on, 
+		1, 
+		LOCALE_USER_DEFAULT,
+		&did)))
+		return false;
+	dispid = did;
+	return true;
+}
+
+int DriverDispatch::Invoke(long dispid, int kind, const DispatchValue *args, int nArgs, DispatchValue *result)
+{
+	VARIANTARG rgvarg[2];
+	VARIANT vRes;
+	DISPID ppdispid[1];
 	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
+	WORD wFlags;
+	int i;
 
-	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
+	if(nArgs > 2)
+		return DI_FAILED;
+	for(i = 0; i < nArgs; i++)
+	{
+		VARIANTARG *va = &rgvarg[nArgs - 1 - i];				// Arg order is R->L
+		switch(args[i].type)
 		{
-			if (noAlert)
-			{
-				NOTIMPL;												// Optional, resignal silently
-			}
-			else
-			{
-				wsprintf(buf, _szGidFailMsg, cp);
-				delete[] cp;
-				drvFail(buf, NULL, true);
-			}
+			case DispatchValue::DV_INT:
+				va->vt = VT_I4;
+				va->lVal = args[i].intVal;
+				break;
+			case DispatchValue::DV_DOUBLE:
+				va->vt = VT_R8;
+				va->dblVal = args[i].dblVal;
+				break;
+			case DispatchValue::DV_BOOL:
+				va->vt = VT_BOOL;
+				va->boolVal = (args[i].boolVal ? VARIANT_TRUE : VARIANT_FALSE);	// Translate to Variant Bool
+				break;
+			default:
+				return DI_FAILED;
 		}
-
+	}
+	dispparms.cArgs = nArgs;
+	dispparms.rgvarg = (nArgs > 0 ? rgvarg : NULL);
+	if(kind == DK_PUT)
+	{
 		//
-		// No dispatch parameters for propget
+		// Special setup for propput (See MSKB Q175618)
 		//
-		dispparms.cArgs = 0;
-		dispparms.rgvarg = NULL;
+		ppdispid[0] = DISPID_PROPERTYPUT;
+		dispparms.cNamedArgs = 1;
+		dispparms.rgdispidNamedArgs = ppdispid;
+		wFlags = DISPATCH_PROPERTYPUT;
+	}
+	else
+	{
 		dispparms.cNamedArgs = 0;
 		dispparms.rgdispidNamedArgs = NULL;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_PROPERTYGET,
-						 &dispparms, 
-						 &result, 
-						 &excep, 
-						 NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
+		wFlags = (kind == DK_GET ? DISPATCH_PROPERTYGET : DISPATCH_METHOD);
+	}
+
+	memset(&excep, 0, sizeof(excep));
+	VariantInit(&vRes);
+	if(FAILED(pDisp->Invoke((DISPID)dispid, 
+					 IID_NULL, 
+					 LOCALE_USER_DEFAULT, 
+					 wFlags,
+					 &dispparms, 
+					 &vRes, 
+					 &excep, 
+					 NULL)))
+		return (excep.scode == EXCEP_NOTIMPL ? DI_NOTIMPL : DI_FAILED);
+
+	switch(vRes.vt)
+	{
+		case VT_EMPTY:
+			break;
+		case VT_I2:
+			result->type = DispatchValue::DV_INT;
+			result->intVal = vRes.iVal;
+			break;
+		case VT_I4:
+			result->type = DispatchValue::DV_INT;
+			result->intVal = vRes.lVal;
+			break;
+		case VT_INT:
+			result->type = DispatchValue::DV_INT;
+			result->intVal = vRes.intVal;
+			break;
+		case VT_BOOL:
+			result->type = DispatchValue::DV_BOOL;
+			result->boolVal = (vRes.boolVal != VARIANT_FALSE);
+			break;
+		case VT_BSTR:
+			result->type = DispatchValue::DV_STRING;
+			result->strVal = uni_to_ansi(vRes.bstrVal != NULL ? vRes.bstrVal : (OLECHAR *)L"");
+			break;
+		default:
+			if(SUCCEEDED(VariantChangeType(&vRes, &vRes, 0, VT_R8)))
 			{
-				cp = uni_to_ansi(name);
-				wsprintf(buf, 
-					 "Internal error reading from the %s property.", cp);
-				delete[] cp;
-				drvFail(buf, &excep, true);
+				result->type = DispatchValue::DV_DOUBLE;
+				result->dblVal = vRes.dblVal;
 			}
-		}
+			break;
 	}
-	__finally
-	{
+	VariantClear(&vRes);
+	return DI_OK;
+}
+
+// ------------------------------
+// enter_driver() / leave_driver()
+// ------------------------------
+//
+// Bracket every driver call: take the lock and point the invoker's target
+// at a dispatch pointer that is valid on this thread. Always used as
+// __try { enter_driver(); ... } __finally { leave_driver(); }
+//
+static void enter_driver(void)
+{
+	EnterCriticalSection(&_cs);										// ++ CRITICAL ++
+#ifdef CROSS_THREAD_GIT
+	switchThreadIf();
+#endif
 #ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
+	_p_DrvDisp = get_dispatch();
+#endif
+	_target.pDisp = _p_DrvDisp;
+}
+
+static void leave_driver(void)
+{
+#ifdef CROSS_THREAD_CO
+	_p_DrvDisp->Release();
 #endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+	LeaveCriticalSection(&_cs);										// -- NOCRITICAL --
+}
+
+// --------------
+// check_status()
+// --------------
+//
+// Turn an invoker status into our exceptions. Call inside the __try so
+// the driver's EXCEPINFO is still ours. If optional, a NOTIMPL from the
+// driver is resignalled silently and lets upstream code decide what to
+// do; if noAlert, so is a missing member.
+//
+static void check_status(int status, DriverMember m, const char *fmt, bool optional, bool noAlert)
+{
+	char buf[256];
+
+	switch(status)
+	{
+		case DI_OK:
+			return;
+
+		case DI_NOTFOUND:
+			if(noAlert)
+				NOTIMPL;											// Optional, resignal silently
+			wsprintf(buf, _szGidFailMsg, DispatchInvoker::Name(m));
+			drvFail(buf, NULL, true);
+			break;
+
+		case DI_NOTIMPL:
+			if(optional)
+				NOTIMPL;											// Resignal silently
+			// Fall through
+		default:
+			wsprintf(buf, fmt, DispatchInvoker::Name(m));
+			drvFail(buf, &_target.excep, true);
+			break;
 	}
-	
-	sprintf(buf, "Get %s <- %i", cp, result.intVal);
-	_pLogger->out(buf);
-	delete[] cp;
+}
+
+// -------------
+// get_integer()
+// -------------
+//
+// Get a named integer property. The optional argument
+// allows trying silently for a property, only raising
+// an exception.
+//
+static int get_integer(DriverMember m, bool noAlert)
+{
+	int val = 0;
 
-	return(result.intVal);										// Return integer result
+	__try {
+		enter_driver();
+		check_status(_invoker.GetInteger(_target, m, val), m,
+				"Internal error reading from the %s property.", true, noAlert);
+	}
+	__finally
+	{
+		leave_driver();
+	}
+
+	if(_iLogLevel >= LOG_READS)
+		_log.GetInteger(m, val);
+	return(val);
 }
 
 // ------------
@@ -1053,81 +1429,23 @@ static int get_integer(OLECHAR *name, bool noAlert)
 // then this raises a NOTIMPL exception and lets upstream code
 // decide what to do.
 //
-static double get_double(OLECHAR *name)
+static double get_double(DriverMember m)
 {
-	DISPID dispid;
-	VARIANT result;
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
+	double val = 0.0;
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			delete[] cp;
-			drvFail(buf, NULL, true);
-		}
-
-		//
-		// No dispatch parameters for propget
-		//
-		dispparms.cArgs = 0;
-		dispparms.rgvarg = NULL;
-		dispparms.cNamedArgs = 0;
-		dispparms.rgdispidNamedArgs = NULL;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_PROPERTYGET,
-						 &dispparms, 
-						 &result, 
-						 &excep, 
-						 NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
-			{
-				wsprintf(buf, 
-					 "Internal error reading from the %s property.", cp);
-				delete[] cp;
-				drvFail(buf, &excep, true);
-			}
-		}
+		enter_driver();
+		check_status(_invoker.GetDouble(_target, m, val), m,
+				"Internal error reading from the %s property.", true, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
 	}
 
-	sprintf(buf, "Get %s <- %0.7f", cp, (double)result.dblVal);
-	_pLogger->out(buf);
-	delete[] cp;
-
-	return(result.dblVal);										// Return long result
+	if(_iLogLevel >= LOG_READS)
+		_log.GetDouble(m, val);
+	return(val);
 }
 
 // ------------
@@ -1138,87 +1456,22 @@ static double get_double(OLECHAR *name)
 // then this raises a NOTIMPL exception and lets upstream code
 // decide what to do.
 //
-static void set_double(OLECHAR *name, double val)
+static void set_double(DriverMember m, double val)
 {
-	DISPID dispid;
-	VARIANTARG rgvarg[1];
-	VARIANT result;
-	DISPID ppdispid[1];
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
-
-	sprintf(buf, "Set %s -> %i", cp, val);
-	_pLogger->out(buf);
+	if(_iLogLevel >= LOG_COMMANDS)
+		_log.SetDouble(m, val);
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			delete[] cp;
-			drvFail(buf, NULL, true);
-		}
-
-		//
-		// Special setup for propput (See MSKB Q175618)
-		//
-		rgvarg[0].vt = VT_R8;
-		rgvarg[0].dblVal = val;
-		dispparms.cArgs = 1;
-		dispparms.rgvarg = rgvarg;
-		ppdispid[0] = DISPID_PROPERTYPUT;
-		dispparms.cNamedArgs = 1;
-		dispparms.rgdispidNamedArgs = ppdispid;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_PROPERTYPUT,
-						 &dispparms, 
-						 &result, 
-						 &excep, 
-						 NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
-			{
-				wsprintf(buf, 
-					 "Internal error writing to the %s property.", cp);
-				delete[] cp;
-				drvFail(buf, &excep, true);
-			}
-		}
+		enter_driver();
+		check_status(_invoker.SetDouble(_target, m, val), m,
+				"Internal error writing to the %s property.", true, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
+		_poller.Invalidate();									// Mount state may have changed
+		_predictor.Invalidate();
 	}
-
-	sprintf(buf, "Set %0.7f -> %s", val, cp);
-	_pLogger->out(buf);
-	delete[] cp;
 }
 
 // ----------
@@ -1229,79 +1482,23 @@ static void set_double(OLECHAR *name, double val)
 // then this raises a NOTIMPL exception and lets upstream code
 // decide what to do.
 //
-static bool get_bool(OLECHAR *name)
+static bool get_bool(DriverMember m)
 {
-	DISPID dispid;
-	VARIANT result;
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
+	bool val = false;
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			drvFail(buf, NULL, true);
-		}
-
-		//
-		// No dispatch parameters for propget
-		//
-		dispparms.cArgs = 0;
-		dispparms.rgvarg = NULL;
-		dispparms.cNamedArgs = 0;
-		dispparms.rgdispidNamedArgs = NULL;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_PROPERTYGET,
-						 &dispparms, 
-						 &result, 
-						 &excep, 
-						 NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
-			{
-				wsprintf(buf, 
-					 "Internal error reading from the %s property.", cp);
-				drvFail(buf, &excep, true);
-			}
-		}
+		enter_driver();
+		check_status(_invoker.GetBool(_target, m, val), m,
+				"Internal error reading from the %s property.", true, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
 	}
 
-	sprintf(buf, "Get %s <- %s", cp, (result.boolVal == VARIANT_TRUE ? "true" : "false"));
-	_pLogger->out(buf);
-	delete[] cp;
-
-	return(result.boolVal == VARIANT_TRUE);						// Return C++ bool result
+	if(_iLogLevel >= LOG_READS)
+		_log.GetBool(m, val);
+	return(val);
 }
 
 
@@ -1313,82 +1510,22 @@ static bool get_bool(OLECHAR *name)
 // then this raises a NOTIMPL exception and lets upstream code
 // decide what to do.
 //
-static void set_bool(OLECHAR *name, bool val)
+static void set_bool(DriverMember m, bool val)
 {
-	DISPID dispid;
-	VARIANTARG rgvarg[1];
-	VARIANT result;
-	DISPID ppdispid[1];
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
-	HRESULT hr;
-
-	sprintf(buf, "Set %s -> %s", cp, (val ? "true" : "false"));
-	_pLogger->out(buf);
+	if(_iLogLevel >= LOG_COMMANDS)
+		_log.SetBool(m, val);
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(hr = _p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			delete[] cp;
-			drvFail(buf, NULL, true);
-		}
-
-		rgvarg[0].vt = VT_BOOL;
-		rgvarg[0].boolVal = (val ? VARIANT_TRUE : VARIANT_FALSE);	// Translate to Variant Bool
-		dispparms.cArgs = 1;
-		dispparms.rgvarg = rgvarg;
-		ppdispid[0] = DISPID_PROPERTYPUT;
-		dispparms.cNamedArgs = 1;									// PropPut kludge
-		dispparms.rgdispidNamedArgs = ppdispid;
-		if(FAILED(_p_DrvDisp->Invoke(
-				dispid,
-				IID_NULL, 
-				LOCALE_USER_DEFAULT, 
-				DISPATCH_PROPERTYPUT, 
-				&dispparms, 
-				&result,
-				&excep, NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
-			{
-				wsprintf(buf, 
-					 "Internal error writing to the %s property.", cp);
-				delete[] cp;
-				drvFail(buf, &excep, true);
-			}
-		}
+		enter_driver();
+		check_status(_invoker.SetBool(_target, m, val), m,
+				"Internal error writing to the %s property.", true, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
+		_poller.Invalidate();									// Mount state may have changed
+		_predictor.Invalidate();
 	}
-
-	sprintf(buf, "Set %s -> %s", (val ? "true" : "false"), cp);
-	_pLogger->out(buf);
-	delete[] cp;
 }
 
 // ------------
@@ -1397,80 +1534,22 @@ static void set_bool(OLECHAR *name, bool val)
 //
 // Returns -> to new[]'ed string. Caller must release.
 //
-static char *get_string(OLECHAR *name )
+static char *get_string(DriverMember m)
 {
-	DISPID dispid;
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	VARIANT vRes;
-	char *cp = uni_to_ansi(name);
-	char buf[2048];
+	char *dp = NULL;
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name,
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			delete[] cp;
-			drvFail(buf, NULL, true);
-		}
-
-		//
-		// No dispatch parameters for propget
-		//
-		dispparms.cArgs = 0;
-		dispparms.rgvarg = NULL;
-		dispparms.cNamedArgs = 0;
-		dispparms.rgdispidNamedArgs = NULL;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_PROPERTYGET,
-						 &dispparms, 
-						 &vRes, 
-						 &excep, 
-						 NULL)))
-		{
-			if(excep.scode == EXCEP_NOTIMPL)						// Optional
-				NOTIMPL;											// Resignal silently
-			else
-			{
-				wsprintf(buf, 
-					 "Internal error reading from the %s property.", cp);
-				delete[] cp;
-				drvFail(buf, &excep, true);
-			}
-		}
+		enter_driver();
+		check_status(_invoker.GetString(_target, m, dp), m,
+				"Internal error reading from the %s property.", true, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
 	}
 
-	char *dp = uni_to_ansi(vRes.bstrVal);
-	sprintf(buf, "Get %s <- %s", cp, dp);
-	_pLogger->out(buf);
-	delete[] cp;
+	if(_iLogLevel >= LOG_READS)
+		_log.GetString(m, dp);									// Long ones are shortened in the log
 	if(strlen(dp) > 254)
 		strcpy(dp+250, "...");
 	return(dp);
@@ -1482,68 +1561,20 @@ static char *get_string(OLECHAR *name )
 //
 // Call a COM method with no parameters and no return value.
 //
-static void call(OLECHAR *name)
+static void call(DriverMember m)
 {
-	DISPID dispid;
-	DISPPARAMS dispparms;
-	EXCEPINFO excep;
-	VARIANT vRes;
-	char buf[256];
-
-	char *cp = uni_to_ansi(name);
-	sprintf(buf, "%s()", cp);
-	_pLogger->out(buf);
+	if(_iLogLevel >= LOG_COMMANDS)
+		_log.Call(m);
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name,
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
-		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			drvFail(buf, NULL, true);
-		}
-
-		dispparms.cArgs = 0;
-		dispparms.rgvarg = NULL;
-		dispparms.cNamedArgs = 0;
-		dispparms.rgdispidNamedArgs = NULL;
-		//
-		// Invoke the method
-		//
-		if(FAILED(_p_DrvDisp->Invoke(dispid, 
-						 IID_NULL, 
-						 LOCALE_USER_DEFAULT, 
-						 DISPATCH_METHOD,
-						 &dispparms, 
-						 &vRes, 
-						 &excep, 
-						 NULL)))
-		{
-			wsprintf(buf, 
-				 "%s failed internally.", cp);
-			drvFail(buf, &excep, true);
-		}		
+		enter_driver();
+		check_status(_invoker.Call(_target, m), m, "%s failed internally.", false, false);
 	}
 	__finally
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		delete[] cp;
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		leave_driver();
+		_poller.Invalidate();									// Mount state may have changed
+		_predictor.Invalidate();
 	}
 }
 
@@ -1553,78 +1584,134 @@ static void call(OLECHAR *name)
 //
 // Common COM call to method which takes RA/Dec coordinates.
 //
-static void call_with_ra_dec(OLECHAR *name, double dRA, double dDec)
+static void call_with_ra_dec(DriverMember m, double dRA, double dDec)
 {
-	DISPID dispid;
-	DISPPARAMS dispParms;
-	VARIANTARG rgvarg[2];
-	EXCEPINFO excep;
-	VARIANT vRes;
-	HRESULT hr;
-	char *cp = uni_to_ansi(name);
-	char buf[256];
+	if(_iLogLevel >= LOG_COMMANDS)
+		_log.CallWithRaDec(m, dRA, dDec);
+
+	__try {
+		enter_driver();
+		check_status(_invoker.CallWithRaDec(_target, m, dRA, dDec), m, "%s failed internally.", false, false);
+	}
+	__finally
+	{
+		leave_driver();
+		_poller.Invalidate();									// Mount state may have changed
+		_predictor.Invalidate();
+	}
+}	
 
-	sprintf(buf, "%s(%0.7f, %0.7f)", cp, dRA, dDec);
-	_pLogger->out(buf);
+
+// ----------------------
+// DriverSource::Attach()
+// DriverSource::Detach()
+// DriverSource::Read()
+// ----------------------
+//
+// MountSource for the poller thread. The thread gets its own proxy on its
+// first batch and keeps it until the poller stops. Only getting the proxy
+// needs _cs, and if the UI thread has it the batch is put off rather than
+// queued behind it. The calls themselves are made without _cs: with an
+// apartment-threaded driver they wait for TheSky's UI thread to pump
+// messages, and that thread may be waiting for _cs in enter_driver().
+//
+void DriverSource::Attach()
+{
+	CoInitializeEx(NULL, COINIT_MULTITHREADED);
+	invoker.Reset();											// New poller, maybe a new driver
+}
+
+void DriverSource::Detach()
+{
+	if(pDisp != NULL)
+	{
+		pDisp->Release();
+		pDisp = NULL;
+	}
+	CoUninitialize();
+}
+
+int DriverSource::Read(MountSnapshot &snap)
+{
+	int status = MR_OK;
+	bool parkedForV1;
+
+	if(!TryEnterCriticalSection(&_cs))							// ++ CRITICAL ++
+		return MR_BUSY;
+	if(pDisp == NULL)
+		pDisp = poller_dispatch();
+	parkedForV1 = isParkedForV1;
+	LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+	if(pDisp == NULL)
+		return MR_FAILED;
 
 	__try {
-		EnterCriticalSection(&_cs);										// ++ CRITICAL ++
-#ifdef CROSS_THREAD_GIT
-		switchThreadIf();
-#endif
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp = get_dispatch();
-#endif
-		//
-		// Get our dispatch ID
-		//
-		if(FAILED(_p_DrvDisp->GetIDsOfNames(
-			IID_NULL, 
-			&name, 
-			1, 
-			LOCALE_USER_DEFAULT,
-			&dispid)))
+		target.pDisp = pDisp;
+
+		if(invoker.GetDouble(target, DM_RightAscension, snap.ra) == DI_OK &&
+				invoker.GetDouble(target, DM_Declination, snap.dec) == DI_OK)
+			snap.valid |= MountSnapshot::MS_RADEC;
+		if(invoker.GetBool(target, DM_Slewing, snap.slewing) == DI_OK)
+			snap.valid |= MountSnapshot::MS_SLEWING;
+		if(invoker.GetBool(target, DM_Tracking, snap.tracking) == DI_OK)
+			snap.valid |= MountSnapshot::MS_TRACKING;
+		if(_iScopeInterfaceVersion == 1)
 		{
-			wsprintf(buf, _szGidFailMsg, cp);
-			drvFail(buf, NULL, true);
+			snap.atPark = parkedForV1;							// See GetAtPark()
+			snap.valid |= MountSnapshot::MS_ATPARK;
 		}
-
+		else if(_bScopeCanPark && invoker.GetBool(target, DM_AtPark, snap.atPark) == DI_OK)
+			snap.valid |= MountSnapshot::MS_ATPARK;
+		if(GetCanPierSide() && invoker.GetInteger(target, DM_SideOfPier, snap.sideOfPier) == DI_OK)
+			snap.valid |= MountSnapshot::MS_SIDEOFPIER;
 		//
-		// Do the sync
+		// Offsets are only asked for by trackingRates() while tracking
 		//
-		rgvarg[0].vt = VT_R8;		// Arg order is R->L
-		rgvarg[0].dblVal = dDec;
-		rgvarg[1].vt = VT_R8;
-		rgvarg[1].dblVal = dRA;
-		dispParms.cArgs = 2;
-		dispParms.rgvarg = rgvarg;
-		dispParms.cNamedArgs = 0;
-		dispParms.rgdispidNamedArgs =NULL;
-		if(FAILED(hr = _p_DrvDisp->Invoke(
-			dispid, 
-			IID_NULL, 
-			LOCALE_USER_DEFAULT, 
-			DISPATCH_METHOD, 
-			&dispParms, 
-			&vRes,
-			&excep, 
-			NULL)))
-		{
-			wsprintf(buf, 
-				 "%s failed internally.", cp);
-			drvFail(buf, &excep, true);
-		}
+		if(_bScopeCanSetTrackRates && (snap.valid & MountSnapshot::MS_TRACKING) && snap.tracking &&
+				invoker.GetDouble(target, DM_RightAscensionRate, snap.raRate) == DI_OK &&
+				invoker.GetDouble(target, DM_DeclinationRate, snap.decRate) == DI_OK)
+			snap.valid |= MountSnapshot::MS_RATES;
 	}
-	__finally
+	__except(EXCEPTION_EXECUTE_HANDLER)
 	{
-#ifdef CROSS_THREAD_CO
-		_p_DrvDisp->Release();
-#endif
-		delete[] cp;
-		LeaveCriticalSection(&_cs);									// -- NOCRITICAL --
+		status = MR_FAILED;
 	}
-}	
+	return status;
+}
 
+// -----------------
+// poller_dispatch()
+// -----------------
+//
+// A dispatch pointer for the poller thread, held until the poller stops.
+// Like get_dispatch() but returns NULL instead of alerting. Call with _cs
+// held.
+//
+static IDispatch *poller_dispatch(void)
+{
+	IDispatch *pDisp = NULL;
+
+#ifdef CROSS_THREAD_GIT
+	if(FAILED(_p_GIT->GetInterfaceFromGlobal(dwIntfcCookie, IID_IDispatch, (void **)&pDisp)))
+		return NULL;
+#endif
+#ifdef CROSS_THREAD_CO
+	LPSTREAM pStream = _pMarshalStream;
+
+	if(pStream == NULL)
+		return NULL;											// Lost to an earlier failed re-marshal
+	_pMarshalStream = NULL;										// Released by the Get, even if it fails
+	if(FAILED(CoGetInterfaceAndReleaseStream(pStream, IID_IDispatch, (LPVOID *)&pDisp)))
+		return NULL;
+	if(FAILED(CoMarshalInterThreadInterfaceInStream(IID_IDispatch, pDisp, &pStream)))
+	{
+		pDisp->Release();
+		return NULL;
+	}
+	_pMarshalStream = pStream;
+#endif
+	return pDisp;
+}
 
 #ifdef CROSS_THREAD_GIT
 //
@@ -1648,9 +1735,12 @@ static void switchThreadIf()
 			drvFail("Failed to get interface from GIT in new thread", NULL, true);
 		_p_DrvDisp = pTemp;
 #ifndef NDEBUG
-		char buf[256];
-		sprintf(buf, "tid %i, disp %i", tid, _p_DrvDisp);
-		_pLogger->out(buf);
+		if(_iLogLevel >= LOG_READS)
+		{
+			char buf[256];
+			sprintf(buf, "tid %i, disp %i", tid, _p_DrvDisp);
+			_log.Message(buf);
+		}
 #endif
 	}
 }
@@ -1660,18 +1750,26 @@ static void switchThreadIf()
 static IDispatch *get_dispatch(void)
 {
 	IDispatch *pDisp;
+	LPSTREAM pStream = _pMarshalStream;
 #ifndef NDEBUG
 	DWORD tid = GetCurrentThreadId();
 #endif
 
-	if(FAILED(CoGetInterfaceAndReleaseStream(_pMarshalStream, IID_IDispatch, (LPVOID *)&pDisp)))
+	if(pStream == NULL)
+		drvFail("No dispatch pointer to unmarshal", NULL, true);
+	_pMarshalStream = NULL;										// Released by the Get, even if it fails
+	if(FAILED(CoGetInterfaceAndReleaseStream(pStream, IID_IDispatch, (LPVOID *)&pDisp)))
 		drvFail("Failed to unmarshal dispatch pointer", NULL, true);
-	if(FAILED(CoMarshalInterThreadInterfaceInStream(IID_IDispatch, pDisp, &_pMarshalStream)))
+	if(FAILED(CoMarshalInterThreadInterfaceInStream(IID_IDispatch, pDisp, &pStream)))
 		drvFail("Failed to remarshal dispatch pointer", NULL, true);
+	_pMarshalStream = pStream;
 #ifndef NDEBUG
-	char buf[256];
-	sprintf(buf, "tid %i, disp %i", tid, pDisp);
-	_pLogger->out(buf);
+	if(_iLogLevel >= LOG_READS)
+	{
+		char buf[256];
+		sprintf(buf, "tid %i, disp %i", tid, pDisp);
+		_log.Message(buf);
+	}
 #endif
 	return pDisp;
 }
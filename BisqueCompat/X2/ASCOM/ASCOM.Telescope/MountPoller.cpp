@@ -0,0 +1,344 @@
+//========================================================================
+//
+// TITLE:		MountPoller.cpp
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Background snapshot of the mount's position and state.
+//				See MountPoller.h.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		Stop() services COM while waiting for the thread
+//========================================================================
+
+#include <string.h>
+#include "MountPoller.h"
+
+#ifdef _WIN32
+#include <process.h>
+#include <objbase.h>
+#define MP_INCREMENT(p) InterlockedIncrement(p)
+#define MP_BARRIER() MemoryBarrier()
+#define MP_YIELD() Sleep(0)
+#else
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+#define MP_INCREMENT(p) __sync_add_and_fetch(p, 1)
+#define MP_BARRIER() __sync_synchronize()
+#define MP_YIELD() sched_yield()
+#endif
+
+#define RETRY_MS 20												// After MR_BUSY
+
+#ifdef _WIN32
+// -------------
+// WaitPumping()
+// -------------
+//
+// Stop() runs on TheSky's UI thread. The poller thread may be in a call
+// to an apartment-threaded driver, or releasing its proxy in Detach(),
+// and both need this thread to service COM. CoWaitForMultipleHandles
+// does that while it waits; off an apartment it is a plain wait.
+//
+static void WaitPumping(HANDLE h)
+{
+	DWORD index;
+
+	if(FAILED(CoWaitForMultipleHandles(0, INFINITE, 1, &h, &index)))
+		WaitForSingleObject(h, INFINITE);
+}
+#endif
+
+MountPoller::MountPoller()
+{
+	_source = NULL;
+	_interval = 0;
+	_maxAge = 0;
+	_running = false;
+	_stop = false;
+	_seq = 0;
+	_generation = 0;
+	memset(&_snap, 0, sizeof(_snap));
+	_batches = 0;
+	_busy = 0;
+#ifdef _WIN32
+	_hThread = NULL;
+	_hWake = NULL;
+#else
+	pthread_mutex_init(&_mutex, NULL);
+	pthread_cond_init(&_wake, NULL);
+	_kick = false;
+#endif
+}
+
+MountPoller::~MountPoller()
+{
+	Stop();
+#ifndef _WIN32
+	pthread_cond_destroy(&_wake);
+	pthread_mutex_destroy(&_mutex);
+#endif
+}
+
+// -----------
+// TickCount()
+// -----------
+//
+// Milliseconds, wrapping. Only differences are used.
+//
+unsigned long MountPoller::TickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000);
+#endif
+}
+
+// -------
+// Start()
+// -------
+//
+// Snapshots older than maxAgeMs are not handed out. The first batch is
+// read immediately.
+//
+bool MountPoller::Start(MountSource *source, unsigned long intervalMs, unsigned long maxAgeMs)
+{
+	if(_running)
+		return false;
+	_source = source;
+	_interval = intervalMs;
+	_maxAge = maxAgeMs;
+	_stop = false;
+	_seq = 0;
+	memset(&_snap, 0, sizeof(_snap));
+	_batches = 0;
+	_busy = 0;
+
+#ifdef _WIN32
+	_hWake = CreateEvent(NULL, FALSE, FALSE, NULL);
+	if(_hWake == NULL)
+		return false;
+	_hThread = (HANDLE)_beginthreadex(NULL, 0, ThreadProc, this, 0, NULL);
+	if(_hThread == NULL)
+	{
+		CloseHandle(_hWake);
+		_hWake = NULL;
+		return false;
+	}
+#else
+	_kick = false;
+	if(pthread_create(&_thread, NULL, ThreadProc, this) != 0)
+		return false;
+#endif
+	_running = true;
+	return true;
+}
+
+// ------
+// Stop()
+// ------
+//
+// Returns once the poller thread has finished its current batch and
+// detached from the source. Safe to call when not running. On Windows
+// COM calls are serviced while waiting, so this may be re-entered.
+//
+void MountPoller::Stop()
+{
+	if(!_running)
+		return;
+	_stop = true;
+#ifdef _WIN32
+	SetEvent(_hWake);
+	WaitPumping(_hThread);
+	if(!_running)
+		return;													// A nested Stop() has finished
+	CloseHandle(_hThread);
+	CloseHandle(_hWake);
+	_hThread = NULL;
+	_hWake = NULL;
+#else
+	pthread_mutex_lock(&_mutex);
+	_kick = true;
+	pthread_cond_signal(&_wake);
+	pthread_mutex_unlock(&_mutex);
+	pthread_join(_thread, NULL);
+#endif
+	_running = false;
+}
+
+// ------------
+// Invalidate()
+// ------------
+//
+// Call after anything that changes the mount's state (slew, park,
+// tracking). Snapshots from batches that started earlier are no longer
+// handed out, and a new batch is started at once.
+//
+void MountPoller::Invalidate()
+{
+	MP_INCREMENT(&_generation);
+	if(!_running)
+		return;
+#ifdef _WIN32
+	SetEvent(_hWake);
+#else
+	pthread_mutex_lock(&_mutex);
+	_kick = true;
+	pthread_cond_signal(&_wake);
+	pthread_mutex_unlock(&_mutex);
+#endif
+}
+
+// -----
+// Get()
+// -----
+//
+// Latest snapshot, if there is one that is recent, was taken after the
+// last Invalidate(), and has at least one valid field. Never blocks.
+//
+bool MountPoller::Get(MountSnapshot &snap)
+{
+	if(!_running)
+		return false;
+	Peek(snap);
+	if(snap.batch == 0 || snap.valid == 0)
+		return false;
+	if(snap.generation != (unsigned long)_generation)
+		return false;
+	if(TickCount() - snap.tick > _maxAge)
+		return false;
+	return true;
+}
+
+// ------
+// Peek()
+// ------
+//
+// Read side of the sequence lock.
+//
+void MountPoller::Peek(MountSnapshot &snap)
+{
+	for(;;)
+	{
+		long seq = _seq;
+		MP_BARRIER();
+		if((seq & 1) == 0)
+		{
+			snap = _snap;
+			MP_BARRIER();
+			if(_seq == seq)
+				return;
+		}
+		MP_YIELD();
+	}
+}
+
+// ---------
+// Publish()
+// ---------
+//
+// Write side of the sequence lock. Only the poller thread writes.
+//
+void MountPoller::Publish(const MountSnapshot &snap)
+{
+	MP_INCREMENT(&_seq);										// Odd: readers retry
+	MP_BARRIER();
+	_snap = snap;
+	MP_BARRIER();
+	MP_INCREMENT(&_seq);										// Even: stable
+}
+
+// ------
+// Wait()
+// ------
+//
+bool MountPoller::Wait(unsigned long ms)
+{
+#ifdef _WIN32
+	WaitForSingleObject(_hWake, ms);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += ms / 1000;
+	ts.tv_nsec += (long)(ms % 1000) * 1000000L;
+	if(ts.tv_nsec >= 1000000000L)
+	{
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	pthread_mutex_lock(&_mutex);
+	while(!_kick)
+	{
+		if(pthread_cond_timedwait(&_wake, &_mutex, &ts) == ETIMEDOUT)
+			break;
+	}
+	_kick = false;
+	pthread_mutex_unlock(&_mutex);
+#endif
+	return !_stop;
+}
+
+// -----
+// Run()
+// -----
+//
+// The poller thread. The generation is taken before the batch starts, so
+// a command that completes while the batch is being read makes the batch
+// stale rather than letting pre-command values through.
+//
+void MountPoller::Run()
+{
+	_source->Attach();
+	while(!_stop)
+	{
+		MountSnapshot snap;
+		int status;
+
+		memset(&snap, 0, sizeof(snap));
+		snap.generation = (unsigned long)_generation;
+		MP_BARRIER();
+		snap.tick = TickCount();
+		status = _source->Read(snap);
+		if(status == MR_BUSY)
+		{
+			_busy++;
+			if(!Wait(_interval < RETRY_MS ? _interval : RETRY_MS))
+				break;
+			continue;
+		}
+		if(status != MR_OK)
+			snap.valid = 0;
+		snap.batch = ++_batches;
+		Publish(snap);
+		if(!Wait(_interval))
+			break;
+	}
+	_source->Detach();
+}
+
+#ifdef _WIN32
+unsigned __stdcall MountPoller::ThreadProc(void *param)
+{
+	((MountPoller *)param)->Run();
+	return 0;
+}
+#else
+void *MountPoller::ThreadProc(void *param)
+{
+	((MountPoller *)param)->Run();
+	return NULL;
+}
+#endif
@@ -0,0 +1,150 @@
+//========================================================================
+//
+// TITLE:		MountPoller.h
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Background snapshot of the mount's position and state. A
+//				poller thread reads RightAscension, Declination, Slewing,
+//				Tracking, AtPark and SideOfPier in one batch at a fixed
+//				rate and publishes the result without a lock, so TheSky's
+//				UI polling reads the last snapshot instead of waiting on
+//				the driver.
+//
+// USING:		Portable C++, Win32 or pthreads. The driver side is the
+//				MountSource implementation in DriverInterface.cpp;
+//				MountPollerTest.cpp runs the poller against a mock mount.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef MOUNTPOLLER_H
+#define MOUNTPOLLER_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// -------------
+// MountSnapshot
+// -------------
+//
+// One batch of readings. Only the fields whose bit is set in valid were
+// read; a field the driver failed on or does not have is left clear and
+// the caller goes to the driver for it.
+//
+struct MountSnapshot
+{
+	enum
+	{
+		MS_RADEC = 0x01,
+		MS_SLEWING = 0x02,
+		MS_TRACKING = 0x04,
+		MS_ATPARK = 0x08,
+		MS_SIDEOFPIER = 0x10,
+		MS_RATES = 0x20											// Only read while tracking with offsets
+	};
+	unsigned valid;
+	double ra, dec;
+	bool slewing;
+	bool tracking;
+	bool atPark;
+	int sideOfPier;
+	double raRate, decRate;										// As the driver reports them
+	unsigned long tick;											// MountPoller::TickCount() at batch start
+	unsigned long generation;									// Invalidate() count at batch start
+	unsigned long batch;										// Batches published so far
+};
+
+//
+// MountSource::Read() results
+//
+enum
+{
+	MR_OK = 0,
+	MR_BUSY,													// Driver in use elsewhere, retry soon
+	MR_FAILED													// Publish nothing valid
+};
+
+// -----------
+// MountSource
+// -----------
+//
+// Reads one batch from the driver. Called only on the poller thread.
+// Attach() and Detach() bracket the thread's life so the source can set
+// up per-thread state (COM apartment, its own proxy).
+//
+class MountSource
+{
+public:
+	virtual void Attach() {}
+	virtual void Detach() {}
+	virtual int Read(MountSnapshot &snap) = 0;
+};
+
+// -----------
+// MountPoller
+// -----------
+//
+// One writer (the poller thread), any number of readers. Publication is a
+// sequence lock: readers copy the snapshot and retry if a batch landed
+// while they were copying, so they never wait on the driver.
+//
+class MountPoller
+{
+public:
+	MountPoller();
+	~MountPoller();
+
+	bool Start(MountSource *source, unsigned long intervalMs, unsigned long maxAgeMs);
+	void Stop();
+	bool IsRunning() const { return _running; }
+
+	bool Get(MountSnapshot &snap);								// Fresh and current, or false
+	void Invalidate();											// State changed; drop older snapshots
+
+	unsigned long Batches() const { return _batches; }
+	unsigned long Busy() const { return _busy; }
+
+	static unsigned long TickCount();
+
+protected:
+	void Run();
+	void Publish(const MountSnapshot &snap);
+	void Peek(MountSnapshot &snap);
+	bool Wait(unsigned long ms);								// false when stopping
+
+	MountSource *_source;
+	unsigned long _interval;
+	unsigned long _maxAge;
+	bool _running;
+	volatile bool _stop;
+	volatile long _seq;											// Odd while a batch is being written
+	volatile long _generation;
+	MountSnapshot _snap;
+	unsigned long _batches;
+	unsigned long _busy;										// Batches deferred by MR_BUSY
+
+#ifdef _WIN32
+	static unsigned __stdcall ThreadProc(void *param);
+	HANDLE _hThread;
+	HANDLE _hWake;												// Auto-reset; Stop() or Invalidate()
+#else
+	static void *ThreadProc(void *param);
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _wake;
+	bool _kick;
+#endif
+};
+
+#endif
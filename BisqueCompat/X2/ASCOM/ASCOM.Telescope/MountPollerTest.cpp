@@ -0,0 +1,382 @@
+//========================================================================
+//
+// TITLE:		MountPollerTest.cpp
+//
+// FACILITY:	X2 Plugin for TheSky X and ASCOM drivers
+//
+// ABSTRACT:	Test program for MountPoller against a mock mount whose
+//				reads can be made slow, busy or failing. Not part of the
+//				plug-in build; on Linux:
+//
+//				g++ -o MountPollerTest MountPoller.cpp MountPollerTest.cpp -lpthread
+//				./MountPollerTest
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		PASS/FAIL reporting from TestCheck.h
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "MountPoller.h"
+#include "../../../../PluginCommon/TestCheck.h"
+
+static void sleep_ms(unsigned long ms)
+{
+	usleep(ms * 1000);
+}
+
+// ---------
+// MockMount
+// ---------
+//
+// Each batch reads ra = n and dec = -n for the n'th batch, so a torn copy
+// shows up as dec != -ra. The test thread changes the other state under
+// the mock's own lock, as a command would under _cs.
+//
+class MockMount : public MountSource
+{
+public:
+	pthread_mutex_t lock;
+	pthread_t owner;
+	int attaches, detaches;
+	bool sameThread;
+	unsigned long reads;
+	unsigned long delayMs;										// Latency of one batch
+	int busyCount;												// Return MR_BUSY this many times
+	bool fail;
+	bool slewing, tracking, atPark, hasPierSide;
+	int sideOfPier;
+
+	MockMount()
+	{
+		pthread_mutex_init(&lock, NULL);
+		attaches = detaches = 0;
+		sameThread = true;
+		reads = 0;
+		delayMs = 0;
+		busyCount = 0;
+		fail = false;
+		slewing = false;
+		tracking = true;
+		atPark = false;
+		hasPierSide = false;
+		sideOfPier = 0;
+	}
+
+	void Attach()
+	{
+		owner = pthread_self();
+		attaches++;
+	}
+
+	void Detach()
+	{
+		if(!pthread_equal(owner, pthread_self()))
+			sameThread = false;
+		detaches++;
+	}
+
+	int Read(MountSnapshot &snap)
+	{
+		unsigned long delay;
+
+		if(!pthread_equal(owner, pthread_self()))
+			sameThread = false;
+		pthread_mutex_lock(&lock);
+		if(busyCount > 0)
+		{
+			busyCount--;
+			pthread_mutex_unlock(&lock);
+			return MR_BUSY;
+		}
+		if(fail)
+		{
+			pthread_mutex_unlock(&lock);
+			return MR_FAILED;
+		}
+		reads++;
+		delay = delayMs;
+		snap.ra = (double)reads;
+		snap.dec = -(double)reads;
+		snap.slewing = slewing;
+		snap.tracking = tracking;
+		snap.atPark = atPark;
+		snap.valid = MountSnapshot::MS_RADEC | MountSnapshot::MS_SLEWING |
+				MountSnapshot::MS_TRACKING | MountSnapshot::MS_ATPARK;
+		if(hasPierSide)
+		{
+			snap.sideOfPier = sideOfPier;
+			snap.valid |= MountSnapshot::MS_SIDEOFPIER;
+		}
+		pthread_mutex_unlock(&lock);
+		if(delay > 0)
+			sleep_ms(delay);									// The driver round trip
+		return MR_OK;
+	}
+
+	void Set(bool s, bool t, bool p)
+	{
+		pthread_mutex_lock(&lock);
+		slewing = s;
+		tracking = t;
+		atPark = p;
+		pthread_mutex_unlock(&lock);
+	}
+
+	void SetDelay(unsigned long ms)
+	{
+		pthread_mutex_lock(&lock);
+		delayMs = ms;
+		pthread_mutex_unlock(&lock);
+	}
+
+	void SetFail(bool f)
+	{
+		pthread_mutex_lock(&lock);
+		fail = f;
+		pthread_mutex_unlock(&lock);
+	}
+
+	void SetBusy(int n)
+	{
+		pthread_mutex_lock(&lock);
+		busyCount = n;
+		pthread_mutex_unlock(&lock);
+	}
+};
+
+//
+// Wait up to ms for a snapshot that passes Get()
+//
+static bool wait_get(MountPoller &poller, MountSnapshot &snap, unsigned long ms)
+{
+	unsigned long start = MountPoller::TickCount();
+
+	while(MountPoller::TickCount() - start < ms)
+	{
+		if(poller.Get(snap))
+			return true;
+		sleep_ms(1);
+	}
+	return false;
+}
+
+//
+// Reader thread for the tearing check
+//
+static MountPoller *_shared = NULL;
+static volatile bool _readerStop = false;
+static unsigned long _torn = 0;
+static unsigned long _seen = 0;
+
+static void *reader(void *)
+{
+	MountSnapshot snap;
+
+	while(!_readerStop)
+	{
+		if(_shared->Get(snap))
+		{
+			__sync_fetch_and_add(&_seen, 1);
+			if(snap.dec != -snap.ra)
+				__sync_fetch_and_add(&_torn, 1);
+		}
+	}
+	return NULL;
+}
+
+int main()
+{
+	MountSnapshot snap;
+	unsigned long start, worst, t;
+	int n;
+
+	//
+	// Nothing before the first batch
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		check(!poller.Get(snap), "idle: no snapshot before Start");
+		mock.SetDelay(100);
+		poller.Start(&mock, 20, 1000);
+		sleep_ms(20);
+		check(!poller.Get(snap), "start: no snapshot before the first batch lands");
+		check(wait_get(poller, snap, 500) && snap.ra == 1.0 && snap.dec == -1.0 && snap.tracking,
+				"start: first batch published");
+		poller.Stop();
+		check(mock.attaches == 1 && mock.detaches == 1 && mock.sameThread, "start: attach/read/detach on one thread");
+		check(!poller.Get(snap), "stop: no snapshot once stopped");
+	}
+
+	//
+	// Batches keep coming at about the interval
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 10, 1000);
+		sleep_ms(200);
+		poller.Stop();
+		check(poller.Batches() >= 5 && poller.Batches() <= 25, "rate: about one batch per interval");
+	}
+
+	//
+	// Readers do not wait on a slow mount
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 0, 2000);
+		check(wait_get(poller, snap, 500), "slow: first batch");
+		mock.SetDelay(150);										// Every batch now takes 150 ms
+		worst = 0;
+		for(n = 0; n < 200; n++)
+		{
+			start = MountPoller::TickCount();
+			poller.Get(snap);
+			t = MountPoller::TickCount() - start;
+			if(t > worst)
+				worst = t;
+			sleep_ms(2);
+		}
+		check(worst < 20, "slow: Get() never waits for the batch in progress");
+		poller.Stop();
+	}
+
+	//
+	// A command invalidates older snapshots; the next batch shows the change
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 1000, 5000);						// Long interval: only a kick gets a batch
+		check(wait_get(poller, snap, 500) && !snap.slewing, "invalidate: not slewing");
+		mock.Set(true, true, false);							// startSlewTo()
+		poller.Invalidate();
+		check(!poller.Get(snap) || snap.slewing, "invalidate: pre-command snapshot not handed out");
+		start = MountPoller::TickCount();
+		check(wait_get(poller, snap, 500) && snap.slewing, "invalidate: new batch shows slewing");
+		check(MountPoller::TickCount() - start < 500, "invalidate: new batch started at once");
+		poller.Stop();
+	}
+
+	//
+	// A batch that started before the command is stale even if it lands after
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		mock.SetDelay(100);
+		poller.Start(&mock, 1000, 5000);
+		sleep_ms(20);											// First batch is in progress
+		poller.Invalidate();
+		sleep_ms(120);											// ... and has now landed
+		check(!poller.Get(snap) || snap.batch > 1, "generation: batch begun before Invalidate() not used");
+		check(wait_get(poller, snap, 500) && snap.batch >= 2, "generation: following batch used");
+		poller.Stop();
+	}
+
+	//
+	// Old snapshots age out
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 10, 100);
+		check(wait_get(poller, snap, 500), "age: fresh snapshot");
+		mock.SetDelay(400);										// Mount stops answering promptly
+		sleep_ms(250);
+		check(!poller.Get(snap), "age: stale snapshot not handed out");
+		poller.Stop();
+	}
+
+	//
+	// Failed batches clear the snapshot; busy ones are retried
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 10, 1000);
+		check(wait_get(poller, snap, 500), "fail: good snapshot");
+		mock.SetFail(true);
+		sleep_ms(50);
+		check(!poller.Get(snap), "fail: no snapshot after a failed batch");
+		mock.SetFail(false);
+		check(wait_get(poller, snap, 500), "fail: recovers");
+		mock.SetBusy(3);
+		sleep_ms(150);
+		check(poller.Get(snap), "busy: snapshot after deferred batches");
+		poller.Stop();
+		check(poller.Busy() == 3, "busy: each deferral counted");
+	}
+
+	//
+	// Only fields the source read are marked valid
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 10, 1000);
+		check(wait_get(poller, snap, 500) && (snap.valid & MountSnapshot::MS_SIDEOFPIER) == 0,
+				"fields: no pier side from a mount without one");
+		poller.Stop();
+		mock.hasPierSide = true;
+		mock.sideOfPier = 1;
+		poller.Start(&mock, 10, 1000);
+		check(wait_get(poller, snap, 500) && (snap.valid & MountSnapshot::MS_SIDEOFPIER) && snap.sideOfPier == 1,
+				"fields: pier side when read");
+		poller.Stop();
+	}
+
+	//
+	// Readers never see a half-written snapshot
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+		pthread_t th[3];
+
+		_shared = &poller;
+		poller.Start(&mock, 0, 1000);							// Publish as fast as it can
+		for(n = 0; n < 3; n++)
+			pthread_create(&th[n], NULL, reader, NULL);
+		sleep_ms(300);
+		_readerStop = true;
+		for(n = 0; n < 3; n++)
+			pthread_join(th[n], NULL);
+		poller.Stop();
+		printf("      %lu batches, %lu reads\n", poller.Batches(), _seen);
+		check(_seen > 0 && _torn == 0, "seqlock: no torn snapshots");
+	}
+
+	//
+	// Stop does not wait out the interval
+	//
+	{
+		MockMount mock;
+		MountPoller poller;
+
+		poller.Start(&mock, 10000, 20000);
+		wait_get(poller, snap, 500);
+		start = MountPoller::TickCount();
+		poller.Stop();
+		check(MountPoller::TickCount() - start < 200, "stop: prompt");
+	}
+
+	return check_summary();
+}
@@ -31,6 +31,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <shellapi.h>
+#include "MountPoller.h"
+#include "../../../../PluginCommon/PointingPredictor.h"
 #include "main.h"
 #include "ASCOM.Telescope.h"
 
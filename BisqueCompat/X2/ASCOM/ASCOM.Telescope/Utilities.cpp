@@ -21,6 +21,9 @@
 // 12-Jul-11	rbd		0.9.3 - Log exceptions to TheSky X's comm log
 // 12-Oct-11	rbd		0.9.5 - Improve error reporting in DrvFail.
 // 04-Jan-12	rbd		1.0.1 - Release. No changes.
+// 17-Oct-26	asc		Flush queued call records before logging an error.
+// 18-Oct-26	asc		Error block written through LogLines(), under the
+//						same lock as the call log's lines.
 //========================================================================
 #include "StdAfx.h"
 
@@ -142,11 +145,8 @@ void drvFail(char *msg, EXCEPINFO *ei, bool bCloseConn)
 			{
 				char *dsc = uni_to_ansi(ei->bstrDescription);
 				char *src = uni_to_ansi(ei->bstrSource);
-				_pLogger->out("== ERROR FROM DRIVER ==");
-				_pLogger->out(msg);
-				_pLogger->out(src);
-				_pLogger->out(dsc);
-				_pLogger->out("=======================");
+				const char *lines[] = { "== ERROR FROM DRIVER ==", msg, src, dsc, "=======================" };
+				LogLines(lines, 5);								// After the calls leading up to it
 				sprintf(buf, "%s\n%s", msg, dsc);
 				MessageBox(NULL, buf, src, (MB_OK | MB_ICONSTOP | MB_SETFOREGROUND));
 				delete [] dsc;
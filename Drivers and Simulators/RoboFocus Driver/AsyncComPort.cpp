@@ -0,0 +1,1044 @@
+//---------------------------------------------------------------------
+//
+// Purpose:   Asynchronous serial port
+//
+// One I/O thread per port. On Windows the handle is opened for
+// overlapped I/O; the thread waits on an overlapped WaitCommEvent for
+// EV_RXCHAR and on a wake event, and on each receive event reads
+// everything the driver holds in one ReadFile. Elsewhere it polls the
+// file descriptor and a wake pipe. Received blocks go to the receive
+// callback or the ring; waiting readers are signalled at once.
+//
+// Writers only append to the transmit queue and wake the thread, which
+// sends the whole queue in one device write. Bytes queued while that
+// write is in progress are sent together in the next one, so a burst of
+// small writes costs a few device writes rather than one each. An
+// optional coalescing delay holds the first byte back a little longer
+// to collect more.
+//
+// Edits:
+//
+// When      Who     What
+// --------- ---     --------------------------------------------------
+// 17-Oct-26 asc     Initial edit
+//
+
+#include "AsyncComPort.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Constructor
+//	Purpose:	Creates object
+//
+//-------------------------------------------------------------------------------
+AsyncComPort::AsyncComPort()
+{
+#ifdef _WIN32
+	hCom = INVALID_HANDLE_VALUE;
+	WakeEvent = CreateEvent ( NULL, FALSE, FALSE, NULL );
+	RxChanged = CreateEvent ( NULL, FALSE, FALSE, NULL );
+	TxChanged = CreateEvent ( NULL, FALSE, FALSE, NULL );
+	Thread = NULL;
+	InitializeCriticalSection ( &Mutex );
+#else
+	fd = -1;
+	WakePipe[ 0 ] = WakePipe[ 1 ] = -1;
+	BaudRate = 9600;
+	Parity = false;
+	CTSFlow = false;
+	pthread_mutex_init ( &Mutex, NULL );
+	pthread_cond_init ( &Changed, NULL );
+#endif
+	Running = false;
+	StopRequested = false;
+	Failed = false;
+	RingHead = RingTail = 0;
+	TxLen = 0;
+	TxBusy = false;
+	TxQueued = 0;
+	InterByteTimeout = 200;
+	TotalTimeoutMultiplier = 4;
+	TotalTimeoutConstant = 100;
+	CoalesceDelay = 0;
+	OnReceive = NULL;
+	ReceiveContext = NULL;
+	OnWrite = NULL;
+	WriteContext = NULL;
+	memset ( &Stats, 0, sizeof ( Stats ) );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Destructor
+//	Purpose:	Closes the port and deletes object
+//
+//-------------------------------------------------------------------------------
+AsyncComPort::~AsyncComPort()
+{
+	Close();
+#ifdef _WIN32
+	DeleteCriticalSection ( &Mutex );
+	CloseHandle ( TxChanged );
+	CloseHandle ( RxChanged );
+	CloseHandle ( WakeEvent );
+#else
+	pthread_cond_destroy ( &Changed );
+	pthread_mutex_destroy ( &Mutex );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Open
+//	Purpose:	Opens the port and starts the I/O thread
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::Open ( const char *Name, int Baud, bool EvenParity )
+{
+	if (Running) return false;
+
+	StopRequested = false;
+	Failed = false;
+	RingHead = RingTail = 0;
+	TxLen = 0;
+	TxBusy = false;
+	memset ( &Stats, 0, sizeof ( Stats ) );
+
+	if (!OpenDevice ( Name, Baud, EvenParity )) return false;
+
+	Running = true;
+#ifdef _WIN32
+	unsigned ThreadId;
+	Thread = (HANDLE) _beginthreadex ( NULL, 0, ThreadProc, this, 0, &ThreadId );
+	if (Thread != NULL) return true;
+#else
+	if (pthread_create ( &Thread, NULL, ThreadProc, this ) == 0) return true;
+#endif
+	Running = false;
+	CloseDevice();
+	return false;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Close
+//	Purpose:	Stops the I/O thread and closes the port
+//	Notes:		Queued bytes not yet written are discarded; call Flush first
+//				to send them
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Close()
+{
+	if (!Running) return;
+
+	Lock();
+	StopRequested = true;
+	Unlock();
+	Wake();
+#ifdef _WIN32
+	WaitForSingleObject ( Thread, INFINITE );
+	CloseHandle ( Thread );
+	Thread = NULL;
+#else
+	pthread_join ( Thread, NULL );
+#endif
+	CloseDevice();
+	Running = false;
+	Signal ( true, true );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SetReadTimeouts
+//	Purpose:	Sets the timeouts used by Read (milliseconds)
+//	Notes:		As for COMMTIMEOUTS: a negative value leaves a setting as it
+//				is, and zero disables that timeout
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::SetReadTimeouts ( int InterByte, int TotalMultiplier, int TotalConstant )
+{
+	Lock();
+	if (InterByte >= 0) InterByteTimeout = InterByte;
+	if (TotalMultiplier >= 0) TotalTimeoutMultiplier = TotalMultiplier;
+	if (TotalConstant >= 0) TotalTimeoutConstant = TotalConstant;
+	Unlock();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SetCoalesceDelay
+//	Purpose:	Holds queued bytes up to this long for more to arrive
+//	Notes:		0 (the default) sends as soon as the I/O thread is free
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::SetCoalesceDelay ( int Milliseconds )
+{
+	Lock();
+	CoalesceDelay = Milliseconds > 0 ? Milliseconds : 0;
+	Unlock();
+	Wake();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SetReceiveCallback, SetWriteCallback
+//	Purpose:	Installs completion callbacks; NULL removes them
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::SetReceiveCallback ( ReceiveCallback Callback, void *Context )
+{
+	Lock();
+	OnReceive = Callback;
+	ReceiveContext = Context;
+	Unlock();
+}
+
+void AsyncComPort::SetWriteCallback ( WriteCallback Callback, void *Context )
+{
+	Lock();
+	OnWrite = Callback;
+	WriteContext = Context;
+	Unlock();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Write
+//	Purpose:	Queues bytes for the I/O thread and returns
+//	Notes:		Waits only if the queue is full
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::Write ( const unsigned char *Buf, int NumToWrite )
+{
+	if (!Running) return false;
+
+	unsigned long Start = TickCount();
+
+	Lock();
+	if (Failed)
+	{
+		Unlock();
+		return false;
+	}
+	Stats.WriteRequests++;
+	while (NumToWrite > 0)
+	{
+		int Space = AsyncComPortTxSize - TxLen;
+		if (Space == 0)
+		{
+			Unlock();
+			Wake();
+			Lock();
+			long Remaining = 1000L - (long) ( TickCount() - Start );
+			if (Remaining <= 0 || Failed)
+			{
+				Unlock();
+				return false;
+			}
+			WaitSignal ( false, (int) Remaining );
+			continue;
+		}
+		int Num = NumToWrite < Space ? NumToWrite : Space;
+		if (TxLen == 0) TxQueued = TickCount();
+		memcpy ( &Tx[ TxLen ], Buf, Num );
+		TxLen += Num;
+		Buf += Num;
+		NumToWrite -= Num;
+	}
+	Unlock();
+	Wake();
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Flush
+//	Purpose:	Waits until everything queued has been written
+//	Notes:		A negative timeout waits indefinitely
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::Flush ( int TimeoutMs )
+{
+	unsigned long Start = TickCount();
+
+	Lock();
+	while ((TxLen > 0 || TxBusy) && !Failed && Running)
+	{
+		long Remaining = 1000L;
+		if (TimeoutMs >= 0)
+		{
+			Remaining = TimeoutMs - (long) ( TickCount() - Start );
+			if (Remaining <= 0) break;
+		}
+		WaitSignal ( false, (int) Remaining );
+	}
+	bool Done = TxLen == 0 && !TxBusy && !Failed;
+	Unlock();
+	return Done;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Read
+//	Purpose:	Reads NumToRead bytes, subject to the read timeouts
+//	Returns:	Number of bytes read; fewer than asked for on a timeout
+//	Notes:		The same rules as a non-overlapped ReadFile with COMMTIMEOUTS:
+//				the total timeout is TotalTimeoutMultiplier * NumToRead +
+//				TotalTimeoutConstant, and the read also ends when the gap
+//				after a received byte exceeds InterByteTimeout
+//
+//-------------------------------------------------------------------------------
+int AsyncComPort::Read ( unsigned char *Buf, int NumToRead )
+{
+	unsigned long Start = TickCount();
+	unsigned long LastByte = Start;
+	int NumRead = 0;
+
+	Lock();
+	long Total = (long) TotalTimeoutMultiplier * NumToRead + TotalTimeoutConstant;
+	long InterByte = InterByteTimeout;
+	while (NumRead < NumToRead)
+	{
+		int Num = TakeRing ( &Buf[ NumRead ], NumToRead - NumRead );
+		unsigned long Now = TickCount();
+		if (Num > 0)
+		{
+			NumRead += Num;
+			LastByte = Now;
+			continue;
+		}
+		if (Failed || !Running) break;
+
+		long Wait = 1000L;
+		if (Total > 0)
+		{
+			Wait = Total - (long) ( Now - Start );
+			if (Wait <= 0) break;
+		}
+		if (InterByte > 0 && NumRead > 0)
+		{
+			long Gap = InterByte - (long) ( Now - LastByte );
+			if (Gap <= 0) break;
+			if (Gap < Wait) Wait = Gap;
+		}
+		WaitSignal ( true, (int) Wait );
+	}
+	Unlock();
+	return NumRead;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ReadAvailable
+//	Purpose:	Waits up to TimeoutMs for data and takes whatever has arrived
+//	Returns:	Number of bytes read, 0 on timeout, -1 if the port has failed
+//				or is closed
+//
+//-------------------------------------------------------------------------------
+int AsyncComPort::ReadAvailable ( unsigned char *Buf, int MaxToRead, int TimeoutMs )
+{
+	unsigned long Start = TickCount();
+
+	Lock();
+	while (RingHead == RingTail)
+	{
+		if (Failed || !Running)
+		{
+			Unlock();
+			return -1;
+		}
+		long Remaining = TimeoutMs - (long) ( TickCount() - Start );
+		if (Remaining <= 0)
+		{
+			Unlock();
+			return 0;
+		}
+		WaitSignal ( true, (int) Remaining );
+	}
+	int NumRead = TakeRing ( Buf, MaxToRead );
+	Unlock();
+	return NumRead;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Available
+//	Purpose:	Number of bytes waiting in the receive ring
+//
+//-------------------------------------------------------------------------------
+int AsyncComPort::Available()
+{
+	Lock();
+	int Num = (int) ( RingHead - RingTail );
+	Unlock();
+	return Num;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Purge
+//	Purpose:	Discards queued output and/or received input
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Purge ( bool Tx, bool Rx )
+{
+	Lock();
+	if (Tx) TxLen = 0;
+	if (Rx) RingTail = RingHead;
+	Unlock();
+	Signal ( Rx, Tx );
+
+	if (!Running) return;
+#ifdef _WIN32
+	// No PURGE_RXABORT: that would cancel the I/O thread's read
+	PurgeComm ( hCom, ( Tx ? PURGE_TXCLEAR : 0 ) | ( Rx ? PURGE_RXCLEAR : 0 ) );
+#else
+	if (Tx || Rx) tcflush ( fd, Tx && Rx ? TCIOFLUSH : Tx ? TCOFLUSH : TCIFLUSH );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		GetStats
+//	Purpose:	Copies the transfer counters
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::GetStats ( AsyncComPortStats &Copy )
+{
+	Lock();
+	Copy = Stats;
+	Unlock();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TickCount
+//	Purpose:	Millisecond clock; wraps, so only differences are meaningful
+//
+//-------------------------------------------------------------------------------
+unsigned long AsyncComPort::TickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	struct timespec Ts;
+	clock_gettime ( CLOCK_MONOTONIC, &Ts );
+	return (unsigned long) Ts.tv_sec * 1000UL + (unsigned long) ( Ts.tv_nsec / 1000000L );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Receive
+//	Purpose:	Delivers a block read by the I/O thread
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Receive ( const unsigned char *Buf, int Len )
+{
+	Lock();
+	ReceiveCallback Callback = OnReceive;
+	void *Context = ReceiveContext;
+	Stats.BytesRead += Len;
+	Stats.ReadCompletions++;
+	Unlock();
+
+	if (Callback != NULL && Callback ( Context, Buf, Len )) return;
+
+	Lock();
+	for (int I = 0; I < Len; I++)
+	{
+		if (RingHead - RingTail == (unsigned long) AsyncComPortRingSize)
+		{
+			// Full: keep the newest bytes
+			RingTail++;
+			Stats.Overruns++;
+		}
+		Ring[ RingHead++ & ( AsyncComPortRingSize - 1 ) ] = Buf[ I ];
+	}
+	Unlock();
+	Signal ( true, false );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TakeRing
+//	Purpose:	Copies bytes out of the receive ring (Mutex held)
+//
+//-------------------------------------------------------------------------------
+int AsyncComPort::TakeRing ( unsigned char *Buf, int MaxToRead )
+{
+	int Num = (int) ( RingHead - RingTail );
+	if (Num > MaxToRead) Num = MaxToRead;
+	for (int I = 0; I < Num; I++)
+	{
+		Buf[ I ] = Ring[ RingTail++ & ( AsyncComPortRingSize - 1 ) ];
+	}
+	return Num;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SendQueued
+//	Purpose:	Writes the whole transmit queue in one device write
+//	Returns:	false if nothing was written (empty, or held for coalescing)
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::SendQueued()
+{
+	unsigned char Block[ AsyncComPortTxSize ];
+
+	Lock();
+	if (TxLen == 0 || Failed ||
+		( CoalesceDelay > 0 && TxLen < AsyncComPortTxSize && TickCount() - TxQueued < (unsigned long) CoalesceDelay ))
+	{
+		Unlock();
+		return false;
+	}
+	int Len = TxLen;
+	memcpy ( Block, Tx, Len );
+	TxLen = 0;
+	TxBusy = true;
+	WriteCallback Callback = OnWrite;
+	void *Context = WriteContext;
+	Unlock();
+
+	bool Ok = WriteDevice ( Block, Len );
+
+	Lock();
+	TxBusy = false;
+	Stats.DeviceWrites++;
+	if (Ok) Stats.BytesWritten += Len;
+	else Failed = true;
+	Unlock();
+	Signal ( !Ok, true );
+
+	if (Callback != NULL) Callback ( Context, Ok ? Len : 0, Ok );
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Lock, Unlock, Signal, WaitSignal
+//	Purpose:	Mutex and change notification
+//	Notes:		On Windows the auto-reset events stay set if nobody is waiting,
+//				so a change between a caller's test and its wait is not lost.
+//				Receive and transmit have separate events so that a Flush
+//				cannot take the wake-up meant for a reader.
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Lock()
+{
+#ifdef _WIN32
+	EnterCriticalSection ( &Mutex );
+#else
+	pthread_mutex_lock ( &Mutex );
+#endif
+}
+
+void AsyncComPort::Unlock()
+{
+#ifdef _WIN32
+	LeaveCriticalSection ( &Mutex );
+#else
+	pthread_mutex_unlock ( &Mutex );
+#endif
+}
+
+void AsyncComPort::Signal ( bool Rx, bool Tx )
+{
+#ifdef _WIN32
+	if (Rx) SetEvent ( RxChanged );
+	if (Tx) SetEvent ( TxChanged );
+#else
+	if (Rx || Tx) pthread_cond_broadcast ( &Changed );
+#endif
+}
+
+void AsyncComPort::WaitSignal ( bool Rx, int TimeoutMs )
+{
+#ifdef _WIN32
+	Unlock();
+	WaitForSingleObject ( Rx ? RxChanged : TxChanged, TimeoutMs );
+	Lock();
+#else
+	(void) Rx;										// one condition serves both
+	struct timespec Ts;
+	clock_gettime ( CLOCK_REALTIME, &Ts );
+	Ts.tv_sec += TimeoutMs / 1000;
+	Ts.tv_nsec += ( TimeoutMs % 1000 ) * 1000000L;
+	if (Ts.tv_nsec >= 1000000000L)
+	{
+		Ts.tv_sec++;
+		Ts.tv_nsec -= 1000000000L;
+	}
+	pthread_cond_timedwait ( &Changed, &Mutex, &Ts );
+#endif
+}
+
+#ifdef _WIN32
+//-------------------------------------------------------------------------------
+//
+//	Name:		OpenDevice (Windows)
+//	Purpose:	Opens the port for overlapped I/O
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::OpenDevice ( const char *Name, int Baud, bool EvenParity )
+{
+	char Device[ MAX_PATH ];
+	if (Name[ 0 ] != '/' && Name[ 0 ] != '\\')
+	{
+		_snprintf ( Device, sizeof ( Device ) - 1, "//./%s", Name );		// Use extended port name for high port numbers
+	}
+	else
+	{
+		_snprintf ( Device, sizeof ( Device ) - 1, "%s", Name );
+	}
+	Device[ sizeof ( Device ) - 1 ] = 0;
+
+	hCom = CreateFileA ( Device, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL );
+	if (hCom == INVALID_HANDLE_VALUE) return false;
+
+	if (GetCommState ( hCom, &dcb ) == 0)
+	{
+		CloseDevice();
+		return false;
+	}
+	dcb.BaudRate = Baud;
+	dcb.ByteSize = 8;
+	dcb.Parity = EvenParity ? EVENPARITY : NOPARITY;
+	dcb.StopBits = ONESTOPBIT;
+
+	if (!ConfigureDevice())
+	{
+		CloseDevice();
+		return false;
+	}
+
+	memset ( &WaitOverlapped, 0, sizeof ( WaitOverlapped ) );
+	memset ( &ReadOverlapped, 0, sizeof ( ReadOverlapped ) );
+	memset ( &WriteOverlapped, 0, sizeof ( WriteOverlapped ) );
+	WaitOverlapped.hEvent = CreateEvent ( NULL, TRUE, FALSE, NULL );
+	ReadOverlapped.hEvent = CreateEvent ( NULL, TRUE, FALSE, NULL );
+	WriteOverlapped.hEvent = CreateEvent ( NULL, TRUE, FALSE, NULL );
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ConfigureDevice (Windows)
+//	Purpose:	Applies the DCB, timeouts and event mask
+//	Notes:		Reads return at once with whatever the driver holds; the
+//				waiting is done on EV_RXCHAR
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::ConfigureDevice()
+{
+	COMMTIMEOUTS Timeouts;
+	Timeouts.ReadIntervalTimeout = MAXDWORD;
+	Timeouts.ReadTotalTimeoutMultiplier = 0;
+	Timeouts.ReadTotalTimeoutConstant = 0;
+	Timeouts.WriteTotalTimeoutMultiplier = 0;
+	Timeouts.WriteTotalTimeoutConstant = 0;
+
+	return SetCommState ( hCom, &dcb ) != 0 &&
+		SetCommTimeouts ( hCom, &Timeouts ) != 0 &&
+		SetCommMask ( hCom, EV_RXCHAR ) != 0;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		CloseDevice (Windows)
+//	Purpose:	Closes the handle and its events
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::CloseDevice()
+{
+	if (hCom == INVALID_HANDLE_VALUE) return;
+	CloseHandle ( hCom );
+	hCom = INVALID_HANDLE_VALUE;
+	if (WaitOverlapped.hEvent != NULL) CloseHandle ( WaitOverlapped.hEvent );
+	if (ReadOverlapped.hEvent != NULL) CloseHandle ( ReadOverlapped.hEvent );
+	if (WriteOverlapped.hEvent != NULL) CloseHandle ( WriteOverlapped.hEvent );
+	WaitOverlapped.hEvent = ReadOverlapped.hEvent = WriteOverlapped.hEvent = NULL;
+}
+
+bool AsyncComPort::SetBaud ( int Baud )
+{
+	dcb.BaudRate = Baud;
+	return Running && SetCommState ( hCom, &dcb ) != 0;
+}
+
+void AsyncComPort::SetCTSFlowControl ( bool CTSOn )
+{
+	dcb.fOutxCtsFlow = CTSOn;
+	if (Running) SetCommState ( hCom, &dcb );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ReadDevice (Windows)
+//	Purpose:	Reads everything the driver holds
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::ReadDevice()
+{
+	unsigned char Buf[ AsyncComPortChunk ];
+
+	for (;;)
+	{
+		COMSTAT Status;
+		DWORD Errors;
+		if (!ClearCommError ( hCom, &Errors, &Status )) return false;
+		DWORD Num = Status.cbInQue < (DWORD) AsyncComPortChunk ? Status.cbInQue : (DWORD) AsyncComPortChunk;
+		if (Num == 0) return true;
+
+		DWORD NumRead = 0;
+		ResetEvent ( ReadOverlapped.hEvent );
+		if (!ReadFile ( hCom, Buf, Num, &NumRead, &ReadOverlapped ))
+		{
+			if (GetLastError() != ERROR_IO_PENDING) return false;
+			if (!GetOverlappedResult ( hCom, &ReadOverlapped, &NumRead, TRUE )) return false;
+		}
+		if (NumRead == 0) return true;
+		Receive ( Buf, (int) NumRead );
+	}
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WriteDevice (Windows)
+//	Purpose:	Overlapped write of one block, waiting for completion
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::WriteDevice ( const unsigned char *Buf, int Len )
+{
+	DWORD NumWritten = 0;
+	ResetEvent ( WriteOverlapped.hEvent );
+	if (!WriteFile ( hCom, Buf, Len, &NumWritten, &WriteOverlapped ))
+	{
+		if (GetLastError() != ERROR_IO_PENDING) return false;
+		if (!GetOverlappedResult ( hCom, &WriteOverlapped, &NumWritten, TRUE )) return false;
+	}
+	return int ( NumWritten ) == Len;
+}
+
+void AsyncComPort::Wake()
+{
+	SetEvent ( WakeEvent );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Run (Windows)
+//	Purpose:	I/O thread body
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Run()
+{
+	bool WaitPending = false;
+	bool Ok = true;
+
+	for (;;)
+	{
+		Lock();
+		bool Quit = StopRequested;
+		DWORD Timeout = INFINITE;
+		if (TxLen > 0 && CoalesceDelay > 0)
+		{
+			long Remaining = CoalesceDelay - (long) ( TickCount() - TxQueued );
+			Timeout = Remaining > 0 ? (DWORD) Remaining : 0;
+		}
+		Unlock();
+		if (Quit) break;
+
+		if (!WaitPending)
+		{
+			ResetEvent ( WaitOverlapped.hEvent );
+			if (WaitCommEvent ( hCom, &EventMask, &WaitOverlapped ))
+			{
+				// Already signalled
+				if (!ReadDevice()) { Ok = false; break; }
+				SendQueued();
+				continue;
+			}
+			if (GetLastError() != ERROR_IO_PENDING) { Ok = false; break; }
+			WaitPending = true;
+
+			// Anything that arrived after the last read but before the
+			// wait was armed
+			if (!ReadDevice()) { Ok = false; break; }
+		}
+
+		HANDLE Handles[ 2 ];
+		Handles[ 0 ] = WaitOverlapped.hEvent;
+		Handles[ 1 ] = WakeEvent;
+		DWORD Result = WaitForMultipleObjects ( 2, Handles, FALSE, Timeout );
+		if (Result == WAIT_OBJECT_0)
+		{
+			DWORD Dummy;
+			WaitPending = false;
+			if (!GetOverlappedResult ( hCom, &WaitOverlapped, &Dummy, FALSE )) { Ok = false; break; }
+			if (!ReadDevice()) { Ok = false; break; }
+		}
+		SendQueued();
+	}
+
+	if (WaitPending)
+	{
+		// Clearing the mask completes the outstanding WaitCommEvent
+		DWORD Dummy;
+		SetCommMask ( hCom, 0 );
+		GetOverlappedResult ( hCom, &WaitOverlapped, &Dummy, TRUE );
+	}
+
+	if (!Ok)
+	{
+		Lock();
+		Failed = true;
+		Unlock();
+		Signal ( true, true );
+	}
+}
+
+unsigned __stdcall AsyncComPort::ThreadProc ( void *Param )
+{
+	( (AsyncComPort *) Param )->Run();
+	return 0;
+}
+
+#else
+//-------------------------------------------------------------------------------
+//
+//	Name:		OpenDevice (POSIX)
+//	Purpose:	Opens a serial device (or pseudo-terminal) in raw mode
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::OpenDevice ( const char *Name, int Baud, bool EvenParity )
+{
+	fd = open ( Name, O_RDWR | O_NOCTTY | O_NONBLOCK );
+	if (fd < 0) return false;
+
+	BaudRate = Baud;
+	Parity = EvenParity;
+	if (!ConfigureDevice() || pipe ( WakePipe ) != 0)
+	{
+		CloseDevice();
+		return false;
+	}
+	fcntl ( WakePipe[ 0 ], F_SETFL, O_NONBLOCK );
+	fcntl ( WakePipe[ 1 ], F_SETFL, O_NONBLOCK );
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ConfigureDevice (POSIX)
+//	Purpose:	8 data bits, one stop bit, raw, non-blocking
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::ConfigureDevice()
+{
+	speed_t Speed;
+	switch (BaudRate)
+	{
+	case 1200:	Speed = B1200; break;
+	case 2400:	Speed = B2400; break;
+	case 4800:	Speed = B4800; break;
+	case 19200: Speed = B19200; break;
+	case 38400: Speed = B38400; break;
+	case 57600: Speed = B57600; break;
+	case 115200: Speed = B115200; break;
+	default:	Speed = B9600; break;
+	}
+
+	struct termios Tio;
+	if (tcgetattr ( fd, &Tio ) != 0) return false;
+	cfmakeraw ( &Tio );
+	Tio.c_cflag |= CLOCAL | CREAD;
+	Tio.c_cflag &= ~( CSTOPB | PARENB | PARODD );
+	if (Parity) Tio.c_cflag |= PARENB;
+#ifdef CRTSCTS
+	if (CTSFlow) Tio.c_cflag |= CRTSCTS;
+	else Tio.c_cflag &= ~CRTSCTS;
+#endif
+	Tio.c_cc[ VMIN ] = 0;
+	Tio.c_cc[ VTIME ] = 0;
+	cfsetispeed ( &Tio, Speed );
+	cfsetospeed ( &Tio, Speed );
+	return tcsetattr ( fd, TCSANOW, &Tio ) == 0;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		CloseDevice (POSIX)
+//	Purpose:	Closes the device and the wake pipe
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::CloseDevice()
+{
+	if (fd >= 0) close ( fd );
+	if (WakePipe[ 0 ] >= 0) close ( WakePipe[ 0 ] );
+	if (WakePipe[ 1 ] >= 0) close ( WakePipe[ 1 ] );
+	fd = -1;
+	WakePipe[ 0 ] = WakePipe[ 1 ] = -1;
+}
+
+bool AsyncComPort::SetBaud ( int Baud )
+{
+	BaudRate = Baud;
+	return Running && ConfigureDevice();
+}
+
+void AsyncComPort::SetCTSFlowControl ( bool CTSOn )
+{
+	CTSFlow = CTSOn;
+	if (Running) ConfigureDevice();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ReadDevice (POSIX)
+//	Purpose:	Reads everything available
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::ReadDevice()
+{
+	unsigned char Buf[ AsyncComPortChunk ];
+
+	for (;;)
+	{
+		ssize_t NumRead = read ( fd, Buf, sizeof ( Buf ) );
+		if (NumRead > 0)
+		{
+			Receive ( Buf, (int) NumRead );
+			if (NumRead < (ssize_t) sizeof ( Buf )) return true;
+			continue;
+		}
+		if (NumRead < 0 && errno == EINTR) continue;
+		if (NumRead < 0 && errno == EAGAIN) return true;
+		return false;											// hangup or error
+	}
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WriteDevice (POSIX)
+//	Purpose:	Writes one block, waiting for the device as needed
+//
+//-------------------------------------------------------------------------------
+bool AsyncComPort::WriteDevice ( const unsigned char *Buf, int Len )
+{
+	while (Len > 0)
+	{
+		ssize_t NumWritten = write ( fd, Buf, Len );
+		if (NumWritten < 0)
+		{
+			if (errno == EINTR) continue;
+			if (errno != EAGAIN) return false;
+			struct pollfd Pfd;
+			Pfd.fd = fd;
+			Pfd.events = POLLOUT;
+			Pfd.revents = 0;
+			if (poll ( &Pfd, 1, 1000 ) <= 0) return false;
+			continue;
+		}
+		Buf += NumWritten;
+		Len -= (int) NumWritten;
+	}
+	return true;
+}
+
+void AsyncComPort::Wake()
+{
+	char Byte = 0;
+	if (WakePipe[ 1 ] >= 0 && write ( WakePipe[ 1 ], &Byte, 1 ) < 0)
+	{
+		// Pipe full: the thread is awake anyway
+	}
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Run (POSIX)
+//	Purpose:	I/O thread body
+//
+//-------------------------------------------------------------------------------
+void AsyncComPort::Run()
+{
+	bool Ok = true;
+
+	for (;;)
+	{
+		Lock();
+		bool Quit = StopRequested;
+		int Timeout = -1;
+		if (TxLen > 0 && CoalesceDelay > 0)
+		{
+			long Remaining = CoalesceDelay - (long) ( TickCount() - TxQueued );
+			Timeout = Remaining > 0 ? (int) Remaining : 0;
+		}
+		Unlock();
+		if (Quit) break;
+
+		struct pollfd Pfd[ 2 ];
+		Pfd[ 0 ].fd = fd;
+		Pfd[ 0 ].events = POLLIN;
+		Pfd[ 0 ].revents = 0;
+		Pfd[ 1 ].fd = WakePipe[ 0 ];
+		Pfd[ 1 ].events = POLLIN;
+		Pfd[ 1 ].revents = 0;
+		if (poll ( Pfd, 2, Timeout ) < 0)
+		{
+			if (errno == EINTR) continue;
+			Ok = false;
+			break;
+		}
+
+		if (Pfd[ 0 ].revents & POLLIN)
+		{
+			if (!ReadDevice()) { Ok = false; break; }
+		}
+		else if (Pfd[ 0 ].revents & ( POLLHUP | POLLERR | POLLNVAL ))
+		{
+			Ok = false;
+			break;
+		}
+
+		if (Pfd[ 1 ].revents & POLLIN)
+		{
+			char Drain[ 64 ];
+			while (read ( WakePipe[ 0 ], Drain, sizeof ( Drain ) ) > 0) {}
+		}
+
+		SendQueued();
+	}
+
+	if (!Ok)
+	{
+		Lock();
+		Failed = true;
+		Unlock();
+		Signal ( true, true );
+	}
+}
+
+void *AsyncComPort::ThreadProc ( void *Param )
+{
+	( (AsyncComPort *) Param )->Run();
+	return NULL;
+}
+#endif
@@ -0,0 +1,148 @@
+// AsyncComPort.h : Declaration of the asynchronous serial port
+//
+// An I/O thread keeps a read outstanding on the port at all times and
+// moves whatever arrives, in bulk, into a receive ring. Readers wait on
+// the ring rather than on the device, so they see data as soon as it
+// lands. Writes are queued and sent by the same thread; everything
+// queued while a write is in progress goes out in the next single
+// write. Overlapped I/O on Windows, termios and poll() elsewhere.
+//
+// No MFC or ATL dependencies (see RoboFocusEngineTest.cpp).
+
+#ifndef __ASYNCCOMPORT_H_
+#define __ASYNCCOMPORT_H_
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+const int AsyncComPortRingSize = 4096;			// receive ring (power of two)
+const int AsyncComPortTxSize = 1024;			// transmit queue
+const int AsyncComPortChunk = 512;				// largest single read from the device
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		AsyncComPortStats
+//	Purpose:	Transfer counters
+//
+//-------------------------------------------------------------------------------
+struct AsyncComPortStats
+{
+	unsigned long BytesRead;
+	unsigned long ReadCompletions;		// reads that returned data
+	unsigned long BytesWritten;
+	unsigned long WriteRequests;		// calls to Write
+	unsigned long DeviceWrites;			// writes issued to the device
+	unsigned long Overruns;				// bytes dropped because the ring was full
+};
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		AsyncComPort
+//	Purpose:	Serial port with an I/O thread, receive ring and write queue
+//
+//-------------------------------------------------------------------------------
+class AsyncComPort
+{
+// Construction
+public:
+	AsyncComPort();
+	~AsyncComPort();
+
+	// Called on the I/O thread with each block as it is read. Return true
+	// if the bytes were consumed; otherwise they go to the receive ring.
+	typedef bool (*ReceiveCallback) ( void *Context, const unsigned char *Buf, int Len );
+
+	// Called on the I/O thread after each device write
+	typedef void (*WriteCallback) ( void *Context, int NumWritten, bool Ok );
+
+// Implementation
+public:
+	bool Open ( const char *Name, int Baud, bool EvenParity = false );
+	void Close();
+	bool IsOpen() const { return Running; }
+	bool SetBaud ( int Baud );
+	void SetCTSFlowControl ( bool CTSOn );
+
+	void SetReadTimeouts ( int InterByte, int TotalMultiplier, int TotalConstant );
+	void SetCoalesceDelay ( int Milliseconds );
+	void SetReceiveCallback ( ReceiveCallback Callback, void *Context );
+	void SetWriteCallback ( WriteCallback Callback, void *Context );
+
+	bool Write ( const unsigned char *Buf, int NumToWrite );
+	bool Flush ( int TimeoutMs );
+	int Read ( unsigned char *Buf, int NumToRead );
+	int ReadAvailable ( unsigned char *Buf, int MaxToRead, int TimeoutMs );
+	int Available();
+	void Purge ( bool Tx, bool Rx );
+	void GetStats ( AsyncComPortStats &Stats );
+
+	static unsigned long TickCount();
+
+protected:
+	bool OpenDevice ( const char *Name, int Baud, bool EvenParity );
+	void CloseDevice();
+	bool ConfigureDevice();
+	bool ReadDevice();
+	bool WriteDevice ( const unsigned char *Buf, int Len );
+	void Receive ( const unsigned char *Buf, int Len );
+	int TakeRing ( unsigned char *Buf, int MaxToRead );
+	bool SendQueued();
+	void Wake();
+	void Lock();
+	void Unlock();
+	void Signal ( bool Rx, bool Tx );
+	void WaitSignal ( bool Rx, int TimeoutMs );	// called and returns with Mutex held
+	void Run();
+
+#ifdef _WIN32
+	static unsigned __stdcall ThreadProc ( void *Param );
+	HANDLE hCom;
+	DCB dcb;
+	HANDLE WakeEvent;			// auto-reset; tells the I/O thread to write or stop
+	OVERLAPPED WaitOverlapped;	// WaitCommEvent for EV_RXCHAR
+	OVERLAPPED ReadOverlapped;
+	OVERLAPPED WriteOverlapped;
+	DWORD EventMask;
+	HANDLE RxChanged;			// auto-reset; set when the ring gains data
+	HANDLE TxChanged;			// auto-reset; set when the queue drains
+	HANDLE Thread;
+	CRITICAL_SECTION Mutex;
+#else
+	static void *ThreadProc ( void *Param );
+	int fd;
+	int WakePipe[ 2 ];
+	int BaudRate;
+	bool Parity;
+	bool CTSFlow;
+	pthread_t Thread;
+	pthread_mutex_t Mutex;
+	pthread_cond_t Changed;
+#endif
+
+	volatile bool Running;
+
+	// Guarded by Mutex
+	bool StopRequested;
+	bool Failed;				// the device reported an error; the I/O thread has stopped
+	unsigned char Ring[ AsyncComPortRingSize ];
+	unsigned long RingHead;		// total bytes ever stored
+	unsigned long RingTail;		// total bytes ever taken
+	unsigned char Tx[ AsyncComPortTxSize ];
+	int TxLen;
+	bool TxBusy;				// the I/O thread is writing a block taken from Tx
+	unsigned long TxQueued;		// tick the oldest queued byte arrived
+	int InterByteTimeout;		// milliseconds
+	int TotalTimeoutMultiplier;	// milliseconds per byte
+	int TotalTimeoutConstant;	// milliseconds
+	int CoalesceDelay;			// milliseconds to hold a write for more bytes
+	ReceiveCallback OnReceive;
+	void *ReceiveContext;
+	WriteCallback OnWrite;
+	void *WriteContext;
+	AsyncComPortStats Stats;
+};
+
+#endif //__ASYNCCOMPORT_H_
@@ -23,6 +23,8 @@
 // 01-Jan-98 dbg     Initial edit
 // 04-Sep-02 dbg     Update header for ASCOM release
 // 05-Jan-04 rbd     Per dbg, add extended port syntax in OpenPort()
+// 17-Oct-26 asc     Add ReadAvailable() for the RoboFocus engine reader thread
+// 17-Oct-26 asc     Run on AsyncComPort: overlapped I/O, receive ring, queued writes
 //
 
 #include "stdafx.h"
@@ -42,7 +44,8 @@ static char THIS_FILE[] = __FILE__;
 //-------------------------------------------------------------------------------
 ComPort::ComPort()
 {
-	hCom = INVALID_HANDLE_VALUE;		// Handle to com device
+	WriteTimeoutConstant = WriteTotalTimeoutConstant;
+	WriteTimeoutMultiplier = WriteTotalTimeoutMultiplier;
 }
 
 //-------------------------------------------------------------------------------
@@ -60,62 +63,33 @@ ComPort::~ComPort()
 //
 //	Name:		OpenPort
 //	Purpose:	Opens a COM port
+//	Notes:		The port gets its own I/O thread; see AsyncComPort.h
 //
 //-------------------------------------------------------------------------------
 BOOL ComPort::OpenPort ( CString COM, int Baud, BOOL EvenParity /*=FALSE*/ )
 {
 	if (COM[0] != '/') COM = "//./" + COM;								// Use extended port name for high port numbers
 
-	// Access the port
-	hCom = CreateFile ( COM, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL );
-	if (hCom == INVALID_HANDLE_VALUE) return FALSE;
+	Port.SetReadTimeouts ( ReadIntervalTimeout, ReadTotalTimeoutMultiplier, ReadTotalTimeoutConstant );
+	WriteTimeoutConstant = WriteTotalTimeoutConstant;
+	WriteTimeoutMultiplier = WriteTotalTimeoutMultiplier;
 
-	// Get a device record
-	if (GetCommState(hCom, &dcb) == 0) 
-	{
-		CloseHandle ( hCom );
-		return FALSE;
-	}
-
-	// Set comport timeouts
-	COMMTIMEOUTS Timeouts;
-	Timeouts.ReadIntervalTimeout = ReadIntervalTimeout;					// milliseconds between receive chars
-	Timeouts.ReadTotalTimeoutMultiplier = ReadTotalTimeoutMultiplier;	// milliseconds per character (min 9600 baud)
-	Timeouts.ReadTotalTimeoutConstant = ReadTotalTimeoutConstant;		// additional milliseconds per message
-	Timeouts.WriteTotalTimeoutMultiplier = WriteTotalTimeoutMultiplier; // no write timeouts
-	Timeouts.WriteTotalTimeoutConstant = WriteTotalTimeoutConstant;
-	if (!SetCommTimeouts ( hCom, &Timeouts ))
-	{
-		CloseHandle ( hCom );
-		return FALSE;
-	}
-
-
-	// Set default baud rate
-	dcb.BaudRate = Baud;
-	dcb.ByteSize = 8;
-	dcb.Parity = EvenParity ? EVENPARITY : NOPARITY;
-	dcb.StopBits = ONESTOPBIT;
-	
-	return SetCommState(hCom, &dcb) != 0;
+	return Port.Open ( COM, Baud, EvenParity != FALSE );
 }
 
 //-------------------------------------------------------------------------------
 //
 //	Name:		SetPortWriteTimeouts
 //	Purpose:	Sets up the port write timeouts
+//	Notes:		Applied by WritePort while it waits for the queue to drain
 //
 //-------------------------------------------------------------------------------
 BOOL ComPort::SetPortWriteTimeouts( int TotalTimeoutConstant, int TotalTimeoutMultiplier )
 {
-	// Set comport timeouts
-	COMMTIMEOUTS Timeouts;
-	Timeouts.ReadIntervalTimeout = ReadIntervalTimeout;					// milliseconds between receive chars
-	Timeouts.ReadTotalTimeoutMultiplier = ReadTotalTimeoutMultiplier;	// milliseconds per character (min 9600 baud)
-	Timeouts.ReadTotalTimeoutConstant = ReadTotalTimeoutConstant;		// additional milliseconds per message
-	Timeouts.WriteTotalTimeoutMultiplier = TotalTimeoutMultiplier;
-	Timeouts.WriteTotalTimeoutConstant = TotalTimeoutConstant;
-	return SetCommTimeouts ( hCom, &Timeouts );
+	WriteTimeoutConstant = TotalTimeoutConstant;
+	WriteTimeoutMultiplier = TotalTimeoutMultiplier;
+	Port.SetReadTimeouts ( ReadIntervalTimeout, ReadTotalTimeoutMultiplier, ReadTotalTimeoutConstant );
+	return Port.IsOpen();
 }
 
 //-------------------------------------------------------------------------------
@@ -127,9 +101,7 @@ BOOL ComPort::SetPortWriteTimeouts( int TotalTimeoutConstant, int TotalTimeoutMu
 BOOL ComPort::SetPortParams ( int Baud )
 {
 	// Set new baud rate
-	dcb.BaudRate = Baud;
-	
-	return SetCommState(hCom, &dcb) == 0;
+	return Port.SetBaud ( Baud );
 }
 
 //-------------------------------------------------------------------------------
@@ -140,37 +112,52 @@ BOOL ComPort::SetPortParams ( int Baud )
 //-------------------------------------------------------------------------------
 void ComPort::ClosePort()
 {
-	if (hCom == INVALID_HANDLE_VALUE) return;
-	CloseHandle ( hCom );
-	hCom = INVALID_HANDLE_VALUE;
+	Port.Close();
 }
 
 //-------------------------------------------------------------------------------
 //
 //	Name:		WritePort
 //	Purpose:	Writes to the COM port
+//	Notes:		Queues the bytes and waits until the I/O thread has written
+//				them. Callers that need not wait use GetAsyncPort()->Write.
 //
 //-------------------------------------------------------------------------------
 BOOL ComPort::WritePort ( unsigned char *Buf, int NumToWrite )
 {
-	DWORD NumWritten;
-	BOOL Ok = WriteFile( hCom, Buf, NumToWrite, &NumWritten, NULL );
-	Ok &= NumToWrite == int ( NumWritten );
-	return Ok;
+	if (!Port.Write ( Buf, NumToWrite )) return FALSE;
+
+	int Timeout = -1;													// no write timeouts
+	if (WriteTimeoutConstant > 0 || WriteTimeoutMultiplier > 0)
+	{
+		Timeout = WriteTimeoutConstant + WriteTimeoutMultiplier * NumToWrite;
+	}
+	return Port.Flush ( Timeout );
 }
 
 //-------------------------------------------------------------------------------
 //
 //	Name:		ReadPort
-//	Purpose:	Writes to the COM port
+//	Purpose:	Reads from the COM port
+//	Notes:		Same timeout rules as ReadFile with the COMMTIMEOUTS set up by
+//				SetTimeouts, but served from the receive ring
 //
 //-------------------------------------------------------------------------------
 BOOL ComPort::ReadPort ( unsigned char *Buf, int NumToRead )
 {
-	DWORD NumRead;
-	BOOL Ok = ReadFile ( hCom, Buf, NumToRead, &NumRead, NULL );
-	Ok &= int ( NumRead ) == NumToRead;
-	return Ok;
+	return Port.Read ( Buf, NumToRead ) == NumToRead;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ReadAvailable
+//	Purpose:	Waits up to TimeoutMs for data and reads whatever has arrived
+//	Returns:	Number of bytes read, 0 on timeout, -1 on error
+//
+//-------------------------------------------------------------------------------
+int ComPort::ReadAvailable ( unsigned char *Buf, int MaxToRead, int TimeoutMs )
+{
+	return Port.ReadAvailable ( Buf, MaxToRead, TimeoutMs );
 }
 
 //-------------------------------------------------------------------------------
@@ -181,7 +168,8 @@ BOOL ComPort::ReadPort ( unsigned char *Buf, int NumToRead )
 //-------------------------------------------------------------------------------
 BOOL ComPort::PurgePort()
 {
-	return PurgeComm ( hCom, PURGE_TXCLEAR | PURGE_RXCLEAR | PURGE_RXABORT );
+	Port.Purge ( true, true );
+	return Port.IsOpen();
 }
 
 //-------------------------------------------------------------------------------
@@ -192,7 +180,8 @@ BOOL ComPort::PurgePort()
 //-------------------------------------------------------------------------------
 BOOL ComPort::PurgeTx()
 {
-	return PurgeComm ( hCom, PURGE_TXCLEAR );
+	Port.Purge ( true, false );
+	return Port.IsOpen();
 }
 
 //-------------------------------------------------------------------------------
@@ -203,7 +192,8 @@ BOOL ComPort::PurgeTx()
 //-------------------------------------------------------------------------------
 BOOL ComPort::PurgeRx()
 {
-	return PurgeComm ( hCom, PURGE_RXCLEAR | PURGE_RXABORT );
+	Port.Purge ( false, true );
+	return Port.IsOpen();
 }
 
 //-------------------------------------------------------------------------------
@@ -214,26 +204,7 @@ BOOL ComPort::PurgeRx()
 //-------------------------------------------------------------------------------
 BOOL ComPort::ReadPortNoWaiting ( unsigned char &Char )
 {
-	// Change timeouts
-	COMMTIMEOUTS Timeouts;
-	Timeouts.ReadIntervalTimeout = 1;			// Minimal timeouts
-	Timeouts.ReadTotalTimeoutMultiplier = 1;
-	Timeouts.ReadTotalTimeoutConstant = 1;
-	Timeouts.WriteTotalTimeoutMultiplier = WriteTotalTimeoutMultiplier; // Don't change write
-	Timeouts.WriteTotalTimeoutConstant = WriteTotalTimeoutConstant;
-	if (!SetCommTimeouts ( hCom, &Timeouts )) return FALSE;
-
-	BOOL CharReceived = ReadPort ( &Char, 1 );
-
-	// Restore timeouts
-	Timeouts.ReadIntervalTimeout = ReadIntervalTimeout;					// milliseconds between receive chars
-	Timeouts.ReadTotalTimeoutMultiplier = ReadTotalTimeoutMultiplier;	// milliseconds per character (min 9600 baud)
-	Timeouts.ReadTotalTimeoutConstant = ReadTotalTimeoutConstant;		// additional milliseconds per message
-	Timeouts.WriteTotalTimeoutMultiplier = WriteTotalTimeoutMultiplier; // no write timeouts
-	Timeouts.WriteTotalTimeoutConstant = WriteTotalTimeoutConstant;
-	SetCommTimeouts ( hCom, &Timeouts );
-
-	return CharReceived;
+	return Port.ReadAvailable ( &Char, 1, 0 ) == 1;
 }
 
 //-------------------------------------------------------------------------------
@@ -245,10 +216,7 @@ BOOL ComPort::ReadPortNoWaiting ( unsigned char &Char )
 //-------------------------------------------------------------------------------
 void ComPort::SetCTSFlowControl(BOOL CTSOn)
 {
-	// Set CTS state
-	dcb.fOutxCtsFlow = CTSOn;
-	
-	SetCommState(hCom, &dcb);
+	Port.SetCTSFlowControl ( CTSOn != FALSE );
 }
 
 //-------------------------------------------------------------------------------
@@ -261,24 +229,7 @@ void ComPort::SetCTSFlowControl(BOOL CTSOn)
 void ComPort::SetTimeouts(int NewReadIntervalTimeout, int NewReadTotalTimeoutMultiplier, int NewReadTotalTimeoutConstant, 
 						  int NewWriteTotalTimeoutMultiplier, int NewWriteTotalTimeoutConstant )
 {
-	// Get current timeouts
-	COMMTIMEOUTS Timeouts;
-	if (!GetCommTimeouts ( hCom, &Timeouts ))
-	{
-		// Oops -- Set defaults
-		Timeouts.ReadIntervalTimeout = ReadIntervalTimeout;					// milliseconds between receive chars
-		Timeouts.ReadTotalTimeoutMultiplier = ReadTotalTimeoutMultiplier;	// milliseconds per character (min 9600 baud)
-		Timeouts.ReadTotalTimeoutConstant = ReadTotalTimeoutConstant;		// additional milliseconds per message
-		Timeouts.WriteTotalTimeoutMultiplier = WriteTotalTimeoutMultiplier; // no write timeouts
-		Timeouts.WriteTotalTimeoutConstant = WriteTotalTimeoutConstant;
-	}
- 
-	if (NewReadIntervalTimeout >= 0) Timeouts.ReadIntervalTimeout = NewReadIntervalTimeout;					// milliseconds between receive chars
-	if (NewReadTotalTimeoutMultiplier >= 0) Timeouts.ReadTotalTimeoutMultiplier = NewReadTotalTimeoutMultiplier;	// milliseconds per character (min 9600 baud)
-	if (NewReadTotalTimeoutConstant >= 0) Timeouts.ReadTotalTimeoutConstant = NewReadTotalTimeoutConstant;		// additional milliseconds per message
-	if (NewWriteTotalTimeoutMultiplier >= 0) Timeouts.WriteTotalTimeoutMultiplier = NewWriteTotalTimeoutMultiplier; // no write timeouts
-	if (NewWriteTotalTimeoutConstant >= 0) Timeouts.WriteTotalTimeoutConstant = NewWriteTotalTimeoutConstant;
-
-	SetCommTimeouts ( hCom, &Timeouts );
+	Port.SetReadTimeouts ( NewReadIntervalTimeout, NewReadTotalTimeoutMultiplier, NewReadTotalTimeoutConstant );
+	if (NewWriteTotalTimeoutMultiplier >= 0) WriteTimeoutMultiplier = NewWriteTotalTimeoutMultiplier;
+	if (NewWriteTotalTimeoutConstant >= 0) WriteTimeoutConstant = NewWriteTotalTimeoutConstant;
 }
-
@@ -4,6 +4,8 @@ const int ReadTotalTimeoutConstant = 100;		// additional milliseconds per messag
 const int WriteTotalTimeoutMultiplier = 0;		// no write timeouts
 const int WriteTotalTimeoutConstant = 0;
 
+#include "AsyncComPort.h"
+
 class ComPort
 {
 
@@ -14,8 +16,9 @@ public:
 
 // Implementation
 protected:
-	HANDLE hCom;		// Handle to com device
-	DCB dcb;			// Device control block
+	AsyncComPort Port;	// Overlapped port and its I/O thread
+	int WriteTimeoutConstant;	// milliseconds, 0 for none
+	int WriteTimeoutMultiplier;	// milliseconds per character
 
 public:
 	BOOL ReadPortNoWaiting ( unsigned char &Char );
@@ -25,10 +28,12 @@ public:
 	void ClosePort();
 	BOOL WritePort ( unsigned char *Buf, int NumToWrite );
 	BOOL ReadPort ( unsigned char *Buf, int NumToRead );
+	int ReadAvailable ( unsigned char *Buf, int MaxToRead, int TimeoutMs );
 	BOOL PurgePort();
 	BOOL PurgeTx();
 	BOOL PurgeRx();
 	void SetCTSFlowControl(BOOL CTSOn);
 	void SetTimeouts(int NewReadIntervalTimeout, int NewReadTotalTimeoutMultiplier, int NewReadTotalTimeoutConstant, 
 						  int NewWriteTotalTimeoutMultiplier, int NewWriteTotalTimeoutConstant );
+	AsyncComPort *GetAsyncPort() { return &Port; }
 };
\ No newline at end of file
@@ -21,6 +21,8 @@
 // 01-Sep-01 dbg     Initial edit
 // 04-Sep-02 dbg     Update header for ASCOM release
 // 28-Mar-09 dbg     Increase number of available COM ports
+// 17-Oct-26 asc     Run the port through RoboFocusEngine; getters read its snapshot
+// 17-Oct-26 asc     Engine link goes straight to the AsyncComPort write queue
 //
 //
 
@@ -29,6 +31,7 @@
 #include "Focuser.h"
 #include "Setup.h"
 #include "ComPort.h"
+#include "RoboFocusEngine.h"
 
 /////////////////////////////////////////////////////////////////////////////
 // CFocuser
@@ -83,54 +86,22 @@ STDMETHODIMP CFocuser::get_IsMoving(VARIANT_BOOL *pVal)
 		// Default to not moving
 	*pVal = VARIANT_FALSE;
 
-	// Check whether a command has gone out
-	if (!bMoving)
+	if (Engine == NULL)
 	{
 		return S_OK;
 	}
 
-	unsigned char Char;
-	while (Port->ReadPortNoWaiting ( Char ))
+	// The engine's reader thread tracks the motion characters and the
+	// closing FD frame, and times out a focuser that stops answering
+	if (Engine->TakeLinkFailure())
 	{
-		if (Char == 'I' || Char == 'O')
-		{
-			// Still moving; reset timeout
-			*pVal = VARIANT_TRUE;
-			Timeout = clock() + CLOCKS_PER_SEC;
-			continue;
-		}
-		// If was an end command...
-		else if (Char == 'F') 
-		{
-			// We won't bother checking the message
-			unsigned char Buf[ 10 ];
-			Port->ReadPort ( Buf, 8 );
-			*pVal = VARIANT_FALSE;
-			bMoving = FALSE;
-			return S_OK;
-		}
-		
-		// We'll assume we just got a bad character and keep going
-	}
-
-	// If we got told that we're still waiting; great
-	if (*pVal == VARIANT_TRUE) return S_OK;
-
-	// We didn't get a character; check for timeout
-	if (clock() < Timeout) 
-	{
-		// Assume still moving
-		*pVal = VARIANT_TRUE;
-		return S_OK;
-	}
-	else
-	{
-		// Whoops -- didn't get response
-		*pVal = VARIANT_FALSE;
-		bMoving = FALSE;
 		return Error ( "Link fail", IID_IFocuser );
 	}
 
+	RoboFocusSnapshot Snap;
+	Engine->GetSnapshot ( Snap );
+	*pVal = Snap.Moving ? VARIANT_TRUE : VARIANT_FALSE;
+	return S_OK;
 }
 
 STDMETHODIMP CFocuser::Move(long Position)
@@ -139,14 +110,15 @@ STDMETHODIMP CFocuser::Move(long Position)
 
 	if (bTempCompMode) return Error ( "Temperature Compensation On", IID_IFocuser );
 
-	VARIANT_BOOL Moving; // Dummy; sets bMoving
+	VARIANT_BOOL Moving;
 	get_IsMoving ( &Moving );
-	if (bMoving) return Error ( "Focuser already in motion", IID_IFocuser );
+	if (Moving) return Error ( "Focuser already in motion", IID_IFocuser );
 
 	if (Position < 0 || Position > MaxPosition) return Error ( "Value out of range", IID_IFocuser );
 
+	// Ask afresh: the hand box may have moved the focuser since the last poll
 	long CurrentPos;
-	if (!GetPosition( CurrentPos )) return Error ( "Link fail", IID_IFocuser );
+	if (Engine == NULL || !Engine->WaitForPosition ( CurrentPos, RoboFocusMotionTimeout )) return Error ( "Link fail", IID_IFocuser );
 
 	if (!SetPosition ( Position - CurrentPos )) return Error ( "Link fail", IID_IFocuser );
 
@@ -158,14 +130,9 @@ STDMETHODIMP CFocuser::Stop()
 {
 	AFX_MANAGE_STATE(AfxGetStaticModuleState())
 
-	if (Port == NULL) return false;
-
-	CString St;
-	St = "FVXXXXXX";
-	CalcChecksum ( (unsigned char *) (LPCSTR) St );
+	if (Engine == NULL) return false;
 
-	Port->PurgePort();
-	Port->WritePort ( (unsigned char *) (LPCSTR) St, St.GetLength() );
+	Engine->Halt();
 	return S_OK;
 }
 
@@ -200,7 +167,8 @@ STDMETHODIMP CFocuser::put_Link(VARIANT_BOOL newVal)
 	{
 		// Reinitialize all variables
 		Port = NULL;
-		bMoving = FALSE;
+		Link = NULL;
+		Engine = NULL;
 		bTempCompMode = FALSE;
 
 		// Initialize link
@@ -219,41 +187,50 @@ STDMETHODIMP CFocuser::put_Link(VARIANT_BOOL newVal)
 			return Error ( St, IID_IFocuser );
 		}
 
+		// Hand the port to the engine; from here on only its reader thread reads it
+		Port->PurgePort();
+		Link = new RoboFocusPortLink ( Port->GetAsyncPort() );
+		Engine = new RoboFocusEngine;
+		if (Link == NULL || Engine == NULL || !Engine->Start ( Link ))
+		{
+			CloseLink();
+			return Error ( "Could not start focuser link", IID_IFocuser );
+		}
+
 		// Try to find the focuser
 		for (int I = 0; I < 10; I++)
 		{
-			Port->PurgePort();
-			unsigned char Msg[] = "FV000000x";
-			CalcChecksum ( Msg );
-			Port->WritePort ( Msg, 9 );
-			unsigned char Buf[ 10 ];
-			BOOL Ok = Port->ReadPort ( Buf, 9 );
-			if (Ok && ChecksumOk ( Buf )) 
+			if (Engine->WaitForVersion ( 150 )) 
 			{
 				bLinkEstablished = TRUE;
 				return S_OK;
 			}
 		}
-		Port->ClosePort();
-		delete Port;
-		Port = NULL;
+		CloseLink();
 		return Error ( "Focuser did not respond", IID_IFocuser );
 	}
 	else
 	{
-		if (Port != NULL) 
-		{
-			// Shutdown link
-			Port->ClosePort();
-		}
-
-		delete Port;
-		Port = NULL;
+		// Shutdown link
+		CloseLink();
 		bLinkEstablished = FALSE;
 		return S_OK;
 	}
 }
 
+void CFocuser::CloseLink()
+{
+	if (Engine != NULL) Engine->Stop();
+	delete Engine;
+	Engine = NULL;
+	delete Link;
+	Link = NULL;
+
+	if (Port != NULL) Port->ClosePort();
+	delete Port;
+	Port = NULL;
+}
+
 STDMETHODIMP CFocuser::get_Absolute(VARIANT_BOOL *pVal)
 {
 	AFX_MANAGE_STATE(AfxGetStaticModuleState())
@@ -265,67 +242,27 @@ STDMETHODIMP CFocuser::get_Absolute(VARIANT_BOOL *pVal)
 
 bool CFocuser::GetPosition(long &Position)
 {
-	static LastPosition = 0;
-
-	if (Port == NULL) return false;
+	if (Engine == NULL) return false;
 
-	if (bMoving && !bTempCompMode)
+	// Kept current by the engine's idle poll and by the FD frame that ends
+	// every move; while moving this is the position the move started from
+	RoboFocusSnapshot Snap;
+	Engine->GetSnapshot ( Snap );
+	if (Snap.PositionValid || Snap.Moving || bTempCompMode)
 	{
-		VARIANT_BOOL Dummy;
-		get_IsMoving(&Dummy);
-	}
-	if (bMoving || bTempCompMode)
-	{
-		Position = LastPosition;
+		Position = Snap.Position;
 		return true;
 	}
 
-	// Try three times
-	for (int I = 0; I < 3; I++)
-	{
-		Port->PurgePort();
-		unsigned char Msg[] = "FG000000x";
-		CalcChecksum ( Msg );
-		Port->WritePort ( Msg, 9 );
-		unsigned char Buf[ 10 ];
-		BOOL Ok = Port->ReadPort ( Buf, 9 );
-		if (Ok && ChecksumOk ( Buf )) 
-		{
-			if (Buf[0] != 'F') continue;
-			if (Buf[1] != 'D') continue;
-			Buf[8] = 0;
-			char *Ptr = (char *) &Buf[2];
-			Position = atoi ( Ptr );
-			LastPosition = Position;
-			return true;
-		}
-	}
-
-	return false;
+	// Nothing heard yet
+	return Engine->WaitForPosition ( Position, RoboFocusMotionTimeout );
 }
 
 bool CFocuser::SetPosition(long Delta)
 {
-	if (Port == NULL) return false;
-
-	CString St;
-	if (Delta >= 0)
-	{
-		St.Format ( "FO%06ix", Delta );
-	}
-	else
-	{
-		St.Format ( "FI%06ix", -Delta );
-	}
-
-	CalcChecksum ( (unsigned char *) (LPCSTR) St );
+	if (Engine == NULL) return false;
 
-	Port->PurgePort();
-	Port->WritePort ( (unsigned char *) (LPCSTR) St, St.GetLength() );
-
-	bMoving = TRUE;
-	Timeout = clock() + 1 * CLOCKS_PER_SEC;
-	return true;
+	return Engine->Move ( Delta );
 }
 
 
@@ -358,8 +295,14 @@ STDMETHODIMP CFocuser::get_Temperature(float *pVal)
 {
 	AFX_MANAGE_STATE(AfxGetStaticModuleState())
 
-	// Not available with this focuser
+	// Polled by the engine when idle; 100 until the focuser has reported one
 	*pVal = 100.0f;
+	if (Engine != NULL)
+	{
+		RoboFocusSnapshot Snap;
+		Engine->GetSnapshot ( Snap );
+		if (Snap.TemperatureValid) *pVal = float ( Snap.Temperature );
+	}
 	return S_OK;
 }
 
@@ -372,39 +315,12 @@ STDMETHODIMP CFocuser::get_MaxIncrement(long *pVal)
 	return S_OK;
 }
 
-// Length of string must be 9 minimum
-void CFocuser::CalcChecksum(unsigned char *Msg)
-{
-	unsigned char Sum = 0;
-	for (int I = 0; I < 8; I++)
-	{
-		Sum += Msg[ I ];
-	}
-	Msg[ I ] = Sum;
-}
-
-// Length of string must be 9 minimum
-bool CFocuser::ChecksumOk(unsigned char *Msg)
-{
-	unsigned char Sum = 0;
-	for (int I = 0; I < 8; I++)
-	{
-		Sum += Msg[ I ];
-	}
-	return Msg[ I ] == Sum;
-}
-
 STDMETHODIMP CFocuser::Halt()
 {
 	AFX_MANAGE_STATE(AfxGetStaticModuleState())
 
-	if (Port == NULL) return false;
-
-	CString St;
-	St = "FVXXXXXX";
-	CalcChecksum ( (unsigned char *) (LPCSTR) St );
+	if (Engine == NULL) return false;
 
-	Port->PurgePort();
-	Port->WritePort ( (unsigned char *) (LPCSTR) St, St.GetLength() );
+	Engine->Halt();
 	return S_OK;
 }
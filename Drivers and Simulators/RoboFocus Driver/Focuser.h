@@ -6,6 +6,8 @@
 #include "resource.h"       // main symbols
 
 class ComPort;
+class RoboFocusEngine;
+class RoboFocusTransport;
 
 /////////////////////////////////////////////////////////////////////////////
 // CFocuser
@@ -20,7 +22,8 @@ public:
 	{
 		bLinkEstablished = FALSE;
 		Port = NULL;
-		bMoving = FALSE;
+		Link = NULL;
+		Engine = NULL;
 		bTempCompMode = FALSE;
 	}
 	~CFocuser()
@@ -42,14 +45,13 @@ END_COM_MAP()
 	STDMETHOD(InterfaceSupportsErrorInfo)(REFIID riid);
 
 protected:
-	bool ChecksumOk ( unsigned char *Msg );
-	void CalcChecksum ( unsigned char * Msg );
 	bool SetPosition ( long Delta );
 	bool GetPosition ( long &Position );
+	void CloseLink();
 	BOOL bLinkEstablished;
-	BOOL bMoving;
-	int Timeout;
 	ComPort *Port;
+	RoboFocusTransport *Link;		// Port as seen by the engine
+	RoboFocusEngine *Engine;		// Owns the port while the link is up
 	BOOL bTempCompMode;
 
 // IFocuser
@@ -110,6 +110,11 @@ SOURCE="$(InputPath)"
 # PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
 # Begin Source File
 
+SOURCE=.\AsyncComPort.cpp
+# SUBTRACT CPP /YX /Yc /Yu
+# End Source File
+# Begin Source File
+
 SOURCE=.\ComPort.cpp
 # End Source File
 # Begin Source File
@@ -135,6 +140,11 @@ SOURCE=.\RoboFocus.rc
 # End Source File
 # Begin Source File
 
+SOURCE=.\RoboFocusEngine.cpp
+# SUBTRACT CPP /YX /Yc /Yu
+# End Source File
+# Begin Source File
+
 SOURCE=.\Setup.cpp
 # End Source File
 # Begin Source File
@@ -148,6 +158,10 @@ SOURCE=.\StdAfx.cpp
 # PROP Default_Filter "h;hpp;hxx;hm;inl"
 # Begin Source File
 
+SOURCE=.\AsyncComPort.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Focuser.h
 # End Source File
 # Begin Source File
@@ -156,6 +170,10 @@ SOURCE=.\Resource.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\RoboFocusEngine.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Setup.h
 # End Source File
 # Begin Source File
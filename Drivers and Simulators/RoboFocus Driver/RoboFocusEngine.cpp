@@ -0,0 +1,744 @@
+//---------------------------------------------------------------------
+//
+// Purpose:   RoboFocus protocol engine
+//
+// The focuser speaks in 9 byte frames: 'F', a command letter, six
+// ASCII digits and an 8 bit checksum of the first eight bytes. While
+// moving it also sends single 'I' or 'O' characters, and ends a move
+// with an FD (position) frame. Any byte sent to it while it is moving
+// halts the move, so nothing but a halt is ever written during motion.
+//
+// The reader thread owns the receive side of the port. Bytes are parsed
+// as they arrive, with resynchronisation on a bad checksum, and the
+// results are published to a snapshot guarded by a lock that is only
+// ever held for a copy. Writers take a separate lock so frames never
+// interleave; a query is only written after checking, under that lock,
+// that no move has started.
+//
+// Edits:
+//
+// When      Who     What
+// --------- ---     --------------------------------------------------
+// 17-Oct-26 asc     Initial edit
+// 17-Oct-26 asc     Serial transport moved to AsyncComPort
+// 18-Oct-26 asc     No poll after a move frame; every waiter is woken
+// 18-Oct-26 asc     SendQuery waits and claims the link in one locked section
+//
+
+#include "RoboFocusEngine.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Constructor
+//	Purpose:	Creates object
+//
+//-------------------------------------------------------------------------------
+RoboFocusEngine::RoboFocusEngine()
+{
+#ifdef _WIN32
+	InitializeCriticalSection ( &StateLock );
+	InitializeCriticalSection ( &WriteLock );
+	Changed = CreateSemaphore ( NULL, 0, 0x7fffffff, NULL );
+	Waiters = 0;
+	Thread = NULL;
+#else
+	pthread_mutex_init ( &StateLock, NULL );
+	pthread_mutex_init ( &WriteLock, NULL );
+	pthread_cond_init ( &Changed, NULL );
+#endif
+	Link = NULL;
+	Running = false;
+	StopRequested = false;
+	PollInterval = RoboFocusPollInterval;
+	memset ( &State, 0, sizeof ( State ) );
+	FrameLen = 0;
+	LastReceive = LastPoll = QuerySent = 0;
+	PollCount = 0;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Destructor
+//	Purpose:	Stops the reader thread and deletes object
+//
+//-------------------------------------------------------------------------------
+RoboFocusEngine::~RoboFocusEngine()
+{
+	Stop();
+#ifdef _WIN32
+	CloseHandle ( Changed );
+	DeleteCriticalSection ( &WriteLock );
+	DeleteCriticalSection ( &StateLock );
+#else
+	pthread_cond_destroy ( &Changed );
+	pthread_mutex_destroy ( &WriteLock );
+	pthread_mutex_destroy ( &StateLock );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Start
+//	Purpose:	Resets the state and starts the reader thread on a link
+//	Notes:		The link must stay open until Stop() returns
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::Start ( RoboFocusTransport *NewLink )
+{
+	if (Running || NewLink == NULL) return false;
+
+	Link = NewLink;
+	memset ( &State, 0, sizeof ( State ) );
+	FrameLen = 0;
+	LastReceive = LastPoll = TickCount();
+	QuerySent = 0;
+	PollCount = 0;
+	StopRequested = false;
+	Running = true;
+
+#ifdef _WIN32
+	unsigned ThreadId;
+	Thread = (HANDLE) _beginthreadex ( NULL, 0, ThreadProc, this, 0, &ThreadId );
+	if (Thread != NULL) return true;
+#else
+	if (pthread_create ( &Thread, NULL, ThreadProc, this ) == 0) return true;
+#endif
+	Running = false;
+	Link = NULL;
+	return false;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Stop
+//	Purpose:	Stops the reader thread
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::Stop()
+{
+	if (!Running) return;
+
+	Lock();
+	StopRequested = true;
+	Unlock();
+#ifdef _WIN32
+	WaitForSingleObject ( Thread, INFINITE );
+	CloseHandle ( Thread );
+	Thread = NULL;
+#else
+	pthread_join ( Thread, NULL );
+#endif
+	Running = false;
+	Link = NULL;
+
+	Lock();
+	State.Moving = false;
+	Unlock();
+	Notify();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		GetSnapshot
+//	Purpose:	Copies the current state
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::GetSnapshot ( RoboFocusSnapshot &Snap )
+{
+	Lock();
+	Snap = State;
+	Unlock();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TakeLinkFailure
+//	Purpose:	Returns and clears the link failure flag
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::TakeLinkFailure()
+{
+	Lock();
+	bool Failed = State.LinkFailed;
+	State.LinkFailed = false;
+	Unlock();
+	return Failed;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		RequestVersion, RequestPosition, RequestTemperature
+//	Purpose:	Sends a query; the reply is picked up by the reader thread
+//	Notes:		Fail while the focuser is moving
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::RequestVersion()
+{
+	return SendQuery ( 'V' );
+}
+
+bool RoboFocusEngine::RequestPosition()
+{
+	return SendQuery ( 'G' );
+}
+
+bool RoboFocusEngine::RequestTemperature()
+{
+	return SendQuery ( 'T' );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WaitForPosition
+//	Purpose:	Queries the position and waits for the reply
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::WaitForPosition ( long &Position, int TimeoutMs )
+{
+	RoboFocusSnapshot Snap;
+	GetSnapshot ( Snap );
+	if (!RequestPosition()) return false;
+	if (!WaitForCount ( &RoboFocusSnapshot::PositionCount, Snap.PositionCount, TimeoutMs )) return false;
+
+	GetSnapshot ( Snap );
+	Position = Snap.Position;
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WaitForVersion
+//	Purpose:	Queries the firmware version and waits for the reply
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::WaitForVersion ( int TimeoutMs )
+{
+	RoboFocusSnapshot Snap;
+	GetSnapshot ( Snap );
+	if (!RequestVersion()) return false;
+	return WaitForCount ( &RoboFocusSnapshot::VersionCount, Snap.VersionCount, TimeoutMs );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Move
+//	Purpose:	Starts a relative move
+//	Notes:		The snapshot shows the focuser moving from the moment this
+//				returns until the reader thread sees the closing FD frame
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::Move ( long Delta )
+{
+	// An outstanding query reply would be taken for the end of the move.
+	// The wait and the start of the move share one critical section, so
+	// no poll can be chosen in between.
+	Lock();
+	if (!WaitQueryClearLocked ( RoboFocusQueryTimeout ) || State.Moving)
+	{
+		Unlock();
+		return false;
+	}
+	State.Moving = true;
+	State.LinkFailed = false;
+	LastReceive = TickCount();
+	Unlock();
+	Notify();
+
+	long Steps = Delta >= 0 ? Delta : -Delta;
+	if (Steps > 999999L) Steps = 999999L;					// six digits
+	char Msg[ 24 ];
+	sprintf ( Msg, "F%c%06ld", Delta >= 0 ? 'O' : 'I', Steps );
+	CalcChecksum ( (unsigned char *) Msg );
+	if (SendFrame ( (unsigned char *) Msg, RoboFocusFrameLength )) return true;
+
+	Lock();
+	State.Moving = false;
+	Unlock();
+	Notify();
+	return false;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Halt
+//	Purpose:	Stops a move
+//	Notes:		Any byte halts the focuser; the same 8 bytes as the original
+//				driver are sent. The move ends when the FD frame arrives.
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::Halt()
+{
+	return SendFrame ( (const unsigned char *) "FVXXXXXX", 8 );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Parse
+//	Purpose:	Feeds received bytes to the frame parser
+//	Notes:		Called by the reader thread; public so that the parser can be
+//				tested without a link
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::Parse ( const unsigned char *Buf, int Len )
+{
+	unsigned long Now = TickCount();
+
+	Lock();
+	LastReceive = Now;
+	for (int I = 0; I < Len; I++)
+	{
+		ParseByte ( Buf[ I ], Now );
+	}
+	Unlock();
+	Notify();
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		CalcChecksum
+//	Purpose:	Stores the checksum of the first 8 bytes in the 9th
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::CalcChecksum ( unsigned char *Msg )
+{
+	unsigned char Sum = 0;
+	for (int I = 0; I < RoboFocusFrameLength - 1; I++)
+	{
+		Sum += Msg[ I ];
+	}
+	Msg[ RoboFocusFrameLength - 1 ] = Sum;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ChecksumOk
+//	Purpose:	Checks the 9th byte against the checksum of the first 8
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::ChecksumOk ( const unsigned char *Msg )
+{
+	unsigned char Sum = 0;
+	for (int I = 0; I < RoboFocusFrameLength - 1; I++)
+	{
+		Sum += Msg[ I ];
+	}
+	return Msg[ RoboFocusFrameLength - 1 ] == Sum;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TickCount
+//	Purpose:	Millisecond clock; wraps, so only differences are meaningful
+//
+//-------------------------------------------------------------------------------
+unsigned long RoboFocusEngine::TickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	struct timespec Ts;
+	clock_gettime ( CLOCK_MONOTONIC, &Ts );
+	return (unsigned long) Ts.tv_sec * 1000UL + (unsigned long) ( Ts.tv_nsec / 1000000L );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SendFrame
+//	Purpose:	Writes bytes to the link, one writer at a time
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::SendFrame ( const unsigned char *Msg, int Len )
+{
+	if (!Running) return false;
+
+#ifdef _WIN32
+	EnterCriticalSection ( &WriteLock );
+	bool Ok = Link->Write ( Msg, Len );
+	LeaveCriticalSection ( &WriteLock );
+#else
+	pthread_mutex_lock ( &WriteLock );
+	bool Ok = Link->Write ( Msg, Len );
+	pthread_mutex_unlock ( &WriteLock );
+#endif
+	return Ok;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SendIdleFrame
+//	Purpose:	Writes a query unless a move has started
+//	Notes:		Move() marks the focuser moving before it takes the write
+//				lock, so testing under the write lock means a query can
+//				never follow a move frame onto the wire and halt it
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::SendIdleFrame ( const unsigned char *Msg, int Len )
+{
+	if (!Running) return false;
+
+#ifdef _WIN32
+	EnterCriticalSection ( &WriteLock );
+#else
+	pthread_mutex_lock ( &WriteLock );
+#endif
+	Lock();
+	bool Moving = State.Moving;
+	Unlock();
+	bool Ok = !Moving && Link->Write ( Msg, Len );
+#ifdef _WIN32
+	LeaveCriticalSection ( &WriteLock );
+#else
+	pthread_mutex_unlock ( &WriteLock );
+#endif
+	return Ok;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		SendQuery
+//	Purpose:	Sends a query frame with a zero argument
+//	Notes:		One query is outstanding at a time, and none while moving
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::SendQuery ( char Command )
+{
+	// The wait and the claim share one critical section, so two callers
+	// cannot both find the link clear and send overlapping queries.
+	Lock();
+	if (!WaitQueryClearLocked ( RoboFocusQueryTimeout ) || State.Moving)
+	{
+		Unlock();
+		return false;
+	}
+	QuerySent = TickCount();
+	if (QuerySent == 0) QuerySent = 1;
+	Unlock();
+
+	char Msg[ RoboFocusFrameLength + 1 ];
+	sprintf ( Msg, "F%c000000", Command );
+	CalcChecksum ( (unsigned char *) Msg );
+	if (SendIdleFrame ( (unsigned char *) Msg, RoboFocusFrameLength )) return true;
+
+	Lock();
+	QuerySent = 0;
+	Unlock();
+	return false;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WaitQueryClearLocked
+//	Purpose:	Waits until no query is outstanding
+//	Notes:		A query with no reply is abandoned by the reader thread after
+//				RoboFocusQueryTimeout. Called and returns with StateLock held.
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::WaitQueryClearLocked ( int TimeoutMs )
+{
+	unsigned long Start = TickCount();
+
+	while (QuerySent != 0)
+	{
+		long Remaining = TimeoutMs - (long) ( TickCount() - Start );
+		if (Remaining <= 0 || !Running) return false;
+		WaitNotify ( (int) Remaining );
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		ParseByte
+//	Purpose:	Advances the frame parser by one byte (StateLock held)
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::ParseByte ( unsigned char Char, unsigned long Now )
+{
+	if (FrameLen == 0)
+	{
+		if (Char == 'F')
+		{
+			Frame[ FrameLen++ ] = Char;
+		}
+		else if (Char == 'I' || Char == 'O')
+		{
+			// Motion in progress, whether commanded or from the hand box
+			State.MotionCount++;
+			State.Moving = true;
+		}
+		else
+		{
+			State.StrayBytes++;
+		}
+		return;
+	}
+
+	Frame[ FrameLen++ ] = Char;
+	if (FrameLen < RoboFocusFrameLength) return;
+
+	FrameLen = 0;
+	if (ChecksumOk ( Frame ))
+	{
+		State.FramesOk++;
+		HandleFrame ( Frame, Now );
+		return;
+	}
+
+	// Bad frame: drop its 'F' and rescan the rest, which may hold the
+	// start of the real frame
+	State.ChecksumErrors++;
+	unsigned char Rest[ RoboFocusFrameLength - 1 ];
+	memcpy ( Rest, &Frame[ 1 ], sizeof ( Rest ) );
+	for (int I = 0; I < (int) sizeof ( Rest ); I++)
+	{
+		ParseByte ( Rest[ I ], Now );
+	}
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		HandleFrame
+//	Purpose:	Applies a frame with a good checksum (StateLock held)
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::HandleFrame ( const unsigned char *Msg, unsigned long Now )
+{
+	char Digits[ 7 ];
+	memcpy ( Digits, &Msg[ 2 ], 6 );
+	Digits[ 6 ] = 0;
+
+	switch (Msg[ 1 ])
+	{
+	case 'D':
+		// Either the reply to FG or the end of a move
+		State.Position = atol ( Digits );
+		State.PositionValid = true;
+		State.PositionCount++;
+		if (QuerySent != 0 && Now - QuerySent < (unsigned long) RoboFocusQueryTimeout)
+		{
+			QuerySent = 0;
+		}
+		else
+		{
+			State.Moving = false;
+		}
+		break;
+
+	case 'T':
+		// Half degrees Kelvin
+		State.Temperature = atol ( Digits ) / 2.0 - 273.15;
+		State.TemperatureValid = true;
+		State.TemperatureCount++;
+		QuerySent = 0;
+		break;
+
+	case 'V':
+		memcpy ( State.Version, Digits, sizeof ( State.Version ) );
+		State.VersionCount++;
+		QuerySent = 0;
+		break;
+
+	default:
+		// Settings replies (FB, FC, FL, FP, ...) are not used by the driver
+		QuerySent = 0;
+		break;
+	}
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Housekeeping
+//	Purpose:	Timeouts; returns the query to send when an idle poll is due,
+//				already marked outstanding, or 0 (StateLock held)
+//	Notes:		Every RoboFocusTemperaturePolls'th poll reads the temperature
+//				instead of the position
+//
+//-------------------------------------------------------------------------------
+char RoboFocusEngine::Housekeeping ( unsigned long Now )
+{
+	bool Changes = false;
+
+	if (QuerySent != 0 && Now - QuerySent >= (unsigned long) RoboFocusQueryTimeout)
+	{
+		QuerySent = 0;
+		Changes = true;
+	}
+
+	if (State.Moving && Now - LastReceive >= (unsigned long) RoboFocusMotionTimeout)
+	{
+		State.Moving = false;
+		State.LinkFailed = true;
+		Changes = true;
+	}
+
+	if (Changes) Notify();
+
+	if (State.Moving || QuerySent != 0 || PollInterval <= 0) return 0;
+	if (Now - LastPoll < (unsigned long) PollInterval) return 0;
+	LastPoll = Now;
+	QuerySent = Now != 0 ? Now : 1;
+	return PollCount++ % RoboFocusTemperaturePolls == 0 ? 'T' : 'G';
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		WaitForCount
+//	Purpose:	Waits for a snapshot counter to move past a previous value
+//
+//-------------------------------------------------------------------------------
+bool RoboFocusEngine::WaitForCount ( unsigned long RoboFocusSnapshot::*Counter, unsigned long Last, int TimeoutMs )
+{
+	unsigned long Start = TickCount();
+
+	Lock();
+	while (State.*Counter == Last)
+	{
+		long Remaining = TimeoutMs - (long) ( TickCount() - Start );
+		if (Remaining <= 0 || !Running)
+		{
+			Unlock();
+			return false;
+		}
+		WaitNotify ( (int) Remaining );
+	}
+	Unlock();
+	return true;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Lock, Unlock, Notify, WaitNotify
+//	Purpose:	State lock and change notification
+//	Notes:		On Windows each waiter is counted under StateLock before it
+//				waits and Notify releases the semaphore once per waiter, so
+//				every waiter wakes and a change between a caller's test and
+//				its wait is not lost. A waiter that timed out leaves its count
+//				behind, which can only cause a spurious wakeup; every caller
+//				tests its condition again.
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::Lock()
+{
+#ifdef _WIN32
+	EnterCriticalSection ( &StateLock );
+#else
+	pthread_mutex_lock ( &StateLock );
+#endif
+}
+
+void RoboFocusEngine::Unlock()
+{
+#ifdef _WIN32
+	LeaveCriticalSection ( &StateLock );
+#else
+	pthread_mutex_unlock ( &StateLock );
+#endif
+}
+
+void RoboFocusEngine::Notify()
+{
+#ifdef _WIN32
+	Lock();
+	if (Waiters > 0) ReleaseSemaphore ( Changed, Waiters, NULL );
+	Waiters = 0;
+	Unlock();
+#else
+	pthread_cond_broadcast ( &Changed );
+#endif
+}
+
+void RoboFocusEngine::WaitNotify ( int TimeoutMs )
+{
+#ifdef _WIN32
+	Waiters++;
+	Unlock();
+	WaitForSingleObject ( Changed, TimeoutMs );
+	Lock();
+#else
+	struct timespec Ts;
+	clock_gettime ( CLOCK_REALTIME, &Ts );
+	Ts.tv_sec += TimeoutMs / 1000;
+	Ts.tv_nsec += ( TimeoutMs % 1000 ) * 1000000L;
+	if (Ts.tv_nsec >= 1000000000L)
+	{
+		Ts.tv_sec++;
+		Ts.tv_nsec -= 1000000000L;
+	}
+	pthread_cond_timedwait ( &Changed, &StateLock, &Ts );
+#endif
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Run
+//	Purpose:	Reader thread body
+//
+//-------------------------------------------------------------------------------
+void RoboFocusEngine::Run()
+{
+	unsigned char Buf[ 256 ];
+	bool Quit = false;
+
+	while (!Quit)
+	{
+		int NumRead = Link->Read ( Buf, sizeof ( Buf ), RoboFocusReadTimeout );
+		if (NumRead > 0)
+		{
+			Parse ( Buf, NumRead );
+		}
+		else if (NumRead < 0)
+		{
+			// Link error; the motion timeout reports it if a move is under way
+#ifdef _WIN32
+			Sleep ( RoboFocusReadTimeout );
+#else
+			usleep ( RoboFocusReadTimeout * 1000 );
+#endif
+		}
+
+		// The reader thread must never wait for a reply it would itself
+		// have to parse, so the poll bypasses SendQuery
+		Lock();
+		char Poll = Housekeeping ( TickCount() );
+		Quit = StopRequested;
+		Unlock();
+		if (Poll != 0)
+		{
+			unsigned char Msg[ RoboFocusFrameLength + 1 ] = "F?000000";
+			Msg[ 1 ] = Poll;
+			CalcChecksum ( Msg );
+			if (!SendIdleFrame ( Msg, RoboFocusFrameLength ))
+			{
+				Lock();
+				QuerySent = 0;
+				Unlock();
+			}
+		}
+	}
+}
+
+#ifdef _WIN32
+unsigned __stdcall RoboFocusEngine::ThreadProc ( void *Param )
+{
+	( (RoboFocusEngine *) Param )->Run();
+	return 0;
+}
+#else
+void *RoboFocusEngine::ThreadProc ( void *Param )
+{
+	( (RoboFocusEngine *) Param )->Run();
+	return NULL;
+}
+#endif
@@ -0,0 +1,182 @@
+// RoboFocusEngine.h : Declaration of the RoboFocus protocol engine
+//
+// The engine owns the serial link to the focuser. A reader thread parses
+// the incoming byte stream incrementally and publishes the focuser state
+// through a snapshot that any thread may copy at any time, so the COM
+// getters never touch the port themselves.
+//
+// The engine has no MFC or ATL dependencies so that it can be built and
+// tested on its own (see RoboFocusEngineTest.cpp).
+
+#ifndef __ROBOFOCUSENGINE_H_
+#define __ROBOFOCUSENGINE_H_
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "AsyncComPort.h"
+
+const int RoboFocusFrameLength = 9;				// 'F', command, 6 digits, checksum
+const int RoboFocusReadTimeout = 20;			// milliseconds per reader thread wait
+const int RoboFocusMotionTimeout = 1000;		// milliseconds without a byte before a move is declared failed
+const int RoboFocusQueryTimeout = 500;			// milliseconds to wait for the reply to a query
+const int RoboFocusPollInterval = 1000;			// milliseconds between idle polls
+const int RoboFocusTemperaturePolls = 10;		// one idle poll in this many reads the temperature
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		RoboFocusTransport
+//	Purpose:	Byte stream the engine runs over
+//	Notes:		Read waits at most TimeoutMs for at least one byte and returns
+//				the number of bytes read, 0 on timeout or -1 if the link failed.
+//				Read is only called from the reader thread; Write may be called
+//				from any thread but never concurrently (the engine serialises it).
+//
+//-------------------------------------------------------------------------------
+class RoboFocusTransport
+{
+public:
+	virtual ~RoboFocusTransport() {}
+	virtual int Read ( unsigned char *Buf, int MaxToRead, int TimeoutMs ) = 0;
+	virtual bool Write ( const unsigned char *Buf, int NumToWrite ) = 0;
+};
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		RoboFocusPortLink
+//	Purpose:	Transport over an AsyncComPort
+//	Notes:		Write only queues the frame; the port's I/O thread sends it
+//
+//-------------------------------------------------------------------------------
+class RoboFocusPortLink : public RoboFocusTransport
+{
+public:
+	RoboFocusPortLink ( AsyncComPort *NewPort ) { Port = NewPort; }
+	int Read ( unsigned char *Buf, int MaxToRead, int TimeoutMs )
+	{
+		return Port->ReadAvailable ( Buf, MaxToRead, TimeoutMs );
+	}
+	bool Write ( const unsigned char *Buf, int NumToWrite )
+	{
+		return Port->Write ( Buf, NumToWrite );
+	}
+
+protected:
+	AsyncComPort *Port;
+};
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		RoboFocusSnapshot
+//	Purpose:	Focuser state as last reported by the device
+//	Notes:		The counters only ever increase; a caller waiting for fresh data
+//				compares them against an earlier snapshot.
+//
+//-------------------------------------------------------------------------------
+struct RoboFocusSnapshot
+{
+	long Position;				// last reported position (steps)
+	bool PositionValid;
+	bool Moving;				// a move has been commanded and not yet reported complete
+	double Temperature;			// degrees Celsius
+	bool TemperatureValid;
+	char Version[ 7 ];			// firmware version digits from the FV reply
+	bool LinkFailed;			// the focuser stopped answering during a move
+
+	unsigned long PositionCount;	// FD frames received
+	unsigned long TemperatureCount;	// FT frames received
+	unsigned long VersionCount;		// FV frames received
+	unsigned long MotionCount;		// 'I' and 'O' motion characters received
+	unsigned long FramesOk;			// frames with a good checksum
+	unsigned long ChecksumErrors;	// frames discarded for a bad checksum
+	unsigned long StrayBytes;		// bytes outside any frame that were not motion characters
+};
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		RoboFocusEngine
+//	Purpose:	Protocol engine and reader thread
+//
+//-------------------------------------------------------------------------------
+class RoboFocusEngine
+{
+// Construction
+public:
+	RoboFocusEngine();
+	~RoboFocusEngine();
+
+// Implementation
+public:
+	bool Start ( RoboFocusTransport *NewLink );
+	void Stop();
+	bool IsRunning() const { return Running; }
+
+	void GetSnapshot ( RoboFocusSnapshot &Snap );
+	bool TakeLinkFailure();
+
+	bool RequestVersion();
+	bool RequestPosition();
+	bool RequestTemperature();
+	bool WaitForPosition ( long &Position, int TimeoutMs );
+	bool WaitForVersion ( int TimeoutMs );
+	bool Move ( long Delta );
+	bool Halt();
+
+	void SetPollInterval ( int Milliseconds ) { PollInterval = Milliseconds; }
+
+	void Parse ( const unsigned char *Buf, int Len );
+
+	static void CalcChecksum ( unsigned char *Msg );
+	static bool ChecksumOk ( const unsigned char *Msg );
+	static unsigned long TickCount();
+
+protected:
+	bool SendFrame ( const unsigned char *Msg, int Len );
+	bool SendIdleFrame ( const unsigned char *Msg, int Len );
+	bool SendQuery ( char Command );
+	bool WaitQueryClearLocked ( int TimeoutMs );	// called and returns with StateLock held
+	void ParseByte ( unsigned char Char, unsigned long Now );
+	void HandleFrame ( const unsigned char *Msg, unsigned long Now );
+	char Housekeeping ( unsigned long Now );
+	bool WaitForCount ( unsigned long RoboFocusSnapshot::*Counter, unsigned long Last, int TimeoutMs );
+	void Lock();
+	void Unlock();
+	void Notify();
+	void WaitNotify ( int TimeoutMs );		// called and returns with StateLock held
+	void Run();
+
+#ifdef _WIN32
+	static unsigned __stdcall ThreadProc ( void *Param );
+	CRITICAL_SECTION StateLock;
+	CRITICAL_SECTION WriteLock;
+	HANDLE Changed;				// semaphore, released once per waiter on every state change
+	long Waiters;				// threads in WaitNotify, guarded by StateLock
+	HANDLE Thread;
+#else
+	static void *ThreadProc ( void *Param );
+	pthread_mutex_t StateLock;
+	pthread_mutex_t WriteLock;
+	pthread_cond_t Changed;
+	pthread_t Thread;
+#endif
+
+	RoboFocusTransport *Link;
+	volatile bool Running;
+	bool StopRequested;			// guarded by StateLock
+	int PollInterval;
+
+	RoboFocusSnapshot State;	// guarded by StateLock
+
+	// Guarded by StateLock
+	unsigned char Frame[ RoboFocusFrameLength ];	// frame being assembled
+	int FrameLen;
+	unsigned long LastReceive;	// tick of the last byte received
+	unsigned long LastPoll;		// tick of the last idle poll
+	unsigned long QuerySent;	// tick the outstanding query was sent, 0 if none
+	unsigned long PollCount;	// idle polls sent
+};
+
+#endif //__ROBOFOCUSENGINE_H_
@@ -0,0 +1,586 @@
+//---------------------------------------------------------------------
+//
+// Purpose:   Test program for the RoboFocus protocol engine
+//
+// Runs the asynchronous port and the engine against a simulated focuser
+// on the other side of a pseudo-terminal. Not part of the driver build;
+// on Linux:
+//
+//    g++ -o RoboFocusEngineTest AsyncComPort.cpp RoboFocusEngine.cpp RoboFocusEngineTest.cpp -lpthread
+//    ./RoboFocusEngineTest
+//
+// Edits:
+//
+// When      Who     What
+// --------- ---     --------------------------------------------------
+// 17-Oct-26 asc     Initial edit
+// 17-Oct-26 asc     Add AsyncComPort tests; link runs over AsyncComPort
+// 18-Oct-26 asc     Moves racing idle polls
+// 18-Oct-26 asc     Concurrent queries never overlap
+//
+
+#include "RoboFocusEngine.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int Failures = 0;
+
+static void Check ( bool Ok, const char *What )
+{
+	printf ( "%s  %s\n", Ok ? "PASS" : "FAIL", What );
+	if (!Ok) Failures++;
+}
+
+static void MakeFrame ( unsigned char *Msg, char Command, long Value )
+{
+	char Text[ 24 ];
+	sprintf ( Text, "F%c%06ld", Command, Value );
+	memcpy ( Msg, Text, 8 );
+	RoboFocusEngine::CalcChecksum ( Msg );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Simulator
+//	Purpose:	RoboFocus on the master side of a pseudo-terminal
+//
+//-------------------------------------------------------------------------------
+class Simulator
+{
+public:
+	int Master;
+	volatile bool Quit;
+	volatile bool Silent;			// stop answering altogether
+	volatile bool Corrupt;			// send a bad frame before the next reply
+	volatile long Position;
+	volatile unsigned long DoneTick;	// when the last move ended
+	volatile int ReplyDelay;		// milliseconds before a query is answered
+	volatile int Overlaps;			// queries received while one was unanswered
+	bool Pending;
+	char PendingCommand;
+	long PendingValue;
+	unsigned long PendingDue;
+	long Target;
+	bool Moving;
+	unsigned char Cmd[ RoboFocusFrameLength ];
+	int CmdLen;
+	pthread_t Thread;
+
+	Simulator ( int NewMaster )
+	{
+		Master = NewMaster;
+		Quit = Silent = Corrupt = false;
+		Position = 1000;
+		DoneTick = 0;
+		ReplyDelay = Overlaps = 0;
+		Pending = false;
+		Moving = false;
+		CmdLen = 0;
+		pthread_create ( &Thread, NULL, ThreadProc, this );
+	}
+
+	~Simulator()
+	{
+		Quit = true;
+		pthread_join ( Thread, NULL );
+	}
+
+	void Send ( const unsigned char *Buf, int Len )
+	{
+		if (Silent) return;
+		if (write ( Master, Buf, Len ) != Len) perror ( "simulator write" );
+	}
+
+	void Reply ( char Command, long Value )
+	{
+		unsigned char Msg[ RoboFocusFrameLength ];
+		if (Corrupt)
+		{
+			MakeFrame ( Msg, 'D', 999 );
+			Msg[ 8 ]++;
+			Send ( Msg, RoboFocusFrameLength );
+			Corrupt = false;
+		}
+		MakeFrame ( Msg, Command, Value );
+		Send ( Msg, RoboFocusFrameLength );
+	}
+
+	void Answer ( char Command, long Value )
+	{
+		if (Pending) Overlaps++;
+		if (ReplyDelay <= 0)
+		{
+			Reply ( Command, Value );
+			return;
+		}
+		Pending = true;
+		PendingCommand = Command;
+		PendingValue = Value;
+		PendingDue = RoboFocusEngine::TickCount() + ReplyDelay;
+	}
+
+	void EndMove()
+	{
+		Moving = false;
+		Reply ( 'D', Position );
+		DoneTick = RoboFocusEngine::TickCount();
+	}
+
+	void Command()
+	{
+		if (!RoboFocusEngine::ChecksumOk ( Cmd )) return;
+		char Digits[ 7 ];
+		memcpy ( Digits, &Cmd[ 2 ], 6 );
+		Digits[ 6 ] = 0;
+		switch (Cmd[ 1 ])
+		{
+		case 'G': Answer ( 'D', Position ); break;
+		case 'V': Answer ( 'V', 2013 ); break;
+		case 'T': Answer ( 'T', 596 ); break;
+		case 'I': Target = Position - atol ( Digits ); Moving = true; break;
+		case 'O': Target = Position + atol ( Digits ); Moving = true; break;
+		}
+	}
+
+	void Run()
+	{
+		while (!Quit)
+		{
+			struct pollfd Pfd;
+			Pfd.fd = Master;
+			Pfd.events = POLLIN;
+			Pfd.revents = 0;
+			if (poll ( &Pfd, 1, 5 ) > 0 && (Pfd.revents & POLLIN))
+			{
+				unsigned char Buf[ 64 ];
+				int NumRead = (int) read ( Master, Buf, sizeof ( Buf ) );
+				for (int I = 0; I < NumRead; I++)
+				{
+					if (Moving)
+					{
+						// Any byte halts a move
+						EndMove();
+						CmdLen = 0;
+						break;
+					}
+					if (CmdLen == 0 && Buf[ I ] != 'F') continue;
+					Cmd[ CmdLen++ ] = Buf[ I ];
+					if (CmdLen == RoboFocusFrameLength)
+					{
+						Command();
+						CmdLen = 0;
+					}
+				}
+			}
+
+			if (Pending && (long) ( RoboFocusEngine::TickCount() - PendingDue ) >= 0)
+			{
+				Pending = false;
+				Reply ( PendingCommand, PendingValue );
+			}
+
+			// 50 steps per 5 ms tick, one motion character per tick
+			if (Moving && !Silent)
+			{
+				long Step = Target > Position ? 50 : -50;
+				if (labs ( Target - Position ) <= 50)
+				{
+					Position = Target;
+					EndMove();
+				}
+				else
+				{
+					Position += Step;
+					unsigned char Char = Step > 0 ? 'O' : 'I';
+					Send ( &Char, 1 );
+				}
+			}
+		}
+	}
+
+	static void *ThreadProc ( void *Param )
+	{
+		( (Simulator *) Param )->Run();
+		return NULL;
+	}
+};
+
+static bool WaitStopped ( RoboFocusEngine &Engine, int TimeoutMs, unsigned long &SeenTick )
+{
+	unsigned long Start = RoboFocusEngine::TickCount();
+	RoboFocusSnapshot Snap;
+	do
+	{
+		Engine.GetSnapshot ( Snap );
+		if (!Snap.Moving)
+		{
+			SeenTick = RoboFocusEngine::TickCount();
+			return true;
+		}
+		usleep ( 200 );
+	} while (RoboFocusEngine::TickCount() - Start < (unsigned long) TimeoutMs);
+	return false;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		Requester
+//	Purpose:	Thread asking for position and temperature in turn
+//
+//-------------------------------------------------------------------------------
+static void *Requester ( void *Param )
+{
+	RoboFocusEngine *Engine = (RoboFocusEngine *) Param;
+	for (int I = 0; I < 5; I++)
+	{
+		if (I % 2) Engine->RequestTemperature();
+		else Engine->RequestPosition();
+	}
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TestPort
+//	Purpose:	AsyncComPort against the bare master side of a pseudo-terminal
+//
+//-------------------------------------------------------------------------------
+struct CallbackCounts
+{
+	pthread_mutex_t Mutex;	// the callbacks run on the I/O thread
+	int Received;			// bytes taken by the receive callback
+	int Written;			// bytes reported by the write callback
+	int Completions;
+};
+
+static bool TakeAll ( void *Context, const unsigned char *, int Len )
+{
+	CallbackCounts *Counts = (CallbackCounts *) Context;
+	pthread_mutex_lock ( &Counts->Mutex );
+	Counts->Received += Len;
+	pthread_mutex_unlock ( &Counts->Mutex );
+	return true;
+}
+
+static void CountWrites ( void *Context, int NumWritten, bool Ok )
+{
+	CallbackCounts *Counts = (CallbackCounts *) Context;
+	pthread_mutex_lock ( &Counts->Mutex );
+	if (Ok) Counts->Written += NumWritten;
+	Counts->Completions++;
+	pthread_mutex_unlock ( &Counts->Mutex );
+}
+
+static void GetCounts ( CallbackCounts &Counts, int &Received, int &Written, int &Completions )
+{
+	pthread_mutex_lock ( &Counts.Mutex );
+	Received = Counts.Received;
+	Written = Counts.Written;
+	Completions = Counts.Completions;
+	pthread_mutex_unlock ( &Counts.Mutex );
+}
+
+static int DrainMaster ( int Master, unsigned char *Buf, int Max, int TimeoutMs )
+{
+	int Len = 0;
+	struct pollfd Pfd;
+	Pfd.fd = Master;
+	Pfd.events = POLLIN;
+	while (Len < Max)
+	{
+		Pfd.revents = 0;
+		if (poll ( &Pfd, 1, TimeoutMs ) <= 0) break;
+		int NumRead = (int) read ( Master, &Buf[ Len ], Max - Len );
+		if (NumRead <= 0) break;
+		Len += NumRead;
+	}
+	return Len;
+}
+
+static void TestPort()
+{
+	int Master = posix_openpt ( O_RDWR | O_NOCTTY );
+	if (Master < 0 || grantpt ( Master ) != 0 || unlockpt ( Master ) != 0)
+	{
+		Check ( false, "port: pseudo-terminal created" );
+		return;
+	}
+
+	AsyncComPort Port;
+	AsyncComPortStats Stats;
+	CallbackCounts Counts;
+	unsigned char Buf[ 8192 ];
+	unsigned long Start, Elapsed;
+	int I, Num, Received, Written, Completions;
+
+	Check ( Port.Open ( ptsname ( Master ), 9600 ), "port: opened" );
+
+	// Data is in the ring as soon as it lands
+	const char *Hello = "hello";
+	Start = AsyncComPort::TickCount();
+	if (write ( Master, Hello, 5 ) != 5) perror ( "master write" );
+	Num = Port.ReadAvailable ( Buf, sizeof ( Buf ), 1000 );
+	Elapsed = AsyncComPort::TickCount() - Start;
+	Check ( Num == 5 && memcmp ( Buf, Hello, 5 ) == 0, "port: bytes received" );
+	printf ( "      receive latency %lu ms\n", Elapsed );
+	Check ( Elapsed < 20, "port: receive latency" );
+
+	// Inter-byte timeout ends a short read well before the total timeout
+	Port.SetReadTimeouts ( 30, 0, 2000 );
+	if (write ( Master, "abc", 3 ) != 3) perror ( "master write" );
+	Start = AsyncComPort::TickCount();
+	Num = Port.Read ( Buf, 10 );
+	Elapsed = AsyncComPort::TickCount() - Start;
+	Check ( Num == 3 && Elapsed < 500, "port: inter-byte timeout" );
+
+	// Total timeout with nothing arriving
+	Port.SetReadTimeouts ( 0, 10, 50 );
+	Start = AsyncComPort::TickCount();
+	Num = Port.Read ( Buf, 4 );
+	Elapsed = AsyncComPort::TickCount() - Start;
+	Check ( Num == 0 && Elapsed >= 85 && Elapsed < 300, "port: total timeout" );
+
+	// Small writes inside the coalescing window go out as one device write
+	memset ( &Counts, 0, sizeof ( Counts ) );
+	pthread_mutex_init ( &Counts.Mutex, NULL );
+	Port.SetWriteCallback ( CountWrites, &Counts );
+	Port.SetCoalesceDelay ( 20 );
+	for (I = 0; I < 100; I++)
+	{
+		unsigned char Byte = (unsigned char) ( 'A' + I % 26 );
+		Port.Write ( &Byte, 1 );
+	}
+	Check ( Port.Flush ( 1000 ), "port: flushed" );
+	Num = DrainMaster ( Master, Buf, 100, 200 );
+	Port.GetStats ( Stats );
+	Check ( Num == 100 && Buf[ 0 ] == 'A' && Buf[ 99 ] == 'A' + 99 % 26, "port: coalesced bytes in order" );
+	printf ( "      %lu write requests, %lu device writes\n", Stats.WriteRequests, Stats.DeviceWrites );
+	Check ( Stats.DeviceWrites <= 2 && Stats.WriteRequests == 100, "port: writes coalesced" );
+	GetCounts ( Counts, Received, Written, Completions );
+	Check ( Written == 100 && Completions == (int) Stats.DeviceWrites, "port: write callback" );
+	Port.SetCoalesceDelay ( 0 );
+	Port.SetWriteCallback ( NULL, NULL );
+
+	// A receive callback that consumes everything bypasses the ring
+	Port.SetReceiveCallback ( TakeAll, &Counts );
+	if (write ( Master, "xyz", 3 ) != 3) perror ( "master write" );
+	usleep ( 50000 );
+	GetCounts ( Counts, Received, Written, Completions );
+	Check ( Received == 3 && Port.Available() == 0, "port: receive callback" );
+	Port.SetReceiveCallback ( NULL, NULL );
+
+	// A full ring keeps the newest bytes
+	for (I = 0; I < (int) sizeof ( Buf ); I++) Buf[ I ] = (unsigned char) I;
+	Port.GetStats ( Stats );
+	unsigned long Before = Stats.BytesRead;
+	if (write ( Master, Buf, 6000 ) != 6000) perror ( "master write" );
+	Start = AsyncComPort::TickCount();
+	do
+	{
+		usleep ( 10000 );
+		Port.GetStats ( Stats );
+	} while (Stats.BytesRead < Before + 6000 && AsyncComPort::TickCount() - Start < 2000);
+	Check ( Port.Available() == AsyncComPortRingSize && Stats.Overruns == 6000 - AsyncComPortRingSize, "port: overrun" );
+	Num = Port.ReadAvailable ( Buf, 1, 0 );
+	Check ( Num == 1 && Buf[ 0 ] == (unsigned char) ( 6000 - AsyncComPortRingSize ), "port: oldest bytes dropped" );
+	Port.Purge ( false, true );
+	Check ( Port.Available() == 0, "port: purged" );
+
+	// Hangup
+	close ( Master );
+	Check ( Port.ReadAvailable ( Buf, 1, 1000 ) == -1, "port: hangup reported" );
+	Check ( !Port.Write ( Buf, 1 ), "port: write refused after hangup" );
+	Port.Close();
+	pthread_mutex_destroy ( &Counts.Mutex );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TestParser
+//	Purpose:	Frame parsing without a link
+//
+//-------------------------------------------------------------------------------
+static void TestParser()
+{
+	RoboFocusEngine Engine;
+	RoboFocusSnapshot Snap;
+	unsigned char Stream[ 64 ];
+	int Len = 0;
+
+	// Motion characters, a stray byte, a corrupted frame whose body holds
+	// the start of a good one, then a temperature frame
+	Stream[ Len++ ] = 'O';
+	Stream[ Len++ ] = 'O';
+	Stream[ Len++ ] = '?';
+	Stream[ Len++ ] = 'F';
+	Stream[ Len++ ] = 'D';
+	Stream[ Len++ ] = '0';
+	MakeFrame ( &Stream[ Len ], 'D', 1234 );
+	Len += RoboFocusFrameLength;
+	MakeFrame ( &Stream[ Len ], 'T', 596 );
+	Len += RoboFocusFrameLength;
+
+	// One byte at a time, as a slow link would deliver them
+	for (int I = 0; I < Len; I++)
+	{
+		Engine.Parse ( &Stream[ I ], 1 );
+		if (I == 1)
+		{
+			Engine.GetSnapshot ( Snap );
+			Check ( Snap.Moving && Snap.MotionCount == 2, "parser: motion characters mark the focuser moving" );
+		}
+	}
+
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.PositionValid && Snap.Position == 1234, "parser: position recovered after a bad frame" );
+	Check ( Snap.ChecksumErrors == 1, "parser: one checksum error counted" );
+	Check ( !Snap.Moving, "parser: FD frame ends the move" );
+	Check ( Snap.TemperatureValid && Snap.Temperature > 24.84 && Snap.Temperature < 24.86, "parser: temperature decoded" );
+	Check ( Snap.StrayBytes >= 1, "parser: stray bytes counted" );
+}
+
+//-------------------------------------------------------------------------------
+//
+//	Name:		TestLink
+//	Purpose:	Engine against the simulator
+//
+//-------------------------------------------------------------------------------
+static void TestLink()
+{
+	int Master = posix_openpt ( O_RDWR | O_NOCTTY );
+	if (Master < 0 || grantpt ( Master ) != 0 || unlockpt ( Master ) != 0)
+	{
+		Check ( false, "link: pseudo-terminal created" );
+		return;
+	}
+
+	AsyncComPort Port;
+	Check ( Port.Open ( ptsname ( Master ), 9600 ), "link: slave side opened" );
+	RoboFocusPortLink Link ( &Port );
+
+	Simulator *Simulated = new Simulator ( Master );
+	Simulator &Sim = *Simulated;
+	RoboFocusEngine Engine;
+	RoboFocusSnapshot Snap;
+	unsigned long Seen, Start;
+	long Position;
+	int I;
+
+	Engine.SetPollInterval ( 100 );
+	Check ( Engine.Start ( &Link ), "link: engine started" );
+
+	Check ( Engine.WaitForVersion ( 1000 ), "link: version reply" );
+	Engine.GetSnapshot ( Snap );
+	Check ( strcmp ( Snap.Version, "002013" ) == 0, "link: version digits" );
+
+	Check ( Engine.WaitForPosition ( Position, 1000 ) && Position == 1000, "link: position query" );
+
+	// The getters only copy the snapshot
+	Start = RoboFocusEngine::TickCount();
+	for (I = 0; I < 1000000; I++)
+	{
+		Engine.GetSnapshot ( Snap );
+	}
+	printf ( "      snapshot read: %.1f ns\n", ( RoboFocusEngine::TickCount() - Start ) * 1.0e6 / 1000000.0 );
+
+	// Idle polling keeps position and temperature fresh without any
+	// caller asking
+	Engine.GetSnapshot ( Snap );
+	unsigned long Count = Snap.PositionCount + Snap.TemperatureCount;
+	usleep ( 350000 );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.PositionCount + Snap.TemperatureCount >= Count + 2, "link: idle polling" );
+	Check ( Snap.TemperatureValid, "link: temperature polled" );
+
+	// A move is visible at once and its end within milliseconds
+	Check ( Engine.Move ( 500 ), "link: move started" );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.Moving, "link: moving immediately after Move" );
+	Check ( WaitStopped ( Engine, 3000, Seen ), "link: move completed" );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.Position == 1500 && Sim.Position == 1500, "link: final position" );
+	printf ( "      end of move seen after %lu ms\n", Seen - Sim.DoneTick );
+	Check ( Seen - Sim.DoneTick < 50, "link: end of move latency" );
+	Check ( Snap.MotionCount > 0, "link: motion characters received" );
+
+	// Halt part way
+	Check ( Engine.Move ( -1000 ), "link: second move started" );
+	usleep ( 30000 );
+	Check ( Engine.Halt(), "link: halt sent" );
+	Check ( WaitStopped ( Engine, 1000, Seen ), "link: halted" );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.Position < 1500 && Snap.Position > 500 && Snap.Position == Sim.Position, "link: halted part way" );
+
+	// Corrupted frame ahead of a reply
+	unsigned long Errors = Snap.ChecksumErrors;
+	Sim.Corrupt = true;
+	Check ( Engine.WaitForPosition ( Position, 1000 ) && Position == Sim.Position, "link: position after corrupted frame" );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.ChecksumErrors == Errors + 1, "link: corrupted frame counted" );
+
+	// Temperature
+	Check ( Engine.RequestTemperature(), "link: temperature requested" );
+	usleep ( 100000 );
+	Engine.GetSnapshot ( Snap );
+	Check ( Snap.TemperatureValid && Snap.Temperature > 24.84 && Snap.Temperature < 24.86, "link: temperature" );
+
+	// No queries while moving: they would halt the focuser
+	Check ( Engine.Move ( 200 ), "link: third move started" );
+	Check ( !Engine.RequestPosition(), "link: query refused while moving" );
+	WaitStopped ( Engine, 3000, Seen );
+
+	// Moves started while idle polls are being chosen are never halted
+	// by a poll written after the move frame
+	Engine.SetPollInterval ( 1 );
+	bool AllReached = true;
+	for (I = 0; I < 40; I++)
+	{
+		long Target = Sim.Position + ( I % 2 ? -200 : 200 );
+		usleep ( ( I * 37 ) % 1500 );
+		if (!Engine.Move ( I % 2 ? -200 : 200 ) || !WaitStopped ( Engine, 3000, Seen ) || Sim.Position != Target)
+		{
+			AllReached = false;
+		}
+	}
+	Check ( AllReached, "link: moves amid idle polls reach their targets" );
+	Engine.SetPollInterval ( 100 );
+
+	// Callers on several threads, with slow replies, still have one query
+	// on the wire at a time
+	pthread_t Requesters[ 4 ];
+	Sim.ReplyDelay = 10;
+	for (I = 0; I < 4; I++) pthread_create ( &Requesters[ I ], NULL, Requester, &Engine );
+	for (I = 0; I < 4; I++) pthread_join ( Requesters[ I ], NULL );
+	usleep ( 50000 );
+	Sim.ReplyDelay = 0;
+	printf ( "      %d overlapping queries\n", (int) Sim.Overlaps );
+	Check ( Sim.Overlaps == 0, "link: concurrent queries never overlap" );
+
+	// Focuser goes quiet during a move
+	Sim.Silent = true;
+	Check ( Engine.Move ( 300 ), "link: fourth move started" );
+	Check ( WaitStopped ( Engine, 3000, Seen ), "link: silent move times out" );
+	Check ( Engine.TakeLinkFailure(), "link: failure reported" );
+	Check ( !Engine.TakeLinkFailure(), "link: failure reported once" );
+
+	Engine.Stop();
+	Port.Close();
+	delete Simulated;
+	close ( Master );
+}
+
+int main()
+{
+	TestPort();
+	TestParser();
+	TestLink();
+
+	printf ( Failures ? "\n%d check(s) FAILED\n" : "\nAll checks passed\n", Failures );
+	return Failures != 0;
+}
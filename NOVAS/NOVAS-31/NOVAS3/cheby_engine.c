@@ -0,0 +1,880 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  cheby_engine.c: Piecewise Chebyshev engine shared by the JPL ephemeris
+                  manager, the USNO/AE98 minor planet reader and the CIO
+                  table
+
+  The three readers in the DLL each kept their own globals, their own
+  file positioning and their own polynomial evaluation.  This file
+  gives them one set of parts:
+
+     cheby_store     read-only file image, memory mapped where possible
+     cheby_index     uniform or tabulated time segments, with an O(1)
+                     lookup for uniform files and a hinted binary search
+                     otherwise
+     cheby_eval      evaluation of value and derivative for several
+                     components sharing one time (SSE2 where available)
+     cheby_handle    store plus index; read-only once opened, so it may
+                     be shared between threads
+*/
+
+#ifndef _CHEBYENGINE_
+   #include "cheby_engine.h"
+#endif
+
+#ifndef _EPHMAN_
+   #include "eph_manager.h"
+#endif
+
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <unistd.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+#endif
+
+#ifdef CHEBY_SSE2
+   #include <emmintrin.h>
+#endif
+
+/********cheby_store_open */
+
+short int cheby_store_open (char *name,
+
+                            cheby_store *store)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Opens a file as a read-only image in memory.  The file is mapped
+      into the address space where the operating system allows;
+      otherwise it is read into allocated memory.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the file.
+
+   OUTPUT
+   ARGUMENTS:
+      *store (struct cheby_store)
+         The file image.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... File not found or cannot be opened.
+         2 ... Error reading the file.
+         3 ... Unable to allocate memory.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      CreateFileA, GetFileSize, CreateFileMappingA, MapViewOfFile,
+      CloseHandle                     windows.h  (Windows)
+      open, fstat, mmap, close        unistd.h   (elsewhere)
+      fopen_s, fseek, ftell, fread, fclose       stdio.h
+      malloc                          stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The image must be released with 'cheby_store_close'.
+
+------------------------------------------------------------------------
+*/
+{
+   FILE *fp = NULL;
+
+   memset (store, 0, sizeof (cheby_store));
+
+#ifdef _WIN32
+   {
+      HANDLE file, map;
+      DWORD size;
+      void *base;
+
+      file = CreateFileA (name, GENERIC_READ, FILE_SHARE_READ, NULL,
+                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      if (file == INVALID_HANDLE_VALUE)
+         return 1;
+      size = GetFileSize (file, NULL);
+      map = (size > 0) ? CreateFileMappingA (file, NULL, PAGE_READONLY, 0,
+                                             0, NULL) : NULL;
+      base = (map != NULL) ? MapViewOfFile (map, FILE_MAP_READ, 0, 0, 0) :
+         NULL;
+      if (base != NULL)
+      {
+         store->base = (unsigned char *) base;
+         store->size = (long int) size;
+         store->mapped = 1;
+         store->file = (void *) file;
+         store->map = (void *) map;
+         return 0;
+      }
+      if (map != NULL)
+         CloseHandle (map);
+      CloseHandle (file);
+   }
+#else
+   {
+      int fd;
+      struct stat st;
+      void *base;
+
+      if ((fd = open (name, O_RDONLY)) < 0)
+         return 1;
+      if ((fstat (fd, &st) == 0) && (st.st_size > 0))
+      {
+         base = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE,
+                      fd, 0);
+         if (base != MAP_FAILED)
+         {
+            close (fd);
+            store->base = (unsigned char *) base;
+            store->size = (long int) st.st_size;
+            store->mapped = 1;
+            return 0;
+         }
+      }
+      close (fd);
+   }
+#endif
+
+/*
+   No mapping: read the whole file instead.
+*/
+
+   if (fopen_s (&fp, name, "rb") != 0)
+      return 1;
+   fseek (fp, 0L, SEEK_END);
+   store->size = ftell (fp);
+   fseek (fp, 0L, SEEK_SET);
+   store->base = (unsigned char *) malloc ((size_t) store->size + 1);
+   if (store->base == NULL)
+   {
+      fclose (fp);
+      return 3;
+   }
+   if ((store->size > 0) &&
+       (fread (store->base, (size_t) store->size, 1, fp) != 1))
+   {
+      fclose (fp);
+      free (store->base);
+      store->base = NULL;
+      return 2;
+   }
+   fclose (fp);
+
+   return 0;
+}
+
+/********cheby_store_close */
+
+void cheby_store_close (cheby_store *store)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases a file image opened by 'cheby_store_open'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *store (struct cheby_store)
+         The file image.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      UnmapViewOfFile, CloseHandle    windows.h  (Windows)
+      munmap                          sys/mman.h (elsewhere)
+      free                            stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   if (store->base == NULL)
+      return;
+
+   if (store->mapped)
+   {
+#ifdef _WIN32
+      UnmapViewOfFile (store->base);
+      CloseHandle ((HANDLE) store->map);
+      CloseHandle ((HANDLE) store->file);
+#else
+      munmap (store->base, (size_t) store->size);
+#endif
+   }
+   else
+      free (store->base);
+
+   memset (store, 0, sizeof (cheby_store));
+   return;
+}
+
+/********cheby_open_uniform */
+
+short int cheby_open_uniform (char *name, double jd0, double span,
+                              long int n_seg, long int rec_base,
+                              long int rec_size,
+
+                              cheby_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Opens a piecewise ephemeris made of fixed-size records, each
+      covering the same span of time (the JPL DE files, the CIO table).
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the file.
+      jd0 (double)
+         Start of the first record (Julian date).
+      span (double)
+         Time covered by each record (days).
+      n_seg (long int)
+         Number of records.
+      rec_base (long int)
+         Byte offset of the first record in the file.
+      rec_size (long int)
+         Size of each record in bytes.
+
+   OUTPUT
+   ARGUMENTS:
+      *h (struct cheby_handle)
+         The opened ephemeris.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1-3 . Error from 'cheby_store_open'.
+         4 ... File shorter than the records described.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_open   cheby_engine.c
+      cheby_store_close  cheby_engine.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   memset (h, 0, sizeof (cheby_handle));
+   if ((error = cheby_store_open (name, &h->store)) != 0)
+      return error;
+
+   if (rec_base + n_seg * rec_size > h->store.size)
+   {
+      cheby_store_close (&h->store);
+      return 4;
+   }
+
+   h->index.n_seg = n_seg;
+   h->index.jd0 = jd0;
+   h->index.span = span;
+   h->index.rec_base = rec_base;
+   h->index.rec_size = rec_size;
+
+   return 0;
+}
+
+/********cheby_open_table */
+
+short int cheby_open_table (char *name, long int n_seg, double *start,
+                            double *len, long int *offset,
+
+                            cheby_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Opens a piecewise ephemeris whose records vary in span and size
+      (the USNO/AE98 minor planet files).
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the file.
+      n_seg (long int)
+         Number of records.
+      *start (double)
+         Start of each record (Julian date), ascending.
+      *len (double)
+         Time covered by each record (days).
+      *offset (long int)
+         Byte offset of each record in the file.
+
+   OUTPUT
+   ARGUMENTS:
+      *h (struct cheby_handle)
+         The opened ephemeris.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1-3 . Error from 'cheby_store_open'.
+         4 ... File shorter than the records described.
+         5 ... Unable to allocate memory.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_open   cheby_engine.c
+      cheby_close        cheby_engine.c
+      malloc             stdlib.h
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The tables are copied, so the caller may free its own.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   long int i;
+
+   memset (h, 0, sizeof (cheby_handle));
+   if (n_seg < 1)
+      return 4;
+   if ((error = cheby_store_open (name, &h->store)) != 0)
+      return error;
+
+   h->index.n_seg = n_seg;
+   h->index.jd0 = start[0];
+   h->index.start = (double *) malloc ((size_t) n_seg * sizeof (double));
+   h->index.len = (double *) malloc ((size_t) n_seg * sizeof (double));
+   h->index.offset = (long int *) malloc ((size_t) n_seg *
+                                          sizeof (long int));
+   if ((h->index.start == NULL) || (h->index.len == NULL) ||
+       (h->index.offset == NULL))
+   {
+      cheby_close (h);
+      return 5;
+   }
+   memcpy (h->index.start, start, (size_t) n_seg * sizeof (double));
+   memcpy (h->index.len, len, (size_t) n_seg * sizeof (double));
+   memcpy (h->index.offset, offset, (size_t) n_seg * sizeof (long int));
+
+   for (i = 0; i < n_seg; i++)
+      if ((offset[i] < 0) || (offset[i] >= h->store.size))
+      {
+         cheby_close (h);
+         return 4;
+      }
+
+   return 0;
+}
+
+/********cheby_close */
+
+void cheby_close (cheby_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Closes a piecewise ephemeris and releases its memory.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct cheby_handle)
+         The ephemeris.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_close  cheby_engine.c
+      free               stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   cheby_store_close (&h->store);
+   free (h->index.start);
+   free (h->index.len);
+   free (h->index.offset);
+   memset (h, 0, sizeof (cheby_handle));
+
+   return;
+}
+
+/********cheby_find */
+
+long int cheby_find (cheby_handle *h, double jd[2], long int hint,
+
+                     double *frac)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Finds the segment holding a date and the fraction of the segment
+      elapsed at that date.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct cheby_handle)
+         The ephemeris.
+      jd[2] (double)
+         Julian date split into two parts, as for function 'state'.
+      hint (long int)
+         Segment found by the previous call, or -1.  Consecutive dates
+         usually fall in the same segment, which is then found at once.
+
+   OUTPUT
+   ARGUMENTS:
+      *frac (double)
+         Fraction of the segment elapsed at 'jd' (0 <= frac <= 1).
+
+   RETURNED
+   VALUE:
+      (long int)
+         Segment number (from 0), or -1 if 'jd' is outside the
+         ephemeris.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      split              eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. For a uniform index the date is split as in 'state', so that
+         the fraction keeps the full precision of the two-part date.
+      2. A date exactly at the end of a segment belongs to that
+         segment, not to the next, as in the USNO/AE98 reader.
+
+------------------------------------------------------------------------
+*/
+{
+   long int seg, lo, hi, mid, n = h->index.n_seg;
+
+   double d[4], s, t, jd_end;
+
+   if (h->index.span > 0.0)
+   {
+      s = jd[0] - 0.5;
+      split (s, &d[0]);
+      split (jd[1], &d[2]);
+      d[0] += d[2] + 0.5;
+      d[1] += d[3];
+      split (d[1], &d[2]);
+      d[0] += d[2];
+
+      jd_end = h->index.jd0 + (double) n * h->index.span;
+      if ((d[0] < h->index.jd0) || ((d[0] + d[3]) > jd_end))
+         return -1;
+
+      seg = (long int) ((d[0] - h->index.jd0) / h->index.span);
+      if (seg >= n)
+         seg = n - 1;
+      *frac = ((d[0] - ((double) seg * h->index.span + h->index.jd0)) +
+               d[3]) / h->index.span;
+      if (*frac > 1.0)
+         *frac = 1.0;
+      return seg;
+   }
+
+/*
+   Tabulated index: try the hint, then search.
+*/
+
+   t = jd[0] + jd[1];
+   if ((t < h->index.start[0]) ||
+       (t > h->index.start[n - 1] + h->index.len[n - 1]))
+      return -1;
+
+   if ((hint >= 0) && (hint < n) && (t >= h->index.start[hint]) &&
+       (t <= h->index.start[hint] + h->index.len[hint]))
+      seg = hint;
+   else
+   {
+      lo = 0;
+      hi = n - 1;
+      while (lo < hi)
+      {
+         mid = (lo + hi) / 2;
+         if (h->index.start[mid] + h->index.len[mid] < t)
+            lo = mid + 1;
+         else
+            hi = mid;
+      }
+      seg = lo;
+   }
+
+   *frac = (t - h->index.start[seg]) / h->index.len[seg];
+   if (*frac < 0.0)
+      *frac = 0.0;
+   return seg;
+}
+
+/********cheby_segment */
+
+const unsigned char *cheby_segment (cheby_handle *h, long int seg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Returns the address of a segment's record within the store.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct cheby_handle)
+         The ephemeris.
+      seg (long int)
+         Segment number (from 0).
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (const unsigned char *)
+         First byte of the record.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   if (h->index.offset != NULL)
+      return h->store.base + h->index.offset[seg];
+
+   return h->store.base + h->index.rec_base + seg * h->index.rec_size;
+}
+
+/********cheby_eval */
+
+void cheby_eval (const double *coef, long int ncf, long int ncomp,
+                 double tc,
+
+                 double *value, double *deriv)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Evaluates Chebyshev series, and optionally their derivatives, for
+      several components sharing the same normalized time.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *coef (double)
+         Coefficients, 'ncf' for each component in turn.
+      ncf (long int)
+         Number of coefficients per component (at most CHEBY_MAX_COEF).
+      ncomp (long int)
+         Number of components.
+      tc (double)
+         Normalized Chebyshev time (-1 <= tc <= 1).
+
+   OUTPUT
+   ARGUMENTS:
+      *value (double)
+         Value of each component.
+      *deriv (double)
+         Derivative of each component with respect to 'tc', or NULL if
+         not wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      _mm_*              emmintrin.h  (SSE2 builds)
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The polynomials T(tc) and their derivatives are generated once
+         by the three-term recurrence and shared by all components,
+         which for the three-component series of the ephemerides is
+         faster than a Clenshaw summation per component.
+      2. Each sum is accumulated in two lanes (even and odd terms) which
+         are added at the end.  The SSE2 path holds the two lanes in one
+         register, so both paths give identical results.
+      3. 'coef' need not be aligned.
+
+------------------------------------------------------------------------
+*/
+{
+   long int c, j;
+
+   double pc[CHEBY_MAX_COEF + 1], vc[CHEBY_MAX_COEF + 1], twot = tc + tc,
+      s0, s1, v0, v1;
+
+   const double *p;
+
+/*
+   Chebyshev polynomials and their derivatives at 'tc'.  The arrays are
+   padded with a zero term so that the sums can run in pairs.
+*/
+
+   pc[0] = 1.0;
+   pc[1] = tc;
+   vc[0] = 0.0;
+   vc[1] = 1.0;
+   for (j = 2; j < ncf; j++)
+   {
+      pc[j] = twot * pc[j - 1] - pc[j - 2];
+      vc[j] = twot * vc[j - 1] + pc[j - 1] + pc[j - 1] - vc[j - 2];
+   }
+   pc[ncf] = 0.0;
+   vc[ncf] = 0.0;
+
+   for (c = 0; c < ncomp; c++)
+   {
+      p = coef + c * ncf;
+
+#ifdef CHEBY_SSE2
+      {
+         __m128d vs = _mm_setzero_pd (), vv = _mm_setzero_pd (), vcf;
+         double out[2];
+
+         for (j = 0; j + 1 < ncf; j += 2)
+         {
+            vcf = _mm_loadu_pd (p + j);
+            vs = _mm_add_pd (vs, _mm_mul_pd (vcf, _mm_loadu_pd (pc + j)));
+            vv = _mm_add_pd (vv, _mm_mul_pd (vcf, _mm_loadu_pd (vc + j)));
+         }
+         _mm_storeu_pd (out, vs);
+         s0 = out[0];
+         s1 = out[1];
+         _mm_storeu_pd (out, vv);
+         v0 = out[0];
+         v1 = out[1];
+      }
+#else
+      s0 = s1 = v0 = v1 = 0.0;
+      for (j = 0; j + 1 < ncf; j += 2)
+      {
+         s0 += p[j] * pc[j];
+         s1 += p[j + 1] * pc[j + 1];
+         v0 += p[j] * vc[j];
+         v1 += p[j + 1] * vc[j + 1];
+      }
+#endif
+
+/*
+   Odd number of coefficients: the last term goes in the even lane.
+*/
+
+      if (j < ncf)
+      {
+         s0 += p[j] * pc[j];
+         v0 += p[j] * vc[j];
+      }
+
+      value[c] = s0 + s1;
+      if (deriv != NULL)
+         deriv[c] = v0 + v1;
+   }
+
+   return;
+}
+
+/********cheby_eval_sub */
+
+void cheby_eval_sub (const double *coef, long int ncf, long int ncomp,
+                     long int na, double t,
+
+                     double *value, double *deriv)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Evaluates a record divided into equal sub-intervals, each holding
+      'ncomp' Chebyshev series, as in the JPL ephemerides.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *coef (double)
+         Coefficients of the first sub-interval; each sub-interval holds
+         'ncomp' x 'ncf' coefficients.
+      ncf (long int)
+         Number of coefficients per component.
+      ncomp (long int)
+         Number of components.
+      na (long int)
+         Number of sub-intervals in the record.
+      t (double)
+         Fraction of the record elapsed (0 <= t <= 1).
+
+   OUTPUT
+   ARGUMENTS:
+      *value (double)
+         Value of each component.
+      *deriv (double)
+         Derivative of each component with respect to 't', or NULL if
+         not wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_eval         cheby_engine.c
+      fmod               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The sub-interval and normalized time are found exactly as in
+         'interpolate' (eph_manager.c).
+
+------------------------------------------------------------------------
+*/
+{
+   long int l, c;
+
+   double dna, dt1, temp, tc;
+
+   dna = (double) na;
+   dt1 = (double) ((long int) t);
+   temp = dna * t;
+   l = (long int) (temp - dt1);
+   if (l >= na)
+      l = na - 1;
+   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+
+   cheby_eval (coef + l * ncomp * ncf, ncf, ncomp, tc, value, deriv);
+
+   if (deriv != NULL)
+      for (c = 0; c < ncomp; c++)
+         deriv[c] *= 2.0 * dna;
+
+   return;
+}
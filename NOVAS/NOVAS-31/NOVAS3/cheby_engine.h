@@ -0,0 +1,143 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  cheby_engine.h: Header file for cheby_engine.c, the piecewise
+                  Chebyshev engine shared by the JPL ephemeris manager,
+                  the USNO/AE98 minor planet reader and the CIO table
+*/
+
+#ifndef _CHEBYENGINE_
+   #define _CHEBYENGINE_
+
+   #ifndef __ASCOM__
+      #include "ascom.h"
+   #endif
+
+   #ifndef __STDIO__
+      #include <stdio.h>
+   #endif
+
+   #ifndef __STDLIB__
+      #include <stdlib.h>
+   #endif
+
+/*
+   The SSE2 evaluator is used wherever the compiler targets SSE2; it
+   gives the same results as the scalar code.
+*/
+
+   #if !defined(CHEBY_NO_SSE2) && (defined(_M_X64) || defined(__SSE2__) \
+       || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+      #define CHEBY_SSE2
+   #endif
+
+/*
+   CHEBY_MAX_COEF     = largest number of coefficients per component
+                        handled by the evaluator
+*/
+
+   #define CHEBY_MAX_COEF 32
+
+/*
+   struct cheby_store:  a read-only file image, memory mapped where the
+                        operating system allows and otherwise read into
+                        memory
+
+   base               = first byte of the image
+   size               = size of the image in bytes
+   mapped             = 1 if 'base' is a mapping, 0 if it was allocated
+   file, map          = operating system handles of the mapping
+*/
+
+   typedef struct
+   {
+      unsigned char *base;
+      long int size;
+      short int mapped;
+      void *file;
+      void *map;
+   } cheby_store;
+
+/*
+   struct cheby_index:  the time segments of a piecewise ephemeris
+
+   n_seg              = number of segments
+   jd0                = start of the first segment (Julian date)
+   span               = segment length for a uniform index (days);
+                        zero when the segments are listed in 'start'
+   start              = start of each segment (days), ascending;
+                        used only when 'span' is zero
+   len                = length of each segment (days); used only when
+                        'span' is zero
+   offset             = byte offset of each segment in the store; NULL
+                        for fixed-size records
+   rec_base           = byte offset of the first fixed-size record
+   rec_size           = size of each fixed-size record (bytes)
+*/
+
+   typedef struct
+   {
+      long int n_seg;
+      double jd0;
+      double span;
+      double *start;
+      double *len;
+      long int *offset;
+      long int rec_base;
+      long int rec_size;
+   } cheby_index;
+
+/*
+   struct cheby_handle:  one open piecewise ephemeris.  A handle is not
+                         changed by evaluation, so any number of threads
+                         may evaluate through the same handle.
+*/
+
+   typedef struct
+   {
+      cheby_store store;
+      cheby_index index;
+   } cheby_handle;
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int cheby_store_open (char *name,
+
+                                      cheby_store *store);
+
+   EXPORT void cheby_store_close (cheby_store *store);
+
+   EXPORT short int cheby_open_uniform (char *name, double jd0, double span,
+                                        long int n_seg, long int rec_base,
+                                        long int rec_size,
+
+                                        cheby_handle *h);
+
+   EXPORT short int cheby_open_table (char *name, long int n_seg,
+                                      double *start, double *len,
+                                      long int *offset,
+
+                                      cheby_handle *h);
+
+   EXPORT void cheby_close (cheby_handle *h);
+
+   EXPORT long int cheby_find (cheby_handle *h, double jd[2], long int hint,
+
+                               double *frac);
+
+   EXPORT const unsigned char *cheby_segment (cheby_handle *h,
+                                              long int seg);
+
+   EXPORT void cheby_eval (const double *coef, long int ncf,
+                           long int ncomp, double tc,
+
+                           double *value, double *deriv);
+
+   EXPORT void cheby_eval_sub (const double *coef, long int ncf,
+                               long int ncomp, long int na, double t,
+
+                               double *value, double *deriv);
+
+#endif
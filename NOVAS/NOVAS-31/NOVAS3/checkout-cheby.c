@@ -0,0 +1,153 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-cheby.c: Checkout and timing program for the Chebyshev engine
+
+  Usage: checkout-cheby <JPL file> [CIO file] [minor planet name]
+                        [minor planet start JD]
+
+  Checks 'cheby_eval' against a direct summation of cos(n acos(tc)),
+  then times the three readers built on the engine: 'state' on the JPL
+  file, 'cio_location' on the CIO file and 'readeph' on a USNO/AE98
+  minor planet file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eph_manager.h"
+#include "cheby_engine.h"
+
+#define N_CALLS 200000L
+
+int main (int argc, char *argv[])
+{
+   short int error, de_num, ref_sys;
+
+   int failed = 0, err;
+
+   long int i, j, k, ncf, n;
+
+   double coef[3 * CHEBY_MAX_COEF], val[3], der[3], ref_val, ref_der,
+      tc, th, d, max_val = 0.0, max_der = 0.0, jd_beg, jd_end, tjd[2],
+      pos[3], vel[3], ra, *mp, secs;
+
+   clock_t start;
+
+   if (argc < 2)
+   {
+      printf ("Usage: checkout-cheby <JPL file> [CIO file] "
+         "[minor planet name] [minor planet start JD]\n");
+      return 1;
+   }
+
+/*
+   Evaluator against direct summation, for every series length.
+*/
+
+   srand (12345);
+   for (ncf = 2; ncf <= CHEBY_MAX_COEF; ncf++)
+   {
+      for (j = 0; j < 3 * ncf; j++)
+         coef[j] = (double) rand () / RAND_MAX - 0.5;
+      for (i = 0; i <= 1000; i++)
+      {
+         tc = -0.9999 + 1.9998 * (double) i / 1000.0;
+         th = acos (tc);
+         cheby_eval (coef, ncf, 3L, tc, val, der);
+         for (k = 0; k < 3; k++)
+         {
+            ref_val = ref_der = 0.0;
+            for (j = 0; j < ncf; j++)
+            {
+               ref_val += coef[k * ncf + j] * cos ((double) j * th);
+               ref_der += coef[k * ncf + j] * (double) j *
+                  sin ((double) j * th) / sin (th);
+            }
+            if ((d = fabs (val[k] - ref_val)) > max_val)
+               max_val = d;
+            if ((d = fabs (der[k] - ref_der) / (ncf * ncf)) > max_der)
+               max_der = d;
+         }
+      }
+   }
+   printf ("cheby_eval: max value error %.3e, max derivative error %.3e\n",
+      max_val, max_der);
+   if ((max_val > 1.0e-13) || (max_der > 1.0e-13))
+      failed = 1;
+
+/*
+   'state' on the JPL file.
+*/
+
+   if ((error = ephem_open (argv[1], &jd_beg, &jd_end, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open.\n", error);
+      return error;
+   }
+   n = 0;
+   start = clock ();
+   for (i = 0; i < N_CALLS; i++)
+   {
+      tjd[0] = jd_beg + (jd_end - jd_beg) * (i + 0.37) / N_CALLS;
+      tjd[1] = 0.0;
+      for (k = 0; k < 11; k++, n++)
+         if ((error = state (tjd, (short int) k, pos, vel)) != 0)
+         {
+            printf ("Error %d from state.\n", error);
+            return error;
+         }
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+   printf ("state:        DE%d, %ld calls, %.3f s, %.1f ns/call\n", de_num,
+      n, secs, 1.0e9 * secs / n);
+   ephem_close ();
+
+/*
+   'cio_location' on the CIO file.
+*/
+
+   if (argc > 2)
+   {
+      set_racio_file (argv[2]);
+      start = clock ();
+      for (i = 0; i < N_CALLS; i++)
+         if ((error = cio_location (2451545.0 + i * 0.0913, 0, &ra,
+            &ref_sys)) != 0)
+         {
+            printf ("Error %d from cio_location.\n", error);
+            return error;
+         }
+      secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+      printf ("cio_location: %ld calls, %.3f s, %.1f ns/call\n", N_CALLS,
+         secs, 1.0e9 * secs / N_CALLS);
+   }
+
+/*
+   'readeph' on a minor planet file, until the end of its span.
+*/
+
+   if (argc > 4)
+   {
+      jd_beg = atof (argv[4]);
+      n = 0;
+      start = clock ();
+      for (i = 0; i < N_CALLS; i++, n++)
+      {
+         mp = readeph (1, argv[3], jd_beg + i * 0.01, &err);
+         if (mp == NULL)
+            break;
+         free (mp);
+      }
+      secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+      printf ("readeph:      %ld calls, %.3f s, %.1f ns/call\n", n, secs,
+         (n > 0) ? 1.0e9 * secs / n : 0.0);
+   }
+
+   printf (failed ? "\nFAILED: evaluator error too large.\n" :
+      "\nAll checks passed.\n");
+
+   return failed;
+}
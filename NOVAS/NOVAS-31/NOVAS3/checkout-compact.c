@@ -0,0 +1,159 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-compact.c: Checkout program for compact ephemeris files
+
+  Usage: checkout-compact <JPL file> <compact file> [accuracy] [jd_begin]
+                          [jd_end]
+
+  Writes a compact ephemeris file holding all eleven 'state' bodies from
+  the JPL file, then compares positions from the two files at many
+  epochs and reports the largest difference found for each body against
+  the error bound recorded in the compact file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "eph_manager.h"
+#include "eph_compact.h"
+
+#define N_TIMES 5000
+
+int main (int argc, char *argv[])
+{
+   static const char *names[11] = {"Mercury", "Venus", "EMB", "Mars",
+      "Jupiter", "Saturn", "Uranus", "Neptune", "Pluto", "Moon (geo)",
+      "Sun"};
+
+   short int error, de_num;
+   short int i, j, k;
+
+   int failed = 0;
+
+   long int size_jpl, size_compact;
+
+   double accuracy = 0.001, jd_beg = 0.0, jd_end = 0.0, jd_first, jd_last;
+   double *ref, tjd[2], pos[3], vel[3], d, max_err[11], bound[11];
+
+   FILE *fp;
+
+   if (argc < 3)
+   {
+      printf ("Usage: checkout-compact <JPL file> <compact file> "
+         "[accuracy] [jd_begin] [jd_end]\n");
+      return 1;
+   }
+   if (argc > 3)
+      accuracy = atof (argv[3]);
+   if (argc > 4)
+      jd_beg = atof (argv[4]);
+   if (argc > 5)
+      jd_end = atof (argv[5]);
+
+/*
+   Convert the JPL file.
+*/
+
+   if ((error = ephem_compact_convert (argv[1], argv[2], 0x7FFL, accuracy,
+      jd_beg, jd_end)) != 0)
+   {
+      printf ("Error %d from ephem_compact_convert.\n", error);
+      return error;
+   }
+
+/*
+   Tabulate reference positions from the JPL file at epochs spread over
+   the span, deliberately off any block boundary.
+*/
+
+   if ((error = ephem_open (argv[1], &jd_first, &jd_last, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open (JPL file).\n", error);
+      return error;
+   }
+   if (jd_beg == 0.0)
+      jd_beg = jd_first;
+   if (jd_end == 0.0)
+      jd_end = jd_last;
+
+   ref = (double *) calloc (N_TIMES * 11 * 3, sizeof (double));
+   for (i = 0; i < N_TIMES; i++)
+   {
+      tjd[0] = jd_beg + (jd_end - jd_beg) * (i + 0.37) / N_TIMES;
+      tjd[1] = 0.0;
+      for (k = 0; k < 11; k++)
+         if ((error = state (tjd, k, &ref[(i * 11 + k) * 3], vel)) != 0)
+         {
+            printf ("Error %d from state (JPL file).\n", error);
+            return error;
+         }
+   }
+   ephem_close ();
+
+/*
+   Compare with the compact file.
+*/
+
+   if ((error = ephem_open (argv[2], &jd_first, &jd_last, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open (compact file).\n", error);
+      return error;
+   }
+   for (k = 0; k < 11; k++)
+   {
+      max_err[k] = 0.0;
+      bound[k] = CEPH->body[CEPH->index[k]].err_bound;
+   }
+
+   for (i = 0; i < N_TIMES; i++)
+   {
+      tjd[0] = jd_beg + (jd_end - jd_beg) * (i + 0.37) / N_TIMES;
+      tjd[1] = 0.0;
+      for (k = 0; k < 11; k++)
+      {
+         if ((error = state (tjd, k, pos, vel)) != 0)
+         {
+            printf ("Error %d from state (compact file).\n", error);
+            return error;
+         }
+         d = 0.0;
+         for (j = 0; j < 3; j++)
+            d += (pos[j] - ref[(i * 11 + k) * 3 + j]) *
+               (pos[j] - ref[(i * 11 + k) * 3 + j]);
+         d = sqrt (d) * CEPH->au;
+         if (d > max_err[k])
+            max_err[k] = d;
+      }
+   }
+
+   printf ("DE%d, JD %.1f to %.1f, accuracy target %g arcsec\n\n", de_num,
+      jd_first, jd_last, accuracy);
+   printf ("Body          Terms  Size  Max diff (km)  Bound (km)\n");
+   for (k = 0; k < 11; k++)
+   {
+      printf ("%-12s  %5d  %4d  %13.6f  %10.6f\n", names[k],
+         CEPH->body[CEPH->index[k]].n_coef,
+         CEPH->body[CEPH->index[k]].coef_size, max_err[k], bound[k]);
+      if (max_err[k] > bound[k] + 1.0e-5)
+         failed = 1;
+   }
+   ephem_close ();
+   free (ref);
+
+   fp = fopen (argv[1], "rb");
+   fseek (fp, 0L, SEEK_END);
+   size_jpl = ftell (fp);
+   fclose (fp);
+   fp = fopen (argv[2], "rb");
+   fseek (fp, 0L, SEEK_END);
+   size_compact = ftell (fp);
+   fclose (fp);
+   printf ("\nJPL file %ld bytes, compact file %ld bytes.\n", size_jpl,
+      size_compact);
+
+   printf (failed ? "\nFAILED: difference exceeds bound.\n" :
+      "\nAll differences within bound.\n");
+
+   return failed;
+}
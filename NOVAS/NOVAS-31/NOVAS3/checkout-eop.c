@@ -0,0 +1,307 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-eop.c: Checkout and timing program for the Earth orientation
+                  store
+
+  Usage: checkout-eop [IERS file]
+
+  Writes a finals2000A file of known values (smooth functions of the
+  date, across the leap seconds of 2012, 2015 and 2016, with a gap,
+  predictions and days without pole offsets), converts it to a binary
+  store and checks 'eop_values' from both the text and the binary forms
+  against the functions, the flags, the handling outside the table, and
+  that 'eop_ter2cel' matches 'cel_pole' and 'ter2cel' called by hand and
+  leaves the caller's pole offsets in place.  Then times 'eop_values'
+  and 'eop_ter2cel', on the given IERS file if there is one.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eop_store.h"
+
+#define N_CALLS 1000000L
+
+#define TEXT_NAME "checkout-eop-finals.txt"
+#define STORE_NAME "checkout-eop.bin"
+
+#define MJD_FIRST 56000L
+#define MJD_LAST 58000L
+#define MJD_GAP 57000L
+#define MJD_PRED 57850L
+#define MJD_NO_POLE 57950L
+
+static double dat (double mjd)
+{
+   return (mjd < 56109.0) ? 34.0 : (mjd < 57204.0) ? 35.0 :
+      (mjd < 57754.0) ? 36.0 : 37.0;
+}
+
+static void model (double mjd, double *xp, double *yp, double *dut1,
+                   double *dx, double *dy)
+{
+   double d = mjd - MJD_FIRST;
+
+   *xp = 0.1 + 0.15 * sin (TWOPI * d / 433.0);
+   *yp = 0.3 + 0.15 * cos (TWOPI * d / 433.0);
+   *dut1 = -34.6 - 0.0016 * d + 0.02 * sin (TWOPI * d / 365.25) +
+      dat (mjd);
+   *dx = 0.2 * sin (TWOPI * d / 300.0);
+   *dy = 0.2 * cos (TWOPI * d / 300.0);
+}
+
+static void put (char *line, int col, char *text)
+{
+   memcpy (line + col - 1, text, strlen (text));
+}
+
+static int write_finals (char *name)
+{
+   char line[190], field[32];
+   long int m;
+   double xp, yp, dut1, dx, dy;
+   FILE *fp = NULL;
+
+   if (fopen_s (&fp, name, "w") != 0)
+      return 1;
+   for (m = MJD_FIRST; m <= MJD_LAST + 10; m++)
+   {
+      if ((m >= MJD_GAP) && (m < MJD_GAP + 3))
+         continue;
+      memset (line, ' ', 187);
+      line[187] = '\0';
+      put (line, 1, "00 1 1");
+      sprintf (field, "%8.2f", (double) m);
+      put (line, 8, field);
+      if (m <= MJD_LAST)
+      {
+         model ((double) m, &xp, &yp, &dut1, &dx, &dy);
+         put (line, 17, (m >= MJD_PRED) ? "P" : "I");
+         sprintf (field, "%9.6f", xp);
+         put (line, 19, field);
+         sprintf (field, "%9.6f", yp);
+         put (line, 38, field);
+         put (line, 58, (m >= MJD_PRED) ? "P" : "I");
+         sprintf (field, "%10.7f", dut1);
+         put (line, 59, field);
+         if (m < MJD_NO_POLE)
+         {
+            put (line, 96, (m >= MJD_PRED) ? "P" : "I");
+            sprintf (field, "%9.3f", dx);
+            put (line, 98, field);
+            sprintf (field, "%9.3f", dy);
+            put (line, 117, field);
+         }
+      }
+      else
+      {
+
+/*
+   Padding after the predictions, as at the end of finals2000A.
+*/
+
+         line[16] = 'P';
+         line[68] = '\0';
+      }
+      fprintf (fp, "%s\n", line);
+   }
+   fclose (fp);
+   return 0;
+}
+
+int main (int argc, char *argv[])
+{
+   short int error, f_text, f_bin, k;
+
+   int failed = 0;
+
+   long int i, n;
+
+   double mjd, jd, xp, yp, dut1, dx, dy, v[5], w[5], m[5], tol[5],
+      d, max_err[5] = {0.0}, vec1[3], vec2[3], vec3[3], vec4[3], vec5[3],
+      secs, jd_ut1_low, sink = 0.0;
+
+   char *names[5] = {"xp", "yp", "dut1", "dx", "dy"};
+
+   eop_handle text, bin;
+
+   clock_t start;
+
+   tol[0] = tol[1] = 1.0e-6;
+   tol[2] = 1.0e-6;
+   tol[3] = tol[4] = 2.0e-3;
+
+   if (write_finals (TEXT_NAME) != 0)
+   {
+      printf ("Unable to write %s.\n", TEXT_NAME);
+      return 1;
+   }
+   if ((error = eop_convert (TEXT_NAME, STORE_NAME)) != 0)
+   {
+      printf ("Error %d from eop_convert.\n", error);
+      return error;
+   }
+   if (((error = eop_open (TEXT_NAME, &text)) != 0) ||
+       ((error = eop_open (STORE_NAME, &bin)) != 0))
+   {
+      printf ("Error %d from eop_open.\n", error);
+      return error;
+   }
+   printf ("Store: %ld days from MJD %.1f, mapped %d\n", bin.n_days,
+      bin.mjd0, bin.store.mapped);
+   if ((bin.n_days != MJD_LAST - MJD_FIRST + 1) ||
+       (bin.mjd0 != (double) MJD_FIRST))
+      failed = 1;
+
+/*
+   Values against the model, and text against binary.  The first and
+   last days are interpolated linearly, so are not held to the model.
+*/
+
+   srand (12345);
+   for (i = 0; i < 200000; i++)
+   {
+      mjd = MJD_FIRST + (MJD_LAST - MJD_FIRST) * (double) rand () /
+         RAND_MAX;
+      jd = 2400000.5 + floor (mjd);
+      f_text = eop_values (&text, jd, mjd - floor (mjd), &v[0], &v[1],
+         &v[2], &v[3], &v[4]);
+      f_bin = eop_values (&bin, jd, mjd - floor (mjd), &w[0], &w[1], &w[2],
+         &w[3], &w[4]);
+      if ((f_text != f_bin) || (memcmp (v, w, sizeof (v)) != 0))
+         failed = 1;
+      if ((mjd > MJD_GAP - 3) && (mjd < MJD_GAP + 5))
+      {
+         if (((mjd >= MJD_GAP - 1) && (mjd < MJD_GAP + 3)) !=
+             ((f_bin & EOP_MISSING) != 0))
+            failed = 1;
+         continue;
+      }
+      if (((mjd > MJD_PRED - 1) != ((f_bin & EOP_PREDICTED) != 0)) ||
+          ((mjd > MJD_NO_POLE - 1) != ((f_bin & EOP_NO_POLE) != 0)))
+         failed = 1;
+      if ((mjd < MJD_FIRST + 1) || (mjd > MJD_LAST - 1))
+         continue;
+      model (mjd, &m[0], &m[1], &m[2], &m[3], &m[4]);
+      for (k = 0; k < ((mjd < MJD_NO_POLE - 3) ? 5 : 3); k++)
+         if ((d = fabs (v[k] - m[k])) > max_err[k])
+            max_err[k] = d;
+   }
+   for (k = 0; k < 5; k++)
+   {
+      printf ("eop_values: max %-4s error %.3e\n", names[k], max_err[k]);
+      if (max_err[k] > tol[k])
+         failed = 1;
+   }
+
+/*
+   Either side of the leap second at the end of 2016:  UT1-UTC steps by
+   one second at 0h UTC, and delta T does not.
+*/
+
+   eop_values (&bin, 2457754.5, -1.0e-6, &xp, &yp, &v[0], &dx, &dy);
+   eop_values (&bin, 2457754.5, 1.0e-6, &xp, &yp, &v[1], &dx, &dy);
+   printf ("Leap second: UT1-UTC %.7f s before, %.7f s after\n", v[0],
+      v[1]);
+   if (fabs (v[1] - v[0] - 1.0) > 1.0e-6)
+      failed = 1;
+   eop_times (&bin, 2457754.5, -1.0e-6, &jd_ut1_low, &w[0]);
+   eop_times (&bin, 2457754.5, 1.0e-6, &jd_ut1_low, &w[1]);
+   if (fabs (w[1] - w[0]) > 1.0e-6)
+      failed = 1;
+
+/*
+   Outside the table:  the end values, flagged.
+*/
+
+   f_bin = eop_values (&bin, 2400000.5 + MJD_FIRST - 10.0, 0.0, &v[0],
+      &v[1], &v[2], &v[3], &v[4]);
+   if (!(f_bin & EOP_OUTSIDE) || (v[0] != bin.rec[0].xp) ||
+       (v[2] != bin.rec[0].dut1))
+      failed = 1;
+   f_bin = eop_values (&bin, 2400000.5 + MJD_LAST + 100.0, 0.0, &v[0],
+      &v[1], &v[2], &v[3], &v[4]);
+   if (!(f_bin & EOP_OUTSIDE) || !(f_bin & EOP_PREDICTED) ||
+       (v[1] != bin.rec[bin.n_days - 1].yp))
+      failed = 1;
+   f_bin = eop_values (&bin, 2400000.5 + MJD_FIRST + 500.0, 0.25, &v[0],
+      &v[1], &v[2], &v[3], &v[4]);
+   if (f_bin != 0)
+      failed = 1;
+
+/*
+   'eop_ter2cel' against 'cel_pole' and 'ter2cel' by hand, with other
+   offsets in force before and after.
+*/
+
+   jd = 2400000.5 + 57500.0;
+   vec1[0] = 0.3;
+   vec1[1] = -0.4;
+   vec1[2] = 0.866;
+   eop_values (&bin, jd, 0.3, &xp, &yp, &dut1, &dx, &dy);
+   cel_pole (jd + (0.3 + (32.184 + 36.0) / 86400.0), 2, dx, dy);
+   ter2cel (jd, 0.3 + dut1 / 86400.0, 32.184 + 36.0 - dut1, 1, 0, 0, xp,
+      yp, vec1, vec2);
+
+   cel_pole (jd, 1, 0.5, 0.3);
+   ter2cel (jd, 0.5, 69.0, 1, 0, 0, xp, yp, vec1, vec4);
+   error = eop_ter2cel (&bin, jd, 0.3, 1, 0, 0, vec1, vec3);
+   ter2cel (jd, 0.5, 69.0, 1, 0, 0, xp, yp, vec1, vec5);
+   printf ("eop_ter2cel: error %d, difference %.3e, caller's offsets %s\n",
+      error, fabs (vec3[0] - vec2[0]) + fabs (vec3[1] - vec2[1]) +
+      fabs (vec3[2] - vec2[2]), (memcmp (vec4, vec5, sizeof (vec4)) == 0) ?
+      "kept" : "CHANGED");
+   if ((error != 0) || (memcmp (vec2, vec3, sizeof (vec2)) != 0) ||
+       (memcmp (vec4, vec5, sizeof (vec4)) != 0))
+      failed = 1;
+
+/*
+   Timing, on the given IERS file or the one written above.
+*/
+
+   if (argc > 1)
+   {
+      eop_close (&bin);
+      if ((error = eop_open (argv[1], &bin)) != 0)
+      {
+         printf ("Error %d from eop_open on %s.\n", error, argv[1]);
+         return error;
+      }
+      printf ("%s: %ld days from MJD %.1f\n", argv[1], bin.n_days,
+         bin.mjd0);
+   }
+   start = clock ();
+   for (i = 0; i < N_CALLS; i++)
+   {
+      eop_values (&bin, 2400000.5 + bin.mjd0, (bin.n_days - 1) *
+         (i + 0.37) / N_CALLS, &xp, &yp, &dut1, &dx, &dy);
+      sink += dut1;
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+   printf ("eop_values:  %ld calls, %.3f s, %.1f ns/call\n", N_CALLS, secs,
+      1.0e9 * secs / N_CALLS);
+
+   n = N_CALLS / 10;
+   start = clock ();
+   for (i = 0; i < n; i++)
+   {
+      eop_ter2cel (&bin, 2400000.5 + bin.mjd0, (bin.n_days - 1) *
+         (i + 0.37) / n, 1, 1, 0, vec1, vec2);
+      sink += vec2[0];
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+   printf ("eop_ter2cel: %ld calls, %.3f s, %.1f ns/call\n", n, secs,
+      1.0e9 * secs / n);
+
+   eop_close (&text);
+   eop_close (&bin);
+   remove (TEXT_NAME);
+   remove (STORE_NAME);
+
+   printf ("%s\n", (failed || (sink == 0.0)) ? "FAILED" : "PASSED");
+   return failed;
+}
@@ -0,0 +1,251 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-multiplace.c: Checkout and timing program for the
+                         multi-observer place
+
+  Usage: checkout-multiplace <JPL file>
+
+  Computes the places of the Sun, Moon and planets and of random stars,
+  two of them beside the Sun and Jupiter, for a network of stations on
+  the Earth's surface, the geocenter and near-Earth spacecraft (one far
+  enough out to need 'light_time' again), in every coordinate system at
+  both accuracies, and checks every pair against 'place' (to a
+  microarcsecond at full accuracy; at reduced accuracy 'place' finds the
+  Moon at dates held in one double, about a milliarcsecond apart from
+  the light-time solved here).  Checks the Earth as a target from
+  spacecraft, then times 'multi_place' against 'place' for every pair.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eph_manager.h"
+#include "multi_place.h"
+
+#define N_STATIONS 40
+#define N_OBSERVERS (N_STATIONS + 4)
+#define N_BODIES 10
+#define N_STARS 100
+#define N_TARGETS (N_BODIES + N_STARS)
+
+#define JD_TT 2456789.5
+#define DELTA_T 67.2
+
+static int failed = 0;
+
+/*
+   Compares the places from 'multi_place' with 'place' for every pair;
+   returns the largest differences in position (microarcseconds),
+   distance (AU) and radial velocity (km/s).
+*/
+
+static void compare (long int n_obs, observer *obs, long int n_tgt,
+                     object *tgt, short int coord_sys, short int accuracy,
+                     sky_pos *out, double *max_pos, double *max_dis,
+                     double *max_rv)
+{
+   long int i, t;
+   short int error;
+   double d;
+   sky_pos sky;
+
+   *max_pos = *max_dis = *max_rv = 0.0;
+   for (i = 0; i < n_obs; i++)
+      for (t = 0; t < n_tgt; t++)
+      {
+         if ((error = place (JD_TT, &tgt[t], &obs[i], DELTA_T, coord_sys,
+            accuracy, &sky)) != 0)
+         {
+            printf ("Error %d from place.\n", error);
+            failed = 1;
+            continue;
+         }
+         d = fmod (out[i * n_tgt + t].ra - sky.ra + 36.0, 24.0) - 12.0;
+         d = sqrt (d * d * 225.0 * cos (sky.dec * DEG2RAD) *
+            cos (sky.dec * DEG2RAD) + (out[i * n_tgt + t].dec - sky.dec) *
+            (out[i * n_tgt + t].dec - sky.dec)) * 3.6e9;
+         if (d > *max_pos)
+            *max_pos = d;
+         d = sqrt ((out[i * n_tgt + t].r_hat[0] - sky.r_hat[0]) *
+            (out[i * n_tgt + t].r_hat[0] - sky.r_hat[0]) +
+            (out[i * n_tgt + t].r_hat[1] - sky.r_hat[1]) *
+            (out[i * n_tgt + t].r_hat[1] - sky.r_hat[1]) +
+            (out[i * n_tgt + t].r_hat[2] - sky.r_hat[2]) *
+            (out[i * n_tgt + t].r_hat[2] - sky.r_hat[2])) * RAD2DEG * 3.6e9;
+         if (d > *max_pos)
+            *max_pos = d;
+         if ((d = fabs (out[i * n_tgt + t].dis - sky.dis)) > *max_dis)
+            *max_dis = d;
+         if ((d = fabs (out[i * n_tgt + t].rv - sky.rv)) > *max_rv)
+            *max_rv = d;
+      }
+}
+
+int main (int argc, char *argv[])
+{
+   static short int body_num[N_BODIES] = {10, 11, 1, 2, 4, 5, 6, 7, 8, 9};
+
+   static double spacecraft[3][6] = {
+      {6878.0, 0.0, 0.0, 0.0, 5.4, 5.4},
+      {-30000.0, 29000.0, 500.0, -2.2, -2.1, 0.1},
+      {900000.0, 1200000.0, -300000.0, 0.3, -0.2, 0.05}};
+
+   short int error, de_num, coord_sys, accuracy, k;
+
+   long int i, t;
+
+   double jd_beg, jd_end, max_pos, max_dis, max_rv, secs, secs_place,
+      sink = 0.0;
+
+   char name[SIZE_OF_OBJ_NAME];
+
+   observer obs[N_OBSERVERS];
+
+   object tgt[N_TARGETS];
+
+   cat_entry star;
+
+   sky_pos *out, sky;
+
+   clock_t start;
+
+   if (argc < 2)
+   {
+      printf ("Usage: checkout-multiplace <JPL file>\n");
+      return 1;
+   }
+   if ((error = ephem_open (argv[1], &jd_beg, &jd_end, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open.\n", error);
+      return error;
+   }
+   if ((out = (sky_pos *) malloc (N_OBSERVERS * N_TARGETS *
+      sizeof (sky_pos))) == NULL)
+   {
+      printf ("Unable to allocate memory.\n");
+      return 3;
+   }
+
+/*
+   Stations across the Earth, the geocenter and three spacecraft.
+*/
+
+   srand (12345);
+   for (i = 0; i < N_STATIONS; i++)
+      make_observer_on_surface (asin (2.0 * (double) rand () / RAND_MAX -
+         1.0) * RAD2DEG, 360.0 * (double) rand () / RAND_MAX - 180.0,
+         3000.0 * (double) rand () / RAND_MAX, 10.0, 1010.0, &obs[i]);
+   make_observer_at_geocenter (&obs[N_STATIONS]);
+   for (k = 0; k < 3; k++)
+      make_observer_in_space (spacecraft[k], spacecraft[k] + 3,
+         &obs[N_STATIONS + 1 + k]);
+
+/*
+   The Sun, Moon and planets, random stars, and stars beside the Sun
+   and Jupiter.
+*/
+
+   make_cat_entry ("DUMMY", "xxx", 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, &star);
+   for (t = 0; t < N_BODIES; t++)
+      make_object (0, body_num[t], "Body", &star, &tgt[t]);
+   for (t = 0; t < N_STARS; t++)
+   {
+      sprintf (name, "Star %ld", t);
+      make_cat_entry (name, "CAT", t, 24.0 * (double) rand () / RAND_MAX,
+         asin (2.0 * (double) rand () / RAND_MAX - 1.0) * RAD2DEG,
+         200.0 * ((double) rand () / RAND_MAX - 0.5),
+         200.0 * ((double) rand () / RAND_MAX - 0.5),
+         (t % 3) ? 50.0 * (double) rand () / RAND_MAX : 0.0,
+         100.0 * ((double) rand () / RAND_MAX - 0.5), &star);
+      make_object (2, 0, name, &star, &tgt[N_BODIES + t]);
+   }
+   for (k = 0; k < 2; k++)
+   {
+      place (JD_TT, &tgt[(k == 0) ? 0 : 5], &obs[N_STATIONS], DELTA_T, 3, 0,
+         &sky);
+      tgt[N_BODIES + k].star.ra = sky.ra + ((k == 0) ? 0.3 : 0.006) / 15.0 /
+         cos (sky.dec * DEG2RAD);
+      tgt[N_BODIES + k].star.dec = sky.dec;
+   }
+
+   for (accuracy = 0; accuracy <= 1; accuracy++)
+      for (coord_sys = 0; coord_sys <= 3; coord_sys++)
+      {
+         if ((error = multi_place (JD_TT, N_OBSERVERS, obs, N_TARGETS, tgt,
+            DELTA_T, coord_sys, accuracy, out)) != 0)
+         {
+            printf ("Error %d from multi_place.\n", error);
+            return error;
+         }
+         compare (N_OBSERVERS, obs, N_TARGETS, tgt, coord_sys, accuracy,
+            out, &max_pos, &max_dis, &max_rv);
+         printf ("Accuracy %d, coord_sys %d: %d pairs, max difference from "
+            "'place' %.4f uas, %.1e AU, %.1e km/s\n", accuracy, coord_sys,
+            N_OBSERVERS * N_TARGETS, max_pos, max_dis, max_rv);
+         if ((max_pos > ((accuracy == 0) ? 1.0 : 2000.0)) ||
+             (max_dis > ((accuracy == 0) ? 1.0e-15 : 1.0e-13)) ||
+             (max_rv > 1.0e-6))
+            failed = 1;
+      }
+
+/*
+   The Earth as a target:  refused with a station, computed from the
+   spacecraft.
+*/
+
+   make_object (0, 3, "Earth", &star, &tgt[0]);
+   if (multi_place (JD_TT, N_OBSERVERS, obs, 1, tgt, DELTA_T, 1, 0, out) !=
+       3)
+   {
+      printf ("Earth as a target from the Earth's surface not refused.\n");
+      failed = 1;
+   }
+   if ((error = multi_place (JD_TT, 3, &obs[N_STATIONS + 1], 1, tgt,
+      DELTA_T, 1, 0, out)) != 0)
+   {
+      printf ("Error %d from multi_place.\n", error);
+      return error;
+   }
+   compare (3, &obs[N_STATIONS + 1], 1, tgt, 1, 0, out, &max_pos, &max_dis,
+      &max_rv);
+   printf ("Earth from spacecraft: max difference from 'place' %.4f uas, "
+      "%.1e AU, %.1e km/s\n", max_pos, max_dis, max_rv);
+   if ((max_pos > 1.0) || (max_dis > 1.0e-15) || (max_rv > 1.0e-6))
+      failed = 1;
+   make_object (0, 10, "Body", &star, &tgt[0]);
+
+/*
+   Timing, for the stations alone.
+*/
+
+   start = clock ();
+   for (k = 0; k < 20; k++)
+   {
+      multi_place (JD_TT + k * 1.0e-3, N_STATIONS, obs, N_TARGETS, tgt,
+         DELTA_T, 1, 0, out);
+      sink += out[0].ra;
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC / 20.0;
+   start = clock ();
+   for (k = 0; k < 5; k++)
+      for (i = 0; i < N_STATIONS; i++)
+         for (t = 0; t < N_TARGETS; t++)
+         {
+            place (JD_TT + k * 1.0e-3, &tgt[t], &obs[i], DELTA_T, 1, 0, &sky);
+            sink += sky.ra;
+         }
+   secs_place = (double) (clock () - start) / CLOCKS_PER_SEC / 5.0;
+   printf ("%d stations, %d targets: multi_place %.3f ms, place for each "
+      "pair %.3f ms\n", N_STATIONS, N_TARGETS, 1.0e3 * secs,
+      1.0e3 * secs_place);
+
+   ephem_close ();
+   free (out);
+
+   printf ("%s\n", (failed || (sink == 0.0)) ? "FAILED" : "PASSED");
+   return failed;
+}
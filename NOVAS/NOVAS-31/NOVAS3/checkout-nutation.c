@@ -0,0 +1,103 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-nutation.c: Checkout and timing program for the nutation
+  evaluation modes
+
+  Usage: checkout-nutation
+
+  Checks that 'iau2000a', 'iau2000b' and 'nu2000k' give the same
+  nutation in the harmonics mode as in the libm mode (the USNO code)
+  over 1800-2200, then times each in both modes.
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+
+#define N_DATES 20001L
+#define N_CALLS 20000L
+
+/*
+   Largest allowed difference between the modes, in radians.
+*/
+
+#define TOLERANCE 1.0e-14
+
+typedef void (*nutation_fn) (double jd_high, double jd_low,
+                             double *dpsi, double *deps);
+
+int main (void)
+{
+   static const char *names[3] = {"iau2000a", "iau2000b", "nu2000k"};
+
+   static const nutation_fn fns[3] = {iau2000a, iau2000b, nu2000k};
+
+   int failed = 0;
+
+   short int mode, n;
+
+   long int i;
+
+   double jd, dpsi1, deps1, dpsi2, deps2, d, max_diff, secs[2];
+
+   clock_t start;
+
+   for (n = 0; n < 3; n++)
+   {
+
+/*
+   The two modes against each other.
+*/
+
+      max_diff = 0.0;
+      for (i = 0; i < N_DATES; i++)
+      {
+         jd = 2378496.5 + 146097.0 * (double) i / (N_DATES - 1);
+         set_nutation_mode (NUT_MODE_LIBM);
+         fns[n] (jd, 0.0, &dpsi1, &deps1);
+         set_nutation_mode (NUT_MODE_HARMONICS);
+         fns[n] (jd, 0.0, &dpsi2, &deps2);
+         if ((d = fabs (dpsi2 - dpsi1)) > max_diff)
+            max_diff = d;
+         if ((d = fabs (deps2 - deps1)) > max_diff)
+            max_diff = d;
+      }
+      if (max_diff > TOLERANCE)
+         failed = 1;
+
+/*
+   Timing.
+*/
+
+      for (mode = NUT_MODE_LIBM; mode <= NUT_MODE_HARMONICS; mode++)
+      {
+         set_nutation_mode (mode);
+         start = clock ();
+         for (i = 0; i < N_CALLS; i++)
+            fns[n] (2451545.0 + (double) i * 0.37, 0.0, &dpsi1, &deps1);
+         secs[mode] = (double) (clock () - start) / CLOCKS_PER_SEC;
+      }
+
+      printf ("%-8s  max difference %.3e rad, libm %.2f us/call, "
+         "harmonics %.2f us/call\n", names[n], max_diff,
+         1.0e6 * secs[0] / N_CALLS, 1.0e6 * secs[1] / N_CALLS);
+   }
+
+/*
+   Mode selection.
+*/
+
+   set_nutation_mode (NUT_MODE_LIBM);
+   if ((set_nutation_mode (99) != NUT_MODE_LIBM) ||
+       (set_nutation_mode (NUT_MODE_LIBM) != NUT_MODE_LIBM))
+   {
+      printf ("set_nutation_mode: invalid mode accepted\n");
+      failed = 1;
+   }
+
+   printf (failed ? "\nFAILED: modes differ.\n" : "\nAll checks passed.\n");
+
+   return failed;
+}
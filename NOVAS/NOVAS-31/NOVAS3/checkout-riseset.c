@@ -0,0 +1,330 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-riseset.c: Checkout and timing program for the rise, set and
+                      transit solver
+
+  Usage: checkout-riseset <JPL file>
+
+  Finds the rise, transit and set over a day of random stars, on the
+  horizon with refraction and at random altitudes without, and of the
+  Sun, Moon and Mars from a few geocentric places across the day, at a
+  middle and a high latitude.  A sample of the stars and the bodies are followed by
+  'equ2hor' every minute of the day:  each event found must lie in the
+  minute where 'equ2hor' shows it, and none may be missed.  At each
+  event the target's altitude, or azimuth at transit, is then checked
+  against 'place' and 'equ2hor' called directly.  Finally times
+  'rise_set' on 100000 stars against sampling with 'equ2hor'.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eph_manager.h"
+#include "rise_set.h"
+
+#define N_STARS 100000L
+#define N_SAMPLE 300L
+#define N_BODIES 3
+#define N_KNOTS 5
+
+#define JD_BEG 2456789.5
+#define WINDOW 1.0
+#define DELTA_T 67.2
+#define XP 0.12
+#define YP 0.35
+
+static on_surface site;
+
+static object bodies[N_BODIES];
+
+static int failed = 0;
+
+/*
+   Observed altitude and azimuth of star 'i', or of body 'i - N_STARS',
+   at UT1 Julian date jd_ut1_beg + t.
+*/
+
+static void exact (double *ra, double *dec, long int i, short int ref,
+                   double t, double *alt, double *az)
+{
+   double zd, rar, decr, r, d;
+   observer obs;
+   sky_pos sky;
+
+   if (i < N_STARS)
+   {
+      r = ra[i];
+      d = dec[i];
+   }
+   else
+   {
+      make_observer_on_surface (site.latitude, site.longitude, site.height,
+         site.temperature, site.pressure, &obs);
+      place (JD_BEG + t + DELTA_T / 86400.0, &bodies[i - N_STARS], &obs,
+         DELTA_T, 1, 0, &sky);
+      r = sky.ra;
+      d = sky.dec;
+   }
+   equ2hor (JD_BEG + t, DELTA_T, 0, XP, YP, &site, r, d, ref, &zd, az,
+      &rar, &decr);
+   *alt = 90.0 - zd;
+}
+
+/*
+   Follows target 'i' every minute and checks the events found for it.
+*/
+
+static void follow (double *ra, double *dec, long int i, short int ref,
+                    double h, double rise, double transit, double set,
+                    short int above, double *max_alt, double *max_az,
+                    long int *n_events)
+{
+   short int b_above = -1;
+   long int m;
+   double t, a, az, a0 = 0.0, az0 = 0.0, b_rise = 0.0, b_transit = 0.0,
+      b_set = 0.0, e[3], b[3], d;
+   int k;
+
+   for (m = 0; m <= 1440; m++)
+   {
+      t = WINDOW * (double) m / 1440.0;
+      exact (ra, dec, i, ref, t, &a, &az);
+      a -= h;
+      if (m == 0)
+         b_above = (short int) (a >= 0.0);
+      else
+      {
+         if ((a0 < 0.0) && (a >= 0.0) && (b_rise == 0.0))
+            b_rise = t;
+         if ((a0 >= 0.0) && (a < 0.0) && (b_set == 0.0))
+            b_set = t;
+         if ((sin (az0 * DEG2RAD) > 0.0) && (sin (az * DEG2RAD) <= 0.0) &&
+             (b_transit == 0.0))
+            b_transit = t;
+      }
+      a0 = a;
+      az0 = az;
+   }
+
+   e[0] = rise;
+   e[1] = transit;
+   e[2] = set;
+   b[0] = b_rise;
+   b[1] = b_transit;
+   b[2] = b_set;
+   if (above != b_above)
+   {
+      printf ("Target %ld: above %d, 'equ2hor' %d\n", i, above, b_above);
+      failed = 1;
+   }
+   for (k = 0; k < 3; k++)
+   {
+      if ((e[k] == RISE_SET_NONE) != (b[k] == 0.0))
+      {
+         printf ("Target %ld event %d: found %.6f, 'equ2hor' minute %.6f\n",
+            i, k, e[k], b[k]);
+         failed = 1;
+         continue;
+      }
+      if (e[k] == RISE_SET_NONE)
+         continue;
+      t = e[k] - JD_BEG;
+      if ((t < b[k] - (1.0 + 1.0e-3) / 1440.0) || (t > b[k] + 1.0e-6))
+      {
+         printf ("Target %ld event %d at %.6f, outside 'equ2hor' minute "
+            "%.6f\n", i, k, t, b[k]);
+         failed = 1;
+      }
+      exact (ra, dec, i, ref, t, &a, &az);
+      (*n_events)++;
+      if (k == 1)
+      {
+         if ((d = fabs (sin (az * DEG2RAD)) * cos (a * DEG2RAD) * 3600.0 *
+              RAD2DEG) > *max_az)
+            *max_az = d;
+      }
+      else if ((d = fabs (a - h) * 3600.0) > *max_alt)
+         *max_alt = d;
+   }
+}
+
+int main (int argc, char *argv[])
+{
+   static double latitudes[2] = {38.5, 65.0};
+
+   short int error, de_num, ref, *above, s, k;
+
+   long int i, n_events;
+
+   double jd_beg, jd_end, *ra, *dec, *alt, *rise, *transit, *set, secs,
+      max_alt, max_az, cost, zd, az, rar, decr, sink = 0.0, h;
+
+   double b_ra[N_KNOTS * N_BODIES], b_dec[N_KNOTS * N_BODIES],
+      b_dis[N_KNOTS * N_BODIES],
+      b_alt[N_BODIES] = {-0.8333, -0.8333, 0.0},
+      b_rise[N_BODIES], b_transit[N_BODIES], b_set[N_BODIES];
+
+   short int b_above[N_BODIES];
+
+   char *body_names[N_BODIES] = {"Sun", "Moon", "Mars"};
+
+   observer obs;
+
+   sky_pos sky;
+
+   cat_entry dummy;
+
+   clock_t start;
+
+   if (argc < 2)
+   {
+      printf ("Usage: checkout-riseset <JPL file>\n");
+      return 1;
+   }
+   if ((error = ephem_open (argv[1], &jd_beg, &jd_end, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open.\n", error);
+      return error;
+   }
+
+   ra = (double *) malloc (N_STARS * sizeof (double));
+   dec = (double *) malloc (N_STARS * sizeof (double));
+   alt = (double *) malloc (N_STARS * sizeof (double));
+   rise = (double *) malloc (N_STARS * sizeof (double));
+   transit = (double *) malloc (N_STARS * sizeof (double));
+   set = (double *) malloc (N_STARS * sizeof (double));
+   above = (short int *) malloc (N_STARS * sizeof (short int));
+   if ((ra == NULL) || (dec == NULL) || (alt == NULL) || (rise == NULL) ||
+       (transit == NULL) || (set == NULL) || (above == NULL))
+   {
+      printf ("Unable to allocate memory.\n");
+      return 3;
+   }
+
+   srand (12345);
+   for (i = 0; i < N_STARS; i++)
+   {
+      ra[i] = 24.0 * (double) rand () / RAND_MAX;
+      dec[i] = asin (2.0 * (double) rand () / RAND_MAX - 1.0) * RAD2DEG;
+      alt[i] = -5.0 + 65.0 * (double) rand () / RAND_MAX;
+   }
+   make_cat_entry ("DUMMY", "xxx", 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, &dummy);
+   make_object (0, 10, "Sun", &dummy, &bodies[0]);
+   make_object (0, 11, "Moon", &dummy, &bodies[1]);
+   make_object (0, 4, "Mars", &dummy, &bodies[2]);
+
+   for (s = 0; s < 2; s++)
+   {
+      make_on_surface (latitudes[s], -77.0, 100.0, 10.0, 1010.0, &site);
+
+/*
+   Stars:  on the horizon with refraction, then at their own altitudes
+   without.
+*/
+
+      for (ref = 1; ref >= 0; ref--)
+      {
+         start = clock ();
+         if ((error = rise_set (JD_BEG, WINDOW, DELTA_T, XP, YP, 0, &site,
+            ref, N_STARS, 1, ra, dec, NULL, (ref != 0) ? NULL : alt, rise,
+            transit, set, above)) != 0)
+         {
+            printf ("Error %d from rise_set.\n", error);
+            return error;
+         }
+         secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+         sink += rise[0] + set[0];
+
+         max_alt = max_az = 0.0;
+         n_events = 0;
+         for (i = 0; i < N_SAMPLE; i++)
+         {
+            h = (ref != 0) ? 0.0 : alt[i];
+            follow (ra, dec, i, ref, h, rise[i], transit[i], set[i],
+               above[i], &max_alt, &max_az, &n_events);
+         }
+         printf ("Latitude %4.1f, stars %s: %ld stars, %.3f s; %ld events "
+            "checked, max altitude error %.4f\", max transit error "
+            "%.4f\"\n", latitudes[s], (ref != 0) ?
+            "on the horizon, refracted" : "at random altitudes", N_STARS,
+            secs, n_events, max_alt, max_az);
+         if ((max_alt > ((ref != 0) ? 0.2 : 0.01)) || (max_az > 0.01))
+            failed = 1;
+      }
+
+/*
+   Sun, Moon and Mars, from geocentric places at the knots; Mars on the
+   horizon with refraction, the Sun and Moon with the conventional
+   allowances.
+*/
+
+      make_observer_at_geocenter (&obs);
+      for (k = 0; k < N_KNOTS; k++)
+         for (i = 0; i < N_BODIES; i++)
+         {
+            place (JD_BEG + WINDOW * k / (N_KNOTS - 1) + DELTA_T / 86400.0,
+               &bodies[i], &obs, DELTA_T, 1, 0, &sky);
+            b_ra[k * N_BODIES + i] = sky.ra;
+            b_dec[k * N_BODIES + i] = sky.dec;
+            b_dis[k * N_BODIES + i] = sky.dis;
+         }
+      for (ref = 0; ref <= 1; ref++)
+      {
+         if ((error = rise_set (JD_BEG, WINDOW, DELTA_T, XP, YP, 0, &site,
+            ref, N_BODIES, N_KNOTS, b_ra, b_dec, b_dis, b_alt, b_rise,
+            b_transit, b_set, b_above)) != 0)
+         {
+            printf ("Error %d from rise_set.\n", error);
+            return error;
+         }
+         for (i = 0; i < N_BODIES; i++)
+         {
+            if ((ref == 1) != (i == 2))
+               continue;
+            max_alt = max_az = 0.0;
+            n_events = 0;
+            follow (ra, dec, N_STARS + i, ref, b_alt[i], b_rise[i],
+               b_transit[i], b_set[i], b_above[i], &max_alt, &max_az,
+               &n_events);
+            printf ("Latitude %4.1f, %-4s: rise %.6f, transit %.6f, set "
+               "%.6f; max altitude error %.4f\", max transit error "
+               "%.4f\"\n", latitudes[s], body_names[i], b_rise[i],
+               b_transit[i], b_set[i], max_alt, max_az);
+            if ((max_alt > 1.0) || (max_az > 1.0))
+               failed = 1;
+         }
+      }
+   }
+
+/*
+   Timing:  sampling every minute with 'equ2hor', from a sample of its
+   calls, against the solver above.
+*/
+
+   start = clock ();
+   for (i = 0; i < 20000; i++)
+   {
+      equ2hor (JD_BEG + (double) i / 20000.0, DELTA_T, 0, XP, YP, &site,
+         ra[i], dec[i], 1, &zd, &az, &rar, &decr);
+      sink += zd;
+   }
+   cost = (double) (clock () - start) / CLOCKS_PER_SEC / 20000.0;
+   printf ("equ2hor every minute: %.1f ns/call, %.1f s for %ld stars\n",
+      1.0e9 * cost, cost * 1441.0 * N_STARS, N_STARS);
+
+   ephem_close ();
+   free (ra);
+   free (dec);
+   free (alt);
+   free (rise);
+   free (transit);
+   free (set);
+   free (above);
+
+   printf ("%s\n", (failed || (sink == 0.0)) ? "FAILED" : "PASSED");
+   return failed;
+}
@@ -0,0 +1,426 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-starcat.c: Checkout and timing program for the binary star
+                      catalog
+
+  Usage: checkout-starcat <JPL file>
+
+  Writes a small text catalog, converts it and checks every value read
+  back.  Writes random catalogs at several HEALPix orders and checks
+  cone and box queries, at the poles, across 0h and from arcseconds to
+  the whole sky, against a scan of every star.  Checks the places from
+  'star_cat_place' against 'place' for stars across the sky and beside
+  the Sun and Jupiter, then times the selection and reduction of the
+  stars in a field of one degree against 'place' for every star of the
+  catalog.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eph_manager.h"
+#include "star_cat.h"
+
+#define N_STARS 2000000L
+#define N_SMALL 20000L
+#define N_FIELDS 200
+
+#define JD_TT 2456789.5
+#define DELTA_T 67.2
+
+static int failed = 0;
+
+/*
+   Random star across the sky, with plausible proper motion, parallax,
+   radial velocity and magnitude.
+*/
+
+static void random_star (long int i, double *ra, double *dec, double *pm_ra,
+                         double *pm_dec, double *parallax, double *rv,
+                         double *mag)
+{
+   ra[i] = 24.0 * (double) rand () / RAND_MAX;
+   dec[i] = asin (2.0 * (double) rand () / RAND_MAX - 1.0) * RAD2DEG;
+   pm_ra[i] = 200.0 * ((double) rand () / RAND_MAX - 0.5);
+   pm_dec[i] = 200.0 * ((double) rand () / RAND_MAX - 0.5);
+   parallax[i] = 50.0 * (double) rand () / RAND_MAX;
+   rv[i] = 100.0 * ((double) rand () / RAND_MAX - 0.5);
+   mag[i] = 4.0 + 12.0 * (double) rand () / RAND_MAX;
+}
+
+/*
+   Checks a selection against a scan of the catalog; 'box' holds
+   ra_min, ra_max, dec_min, dec_max, or is NULL for the circle.
+*/
+
+static void check_query (star_cat *cat, double ra, double dec,
+                         double radius, double *box, double mag_limit,
+                         star_slice *stars, long int *n_found,
+                         long int *n_tested)
+{
+   long int i, j = 0, n = 0;
+   double d, w, width;
+   short int in;
+
+   for (i = 0; i < cat->n_stars; i++)
+   {
+      if ((double) cat->mag[i] > mag_limit)
+         continue;
+      if (box == NULL)
+      {
+         d = sin (cat->dec[i] * DEG2RAD) * sin (dec * DEG2RAD) +
+            cos (cat->dec[i] * DEG2RAD) * cos (dec * DEG2RAD) *
+            cos ((cat->ra[i] - ra) * 15.0 * DEG2RAD);
+         in = (short int) (d >= cos (radius * DEG2RAD));
+      }
+      else
+      {
+         width = fmod (box[1] - box[0] + 48.0, 24.0);
+         if (width == 0.0)
+            width = 24.0;
+         w = fmod (cat->ra[i] - box[0] + 48.0, 24.0);
+         in = (short int) ((w <= width) && (cat->dec[i] >= box[2]) &&
+                           (cat->dec[i] <= box[3]));
+      }
+      if (!in)
+         continue;
+      n++;
+      while ((j < stars->n) && (stars->index[j] < i))
+         j++;
+      if ((j >= stars->n) || (stars->index[j] != i))
+      {
+         printf ("Star %ld (%.6f, %.6f) missed by the query at (%.6f, "
+            "%.6f) radius %.6f\n", i, cat->ra[i], cat->dec[i], ra, dec,
+            radius);
+         failed = 1;
+      }
+   }
+   if (n != stars->n)
+   {
+      printf ("Query at (%.6f, %.6f) radius %.6f: %ld stars, scan %ld\n",
+         ra, dec, radius, stars->n, n);
+      failed = 1;
+   }
+   *n_found += n;
+   (*n_tested)++;
+}
+
+int main (int argc, char *argv[])
+{
+   static short int orders[4] = {0, 3, STAR_CAT_ORDER, 9};
+
+   short int error, de_num, o, f, where, coord_sys, accuracy;
+
+   long int i, j, n, n_found, n_tested, *id;
+
+   double jd_beg, jd_end, *ra, *dec, *pm_ra, *pm_dec, *parallax, *rv, *mag,
+      *p_ra, *p_dec, c_ra, c_dec, radius, box[4], max_diff, d, sink = 0.0,
+      secs, cost, r, dd;
+
+   char *text_name = "checkout-starcat.txt",
+      *cat_name = "checkout-starcat.cat";
+
+   FILE *fp;
+
+   star_cat cat;
+
+   star_slice stars;
+
+   observer obs;
+
+   cat_entry star;
+
+   object body;
+
+   sky_pos sky;
+
+   clock_t start;
+
+   if (argc < 2)
+   {
+      printf ("Usage: checkout-starcat <JPL file>\n");
+      return 1;
+   }
+   if ((error = ephem_open (argv[1], &jd_beg, &jd_end, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open.\n", error);
+      return error;
+   }
+
+   id = (long int *) malloc (N_STARS * sizeof (long int));
+   ra = (double *) malloc (N_STARS * sizeof (double));
+   dec = (double *) malloc (N_STARS * sizeof (double));
+   pm_ra = (double *) malloc (N_STARS * sizeof (double));
+   pm_dec = (double *) malloc (N_STARS * sizeof (double));
+   parallax = (double *) malloc (N_STARS * sizeof (double));
+   rv = (double *) malloc (N_STARS * sizeof (double));
+   mag = (double *) malloc (N_STARS * sizeof (double));
+   p_ra = (double *) malloc (N_STARS * sizeof (double));
+   p_dec = (double *) malloc (N_STARS * sizeof (double));
+   if ((id == NULL) || (ra == NULL) || (dec == NULL) || (pm_ra == NULL) ||
+       (pm_dec == NULL) || (parallax == NULL) || (rv == NULL) ||
+       (mag == NULL) || (p_ra == NULL) || (p_dec == NULL))
+   {
+      printf ("Unable to allocate memory.\n");
+      return 3;
+   }
+   memset (&stars, 0, sizeof (star_slice));
+   srand (12345);
+
+/*
+   Text catalog:  convert, then read every value back.
+*/
+
+   if ((fp = fopen (text_name, "w")) == NULL)
+   {
+      printf ("Unable to create %s.\n", text_name);
+      return 6;
+   }
+   fprintf (fp, "# id ra dec pm_ra pm_dec parallax rv mag\n");
+   for (i = 0; i < N_SMALL; i++)
+   {
+      random_star (i, ra, dec, pm_ra, pm_dec, parallax, rv, mag);
+      id[i] = 1000 + 7 * i;
+      fprintf (fp, "%ld %.12f %.12f %.3f %.3f %.4f, %.2f\t%.2f\n", id[i],
+         ra[i], dec[i], pm_ra[i], pm_dec[i], parallax[i], rv[i], mag[i]);
+   }
+   fclose (fp);
+   if ((error = star_cat_convert (text_name, cat_name)) != 0)
+   {
+      printf ("Error %d from star_cat_convert.\n", error);
+      return error;
+   }
+   if ((error = star_cat_open (cat_name, &cat)) != 0)
+   {
+      printf ("Error %d from star_cat_open.\n", error);
+      return error;
+   }
+   n = 0;
+   max_diff = 0.0;
+   for (i = 0; i < cat.n_stars; i++)
+   {
+      j = (cat.id[i] - 1000) / 7;
+      if ((j < 0) || (j >= N_SMALL) || (cat.id[i] != id[j]))
+      {
+         printf ("Star %ld: bad catalog number %d\n", i, cat.id[i]);
+         failed = 1;
+         continue;
+      }
+      n++;
+      d = fabs (cat.ra[i] - ra[j]) * 15.0 + fabs (cat.dec[i] - dec[j]);
+      if (d > max_diff)
+         max_diff = d;
+      if ((fabs (cat.pm_ra[i] - pm_ra[j]) > 1.0e-3) ||
+          (fabs (cat.pm_dec[i] - pm_dec[j]) > 1.0e-3) ||
+          (fabs (cat.parallax[i] - parallax[j]) > 1.0e-4) ||
+          (fabs (cat.rv[i] - rv[j]) > 1.0e-2) ||
+          (fabs (cat.mag[i] - mag[j]) > 1.0e-2))
+      {
+         printf ("Star %ld: values differ from the text catalog\n", i);
+         failed = 1;
+      }
+   }
+   for (i = 0; i < cat.n_cells; i++)
+      if (cat.cell[i] > cat.cell[i + 1])
+         failed = 1;
+   printf ("Converted %ld of %ld stars at order %d\n", n, N_SMALL,
+      cat.order);
+   if ((n != N_SMALL) || (cat.cell[cat.n_cells] != N_SMALL))
+      failed = 1;
+   star_cat_close (&cat);
+
+/*
+   Queries against a scan, at several orders.
+*/
+
+   for (i = 0; i < N_STARS; i++)
+      random_star (i, ra, dec, pm_ra, pm_dec, parallax, rv, mag);
+   for (o = 0; o < 4; o++)
+   {
+      n = (orders[o] < 9) ? N_STARS : N_STARS / 10;
+      if ((error = star_cat_write (cat_name, orders[o], n, NULL, ra, dec,
+         pm_ra, pm_dec, parallax, rv, mag)) != 0)
+      {
+         printf ("Error %d from star_cat_write.\n", error);
+         return error;
+      }
+      if ((error = star_cat_open (cat_name, &cat)) != 0)
+      {
+         printf ("Error %d from star_cat_open.\n", error);
+         return error;
+      }
+      n_found = n_tested = 0;
+      for (f = 0; f < N_FIELDS; f++)
+      {
+         c_ra = 24.0 * (double) rand () / RAND_MAX;
+         c_dec = asin (2.0 * (double) rand () / RAND_MAX - 1.0) * RAD2DEG;
+         if (f < 8)
+            c_dec = (f & 1) ? 90.0 - 0.01 * f : -90.0 + 0.01 * f;
+         radius = pow (10.0, -3.0 + 5.0 * (double) rand () / RAND_MAX);
+         if (radius > 180.0)
+            radius = 180.0;
+         if ((error = star_cat_cone (&cat, c_ra, c_dec, radius,
+            (f & 2) ? 99.0 : 12.0, &stars)) != 0)
+         {
+            printf ("Error %d from star_cat_cone.\n", error);
+            return error;
+         }
+         check_query (&cat, c_ra, c_dec, radius, NULL, (f & 2) ? 99.0 : 12.0,
+            &stars, &n_found, &n_tested);
+
+         box[0] = 24.0 * (double) rand () / RAND_MAX;
+         box[1] = fmod (box[0] + radius / 5.0 * (1.0 + (f % 5)), 24.0);
+         if (f < 4)
+            box[1] = box[0];
+         box[2] = c_dec - 0.5 * radius;
+         box[3] = c_dec + 0.5 * radius;
+         if (box[2] < -90.0)
+            box[2] = -90.0;
+         if (box[3] > 90.0)
+            box[3] = 90.0;
+         if ((error = star_cat_box (&cat, box[0], box[1], box[2], box[3],
+            99.0, &stars)) != 0)
+         {
+            printf ("Error %d from star_cat_box.\n", error);
+            return error;
+         }
+         check_query (&cat, c_ra, c_dec, radius, box, 99.0, &stars,
+            &n_found, &n_tested);
+      }
+      printf ("Order %d, %ld stars: %ld queries, %ld stars found, all "
+         "matching a scan\n", cat.order, cat.n_stars, n_tested, n_found);
+      star_cat_close (&cat);
+   }
+
+/*
+   Places:  'star_cat_place' against 'place', for random stars and for
+   stars within arcminutes of the limbs of the Sun and Jupiter.
+*/
+
+   if ((error = star_cat_write (cat_name, STAR_CAT_ORDER, N_STARS, NULL, ra,
+      dec, pm_ra, pm_dec, parallax, rv, mag)) != 0)
+   {
+      printf ("Error %d from star_cat_write.\n", error);
+      return error;
+   }
+   if ((error = star_cat_open (cat_name, &cat)) != 0)
+   {
+      printf ("Error %d from star_cat_open.\n", error);
+      return error;
+   }
+   star_cat_cone (&cat, 6.0, 20.0, 1.0, 99.0, &stars);
+   n = stars.n;
+   make_cat_entry ("DUMMY", "xxx", 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, &star);
+   make_observer_at_geocenter (&obs);
+   for (f = 0; f < 2; f++)
+   {
+      make_object (0, (f == 0) ? 10 : 5, "Body", &star, &body);
+      place (JD_TT, &body, &obs, DELTA_T, 3, 0, &sky);
+      for (i = 0; i < 50; i++)
+      {
+         r = ((f == 0) ? 0.27 : 0.0055) * (1.0 + (double) i / 25.0);
+         dd = TWOPI * (double) i / 50.0;
+         stars.ra[n + i] = sky.ra + r * cos (dd) / 15.0 /
+            cos (sky.dec * DEG2RAD);
+         stars.dec[n + i] = sky.dec + r * sin (dd);
+      }
+      n += 50;
+   }
+   for (i = stars.n; i < n; i++)
+   {
+      stars.pm_ra[i] = stars.pm_dec[i] = stars.rv[i] = 0.0;
+      stars.parallax[i] = 1.0;
+   }
+   stars.n = n;
+
+   for (where = 0; where <= 1; where++)
+   {
+      if (where == 0)
+         make_observer_at_geocenter (&obs);
+      else
+         make_observer_on_surface (38.5, -77.0, 100.0, 10.0, 1010.0, &obs);
+      for (accuracy = 0; accuracy <= 1; accuracy++)
+         for (coord_sys = 0; coord_sys <= 3; coord_sys++)
+         {
+            if ((error = star_cat_place (JD_TT, &stars, &obs, DELTA_T,
+               coord_sys, accuracy, p_ra, p_dec)) != 0)
+            {
+               printf ("Error %d from star_cat_place.\n", error);
+               return error;
+            }
+            max_diff = 0.0;
+            for (i = 0; i < stars.n; i++)
+            {
+               make_cat_entry ("STAR", "CAT", 0, stars.ra[i], stars.dec[i],
+                  stars.pm_ra[i], stars.pm_dec[i], stars.parallax[i],
+                  stars.rv[i], &star);
+               make_object (2, 0, "STAR", &star, &body);
+               place (JD_TT, &body, &obs, DELTA_T, coord_sys, accuracy,
+                  &sky);
+               d = fmod (p_ra[i] - sky.ra + 36.0, 24.0) - 12.0;
+               d = sqrt (d * d * 225.0 * cos (sky.dec * DEG2RAD) *
+                  cos (sky.dec * DEG2RAD) + (p_dec[i] - sky.dec) *
+                  (p_dec[i] - sky.dec)) * 3.6e9;
+               if (d > max_diff)
+                  max_diff = d;
+            }
+            printf ("Observer %d, accuracy %d, coord_sys %d: %ld stars, max "
+               "difference from 'place' %.3f uas\n", where, accuracy,
+               coord_sys, stars.n, max_diff);
+            if (max_diff > 5.0)
+               failed = 1;
+         }
+   }
+
+/*
+   Timing:  a field of one degree, selected and reduced, against 'place'
+   for every star of the catalog.
+*/
+
+   make_observer_on_surface (38.5, -77.0, 100.0, 10.0, 1010.0, &obs);
+   start = clock ();
+   for (f = 0; f < 100; f++)
+   {
+      star_cat_cone (&cat, 24.0 * f / 100.0, 30.0, 1.0, 99.0, &stars);
+      star_cat_place (JD_TT, &stars, &obs, DELTA_T, 1, 0, p_ra, p_dec);
+      sink += p_ra[0];
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC / 100.0;
+
+   start = clock ();
+   for (i = 0; i < 2000; i++)
+   {
+      make_cat_entry ("STAR", "CAT", 0, ra[i], dec[i], pm_ra[i], pm_dec[i],
+         parallax[i], rv[i], &star);
+      make_object (2, 0, "STAR", &star, &body);
+      place (JD_TT, &body, &obs, DELTA_T, 1, 0, &sky);
+      sink += sky.ra;
+   }
+   cost = (double) (clock () - start) / CLOCKS_PER_SEC / 2000.0;
+   printf ("Field of 1 degree, %ld stars: %.3f ms to select and reduce; "
+      "'place' for all %ld stars: %.1f s\n", stars.n, 1.0e3 * secs,
+      cat.n_stars, cost * cat.n_stars);
+
+   star_cat_close (&cat);
+   star_slice_free (&stars);
+   ephem_close ();
+   remove (text_name);
+   remove (cat_name);
+   free (id);
+   free (ra);
+   free (dec);
+   free (pm_ra);
+   free (pm_dec);
+   free (parallax);
+   free (rv);
+   free (mag);
+   free (p_ra);
+   free (p_dec);
+
+   printf ("%s\n", (failed || (sink == 0.0)) ? "FAILED" : "PASSED");
+   return failed;
+}
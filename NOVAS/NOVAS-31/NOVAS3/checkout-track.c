@@ -0,0 +1,229 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  checkout-track.c: Checkout and timing program for the tracking
+                    polynomials
+
+  Usage: checkout-track <JPL file>
+
+  Fits tracking polynomials for a star, Mars and the Moon, in right
+  ascension and declination over a day and in azimuth and altitude over
+  half a day (the star passing within 0.3 degrees of the zenith), at
+  0.1 and 0.001 arcsecond, and in refracted azimuth and altitude at 0.1
+  arcsecond ('equ2hor' refracts only to that accuracy).  Each fit is
+  then held to its tolerance at many times between its nodes, against
+  'place' and 'equ2hor' called directly, and its rates against
+  differences of the exact reduction.  Refracted places below the
+  horizon, where 'refract' has a jump that the fit keeps in short
+  segments, are skipped.  Finally times 'track_eval' against the
+  reduction it replaces.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "novas.h"
+#include "eph_manager.h"
+#include "track_poly.h"
+
+#define N_CHECK 20000L
+#define N_CALLS 1000000L
+
+#define JD_BEG 2456789.25
+#define DELTA_T 67.2
+#define XP 0.12
+#define YP 0.35
+
+static on_surface site;
+
+static void exact (object *target, short int coords, short int ref_option,
+                   double jd_tt, double *v)
+{
+   double zd, az, rar, decr;
+   observer obs;
+   sky_pos sky;
+
+   make_observer_on_surface (site.latitude, site.longitude, site.height,
+      site.temperature, site.pressure, &obs);
+   if (coords == TRACK_RADEC)
+   {
+      place (jd_tt, target, &obs, DELTA_T, 1, 0, &sky);
+      v[0] = sky.ra;
+      v[1] = sky.dec;
+   }
+   else
+   {
+      place (jd_tt, target, &obs, DELTA_T, 1, 0, &sky);
+      equ2hor (jd_tt - DELTA_T / 86400.0, DELTA_T, 0, XP, YP, &site,
+         sky.ra, sky.dec, ref_option, &zd, &az, &rar, &decr);
+      v[0] = az;
+      v[1] = 90.0 - zd;
+   }
+}
+
+static double sep (short int coords, double *a, double *b)
+{
+   double period = (coords == TRACK_RADEC) ? 24.0 : 360.0, d0, d1;
+
+   d0 = a[0] - b[0];
+   d0 = (d0 - period * floor (d0 / period + 0.5)) * cos (b[1] * DEG2RAD) *
+      ((coords == TRACK_RADEC) ? 15.0 : 1.0);
+   d1 = a[1] - b[1];
+   return 3600.0 * sqrt (d0 * d0 + d1 * d1);
+}
+
+int main (int argc, char *argv[])
+{
+   static char *case_names[5] = {"RA/Dec", "RA/Dec", "Az/Alt", "Az/Alt",
+      "Az/Alt refracted"};
+
+   static short int case_coords[5] = {TRACK_RADEC, TRACK_RADEC,
+      TRACK_AZALT, TRACK_AZALT, TRACK_AZALT};
+
+   static short int case_ref[5] = {0, 0, 0, 0, 1};
+
+   static double case_tol[5] = {0.1, 0.001, 0.1, 0.001, 0.1};
+
+   short int error, de_num, t, coords, ref, c;
+
+   int failed = 0;
+
+   long int i, hint;
+
+   double jd_beg, jd_end, window, jd, v[2], w[2], rate[2], vp[2], vm[2],
+      d, max_err, max_rate, h, secs, sink = 0.0;
+
+   char *target_names[3] = {"Vega", "Mars", "Moon"};
+
+   cat_entry star;
+
+   object targets[3];
+
+   track_poly tp;
+
+   clock_t start;
+
+   if (argc < 2)
+   {
+      printf ("Usage: checkout-track <JPL file>\n");
+      return 1;
+   }
+   if ((error = ephem_open (argv[1], &jd_beg, &jd_end, &de_num)) != 0)
+   {
+      printf ("Error %d from ephem_open.\n", error);
+      return error;
+   }
+
+   make_on_surface (38.5, -77.0, 100.0, 10.0, 1010.0, &site);
+   make_cat_entry ("Vega", "HIP", 91262, 18.615649, 38.783690, 200.94,
+      286.23, 130.23, -13.5, &star);
+   make_object (2, 0, "Vega", &star, &targets[0]);
+   make_object (0, 4, "Mars", &star, &targets[1]);
+   make_object (0, 11, "Moon", &star, &targets[2]);
+
+   for (c = 0; c < 5; c++)
+      for (t = 0; t < 3; t++)
+      {
+         coords = case_coords[c];
+         ref = case_ref[c];
+         window = (coords == TRACK_RADEC) ? 1.0 : 0.5;
+         start = clock ();
+         if ((error = track_fit (&targets[t], &site, JD_BEG,
+            JD_BEG + window, DELTA_T, XP, YP, coords, 1, 0, ref,
+            case_tol[c], &tp)) != 0)
+         {
+            printf ("Error %d from track_fit.\n", error);
+            return error;
+         }
+         secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+
+/*
+Against the reduction at times between the nodes, and the rates
+against central differences over 10 seconds.
+*/
+
+         srand (12345);
+         max_err = max_rate = 0.0;
+         h = 5.0 / 86400.0;
+         hint = -1;
+         for (i = 0; i < N_CHECK; i++)
+         {
+            jd = JD_BEG + window * (double) rand () / RAND_MAX;
+            if (track_eval (&tp, jd, 0.0, &hint, w, rate) != 0)
+            {
+               failed = 1;
+               continue;
+            }
+            exact (&targets[t], coords, ref, jd, v);
+            if ((ref != 0) && (v[1] < 0.0))
+               continue;
+            if ((d = sep (coords, w, v)) > max_err)
+               max_err = d;
+            if ((i % 20 == 0) && (jd - h >= JD_BEG) &&
+                (jd + h <= JD_BEG + window))
+            {
+               exact (&targets[t], coords, ref, jd + h, vp);
+               exact (&targets[t], coords, ref, jd - h, vm);
+               vp[0] -= vm[0];
+               vp[0] -= ((coords == TRACK_RADEC) ? 24.0 : 360.0) *
+                  floor (vp[0] / ((coords == TRACK_RADEC) ? 24.0 : 360.0)
+                  + 0.5);
+               vm[0] = vp[0] / (2.0 * h);
+               vm[1] = (vp[1] - vm[1]) / (2.0 * h);
+               d = sqrt (pow ((rate[0] - vm[0]) * cos (v[1] * DEG2RAD) *
+                  ((coords == TRACK_RADEC) ? 15.0 : 1.0), 2.0) +
+                  pow (rate[1] - vm[1], 2.0)) * 3600.0 / 86400.0;
+               if (d > max_rate)
+                  max_rate = d;
+            }
+         }
+         if ((track_eval (&tp, JD_BEG, 0.0, NULL, w, NULL) != 0) ||
+             (track_eval (&tp, JD_BEG + window, 0.0, NULL, w, NULL) != 0)
+             || (track_eval (&tp, JD_BEG + window, 1.0e-3, NULL, w,
+             NULL) != 1))
+            failed = 1;
+         printf ("%s %s tol %.3f\": %ld segments (%ld rough), %ld "
+            "reductions, %.2f s; max error %.5f\" (fit %.5f\"), max rate "
+            "error %.2e \"/s\n", target_names[t], case_names[c],
+            case_tol[c], tp.ch.index.n_seg, tp.n_rough, tp.n_calls, secs,
+            max_err, tp.max_err, max_rate);
+         if ((max_err > case_tol[c]) || ((ref == 0) && (tp.n_rough > 0)))
+            failed = 1;
+         track_free (&tp);
+      }
+
+/*
+   Timing:  the polynomials against the reduction, Moon in Az/Alt.
+*/
+
+   track_fit (&targets[2], &site, JD_BEG, JD_BEG + 0.5, DELTA_T, XP, YP,
+      TRACK_AZALT, 1, 0, 0, 0.001, &tp);
+   hint = -1;
+   start = clock ();
+   for (i = 0; i < N_CALLS; i++)
+   {
+      track_eval (&tp, JD_BEG, 0.5 * (i + 0.37) / N_CALLS, &hint, w, rate);
+      sink += w[0];
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+   printf ("track_eval:     %ld calls, %.3f s, %.1f ns/call\n", N_CALLS,
+      secs, 1.0e9 * secs / N_CALLS);
+   start = clock ();
+   for (i = 0; i < N_CALLS / 100; i++)
+   {
+      exact (&targets[2], TRACK_AZALT, 0, JD_BEG + 0.5 * (i + 0.37) /
+         (N_CALLS / 100), v);
+      sink += v[0];
+   }
+   secs = (double) (clock () - start) / CLOCKS_PER_SEC;
+   printf ("place+equ2hor:  %ld calls, %.3f s, %.1f ns/call\n",
+      N_CALLS / 100, secs, 1.0e9 * secs / (N_CALLS / 100));
+   track_free (&tp);
+
+   ephem_close ();
+
+   printf ("%s\n", (failed || (sink == 0.0)) ? "FAILED" : "PASSED");
+   return failed;
+}
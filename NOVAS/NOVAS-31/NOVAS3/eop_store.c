@@ -0,0 +1,1107 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eop_store.c: Store of IERS Earth orientation parameters that supplies
+               polar motion, UT1 and the celestial pole offsets to
+               'ter2cel', 'cel2ter' and 'equ2hor'
+
+  Without it every caller of the NOVAS Earth rotation functions looks up
+  xp, yp and delta T itself, and passes dX, dY through 'cel_pole' into
+  offsets that were shared by the whole process.  Here the IERS daily
+  series (finals2000A, or EOP 14 C04 / EOP 20 C04) is held as one
+  record per day:
+
+     eop_convert     IERS text file to a binary store
+     eop_open        binary store (memory mapped) or IERS text file
+     eop_values      xp, yp, UT1-UTC, dX, dY for any UTC date: the day
+                     is found by subtraction and the values are
+                     interpolated through four days
+     eop_times       UT1 and delta T for a UTC date
+     eop_ter2cel,    the NOVAS functions with the Earth orientation
+     eop_cel2ter,    supplied from a handle; the pole offsets are passed
+     eop_equ2hor     for the call only, through the '_cor' functions
+
+  A handle is read-only once opened, so threads may share it.
+*/
+
+#ifndef _EOPSTORE_
+   #include "eop_store.h"
+#endif
+
+#include <string.h>
+#include <math.h>
+
+/*
+   TAI-UTC (seconds) from 0h UTC of each date (MJD) since 1972, as
+   published in IERS Bulletin C.  Handles start with this table; a later
+   table can be given with 'eop_set_leap_seconds'.
+*/
+
+#define EOP_N_LEAP 28
+
+static const double LEAP_MJD[EOP_N_LEAP] = {
+   41317.0, 41499.0, 41683.0, 42048.0, 42413.0, 42778.0, 43144.0,
+   43509.0, 43874.0, 44239.0, 44786.0, 45151.0, 45516.0, 46247.0,
+   47161.0, 47892.0, 48257.0, 48804.0, 49169.0, 49534.0, 50083.0,
+   50630.0, 51179.0, 53736.0, 54832.0, 56109.0, 57204.0, 57754.0};
+
+static const double LEAP_DAT[EOP_N_LEAP] = {
+   10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0,
+   21.0, 22.0, 23.0, 24.0, 25.0, 26.0, 27.0, 28.0, 29.0, 30.0, 31.0,
+   32.0, 33.0, 34.0, 35.0, 36.0, 37.0};
+
+static void eop_default_leap (eop_handle *h);
+
+static double eop_dat (eop_handle *h, double mjd, short int *before);
+
+static short int eop_parse (cheby_store *text, eop_handle *h);
+
+static short int eop_field (const char *line, int len, int col,
+                            int width, double *value);
+
+/********eop_convert */
+
+short int eop_convert (char *iers_name, char *store_name)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Converts an IERS Earth orientation file (finals2000A, EOP 14 C04
+      or EOP 20 C04) to a binary store that 'eop_open' maps directly
+      into memory.
+
+   REFERENCES:
+      IERS Rapid Service/Prediction Center, readme.finals2000A.
+      IERS Earth Orientation Center, EOP 14 C04 and EOP 20 C04 file
+         descriptions.
+
+   INPUT
+   ARGUMENTS:
+      *iers_name (char)
+         Name of the IERS file.
+      *store_name (char)
+         Name of the binary store to be written.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1-5 . Error from 'eop_open'.
+         6 ... Unable to create the binary store.
+         7 ... Error writing the binary store.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_open           eop_store.c
+      eop_close          eop_store.c
+      fopen_s            stdio.h
+      fwrite             stdio.h
+      fclose             stdio.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The store is in the byte order of the machine that wrote it.
+      2. A binary store may also be given as 'iers_name'; it is copied.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+   size_t size;
+   FILE *fp = NULL;
+   eop_handle h;
+
+   if ((error = eop_open (iers_name, &h)) != 0)
+      return error;
+
+   size = EOP_STORE_HEADER + (size_t) h.n_days * sizeof (eop_record);
+
+   if (fopen_s (&fp, store_name, "wb") != 0)
+   {
+      eop_close (&h);
+      return 6;
+   }
+   if (fwrite (h.store.base, size, 1, fp) != 1)
+      error = 7;
+   if (fclose (fp) != 0)
+      error = 7;
+
+   eop_close (&h);
+   return error;
+}
+
+/********eop_open */
+
+short int eop_open (char *name,
+
+                    eop_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Opens a table of Earth orientation parameters:  a binary store
+      written by 'eop_convert', which is memory mapped, or an IERS text
+      file, which is read into memory.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the binary store or IERS file.
+
+   OUTPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The open table, with the built-in leap second table.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... File not found or cannot be opened.
+         2 ... Error reading the file.
+         3 ... Unable to allocate memory.
+         4 ... Binary store of another version, or shorter than the
+               records it describes.
+         5 ... No Earth orientation values found in the IERS file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_open   cheby_engine.c
+      cheby_store_close  cheby_engine.c
+      eop_parse          eop_store.c
+      eop_default_leap   eop_store.c
+      memset             string.h
+      memcmp             string.h
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The table must be released with 'eop_close'.
+      2. Days missing from an IERS file are filled by linear
+         interpolation and flagged EOP_MISSING.  Lines for days beyond
+         the last predicted values (finals2000A) are ignored.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+   int version, n_days;
+   cheby_store text;
+
+   memset (h, 0, sizeof (eop_handle));
+   eop_default_leap (h);
+
+   if ((error = cheby_store_open (name, &text)) != 0)
+      return error;
+
+/*
+   Binary store: use the image as it is.
+*/
+
+   if ((text.size >= EOP_STORE_HEADER) &&
+       (memcmp (text.base, EOP_STORE_MAGIC, 8) == 0))
+   {
+      memcpy (&version, text.base + 8, sizeof (int));
+      memcpy (&n_days, text.base + 12, sizeof (int));
+      if ((version != EOP_STORE_VERSION) || (n_days < 1) ||
+          (EOP_STORE_HEADER + (double) n_days * sizeof (eop_record) >
+           (double) text.size))
+      {
+         cheby_store_close (&text);
+         return 4;
+      }
+      h->store = text;
+      h->n_days = n_days;
+      memcpy (&h->mjd0, text.base + 16, sizeof (double));
+      h->rec = (const eop_record *) (text.base + EOP_STORE_HEADER);
+      return 0;
+   }
+
+/*
+   IERS text: build the same image in memory.
+*/
+
+   error = eop_parse (&text, h);
+   cheby_store_close (&text);
+
+   return error;
+}
+
+/********eop_close */
+
+void eop_close (eop_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases a table opened by 'eop_open'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_close  cheby_engine.c
+      memset             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   cheby_store_close (&h->store);
+   memset (h, 0, sizeof (eop_handle));
+   return;
+}
+
+/********eop_set_leap_seconds */
+
+short int eop_set_leap_seconds (eop_handle *h, short int n, double *mjd,
+                                double *tai_utc)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Replaces the leap second table of a handle, for example with one
+      read from a newer IERS Bulletin C.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      n (short int)
+         Number of entries.
+      *mjd (double)
+         Date from which each value applies (MJD, 0h UTC), ascending.
+      *tai_utc (double)
+         TAI-UTC from that date (seconds).
+
+   OUTPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table with the new leap second table.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... 'n' not between 1 and EOP_MAX_LEAP, or dates not
+               ascending; the handle is unchanged.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The handle is changed, so this must not be called while other
+         threads are using it.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   if ((n < 1) || (n > EOP_MAX_LEAP))
+      return 1;
+   for (i = 1; i < n; i++)
+      if (mjd[i] <= mjd[i - 1])
+         return 1;
+
+   for (i = 0; i < n; i++)
+   {
+      h->leap_mjd[i] = mjd[i];
+      h->leap_dat[i] = tai_utc[i];
+   }
+   h->n_leap = n;
+
+   return 0;
+}
+
+/********eop_values */
+
+short int eop_values (eop_handle *h, double jd_utc_high,
+                      double jd_utc_low,
+
+                      double *xp, double *yp, double *dut1, double *dx,
+                      double *dy)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Interpolates the Earth orientation parameters to a UTC date.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      jd_utc_high (double)
+         High-order part of UTC Julian date.
+      jd_utc_low (double)
+         Low-order part of UTC Julian date.
+
+   OUTPUT
+   ARGUMENTS:
+      *xp (double)
+         Polar motion x in arcseconds.
+      *yp (double)
+         Polar motion y in arcseconds.
+      *dut1 (double)
+         UT1-UTC in seconds.
+      *dx (double)
+         Celestial pole offset dX in milliarcseconds.
+      *dy (double)
+         Celestial pole offset dY in milliarcseconds.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 for values interpolated from observed values, otherwise the
+         sum of EOP_PREDICTED, EOP_NO_POLE, EOP_MISSING (from the days
+         used), EOP_OUTSIDE and EOP_NO_LEAP.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_dat            eop_store.c
+      floor              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The day is found by subtraction from the first date of the
+         table and the values are interpolated by a cubic through the
+         two days either side (linear in the first and last days of the
+         table).  Outside the table the values of its first or last day
+         are returned.
+      2. UT1-UTC is interpolated as UT1-TAI, so a leap second within
+         the four days does not disturb it; UTC of the date then gives
+         the step at 0h of the day after a leap second is inserted.
+
+------------------------------------------------------------------------
+*/
+{
+   short int flags = 0, before = 0, k;
+   long int i;
+   double mjd, x, p, w[4], u, v[5];
+   const eop_record *r;
+
+   mjd = (jd_utc_high - 2400000.5) + jd_utc_low;
+   x = mjd - h->mjd0;
+   if (x < 0.0)
+   {
+      x = 0.0;
+      flags |= EOP_OUTSIDE;
+   }
+   else if (x > (double) (h->n_days - 1))
+   {
+      x = (double) (h->n_days - 1);
+      flags |= EOP_OUTSIDE;
+   }
+
+   if (h->n_days < 2)
+   {
+      r = h->rec;
+      *xp = r->xp;
+      *yp = r->yp;
+      *dut1 = r->dut1;
+      *dx = r->dx;
+      *dy = r->dy;
+      eop_dat (h, h->mjd0, &before);
+      return (short int) (flags | (r->flags & 7) |
+                          (before ? EOP_NO_LEAP : 0));
+   }
+
+   i = (long int) floor (x);
+   if (i > h->n_days - 2)
+      i = h->n_days - 2;
+   p = x - (double) i;
+
+   if (p < 1.0)
+      flags |= (short int) (h->rec[i].flags & 7);
+   if (p > 0.0)
+      flags |= (short int) (h->rec[i + 1].flags & 7);
+
+/*
+   Weights of days i-1 to i+2: cubic through four days where they exist,
+   otherwise linear between days i and i+1.
+*/
+
+   if ((i >= 1) && (i + 2 < h->n_days))
+   {
+      w[0] = -p * (p - 1.0) * (p - 2.0) / 6.0;
+      w[1] = (p + 1.0) * (p - 1.0) * (p - 2.0) / 2.0;
+      w[2] = -(p + 1.0) * p * (p - 2.0) / 2.0;
+      w[3] = (p + 1.0) * p * (p - 1.0) / 6.0;
+      r = h->rec + i - 1;
+   }
+   else
+   {
+      w[0] = 1.0 - p;
+      w[1] = p;
+      w[2] = w[3] = 0.0;
+      r = h->rec + i;
+   }
+
+   v[0] = v[1] = v[2] = v[3] = v[4] = 0.0;
+   for (k = 0; k < 4; k++)
+   {
+      if (w[k] == 0.0)
+         continue;
+      u = r[k].dut1 - eop_dat (h, h->mjd0 + (double) (r - h->rec + k),
+                               &before);
+      v[0] += w[k] * r[k].xp;
+      v[1] += w[k] * r[k].yp;
+      v[2] += w[k] * u;
+      v[3] += w[k] * r[k].dx;
+      v[4] += w[k] * r[k].dy;
+   }
+
+   before = 0;
+   *xp = v[0];
+   *yp = v[1];
+   *dut1 = v[2] + eop_dat (h, h->mjd0 + x, &before);
+   *dx = v[3];
+   *dy = v[4];
+
+   if (before)
+      flags |= EOP_NO_LEAP;
+   return flags;
+}
+
+/********eop_times */
+
+short int eop_times (eop_handle *h, double jd_utc_high,
+                     double jd_utc_low,
+
+                     double *jd_ut1_low, double *delta_t)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Gives UT1 and delta T (TT-UT1) for a UTC date, in the form the
+      NOVAS functions take them.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      jd_utc_high (double)
+         High-order part of UTC Julian date.
+      jd_utc_low (double)
+         Low-order part of UTC Julian date.
+
+   OUTPUT
+   ARGUMENTS:
+      *jd_ut1_low (double)
+         Low-order part of UT1 Julian date; the high-order part is
+         'jd_utc_high'.
+      *delta_t (double)
+         TT-UT1 in seconds.
+
+   RETURNED
+   VALUE:
+      (short int)
+         As 'eop_values'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_values         eop_store.c
+      eop_dat            eop_store.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int flags, before = 0;
+   double xp, yp, dut1, dx, dy;
+
+   flags = eop_values (h, jd_utc_high, jd_utc_low, &xp, &yp, &dut1, &dx,
+                       &dy);
+
+   *jd_ut1_low = jd_utc_low + dut1 / 86400.0;
+   *delta_t = 32.184 + eop_dat (h, (jd_utc_high - 2400000.5) + jd_utc_low,
+                                &before) - dut1;
+
+   return flags;
+}
+
+/********eop_ter2cel */
+
+short int eop_ter2cel (eop_handle *h, double jd_utc_high,
+                       double jd_utc_low, short int method,
+                       short int accuracy, short int option, double *vec1,
+
+                       double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Function 'ter2cel' with polar motion, UT1, delta T and the
+      celestial pole offsets taken from an Earth orientation table.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      jd_utc_high (double)
+         High-order part of UTC Julian date.
+      jd_utc_low (double)
+         Low-order part of UTC Julian date.
+      method, accuracy, option, *vec1
+         As 'ter2cel'.
+
+   OUTPUT
+   ARGUMENTS:
+      *vec2 (double)
+         As 'ter2cel'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         As 'ter2cel'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_values         eop_store.c
+      eop_dat            eop_store.c
+      cel_pole_cor       novas.c
+      ter2cel_cor        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The pole offsets from the table are passed to 'ter2cel_cor'
+         for this call only; those set by 'cel_pole' are unchanged.
+      2. The quality of the values used is given by 'eop_values'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error, before = 0;
+   double xp, yp, dut1, dx, dy, dat, psi = 0.0, eps = 0.0;
+
+   eop_values (h, jd_utc_high, jd_utc_low, &xp, &yp, &dut1, &dx, &dy);
+   dat = eop_dat (h, (jd_utc_high - 2400000.5) + jd_utc_low, &before);
+
+   cel_pole_cor (jd_utc_high + (jd_utc_low + (32.184 + dat) / 86400.0), 2,
+                 dx, dy, &psi, &eps);
+   error = ter2cel_cor (jd_utc_high, jd_utc_low + dut1 / 86400.0,
+                        32.184 + dat - dut1, method, accuracy, option, xp,
+                        yp, psi, eps, vec1, vec2);
+
+   return error;
+}
+
+/********eop_cel2ter */
+
+short int eop_cel2ter (eop_handle *h, double jd_utc_high,
+                       double jd_utc_low, short int method,
+                       short int accuracy, short int option, double *vec1,
+
+                       double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Function 'cel2ter' with polar motion, UT1, delta T and the
+      celestial pole offsets taken from an Earth orientation table.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      jd_utc_high (double)
+         High-order part of UTC Julian date.
+      jd_utc_low (double)
+         Low-order part of UTC Julian date.
+      method, accuracy, option, *vec1
+         As 'cel2ter'.
+
+   OUTPUT
+   ARGUMENTS:
+      *vec2 (double)
+         As 'cel2ter'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         As 'cel2ter'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_values         eop_store.c
+      eop_dat            eop_store.c
+      cel_pole_cor       novas.c
+      cel2ter_cor        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. As 'eop_ter2cel'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error, before = 0;
+   double xp, yp, dut1, dx, dy, dat, psi = 0.0, eps = 0.0;
+
+   eop_values (h, jd_utc_high, jd_utc_low, &xp, &yp, &dut1, &dx, &dy);
+   dat = eop_dat (h, (jd_utc_high - 2400000.5) + jd_utc_low, &before);
+
+   cel_pole_cor (jd_utc_high + (jd_utc_low + (32.184 + dat) / 86400.0), 2,
+                 dx, dy, &psi, &eps);
+   error = cel2ter_cor (jd_utc_high, jd_utc_low + dut1 / 86400.0,
+                        32.184 + dat - dut1, method, accuracy, option, xp,
+                        yp, psi, eps, vec1, vec2);
+
+   return error;
+}
+
+/********eop_equ2hor */
+
+short int eop_equ2hor (eop_handle *h, double jd_utc, short int accuracy,
+                       on_surface *location, double ra, double dec,
+                       short int ref_option,
+
+                       double *zd, double *az, double *rar, double *decr)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Function 'equ2hor' with polar motion, UT1, delta T and the
+      celestial pole offsets taken from an Earth orientation table.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *h (struct eop_handle)
+         The table.
+      jd_utc (double)
+         UTC Julian date.
+      accuracy, *location, ra, dec, ref_option
+         As 'equ2hor'.
+
+   OUTPUT
+   ARGUMENTS:
+      *zd, *az, *rar, *decr (double)
+         As 'equ2hor'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         As 'eop_values'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eop_values         eop_store.c
+      eop_dat            eop_store.c
+      cel_pole_cor       novas.c
+      equ2hor_cor        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. As 'eop_ter2cel'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int flags, before = 0;
+   double xp, yp, dut1, dx, dy, dat, psi = 0.0, eps = 0.0;
+
+   flags = eop_values (h, jd_utc, 0.0, &xp, &yp, &dut1, &dx, &dy);
+   dat = eop_dat (h, jd_utc - 2400000.5, &before);
+
+   cel_pole_cor (jd_utc + (32.184 + dat) / 86400.0, 2, dx, dy, &psi, &eps);
+   equ2hor_cor (jd_utc + dut1 / 86400.0, 32.184 + dat - dut1, accuracy, xp,
+                yp, psi, eps, location, ra, dec, ref_option, zd, az, rar,
+                decr);
+
+   return flags;
+}
+
+/********eop_default_leap */
+
+static void eop_default_leap (eop_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Gives a handle the built-in leap second table.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   for (i = 0; i < EOP_N_LEAP; i++)
+   {
+      h->leap_mjd[i] = LEAP_MJD[i];
+      h->leap_dat[i] = LEAP_DAT[i];
+   }
+   h->n_leap = EOP_N_LEAP;
+
+   return;
+}
+
+/********eop_dat */
+
+static double eop_dat (eop_handle *h, double mjd, short int *before)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      TAI-UTC (seconds) at a UTC date (MJD).  Before the first entry of
+      the table its value is returned and '*before' is set to 1.
+
+------------------------------------------------------------------------
+*/
+{
+   short int k;
+
+   for (k = h->n_leap - 1; k >= 0; k--)
+      if (mjd >= h->leap_mjd[k])
+         return h->leap_dat[k];
+
+   *before = 1;
+   return h->leap_dat[0];
+}
+
+/********eop_parse */
+
+static short int eop_parse (cheby_store *text, eop_handle *h)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Builds the image of a binary store from the lines of an IERS file
+      and attaches it to a handle.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         3 ... Unable to allocate memory.
+         5 ... No Earth orientation values found.
+
+   NOTES:
+      1. finals2000A lines are recognised by the 'I' or 'P' flag in
+         column 17 and read by column; other lines that start with a
+         digit are read as C04.  C04 lines with the hour before the MJD
+         (EOP 20 C04) are told from those without (EOP 14 C04) by the
+         size of the fourth number.  C04 gives dX, dY in arcseconds.
+
+------------------------------------------------------------------------
+*/
+{
+   char line[256];
+   int len, flags, version = EOP_STORE_VERSION, n_days;
+   long int pos = 0, next, n = 0, cap = 0, mjd, k, j;
+   short int nt, before = 0;
+   double t[10], v, f, mjd0 = 0.0, xp, yp, ut1, dx, dy, u0, u1;
+   char *s, *e;
+   unsigned char *image = NULL, *grown;
+   eop_record *rec = NULL, *r;
+
+   while (pos < text->size)
+   {
+
+/*
+   Copy the next line.
+*/
+
+      for (next = pos; (next < text->size) && (text->base[next] != '\n');
+           next++)
+         ;
+      len = (int) (next - pos);
+      if (len > (int) sizeof (line) - 1)
+         len = (int) sizeof (line) - 1;
+      memcpy (line, text->base + pos, (size_t) len);
+      while ((len > 0) && (line[len - 1] == '\r'))
+         len--;
+      line[len] = '\0';
+      pos = next + 1;
+
+      flags = 0;
+      if ((len >= 68) && ((line[16] == 'I') || (line[16] == 'P')) &&
+          eop_field (line, len, 8, 8, &v))
+      {
+
+/*
+   finals2000A.  Days without polar motion or UT1 are the padding after
+   the predictions.
+*/
+
+         mjd = (long int) floor (v + 0.5);
+         if (!eop_field (line, len, 19, 9, &xp) ||
+             !eop_field (line, len, 38, 9, &yp) ||
+             !eop_field (line, len, 59, 10, &ut1))
+            continue;
+         if ((line[16] == 'P') || (line[57] == 'P'))
+            flags |= EOP_PREDICTED;
+         if (eop_field (line, len, 98, 9, &dx) &&
+             eop_field (line, len, 117, 9, &dy))
+         {
+            if (line[95] == 'P')
+               flags |= EOP_PREDICTED;
+         }
+         else
+         {
+            dx = dy = 0.0;
+            flags |= EOP_NO_POLE;
+         }
+      }
+      else
+      {
+
+/*
+   C04, or a line to be ignored.
+*/
+
+         for (s = line; (*s == ' ') || (*s == '\t'); s++)
+            ;
+         if ((*s < '0') || (*s > '9'))
+            continue;
+         for (nt = 0; nt < 10; nt++)
+         {
+            t[nt] = strtod (s, &e);
+            if (e == s)
+               break;
+            s = e;
+         }
+         if (nt < 10)
+            continue;
+         if (t[3] > 30000.0)
+         {
+            mjd = (long int) floor (t[3] + 0.5);
+            xp = t[4];
+            yp = t[5];
+            ut1 = t[6];
+         }
+         else if ((t[3] < 24.0) && (t[4] > 30000.0))
+         {
+            mjd = (long int) floor (t[4] + 0.5);
+            xp = t[5];
+            yp = t[6];
+            ut1 = t[7];
+         }
+         else
+            continue;
+         dx = t[8] * 1000.0;
+         dy = t[9] * 1000.0;
+      }
+
+/*
+   Make room for the day, skipping repeated or earlier days.
+*/
+
+      if (n == 0)
+         mjd0 = (double) mjd;
+      k = mjd - (long int) mjd0;
+      if ((n > 0) && (k < n))
+         continue;
+      if (k >= cap)
+      {
+         cap = (k + 1 > 2 * cap) ? k + 1024 : 2 * cap;
+         grown = (unsigned char *) realloc (image, EOP_STORE_HEADER +
+                                            (size_t) cap * sizeof (eop_record));
+         if (grown == NULL)
+         {
+            free (image);
+            return 3;
+         }
+         image = grown;
+         rec = (eop_record *) (image + EOP_STORE_HEADER);
+      }
+
+      r = rec + k;
+      r->xp = (float) xp;
+      r->yp = (float) yp;
+      r->dut1 = (float) ut1;
+      r->dx = (float) dx;
+      r->dy = (float) dy;
+      r->flags = flags;
+
+/*
+   Fill a gap linearly, taking UT1-UTC through UT1-TAI.
+*/
+
+      if (k > n)
+      {
+         u0 = rec[n - 1].dut1 - eop_dat (h, mjd0 + (double) (n - 1),
+                                         &before);
+         u1 = ut1 - eop_dat (h, (double) mjd, &before);
+         for (j = n; j < k; j++)
+         {
+            f = (double) (j - n + 1) / (double) (k - n + 1);
+            rec[j].xp = (float) (rec[n - 1].xp + f * (xp - rec[n - 1].xp));
+            rec[j].yp = (float) (rec[n - 1].yp + f * (yp - rec[n - 1].yp));
+            rec[j].dut1 = (float) (u0 + f * (u1 - u0) +
+                                   eop_dat (h, mjd0 + (double) j, &before));
+            rec[j].dx = (float) (rec[n - 1].dx + f * (dx - rec[n - 1].dx));
+            rec[j].dy = (float) (rec[n - 1].dy + f * (dy - rec[n - 1].dy));
+            rec[j].flags = EOP_MISSING |
+               ((rec[n - 1].flags | flags) & (EOP_PREDICTED | EOP_NO_POLE));
+         }
+      }
+      n = k + 1;
+   }
+
+   if (n == 0)
+   {
+      free (image);
+      return 5;
+   }
+
+/*
+   Header, as written by 'eop_convert'.
+*/
+
+   n_days = (int) n;
+   memset (image, 0, EOP_STORE_HEADER);
+   memcpy (image, EOP_STORE_MAGIC, 8);
+   memcpy (image + 8, &version, sizeof (int));
+   memcpy (image + 12, &n_days, sizeof (int));
+   memcpy (image + 16, &mjd0, sizeof (double));
+
+   h->store.base = image;
+   h->store.size = EOP_STORE_HEADER + n * (long int) sizeof (eop_record);
+   h->store.mapped = 0;
+   h->rec = rec;
+   h->n_days = n;
+   h->mjd0 = mjd0;
+
+   return 0;
+}
+
+/********eop_field */
+
+static short int eop_field (const char *line, int len, int col,
+                            int width, double *value)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Reads a number from columns 'col' to 'col'+'width'-1 (counted
+      from 1) of a line.  Returns 1 if there is a number there, 0 if
+      the field is blank or outside the line.
+
+------------------------------------------------------------------------
+*/
+{
+   char field[32], *e;
+   int i;
+
+   if ((col + width - 1 > len) || (width > (int) sizeof (field) - 1))
+      return 0;
+   memcpy (field, line + col - 1, (size_t) width);
+   field[width] = '\0';
+   for (i = 0; (i < width) && (field[i] == ' '); i++)
+      ;
+   if (i == width)
+      return 0;
+
+   *value = strtod (field, &e);
+   return (short int) (e != field);
+}
@@ -0,0 +1,153 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eop_store.h: Header file for eop_store.c, a store of IERS Earth
+               orientation parameters that supplies polar motion, UT1
+               and the celestial pole offsets to 'ter2cel', 'cel2ter'
+               and 'equ2hor'
+*/
+
+#ifndef _EOPSTORE_
+   #define _EOPSTORE_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+   #ifndef _CHEBYENGINE_
+      #include "cheby_engine.h"
+   #endif
+
+/*
+   File identifier written at the start of every binary EOP store.  IERS
+   text files start with a date or a header line, so the two kinds of
+   file cannot be confused by 'eop_open'.
+*/
+
+   #define EOP_STORE_MAGIC "NOVASEO1"
+   #define EOP_STORE_VERSION 1
+
+/*
+   EOP_STORE_HEADER   = size of the binary file header (bytes); the
+                        records follow it
+   EOP_MAX_LEAP       = largest number of leap second table entries held
+                        by a handle
+*/
+
+   #define EOP_STORE_HEADER 32
+   #define EOP_MAX_LEAP 64
+
+/*
+   Flags of a daily record, and of the status returned by 'eop_values'.
+
+   EOP_PREDICTED      = some of the values are IERS predictions
+   EOP_NO_POLE        = no celestial pole offsets (dX, dY taken as zero)
+   EOP_MISSING        = no values for the day (a gap in the source)
+   EOP_OUTSIDE        = date outside the table; values held at its end
+   EOP_NO_LEAP        = date before the leap second table (TAI-UTC taken
+                        from its first entry)
+*/
+
+   #define EOP_PREDICTED 1
+   #define EOP_NO_POLE 2
+   #define EOP_MISSING 4
+   #define EOP_OUTSIDE 8
+   #define EOP_NO_LEAP 16
+
+/*
+   struct eop_record:  Earth orientation at 0h UTC of one day.  Single
+                       precision holds the IERS values to better than
+                       their last published digit.
+
+   xp, yp             = polar motion (arcseconds)
+   dut1               = UT1-UTC (seconds)
+   dx, dy             = celestial pole offsets dX, dY with respect to
+                        IAU 2000A/2006 (milliarcseconds)
+   flags              = EOP_PREDICTED, EOP_NO_POLE, EOP_MISSING
+*/
+
+   typedef struct
+   {
+      float xp;
+      float yp;
+      float dut1;
+      float dx;
+      float dy;
+      int flags;
+   } eop_record;
+
+/*
+   struct eop_handle:  one open EOP table.  A handle is not changed by
+                       'eop_values' or the transformations, so any number
+                       of threads may use the same handle.
+
+   store              = the binary file image (memory mapped), or the
+                        records built from an IERS text file
+   rec                = the daily records
+   n_days             = number of records
+   mjd0               = date of the first record (MJD, 0h UTC)
+   n_leap             = number of leap second table entries
+   leap_mjd           = date from which each TAI-UTC value applies (MJD)
+   leap_dat           = TAI-UTC from that date (seconds)
+*/
+
+   typedef struct
+   {
+      cheby_store store;
+      const eop_record *rec;
+      long int n_days;
+      double mjd0;
+      short int n_leap;
+      double leap_mjd[EOP_MAX_LEAP];
+      double leap_dat[EOP_MAX_LEAP];
+   } eop_handle;
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int eop_convert (char *iers_name, char *store_name);
+
+   EXPORT short int eop_open (char *name,
+
+                              eop_handle *h);
+
+   EXPORT void eop_close (eop_handle *h);
+
+   EXPORT short int eop_set_leap_seconds (eop_handle *h, short int n,
+                                          double *mjd, double *tai_utc);
+
+   EXPORT short int eop_values (eop_handle *h, double jd_utc_high,
+                                double jd_utc_low,
+
+                                double *xp, double *yp, double *dut1,
+                                double *dx, double *dy);
+
+   EXPORT short int eop_times (eop_handle *h, double jd_utc_high,
+                               double jd_utc_low,
+
+                               double *jd_ut1_low, double *delta_t);
+
+   EXPORT short int eop_ter2cel (eop_handle *h, double jd_utc_high,
+                                 double jd_utc_low, short int method,
+                                 short int accuracy, short int option,
+                                 double *vec1,
+
+                                 double *vec2);
+
+   EXPORT short int eop_cel2ter (eop_handle *h, double jd_utc_high,
+                                 double jd_utc_low, short int method,
+                                 short int accuracy, short int option,
+                                 double *vec1,
+
+                                 double *vec2);
+
+   EXPORT short int eop_equ2hor (eop_handle *h, double jd_utc,
+                                 short int accuracy, on_surface *location,
+                                 double ra, double dec,
+                                 short int ref_option,
+
+                                 double *zd, double *az, double *rar,
+                                 double *decr);
+
+#endif
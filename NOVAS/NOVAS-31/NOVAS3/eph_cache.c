@@ -0,0 +1,852 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eph_cache.c: In-memory Chebyshev cache of solar system body positions
+               for function 'ephemeris'
+
+  Over a night an application asks 'ephemeris' for the same few bodies
+  (Sun, Earth, Moon, the planets used by 'grav_def') at slowly advancing
+  times.  When a cache window is started, each body requested within it
+  is refitted on first use into short Chebyshev segments, and later
+  requests are evaluated from those segments without calling the JPL or
+  minor planet software.  Segments are fitted lazily, so only the parts
+  of the window actually used cost any ephemeris reads.
+
+  The cache is shared by all threads and guarded by one lock.  A thread
+  fitting a segment holds the lock while it calls 'ephemeris' for the
+  samples; those inner calls see that the thread already holds the lock
+  and go to the underlying ephemeris.
+*/
+
+#ifndef _EPHCACHE_
+   #include "eph_cache.h"
+#endif
+
+#ifdef _WIN32
+   #include <windows.h>
+#else
+   #include <pthread.h>
+#endif
+
+/*
+   Global variables
+*/
+
+static double CACHE_START = 0.0;
+static double CACHE_DAYS = 0.0;
+static double CACHE_TOL = 0.0;
+static short int CACHE_ACTIVE = 0;
+static long int CACHE_HITS = 0;
+static long int CACHE_MISSES = 0;
+static eph_cache_body CACHE[EPH_CACHE_BODIES];
+static short int CACHE_N = 0;
+
+/*
+   The lock, with the thread holding it.  On Windows the critical section
+   is initialized by the first thread to use the cache (CACHE_INIT goes
+   from 0 to 1 while it does so, then to 2), and is kept for the life of
+   the process.
+*/
+
+#ifdef _WIN32
+   static CRITICAL_SECTION CACHE_LOCK;
+   static volatile LONG CACHE_INIT = 0;
+   static volatile DWORD CACHE_OWNER = 0;
+#else
+   static pthread_mutex_t CACHE_LOCK = PTHREAD_MUTEX_INITIALIZER;
+   static volatile pthread_t CACHE_OWNER;
+   static volatile short int CACHE_OWNED = 0;
+#endif
+
+static short int eph_cache_lock (void);
+
+static void eph_cache_unlock (void);
+
+static void eph_cache_discard (void);
+
+static eph_cache_body *eph_cache_find (object *cel_obj, short int origin,
+                                       short int accuracy);
+
+static short int eph_cache_fit (eph_cache_body *cb, object *cel_obj,
+                                double t);
+
+static void eph_cache_eval (double *c, double x, double *out);
+
+static short int eph_cache_halve (eph_cache_body *cb);
+
+static short int eph_cache_alloc (eph_cache_body *cb, long int n_seg);
+
+/********eph_cache_start */
+
+short int eph_cache_start (double jd_tdb, double hours, double tolerance)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Starts (or restarts) the ephemeris cache over a window of time.
+      While the cache is active, requests to 'ephemeris' falling within
+      the window are answered from fitted Chebyshev segments.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date of the start of the window.
+      hours (double)
+         Length of the window in hours (e.g. 24 for one night).
+      tolerance (double)
+         Largest position difference from the underlying ephemeris
+         allowed at the check points of each segment (km).  Velocities
+         are held to the same figure per day.  See note 2.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid value of 'hours' or 'tolerance'.
+
+   GLOBALS
+   USED:
+      CACHE_START, CACHE_DAYS, CACHE_TOL, CACHE_ACTIVE,
+      CACHE_HITS, CACHE_MISSES  eph_cache.c
+
+   FUNCTIONS
+   CALLED:
+      eph_cache_lock    eph_cache.c
+      eph_cache_unlock  eph_cache.c
+      eph_cache_discard eph_cache.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Any cache already held is discarded.  'ephem_open' and
+         'ephem_close' clear the cache (see 'eph_cache_clear'), so it
+         never answers from a file no longer open.
+      2. The tolerance is checked at six points of each segment, its
+         ends and four interior points between the fitting nodes.  It is
+         a sampled check, not a bound:  between the check points the
+         error of a 12-term fit to a smooth orbit is expected to be
+         smaller, but it is not tested.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((hours <= 0.0) || (tolerance <= 0.0))
+   {
+      eph_cache_stop ();
+      return 1;
+   }
+
+   eph_cache_lock ();
+   eph_cache_discard ();
+   CACHE_START = jd_tdb;
+   CACHE_DAYS = hours / 24.0;
+   CACHE_TOL = tolerance;
+   CACHE_HITS = 0;
+   CACHE_MISSES = 0;
+   CACHE_ACTIVE = 1;
+   eph_cache_unlock ();
+
+   return 0;
+}
+
+/********eph_cache_stop */
+
+void eph_cache_stop (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Stops the ephemeris cache and releases its memory.  'ephemeris'
+      then calls the underlying ephemeris software for every request.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      CACHE_ACTIVE      eph_cache.c
+
+   FUNCTIONS
+   CALLED:
+      eph_cache_lock    eph_cache.c
+      eph_cache_unlock  eph_cache.c
+      eph_cache_discard eph_cache.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   eph_cache_lock ();
+   eph_cache_discard ();
+   CACHE_ACTIVE = 0;
+   eph_cache_unlock ();
+
+   return;
+}
+
+/********eph_cache_clear */
+
+void eph_cache_clear (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Discards every fitted segment, keeping the cache window.  Bodies
+      are fitted again from the underlying ephemeris as they are next
+      requested.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      eph_cache_lock    eph_cache.c
+      eph_cache_unlock  eph_cache.c
+      eph_cache_discard eph_cache.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Called by 'ephem_open' and 'ephem_close', since the segments
+         hold positions from the file open when they were fitted.
+
+------------------------------------------------------------------------
+*/
+{
+   eph_cache_lock ();
+   eph_cache_discard ();
+   eph_cache_unlock ();
+
+   return;
+}
+
+/********eph_cache_stats */
+
+void eph_cache_stats (long int *hits, long int *misses, double *max_err)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Reports the use of the ephemeris cache since it was started.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      *hits (long int)
+         Number of requests answered from the cache.
+      *misses (long int)
+         Number of requests passed to the underlying ephemeris (outside
+         the window, table full, or body not cacheable).
+      *max_err (double)
+         Largest position difference found at any segment check point
+         over all cached bodies (km).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      CACHE, CACHE_N, CACHE_HITS, CACHE_MISSES  eph_cache.c
+
+   FUNCTIONS
+   CALLED:
+      eph_cache_lock    eph_cache.c
+      eph_cache_unlock  eph_cache.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   eph_cache_lock ();
+   *hits = CACHE_HITS;
+   *misses = CACHE_MISSES;
+   *max_err = 0.0;
+   for (i = 0; i < CACHE_N; i++)
+      if (CACHE[i].max_err > *max_err)
+         *max_err = CACHE[i].max_err;
+   eph_cache_unlock ();
+
+   return;
+}
+
+/********eph_cache_ephemeris */
+
+short int eph_cache_ephemeris (double jd[2], object *cel_obj,
+                               short int origin, short int accuracy,
+
+                               double *pos, double *vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Answers a request to 'ephemeris' from the cache, if possible.
+      Called by 'ephemeris' before it consults the underlying software.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As for function 'ephemeris'.
+
+   OUTPUT
+   ARGUMENTS:
+      pos[3] (double)
+         Position vector of the body (AU), as from 'ephemeris'.
+      vel[3] (double)
+         Velocity vector of the body (AU/day), as from 'ephemeris'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         -1 ... Not answered from the cache; 'ephemeris' must carry on.
+          0 ... Everything OK.
+         >0 ... Error code from 'ephemeris' while fitting a segment.
+
+   GLOBALS
+   USED:
+      CACHE_START, CACHE_DAYS, CACHE_ACTIVE,
+      CACHE_HITS, CACHE_MISSES  eph_cache.c
+
+   FUNCTIONS
+   CALLED:
+      eph_cache_lock    eph_cache.c
+      eph_cache_unlock  eph_cache.c
+      eph_cache_find    eph_cache.c
+      eph_cache_fit     eph_cache.c
+      eph_cache_eval    eph_cache.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Segments are fitted by calling 'ephemeris' itself, with the
+         lock held; those inner calls find the lock already held by
+         their thread and bypass the cache.  Other threads wait.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = -1;
+
+   long int seg;
+
+   double t, x, out[6];
+
+   eph_cache_body *cb;
+
+   if (!CACHE_ACTIVE)
+      return -1;
+   if ((cel_obj->type != 0) && (cel_obj->type != 1))
+      return -1;
+   if (eph_cache_lock () != 0)
+      return -1;
+   if (!CACHE_ACTIVE)
+   {
+      eph_cache_unlock ();
+      return -1;
+   }
+
+/*
+   Time from the start of the window, keeping the precision of the split
+   Julian date.
+*/
+
+   t = (jd[0] - CACHE_START) + jd[1];
+   if ((t < 0.0) || (t > CACHE_DAYS) ||
+       ((cb = eph_cache_find (cel_obj, origin, accuracy)) == NULL) ||
+       cb->disabled)
+   {
+      CACHE_MISSES++;
+      eph_cache_unlock ();
+      return -1;
+   }
+
+   seg = (long int) (t / cb->seg_len);
+   if (seg >= cb->n_seg)
+      seg = cb->n_seg - 1;
+
+   if (!cb->fitted[seg])
+   {
+      if ((error = eph_cache_fit (cb, cel_obj, t)) != 0)
+      {
+         eph_cache_unlock ();
+         return error;
+      }
+      error = -1;
+      if (cb->disabled)
+      {
+         CACHE_MISSES++;
+         eph_cache_unlock ();
+         return -1;
+      }
+      seg = (long int) (t / cb->seg_len);
+      if (seg >= cb->n_seg)
+         seg = cb->n_seg - 1;
+   }
+
+   x = 2.0 * (t - (double) seg * cb->seg_len) / cb->seg_len - 1.0;
+   eph_cache_eval (&cb->coef[seg * 6 * EPH_CACHE_NCOEF], x, out);
+   pos[0] = out[0];
+   pos[1] = out[1];
+   pos[2] = out[2];
+   vel[0] = out[3];
+   vel[1] = out[4];
+   vel[2] = out[5];
+
+   CACHE_HITS++;
+   eph_cache_unlock ();
+   return 0;
+}
+
+/********eph_cache_find */
+
+static eph_cache_body *eph_cache_find (object *cel_obj, short int origin,
+                                       short int accuracy)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Returns the cache entry for a body, creating it if there is room.
+      Returns NULL if the table is full or memory cannot be allocated.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   long int n_seg;
+
+   eph_cache_body *cb;
+
+   for (i = 0; i < CACHE_N; i++)
+   {
+      cb = &CACHE[i];
+      if ((cb->type == cel_obj->type) && (cb->number == cel_obj->number) &&
+          (cb->origin == origin) && (cb->accuracy == accuracy) &&
+          ((cb->type == 0) || (strcmp (cb->name, cel_obj->name) == 0)))
+         return cb;
+   }
+
+   if (CACHE_N == EPH_CACHE_BODIES)
+      return NULL;
+
+   cb = &CACHE[CACHE_N];
+   memset (cb, 0, sizeof (eph_cache_body));
+   cb->type = cel_obj->type;
+   cb->number = cel_obj->number;
+   strcpy_s (cb->name, SIZE_OF_OBJ_NAME, cel_obj->name);
+   cb->origin = origin;
+   cb->accuracy = accuracy;
+
+/*
+   Start with quarter-window segments, but no longer than six hours.
+*/
+
+   n_seg = (long int) ceil (CACHE_DAYS / 0.25 - 1.0e-9);
+   if (eph_cache_alloc (cb, (n_seg < 4) ? 4 : n_seg) != 0)
+      return NULL;
+
+   CACHE_N++;
+   return cb;
+}
+
+/********eph_cache_alloc */
+
+static short int eph_cache_alloc (eph_cache_body *cb, long int n_seg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Gives a body 'n_seg' empty segments across the window.  Returns 0
+      if OK or 3 if memory cannot be allocated.
+
+------------------------------------------------------------------------
+*/
+{
+   if (n_seg < 1)
+      n_seg = 1;
+   cb->n_seg = n_seg;
+   cb->seg_len = CACHE_DAYS / (double) n_seg;
+   cb->coef = (double *) calloc (n_seg * 6 * EPH_CACHE_NCOEF,
+                                 sizeof (double));
+   cb->fitted = (char *) calloc (n_seg, sizeof (char));
+   if ((cb->coef == NULL) || (cb->fitted == NULL))
+   {
+      free (cb->coef);
+      free (cb->fitted);
+      cb->coef = NULL;
+      cb->fitted = NULL;
+      cb->n_seg = 0;
+      cb->disabled = 1;
+      return 3;
+   }
+
+   return 0;
+}
+
+/********eph_cache_halve */
+
+static short int eph_cache_halve (eph_cache_body *cb)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Halves the segments of a body.  Each segment already fitted is
+      carried into its two halves:  the series of one half is the
+      interpolant of the old series at its nodes, which a polynomial of
+      the same degree reproduces exactly.  Returns 0 if OK or 3 if
+      memory cannot be allocated (the body is then disabled).
+
+------------------------------------------------------------------------
+*/
+{
+   const long int n = EPH_CACHE_NCOEF;
+
+   long int seg, h, i, j, k;
+
+   double *old_coef = cb->coef, v[EPH_CACHE_NCOEF][6], x, d, *c;
+
+   char *old_fitted = cb->fitted;
+
+   long int old_n = cb->n_seg;
+
+   if (eph_cache_alloc (cb, 2 * old_n) != 0)
+   {
+      free (old_coef);
+      free (old_fitted);
+      return 3;
+   }
+
+   for (seg = 0; seg < old_n; seg++)
+   {
+      if (!old_fitted[seg])
+         continue;
+      for (h = 0; h < 2; h++)
+      {
+         for (k = 0; k < n; k++)
+         {
+            x = cos (0.5 * TWOPI * ((double) k + 0.5) / (double) n);
+            eph_cache_eval (&old_coef[seg * 6 * n], 0.5 * (x - 1.0) +
+                            (double) h, v[k]);
+         }
+         c = &cb->coef[(2 * seg + h) * 6 * n];
+         for (i = 0; i < 6; i++)
+            for (j = 0; j < n; j++)
+            {
+               d = 0.0;
+               for (k = 0; k < n; k++)
+                  d += v[k][i] * cos (0.5 * TWOPI * (double) j *
+                                      ((double) k + 0.5) / (double) n);
+               c[i * n + j] = d * ((j == 0) ? 1.0 : 2.0) / (double) n;
+            }
+         cb->fitted[2 * seg + h] = 1;
+      }
+   }
+
+   free (old_coef);
+   free (old_fitted);
+   return 0;
+}
+
+/********eph_cache_fit */
+
+static short int eph_cache_fit (eph_cache_body *cb, object *cel_obj,
+                                double t)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Fits the segment of a body holding time 't' (days from the start
+      of the window) by interpolation at the Chebyshev nodes,
+      then checks the fit at the segment ends and at interior points
+      between the nodes.  If the check fails the segment length of the
+      body is halved (keeping its other segments) and the fit is
+      repeated; below EPH_CACHE_MIN_SEG the body is disabled.  Called
+      with the lock held.
+
+      Returns 0 if OK, or the error code from 'ephemeris'.
+
+------------------------------------------------------------------------
+*/
+{
+   const long int n = EPH_CACHE_NCOEF;
+
+   short int error = 0;
+
+   long int i, j, k, seg;
+
+   double t0, x, jd[2], pv[EPH_CACHE_NCOEF][6], out[6], tk, err, d,
+      *c, max_err;
+
+   for (;;)
+   {
+      seg = (long int) (t / cb->seg_len);
+      if (seg >= cb->n_seg)
+         seg = cb->n_seg - 1;
+      t0 = (double) seg * cb->seg_len;
+      c = &cb->coef[seg * 6 * n];
+
+/*
+   Sample the underlying ephemeris at the Chebyshev nodes.
+*/
+
+      for (k = 0; k < n; k++)
+      {
+         x = cos (0.5 * TWOPI * ((double) k + 0.5) / (double) n);
+         jd[0] = CACHE_START;
+         jd[1] = t0 + 0.5 * (x + 1.0) * cb->seg_len;
+         if ((error = ephemeris (jd, cel_obj, cb->origin, cb->accuracy,
+                                 &pv[k][0], &pv[k][3])) != 0)
+            return error;
+      }
+
+      for (i = 0; i < 6; i++)
+         for (j = 0; j < n; j++)
+         {
+            d = 0.0;
+            for (k = 0; k < n; k++)
+               d += pv[k][i] * cos (0.5 * TWOPI * (double) j *
+                                    ((double) k + 0.5) / (double) n);
+            c[i * n + j] = d * ((j == 0) ? 1.0 : 2.0) / (double) n;
+         }
+
+/*
+   Check at the extrema of T(n-1) with even index, which include both
+   ends of the segment where the interpolation error is largest.
+*/
+
+      max_err = 0.0;
+      for (k = 0; k < n; k += 2)
+      {
+         x = cos (0.5 * TWOPI * (double) k / (double) (n - 1));
+         tk = t0 + 0.5 * (x + 1.0) * cb->seg_len;
+         jd[0] = CACHE_START;
+         jd[1] = tk;
+         if ((error = ephemeris (jd, cel_obj, cb->origin, cb->accuracy,
+                                 &pv[0][0], &pv[0][3])) != 0)
+            return error;
+         eph_cache_eval (c, x, out);
+         err = 0.0;
+         for (i = 0; i < 3; i++)
+            err += (out[i] - pv[0][i]) * (out[i] - pv[0][i]);
+         err = sqrt (err) * AU_KM;
+         if (err > max_err)
+            max_err = err;
+         err = 0.0;
+         for (i = 3; i < 6; i++)
+            err += (out[i] - pv[0][i]) * (out[i] - pv[0][i]);
+         err = sqrt (err) * AU_KM;
+         if (err > max_err)
+            max_err = err;
+      }
+
+      if (max_err <= CACHE_TOL)
+         break;
+
+/*
+   Too coarse: halve the segments of this body and try again.
+*/
+
+      if (cb->seg_len * 0.5 < EPH_CACHE_MIN_SEG)
+      {
+         cb->disabled = 1;
+         return 0;
+      }
+      if (eph_cache_halve (cb) != 0)
+         return 0;
+   }
+
+   cb->fitted[seg] = 1;
+   if (max_err > cb->max_err)
+      cb->max_err = max_err;
+
+   return 0;
+}
+
+/********eph_cache_eval */
+
+static void eph_cache_eval (double *c, double x, double *out)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Evaluates the six Chebyshev series of one segment at normalized
+      time 'x' (-1 <= x <= 1) by Clenshaw's recurrence.
+
+------------------------------------------------------------------------
+*/
+{
+   const long int n = EPH_CACHE_NCOEF;
+
+   long int i, j;
+
+   double b0, b1, b2, x2 = x + x;
+
+   for (i = 0; i < 6; i++, c += n)
+   {
+      b1 = 0.0;
+      b2 = 0.0;
+      for (j = n - 1; j >= 1; j--)
+      {
+         b0 = x2 * b1 - b2 + c[j];
+         b2 = b1;
+         b1 = b0;
+      }
+      out[i] = x * b1 - b2 + c[0];
+   }
+
+   return;
+}
+
+/********eph_cache_discard */
+
+static void eph_cache_discard (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases every cached body.  Called with the lock held.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   for (i = 0; i < CACHE_N; i++)
+   {
+      free (CACHE[i].coef);
+      free (CACHE[i].fitted);
+   }
+   CACHE_N = 0;
+
+   return;
+}
+
+/********eph_cache_lock */
+
+static short int eph_cache_lock (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Takes the cache lock, waiting for another thread that holds it.
+      Returns 0 once the lock is taken, or 1 without waiting if this
+      thread already holds it (a call to 'ephemeris' from within
+      'eph_cache_fit').
+
+------------------------------------------------------------------------
+*/
+{
+#ifdef _WIN32
+   if (CACHE_INIT != 2)
+   {
+      if (InterlockedCompareExchange (&CACHE_INIT, 1, 0) == 0)
+      {
+         InitializeCriticalSection (&CACHE_LOCK);
+         InterlockedExchange (&CACHE_INIT, 2);
+      }
+      else
+      {
+         while (CACHE_INIT != 2)
+            Sleep (1);
+      }
+   }
+   if (CACHE_OWNER == GetCurrentThreadId ())
+      return 1;
+   EnterCriticalSection (&CACHE_LOCK);
+   CACHE_OWNER = GetCurrentThreadId ();
+#else
+   if (CACHE_OWNED && pthread_equal (CACHE_OWNER, pthread_self ()))
+      return 1;
+   pthread_mutex_lock (&CACHE_LOCK);
+   CACHE_OWNER = pthread_self ();
+   CACHE_OWNED = 1;
+#endif
+
+   return 0;
+}
+
+/********eph_cache_unlock */
+
+static void eph_cache_unlock (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases the cache lock taken by 'eph_cache_lock'.
+
+------------------------------------------------------------------------
+*/
+{
+#ifdef _WIN32
+   CACHE_OWNER = 0;
+   LeaveCriticalSection (&CACHE_LOCK);
+#else
+   CACHE_OWNED = 0;
+   pthread_mutex_unlock (&CACHE_LOCK);
+#endif
+
+   return;
+}
@@ -0,0 +1,80 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eph_cache.h: Header file for eph_cache.c, an in-memory Chebyshev cache
+               of solar system body positions for function 'ephemeris'
+*/
+
+#ifndef _EPHCACHE_
+   #define _EPHCACHE_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+/*
+   EPH_CACHE_NCOEF    = number of Chebyshev coefficients per segment and
+                        component
+   EPH_CACHE_BODIES   = maximum number of distinct bodies (object, origin
+                        and accuracy combinations) held at one time
+   EPH_CACHE_MIN_SEG  = shortest segment tried before a body is declared
+                        unsuitable for caching (days)
+*/
+
+   #define EPH_CACHE_NCOEF 12
+   #define EPH_CACHE_BODIES 16
+   #define EPH_CACHE_MIN_SEG (1.0 / 1440.0)
+
+/*
+   struct eph_cache_body:  cached ephemeris of one body
+
+   type, number, name = body designation, as in struct 'object'
+   origin             = origin code passed to 'ephemeris'
+   accuracy           = accuracy code passed to 'ephemeris'
+   n_seg              = number of segments across the cache window
+   seg_len            = segment length (days)
+   max_err            = largest position difference found at the check
+                        points of the fitted segments (km); a sampled
+                        figure, not a bound between the check points
+   coef               = coefficients, EPH_CACHE_NCOEF per component,
+                        6 components (position, velocity) per segment
+   fitted             = flag per segment; 1 once its coefficients are set
+   disabled           = 1 if the body could not be fitted to tolerance
+*/
+
+   typedef struct
+   {
+      short int type;
+      short int number;
+      char name[SIZE_OF_OBJ_NAME];
+      short int origin;
+      short int accuracy;
+      long int n_seg;
+      double seg_len;
+      double max_err;
+      double *coef;
+      char *fitted;
+      short int disabled;
+   } eph_cache_body;
+
+/*
+   Function prototypes.  The cache is shared by all threads; every
+   function takes its lock.
+*/
+
+   EXPORT short int eph_cache_start (double jd_tdb, double hours,
+                                     double tolerance);
+
+   EXPORT void eph_cache_stop (void);
+
+   EXPORT void eph_cache_clear (void);
+
+   EXPORT void eph_cache_stats (long int *hits, long int *misses,
+                                double *max_err);
+
+   short int eph_cache_ephemeris (double jd[2], object *cel_obj,
+                                  short int origin, short int accuracy,
+
+                                  double *pos, double *vel);
+
+#endif
@@ -0,0 +1,808 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eph_compact.c: Compact form of the JPL planetary ephemerides for use
+                 with eph_manager.c
+
+  A compact ephemeris file holds a subset of the bodies of a JPL
+  direct-access file over a chosen span of dates.  For each body the
+  Chebyshev series are truncated to the lowest order that meets an
+  accuracy target (expressed as an angle seen from the Earth), and the
+  higher-order coefficients are stored in single precision whenever the
+  rounding stays within the same target.  The constant term of every
+  series is always kept in double precision.
+
+  The file is loaded into memory in one read by 'ephem_open', after which
+  'state' is served without any further file access.
+*/
+
+#ifndef _EPHCOMPACT_
+   #include "eph_compact.h"
+#endif
+
+#ifndef _EPHMAN_
+   #include "eph_manager.h"
+#endif
+
+#ifndef _CONSTS_
+   #include "novascon.h"
+#endif
+
+#ifndef _CHEBYENGINE_
+   #include "cheby_engine.h"
+#endif
+
+#include <string.h>
+
+/*
+   Global variables
+*/
+
+compact_ephemeris *CEPH = NULL;
+
+/*
+   Minimum distance from the Earth of each 'state' body, in AU (the
+   geocentric Moon in km).  Used to turn the angular accuracy target into
+   a position tolerance.  The Earth-Moon barycenter is bounded by the
+   closest approach of Venus, since an error in it displaces the
+   geocentric direction of every body except the Moon.
+*/
+
+static const double MIN_DIST[11] = {0.52, 0.26, 0.26, 0.37, 3.90, 7.90,
+                                    17.20, 28.70, 28.60, 356000.0, 0.98};
+
+#define COMPACT_HEADER_SIZE 72L
+#define COMPACT_BODY_SIZE   24L
+
+static long int compact_set_size (int n_coef, int coef_size);
+
+/********ephem_compact_convert */
+
+short int ephem_compact_convert (char *de_name, char *compact_name,
+                                 long int body_mask, double accuracy,
+                                 double jd_begin, double jd_end)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function writes a compact ephemeris file from a JPL
+      direct-access ephemeris file.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *de_name (char)
+         Name of the JPL direct-access ephemeris file.
+      *compact_name (char)
+         Name of the compact ephemeris file to be written.
+      body_mask (long int)
+         Bodies to include; a combination of COMPACT_EPH_BODY(target)
+         values, where 'target' is numbered as in function 'state'.
+      accuracy (double)
+         Accuracy target in arcseconds, as seen from the Earth at the
+         closest approach of each body.  Zero or less keeps the full
+         JPL series in double precision.
+      jd_begin (double)
+         First Julian date (TDB) required.  Zero selects the start of
+         the JPL file.
+      jd_end (double)
+         Last Julian date (TDB) required.  Zero selects the end of the
+         JPL file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0   ...everything OK.
+          1   ...no valid body selected in 'body_mask'.
+          2   ...requested dates not covered by the JPL file.
+          3   ...error reading the JPL file (or it is itself a compact
+                 file).
+          4   ...unable to create or write the compact file.
+          5   ...insufficient memory.
+         >10  ...error from function 'ephem_open' + 10.
+
+   GLOBALS
+   USED:
+      SS                eph_manager.h
+      JPLAU             eph_manager.h
+      EM_RATIO          eph_manager.h
+      IPT               eph_manager.h
+      BUFFER            eph_manager.h
+      RECORD_LENGTH     eph_manager.h
+      EPHFILE           eph_manager.h
+      ASEC2RAD          novascon.h
+      AU_KM             novascon.h
+
+   FUNCTIONS
+   CALLED:
+      ephem_open        eph_manager.h
+      ephem_close       eph_manager.h
+      fopen_s           stdio.h
+      fseek             stdio.h
+      fread             stdio.h
+      fwrite            stdio.h
+      fclose            stdio.h
+      calloc            stdlib.h
+      free              stdlib.h
+      fabs              math.h
+      sqrt              math.h
+      floor             math.h
+      ceil              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The JPL file is opened through 'ephem_open' and is closed again
+         on return, so any ephemeris previously opened by the caller must
+         be reopened afterwards.
+      2. The error bound stored for each body is the sum of the largest
+         neglected Chebyshev terms and the largest single-precision
+         rounding of any one component over the whole span, times
+         sqrt(3), and so is a strict bound on the length of the position
+         difference from the JPL file.
+      3. Velocities are not bounded separately; they follow from the
+         same truncated series.
+
+------------------------------------------------------------------------
+*/
+{
+   static const char magic[] = COMPACT_EPH_MAGIC;
+
+   short int error, de_number;
+
+   int t, n, j, i, s, version = COMPACT_EPH_VERSION, n_bodies = 0;
+   int denum, n_blocks, target[11], n_coef[11], coef_size[11];
+
+   long int b, b0, b1, ncf, na, base;
+
+   double jd_first, jd_last, ss[3], tol, sum, round_err;
+   double err_bound[11], *tail, *rnd;
+
+   float f;
+
+   FILE *out = NULL;
+
+/*
+   Open the JPL file and settle the span, rounded outward to whole
+   ephemeris blocks.
+*/
+
+   if ((error = ephem_open (de_name, &jd_first, &jd_last, &de_number)) != 0)
+      return (short int) (error + 10);
+   if (CEPH != NULL)
+   {
+      ephem_close ();
+      return 3;
+   }
+
+   for (t = 0; t < 11; t++)
+      if (body_mask & COMPACT_EPH_BODY (t))
+         target[n_bodies++] = t;
+   if (n_bodies == 0)
+   {
+      ephem_close ();
+      return 1;
+   }
+
+   if (jd_begin == 0.0)
+      jd_begin = SS[0];
+   if (jd_end == 0.0)
+      jd_end = SS[1];
+   if ((jd_begin < SS[0]) || (jd_end > SS[1]) || (jd_end <= jd_begin))
+   {
+      ephem_close ();
+      return 2;
+   }
+
+   b0 = (long int) floor ((jd_begin - SS[0]) / SS[2]);
+   b1 = (long int) ceil ((jd_end - SS[0]) / SS[2]);
+   n_blocks = (int) (b1 - b0);
+   ss[0] = SS[0] + (double) b0 * SS[2];
+   ss[1] = SS[0] + (double) b1 * SS[2];
+   ss[2] = SS[2];
+
+   tail = (double *) calloc (11 * 18, sizeof (double));
+   rnd = (double *) calloc (11 * 18, sizeof (double));
+   if ((tail == NULL) || (rnd == NULL))
+   {
+      free (tail);
+      free (rnd);
+      ephem_close ();
+      return 5;
+   }
+
+/*
+   First pass: for every body find, over the whole span, the largest sum
+   of neglected terms for each possible truncation order and the largest
+   single-precision rounding of the retained terms.
+*/
+
+   for (b = b0; b < b1; b++)
+   {
+      fseek (EPHFILE, (b + 2) * RECORD_LENGTH, SEEK_SET);
+      if (!fread (BUFFER, RECORD_LENGTH, 1, EPHFILE))
+      {
+         free (tail);
+         free (rnd);
+         ephem_close ();
+         return 3;
+      }
+
+      for (n = 0; n < n_bodies; n++)
+      {
+         t = target[n];
+         ncf = IPT[1][t];
+         na = IPT[2][t];
+         for (s = 0; s < na * 3; s++)
+         {
+            base = IPT[0][t] - 1 + s * ncf;
+            sum = 0.0;
+            for (j = (int) ncf - 1; j >= 1; j--)
+            {
+               sum += fabs (BUFFER[base + j]);
+               if (sum > tail[t * 18 + j])
+                  tail[t * 18 + j] = sum;
+            }
+            sum = 0.0;
+            for (j = 1; j < ncf; j++)
+            {
+               f = (float) BUFFER[base + j];
+               sum += fabs (BUFFER[base + j] - (double) f);
+               if (sum > rnd[t * 18 + j])
+                  rnd[t * 18 + j] = sum;
+            }
+         }
+      }
+   }
+
+/*
+   Choose the order and coefficient size of each body.  At least two
+   terms are kept so that a velocity is always available.
+*/
+
+   for (n = 0; n < n_bodies; n++)
+   {
+      t = target[n];
+      ncf = IPT[1][t];
+      n_coef[t] = (int) ncf;
+      coef_size[t] = 8;
+      err_bound[t] = 0.0;
+      if (accuracy <= 0.0)
+         continue;
+
+      tol = accuracy * ASEC2RAD * MIN_DIST[t] * ((t == 9) ? 1.0 : AU_KM) /
+         sqrt (3.0);
+      for (j = 2; j < ncf; j++)
+         if (tail[t * 18 + j] <= 0.5 * tol)
+            break;
+      n_coef[t] = j;
+      err_bound[t] = (j < ncf) ? tail[t * 18 + j] : 0.0;
+      round_err = rnd[t * 18 + j - 1];
+      if (err_bound[t] + round_err <= tol)
+      {
+         coef_size[t] = 4;
+         err_bound[t] += round_err;
+      }
+      err_bound[t] *= sqrt (3.0);
+   }
+   free (tail);
+   free (rnd);
+
+/*
+   Write the header and body table.
+*/
+
+   if (fopen_s (&out, compact_name, "wb") != 0)
+   {
+      ephem_close ();
+      return 4;
+   }
+
+   denum = (int) de_number;
+   fwrite (magic, 8, 1, out);
+   fwrite (&version, sizeof (int), 1, out);
+   fwrite (&denum, sizeof (int), 1, out);
+   fwrite (&n_bodies, sizeof (int), 1, out);
+   fwrite (&n_blocks, sizeof (int), 1, out);
+   fwrite (ss, sizeof (double), 3, out);
+   fwrite (&JPLAU, sizeof (double), 1, out);
+   fwrite (&EM_RATIO, sizeof (double), 1, out);
+   fwrite (&accuracy, sizeof (double), 1, out);
+
+   for (n = 0; n < n_bodies; n++)
+   {
+      t = target[n];
+      na = IPT[2][t];
+      i = (int) IPT[2][t];
+      fwrite (&t, sizeof (int), 1, out);
+      fwrite (&i, sizeof (int), 1, out);
+      fwrite (&n_coef[t], sizeof (int), 1, out);
+      fwrite (&coef_size[t], sizeof (int), 1, out);
+      fwrite (&err_bound[t], sizeof (double), 1, out);
+   }
+
+/*
+   Second pass: write the coefficients, body by body, block by block.
+*/
+
+   for (n = 0; n < n_bodies; n++)
+   {
+      t = target[n];
+      ncf = IPT[1][t];
+      na = IPT[2][t];
+      for (b = b0; b < b1; b++)
+      {
+         fseek (EPHFILE, (b + 2) * RECORD_LENGTH, SEEK_SET);
+         if (!fread (BUFFER, RECORD_LENGTH, 1, EPHFILE))
+         {
+            fclose (out);
+            ephem_close ();
+            return 3;
+         }
+         for (s = 0; s < na * 3; s++)
+         {
+            base = IPT[0][t] - 1 + s * ncf;
+            fwrite (&BUFFER[base], sizeof (double), 1, out);
+            for (i = 1; i < n_coef[t]; i++)
+            {
+               if (coef_size[t] == 4)
+               {
+                  f = (float) BUFFER[base + i];
+                  fwrite (&f, sizeof (float), 1, out);
+               }
+               else
+                  fwrite (&BUFFER[base + i], sizeof (double), 1, out);
+            }
+         }
+      }
+   }
+
+   error = (short int) ((ferror (out) != 0) | (fclose (out) != 0));
+   ephem_close ();
+
+   return (short int) (error ? 4 : 0);
+}
+
+/********compact_ephem_open */
+
+short int compact_ephem_open (char *ephem_name,
+
+                              double *jd_begin, double *jd_end,
+                              short int *de_number)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function loads a compact ephemeris file into memory if
+      'ephem_name' is one.  It is called by 'ephem_open'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *ephem_name (char)
+         Name of the ephemeris file.
+
+   OUTPUT
+   ARGUMENTS:
+      *jd_begin (double)
+         Beginning Julian date of the compact file.
+      *jd_end (double)
+         Ending Julian date of the compact file.
+      *de_number (short int)
+         DE number of the JPL file the compact file was made from.
+
+   RETURNED
+   VALUE:
+      (short int)
+         -1  ...file is not a compact ephemeris file (or not found).
+          0  ...file loaded correctly.
+          2  ...file is truncated or its header is invalid.
+         12  ...insufficient memory to load the file.
+
+   GLOBALS
+   USED:
+      CEPH              eph_compact.h
+      KM                eph_manager.h
+      SS                eph_manager.h
+      JPLAU             eph_manager.h
+      EM_RATIO          eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      compact_ephem_close  eph_compact.h
+      compact_set_size     eph_compact.c
+      fopen_s           stdio.h
+      fread             stdio.h
+      fseek             stdio.h
+      ftell             stdio.h
+      fclose            stdio.h
+      calloc            stdlib.h
+      memcmp            string.h
+      memcpy            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Any compact file already loaded is released first.
+
+------------------------------------------------------------------------
+*/
+{
+   char magic[8];
+
+   int i, n, version, header[4];
+
+   long int size, offset, n_blocks;
+
+   unsigned char *p;
+
+   compact_ephemeris *ce;
+
+   FILE *fp = NULL;
+
+   compact_ephem_close ();
+
+   if (fopen_s (&fp, ephem_name, "rb") != 0)
+      return -1;
+   if ((fread (magic, 8, 1, fp) != 1) ||
+       (memcmp (magic, COMPACT_EPH_MAGIC, 8) != 0))
+   {
+      fclose (fp);
+      return -1;
+   }
+
+/*
+   Read the whole file in one go.
+*/
+
+   fseek (fp, 0L, SEEK_END);
+   size = ftell (fp);
+   fseek (fp, 0L, SEEK_SET);
+   if (size < COMPACT_HEADER_SIZE)
+   {
+      fclose (fp);
+      return 2;
+   }
+
+   ce = (compact_ephemeris *) calloc (1, sizeof (compact_ephemeris));
+   if (ce == NULL)
+   {
+      fclose (fp);
+      return 12;
+   }
+   ce->image = (unsigned char *) malloc ((size_t) size);
+   if (ce->image == NULL)
+   {
+      free (ce);
+      fclose (fp);
+      return 12;
+   }
+   n = (int) fread (ce->image, (size_t) size, 1, fp);
+   fclose (fp);
+   CEPH = ce;
+   if (n != 1)
+   {
+      compact_ephem_close ();
+      return 2;
+   }
+
+/*
+   Decode the header and body table.
+*/
+
+   p = ce->image + 8;
+   memcpy (header, p, sizeof header);
+   p += sizeof header;
+   version = header[0];
+   ce->de_number = header[1];
+   ce->n_bodies = header[2];
+   n_blocks = header[3];
+   memcpy (ce->ss, p, 3 * sizeof (double));
+   memcpy (&ce->au, p + 24, sizeof (double));
+   memcpy (&ce->em_ratio, p + 32, sizeof (double));
+   memcpy (&ce->accuracy, p + 40, sizeof (double));
+
+   if ((version != COMPACT_EPH_VERSION) || (ce->n_bodies < 1) ||
+       (ce->n_bodies > 11) || (n_blocks < 1) ||
+       (size < COMPACT_HEADER_SIZE + ce->n_bodies * COMPACT_BODY_SIZE))
+   {
+      compact_ephem_close ();
+      return 2;
+   }
+
+   ce->body = (compact_body *) calloc (ce->n_bodies, sizeof (compact_body));
+   if (ce->body == NULL)
+   {
+      compact_ephem_close ();
+      return 12;
+   }
+
+   for (i = 0; i < 11; i++)
+      ce->index[i] = -1;
+
+   p = ce->image + COMPACT_HEADER_SIZE;
+   offset = COMPACT_HEADER_SIZE + ce->n_bodies * COMPACT_BODY_SIZE;
+   for (i = 0; i < ce->n_bodies; i++, p += COMPACT_BODY_SIZE)
+   {
+      memcpy (header, p, sizeof header);
+      ce->body[i].target = header[0];
+      ce->body[i].n_sub = header[1];
+      ce->body[i].n_coef = header[2];
+      ce->body[i].coef_size = header[3];
+      memcpy (&ce->body[i].err_bound, p + 16, sizeof (double));
+      if ((header[0] < 0) || (header[0] > 10) || (header[1] < 1) ||
+          (header[2] < 2) || (header[2] > 18) ||
+          ((header[3] != 4) && (header[3] != 8)))
+      {
+         compact_ephem_close ();
+         return 2;
+      }
+      ce->index[header[0]] = i;
+      ce->body[i].data = ce->image + offset;
+      offset += n_blocks * header[1] * 3 *
+         compact_set_size (header[2], header[3]);
+   }
+   if (offset > size)
+   {
+      compact_ephem_close ();
+      return 2;
+   }
+
+/*
+   Publish the constants used by 'planet_ephemeris' and 'state'.
+*/
+
+   KM = 0;
+   for (i = 0; i < 3; i++)
+      SS[i] = ce->ss[i];
+   JPLAU = ce->au;
+   EM_RATIO = ce->em_ratio;
+
+   *jd_begin = ce->ss[0];
+   *jd_end = ce->ss[1];
+   *de_number = (short int) ce->de_number;
+
+   return 0;
+}
+
+/********compact_ephem_close */
+
+void compact_ephem_close (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function releases a compact ephemeris file loaded by
+      'compact_ephem_open'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      CEPH              eph_compact.h
+
+   FUNCTIONS
+   CALLED:
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   if (CEPH)
+   {
+      free (CEPH->body);
+      free (CEPH->image);
+      free (CEPH);
+      CEPH = NULL;
+   }
+   return;
+}
+
+/********compact_state */
+
+short int compact_state (double *jed, short int target,
+
+                         double *target_pos, double *target_vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function interpolates the compact ephemeris held in memory.
+      It is the counterpart of 'state' for compact files and has the
+      same arguments.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *jed (double)
+         2-element Julian date (TDB) at which interpolation is wanted.
+      target (short int)
+         The requested body, numbered as in function 'state'.
+
+   OUTPUT
+   ARGUMENTS:
+      *target_pos (double)
+         The barycentric position vector of the requested object, in AU
+         (km if KM is set).  The Moon is geocentric.
+      *target_vel (double)
+         The barycentric velocity vector of the requested object, in
+         AU/day (km/s if KM is set).
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         2...epoch out of range.
+         3...body not held in the compact file.
+
+   GLOBALS
+   USED:
+      CEPH              eph_compact.h
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      split             eph_manager.h
+      compact_set_size  eph_compact.c
+      cheby_eval        cheby_engine.c
+      memcpy            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. No global state is changed, so calls from several threads do
+         not interfere.
+
+------------------------------------------------------------------------
+*/
+{
+   int i, j, ncf;
+
+   long int b, l, n_blocks, set_size;
+
+   double jd[4], s, t0, t1, aufac = 1.0, dna, dt1, temp, tc, vfac;
+   double coef[3 * 18];
+
+   float f;
+
+   unsigned char *p;
+
+   compact_body *cb;
+
+   if ((target < 0) || (target > 10) || (CEPH->index[target] < 0))
+      return 3;
+   cb = &CEPH->body[CEPH->index[target]];
+   ncf = cb->n_coef;
+   set_size = compact_set_size (ncf, cb->coef_size);
+
+/*
+   Check epoch, exactly as 'state' does.
+*/
+
+   s = jed[0] - 0.5;
+   split (s, &jd[0]);
+   split (jed[1], &jd[2]);
+   jd[0] += jd[2] + 0.5;
+   jd[1] += jd[3];
+   split (jd[1], &jd[2]);
+   jd[0] += jd[2];
+
+   if ((jd[0] < CEPH->ss[0]) || ((jd[0] + jd[3]) > CEPH->ss[1]))
+      return 2;
+
+   n_blocks = (long int) ((CEPH->ss[1] - CEPH->ss[0]) / CEPH->ss[2] + 0.5);
+   b = (long int) ((jd[0] - CEPH->ss[0]) / CEPH->ss[2]);
+   if (b >= n_blocks)
+      b = n_blocks - 1;
+   t0 = ((jd[0] - ((double) b * CEPH->ss[2] + CEPH->ss[0])) + jd[3]) /
+      CEPH->ss[2];
+
+   if (KM)
+      t1 = CEPH->ss[2] * 86400.0;
+   else
+   {
+      t1 = CEPH->ss[2];
+      aufac = 1.0 / CEPH->au;
+   }
+
+/*
+   Sub-interval and normalized Chebyshev time, as in 'interpolate'.
+*/
+
+   dna = (double) cb->n_sub;
+   dt1 = (double) ((long int) t0);
+   temp = dna * t0;
+   l = (long int) (temp - dt1);
+   if (l >= cb->n_sub)
+      l = cb->n_sub - 1;
+   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+   vfac = (2.0 * dna) / t1;
+
+/*
+   Unpack the coefficients of this sub-interval and evaluate them.
+*/
+
+   p = cb->data + ((b * cb->n_sub + l) * 3) * set_size;
+   for (i = 0; i < 3; i++, p += set_size)
+   {
+      memcpy (&coef[i * ncf], p, sizeof (double));
+      for (j = 1; j < ncf; j++)
+      {
+         if (cb->coef_size == 4)
+         {
+            memcpy (&f, p + 8 + (j - 1) * 4, sizeof (float));
+            coef[i * ncf + j] = (double) f;
+         }
+         else
+            memcpy (&coef[i * ncf + j], p + 8 + (j - 1) * 8,
+                    sizeof (double));
+      }
+   }
+
+   cheby_eval (coef, ncf, 3L, tc, target_pos, target_vel);
+
+   for (i = 0; i < 3; i++)
+   {
+      target_pos[i] *= aufac;
+      target_vel[i] *= vfac * aufac;
+   }
+
+   return 0;
+}
+
+/********compact_set_size */
+
+static long int compact_set_size (int n_coef, int coef_size)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Returns the number of bytes used by one component of one
+      sub-interval in the coefficient stream of a compact file.
+
+   NOTES:
+      1. The constant term is always held as a double.
+
+------------------------------------------------------------------------
+*/
+{
+   return 8L + (long int) (n_coef - 1) * coef_size;
+}
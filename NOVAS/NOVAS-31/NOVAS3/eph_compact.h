@@ -0,0 +1,121 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  eph_compact.h: Header file for eph_compact.c, the compact
+                 single-precision-residual form of the JPL planetary
+                 ephemerides read by eph_manager.c
+*/
+
+#ifndef _EPHCOMPACT_
+   #define _EPHCOMPACT_
+
+   #ifndef __ASCOM__
+      #include "ascom.h"
+   #endif
+
+   #ifndef __STDIO__
+      #include <stdio.h>
+   #endif
+
+/*
+   File identifier written at the start of every compact ephemeris file.
+   A JPL direct-access file starts with its title record, so the two
+   formats cannot be confused by 'ephem_open'.
+*/
+
+   #define COMPACT_EPH_MAGIC "NOVASCE1"
+   #define COMPACT_EPH_VERSION 1
+
+/*
+   Body selection mask for 'ephem_compact_convert'.  Bits are numbered
+   as the 'target' argument of function 'state' (0 = Mercury, ...,
+   2 = Earth-Moon barycenter, ..., 9 = geocentric Moon, 10 = Sun).
+*/
+
+   #define COMPACT_EPH_BODY(target) (1L << (target))
+   #define COMPACT_EPH_SUN_EARTH_MOON (COMPACT_EPH_BODY(2) | \
+                                       COMPACT_EPH_BODY(9) | \
+                                       COMPACT_EPH_BODY(10))
+
+/*
+   struct compact_body:  description of one body held in a compact
+                         ephemeris file
+
+   target             = body number as used by function 'state'
+   n_sub              = number of sub-intervals per ephemeris block
+   n_coef             = number of Chebyshev coefficients retained per
+                        component (truncated from the JPL order)
+   coef_size          = storage size of coefficients 1..n_coef-1;
+                        4 = float residuals, 8 = full double
+   err_bound          = bound on the position error of this body with
+                        respect to the source JPL file (km)
+   data               = coefficient stream for this body
+*/
+
+   typedef struct
+   {
+      int target;
+      int n_sub;
+      int n_coef;
+      int coef_size;
+      double err_bound;
+      unsigned char *data;
+   } compact_body;
+
+/*
+   struct compact_ephemeris:  a compact ephemeris file resident in memory
+
+   de_number          = DE number of the source JPL file
+   n_bodies           = number of bodies in 'body'
+   ss[3]              = first JD, last JD and block length (days)
+   au                 = number of km per AU
+   em_ratio           = Earth/Moon mass ratio
+   accuracy           = accuracy target used for the conversion
+                        (arcseconds, as seen from the Earth)
+   index[11]          = index into 'body' for each 'state' target, or -1
+   body               = array of 'n_bodies' body descriptions
+   image              = the file contents
+*/
+
+   typedef struct
+   {
+      int de_number;
+      int n_bodies;
+      double ss[3];
+      double au;
+      double em_ratio;
+      double accuracy;
+      int index[11];
+      compact_body *body;
+      unsigned char *image;
+   } compact_ephemeris;
+
+/*
+   External variables
+*/
+
+   extern compact_ephemeris *CEPH;
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int ephem_compact_convert (char *de_name,
+                                           char *compact_name,
+                                           long int body_mask,
+                                           double accuracy,
+                                           double jd_begin,
+                                           double jd_end);
+
+   short int compact_ephem_open (char *ephem_name,
+
+                                 double *jd_begin, double *jd_end,
+                                 short int *de_number);
+
+   void compact_ephem_close (void);
+
+   short int compact_state (double *jed, short int target,
+
+                            double *target_pos, double *target_vel);
+
+#endif
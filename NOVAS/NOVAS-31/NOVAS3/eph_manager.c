@@ -14,6 +14,18 @@
 #include "eph_manager.h"
 #endif
 
+#ifndef _EPHCOMPACT_
+#include "eph_compact.h" //ASCOM - compact ephemeris support
+#endif
+
+#ifndef _CHEBYENGINE_
+#include "cheby_engine.h" //ASCOM - shared Chebyshev engine
+#endif
+
+#ifndef _EPHCACHE_
+#include "eph_cache.h" //ASCOM - cleared whenever the ephemeris file changes
+#endif
+
 /*
    Define global variables
 */
@@ -34,6 +46,13 @@ double *BUFFER;
 
 FILE *EPHFILE = NULL;
 
+/*
+   ASCOM - The JPL file is also mapped into memory through cheby_engine.c;
+   'state' reads its records from there rather than through EPHFILE.
+*/
+
+cheby_handle JPL_HANDLE;
+
 /********ephem_open */
 
 short int ephem_open(char *ephem_name,
@@ -74,6 +93,7 @@ short int ephem_open(char *ephem_name,
 			  2-10...error reading from file header.
 			  11  ...unable to set record length; ephemeris (DE number)
 					 not in look-up table.
+			  12  ...insufficient memory to load a compact ephemeris file.
 
 	   GLOBALS
 	   USED:
@@ -132,12 +152,25 @@ short int ephem_open(char *ephem_name,
 
 	int ncon, denum;
 
+	eph_cache_clear(); //ASCOM - cached positions came from the previous file
+
 	if (EPHFILE)
 	{
 		fclose(EPHFILE);
+		EPHFILE = NULL; //ASCOM - reset so that a compact file is not mistaken for an open JPL file
 		free(BUFFER);
+		cheby_close(&JPL_HANDLE); //ASCOM - release the previous file's mapping
 	}
 
+	/*
+	   ASCOM - A compact ephemeris file (see eph_compact.c) is recognised by
+	   its header and loaded into memory; otherwise carry on as before.
+	*/
+
+	i = compact_ephem_open(ephem_name, jd_begin, jd_end, de_number);
+	if (i != -1)
+		return i;
+
 	/*
 	   Open file ephem_name.
 	*/
@@ -256,6 +289,16 @@ short int ephem_open(char *ephem_name,
 
 		BUFFER = (double *)calloc(RECORD_LENGTH / 8, sizeof(double));
 
+		/*
+		   ASCOM - Map the data records.  If the file cannot be mapped, 'state'
+		   reads records through EPHFILE as before.
+		*/
+
+		if (cheby_open_uniform(ephem_name, SS[0], SS[2],
+			(long int)((SS[1] - SS[0]) / SS[2] + 0.5), 2L * RECORD_LENGTH,
+			RECORD_LENGTH, &JPL_HANDLE) != 0)
+			cheby_close(&JPL_HANDLE);
+
 		*de_number = (short int)denum;
 		*jd_begin = SS[0];
 		*jd_end = SS[1];
@@ -327,6 +370,9 @@ short int ephem_close(void)
 		EPHFILE = NULL; // new line, reset pointer 
 		free(BUFFER);
 	}
+	compact_ephem_close(); //ASCOM - release any compact ephemeris file
+	cheby_close(&JPL_HANDLE); //ASCOM - release the mapped JPL file
+	eph_cache_clear(); //ASCOM - cached positions came from the closed file
 	return error;
 }
 
@@ -667,6 +713,7 @@ short int state(double *jed, short int target,
 			 0...everything OK.
 			 1...error reading ephemeris file.
 			 2...epoch out of range.
+			 3...body not held in a compact ephemeris file.
 
 	   GLOBALS
 	   USED:
@@ -686,6 +733,8 @@ short int state(double *jed, short int target,
 		  fread             stdio.h
 		  interpolate       eph_manager.h
 		  ephem_close       eph_manager.h
+		  cheby_find        cheby_engine.c
+		  cheby_segment     cheby_engine.c
 
 	   VER./DATE/
 	   PROGRAMMER:
@@ -715,7 +764,14 @@ short int state(double *jed, short int target,
 
 	long int nr, rec;
 
-	double t[2], aufac = 1.0, jd[4], s;
+	double t[2], aufac = 1.0, jd[4], s, *buf;
+
+	/*
+	   ASCOM - Compact ephemeris files are interpolated from memory.
+	*/
+
+	if (CEPH)
+		return compact_state(jed, target, target_pos, target_vel);
 
 	/*
 	   Set units based on value of the 'KM' flag.
@@ -730,54 +786,70 @@ short int state(double *jed, short int target,
 	}
 
 	/*
-	   Check epoch.
+	   ASCOM - Find the record in the mapped file, if there is one.  The
+	   epoch is checked and split by 'cheby_find' exactly as below.
 	*/
 
-	s = jed[0] - 0.5;
-	split(s, &jd[0]);
-	split(jed[1], &jd[2]);
-	jd[0] += jd[2] + 0.5;
-	jd[1] += jd[3];
-	split(jd[1], &jd[2]);
-	jd[0] += jd[2];
+	if (JPL_HANDLE.store.base != NULL)
+	{
+		if ((nr = cheby_find(&JPL_HANDLE, jed, -1L, &t[0])) < 0)
+			return 2;
+		buf = (double *)cheby_segment(&JPL_HANDLE, nr);
+	}
+	else
+	{
+		/*
+		   Check epoch.
+		*/
 
-	/*
-	   Return error code if date is out of range.
-	*/
+		s = jed[0] - 0.5;
+		split(s, &jd[0]);
+		split(jed[1], &jd[2]);
+		jd[0] += jd[2] + 0.5;
+		jd[1] += jd[3];
+		split(jd[1], &jd[2]);
+		jd[0] += jd[2];
 
-	if ((jd[0] < SS[0]) || ((jd[0] + jd[3]) > SS[1]))
-		return 2;
+		/*
+		   Return error code if date is out of range.
+		*/
 
-	/*
-	   Calculate record number and relative time interval.
-	*/
+		if ((jd[0] < SS[0]) || ((jd[0] + jd[3]) > SS[1]))
+			return 2;
 
-	nr = (long int)((jd[0] - SS[0]) / SS[2]) + 3;
-	if (jd[0] == SS[1])
-		nr -= 2;
-	t[0] = ((jd[0] - ((double)(nr - 3) * SS[2] + SS[0])) + jd[3]) / SS[2];
+		/*
+		   Calculate record number and relative time interval.
+		*/
 
-	/*
-	   Read correct record if it is not already in memory.
-	*/
+		nr = (long int)((jd[0] - SS[0]) / SS[2]) + 3;
+		if (jd[0] == SS[1])
+			nr -= 2;
+		t[0] = ((jd[0] - ((double)(nr - 3) * SS[2] + SS[0])) + jd[3]) / SS[2];
 
-	if (nr != NRL)
-	{
-		NRL = nr;
-		rec = (nr - 1) * RECORD_LENGTH;
-		fseek(EPHFILE, rec, SEEK_SET);
-		if (!fread(BUFFER, RECORD_LENGTH, 1, EPHFILE))
+		/*
+		   Read correct record if it is not already in memory.
+		*/
+
+		if (nr != NRL)
 		{
-			ephem_close();
-			return 1;
+			NRL = nr;
+			rec = (nr - 1) * RECORD_LENGTH;
+			fseek(EPHFILE, rec, SEEK_SET);
+			if (!fread(BUFFER, RECORD_LENGTH, 1, EPHFILE))
+			{
+				ephem_close();
+				return 1;
+			}
 		}
+
+		buf = BUFFER;
 	}
 
 	/*
 	   Check and interpolate for requested body.
 	*/
 
-	interpolate(&BUFFER[IPT[0][target] - 1], t, IPT[1][target],
+	interpolate(&buf[IPT[0][target] - 1], t, IPT[1][target],
 		IPT[2][target], target_pos, target_vel);
 
 	for (i = 0; i < 3; i++)
@@ -832,15 +904,11 @@ void interpolate(double *buf, double *t, long int ncf, long int na,
 
 	   GLOBALS
 	   USED:
-		  NP                eph_manager.h
-		  NV                eph_manager.h
-		  PC                eph_manager.h
-		  VC                eph_manager.h
-		  TWOT              eph_manager.h
+		  None.
 
 	   FUNCTIONS
 	   CALLED:
-		  fmod              math.h
+		  cheby_eval_sub    cheby_engine.c
 
 	   VER./DATE/
 	   PROGRAMMER:
@@ -853,6 +921,9 @@ void interpolate(double *buf, double *t, long int ncf, long int na,
 									int to long int.
 		  V1.5/10-10/WKP (USNO/AA): Renamed function to lowercase to
 									comply with coding standards.
+		  ASCOM: Evaluation moved to 'cheby_eval_sub' (cheby_engine.c).
+				 The globals PC, VC, NP, NV and TWOT are no longer used,
+				 so 'interpolate' may be called from several threads.
 
 	   NOTES:
 		  None.
@@ -860,94 +931,17 @@ void interpolate(double *buf, double *t, long int ncf, long int na,
 	------------------------------------------------------------------------
 	*/
 {
-	long int i, j, k, l;
-
-	double dna, dt1, temp, tc, vfac;
-
-	/*
-	   Get correct sub-interval number for this set of coefficients and
-	   then get normalized Chebyshev time within that subinterval.
-	*/
-
-	dna = (double)na;
-	dt1 = (double)((long int)t[0]);
-	temp = dna * t[0];
-	l = (long int)(temp - dt1);
-
-	/*
-	   'tc' is the normalized Chebyshev time (-1 <= tc <= 1).
-	*/
-
-	tc = 2.0 * (fmod(temp, 1.0) + dt1) - 1.0;
-
-	/*
-	   Check to see whether Chebyshev time has changed, and compute new
-	   polynomial values if it has.  (The element PC[1] is the value of
-	   t1[tc] and hence contains the value of 'tc' on the previous call.)
-	*/
-
-	if (tc != PC[1])
-	{
-		NP = 2;
-		NV = 3;
-		PC[1] = tc;
-		TWOT = tc + tc;
-	}
-
-	/*
-	   Be sure that at least 'ncf' polynomials have been evaluated and
-	   are stored in the array 'PC'.
-	*/
-
-	if (NP < ncf)
-	{
-		for (i = NP; i < ncf; i++)
-			PC[i] = TWOT * PC[i - 1] - PC[i - 2];
-		NP = ncf;
-	}
+	long int i;
 
 	/*
-	   Interpolate to get position for each component.
+	   Values and derivatives with respect to the fraction of the whole
+	   interval; scale the derivatives to the input time units.
 	*/
 
-	for (i = 0; i < 3; i++)
-	{
-		position[i] = 0.0;
-		for (j = ncf - 1; j >= 0; j--)
-		{
-			k = j + (i * ncf) + (l * (3 * ncf));
-			position[i] += PC[j] * buf[k];
-		}
-	}
-
-	/*
-	   If velocity interpolation is desired, be sure enough derivative
-	   polynomials have been generated and stored.
-	*/
-
-	vfac = (2.0 * dna) / t[1];
-	VC[2] = 2.0 * TWOT;
-	if (NV < ncf)
-	{
-		for (i = NV; i < ncf; i++)
-			VC[i] = TWOT * VC[i - 1] + PC[i - 1] + PC[i - 1] - VC[i - 2];
-		NV = ncf;
-	}
-
-	/*
-	   Interpolate to get velocity for each component.
-	*/
+	cheby_eval_sub(buf, ncf, 3L, na, t[0], position, velocity);
 
 	for (i = 0; i < 3; i++)
-	{
-		velocity[i] = 0.0;
-		for (j = ncf - 1; j > 0; j--)
-		{
-			k = j + (i * ncf) + (l * (3 * ncf));
-			velocity[i] += VC[j] * buf[k];
-		}
-		velocity[i] *= vfac;
-	}
+		velocity[i] /= t[1];
 
 	return;
 }
@@ -0,0 +1,478 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  multi_place.c: Apparent, topocentric and astrometric places of many
+                 targets for many observers at one time
+
+  'place' finds the Earth and the Sun, the observer's geocentric state
+  ('geo_posvel', with its sidereal time and rotation to the GCRS), the
+  target's light-time ('light_time'), the deflecting bodies
+  ('grav_def') and the rotation to the output system for every call.
+  For a network of stations reducing the same targets at the same
+  instant, 'multi_place' finds what does not depend on the observer
+  once:  the Earth, the Sun, the deflecting bodies, the sidereal time,
+  the rotations, and each solar system target's retarded state as seen
+  from the geocenter.  Each observer-target pair then needs only its own
+  parallax, light-time, deflection and aberration.
+*/
+
+#ifndef _MULTIPLACE_
+   #include "multi_place.h"
+#endif
+
+#include <math.h>
+
+/********multi_place */
+
+short int multi_place (double jd_tt, long int n_observers,
+                       observer *locations, long int n_targets,
+                       object *targets, double delta_t,
+                       short int coord_sys, short int accuracy,
+
+                       sky_pos *output)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the places of several stars or solar system bodies for
+      several observers at one time, as 'place' does for each pair.
+
+   REFERENCES:
+      Kaplan, G. et al. (1989). Astron. Journ. 97, 1197-1210.
+      Klioner, S. (2003). Astron. Journ. 125, 1580-1597.
+
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date for place.
+      n_observers (long int)
+         Number of observers.
+      *locations (struct observer)
+         The observers, as for 'place'.
+      n_targets (long int)
+         Number of targets.
+      *targets (struct object)
+         The stars and solar system bodies, as for 'place'.
+      delta_t (double)
+         Difference TT-UT1 at 'jd_tt', in seconds of time.
+      coord_sys (short int)
+         Coordinate system of the output, as for 'place':
+            = 0 ... GCRS or "local GCRS"
+            = 1 ... true equator and equinox of date
+            = 2 ... true equator and CIO of date
+            = 3 ... astrometric coordinates, i.e., without light
+                    deflection or aberration.
+      accuracy (short int)
+         Selection for accuracy, as for 'place'.
+
+   OUTPUT
+   ARGUMENTS:
+      *output (struct sky_pos)
+         The place of target j for observer i in
+         output[i * n_targets + j], as from 'place'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         = 0         ... Everything OK.
+         = 1         ... Invalid value of 'coord_sys'.
+         = 2         ... Invalid value of 'accuracy'.
+         = 3         ... Earth is a target and an observer is at the
+                         geocenter or on the Earth's surface (not
+                         permitted).
+         = 4         ... Invalid value of 'n_observers' or 'n_targets'.
+         > 10, < 40  ... 10 + error from function 'ephemeris'.
+         > 50, < 70  ... 50 + error from function 'light_time'.
+         > 70, < 80  ... 70 + error from function 'ephemeris' for a
+                         deflecting body.
+         > 80, < 90  ... 80 + error from function 'cio_location'.
+         > 90, < 100 ... 90 + error from function 'cio_basis'.
+
+   GLOBALS
+   USED:
+      T0, C_AUDAY        novascon.c
+      AU_KM, RMASS       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      make_cat_entry     novas.c
+      make_object        novas.c
+      tdb2tt             novas.c
+      ephemeris          novas.c
+      sidereal_time      novas.c
+      e_tilt             novas.c
+      terra              novas.c
+      starvectors        novas.c
+      d_light            novas.c
+      proper_motion      novas.c
+      bary2obs           novas.c
+      light_time         novas.c
+      limb_angle         novas.c
+      grav_vec           novas.c
+      aberration         novas.c
+      frame_tie          novas.c
+      precession         novas.c
+      nutation           novas.c
+      cio_location       novas.c
+      cio_basis          novas.c
+      rad_vel            novas.c
+      vector2radec       novas.c
+      fabs               math.h
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The sidereal time and the rotation from the true equator and
+         equinox of date to the GCRS that 'geo_posvel' finds for each
+         observer are found once and applied as one matrix, as is the
+         rotation to the output system.
+      2. The deflecting bodies of 'grav_def' (the Sun, with Jupiter and
+         Saturn at full accuracy) are found once, with their
+         velocities.  'grav_def' takes each body where it was when the
+         light passed closest to it, which depends on the target and
+         the observer; here the body is moved back there along its
+         velocity.
+      3. A solar system target is found once at 'jd_tdb' and once at
+         its retarded time as seen from the geocenter.  The light-time
+         from each observer is then solved with the target carried
+         along its velocity from there, which for an observer on the
+         Earth's surface (light-times within 0.02 s of the geocenter's)
+         is exact to well under a millimeter.  Observers whose
+         light-times differ from the geocenter's by more than
+         MULTI_PLACE_SPAN fall back to 'light_time'.  At reduced
+         accuracy 'light_time' looks the target up at a date held in
+         one double, which moves the Moon by up to a few meters; its
+         places from 'place' and from here then differ by about a
+         milliarcsecond.
+      4. Observers are taken MULTI_PLACE_BLOCK at a time, so each
+         solar system target is looked up once per block.
+
+------------------------------------------------------------------------
+*/
+{
+   static char *body_name[3] = {"Sun", "Jupiter", "Saturn"};
+   static const short int body_num[3] = {10, 5, 6};
+
+   short int error, n_bodies, b, j, k, rs, iter, rotate = 0, spin = 0,
+      loc[MULTI_PLACE_BLOCK];
+
+   long int i0, n_block, i, t;
+
+   double jd_tdb, x, secdif, jd[2], jd_ut1, gmst, gast = 0.0, eqeq, x1, x2,
+      x3, x4, tol, peb[3], veb[3], psb[3], vsb[3], pbody[3][3],
+      vbody[3][3], m[3][3], q[3][3], e[3], p1[3], p2[3], r_cio,
+      pog[MULTI_PLACE_BLOCK][3], vog[MULTI_PLACE_BLOCK][3],
+      pob[MULTI_PLACE_BLOCK][3], vob[MULTI_PLACE_BLOCK][3],
+      pbodyo[MULTI_PLACE_BLOCK][3][3], d_obs_geo[MULTI_PLACE_BLOCK],
+      d_obs_sun[MULTI_PLACE_BLOCK], pos1[3], vel1[3], pret[3], vret[3],
+      pos2[3], pos3[3], pos4[3], pos5[3], pos8[3], pb[3], t_geo, t_light0,
+      t_light, tlt, tau, dlt, back, frlimb, d_obj_sun, dt;
+
+   cat_entry dummy_star;
+
+   object body;
+
+   sky_pos *out;
+
+   if ((coord_sys < 0) || (coord_sys > 3))
+      return 1;
+   if ((accuracy < 0) || (accuracy > 1))
+      return 2;
+   if ((n_observers < 0) || (n_targets < 0))
+      return 4;
+
+/*
+   Earth can only be a target when every observer is on a near-Earth
+   spacecraft.
+*/
+
+   for (t = 0; t < n_targets; t++)
+      if ((targets[t].type == 0) && (targets[t].number == 3))
+         for (i = 0; i < n_observers; i++)
+            if (locations[i].where != 2)
+               return 3;
+
+/*
+   The Earth and the Sun.
+*/
+
+   tdb2tt (jd_tt, &x, &secdif);
+   jd_tdb = jd_tt + secdif / 86400.0;
+   jd[0] = jd_tdb;
+   jd[1] = 0.0;
+   tol = (accuracy == 0) ? 1.0e-12 : 1.0e-9;
+
+   make_cat_entry ("DUMMY", "xxx", 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                   &dummy_star);
+   make_object (0, 3, "Earth", &dummy_star, &body);
+   if ((error = ephemeris (jd, &body, 0, accuracy, peb, veb)) != 0)
+      return (short int) (10 + error);
+   make_object (0, 10, "Sun", &dummy_star, &body);
+   if ((error = ephemeris (jd, &body, 0, accuracy, psb, vsb)) != 0)
+      return (short int) (10 + error);
+
+/*
+   The deflecting bodies of 'grav_def'.
+*/
+
+   n_bodies = (coord_sys == 3) ? 0 : ((accuracy == 0) ? 3 : 1);
+   for (b = 0; b < n_bodies; b++)
+   {
+      make_object (0, body_num[b], body_name[b], &dummy_star, &body);
+      if ((error = ephemeris (jd, &body, 0, accuracy, pbody[b],
+                              vbody[b])) != 0)
+         return (short int) (70 + error);
+   }
+
+/*
+   The rotation from the GCRS to the output system (m), and for
+   observers away from the geocenter the rotation from the true equator
+   and equinox of date to the GCRS (q) and the sidereal time, as in
+   'geo_posvel'.  The columns of each matrix are the images of the axes.
+*/
+
+   for (i = 0; i < n_observers; i++)
+   {
+      if ((locations[i].where == 1) || (locations[i].where == 2))
+         rotate = 1;
+      if (locations[i].where == 1)
+         spin = 1;
+   }
+   if (spin)
+   {
+      jd_ut1 = jd_tt - (delta_t / 86400.0);
+      sidereal_time (jd_ut1, 0.0, delta_t, 0, 1, accuracy, &gmst);
+      e_tilt (jd_tdb, accuracy, &x1, &x2, &eqeq, &x3, &x4);
+      gast = gmst + eqeq / 3600.0;
+   }
+
+   for (k = 0; k < 3; k++)
+   {
+      for (j = 0; j < 3; j++)
+         e[j] = (j == k) ? 1.0 : 0.0;
+      if (rotate)
+      {
+         nutation (jd_tdb, -1, accuracy, e, p1);
+         precession (jd_tdb, p1, T0, p2);
+         frame_tie (p2, -1, p1);
+         for (j = 0; j < 3; j++)
+            q[j][k] = p1[j];
+      }
+      switch (coord_sys)
+      {
+         case (1):
+            frame_tie (e, 1, p1);
+            precession (T0, p1, jd_tdb, p2);
+            nutation (jd_tdb, 0, accuracy, p2, e);
+            break;
+         case (2):
+            if (k == 0)
+            {
+               if ((error = cio_location (jd_tdb, accuracy, &r_cio,
+                                          &rs)) != 0)
+                  return (short int) (80 + error);
+               if ((error = cio_basis (jd_tdb, r_cio, rs, accuracy, m[0],
+                                       m[1], m[2])) != 0)
+                  return (short int) (90 + error);
+            }
+            break;
+         default:
+            break;
+      }
+      if (coord_sys != 2)
+         for (j = 0; j < 3; j++)
+            m[j][k] = e[j];
+   }
+
+   for (i0 = 0; i0 < n_observers; i0 += MULTI_PLACE_BLOCK)
+   {
+      n_block = n_observers - i0;
+      if (n_block > MULTI_PLACE_BLOCK)
+         n_block = MULTI_PLACE_BLOCK;
+
+/*
+   The observers of this block, with respect to the geocenter and to
+   the barycenter, and the deflecting bodies as they see them.
+*/
+
+      for (i = 0; i < n_block; i++)
+      {
+         switch (locations[i0 + i].where)
+         {
+            case (1):
+               terra (&locations[i0 + i].on_surf, gast, p1, p2);
+               loc[i] = 1;
+               break;
+            case (2):
+               for (j = 0; j < 3; j++)
+               {
+                  p1[j] = locations[i0 + i].near_earth.sc_pos[j] / AU_KM;
+                  p2[j] = locations[i0 + i].near_earth.sc_vel[j] /
+                     (AU_KM / 86400.0);
+               }
+               loc[i] = 1;
+               break;
+            default:
+               for (j = 0; j < 3; j++)
+                  p1[j] = p2[j] = 0.0;
+               loc[i] = 0;
+               break;
+         }
+         for (j = 0; j < 3; j++)
+         {
+            if (loc[i])
+            {
+               pog[i][j] = q[j][0] * p1[0] + q[j][1] * p1[1] +
+                  q[j][2] * p1[2];
+               vog[i][j] = q[j][0] * p2[0] + q[j][1] * p2[1] +
+                  q[j][2] * p2[2];
+            }
+            else
+               pog[i][j] = vog[i][j] = 0.0;
+            pob[i][j] = peb[j] + pog[i][j];
+            vob[i][j] = veb[j] + vog[i][j];
+         }
+         d_obs_geo[i] = sqrt (pog[i][0] * pog[i][0] + pog[i][1] *
+                              pog[i][1] + pog[i][2] * pog[i][2]);
+         d_obs_sun[i] = sqrt ((pob[i][0] - psb[0]) * (pob[i][0] - psb[0]) +
+                              (pob[i][1] - psb[1]) * (pob[i][1] - psb[1]) +
+                              (pob[i][2] - psb[2]) * (pob[i][2] - psb[2]));
+         for (b = 0; b < n_bodies; b++)
+            bary2obs (pbody[b], pob[i], pbodyo[i][b], &x);
+      }
+
+      for (t = 0; t < n_targets; t++)
+      {
+
+/*
+   What the target's place needs that does not depend on the observer:
+   a star's vectors, or a body's state at 'jd_tdb' and at its retarded
+   time from the geocenter.
+*/
+
+         t_geo = 0.0;
+         if (targets[t].type == 2)
+            starvectors (&targets[t].star, pos1, vel1);
+         else
+         {
+            jd[0] = jd_tdb;
+            jd[1] = 0.0;
+            if ((error = ephemeris (jd, &targets[t], 0, accuracy, pos1,
+                                    vel1)) != 0)
+               return (short int) (10 + error);
+            bary2obs (pos1, peb, p1, &t_light0);
+            if ((error = light_time (jd_tdb, &targets[t], peb, t_light0,
+                                     accuracy, p1, &t_geo)) != 0)
+               return (short int) (50 + error);
+            if (accuracy == 0)
+            {
+               jd[0] = (double) ((long int) jd_tdb);
+               jd[1] = jd_tdb - jd[0] - t_geo;
+            }
+            else
+            {
+               jd[0] = 0.0;
+               jd[1] = jd_tdb - t_geo;
+            }
+            if ((error = ephemeris (jd, &targets[t], 0, accuracy, pret,
+                                    vret)) != 0)
+               return (short int) (10 + error);
+         }
+         d_obj_sun = sqrt ((pos1[0] - psb[0]) * (pos1[0] - psb[0]) +
+                           (pos1[1] - psb[1]) * (pos1[1] - psb[1]) +
+                           (pos1[2] - psb[2]) * (pos1[2] - psb[2]));
+
+         for (i = 0; i < n_block; i++)
+         {
+            out = &output[(i0 + i) * n_targets + t];
+
+/*
+   The target from this observer, corrected for light-time.
+*/
+
+            if (targets[t].type == 2)
+            {
+               dt = d_light (pos1, pob[i]);
+               proper_motion (T0, pos1, vel1, jd_tdb + dt, pos2);
+               bary2obs (pos2, pob[i], pos3, &t_light);
+               out->dis = 0.0;
+            }
+            else
+            {
+               bary2obs (pos1, pob[i], p1, &t_light0);
+               out->dis = t_light0 * C_AUDAY;
+               tau = t_geo;
+               for (iter = 0; iter < 10; iter++)
+               {
+                  for (j = 0; j < 3; j++)
+                     p1[j] = pret[j] - vret[j] * (tau - t_geo);
+                  bary2obs (p1, pob[i], pos3, &t_light);
+                  x = t_light - tau;
+                  tau = t_light;
+                  if (fabs (x) <= tol)
+                     break;
+               }
+               if (fabs (tau - t_geo) > MULTI_PLACE_SPAN)
+                  if ((error = light_time (jd_tdb, &targets[t], pob[i],
+                                           t_light0, accuracy, pos3,
+                                           &t_light)) != 0)
+                     return (short int) (50 + error);
+            }
+
+/*
+   Deflection and aberration, as 'place' and 'grav_def'.
+*/
+
+            if (coord_sys == 3)
+            {
+               for (j = 0; j < 3; j++)
+                  pos5[j] = pos3[j];
+            }
+            else
+            {
+               for (j = 0; j < 3; j++)
+                  pos4[j] = pos3[j];
+               tlt = sqrt (pos3[0] * pos3[0] + pos3[1] * pos3[1] +
+                           pos3[2] * pos3[2]) / C_AUDAY;
+               for (b = 0; b < n_bodies; b++)
+               {
+                  dlt = d_light (pos4, pbodyo[i][b]);
+                  back = 0.0;
+                  if (dlt > 0.0)
+                     back = dlt;
+                  if (tlt < dlt)
+                     back = tlt;
+                  for (j = 0; j < 3; j++)
+                     pb[j] = pbody[b][j] - vbody[b][j] * back;
+                  grav_vec (pos4, pob[i], pb, RMASS[body_num[b]], pos4);
+               }
+               if (loc[i])
+               {
+                  limb_angle (pos3, pog[i], &x, &frlimb);
+                  if (frlimb >= 0.8)
+                     grav_vec (pos4, pob[i], peb, RMASS[3], pos4);
+               }
+               aberration (pos4, vob[i], t_light, pos5);
+            }
+
+            for (j = 0; j < 3; j++)
+               pos8[j] = m[j][0] * pos5[0] + m[j][1] * pos5[1] +
+                  m[j][2] * pos5[2];
+
+            rad_vel (&targets[t], pos3, vel1, vob[i], d_obs_geo[i],
+                     d_obs_sun[i], d_obj_sun, &out->rv);
+
+            vector2radec (pos8, &out->ra, &out->dec);
+            x = sqrt (pos8[0] * pos8[0] + pos8[1] * pos8[1] +
+                      pos8[2] * pos8[2]);
+            for (j = 0; j < 3; j++)
+               out->r_hat[j] = pos8[j] / x;
+         }
+      }
+   }
+
+   return 0;
+}
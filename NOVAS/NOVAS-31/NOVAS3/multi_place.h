@@ -0,0 +1,41 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  multi_place.h: Header file for multi_place.c, apparent, topocentric
+                 and astrometric places of many targets for many
+                 observers at one time
+*/
+
+#ifndef _MULTIPLACE_
+   #define _MULTIPLACE_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+/*
+   MULTI_PLACE_BLOCK  = number of observers whose states are held at once;
+                        each solar system target is looked up once per
+                        block
+   MULTI_PLACE_SPAN   = largest difference (days) between the light-time
+                        from an observer and from the geocenter for which
+                        a solar system target's retarded position is
+                        carried along its velocity rather than found
+                        again by 'light_time'
+*/
+
+   #define MULTI_PLACE_BLOCK 64
+   #define MULTI_PLACE_SPAN (1.0 / 86400.0)
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int multi_place (double jd_tt, long int n_observers,
+                                 observer *locations, long int n_targets,
+                                 object *targets, double delta_t,
+                                 short int coord_sys, short int accuracy,
+
+                                 sky_pos *output);
+
+#endif
@@ -14,6 +14,14 @@
 #include "novas.h"
 #endif
 
+#ifndef _EPHCACHE_
+#include "eph_cache.h" //ASCOM - ephemeris cache used by ephemeris()
+#endif
+
+#ifndef _CHEBYENGINE_
+#include "cheby_engine.h" //ASCOM - mapped CIO file used by cio_array()
+#endif
+
 #include <math.h>
 
 /*
@@ -26,6 +34,30 @@
 static double PSI_COR = 0.0;
 static double EPS_COR = 0.0;
 
+/*
+   ASCOM - Functions that take the pole offsets as arguments.  Each
+   function 'xxx' that uses the offsets is computed by 'xxx_cor', given
+   'PSI_COR' and 'EPS_COR'; the exported ones (see novas.h) let a caller
+   such as eop_store.c supply its own offsets for one call.
+*/
+
+static short int sidereal_time_cor(double jd_high, double jd_low,
+	double delta_t, short int gst_type, short int method,
+	short int accuracy, double psi_cor, double eps_cor, double *gst);
+static void e_tilt_cor(double jd_tdb, short int accuracy, double psi_cor,
+	double eps_cor, double *mobl, double *tobl, double *ee, double *dpsi,
+	double *deps);
+static void nutation_cor(double jd_tdb, short int direction,
+	short int accuracy, double psi_cor, double eps_cor, double *pos,
+	double *pos2);
+static short int cio_location_cor(double jd_tdb, short int accuracy,
+	double psi_cor, double eps_cor, double *ra_cio, short int *ref_sys);
+static short int cio_basis_cor(double jd_tdb, double ra_cio,
+	short int ref_sys, short int accuracy, double psi_cor, double eps_cor,
+	double *x, double *y, double *z);
+static double ira_equinox_cor(double jd_tdb, short int equinox,
+	short int accuracy, double psi_cor, double eps_cor);
+
 //Next line added by Peter Simpson 17th February 2010 to enable routines in this file to access the RACIO_FILE_NAME variable
 //defined in ascom.c
 extern char RACIO_FILE_NAME[255]; //cio_ra.bin
@@ -2578,6 +2610,41 @@ void equ2hor(double jd_ut1, double delta_t, short int accuracy,
 		  4. This function is the C version of NOVAS Fortran routine
 		  'zdaz'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by equ2hor_cor, given the global pole offsets
+	equ2hor_cor(jd_ut1, delta_t, accuracy, xp, yp, PSI_COR, EPS_COR,
+		location, ra, dec, ref_option, zd, az, rar, decr);
+	return;
+}
+
+/********equ2hor_cor */
+
+void equ2hor_cor(double jd_ut1, double delta_t, short int accuracy,
+	double xp, double yp, double psi_cor, double eps_cor,
+	on_surface *location, double ra, double dec, short int ref_option,
+
+	double *zd, double *az, double *rar, double *decr)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'equ2hor' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'equ2hor', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -2635,9 +2702,12 @@ void equ2hor(double jd_ut1, double delta_t, short int accuracy,
 	   (wrt equator and equinox of date).
 	*/
 
-	ter2cel(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, uze, uz);
-	ter2cel(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, une, un);
-	ter2cel(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, uwe, uw);
+	ter2cel_cor(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, psi_cor,
+		eps_cor, uze, uz);
+	ter2cel_cor(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, psi_cor,
+		eps_cor, une, un);
+	ter2cel_cor(jd_ut1, 0.0, delta_t, 1, accuracy, 1, xp, yp, psi_cor,
+		eps_cor, uwe, uw);
 
 	/*
 	   Define unit vector 'p' toward object in celestial system
@@ -3023,6 +3093,41 @@ short int sidereal_time(double jd_high, double jd_low,
 		  2. This function is the C version of NOVAS Fortran routine
 		  'sidtim'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by sidereal_time_cor, given the global pole offsets
+	return (sidereal_time_cor(jd_high, jd_low, delta_t, gst_type, method,
+		accuracy, PSI_COR, EPS_COR, gst));
+}
+
+/********sidereal_time_cor */
+
+static short int sidereal_time_cor(double jd_high, double jd_low,
+	double delta_t, short int gst_type,
+	short int method, short int accuracy,
+	double psi_cor, double eps_cor,
+
+	double *gst)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'sidereal_time' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'sidereal_time', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -3031,6 +3136,7 @@ short int sidereal_time(double jd_high, double jd_low,
 
 	static double ee;
 	static double jd_last = -99.0;
+	static double psi_last = 0.0, eps_last = 0.0; //ASCOM
 	double unitx[3] = { 1.0, 0.0, 0.0 };
 	double jd_ut, jd_tt, jd_tdb, tt_temp, t, theta, a, b, c, d,
 		ra_cio, x[3], y[3], z[3], w1[3], w2[3], eq[3], ha_eq, st,
@@ -3070,10 +3176,15 @@ short int sidereal_time(double jd_high, double jd_low,
 	if (((gst_type == 0) && (method == 0)) ||       /* GMST; CIO-TIO */
 		((gst_type == 1) && (method == 1)))         /* GAST; equinox */
 	{
-		if (fabs(jd_tdb - jd_last) > 1.0e-8)
+		//ASCOM - the saved value is also keyed by the pole offsets
+		if ((fabs(jd_tdb - jd_last) > 1.0e-8) || (psi_cor != psi_last) ||
+			(eps_cor != eps_last))
 		{
-			e_tilt(jd_tdb, accuracy, &a, &b, &ee, &c, &d);
+			e_tilt_cor(jd_tdb, accuracy, psi_cor, eps_cor, &a, &b, &ee, &c,
+				&d);
 			jd_last = jd_tdb;
+			psi_last = psi_cor;
+			eps_last = eps_cor;
 		}
 		eqeq = ee * 15.0;
 	}
@@ -3100,20 +3211,21 @@ short int sidereal_time(double jd_high, double jd_low,
 		   system.
 		*/
 
-		if ((error = cio_location(jd_tdb, accuracy, &ra_cio,
-			&ref_sys)) != 0)
+		if ((error = cio_location_cor(jd_tdb, accuracy, psi_cor, eps_cor,
+			&ra_cio, &ref_sys)) != 0)
 		{
 			*gst = 99.0;
 			return (error += 10);
 		}
 
-		cio_basis(jd_tdb, ra_cio, ref_sys, accuracy, x, y, z);
+		cio_basis_cor(jd_tdb, ra_cio, ref_sys, accuracy, psi_cor, eps_cor,
+			x, y, z);
 
 		/*
 		   Compute the direction of the true equinox in the GCRS.
 		*/
 
-		nutation(jd_tdb, -1, accuracy, unitx, w1);
+		nutation_cor(jd_tdb, -1, accuracy, psi_cor, eps_cor, unitx, w1);
 		precession(jd_tdb, w1, T0, w2);
 		frame_tie(w2, -1, eq);
 
@@ -3364,6 +3476,41 @@ short int ter2cel(double jd_ut_high, double jd_ut_low, double delta_t,
 		  3. This function is the C version of NOVAS Fortran routine
 		  'tercel'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by ter2cel_cor, given the global pole offsets
+	return (ter2cel_cor(jd_ut_high, jd_ut_low, delta_t, method, accuracy,
+		option, xp, yp, PSI_COR, EPS_COR, vec1, vec2));
+}
+
+/********ter2cel_cor */
+
+short int ter2cel_cor(double jd_ut_high, double jd_ut_low,
+	double delta_t, short int method, short int accuracy,
+	short int option, double xp, double yp, double psi_cor,
+	double eps_cor, double *vec1,
+
+	double *vec2)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'ter2cel' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'ter2cel', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -3424,10 +3571,12 @@ short int ter2cel(double jd_ut_high, double jd_ut_low, double delta_t,
 		   system.
 		*/
 
-		if ((error = cio_location(jd_tdb, accuracy, &r_cio, &rs)) != 0)
+		if ((error = cio_location_cor(jd_tdb, accuracy, psi_cor, eps_cor,
+			&r_cio, &rs)) != 0)
 			return (error += 10);
 
-		if ((error = cio_basis(jd_tdb, r_cio, rs, accuracy, x, y, z)) != 0)
+		if ((error = cio_basis_cor(jd_tdb, r_cio, rs, accuracy, psi_cor,
+			eps_cor, x, y, z)) != 0)
 			return (error += 20);
 
 		/*
@@ -3470,7 +3619,8 @@ short int ter2cel(double jd_ut_high, double jd_ut_low, double delta_t,
 		   Apply Earth rotation.
 		*/
 
-		sidereal_time(jd_ut_high, jd_ut_low, delta_t, 1, 1, accuracy, &gast);
+		sidereal_time_cor(jd_ut_high, jd_ut_low, delta_t, 1, 1, accuracy,
+			psi_cor, eps_cor, &gast);
 		spin(-gast * 15.0, v1, v2);
 
 		/*
@@ -3490,7 +3640,7 @@ short int ter2cel(double jd_ut_high, double jd_ut_low, double delta_t,
 			   Apply precession, nutation, and frame tie.
 			*/
 
-			nutation(jd_tdb, -1, accuracy, v2, v3);
+			nutation_cor(jd_tdb, -1, accuracy, psi_cor, eps_cor, v2, v3);
 			precession(jd_tdb, v3, T0, v4);
 			frame_tie(v4, -1, vec2);
 		}
@@ -3606,6 +3756,41 @@ short int cel2ter(double jd_ut_high, double jd_ut_low, double delta_t,
 		  3. This function is the C version of NOVAS Fortran routine
 		  'celter'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by cel2ter_cor, given the global pole offsets
+	return (cel2ter_cor(jd_ut_high, jd_ut_low, delta_t, method, accuracy,
+		option, xp, yp, PSI_COR, EPS_COR, vec1, vec2));
+}
+
+/********cel2ter_cor */
+
+short int cel2ter_cor(double jd_ut_high, double jd_ut_low,
+	double delta_t, short int method, short int accuracy,
+	short int option, double xp, double yp, double psi_cor,
+	double eps_cor, double *vec1,
+
+	double *vec2)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'cel2ter' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'cel2ter', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -3652,10 +3837,12 @@ short int cel2ter(double jd_ut_high, double jd_ut_low, double delta_t,
 		   system.
 		*/
 
-		if ((error = cio_location(jd_tdb, accuracy, &r_cio, &rs)) != 0)
+		if ((error = cio_location_cor(jd_tdb, accuracy, psi_cor, eps_cor,
+			&r_cio, &rs)) != 0)
 			return (error += 10);
 
-		if ((error = cio_basis(jd_tdb, r_cio, rs, accuracy, x, y, z)) != 0)
+		if ((error = cio_basis_cor(jd_tdb, r_cio, rs, accuracy, psi_cor,
+			eps_cor, x, y, z)) != 0)
 			return (error += 20);
 
 		/*
@@ -3713,14 +3900,15 @@ short int cel2ter(double jd_ut_high, double jd_ut_low, double delta_t,
 
 			frame_tie(vec1, 1, v1);
 			precession(T0, v1, jd_tdb, v2);
-			nutation(jd_tdb, 0, accuracy, v2, v3);
+			nutation_cor(jd_tdb, 0, accuracy, psi_cor, eps_cor, v2, v3);
 		}
 
 		/*
 		   Apply Earth rotation.
 		*/
 
-		sidereal_time(jd_ut_high, jd_ut_low, delta_t, 1, 1, accuracy, &gast);
+		sidereal_time_cor(jd_ut_high, jd_ut_low, delta_t, 1, 1, accuracy,
+			psi_cor, eps_cor, &gast);
 		spin(gast * 15.0, v3, v4);
 
 		/*
@@ -4212,6 +4400,41 @@ void e_tilt(double jd_tdb, short int accuracy,
 		  2. This function is the C version of NOVAS Fortran routine
 		  'etilt'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by e_tilt_cor, given the global pole offsets
+	e_tilt_cor(jd_tdb, accuracy, PSI_COR, EPS_COR, mobl, tobl, ee, dpsi,
+		deps);
+	return;
+}
+
+/********e_tilt_cor */
+
+static void e_tilt_cor(double jd_tdb, short int accuracy,
+	double psi_cor, double eps_cor,
+
+	double *mobl, double *tobl, double *ee, double *dpsi,
+	double *deps)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'e_tilt' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'e_tilt', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -4263,8 +4486,8 @@ void e_tilt(double jd_tdb, short int accuracy,
 	   Apply observed celestial pole offsets.
 	*/
 
-	d_psi = dp + PSI_COR;
-	d_eps = de + EPS_COR;
+	d_psi = dp + psi_cor;
+	d_eps = de + eps_cor;
 
 	/*
 	   Compute mean obliquity of the ecliptic in arcseconds.
@@ -4383,6 +4606,42 @@ short int cel_pole(double tjd, short int type, double dpole1,
 		  5. This function is the C version of NOVAS Fortran routine
 		  'celpol'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by cel_pole_cor, given the global pole offsets
+	return (cel_pole_cor(tjd, type, dpole1, dpole2, &PSI_COR, &EPS_COR));
+}
+
+/********cel_pole_cor */
+
+short int cel_pole_cor(double tjd, short int type, double dpole1,
+	double dpole2,
+
+	double *psi_cor, double *eps_cor)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'cel_pole' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'cel_pole'.
+
+	   OUTPUT
+	   ARGUMENTS:
+		  *psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  *eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+		  Neither is changed if 'type' is invalid.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -4399,8 +4658,8 @@ short int cel_pole(double tjd, short int type, double dpole1,
 		   date, that is,delta-delta-psi and delta-delta-epsilon.
 		*/
 
-		PSI_COR = dpole1 * 1.0e-3;
-		EPS_COR = dpole2 * 1.0e-3;
+		*psi_cor = dpole1 * 1.0e-3;
+		*eps_cor = dpole2 * 1.0e-3;
 		break;
 
 	case (2):
@@ -4452,8 +4711,8 @@ short int cel_pole(double tjd, short int type, double dpole1,
 		   Compute delta-delta-psi and delta-delta-epsilon in arcseconds.
 		*/
 
-		PSI_COR = (dp3[0] / sin_e) / ASEC2RAD;
-		EPS_COR = dp3[1] / ASEC2RAD;
+		*psi_cor = (dp3[0] / sin_e) / ASEC2RAD;
+		*eps_cor = dp3[1] / ASEC2RAD;
 		break;
 
 	default:
@@ -6559,6 +6818,39 @@ void nutation(double jd_tdb, short int direction, short int accuracy,
 		  1. This function is the C version of NOVAS Fortran routine
 		  'nutate'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by nutation_cor, given the global pole offsets
+	nutation_cor(jd_tdb, direction, accuracy, PSI_COR, EPS_COR, pos, pos2);
+	return;
+}
+
+/********nutation_cor */
+
+static void nutation_cor(double jd_tdb, short int direction,
+	short int accuracy, double psi_cor, double eps_cor, double *pos,
+
+	double *pos2)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'nutation' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'nutation', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -6569,7 +6861,8 @@ void nutation(double jd_tdb, short int direction, short int accuracy,
 	   Call 'e_tilt' to get the obliquity and nutation angles.
 	*/
 
-	e_tilt(jd_tdb, accuracy, &oblm, &oblt, &eqeq, &psi, &eps);
+	e_tilt_cor(jd_tdb, accuracy, psi_cor, eps_cor, &oblm, &oblt, &eqeq,
+		&psi, &eps);
 
 	cobm = cos(oblm * DEG2RAD);
 	sobm = sin(oblm * DEG2RAD);
@@ -7455,6 +7748,39 @@ short int cio_location(double jd_tdb, short int accuracy,
 		  3. This function is the C version of NOVAS Fortran routine
 		  'cioloc'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by cio_location_cor, given the global pole offsets
+	return (cio_location_cor(jd_tdb, accuracy, PSI_COR, EPS_COR, ra_cio,
+		ref_sys));
+}
+
+/********cio_location_cor */
+
+static short int cio_location_cor(double jd_tdb, short int accuracy,
+	double psi_cor, double eps_cor,
+
+	double *ra_cio, short int *ref_sys)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'cio_location' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'cio_location', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -7468,6 +7794,7 @@ short int cio_location(double jd_tdb, short int accuracy,
 
 	static double t_last = 0.0;
 	static double ra_last;
+	static double psi_last = 0.0, eps_last = 0.0; //ASCOM
 	double p, eq_origins;
 
 	size_t cio_size;
@@ -7502,7 +7829,9 @@ short int cio_location(double jd_tdb, short int accuracy,
 	   Check if previously computed RA value can be used.
 	*/
 
-	if ((fabs(jd_tdb - t_last) <= 1.0e-8))
+	//ASCOM - the saved value is also keyed by the pole offsets
+	if ((fabs(jd_tdb - t_last) <= 1.0e-8) && (psi_cor == psi_last) &&
+		(eps_cor == eps_last))
 	{
 		*ra_cio = ra_last;
 		*ref_sys = ref_sys_last;
@@ -7586,7 +7915,7 @@ short int cio_location(double jd_tdb, short int accuracy,
 		if (first_call)
 			first_call = 0;
 
-		eq_origins = ira_equinox(jd_tdb, 1, accuracy);
+		eq_origins = ira_equinox_cor(jd_tdb, 1, accuracy, psi_cor, eps_cor);
 
 		*ra_cio = -eq_origins;
 		*ref_sys = 2;
@@ -7597,6 +7926,8 @@ short int cio_location(double jd_tdb, short int accuracy,
 	t_last = jd_tdb;
 	ra_last = *ra_cio;
 	ref_sys_last = *ref_sys;
+	psi_last = psi_cor;
+	eps_last = eps_cor;
 
 	return (error);
 }
@@ -7687,6 +8018,40 @@ short int cio_basis(double jd_tdb, double ra_cio, short int ref_sys,
 		  2. This function is the C version of NOVAS Fortran routine
 		  'ciobas'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by cio_basis_cor, given the global pole offsets
+	return (cio_basis_cor(jd_tdb, ra_cio, ref_sys, accuracy, PSI_COR,
+		EPS_COR, x, y, z));
+}
+
+/********cio_basis_cor */
+
+static short int cio_basis_cor(double jd_tdb, double ra_cio,
+	short int ref_sys, short int accuracy, double psi_cor,
+	double eps_cor,
+
+	double *x, double *y, double *z)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'cio_basis' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'cio_basis', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -7696,6 +8061,7 @@ short int cio_basis(double jd_tdb, double ra_cio, short int ref_sys,
 
 	static double t_last = 0.0;
 	static double xx[3], yy[3], zz[3];
+	static double psi_last = 0.0, eps_last = 0.0; //ASCOM
 	double z0[3] = { 0.0, 0.0, 1.0 };
 	double w0[3], w1[3], w2[3], sinra, cosra, xmag;
 
@@ -7703,13 +8069,17 @@ short int cio_basis(double jd_tdb, double ra_cio, short int ref_sys,
 	   Compute unit vector z toward celestial pole.
 	*/
 
-	if (((fabs(jd_tdb - t_last) > 1.0e-8)) || (ref_sys != ref_sys_last))
+	//ASCOM - the saved vectors are also keyed by the pole offsets
+	if (((fabs(jd_tdb - t_last) > 1.0e-8)) || (ref_sys != ref_sys_last) ||
+		(psi_cor != psi_last) || (eps_cor != eps_last))
 	{
-		nutation(jd_tdb, -1, accuracy, z0, w1);
+		nutation_cor(jd_tdb, -1, accuracy, psi_cor, eps_cor, z0, w1);
 		precession(jd_tdb, w1, T0, w2);
 		frame_tie(w2, -1, zz);
 
 		t_last = jd_tdb;
+		psi_last = psi_cor;
+		eps_last = eps_cor;
 		ref_sys_last = ref_sys;
 	}
 	else
@@ -7789,7 +8159,7 @@ short int cio_basis(double jd_tdb, double ra_cio, short int ref_sys,
 		   Rotate the vector into the GCRS to form unit vector x.
 		*/
 
-		nutation(jd_tdb, -1, accuracy, w0, w1);
+		nutation_cor(jd_tdb, -1, accuracy, psi_cor, eps_cor, w0, w1);
 		precession(jd_tdb, w1, T0, w2);
 		frame_tie(w2, -1, xx);
 
@@ -7877,8 +8247,10 @@ short int cio_array(double jd_tdb, long int n_pts,
 			 = 1 ... error opening the 'cio_ra.bin' file.
 			 = 2 ... 'jd_tdb' not in the range of the CIO file.
 			 = 3 ... 'n_pts' out of range.
-			 = 4 ... unable to allocate memory for the internal 't' array.
-			 = 5 ... unable to allocate memory for the internal 'ra' array.
+			 = 4 ... unable to allocate memory for the internal 't' array
+					 (no longer returned, see ASCOM note).
+			 = 5 ... unable to allocate memory for the internal 'ra' array
+					 (no longer returned, see ASCOM note).
 			 = 6 ... 'jd_tdb' is too close to either end of the CIO file;
 					 unable to put 'n_pts' data points into the output
 					 structure.
@@ -7892,10 +8264,9 @@ short int cio_array(double jd_tdb, long int n_pts,
 		  fopen              stdio.h
 		  fread              stdio.h
 		  fclose             stdio.h
-		  abs                math.h
-		  free               stdlib.h
-		  calloc             stdlib.h
-		  fseek              stdio.h
+		  cheby_open_uniform cheby_engine.c
+		  cheby_segment      cheby_engine.c
+		  memcpy             string.h
 
 	   VER./DATE/
 	   PROGRAMMER:
@@ -7911,6 +8282,10 @@ short int cio_array(double jd_tdb, long int n_pts,
 		  your executable.  This file is created by program 'cio_file.c',
 		  included in the NOVAS-C package.  On the first call to this
 		  function, file 'cio_ra.bin' is opened in read mode.
+		  2. ASCOM - The file is mapped into memory through cheby_engine.c
+		  and the records are copied straight from the mapping, in place of
+		  the file-read strategies of V1.2.  No state changes after the
+		  first call.
 
 	------------------------------------------------------------------------
 	*/
@@ -7918,24 +8293,24 @@ short int cio_array(double jd_tdb, long int n_pts,
 	static short int first_call = 1;
 	short int error = 0;
 
-	static long int last_index_rec = -50L;
-	static long int last_n_pts = 0L;
 	static long int header_size, record_size, n_recs;
 	long int min_pts = 2;
 	long int max_pts = 20;
-	long int  del_n_pts, index_rec, half_int, lo_limit, hi_limit,
-		del_index, abs_del_index, bytes_to_lo, n_swap, n_read, i, j;
+	long int index_rec, half_int, lo_limit, hi_limit, i;
 
-	static double jd_beg, jd_end, t_int, *t, *ra;
-	double t_temp, ra_temp;
+	static double jd_beg, jd_end, t_int;
 
 	static size_t double_size, long_size;
 
-	static FILE *cio_file;
+	static cheby_handle cio_handle;
+
+	FILE *cio_file;
+
+	const unsigned char *rec;
 
 	/*
-	   Set the sizes of the file header and data records, open the CIO file,
-	   and read the file header on the first call to this function.
+	   Set the sizes of the file header and data records, read the file
+	   header and map the file on the first call to this function.
 	*/
 
 	if (first_call)
@@ -7965,6 +8340,17 @@ short int cio_array(double jd_tdb, long int n_pts,
 		fread(&jd_end, double_size, (size_t)1, cio_file);
 		fread(&t_int, double_size, (size_t)1, cio_file);
 		fread(&n_recs, long_size, (size_t)1, cio_file);
+		fclose(cio_file);
+
+		/*
+		   ASCOM - Map the data records.
+		*/
+
+		if (cheby_open_uniform(RACIO_FILE_NAME, jd_beg, t_int, n_recs,
+			header_size, record_size, &cio_handle) != 0)
+			return (error = 1);
+
+		first_call = 0;
 	}
 
 	/*
@@ -7977,43 +8363,6 @@ short int cio_array(double jd_tdb, long int n_pts,
 	if ((n_pts < min_pts) || (n_pts > max_pts))
 		return (error = 3);
 
-	/*
-	   Calculate the difference between the current value of 'n_pts' and
-	   the last value of 'n_pts'.
-	*/
-
-	del_n_pts = abs(n_pts - last_n_pts);
-
-	/*
-	   Allocate memory for the 't' and 'ra' arrays.
-	*/
-
-	if (del_n_pts != 0L)
-	{
-		if (!first_call)
-		{
-			free(t);
-			free(ra);
-		}
-
-		t = (double *)calloc((size_t)n_pts, double_size);
-		if (t == NULL)
-		{
-			fclose(cio_file);
-			return (error = 4);
-		}
-
-		ra = (double *)calloc((size_t)n_pts, double_size);
-		if (ra == NULL)
-		{
-			free(t);
-			fclose(cio_file);
-			return (error = 5);
-		}
-
-		first_call = 0;
-	}
-
 	/*
 	   Calculate the record number of the record immediately preceding
 	   the date of interest: the "index record".
@@ -8034,137 +8383,16 @@ short int cio_array(double jd_tdb, long int n_pts,
 		return (error = 6);
 
 	/*
-	   Compute the number of bytes from the beginning of the file to
-	   the 'lo_limit'.
+	   Load the output 'cio' array from the mapped records.
 	*/
 
-	bytes_to_lo = header_size + (lo_limit - 1L) * record_size;
-
-	/*
-	   Compare the current index record with the previous index record.
-	*/
-
-	del_index = index_rec - last_index_rec;
-	abs_del_index = abs(del_index);
-
-	/*
-	   Determine the file read strategy.
-	*/
-
-	/*
-	   Case 1: The input value of 'n_pts' changed since the last entry,
-	   or there are no data in the current arrays that can be re-used in the
-	   new arrays.  In this case, read all new data points into the arrays.
-	*/
-
-	if ((abs_del_index > n_pts) || (del_n_pts != 0))
-	{
-		fseek(cio_file, bytes_to_lo, SEEK_SET);
-
-		for (i = 0L; i < n_pts; i++)
-		{
-			fread(&t[i], double_size, (size_t)1, cio_file);
-			fread(&ra[i], double_size, (size_t)1, cio_file);
-		}
-	}
-
-	/*
-	   Case 2: The new index is close enough to the previous index that
-	   there are some data in the current arrays that can be re-used
-	   in the new arrays.  The remaining data will be read from the CIO
-	   file.
-
-	   Note that if the new index is the same as the previous index (i.e.,
-	   'del_index' == 0), neither Case 2a nor 2b is satisfied, and the
-	   program flow goes directly to load the output arrays with the same
-	   values as in the current arrays.
-	*/
-
-	else if ((abs_del_index <= n_pts) && (del_n_pts == 0))
-	{
-		n_swap = abs(n_pts - abs_del_index);
-		n_read = abs_del_index;
-
-		/*
-		   Case 2a: The new index is less than the previous one.  Put the "old"
-		   data at the end of the new arrays, and read "new" data into the
-		   beginning of the new arrays.
-		*/
-
-		if (del_index < 0L)
-		{
-			for (i = 0L; i < n_swap; i++)
-			{
-				t_temp = t[i];
-				ra_temp = ra[i];
-
-				j = i + abs_del_index;
-				t[j] = t_temp;
-				ra[j] = ra_temp;
-			}
-
-			fseek(cio_file, bytes_to_lo, SEEK_SET);
-
-			for (i = 0L; i < n_read; i++)
-			{
-				fread(&t[i], double_size, (size_t)1, cio_file);
-				fread(&ra[i], double_size, (size_t)1, cio_file);
-			}
-		}
-
-		/*
-		   Case 2b: The new index is greater than the previous one.  Put the
-		   "old" data at the beginning of the new arrays, and read "new" data
-		   into the end of the new arrays.
-		*/
-
-		else if (del_index > 0L)
-		{
-			for (i = 0L; i < n_swap; i++)
-			{
-				j = i + abs_del_index;
-				t_temp = t[j];
-				ra_temp = ra[j];
-
-				t[i] = t_temp;
-				ra[i] = ra_temp;
-			}
-
-			fseek(cio_file, bytes_to_lo + (n_swap * record_size),
-				SEEK_SET);
-
-			j = i++;
-			for (i = j; i < n_pts; i++)
-			{
-				fread(&t[i], double_size, (size_t)1, cio_file);
-				fread(&ra[i], double_size, (size_t)1, cio_file);
-			}
-		}
-	}
-
-	/*
-	   Load the output 'cio' array with the values in the 't' and 'ra'
-	   arrays.
-
-	   Note that if the input value of 'n_pts' has not changed since the
-	   last entry, all data in the current arrays can be re-used in
-	   the new arrays. The if statements above are bypassed and the new
-	   arrays are the same as the current arrays.
-	*/
-
-	for (i = 0L; i < n_pts; i++)
+	rec = cheby_segment(&cio_handle, lo_limit - 1L);
+	for (i = 0L; i < n_pts; i++, rec += record_size)
 	{
-		cio[i].jd_tdb = t[i];
-		cio[i].ra_cio = ra[i];
+		memcpy(&cio[i].jd_tdb, rec, sizeof(double));
+		memcpy(&cio[i].ra_cio, rec + sizeof(double), sizeof(double));
 	}
 
-	/*
-	   Set values of 'last_index_rec' and 'last_n_pts'.
-	*/
-
-	last_index_rec = index_rec;
-	last_n_pts = n_pts;
-
 	return (error);
 }
 
@@ -8226,6 +8454,36 @@ double ira_equinox(double jd_tdb, short int equinox,
 		  1. This function is the C version of NOVAS Fortran routine
 		  'eqxra'.
 
+	------------------------------------------------------------------------
+	*/
+{
+	//ASCOM - computed by ira_equinox_cor, given the global pole offsets
+	return (ira_equinox_cor(jd_tdb, equinox, accuracy, PSI_COR, EPS_COR));
+}
+
+/********ira_equinox_cor */
+
+static double ira_equinox_cor(double jd_tdb, short int equinox,
+	short int accuracy, double psi_cor, double eps_cor)
+	/*
+	------------------------------------------------------------------------
+
+	   PURPOSE:
+		  ASCOM - Function 'ira_equinox' with the celestial pole offsets given
+		  as arguments rather than taken from 'PSI_COR' and 'EPS_COR'.
+
+	   INPUT
+	   ARGUMENTS:
+		  As 'ira_equinox', and
+		  psi_cor (double)
+			 Celestial pole offset delta-delta-psi in arcseconds.
+		  eps_cor (double)
+			 Celestial pole offset delta-delta-epsilon in arcseconds.
+
+	   VER./DATE/
+	   PROGRAMMER:
+		  V1.0/10-26/ASCOM
+
 	------------------------------------------------------------------------
 	*/
 {
@@ -8233,6 +8491,7 @@ double ira_equinox(double jd_tdb, short int equinox,
 
 	static double t_last = 0.0;
 	static double eq_eq = 0.0;
+	static double psi_last = 0.0, eps_last = 0.0; //ASCOM
 	double t, u, v, w, x, prec_ra, ra_eq;
 
 	/*
@@ -8248,11 +8507,16 @@ double ira_equinox(double jd_tdb, short int equinox,
 
 	if (equinox == 1)
 	{
-		if (((fabs(jd_tdb - t_last)) > 1.0e-8) || (accuracy != acc_last))
+		//ASCOM - the saved value is also keyed by the pole offsets
+		if (((fabs(jd_tdb - t_last)) > 1.0e-8) || (accuracy != acc_last) ||
+			(psi_cor != psi_last) || (eps_cor != eps_last))
 		{
-			e_tilt(jd_tdb, accuracy, &u, &v, &eq_eq, &w, &x);
+			e_tilt_cor(jd_tdb, accuracy, psi_cor, eps_cor, &u, &v, &eq_eq,
+				&w, &x);
 			t_last = jd_tdb;
 			acc_last = accuracy;
+			psi_last = psi_cor;
+			eps_last = eps_cor;
 		}
 	}
 	else
@@ -8334,6 +8598,7 @@ short int ephemeris(double jd[2], object *cel_obj, short int origin,
 
 	   FUNCTIONS
 	   CALLED:
+		  eph_cache_ephemeris eph_cache.c
 		  solarsystem         novas.c
 		  solarsystem_hp      novas.c
 		  readeph             readeph.c
@@ -8361,6 +8626,8 @@ short int ephemeris(double jd[2], object *cel_obj, short int origin,
 	   NOTES:
 		  1. It is recommended that the input structure 'cel_obj' be
 		  created using function 'make_object' in file novas.c.
+		  2. ASCOM - While a cache window is active (see 'eph_cache_start'
+		  in eph_cache.c) requests within it are answered from the cache.
 
 	------------------------------------------------------------------------
 	*/
@@ -8384,6 +8651,16 @@ short int ephemeris(double jd[2], object *cel_obj, short int origin,
 	if ((origin < 0) || (origin > 1))
 		return (error = 1);
 
+	/*
+	   ASCOM - Answer from the ephemeris cache if it is active and covers
+	   this request.
+	*/
+
+	if ((error = eph_cache_ephemeris(jd, cel_obj, origin, accuracy, pos,
+		vel)) != -1)
+		return error;
+	error = 0;
+
 	/*
 	   Invoke the appropriate ephemeris access software depending upon the
 	   type of object.
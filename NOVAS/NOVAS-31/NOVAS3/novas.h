@@ -325,6 +325,14 @@
 
                  double *zd, double *az, double *rar, double *decr);
 
+   EXPORT void equ2hor_cor (double jd_ut1, double delta_t,
+                     short int accuracy, double xp, double yp,
+                     double psi_cor, double eps_cor, on_surface *location,
+                     double ra, double dec, short int ref_option,
+
+                     double *zd, double *az, double *rar,
+                     double *decr); //ASCOM
+
    EXPORT short int gcrs2equ (double jd_tt, short int coord_sys,
                        short int accuracy, double rag, double decg,
 
@@ -345,6 +353,14 @@
 
                       double *vec2);
 
+   EXPORT short int ter2cel_cor (double jd_ut_high, double jd_ut_low,
+                      double delta_t, short int method,
+                      short int accuracy, short int option, double xp,
+                      double yp, double psi_cor, double eps_cor,
+                      double *vec1,
+
+                      double *vec2); //ASCOM
+
    EXPORT short int cel2ter (double jd_ut_high, double jd_ut_low,
                       double delta_t, short int method,
                       short int accuracy, short int option,
@@ -352,6 +368,14 @@
 
                       double *vec2);
 
+   EXPORT short int cel2ter_cor (double jd_ut_high, double jd_ut_low,
+                      double delta_t, short int method,
+                      short int accuracy, short int option,
+                      double xp, double yp, double psi_cor,
+                      double eps_cor, double *vec1,
+
+                      double *vec2); //ASCOM
+
    EXPORT void spin (double angle, double *pos1,
 
               double *pos2);
@@ -373,6 +397,11 @@
    EXPORT short int cel_pole (double tjd, short int type, double dpole1,
                        double dpole2);
 
+   EXPORT short int cel_pole_cor (double tjd, short int type,
+                       double dpole1, double dpole2,
+
+                       double *psi_cor, double *eps_cor); //ASCOM
+
    EXPORT double ee_ct (double jd_high, double jd_low, short int accuracy);
 
    EXPORT void frame_tie (double *pos1, short int direction,
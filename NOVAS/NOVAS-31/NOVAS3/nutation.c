@@ -14,6 +14,26 @@
    #include "novas.h"
 #endif
 
+/*
+   ASCOM - Global variable.
+
+   'NUT_MODE' selects how the series terms are evaluated.  See function
+   'set_nutation_mode' for more details.
+*/
+
+static short int NUT_MODE = NUT_MODE_LIBM;
+
+static void nut_harmonics (double *arg, short int n_args, short int k_max,
+
+                           double hsin[][2 * NUT_KMAX + 1],
+                           double hcos[][2 * NUT_KMAX + 1]);
+
+static void nut_term (const short int *mult, short int n_args,
+                      double hsin[][2 * NUT_KMAX + 1],
+                      double hcos[][2 * NUT_KMAX + 1],
+
+                      double *sarg, double *carg);
+
 /********iau2000a */
 
 void iau2000a (double jd_high, double jd_low,
@@ -52,10 +72,13 @@ void iau2000a (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_MODE           nutation.c
 
    FUNCTIONS
    CALLED:
       fund_args    novas.c
+      nut_harmonics  nutation.c
+      nut_term     nutation.c
       fmod         math.h
       sin          math.h
       cos          math.h
@@ -73,6 +96,8 @@ void iau2000a (double jd_high, double jd_low,
      nutation and without the corrections to Lieske precession.
      2. This function is the "C" version of NOVAS Fortran routine
      'nu2000a'.
+     3. ASCOM - The terms are evaluated as selected by
+     'set_nutation_mode'.
 
 ------------------------------------------------------------------------
 */
@@ -81,7 +106,8 @@ void iau2000a (double jd_high, double jd_low,
 
    double t, a[5], dp, de, arg, sarg, carg, factor, dpsils, depsls,
       al, alsu, af, ad, aom, alme, alve, alea, alma, alju, alsa, alur,
-      alne, apa, dpsipl, depspl;
+      alne, apa, dpsipl, depspl, b[14], hsin[14][2 * NUT_KMAX + 1],
+      hcos[14][2 * NUT_KMAX + 1];
 
 /*
    Luni-Solar argument multipliers:
@@ -2869,6 +2895,14 @@ void iau2000a (double jd_high, double jd_low,
    dp = 0.0;
    de = 0.0;
 
+/*
+   ASCOM - In the harmonics mode, sines and cosines of multiples of the
+   arguments, from which the terms are built (see 'set_nutation_mode').
+*/
+
+   if (NUT_MODE == NUT_MODE_HARMONICS)
+      nut_harmonics (a, 5, 6, hsin, hcos);
+
 /*
    Summation of luni-solar nutation series (in reverse order).
 */
@@ -2880,14 +2914,21 @@ void iau2000a (double jd_high, double jd_low,
    Argument and functions.
 */
 
-      arg = fmod ((double) nals_t[i][0] * a[0]  +
-                  (double) nals_t[i][1] * a[1]  +
-                  (double) nals_t[i][2] * a[2]  +
-                  (double) nals_t[i][3] * a[3]  +
-                  (double) nals_t[i][4] * a[4], TWOPI);
-
-      sarg = sin (arg);
-      carg = cos (arg);
+      if (NUT_MODE == NUT_MODE_HARMONICS)
+      {
+         nut_term (nals_t[i], 5, hsin, hcos, &sarg, &carg);
+      }
+      else
+      {
+         arg = fmod ((double) nals_t[i][0] * a[0]  +
+                     (double) nals_t[i][1] * a[1]  +
+                     (double) nals_t[i][2] * a[2]  +
+                     (double) nals_t[i][3] * a[3]  +
+                     (double) nals_t[i][4] * a[4], TWOPI);
+
+         sarg = sin (arg);
+         carg = cos (arg);
+      }
 
 /*
    Term.
@@ -2966,6 +3007,30 @@ void iau2000a (double jd_high, double jd_low,
    dp = 0.0;
    de = 0.0;
 
+/*
+   ASCOM - In the harmonics mode, sines and cosines of multiples of the
+   arguments, from which the terms are built (see 'set_nutation_mode').
+*/
+
+   if (NUT_MODE == NUT_MODE_HARMONICS)
+   {
+      b[ 0] = al;
+      b[ 1] = alsu;
+      b[ 2] = af;
+      b[ 3] = ad;
+      b[ 4] = aom;
+      b[ 5] = alme;
+      b[ 6] = alve;
+      b[ 7] = alea;
+      b[ 8] = alma;
+      b[ 9] = alju;
+      b[10] = alsa;
+      b[11] = alur;
+      b[12] = alne;
+      b[13] = apa;
+      nut_harmonics (b, 14, 21, hsin, hcos);
+   }
+
 /*
    Summation of planetary nutation series (in reverse order).
 */
@@ -2977,23 +3042,30 @@ void iau2000a (double jd_high, double jd_low,
    Argument and functions.
 */
 
-      arg = fmod ((double) napl_t[i][ 0] * al    +
-                  (double) napl_t[i][ 1] * alsu  +
-                  (double) napl_t[i][ 2] * af    +
-                  (double) napl_t[i][ 3] * ad    +
-                  (double) napl_t[i][ 4] * aom   +
-                  (double) napl_t[i][ 5] * alme  +
-                  (double) napl_t[i][ 6] * alve  +
-                  (double) napl_t[i][ 7] * alea  +
-                  (double) napl_t[i][ 8] * alma  +
-                  (double) napl_t[i][ 9] * alju  +
-                  (double) napl_t[i][10] * alsa  +
-                  (double) napl_t[i][11] * alur  +
-                  (double) napl_t[i][12] * alne  +
-                  (double) napl_t[i][13] * apa, TWOPI);
-
-      sarg = sin (arg);
-      carg = cos (arg);
+      if (NUT_MODE == NUT_MODE_HARMONICS)
+      {
+         nut_term (napl_t[i], 14, hsin, hcos, &sarg, &carg);
+      }
+      else
+      {
+         arg = fmod ((double) napl_t[i][ 0] * al    +
+                     (double) napl_t[i][ 1] * alsu  +
+                     (double) napl_t[i][ 2] * af    +
+                     (double) napl_t[i][ 3] * ad    +
+                     (double) napl_t[i][ 4] * aom   +
+                     (double) napl_t[i][ 5] * alme  +
+                     (double) napl_t[i][ 6] * alve  +
+                     (double) napl_t[i][ 7] * alea  +
+                     (double) napl_t[i][ 8] * alma  +
+                     (double) napl_t[i][ 9] * alju  +
+                     (double) napl_t[i][10] * alsa  +
+                     (double) napl_t[i][11] * alur  +
+                     (double) napl_t[i][12] * alne  +
+                     (double) napl_t[i][13] * apa, TWOPI);
+
+         sarg = sin (arg);
+         carg = cos (arg);
+      }
 
 /*
    Term.
@@ -3056,9 +3128,12 @@ void iau2000b (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_MODE           nutation.c
 
    FUNCTIONS
    CALLED:
+      nut_harmonics  nutation.c
+      nut_term  nutation.c
       fmod      math.h
       sin       math.h
       cos       math.h
@@ -3074,6 +3149,8 @@ void iau2000b (double jd_high, double jd_low,
    NOTES:
       1. IAU 2000B reproduces the IAU 2000A model to a precision of
       1 milliarcsecond in the interval 1995-2020.
+      2. ASCOM - The terms are evaluated as selected by
+      'set_nutation_mode'.
 
 ------------------------------------------------------------------------
 */
@@ -3089,7 +3166,8 @@ void iau2000b (double jd_high, double jd_low,
    double deplan =  0.000388;
 
    double t, el, elp, f, d, om, arg, dp, de, sarg, carg, factor, dpsils,
-      depsls, dpsipl, depspl;
+      depsls, dpsipl, depspl, b[5], hsin[5][2 * NUT_KMAX + 1],
+      hcos[5][2 * NUT_KMAX + 1];
 
 /*
    Luni-Solar argument multipliers:
@@ -3317,6 +3395,21 @@ void iau2000b (double jd_high, double jd_low,
    dp = 0.0;
    de = 0.0;
 
+/*
+   ASCOM - In the harmonics mode, sines and cosines of multiples of the
+   arguments, from which the terms are built (see 'set_nutation_mode').
+*/
+
+   if (NUT_MODE == NUT_MODE_HARMONICS)
+   {
+      b[ 0] = el;
+      b[ 1] = elp;
+      b[ 2] = f;
+      b[ 3] = d;
+      b[ 4] = om;
+      nut_harmonics (b, 5, 4, hsin, hcos);
+   }
+
 /*
   Summation of luni-solar nutation series (in reverse order).
 */
@@ -3328,14 +3421,21 @@ void iau2000b (double jd_high, double jd_low,
    Argument and functions.
 */
 
-      arg = fmod ((double) nals_t[i][0] * el  +
-                  (double) nals_t[i][1] * elp +
-                  (double) nals_t[i][2] * f   +
-                  (double) nals_t[i][3] * d   +
-                  (double) nals_t[i][4] * om,   TWOPI);
-
-      sarg = sin (arg);
-      carg = cos (arg);
+      if (NUT_MODE == NUT_MODE_HARMONICS)
+      {
+         nut_term (nals_t[i], 5, hsin, hcos, &sarg, &carg);
+      }
+      else
+      {
+         arg = fmod ((double) nals_t[i][0] * el  +
+                     (double) nals_t[i][1] * elp +
+                     (double) nals_t[i][2] * f   +
+                     (double) nals_t[i][3] * d   +
+                     (double) nals_t[i][4] * om,   TWOPI);
+
+         sarg = sin (arg);
+         carg = cos (arg);
+      }
 
 /*
    Term.
@@ -3416,10 +3516,13 @@ void nu2000k (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_MODE           nutation.c
 
    FUNCTIONS
    CALLED:
       fund_args    novas.c
+      nut_harmonics  nutation.c
+      nut_term     nutation.c
       fmod         math.h
       sin          math.h
       cos          math.h
@@ -3441,6 +3544,8 @@ void nu2000k (double jd_high, double jd_low,
      2. NU2000K was developed by G. Kaplan (USNO) in March 2004.
      3. This function is the "C" version of NOVAS Fortran routine
       'nu2000k'.
+     4. ASCOM - The terms are evaluated as selected by
+      'set_nutation_mode'.
 
 ------------------------------------------------------------------------
 */
@@ -3449,7 +3554,8 @@ void nu2000k (double jd_high, double jd_low,
 
    double t, a[5], dp, de, arg, sarg, carg, factor, dpsils,
       depsls, alme, alve, alea, alma, alju, alsa, alur, alne, apa,
-      dpsipl, depspl;
+      dpsipl, depspl, b[14], hsin[14][2 * NUT_KMAX + 1],
+      hcos[14][2 * NUT_KMAX + 1];
 
 /*
    Luni-Solar argument multipliers:
@@ -4484,6 +4590,14 @@ void nu2000k (double jd_high, double jd_low,
    dp = 0.0;
    de = 0.0;
 
+/*
+   ASCOM - In the harmonics mode, sines and cosines of multiples of the
+   arguments, from which the terms are built (see 'set_nutation_mode').
+*/
+
+   if (NUT_MODE == NUT_MODE_HARMONICS)
+      nut_harmonics (a, 5, 6, hsin, hcos);
+
 /*
    Summation of luni-solar nutation series (in reverse order).
 */
@@ -4495,14 +4609,21 @@ void nu2000k (double jd_high, double jd_low,
    Argument and functions.
 */
 
-      arg = fmod ((double) nals_t[i][0] * a[0]  +
-                  (double) nals_t[i][1] * a[1]  +
-                  (double) nals_t[i][2] * a[2]  +
-                  (double) nals_t[i][3] * a[3]  +
-                  (double) nals_t[i][4] * a[4], TWOPI);
-
-      sarg = sin (arg);
-      carg = cos (arg);
+      if (NUT_MODE == NUT_MODE_HARMONICS)
+      {
+         nut_term (nals_t[i], 5, hsin, hcos, &sarg, &carg);
+      }
+      else
+      {
+         arg = fmod ((double) nals_t[i][0] * a[0]  +
+                     (double) nals_t[i][1] * a[1]  +
+                     (double) nals_t[i][2] * a[2]  +
+                     (double) nals_t[i][3] * a[3]  +
+                     (double) nals_t[i][4] * a[4], TWOPI);
+
+         sarg = sin (arg);
+         carg = cos (arg);
+      }
 
 /*
    Term.
@@ -4555,6 +4676,30 @@ void nu2000k (double jd_high, double jd_low,
    dp = 0.0;
    de = 0.0;
 
+/*
+   ASCOM - In the harmonics mode, sines and cosines of multiples of the
+   arguments, from which the terms are built (see 'set_nutation_mode').
+*/
+
+   if (NUT_MODE == NUT_MODE_HARMONICS)
+   {
+      b[ 0] = a[0];
+      b[ 1] = a[1];
+      b[ 2] = a[2];
+      b[ 3] = a[3];
+      b[ 4] = a[4];
+      b[ 5] = alme;
+      b[ 6] = alve;
+      b[ 7] = alea;
+      b[ 8] = alma;
+      b[ 9] = alju;
+      b[10] = alsa;
+      b[11] = alur;
+      b[12] = alne;
+      b[13] = apa;
+      nut_harmonics (b, 14, 21, hsin, hcos);
+   }
+
 /*
    Summation of planetary nutation series (in reverse order).
 */
@@ -4566,23 +4711,30 @@ void nu2000k (double jd_high, double jd_low,
    Argument and functions.
 */
 
-      arg = fmod ((double) napl_t[i][ 0] * a[0]  +
-                  (double) napl_t[i][ 1] * a[1]  +
-                  (double) napl_t[i][ 2] * a[2]  +
-                  (double) napl_t[i][ 3] * a[3]  +
-                  (double) napl_t[i][ 4] * a[4]  +
-                  (double) napl_t[i][ 5] * alme  +
-                  (double) napl_t[i][ 6] * alve  +
-                  (double) napl_t[i][ 7] * alea  +
-                  (double) napl_t[i][ 8] * alma  +
-                  (double) napl_t[i][ 9] * alju  +
-                  (double) napl_t[i][10] * alsa  +
-                  (double) napl_t[i][11] * alur  +
-                  (double) napl_t[i][12] * alne  +
-                  (double) napl_t[i][13] * apa, TWOPI);
-
-      sarg = sin (arg);
-      carg = cos (arg);
+      if (NUT_MODE == NUT_MODE_HARMONICS)
+      {
+         nut_term (napl_t[i], 14, hsin, hcos, &sarg, &carg);
+      }
+      else
+      {
+         arg = fmod ((double) napl_t[i][ 0] * a[0]  +
+                     (double) napl_t[i][ 1] * a[1]  +
+                     (double) napl_t[i][ 2] * a[2]  +
+                     (double) napl_t[i][ 3] * a[3]  +
+                     (double) napl_t[i][ 4] * a[4]  +
+                     (double) napl_t[i][ 5] * alme  +
+                     (double) napl_t[i][ 6] * alve  +
+                     (double) napl_t[i][ 7] * alea  +
+                     (double) napl_t[i][ 8] * alma  +
+                     (double) napl_t[i][ 9] * alju  +
+                     (double) napl_t[i][10] * alsa  +
+                     (double) napl_t[i][11] * alur  +
+                     (double) napl_t[i][12] * alne  +
+                     (double) napl_t[i][13] * apa, TWOPI);
+
+         sarg = sin (arg);
+         carg = cos (arg);
+      }
 
 /*
    Term.
@@ -4604,3 +4756,237 @@ void nu2000k (double jd_high, double jd_low,
 
    return;
 }
+
+/********set_nutation_mode */
+
+short int set_nutation_mode (short int mode)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Selects how the terms of the nutation series in 'iau2000a',
+      'iau2000b' and 'nu2000k' are evaluated.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      mode (short int)
+         Evaluation mode:
+            NUT_MODE_LIBM      ... sine and cosine of the argument of
+                                   each term (the USNO code; default).
+            NUT_MODE_HARMONICS ... each term built by angle addition
+                                   from the sines and cosines of
+                                   multiples of the fundamental
+                                   arguments, formed once per call.
+         Any other value leaves the mode unchanged.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         Mode in effect before the call.
+
+   GLOBALS
+   USED:
+      NUT_MODE           nutation.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The two modes agree to better than 1.0e-14 radians in dpsi and
+         deps.  The harmonics mode makes two calls each to sin and cos
+         per fundamental argument instead of one call each per term,
+         and is the faster of the two.
+      2. The mode is global.  Set it before the nutation functions are
+         used from more than one thread.
+
+------------------------------------------------------------------------
+*/
+{
+   short int old_mode;
+
+   old_mode = NUT_MODE;
+   if ((mode == NUT_MODE_LIBM) || (mode == NUT_MODE_HARMONICS))
+      NUT_MODE = mode;
+
+   return old_mode;
+}
+
+/********nut_harmonics */
+
+static void nut_harmonics (double *arg, short int n_args, short int k_max,
+
+                           double hsin[][2 * NUT_KMAX + 1],
+                           double hcos[][2 * NUT_KMAX + 1])
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Forms the sines and cosines of -k_max to +k_max times each of a
+      set of fundamental arguments, for 'nut_term'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *arg (double)
+         Fundamental arguments, in radians.
+      n_args (short int)
+         Number of fundamental arguments.
+      k_max (short int)
+         Largest multiplier (at most NUT_KMAX).
+
+   OUTPUT
+   ARGUMENTS:
+      hsin[][2 * NUT_KMAX + 1] (double)
+         hsin[j][NUT_KMAX + k] is sin (k * arg[j]), k = -k_max to k_max.
+      hcos[][2 * NUT_KMAX + 1] (double)
+         hcos[j][NUT_KMAX + k] is cos (k * arg[j]), k = -k_max to k_max.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      sin          math.h
+      cos          math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The multiples are built by the angle-addition recurrence from
+      sin (arg[j]) and cos (arg[j]); the error of the k-th grows about
+      as k times the rounding error of one step.
+
+------------------------------------------------------------------------
+*/
+{
+   short int j, k;
+
+   double *s, *c;
+
+   for (j = 0; j < n_args; j++)
+   {
+      s = hsin[j] + NUT_KMAX;
+      c = hcos[j] + NUT_KMAX;
+
+      s[0] = 0.0;
+      c[0] = 1.0;
+      s[1] = sin (arg[j]);
+      c[1] = cos (arg[j]);
+
+      for (k = 2; k <= k_max; k++)
+      {
+         s[k] = s[k-1] * c[1] + c[k-1] * s[1];
+         c[k] = c[k-1] * c[1] - s[k-1] * s[1];
+      }
+
+      for (k = 1; k <= k_max; k++)
+      {
+         s[-k] = -s[k];
+         c[-k] =  c[k];
+      }
+   }
+
+   return;
+}
+
+/********nut_term */
+
+static void nut_term (const short int *mult, short int n_args,
+                      double hsin[][2 * NUT_KMAX + 1],
+                      double hcos[][2 * NUT_KMAX + 1],
+
+                      double *sarg, double *carg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the sine and cosine of the argument of one nutation
+      term from the harmonics formed by 'nut_harmonics'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *mult (short int)
+         Multipliers of the fundamental arguments for the term.
+      n_args (short int)
+         Number of fundamental arguments.
+      hsin[][2 * NUT_KMAX + 1] (double)
+      hcos[][2 * NUT_KMAX + 1] (double)
+         Sines and cosines of the multiples of the fundamental
+         arguments, from 'nut_harmonics'.
+
+   OUTPUT
+   ARGUMENTS:
+      *sarg (double)
+         Sine of the argument of the term.
+      *carg (double)
+         Cosine of the argument of the term.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Arguments with a zero multiplier are skipped, so most terms
+      take only two or three angle additions.
+
+------------------------------------------------------------------------
+*/
+{
+   short int j;
+
+   double s, c, t;
+
+   s = 0.0;
+   c = 1.0;
+
+   for (j = 0; j < n_args; j++)
+   {
+      if (mult[j] == 0)
+         continue;
+
+      t = s * hcos[j][NUT_KMAX + mult[j]] + c * hsin[j][NUT_KMAX + mult[j]];
+      c = c * hcos[j][NUT_KMAX + mult[j]] - s * hsin[j][NUT_KMAX + mult[j]];
+      s = t;
+   }
+
+   *sarg = s;
+   *carg = c;
+
+   return;
+}
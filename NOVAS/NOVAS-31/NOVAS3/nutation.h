@@ -13,6 +13,17 @@
 #ifndef _NUTATION_
    #define _NUTATION_
 
+/*
+   ASCOM - Evaluation modes of the nutation series (see
+   'set_nutation_mode'), and the largest multiple of a fundamental
+   argument formed in the harmonics mode.
+*/
+
+   #define NUT_MODE_LIBM       0
+   #define NUT_MODE_HARMONICS  1
+
+   #define NUT_KMAX 24
+
 /*
    Function prototypes
 */
@@ -29,4 +40,6 @@
 
                  double *dpsi, double *deps);
 
+   EXPORT short int set_nutation_mode (short int mode);
+
 #endif
@@ -0,0 +1,607 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  rise_set.c: Rise, set, transit and altitude crossings of many targets
+              for one observer
+
+  A scheduler that samples 'equ2hor' every minute for every target
+  repeats the Earth rotation and polar motion for each sample.
+  'rise_set' takes them out of the target loop:  the sidereal time and
+  the observer's zenith and west directions are found once per step of
+  a coarse sweep, so that each step costs a pair of dot products per
+  target, run over arrays.  Between meridian passages the altitude of a
+  target changes in one direction only, so every crossing lies in a step
+  where its sign changes, or on one side of a meridian passage in the
+  step, and is refined there for its own target.
+*/
+
+#ifndef _RISESET_
+   #include "rise_set.h"
+#endif
+
+#include <stdlib.h>
+#include <math.h>
+
+/*
+   Work space shared by the sweep and the refinement.
+*/
+
+typedef struct
+{
+   long int n_targets;
+   short int n_knots;
+   short int parallax;
+   double window;
+   long int n_steps;
+   double step;
+   double *theta;
+   double vz[3];
+   double vw[3];
+   double vo[3];
+   double *px;
+   double *py;
+   double *pz;
+   double *sin_h;
+} rise_set_work;
+
+static void rise_set_weights (rise_set_work *w, double t, double *wt);
+
+static double rise_set_f (rise_set_work *w, long int i, short int kind,
+                          double t);
+
+static double rise_set_root (rise_set_work *w, long int i, short int kind,
+                             double ta, double fa, double tb, double fb);
+
+static void rise_set_cross (rise_set_work *w, long int i, double jd_ut1_beg,
+                            double ta, double fa, double tb, double fb,
+                            double *rise, double *set);
+
+/********rise_set */
+
+short int rise_set (double jd_ut1_beg, double window, double delta_t,
+                    double xp, double yp, short int accuracy,
+                    on_surface *location, short int ref_option,
+                    long int n_targets, short int n_knots, double *ra,
+                    double *dec, double *dis, double *alt,
+
+                    double *rise, double *transit, double *set,
+                    short int *above)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Finds the first rise, upper transit and set of each of an array of
+      targets in a time window, for one observer.  'Rise' and 'set' may
+      be taken at any altitude, so the same function gives twilight,
+      airmass limits and other altitude crossings.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_ut1_beg (double)
+         UT1 Julian date of the start of the window.
+      window (double)
+         Length of the window (days).
+      delta_t (double)
+         Difference TT-UT1 in seconds, as for 'equ2hor'.
+      xp (double)
+         Conventionally-defined x coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds.
+      yp (double)
+         Conventionally-defined y coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds.
+      accuracy (short int)
+         Accuracy of the sidereal time, as for 'equ2hor'.
+      *location (struct on_surface)
+         The observer.
+      ref_option (short int)
+         Refraction option, as for 'equ2hor':  the altitudes in 'alt'
+         are observed altitudes, refracted by 'refract' unless
+         'ref_option' = 0.
+      n_targets (long int)
+         Number of targets.
+      n_knots (short int)
+         Number of places given for each target, from 1 to
+         RISE_SET_MAX_KNOTS.
+      *ra (double)
+         Topocentric right ascensions (hours), referred to the true
+         equator and equinox of date; n_knots * n_targets values (see
+         note 1).
+      *dec (double)
+         Topocentric declinations (degrees), laid out as 'ra'.
+      *dis (double)
+         Geocentric distances (AU), laid out as 'ra', or NULL.  With
+         distances, 'ra' and 'dec' are geocentric places and the
+         parallax of the observer is applied (see note 1).
+      *alt (double)
+         Altitude of the rise and set of each target (degrees), or NULL
+         for the horizon.
+
+   OUTPUT
+   ARGUMENTS:
+      *rise (double)
+         UT1 Julian date of the first rise of each target in the window,
+         or RISE_SET_NONE.  May be NULL if not wanted.
+      *transit (double)
+         UT1 Julian date of the first upper transit of each target in
+         the window, or RISE_SET_NONE.  May be NULL if not wanted.
+      *set (double)
+         UT1 Julian date of the first set of each target in the window,
+         or RISE_SET_NONE.  May be NULL if not wanted.
+      *above (short int)
+         1 if the target is above its altitude at the start of the
+         window, 0 if not, so that a target with neither rise nor set is
+         known to be up all the time or not at all.  May be NULL if not
+         wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid window, 'n_targets' or 'n_knots'.
+         3 ... Unable to allocate memory.
+         > 10  10 + error from function 'sidereal_time'.
+
+   GLOBALS
+   USED:
+      DEG2RAD, TWOPI     novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sidereal_time      novas.c
+      terra              novas.c
+      wobble             novas.c
+      refract            novas.c
+      rise_set_weights   rise_set.c
+      rise_set_f         rise_set.c
+      rise_set_root      rise_set.c
+      rise_set_cross     rise_set.c
+      malloc             stdlib.h
+      free               stdlib.h
+      sin                math.h
+      cos                math.h
+      sqrt               math.h
+      ceil               math.h
+      floor              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Place k of target i is ra[k * n_targets + i], dec[k *
+         n_targets + i], at UT1 Julian date jd_ut1_beg + window * k /
+         (n_knots - 1).  A single place is held fixed across the window,
+         which suits stars over a night.  For the Sun, Moon and planets,
+         the geocentric places and distances from 'place' (coord_sys =
+         1, an observer at the geocenter) at a few knots are
+         interpolated by the polynomial through all of them, and the
+         observer's position from 'terra' is taken off at each time;
+         the topocentric place itself swings with the parallax once a
+         day, which a few knots cannot follow.  Five knots a day hold
+         the Moon to about an arcsecond; the diurnal aberration (0.3
+         arcsecond at most) is left out.
+      2. The directions of the zenith and of the west are those of
+         'equ2hor', polar motion included, and the sidereal time is
+         found by 'sidereal_time' at each step of the sweep and
+         interpolated linearly between the steps.  'Transit' is the
+         passage through the plane of the zenith and the ITRS pole,
+         where 'equ2hor' gives an azimuth of 180 or 0 degrees.
+      3. Refraction is applied to the altitudes in 'alt', once per
+         target:  'refract' takes the observed zenith distance, so the
+         crossing of the unrefracted altitude that it gives is exact.
+         With 'ref_option' = 0 the conventional allowances (-0.5667
+         degrees for refraction at the horizon, less the semidiameter
+         of the Sun or the Moon) belong in 'alt'.
+      4. Only the first event of each kind is returned.  A window of a
+         day holds a second rise of a star that rises in its first four
+         minutes.
+      5. The altitude is taken to change in one direction only between
+         meridian passages.  That is exact for a fixed place; for a
+         moving target it can fail only where the target just grazes
+         the altitude, near a meridian passage.
+      6. The times are refined to RISE_SET_TOL days.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0, k;
+
+   long int i, j, nk;
+
+   double *work, *alt0, *alt1, *west0, *west1, *swap,
+      wt[RISE_SET_MAX_KNOTS], gst, jd_tdb, sinlat, coslat, sinlon, coslon,
+      uze[3], uwe[3], uoe[3], vel[3], uz[3], uw[3], ro[3], c, s, x, y, z,
+      r, h, t, t0, tm, fm;
+
+   rise_set_work w;
+
+   if ((window <= 0.0) || (n_targets < 0) || (n_knots < 1) ||
+       (n_knots > RISE_SET_MAX_KNOTS))
+      return 1;
+   if (n_targets == 0)
+      return 0;
+
+   w.n_targets = n_targets;
+   w.n_knots = n_knots;
+   w.parallax = (short int) (dis != NULL);
+   w.window = window;
+   w.n_steps = (long int) ceil (window / RISE_SET_STEP - 1.0e-9);
+   if (w.n_steps < 1)
+      w.n_steps = 1;
+   w.step = window / (double) w.n_steps;
+
+   nk = (long int) n_knots * n_targets;
+   if ((work = (double *) malloc ((size_t) (w.n_steps + 1 + 3 * nk + 5 *
+                                            n_targets) *
+                                  sizeof (double))) == NULL)
+      return 3;
+   w.theta = work;
+   w.px = w.theta + w.n_steps + 1;
+   w.py = w.px + nk;
+   w.pz = w.py + nk;
+   w.sin_h = w.pz + nk;
+   alt0 = w.sin_h + n_targets;
+   alt1 = alt0 + n_targets;
+   west0 = alt1 + n_targets;
+   west1 = west0 + n_targets;
+
+/*
+   Greenwich apparent sidereal time at each step, as an angle that runs
+   on across the window.
+*/
+
+   for (j = 0; j <= w.n_steps; j++)
+   {
+      if ((error = sidereal_time (jd_ut1_beg, (double) j * w.step, delta_t,
+                                  1, 1, accuracy, &gst)) != 0)
+      {
+         free (work);
+         return (short int) (10 + error);
+      }
+      w.theta[j] = gst * 15.0 * DEG2RAD;
+      if (j > 0)
+         w.theta[j] += TWOPI * (floor ((w.theta[j - 1] - w.theta[j]) /
+                                       TWOPI) + 1.0);
+   }
+
+/*
+   Zenith, west and the observer's position in the Earth-fixed system,
+   as 'equ2hor' and 'terra', with polar motion applied once for the
+   window.
+*/
+
+   sinlat = sin (location->latitude * DEG2RAD);
+   coslat = cos (location->latitude * DEG2RAD);
+   sinlon = sin (location->longitude * DEG2RAD);
+   coslon = cos (location->longitude * DEG2RAD);
+   uze[0] = coslat * coslon;
+   uze[1] = coslat * sinlon;
+   uze[2] = sinlat;
+   uwe[0] = sinlon;
+   uwe[1] = -coslon;
+   uwe[2] = 0.0;
+   terra (location, 0.0, uoe, vel);
+   if ((xp == 0.0) && (yp == 0.0))
+   {
+      for (k = 0; k < 3; k++)
+      {
+         w.vz[k] = uze[k];
+         w.vw[k] = uwe[k];
+         w.vo[k] = uoe[k];
+      }
+   }
+   else
+   {
+      jd_tdb = jd_ut1_beg + 0.5 * window + delta_t / 86400.0;
+      wobble (jd_tdb, 0, xp, yp, uze, w.vz);
+      wobble (jd_tdb, 0, xp, yp, uwe, w.vw);
+      wobble (jd_tdb, 0, xp, yp, uoe, w.vo);
+   }
+
+/*
+   Unit vectors of the places, or geocentric positions (AU) with
+   distances, and the sine of each altitude without refraction.
+*/
+
+   for (i = 0; i < nk; i++)
+   {
+      r = (dis != NULL) ? dis[i] : 1.0;
+      c = r * cos (dec[i] * DEG2RAD);
+      w.px[i] = c * cos (ra[i] * 15.0 * DEG2RAD);
+      w.py[i] = c * sin (ra[i] * 15.0 * DEG2RAD);
+      w.pz[i] = r * sin (dec[i] * DEG2RAD);
+   }
+   for (i = 0; i < n_targets; i++)
+   {
+      h = (alt != NULL) ? alt[i] : 0.0;
+      if (ref_option != 0)
+         h -= refract (location, ref_option, 90.0 - h);
+      w.sin_h[i] = sin (h * DEG2RAD);
+      if (rise != NULL)
+         rise[i] = RISE_SET_NONE;
+      if (transit != NULL)
+         transit[i] = RISE_SET_NONE;
+      if (set != NULL)
+         set[i] = RISE_SET_NONE;
+   }
+
+/*
+   The sweep.
+*/
+
+   for (j = 0; j <= w.n_steps; j++)
+   {
+      t = (double) j * w.step;
+      c = cos (w.theta[j]);
+      s = sin (w.theta[j]);
+      uz[0] = c * w.vz[0] - s * w.vz[1];
+      uz[1] = s * w.vz[0] + c * w.vz[1];
+      uz[2] = w.vz[2];
+      uw[0] = c * w.vw[0] - s * w.vw[1];
+      uw[1] = s * w.vw[0] + c * w.vw[1];
+      uw[2] = w.vw[2];
+      ro[0] = c * w.vo[0] - s * w.vo[1];
+      ro[1] = s * w.vo[0] + c * w.vo[1];
+      ro[2] = w.vo[2];
+
+/*
+   Altitude (as the sine, less that of the target's altitude) and west
+   component of every target at this step.
+*/
+
+      if ((n_knots == 1) && (dis == NULL))
+      {
+         for (i = 0; i < n_targets; i++)
+         {
+            alt1[i] = w.px[i] * uz[0] + w.py[i] * uz[1] + w.pz[i] * uz[2] -
+               w.sin_h[i];
+            west1[i] = w.px[i] * uw[0] + w.py[i] * uw[1] + w.pz[i] * uw[2];
+         }
+      }
+      else
+      {
+         if (n_knots == 1)
+            wt[0] = 1.0;
+         else
+            rise_set_weights (&w, t, wt);
+         if (dis == NULL)
+            ro[0] = ro[1] = ro[2] = 0.0;
+         for (i = 0; i < n_targets; i++)
+         {
+            x = -ro[0];
+            y = -ro[1];
+            z = -ro[2];
+            for (k = 0; k < n_knots; k++)
+            {
+               x += wt[k] * w.px[k * n_targets + i];
+               y += wt[k] * w.py[k * n_targets + i];
+               z += wt[k] * w.pz[k * n_targets + i];
+            }
+            r = 1.0 / sqrt (x * x + y * y + z * z);
+            alt1[i] = (x * uz[0] + y * uz[1] + z * uz[2]) * r - w.sin_h[i];
+            west1[i] = (x * uw[0] + y * uw[1] + z * uw[2]) * r;
+         }
+      }
+
+/*
+   Events since the last step.  A change of sign of the west component
+   is a meridian passage, upper if the target moves to the west; the
+   altitude is refined on each side of it.
+*/
+
+      if (j == 0)
+      {
+         if (above != NULL)
+            for (i = 0; i < n_targets; i++)
+               above[i] = (short int) (alt1[i] >= 0.0);
+      }
+      else
+      {
+         t0 = (double) (j - 1) * w.step;
+         for (i = 0; i < n_targets; i++)
+         {
+            if ((west0[i] < 0.0) != (west1[i] < 0.0))
+            {
+               tm = rise_set_root (&w, i, 1, t0, west0[i], t, west1[i]);
+               fm = rise_set_f (&w, i, 0, tm);
+               if ((transit != NULL) && (west0[i] < 0.0) &&
+                   (transit[i] == RISE_SET_NONE))
+                  transit[i] = jd_ut1_beg + tm;
+               rise_set_cross (&w, i, jd_ut1_beg, t0, alt0[i], tm, fm, rise,
+                               set);
+               rise_set_cross (&w, i, jd_ut1_beg, tm, fm, t, alt1[i], rise,
+                               set);
+            }
+            else
+               rise_set_cross (&w, i, jd_ut1_beg, t0, alt0[i], t, alt1[i],
+                               rise, set);
+         }
+      }
+
+      swap = alt0;
+      alt0 = alt1;
+      alt1 = swap;
+      swap = west0;
+      west0 = west1;
+      west1 = swap;
+   }
+
+   free (work);
+   return 0;
+}
+
+/********rise_set_weights */
+
+static void rise_set_weights (rise_set_work *w, double t, double *wt)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Weights of the knots in the polynomial through all of them, at
+      time 't' (days from the start of the window).
+
+------------------------------------------------------------------------
+*/
+{
+   short int k, m;
+
+   double h = w->window / (double) (w->n_knots - 1);
+
+   for (k = 0; k < w->n_knots; k++)
+   {
+      wt[k] = 1.0;
+      for (m = 0; m < w->n_knots; m++)
+         if (m != k)
+            wt[k] *= (t - (double) m * h) / ((double) (k - m) * h);
+   }
+
+   return;
+}
+
+/********rise_set_f */
+
+static double rise_set_f (rise_set_work *w, long int i, short int kind,
+                          double t)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      For target 'i' at time 't' (days from the start of the window),
+      the sine of the altitude less that of the target's altitude
+      ('kind' = 0), or the west component of its direction ('kind' =
+      1).
+
+------------------------------------------------------------------------
+*/
+{
+   short int k;
+
+   long int j;
+
+   double wt[RISE_SET_MAX_KNOTS], theta, c, s, x, y, z, r, *v, d;
+
+   j = (long int) (t / w->step);
+   if (j > w->n_steps - 1)
+      j = w->n_steps - 1;
+   if (j < 0)
+      j = 0;
+   theta = w->theta[j] + (w->theta[j + 1] - w->theta[j]) *
+      (t - (double) j * w->step) / w->step;
+   c = cos (theta);
+   s = sin (theta);
+
+   if ((w->n_knots == 1) && (w->parallax == 0))
+   {
+      x = w->px[i];
+      y = w->py[i];
+      z = w->pz[i];
+   }
+   else
+   {
+      if (w->n_knots == 1)
+         wt[0] = 1.0;
+      else
+         rise_set_weights (w, t, wt);
+      x = y = z = 0.0;
+      if (w->parallax != 0)
+      {
+         x = -(c * w->vo[0] - s * w->vo[1]);
+         y = -(s * w->vo[0] + c * w->vo[1]);
+         z = -w->vo[2];
+      }
+      for (k = 0; k < w->n_knots; k++)
+      {
+         x += wt[k] * w->px[k * w->n_targets + i];
+         y += wt[k] * w->py[k * w->n_targets + i];
+         z += wt[k] * w->pz[k * w->n_targets + i];
+      }
+      r = 1.0 / sqrt (x * x + y * y + z * z);
+      x *= r;
+      y *= r;
+      z *= r;
+   }
+
+   v = (kind == 0) ? w->vz : w->vw;
+   d = c * (x * v[0] + y * v[1]) + s * (y * v[0] - x * v[1]) + z * v[2];
+
+   return (kind == 0) ? d - w->sin_h[i] : d;
+}
+
+/********rise_set_root */
+
+static double rise_set_root (rise_set_work *w, long int i, short int kind,
+                             double ta, double fa, double tb, double fb)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Refines the root of 'rise_set_f' for target 'i' between 'ta' and
+      'tb', where it has the values 'fa' and 'fb' of opposite sign, by
+      the Illinois form of the method of false position.
+
+------------------------------------------------------------------------
+*/
+{
+   short int iter, side = 0;
+
+   double t = ta, t_last, f;
+
+   for (iter = 0; iter < 60; iter++)
+   {
+      t_last = t;
+      t = (ta * fb - tb * fa) / (fb - fa);
+      if (((iter > 0) && (fabs (t - t_last) < RISE_SET_TOL)) ||
+          (tb - ta < RISE_SET_TOL))
+         break;
+      if ((f = rise_set_f (w, i, kind, t)) == 0.0)
+         break;
+      if ((f < 0.0) == (fa < 0.0))
+      {
+         ta = t;
+         fa = f;
+         if (side == -1)
+            fb *= 0.5;
+         side = -1;
+      }
+      else
+      {
+         tb = t;
+         fb = f;
+         if (side == 1)
+            fa *= 0.5;
+         side = 1;
+      }
+   }
+
+   return t;
+}
+
+/********rise_set_cross */
+
+static void rise_set_cross (rise_set_work *w, long int i, double jd_ut1_beg,
+                            double ta, double fa, double tb, double fb,
+                            double *rise, double *set)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Records the rise or set of target 'i' between 'ta' and 'tb', if
+      the altitude crosses there and no earlier event of the kind has
+      been found.
+
+------------------------------------------------------------------------
+*/
+{
+   double *event;
+
+   if ((fa < 0.0) == (fb < 0.0))
+      return;
+   event = (fb >= 0.0) ? rise : set;
+   if ((event != NULL) && (event[i] == RISE_SET_NONE))
+      event[i] = jd_ut1_beg + rise_set_root (w, i, 0, ta, fa, tb, fb);
+
+   return;
+}
@@ -0,0 +1,43 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  rise_set.h: Header file for rise_set.c, rise, set, transit and
+              altitude crossings of many targets for one observer
+*/
+
+#ifndef _RISESET_
+   #define _RISESET_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+/*
+   RISE_SET_STEP      = longest step of the sweep across the window
+                        (days)
+   RISE_SET_MAX_KNOTS = largest number of places given per target
+   RISE_SET_TOL       = precision of the event times (days)
+   RISE_SET_NONE      = event time returned when the event does not
+                        happen in the window
+*/
+
+   #define RISE_SET_STEP (1.0 / 24.0)
+   #define RISE_SET_MAX_KNOTS 9
+   #define RISE_SET_TOL 1.0e-8
+   #define RISE_SET_NONE 0.0
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int rise_set (double jd_ut1_beg, double window,
+                              double delta_t, double xp, double yp,
+                              short int accuracy, on_surface *location,
+                              short int ref_option, long int n_targets,
+                              short int n_knots, double *ra, double *dec,
+                              double *dis, double *alt,
+
+                              double *rise, double *transit, double *set,
+                              short int *above);
+
+#endif
@@ -0,0 +1,1524 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  star_cat.c: Memory-mapped columnar star catalog with a HEALPix index,
+              cone and box queries and the apparent places of the stars
+              selected
+
+  A program that reads its own text catalog and calls 'make_cat_entry'
+  for every star holds the names and the whole catalog in memory, and
+  must look at every star to find those in a field.  'star_cat_convert'
+  writes the catalog once as columns (right ascension, declination,
+  proper motion, parallax, radial velocity, magnitude), sorted by
+  HEALPix cell (nested scheme) with an index of the first star of each
+  cell.  'star_cat_open' maps the file; a query walks the HEALPix tree
+  down to the cells that can touch the field and tests only their stars,
+  and 'star_cat_place' reduces the stars found with the Earth's state,
+  the deflecting bodies and the frame rotation computed once for all of
+  them.
+*/
+
+#ifndef _STARCAT_
+   #include "star_cat.h"
+#endif
+
+#include <string.h>
+#include <math.h>
+
+/*
+   Face coordinates of the twelve HEALPix base cells (Gorski et al.
+   2005):  ring index of the southernmost corner and longitude index.
+*/
+
+static const int JRLL[12] = {2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4};
+
+static const int JPLL[12] = {1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7};
+
+/*
+   Factor on the HEALPix estimate of the largest distance from the
+   center of a cell to its corners, taken as the radius of a circle that
+   holds the cell.  See 'star_cat_pixrad'.
+*/
+
+#define STAR_CAT_PIXRAD_FACTOR 1.1
+
+static long int star_cat_spread (long int v);
+
+static long int star_cat_compress (long int v);
+
+static long int star_cat_pixel (short int order, double ra, double dec);
+
+static void star_cat_vector (short int order, long int pix, double dx,
+                             double dy, double *v);
+
+static double star_cat_pixrad (short int order);
+
+static void star_cat_layout (short int order, long int n_stars,
+                             long int *offset, long int *size);
+
+static short int star_cat_query (star_cat *cat, double ra, double dec,
+                                 double radius, double *box,
+                                 double mag_limit,
+
+                                 star_slice *stars);
+
+static short int star_cat_append (star_cat *cat, long int i,
+                                  star_slice *stars);
+
+/********star_cat_write */
+
+short int star_cat_write (char *name, short int order, long int n_stars,
+                          long int *id, double *ra, double *dec,
+                          double *pm_ra, double *pm_dec, double *parallax,
+                          double *rv, double *mag)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Writes a binary star catalog, to be opened by 'star_cat_open',
+      from arrays of star data.
+
+   REFERENCES:
+      Gorski, K. M. et al. (2005), Astrophys. J. 622, 759 (HEALPix).
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the binary catalog to be written.
+      order (short int)
+         HEALPix order of the cells, from 0 to STAR_CAT_MAX_ORDER.
+      n_stars (long int)
+         Number of stars.
+      *id (long int)
+         Catalog numbers, or NULL to number the stars from 1.
+      *ra (double)
+         ICRS right ascensions (hours) at J2000.0.
+      *dec (double)
+         ICRS declinations (degrees) at J2000.0.
+      *pm_ra (double)
+         Proper motions in right ascension, times the cosine of the
+         declination (milliarcseconds/year), or NULL for none.
+      *pm_dec (double)
+         Proper motions in declination (milliarcseconds/year), or NULL
+         for none.
+      *parallax (double)
+         Parallaxes (milliarcseconds), or NULL for none.
+      *rv (double)
+         Radial velocities (km/s), or NULL for none.
+      *mag (double)
+         Magnitudes, or NULL for none.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid 'order' or 'n_stars'.
+         3 ... Unable to allocate memory.
+         6 ... Unable to create the binary catalog.
+         7 ... Error writing the binary catalog.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      star_cat_pixel     star_cat.c
+      star_cat_layout    star_cat.c
+      malloc             stdlib.h
+      calloc             stdlib.h
+      free               stdlib.h
+      fopen_s            stdio.h
+      fwrite             stdio.h
+      fseek              stdio.h
+      fclose             stdio.h
+      memset             string.h
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The catalog is in the byte order of the machine that wrote it.
+      2. The stars of a cell keep the order in which they are given.
+      3. The values other than the position are held in single
+         precision, which keeps their published digits.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0, c;
+   int head[2];
+   long int n_cells, i, *pix = NULL, *first = NULL, *perm = NULL,
+      offset[9], size;
+   unsigned char header[STAR_CAT_HEADER];
+   double *source, *column = NULL, z = 0.0;
+   int *cells = NULL, *ids;
+   float *fcol;
+   FILE *fp = NULL;
+
+   if ((order < 0) || (order > STAR_CAT_MAX_ORDER) || (n_stars < 0) ||
+       (n_stars > 0x7fffffffL))
+      return 1;
+   n_cells = 12L << (2 * order);
+
+/*
+   Sort the stars by cell:  a count of each cell, then a stable
+   scatter.
+*/
+
+   pix = (long int *) malloc ((size_t) (n_stars + 1) * sizeof (long int));
+   perm = (long int *) malloc ((size_t) (n_stars + 1) * sizeof (long int));
+   first = (long int *) calloc ((size_t) n_cells + 1, sizeof (long int));
+   cells = (int *) malloc (((size_t) n_cells + 1) * sizeof (int));
+   column = (double *) malloc ((size_t) (n_stars + 1) * sizeof (double));
+   if ((pix == NULL) || (perm == NULL) || (first == NULL) ||
+       (cells == NULL) || (column == NULL))
+   {
+      error = 3;
+      goto done;
+   }
+   for (i = 0; i < n_stars; i++)
+   {
+      pix[i] = star_cat_pixel (order, ra[i], dec[i]);
+      first[pix[i] + 1]++;
+   }
+   for (i = 0; i < n_cells; i++)
+   {
+      first[i + 1] += first[i];
+      cells[i] = (int) first[i];
+   }
+   cells[n_cells] = (int) n_stars;
+   for (i = 0; i < n_stars; i++)
+      perm[first[pix[i]]++] = i;
+
+/*
+   Header, cell index, then the columns at their offsets.
+*/
+
+   if (fopen_s (&fp, name, "wb") != 0)
+   {
+      error = 6;
+      goto done;
+   }
+   star_cat_layout (order, n_stars, offset, &size);
+   memset (header, 0, sizeof (header));
+   memcpy (header, STAR_CAT_MAGIC, 8);
+   head[0] = STAR_CAT_VERSION;
+   head[1] = order;
+   memcpy (header + 8, head, sizeof (head));
+   head[0] = (int) n_stars;
+   memcpy (header + 16, head, sizeof (int));
+   if ((fwrite (header, sizeof (header), 1, fp) != 1) ||
+       (fwrite (cells, sizeof (int), (size_t) n_cells + 1, fp) !=
+        (size_t) n_cells + 1))
+      error = 7;
+
+   for (c = 0; (c < 8) && (error == 0); c++)
+   {
+      switch (c)
+      {
+         case 0:  source = ra;        break;
+         case 1:  source = dec;       break;
+         case 2:  source = pm_ra;     break;
+         case 3:  source = pm_dec;    break;
+         case 4:  source = parallax;  break;
+         case 5:  source = rv;        break;
+         case 6:  source = mag;       break;
+         default: source = NULL;      break;
+      }
+      fcol = (float *) column;
+      ids = (int *) column;
+      for (i = 0; i < n_stars; i++)
+      {
+         if (c < 2)
+            column[i] = source[perm[i]];
+         else if (c < 7)
+            fcol[i] = (float) ((source != NULL) ? source[perm[i]] : 0.0);
+         else
+            ids[i] = (int) ((id != NULL) ? id[perm[i]] : perm[i] + 1);
+      }
+      if ((fseek (fp, offset[c], SEEK_SET) != 0) ||
+          ((n_stars > 0) &&
+           (fwrite (column, (c < 2) ? sizeof (double) : sizeof (float),
+                    (size_t) n_stars, fp) != (size_t) n_stars)))
+         error = 7;
+   }
+
+/*
+   Pad the file to its full size.
+*/
+
+   if ((error == 0) && ((fseek (fp, size - 1, SEEK_SET) != 0) ||
+                        (fwrite (&z, 1, 1, fp) != 1)))
+      error = 7;
+   if (fclose (fp) != 0)
+      error = 7;
+
+done:
+   free (pix);
+   free (perm);
+   free (first);
+   free (cells);
+   free (column);
+   return error;
+}
+
+/********star_cat_convert */
+
+short int star_cat_convert (char *text_name, char *cat_name)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Converts a text star catalog to a binary catalog that
+      'star_cat_open' maps directly into memory.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *text_name (char)
+         Name of the text catalog (see note 1).
+      *cat_name (char)
+         Name of the binary catalog to be written.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... File not found or cannot be opened.
+         2 ... Error reading the file.
+         3 ... Unable to allocate memory.
+         5 ... No stars found in the text catalog.
+         6 ... Unable to create the binary catalog.
+         7 ... Error writing the binary catalog.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_open   cheby_engine.c
+      cheby_store_close  cheby_engine.c
+      star_cat_write     star_cat.c
+      realloc            stdlib.h
+      free               stdlib.h
+      strtod             stdlib.h
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Each line of the text catalog holds, separated by spaces, tabs
+         or commas:  catalog number, ICRS right ascension (hours) and
+         declination (degrees) at J2000.0, proper motion in right
+         ascension times the cosine of the declination and in
+         declination (milliarcseconds/year), parallax (milliarcseconds),
+         radial velocity (km/s) and magnitude; the units of 'cat_entry'.
+         Lines that do not start with a number are ignored, so the
+         catalog may have a header and '#' comments.
+      2. The cells are of HEALPix order STAR_CAT_ORDER.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0, k;
+   char line[512], *s, *e;
+   int len;
+   long int pos = 0, next, n = 0, cap = 0;
+   double v[8], *grown, *col[8] = {NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+      NULL};
+   long int *id = NULL, *grown_id;
+   cheby_store text;
+
+   if ((error = cheby_store_open (text_name, &text)) != 0)
+      return error;
+
+   while ((error == 0) && (pos < text.size))
+   {
+
+/*
+   Copy the next line.
+*/
+
+      for (next = pos; (next < text.size) && (text.base[next] != '\n');
+           next++)
+         ;
+      len = (int) (next - pos);
+      if (len > (int) sizeof (line) - 1)
+         len = (int) sizeof (line) - 1;
+      memcpy (line, text.base + pos, (size_t) len);
+      line[len] = '\0';
+      pos = next + 1;
+
+      for (s = line; (*s == ' ') || (*s == '\t'); s++)
+         ;
+      if ((*s < '0') || (*s > '9'))
+         continue;
+      for (k = 0; k < 8; k++)
+      {
+         while ((*s == ' ') || (*s == '\t') || (*s == ','))
+            s++;
+         v[k] = strtod (s, &e);
+         if (e == s)
+            break;
+         s = e;
+      }
+      if (k < 8)
+         continue;
+
+      if (n == cap)
+      {
+         cap = 2 * cap + 4096;
+         for (k = 0; k < 8; k++)
+         {
+            if (k == 0)
+            {
+               if ((grown_id = (long int *) realloc (id, (size_t) cap *
+                                                     sizeof (long int))) ==
+                   NULL)
+                  error = 3;
+               else
+                  id = grown_id;
+            }
+            else
+            {
+               if ((grown = (double *) realloc (col[k], (size_t) cap *
+                                                sizeof (double))) == NULL)
+                  error = 3;
+               else
+                  col[k] = grown;
+            }
+         }
+         if (error != 0)
+            break;
+      }
+      id[n] = (long int) v[0];
+      for (k = 1; k < 8; k++)
+         col[k][n] = v[k];
+      n++;
+   }
+   cheby_store_close (&text);
+
+   if ((error == 0) && (n == 0))
+      error = 5;
+   if (error == 0)
+      error = star_cat_write (cat_name, STAR_CAT_ORDER, n, id, col[1],
+                              col[2], col[3], col[4], col[5], col[6],
+                              col[7]);
+
+   free (id);
+   for (k = 1; k < 8; k++)
+      free (col[k]);
+   return error;
+}
+
+/********star_cat_open */
+
+short int star_cat_open (char *name,
+
+                         star_cat *cat)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Opens a binary star catalog written by 'star_cat_write' or
+      'star_cat_convert', memory mapped where the operating system
+      allows.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *name (char)
+         Name of the binary catalog.
+
+   OUTPUT
+   ARGUMENTS:
+      *cat (struct star_cat)
+         The open catalog.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... File not found or cannot be opened.
+         2 ... Error reading the file.
+         3 ... Unable to allocate memory.
+         4 ... Not a binary star catalog of this version, or shorter
+               than the stars it describes.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_open   cheby_engine.c
+      cheby_store_close  cheby_engine.c
+      star_cat_layout    star_cat.c
+      memset             string.h
+      memcmp             string.h
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The catalog must be released with 'star_cat_close'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+   int head[3];
+   long int offset[9], size;
+   cheby_store store;
+
+   memset (cat, 0, sizeof (star_cat));
+
+   if ((error = cheby_store_open (name, &store)) != 0)
+      return error;
+
+   if ((store.size < STAR_CAT_HEADER) ||
+       (memcmp (store.base, STAR_CAT_MAGIC, 8) != 0))
+   {
+      cheby_store_close (&store);
+      return 4;
+   }
+   memcpy (head, store.base + 8, sizeof (head));
+   if ((head[0] != STAR_CAT_VERSION) || (head[1] < 0) ||
+       (head[1] > STAR_CAT_MAX_ORDER) || (head[2] < 0))
+   {
+      cheby_store_close (&store);
+      return 4;
+   }
+   star_cat_layout ((short int) head[1], (long int) head[2], offset, &size);
+   if (size > store.size)
+   {
+      cheby_store_close (&store);
+      return 4;
+   }
+
+   cat->store = store;
+   cat->order = (short int) head[1];
+   cat->n_cells = 12L << (2 * cat->order);
+   cat->n_stars = (long int) head[2];
+   cat->cell = (const int *) (store.base + STAR_CAT_HEADER);
+   cat->ra = (const double *) (store.base + offset[0]);
+   cat->dec = (const double *) (store.base + offset[1]);
+   cat->pm_ra = (const float *) (store.base + offset[2]);
+   cat->pm_dec = (const float *) (store.base + offset[3]);
+   cat->parallax = (const float *) (store.base + offset[4]);
+   cat->rv = (const float *) (store.base + offset[5]);
+   cat->mag = (const float *) (store.base + offset[6]);
+   cat->id = (const int *) (store.base + offset[7]);
+
+   return 0;
+}
+
+/********star_cat_close */
+
+void star_cat_close (star_cat *cat)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases a catalog opened by 'star_cat_open'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *cat (struct star_cat)
+         The catalog.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_store_close  cheby_engine.c
+      memset             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   cheby_store_close (&cat->store);
+   memset (cat, 0, sizeof (star_cat));
+   return;
+}
+
+/********star_cat_cone */
+
+short int star_cat_cone (star_cat *cat, double ra, double dec,
+                         double radius, double mag_limit,
+
+                         star_slice *stars)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Selects the stars of a catalog within a given angle of a point.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *cat (struct star_cat)
+         The catalog.
+      ra (double)
+         ICRS right ascension of the center of the field (hours).
+      dec (double)
+         ICRS declination of the center of the field (degrees).
+      radius (double)
+         Radius of the field (degrees), greater than 0 and at most 180.
+      mag_limit (double)
+         Faintest magnitude selected.
+
+   OUTPUT
+   ARGUMENTS:
+      *stars (struct star_slice)
+         The stars selected, in the order of the catalog.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid radius.
+         3 ... Unable to allocate memory.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      star_cat_query     star_cat.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The field is taken on the catalog positions at J2000.0; widen
+         it by the largest proper motion expected, and by the
+         aberration (about 20 arcseconds) if the field is an apparent
+         place.
+
+------------------------------------------------------------------------
+*/
+{
+   stars->n = 0;
+   if ((radius <= 0.0) || (radius > 180.0))
+      return 1;
+
+   return star_cat_query (cat, ra, dec, radius, NULL, mag_limit, stars);
+}
+
+/********star_cat_box */
+
+short int star_cat_box (star_cat *cat, double ra_min, double ra_max,
+                        double dec_min, double dec_max, double mag_limit,
+
+                        star_slice *stars)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Selects the stars of a catalog in a range of right ascension and
+      declination.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *cat (struct star_cat)
+         The catalog.
+      ra_min (double)
+         ICRS right ascension of the western edge of the field (hours).
+      ra_max (double)
+         ICRS right ascension of the eastern edge of the field (hours);
+         the field runs east from 'ra_min' to 'ra_max', across 0h if
+         'ra_max' is the smaller.  Equal values give all right
+         ascensions.
+      dec_min (double)
+         ICRS declination of the southern edge of the field (degrees).
+      dec_max (double)
+         ICRS declination of the northern edge of the field (degrees).
+      mag_limit (double)
+         Faintest magnitude selected.
+
+   OUTPUT
+   ARGUMENTS:
+      *stars (struct star_slice)
+         The stars selected, in the order of the catalog.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid range of declination.
+         3 ... Unable to allocate memory.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      star_cat_query     star_cat.c
+      sin                math.h
+      cos                math.h
+      acos               math.h
+      atan2              math.h
+      fmod               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. As note 1 of 'star_cat_cone'.
+      2. The cells are found for the smallest circle about the middle of
+         the field that holds it; the stars of those cells are then
+         tested against the edges of the field.
+
+------------------------------------------------------------------------
+*/
+{
+   short int k;
+   double box[4], width, ra_c, dec_c, hw, a, d, c, radius = 0.0;
+
+   stars->n = 0;
+   if ((dec_min > dec_max) || (dec_min < -90.0) || (dec_max > 90.0))
+      return 1;
+
+   width = fmod (ra_max - ra_min, 24.0);
+   if (width <= 0.0)
+      width += 24.0;
+   box[0] = fmod (ra_min, 24.0);
+   if (box[0] < 0.0)
+      box[0] += 24.0;
+   box[1] = width;
+   box[2] = dec_min;
+   box[3] = dec_max;
+
+/*
+   The circle:  the distance from the middle of the field is greatest
+   on its eastern and western edges, at one of their ends or where
+   sin(dec_c) sin(dec) + cos(dec_c) cos(hw) cos(dec) is least.
+*/
+
+   ra_c = box[0] + 0.5 * width;
+   dec_c = 0.5 * (dec_min + dec_max);
+   hw = 0.5 * width * 15.0 * DEG2RAD;
+   a = atan2 (sin (dec_c * DEG2RAD), cos (dec_c * DEG2RAD) * cos (hw)) +
+      0.5 * TWOPI;
+   if (a > 0.5 * TWOPI)
+      a -= TWOPI;
+   for (k = 0; k < 3; k++)
+   {
+      if (k == 2)
+      {
+         if ((a < dec_min * DEG2RAD) || (a > dec_max * DEG2RAD))
+            break;
+         d = a;
+      }
+      else
+         d = ((k == 0) ? dec_min : dec_max) * DEG2RAD;
+      c = sin (dec_c * DEG2RAD) * sin (d) + cos (dec_c * DEG2RAD) *
+         cos (d) * cos (hw);
+      if (c > 1.0)
+         c = 1.0;
+      if (c < -1.0)
+         c = -1.0;
+      if (acos (c) * RAD2DEG > radius)
+         radius = acos (c) * RAD2DEG;
+   }
+   radius += 1.0e-9;
+   if (radius > 180.0)
+      radius = 180.0;
+
+   return star_cat_query (cat, ra_c, dec_c, radius, box, mag_limit, stars);
+}
+
+/********star_cat_place */
+
+short int star_cat_place (double jd_tt, star_slice *stars,
+                          observer *location, double delta_t,
+                          short int coord_sys, short int accuracy,
+
+                          double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the apparent, topocentric or astrometric places of the
+      stars of a slice, as 'place' does for each, with the parts of the
+      reduction that do not depend on the star computed once.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date for place.
+      *stars (struct star_slice)
+         The stars, as selected by 'star_cat_cone' or 'star_cat_box'.
+      *location (struct observer)
+         The observer, as for 'place'.
+      delta_t (double)
+         Difference TT-UT1 at 'jd_tt', in seconds of time.
+      coord_sys (short int)
+         Coordinate system of the output, as for 'place':
+            = 0 ... GCRS or "local GCRS"
+            = 1 ... true equator and equinox of date
+            = 2 ... true equator and CIO of date
+            = 3 ... astrometric coordinates, i.e., without light
+                    deflection or aberration.
+      accuracy (short int)
+         Selection for accuracy, as for 'place'.
+
+   OUTPUT
+   ARGUMENTS:
+      *ra (double)
+         Right ascension of each star in the chosen system (hours).
+      *dec (double)
+         Declination of each star in the chosen system (degrees).
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid value of 'coord_sys'.
+         2 ... Invalid value of 'accuracy'.
+         > 10 ... Error from function 'ephemeris'.
+         > 40 ... Error from function 'geo_posvel'.
+         > 70 ... Error from function 'ephemeris' for a deflecting body.
+         > 80 ... Error from function 'cio_location'.
+         > 90 ... Error from function 'cio_basis'.
+
+   GLOBALS
+   USED:
+      T0, C_AUDAY        novascon.c
+      RMASS              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      ephemeris          novas.c
+      geo_posvel         novas.c
+      make_cat_entry     novas.c
+      make_object        novas.c
+      starvectors        novas.c
+      d_light            novas.c
+      proper_motion      novas.c
+      bary2obs           novas.c
+      limb_angle         novas.c
+      grav_vec           novas.c
+      aberration         novas.c
+      frame_tie          novas.c
+      precession         novas.c
+      nutation           novas.c
+      cio_location       novas.c
+      cio_basis          novas.c
+      vector2radec       novas.c
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The Earth, the observer and the deflecting bodies of
+         'grav_def' (the Sun, with Jupiter and Saturn at full accuracy)
+         are found once, with their velocities.  'grav_def' takes each
+         body where it was when the light passed closest to it, which
+         depends on the star; here the body is moved back there along
+         its velocity, which changes the deflection by less than a
+         tenth of a microarcsecond beside Jupiter.  The frame rotation for
+         'coord_sys' is applied as one matrix.
+      2. Radial velocities are not computed; 'place' gives them.
+
+------------------------------------------------------------------------
+*/
+{
+   static char *body_name[3] = {"Sun", "Jupiter", "Saturn"};
+   static const short int body_num[3] = {10, 5, 6};
+
+   short int error, loc, n_bodies, b, j, k, rs;
+
+   long int i;
+
+   double jd_tdb, x, secdif, jd[2], peb[3], veb[3], pog[3], vog[3],
+      pob[3], vob[3], pbody[3][3], vbody[3][3], pbodyo[3][3], m[3][3],
+      e[3], p1[3], p2[3], r_cio, pos1[3], vel1[3], pos2[3], pos3[3],
+      pos4[3], pos5[3], pos8[3], pb[3], t_light, tlt, dt, dlt, back, frlimb;
+
+   cat_entry star;
+
+   object body;
+
+   if ((coord_sys < 0) || (coord_sys > 3))
+      return 1;
+   if ((accuracy < 0) || (accuracy > 1))
+      return 2;
+
+/*
+   The Earth and the observer, as 'place'.
+*/
+
+   tdb2tt (jd_tt, &x, &secdif);
+   jd_tdb = jd_tt + secdif / 86400.0;
+   jd[0] = jd_tdb;
+   jd[1] = 0.0;
+
+   make_cat_entry ("DUMMY", "xxx", 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, &star);
+   make_object (0, 3, "Earth", &star, &body);
+   if ((error = ephemeris (jd, &body, 0, accuracy, peb, veb)) != 0)
+      return (short int) (10 + error);
+
+   if ((location->where == 1) || (location->where == 2))
+   {
+      if ((error = geo_posvel (jd_tt, delta_t, accuracy, location, pog,
+                               vog)) != 0)
+         return (short int) (40 + error);
+      loc = 1;
+   }
+   else
+   {
+      for (j = 0; j < 3; j++)
+         pog[j] = vog[j] = 0.0;
+      loc = 0;
+   }
+   for (j = 0; j < 3; j++)
+   {
+      pob[j] = peb[j] + pog[j];
+      vob[j] = veb[j] + vog[j];
+   }
+
+/*
+   The deflecting bodies of 'grav_def', with respect to the barycenter
+   and to the observer.
+*/
+
+   n_bodies = (accuracy == 0) ? 3 : 1;
+   if (coord_sys != 3)
+      for (b = 0; b < n_bodies; b++)
+      {
+         make_object (0, body_num[b], body_name[b], &star, &body);
+         if ((error = ephemeris (jd, &body, 0, accuracy, pbody[b],
+                                 vbody[b])) != 0)
+            return (short int) (70 + error);
+         bary2obs (pbody[b], pob, pbodyo[b], &x);
+      }
+
+/*
+   The rotation from the GCRS to the output system, as a matrix whose
+   columns are the images of the GCRS axes.
+*/
+
+   for (k = 0; k < 3; k++)
+   {
+      for (j = 0; j < 3; j++)
+         e[j] = (j == k) ? 1.0 : 0.0;
+      switch (coord_sys)
+      {
+         case (1):
+            frame_tie (e, 1, p1);
+            precession (T0, p1, jd_tdb, p2);
+            nutation (jd_tdb, 0, accuracy, p2, e);
+            break;
+         case (2):
+            if (k == 0)
+            {
+               if ((error = cio_location (jd_tdb, accuracy, &r_cio,
+                                          &rs)) != 0)
+                  return (short int) (80 + error);
+               if ((error = cio_basis (jd_tdb, r_cio, rs, accuracy, m[0],
+                                       m[1], m[2])) != 0)
+                  return (short int) (90 + error);
+            }
+            break;
+         default:
+            break;
+      }
+      if (coord_sys != 2)
+         for (j = 0; j < 3; j++)
+            m[j][k] = e[j];
+   }
+
+/*
+   Each star, as 'place'.
+*/
+
+   for (i = 0; i < stars->n; i++)
+   {
+      star.ra = stars->ra[i];
+      star.dec = stars->dec[i];
+      star.promora = stars->pm_ra[i];
+      star.promodec = stars->pm_dec[i];
+      star.parallax = stars->parallax[i];
+      star.radialvelocity = stars->rv[i];
+      starvectors (&star, pos1, vel1);
+      dt = d_light (pos1, pob);
+      proper_motion (T0, pos1, vel1, jd_tdb + dt, pos2);
+      bary2obs (pos2, pob, pos3, &t_light);
+
+      if (coord_sys == 3)
+      {
+         for (j = 0; j < 3; j++)
+            pos5[j] = pos3[j];
+      }
+      else
+      {
+         for (j = 0; j < 3; j++)
+            pos4[j] = pos3[j];
+         tlt = sqrt (pos3[0] * pos3[0] + pos3[1] * pos3[1] +
+                     pos3[2] * pos3[2]) / C_AUDAY;
+         for (b = 0; b < n_bodies; b++)
+         {
+            dlt = d_light (pos4, pbodyo[b]);
+            back = 0.0;
+            if (dlt > 0.0)
+               back = dlt;
+            if (tlt < dlt)
+               back = tlt;
+            for (j = 0; j < 3; j++)
+               pb[j] = pbody[b][j] - vbody[b][j] * back;
+            grav_vec (pos4, pob, pb, RMASS[body_num[b]], pos4);
+         }
+         if (loc == 1)
+         {
+            limb_angle (pos3, pog, &x, &frlimb);
+            if (frlimb >= 0.8)
+               grav_vec (pos4, pob, peb, RMASS[3], pos4);
+         }
+         aberration (pos4, vob, t_light, pos5);
+      }
+
+      for (j = 0; j < 3; j++)
+         pos8[j] = m[j][0] * pos5[0] + m[j][1] * pos5[1] +
+            m[j][2] * pos5[2];
+      vector2radec (pos8, &ra[i], &dec[i]);
+   }
+
+   return 0;
+}
+
+/********star_slice_free */
+
+void star_slice_free (star_slice *stars)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases the arrays of a slice filled by 'star_cat_cone' or
+      'star_cat_box'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *stars (struct star_slice)
+         The slice.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      free               stdlib.h
+      memset             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   free (stars->index);
+   free (stars->id);
+   free (stars->ra);
+   free (stars->dec);
+   free (stars->pm_ra);
+   free (stars->pm_dec);
+   free (stars->parallax);
+   free (stars->rv);
+   free (stars->mag);
+   memset (stars, 0, sizeof (star_slice));
+   return;
+}
+
+/********star_cat_spread */
+
+static long int star_cat_spread (long int v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Moves bit b of 'v' to bit 2b.
+
+------------------------------------------------------------------------
+*/
+{
+   short int b;
+   long int r = 0;
+
+   for (b = 0; b < 16; b++)
+      r |= ((v >> b) & 1L) << (2 * b);
+
+   return r;
+}
+
+/********star_cat_compress */
+
+static long int star_cat_compress (long int v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Moves bit 2b of 'v' to bit b.
+
+------------------------------------------------------------------------
+*/
+{
+   short int b;
+   long int r = 0;
+
+   for (b = 0; b < 16; b++)
+      r |= ((v >> (2 * b)) & 1L) << b;
+
+   return r;
+}
+
+/********star_cat_pixel */
+
+static long int star_cat_pixel (short int order, double ra, double dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      HEALPix cell (nested scheme) of order 'order' holding the
+      direction 'ra' (hours), 'dec' (degrees), after 'loc2pix' of the
+      HEALPix library.  The distance from the pole is taken from the
+      cosine of the declination, which keeps its precision there.
+
+------------------------------------------------------------------------
+*/
+{
+   int face;
+   long int nside = 1L << order, jp, jm, ifp, ifm, ix, iy, ntt;
+   double z, sth, za, tt, t1, t2, tp, tmp;
+
+   z = sin (dec * DEG2RAD);
+   sth = cos (dec * DEG2RAD);
+   za = fabs (z);
+   tt = fmod (ra / 6.0, 4.0);
+   if (tt < 0.0)
+      tt += 4.0;
+   if (tt >= 4.0)
+      tt = 0.0;
+
+   if (za <= 2.0 / 3.0)
+   {
+
+/*
+   Equatorial zone.
+*/
+
+      t1 = (double) nside * (0.5 + tt);
+      t2 = (double) nside * (z * 0.75);
+      jp = (long int) (t1 - t2);
+      jm = (long int) (t1 + t2);
+      ifp = jp >> order;
+      ifm = jm >> order;
+      face = (int) ((ifp == ifm) ? (ifp | 4) : ((ifp < ifm) ? ifp :
+                                                (ifm + 8)));
+      ix = jm & (nside - 1);
+      iy = nside - (jp & (nside - 1)) - 1;
+   }
+   else
+   {
+
+/*
+   Polar caps.
+*/
+
+      ntt = (long int) tt;
+      if (ntt > 3)
+         ntt = 3;
+      tp = tt - (double) ntt;
+      tmp = (double) nside * sth / sqrt ((1.0 + za) / 3.0);
+      jp = (long int) (tp * tmp);
+      jm = (long int) ((1.0 - tp) * tmp);
+      if (jp > nside - 1)
+         jp = nside - 1;
+      if (jm > nside - 1)
+         jm = nside - 1;
+      if (z >= 0.0)
+      {
+         face = (int) ntt;
+         ix = nside - jm - 1;
+         iy = nside - jp - 1;
+      }
+      else
+      {
+         face = (int) ntt + 8;
+         ix = jp;
+         iy = jm;
+      }
+   }
+
+   return ((long int) face << (2 * order)) + star_cat_spread (ix) +
+      (star_cat_spread (iy) << 1);
+}
+
+/********star_cat_vector */
+
+static void star_cat_vector (short int order, long int pix, double dx,
+                             double dy, double *v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Unit vector of the point ('dx', 'dy') of HEALPix cell 'pix' of
+      order 'order', where (0.5, 0.5) is its center and 0 and 1 its
+      corners, after 'xyf2loc' of the HEALPix library.
+
+------------------------------------------------------------------------
+*/
+{
+   int face;
+   long int nside = 1L << order, p;
+   double x, y, jr, nr, z, sth, tmp, phi;
+
+   face = (int) (pix >> (2 * order));
+   p = pix & ((nside * nside) - 1);
+   x = ((double) star_cat_compress (p) + dx) / (double) nside;
+   y = ((double) star_cat_compress (p >> 1) + dy) / (double) nside;
+
+   jr = (double) JRLL[face] - x - y;
+   if (jr < 1.0)
+   {
+      nr = jr;
+      tmp = nr * nr / 3.0;
+      z = 1.0 - tmp;
+      sth = sqrt (tmp * (2.0 - tmp));
+   }
+   else if (jr > 3.0)
+   {
+      nr = 4.0 - jr;
+      tmp = nr * nr / 3.0;
+      z = tmp - 1.0;
+      sth = sqrt (tmp * (2.0 - tmp));
+   }
+   else
+   {
+      nr = 1.0;
+      z = (2.0 - jr) * 2.0 / 3.0;
+      sth = sqrt ((1.0 - z) * (1.0 + z));
+   }
+   tmp = (double) JPLL[face] * nr + x - y;
+   if (tmp < 0.0)
+      tmp += 8.0;
+   if (tmp >= 8.0)
+      tmp -= 8.0;
+   phi = (nr < 1.0e-15) ? 0.0 : 0.125 * TWOPI * tmp / nr;
+
+   v[0] = sth * cos (phi);
+   v[1] = sth * sin (phi);
+   v[2] = z;
+
+   return;
+}
+
+/********star_cat_pixrad */
+
+static double star_cat_pixrad (short int order)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Radius (radians) of a circle about the center of any cell of
+      order 'order' that holds the whole cell:  STAR_CAT_PIXRAD_FACTOR
+      times the largest distance from the center of a cell to its
+      corners ('max_pixrad' of the HEALPix library), with a tenth to
+      spare for rounding.
+
+------------------------------------------------------------------------
+*/
+{
+   double nside = (double) (1L << order), z, s, t1, phi, va[3], vb[3], c;
+
+   z = 2.0 / 3.0;
+   s = sqrt ((1.0 - z) * (1.0 + z));
+   phi = 0.125 * TWOPI / nside;
+   va[0] = s * cos (phi);
+   va[1] = s * sin (phi);
+   va[2] = z;
+   t1 = 1.0 - 1.0 / nside;
+   t1 *= t1;
+   z = 1.0 - t1 / 3.0;
+   vb[0] = sqrt ((1.0 - z) * (1.0 + z));
+   vb[1] = 0.0;
+   vb[2] = z;
+   c = va[0] * vb[0] + va[1] * vb[1] + va[2] * vb[2];
+   if (c > 1.0)
+      c = 1.0;
+
+   return STAR_CAT_PIXRAD_FACTOR * acos (c);
+}
+
+/********star_cat_layout */
+
+static void star_cat_layout (short int order, long int n_stars,
+                             long int *offset, long int *size)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Byte offsets of the columns of a binary catalog (ra, dec, pm_ra,
+      pm_dec, parallax, rv, mag, id) and its size.  Each column starts
+      on a multiple of 8 bytes.
+
+------------------------------------------------------------------------
+*/
+{
+   short int c;
+   long int pos, n_cells = 12L << (2 * order);
+
+   pos = STAR_CAT_HEADER + (n_cells + 1) * (long int) sizeof (int);
+   for (c = 0; c < 8; c++)
+   {
+      pos = (pos + 7) & ~7L;
+      offset[c] = pos;
+      pos += n_stars * (long int) ((c < 2) ? sizeof (double) :
+                                   sizeof (float));
+   }
+   *size = (pos + 7) & ~7L;
+
+   return;
+}
+
+/********star_cat_query */
+
+static short int star_cat_query (star_cat *cat, double ra, double dec,
+                                 double radius, double *box,
+                                 double mag_limit,
+
+                                 star_slice *stars)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Walks the HEALPix tree down to the cells that can touch the
+      circle of 'radius' degrees about ('ra', 'dec'), and selects their
+      stars in the circle, or in 'box' (western edge and width of right
+      ascension, southern and northern edges of declination) if it is
+      not NULL.  Returns 0 if OK or 3 if memory cannot be allocated.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error, k, ord[12 + 3 * STAR_CAT_MAX_ORDER + 4];
+   long int pix[12 + 3 * STAR_CAT_MAX_ORDER + 4], n_stack = 0, p, i, q;
+   double c[3], v[3], cos_k[STAR_CAT_MAX_ORDER + 1], cos_r, a, s, d, w;
+
+   stars->n = 0;
+   c[0] = cos (dec * DEG2RAD) * cos (ra * 15.0 * DEG2RAD);
+   c[1] = cos (dec * DEG2RAD) * sin (ra * 15.0 * DEG2RAD);
+   c[2] = sin (dec * DEG2RAD);
+   cos_r = cos (radius * DEG2RAD);
+   for (k = 0; k <= cat->order; k++)
+   {
+      a = radius * DEG2RAD + star_cat_pixrad (k);
+      cos_k[k] = (a >= 0.5 * TWOPI) ? -2.0 : cos (a);
+   }
+
+   for (p = 11; p >= 0; p--)
+   {
+      pix[n_stack] = p;
+      ord[n_stack] = 0;
+      n_stack++;
+   }
+
+   while (n_stack > 0)
+   {
+      n_stack--;
+      p = pix[n_stack];
+      k = ord[n_stack];
+      star_cat_vector (k, p, 0.5, 0.5, v);
+      if (v[0] * c[0] + v[1] * c[1] + v[2] * c[2] < cos_k[k])
+         continue;
+      if (k < cat->order)
+      {
+         for (q = 3; q >= 0; q--)
+         {
+            pix[n_stack] = 4 * p + q;
+            ord[n_stack] = (short int) (k + 1);
+            n_stack++;
+         }
+         continue;
+      }
+
+/*
+   A cell at the order of the catalog:  test its stars.
+*/
+
+      for (i = cat->cell[p]; i < cat->cell[p + 1]; i++)
+      {
+         if ((double) cat->mag[i] > mag_limit)
+            continue;
+         if (box != NULL)
+         {
+            if ((cat->dec[i] < box[2]) || (cat->dec[i] > box[3]))
+               continue;
+            w = cat->ra[i] - box[0];
+            if (w < 0.0)
+               w += 24.0;
+            if (w > box[1])
+               continue;
+         }
+         else
+         {
+            if (fabs (cat->dec[i] - dec) > radius)
+               continue;
+            s = cos (cat->dec[i] * DEG2RAD);
+            d = s * cos (cat->ra[i] * 15.0 * DEG2RAD) * c[0] +
+               s * sin (cat->ra[i] * 15.0 * DEG2RAD) * c[1] +
+               sin (cat->dec[i] * DEG2RAD) * c[2];
+            if (d < cos_r)
+               continue;
+         }
+         if ((error = star_cat_append (cat, i, stars)) != 0)
+            return error;
+      }
+   }
+
+   return 0;
+}
+
+/********star_cat_append */
+
+static short int star_cat_append (star_cat *cat, long int i,
+                                  star_slice *stars)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Appends star 'i' of the catalog to a slice, growing its arrays if
+      needed.  Returns 0 if OK or 3 if memory cannot be allocated.
+
+------------------------------------------------------------------------
+*/
+{
+   long int n = stars->n, max;
+   void *grown;
+
+   if (n == stars->max)
+   {
+      max = 2 * stars->max + 1024;
+      if ((grown = realloc (stars->index, (size_t) max *
+                            sizeof (long int))) == NULL)
+         return 3;
+      stars->index = (long int *) grown;
+      if ((grown = realloc (stars->id, (size_t) max *
+                            sizeof (long int))) == NULL)
+         return 3;
+      stars->id = (long int *) grown;
+      if ((grown = realloc (stars->ra, (size_t) max * sizeof (double))) ==
+          NULL)
+         return 3;
+      stars->ra = (double *) grown;
+      if ((grown = realloc (stars->dec, (size_t) max * sizeof (double))) ==
+          NULL)
+         return 3;
+      stars->dec = (double *) grown;
+      if ((grown = realloc (stars->pm_ra, (size_t) max *
+                            sizeof (double))) == NULL)
+         return 3;
+      stars->pm_ra = (double *) grown;
+      if ((grown = realloc (stars->pm_dec, (size_t) max *
+                            sizeof (double))) == NULL)
+         return 3;
+      stars->pm_dec = (double *) grown;
+      if ((grown = realloc (stars->parallax, (size_t) max *
+                            sizeof (double))) == NULL)
+         return 3;
+      stars->parallax = (double *) grown;
+      if ((grown = realloc (stars->rv, (size_t) max * sizeof (double))) ==
+          NULL)
+         return 3;
+      stars->rv = (double *) grown;
+      if ((grown = realloc (stars->mag, (size_t) max * sizeof (double))) ==
+          NULL)
+         return 3;
+      stars->mag = (double *) grown;
+      stars->max = max;
+   }
+
+   stars->index[n] = i;
+   stars->id[n] = (long int) cat->id[i];
+   stars->ra[n] = cat->ra[i];
+   stars->dec[n] = cat->dec[i];
+   stars->pm_ra[n] = (double) cat->pm_ra[i];
+   stars->pm_dec[n] = (double) cat->pm_dec[i];
+   stars->parallax[n] = (double) cat->parallax[i];
+   stars->rv[n] = (double) cat->rv[i];
+   stars->mag[n] = (double) cat->mag[i];
+   stars->n = n + 1;
+
+   return 0;
+}
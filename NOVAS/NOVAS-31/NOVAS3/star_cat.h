@@ -0,0 +1,149 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  star_cat.h: Header file for star_cat.c, a memory-mapped columnar star
+              catalog with a HEALPix index, cone and box queries and
+              the apparent places of the stars selected
+*/
+
+#ifndef _STARCAT_
+   #define _STARCAT_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+   #ifndef _CHEBYENGINE_
+      #include "cheby_engine.h"
+   #endif
+
+/*
+   File identifier written at the start of every binary star catalog.
+*/
+
+   #define STAR_CAT_MAGIC "NOVASSC1"
+   #define STAR_CAT_VERSION 1
+
+/*
+   STAR_CAT_HEADER    = size of the binary file header (bytes); the cell
+                        index and the columns follow it
+   STAR_CAT_ORDER     = HEALPix order of the cells used by
+                        'star_cat_convert' (nside 128, cells of about
+                        0.46 degrees)
+   STAR_CAT_MAX_ORDER = largest HEALPix order accepted
+*/
+
+   #define STAR_CAT_HEADER 32
+   #define STAR_CAT_ORDER 7
+   #define STAR_CAT_MAX_ORDER 10
+
+/*
+   struct star_cat:  one open catalog.  The columns point into the
+                     mapped file, in the order of the HEALPix cells
+                     (nested scheme); the stars of cell c are numbers
+                     cell[c] to cell[c + 1] - 1.  A catalog is not
+                     changed by queries, so any number of threads may
+                     query the same catalog.
+
+   store              = the binary file image
+   order              = HEALPix order of the cells
+   n_cells            = number of cells, 12 * 4^order
+   n_stars            = number of stars
+   cell               = first star of each cell, n_cells + 1 values
+   ra, dec            = ICRS right ascension (hours) and declination
+                        (degrees) at J2000.0, as 'cat_entry'
+   pm_ra, pm_dec      = proper motion in right ascension (times the
+                        cosine of the declination) and declination
+                        (milliarcseconds/year)
+   parallax           = parallax (milliarcseconds)
+   rv                 = radial velocity (km/s)
+   mag                = magnitude
+   id                 = catalog number
+*/
+
+   typedef struct
+   {
+      cheby_store store;
+      short int order;
+      long int n_cells;
+      long int n_stars;
+      const int *cell;
+      const double *ra;
+      const double *dec;
+      const float *pm_ra;
+      const float *pm_dec;
+      const float *parallax;
+      const float *rv;
+      const float *mag;
+      const int *id;
+   } star_cat;
+
+/*
+   struct star_slice:  stars selected by a query, as arrays, ready for
+                       'star_cat_place' or for 'place' through
+                       'make_cat_entry'.  The arrays belong to the slice
+                       and grow as needed; a slice may be reused for any
+                       number of queries and is released with
+                       'star_slice_free'.  Zero-fill a slice before its
+                       first use.
+
+   n                  = number of stars selected
+   max                = number of stars the arrays hold
+   index              = number of each star in the catalog
+   id                 = catalog number
+   ra ... mag         = as struct star_cat
+*/
+
+   typedef struct
+   {
+      long int n;
+      long int max;
+      long int *index;
+      long int *id;
+      double *ra;
+      double *dec;
+      double *pm_ra;
+      double *pm_dec;
+      double *parallax;
+      double *rv;
+      double *mag;
+   } star_slice;
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int star_cat_write (char *name, short int order,
+                                    long int n_stars, long int *id,
+                                    double *ra, double *dec, double *pm_ra,
+                                    double *pm_dec, double *parallax,
+                                    double *rv, double *mag);
+
+   EXPORT short int star_cat_convert (char *text_name, char *cat_name);
+
+   EXPORT short int star_cat_open (char *name,
+
+                                   star_cat *cat);
+
+   EXPORT void star_cat_close (star_cat *cat);
+
+   EXPORT short int star_cat_cone (star_cat *cat, double ra, double dec,
+                                   double radius, double mag_limit,
+
+                                   star_slice *stars);
+
+   EXPORT short int star_cat_box (star_cat *cat, double ra_min,
+                                  double ra_max, double dec_min,
+                                  double dec_max, double mag_limit,
+
+                                  star_slice *stars);
+
+   EXPORT short int star_cat_place (double jd_tt, star_slice *stars,
+                                    observer *location, double delta_t,
+                                    short int coord_sys, short int accuracy,
+
+                                    double *ra, double *dec);
+
+   EXPORT void star_slice_free (star_slice *stars);
+
+#endif
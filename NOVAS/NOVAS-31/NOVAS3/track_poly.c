@@ -0,0 +1,545 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  track_poly.c: Chebyshev tracking polynomials fitted to the topocentric
+                place of a target
+
+  A mount controller that calls 'place' and 'equ2hor' for every position
+  update repeats the whole reduction each time.  'track_fit' runs the
+  reduction only at the Chebyshev nodes of short segments of a time
+  window, checks each segment against further exact reductions and
+  halves any segment that misses the tolerance.  'track_eval' then gives
+  the coordinates and their rates at any time in the window from the
+  segment's series, through the Chebyshev engine.
+*/
+
+#ifndef _TRACKPOLY_
+   #include "track_poly.h"
+#endif
+
+#include <string.h>
+#include <math.h>
+
+static short int track_exact (track_poly *tp, double t, double *v);
+
+static short int track_segment (track_poly *tp, double t0, double len,
+                                double *c, double *err);
+
+/********track_fit */
+
+short int track_fit (object *cel_object, on_surface *location,
+                     double jd_tt_beg, double jd_tt_end, double delta_t,
+                     double xp, double yp, short int coords,
+                     short int coord_sys, short int accuracy,
+                     short int ref_option, double tolerance,
+
+                     track_poly *tp)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Fits Chebyshev polynomials to the topocentric right ascension and
+      declination, or azimuth and altitude, of a target over a time
+      window, to within a given tolerance.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *cel_object (struct object)
+         The target, as for 'place'.
+      *location (struct on_surface)
+         The observer.
+      jd_tt_beg (double)
+         TT Julian date of the start of the window.
+      jd_tt_end (double)
+         TT Julian date of the end of the window.
+      delta_t (double)
+         Difference TT-UT1 in seconds, as for 'place'.
+      xp (double)
+         Conventionally-defined x coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds
+         (TRACK_AZALT only).
+      yp (double)
+         Conventionally-defined y coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds
+         (TRACK_AZALT only).
+      coords (short int)
+         TRACK_RADEC or TRACK_AZALT.
+      coord_sys (short int)
+         System of right ascension and declination, as 'place'
+         (TRACK_RADEC only).
+      accuracy (short int)
+         Accuracy of the reduction, as 'place'.
+      ref_option (short int)
+         Refraction option, as 'equ2hor' (TRACK_AZALT only).
+      tolerance (double)
+         Largest error allowed in the fitted place (arcseconds).
+
+   OUTPUT
+   ARGUMENTS:
+      *tp (struct track_poly)
+         The tracking polynomials.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Invalid window, 'coords' or 'tolerance'.
+         3 ... Unable to allocate memory.
+         > 10  10 + error from function 'place'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      track_segment      track_poly.c
+      track_free         track_poly.c
+      realloc            stdlib.h
+      free               stdlib.h
+      memset             string.h
+      ceil               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. Each segment is fitted by interpolation at the TRACK_NCOEF
+         Chebyshev nodes and checked at the extrema of the last
+         polynomial, which include both ends of the segment.  The error
+         is the angle on the sky:  the right ascension or azimuth error
+         is scaled by the cosine of the declination or altitude.  A
+         segment that fails the check is halved, so the segments are
+         short only where the path bends sharply (a target near the
+         zenith in TRACK_AZALT).
+      2. Where the reduction itself jumps, as 'refract' does at zenith
+         distances of 0.1 and 91 degrees, the segment holding the jump
+         cannot meet the tolerance.  It is kept once its halves would be
+         shorter than TRACK_MIN_SEG and counted in 'n_rough'; 'max_err'
+         covers only the other segments.
+      3. Right ascension and azimuth are fitted without the jump at 24h
+         or 360 degrees.
+      4. The reduction takes a single Julian date, which resolves about
+         40 microseconds, so tolerances much below a milliarcsecond are
+         not met even by short segments.  With refraction, 'equ2hor'
+         iterates only to 0.1 arcsecond, so its refracted places step by
+         up to that much; a smaller tolerance then gives many short
+         segments.
+      5. The polynomials must be released with 'track_free'.
+
+------------------------------------------------------------------------
+*/
+{
+   const long int n = TRACK_NCOEF;
+
+   short int error = 0;
+
+   long int n_stack = 0, max_stack = 0, n_seg = 0, max_seg = 0, i, n0;
+
+   double t0, len, err, *stack = NULL, *grown, *start, *slen, *coef;
+
+   memset (tp, 0, sizeof (track_poly));
+   if ((jd_tt_end <= jd_tt_beg) || (tolerance <= 0.0) ||
+       ((coords != TRACK_RADEC) && (coords != TRACK_AZALT)))
+      return 1;
+
+   tp->target = *cel_object;
+   tp->location = *location;
+   tp->jd_tt_beg = jd_tt_beg;
+   tp->jd_tt_end = jd_tt_end;
+   tp->delta_t = delta_t;
+   tp->xp = xp;
+   tp->yp = yp;
+   tp->coords = coords;
+   tp->coord_sys = coord_sys;
+   tp->accuracy = accuracy;
+   tp->ref_option = ref_option;
+   tp->tolerance = tolerance;
+
+/*
+   Segments still to be fitted are held on a stack of (start, length)
+   pairs, the earliest on top, so that the fitted segments come out in
+   order.
+*/
+
+   n0 = (long int) ceil ((jd_tt_end - jd_tt_beg) / TRACK_MAX_SEG - 1.0e-9);
+   if (n0 < 1)
+      n0 = 1;
+   len = (jd_tt_end - jd_tt_beg) / (double) n0;
+   for (i = n0 - 1; i >= 0; i--)
+   {
+      if (n_stack == max_stack)
+      {
+         max_stack = 2 * max_stack + 64;
+         if ((grown = (double *) realloc (stack, (size_t) max_stack * 2 *
+                                          sizeof (double))) == NULL)
+         {
+            error = 3;
+            break;
+         }
+         stack = grown;
+      }
+      stack[2 * n_stack] = (i == n0 - 1) ?
+         (jd_tt_end - jd_tt_beg) - len : (double) i * len;
+      stack[2 * n_stack + 1] = len;
+      n_stack++;
+   }
+
+   while ((error == 0) && (n_stack > 0))
+   {
+      n_stack--;
+      t0 = stack[2 * n_stack];
+      len = stack[2 * n_stack + 1];
+
+      if (n_seg == max_seg)
+      {
+         max_seg = 2 * max_seg + 64;
+         start = (double *) realloc (tp->ch.index.start, (size_t) max_seg *
+                                     sizeof (double));
+         if (start != NULL)
+            tp->ch.index.start = start;
+         slen = (double *) realloc (tp->ch.index.len, (size_t) max_seg *
+                                    sizeof (double));
+         if (slen != NULL)
+            tp->ch.index.len = slen;
+         coef = (double *) realloc (tp->coef, (size_t) max_seg * 2 * n *
+                                    sizeof (double));
+         if (coef != NULL)
+            tp->coef = coef;
+         if ((start == NULL) || (slen == NULL) || (coef == NULL))
+         {
+            error = 3;
+            break;
+         }
+      }
+
+      if ((error = track_segment (tp, t0, len, &tp->coef[n_seg * 2 * n],
+                                  &err)) != 0)
+         break;
+
+      if ((err <= tolerance) || (len * 0.5 < TRACK_MIN_SEG))
+      {
+         tp->ch.index.start[n_seg] = t0;
+         tp->ch.index.len[n_seg] = len;
+         n_seg++;
+         if (err > tolerance)
+            tp->n_rough++;
+         else if (err > tp->max_err)
+            tp->max_err = err;
+         continue;
+      }
+
+/*
+   Too long:  replace the segment by its two halves.
+*/
+
+      if (n_stack + 2 > max_stack)
+      {
+         max_stack = 2 * max_stack + 64;
+         if ((grown = (double *) realloc (stack, (size_t) max_stack * 2 *
+                                          sizeof (double))) == NULL)
+         {
+            error = 3;
+            break;
+         }
+         stack = grown;
+      }
+      stack[2 * n_stack] = t0 + 0.5 * len;
+      stack[2 * n_stack + 1] = 0.5 * len;
+      stack[2 * n_stack + 2] = t0;
+      stack[2 * n_stack + 3] = 0.5 * len;
+      n_stack += 2;
+   }
+
+   free (stack);
+   if (error != 0)
+   {
+      track_free (tp);
+      return error;
+   }
+
+   tp->ch.index.n_seg = n_seg;
+   tp->ch.index.jd0 = 0.0;
+   tp->ch.index.span = 0.0;
+
+   return 0;
+}
+
+/********track_eval */
+
+short int track_eval (track_poly *tp, double jd_tt_high, double jd_tt_low,
+                      long int *hint,
+
+                      double *coord, double *rate)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Evaluates tracking polynomials, giving the place of the target
+      and its rate of change.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *tp (struct track_poly)
+         The tracking polynomials.
+      jd_tt_high (double)
+         High-order part of TT Julian date.
+      jd_tt_low (double)
+         Low-order part of TT Julian date.
+      *hint (long int)
+         Segment used by the previous call, or -1 for none; updated.
+         May be NULL.
+
+   OUTPUT
+   ARGUMENTS:
+      *coord (double)
+         TRACK_RADEC:  right ascension (hours, 0 to 24) and declination
+         (degrees).
+         TRACK_AZALT:  azimuth (degrees, 0 to 360, east of north) and
+         altitude (degrees).
+      *rate (double)
+         Rate of change of each coordinate (units of 'coord' per day),
+         or NULL if not wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0 ... Everything OK.
+         1 ... Date outside the window, or no polynomials fitted.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_find         cheby_engine.c
+      cheby_eval         cheby_engine.c
+      floor              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      1. The rates are the derivatives of the fitted series; they are not
+         checked against the tolerance.
+
+------------------------------------------------------------------------
+*/
+{
+   long int seg;
+
+   double jd[2], frac, deriv[2], period;
+
+   if (tp->ch.index.n_seg < 1)
+      return 1;
+
+   jd[0] = (jd_tt_high - tp->jd_tt_beg) + jd_tt_low;
+   jd[1] = 0.0;
+   seg = cheby_find (&tp->ch, jd, (hint != NULL) ? *hint : -1L, &frac);
+   if (seg < 0)
+      return 1;
+   if (hint != NULL)
+      *hint = seg;
+
+   cheby_eval (&tp->coef[seg * 2 * TRACK_NCOEF], TRACK_NCOEF, 2L,
+               2.0 * frac - 1.0, coord, (rate != NULL) ? deriv : NULL);
+
+   period = (tp->coords == TRACK_RADEC) ? 24.0 : 360.0;
+   coord[0] -= period * floor (coord[0] / period);
+
+   if (rate != NULL)
+   {
+      rate[0] = deriv[0] * 2.0 / tp->ch.index.len[seg];
+      rate[1] = deriv[1] * 2.0 / tp->ch.index.len[seg];
+   }
+
+   return 0;
+}
+
+/********track_free */
+
+void track_free (track_poly *tp)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Releases tracking polynomials fitted by 'track_fit'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *tp (struct track_poly)
+         The tracking polynomials.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      cheby_close        cheby_engine.c
+      free               stdlib.h
+      memset             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ASCOM
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   cheby_close (&tp->ch);
+   free (tp->coef);
+   memset (tp, 0, sizeof (track_poly));
+   return;
+}
+
+/********track_exact */
+
+static short int track_exact (track_poly *tp, double t, double *v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      The exact reduction at time 't' (days from the start of the
+      window):  right ascension (hours) and declination (degrees), or
+      azimuth and altitude (degrees).  Returns 0 if OK, or 10 + the
+      error from 'place'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   double jd_tt, zd, az, rar, decr;
+
+   observer obs;
+
+   sky_pos sky;
+
+   make_observer_on_surface (tp->location.latitude, tp->location.longitude,
+                             tp->location.height, tp->location.temperature,
+                             tp->location.pressure, &obs);
+   jd_tt = tp->jd_tt_beg + t;
+   tp->n_calls++;
+
+   if (tp->coords == TRACK_RADEC)
+   {
+      if ((error = place (jd_tt, &tp->target, &obs, tp->delta_t,
+                          tp->coord_sys, tp->accuracy, &sky)) != 0)
+         return (short int) (10 + error);
+      v[0] = sky.ra;
+      v[1] = sky.dec;
+   }
+   else
+   {
+      if ((error = place (jd_tt, &tp->target, &obs, tp->delta_t, 1,
+                          tp->accuracy, &sky)) != 0)
+         return (short int) (10 + error);
+      equ2hor (jd_tt - tp->delta_t / 86400.0, tp->delta_t, tp->accuracy,
+               tp->xp, tp->yp, &tp->location, sky.ra, sky.dec,
+               tp->ref_option, &zd, &az, &rar, &decr);
+      v[0] = az;
+      v[1] = 90.0 - zd;
+   }
+
+   return 0;
+}
+
+/********track_segment */
+
+static short int track_segment (track_poly *tp, double t0, double len,
+                                double *c, double *err)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Fits one segment, 'len' days from 't0' days after the start of the
+      window, by interpolation at the Chebyshev nodes, and returns in
+      '*err' the largest error (arcseconds) found at the extrema of
+      T(n-1).  Returns 0 if OK, or the error from 'track_exact'.
+
+------------------------------------------------------------------------
+*/
+{
+   const long int n = TRACK_NCOEF;
+
+   short int error;
+
+   long int i, j, k;
+
+   double x, v[TRACK_NCOEF][2], e[2], out[2], d, period, scale;
+
+   period = (tp->coords == TRACK_RADEC) ? 24.0 : 360.0;
+
+/*
+   Exact places at the nodes, which run from the end of the segment to
+   its start; the first coordinate is carried across 24h or 360 degrees.
+*/
+
+   for (k = 0; k < n; k++)
+   {
+      x = cos (0.5 * TWOPI * ((double) k + 0.5) / (double) n);
+      if ((error = track_exact (tp, t0 + 0.5 * (x + 1.0) * len, v[k])) !=
+          0)
+         return error;
+      if (k > 0)
+         v[k][0] -= period * floor ((v[k][0] - v[k - 1][0]) / period +
+                                    0.5);
+   }
+
+   for (i = 0; i < 2; i++)
+      for (j = 0; j < n; j++)
+      {
+         d = 0.0;
+         for (k = 0; k < n; k++)
+            d += v[k][i] * cos (0.5 * TWOPI * (double) j *
+                                ((double) k + 0.5) / (double) n);
+         c[i * n + j] = d * ((j == 0) ? 1.0 : 2.0) / (double) n;
+      }
+
+/*
+   Check at the extrema of T(n-1).
+*/
+
+   *err = 0.0;
+   for (k = 0; k < n; k++)
+   {
+      x = cos (0.5 * TWOPI * (double) k / (double) (n - 1));
+      if ((error = track_exact (tp, t0 + 0.5 * (x + 1.0) * len, e)) != 0)
+         return error;
+      cheby_eval (c, n, 2L, x, out, NULL);
+      scale = cos (e[1] * DEG2RAD) *
+         ((tp->coords == TRACK_RADEC) ? 15.0 : 1.0);
+      out[0] -= e[0];
+      out[0] = (out[0] - period * floor (out[0] / period + 0.5)) * scale;
+      out[1] -= e[1];
+      d = 3600.0 * sqrt (out[0] * out[0] + out[1] * out[1]);
+      if (d > *err)
+         *err = d;
+   }
+
+   return 0;
+}
@@ -0,0 +1,114 @@
+/*
+  ASCOM additions to NOVAS C3.1
+
+  track_poly.h: Header file for track_poly.c, Chebyshev tracking
+                polynomials fitted to the topocentric place of a target
+*/
+
+#ifndef _TRACKPOLY_
+   #define _TRACKPOLY_
+
+   #ifndef _NOVAS_
+      #include "novas.h"
+   #endif
+
+   #ifndef _CHEBYENGINE_
+      #include "cheby_engine.h"
+   #endif
+
+/*
+   Coordinates fitted.
+
+   TRACK_RADEC        = right ascension (hours) and declination (degrees)
+                        in the system chosen by 'coord_sys', as 'place'
+   TRACK_AZALT        = azimuth (degrees, east of north) and altitude
+                        (degrees), as 'equ2hor'
+*/
+
+   #define TRACK_RADEC 0
+   #define TRACK_AZALT 1
+
+/*
+   TRACK_NCOEF        = number of Chebyshev coefficients per segment and
+                        coordinate
+   TRACK_MAX_SEG      = longest segment (days)
+   TRACK_MIN_SEG      = shortest segment made by halving (days)
+*/
+
+   #define TRACK_NCOEF 12
+   #define TRACK_MAX_SEG 0.25
+   #define TRACK_MIN_SEG (1.0 / 86400.0)
+
+/*
+   struct track_poly:  tracking polynomials of one target for one
+                       observer over a time window.  Read-only once
+                       fitted, so any number of threads may evaluate
+                       through the same polynomials.
+
+   target             = the target
+   location           = the observer
+   jd_tt_beg          = start of the window (TT Julian date)
+   jd_tt_end          = end of the window (TT Julian date)
+   delta_t, xp, yp    = TT-UT1 (seconds) and polar motion (arcseconds)
+                        used by the reduction
+   coords             = TRACK_RADEC or TRACK_AZALT
+   coord_sys          = system of right ascension and declination, as
+                        'place' (TRACK_RADEC only)
+   accuracy           = accuracy of the reduction, as 'place'
+   ref_option         = refraction option, as 'equ2hor' (TRACK_AZALT
+                        only)
+   tolerance          = largest error allowed (arcseconds)
+   max_err            = largest error found while checking the fit
+                        (arcseconds)
+   n_calls            = number of exact reductions made by the fit
+   n_rough            = number of segments that miss the tolerance
+                        but could not be halved again (a jump in the
+                        reduction)
+   ch                 = the segments, as a tabulated Chebyshev index in
+                        days from 'jd_tt_beg'
+   coef               = coefficients, TRACK_NCOEF per coordinate, two
+                        coordinates per segment
+*/
+
+   typedef struct
+   {
+      object target;
+      on_surface location;
+      double jd_tt_beg;
+      double jd_tt_end;
+      double delta_t;
+      double xp;
+      double yp;
+      short int coords;
+      short int coord_sys;
+      short int accuracy;
+      short int ref_option;
+      double tolerance;
+      double max_err;
+      long int n_calls;
+      long int n_rough;
+      cheby_handle ch;
+      double *coef;
+   } track_poly;
+
+/*
+   Function prototypes
+*/
+
+   EXPORT short int track_fit (object *cel_object, on_surface *location,
+                               double jd_tt_beg, double jd_tt_end,
+                               double delta_t, double xp, double yp,
+                               short int coords, short int coord_sys,
+                               short int accuracy, short int ref_option,
+                               double tolerance,
+
+                               track_poly *tp);
+
+   EXPORT short int track_eval (track_poly *tp, double jd_tt_high,
+                                double jd_tt_low, long int *hint,
+
+                                double *coord, double *rate);
+
+   EXPORT void track_free (track_poly *tp);
+
+#endif
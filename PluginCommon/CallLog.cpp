@@ -0,0 +1,612 @@
+//========================================================================
+//
+// TITLE:		CallLog.cpp
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Non-blocking log of driver calls. See CallLog.h.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		A rate-limited read dropped by a full ring hands its
+//						suppressed count on to the next one.
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include "CallLog.h"
+
+#ifdef _WIN32
+#include <process.h>
+#define CL_CAS(p, v, cmp) InterlockedCompareExchange((p), (v), (cmp))
+#define CL_INC(p) InterlockedIncrement(p)
+#define CL_ADD(p, v) InterlockedExchangeAdd((p), (v))
+#define CL_XCHG(p, v) InterlockedExchange((p), (v))
+#define CL_BARRIER() MemoryBarrier()
+#define CL_SLEEP1() Sleep(1)
+#define CL_SNPRINTF _snprintf
+#else
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#define CL_CAS(p, v, cmp) __sync_val_compare_and_swap((p), (cmp), (v))
+#define CL_INC(p) __sync_add_and_fetch((p), 1)
+#define CL_ADD(p, v) __sync_add_and_fetch((p), (v))
+#define CL_XCHG(p, v) __sync_lock_test_and_set((p), (v))
+#define CL_BARRIER() __sync_synchronize()
+#define CL_SLEEP1() usleep(1000)
+#define CL_SNPRINTF snprintf
+#endif
+
+//
+// Ticket arithmetic wraps; do it unsigned so the wrap is defined.
+//
+static inline long add(long a, long b)
+{
+	return (long)((unsigned long)a + (unsigned long)b);
+}
+
+static inline long diff(long a, long b)
+{
+	return (long)((unsigned long)a - (unsigned long)b);
+}
+
+CallLog::CallLog()
+{
+	_slots = NULL;
+	_mask = 0;
+	_enqueue = _dequeue = 0;
+	_posted = _dropped = _suppressed = 0;
+	_written = 0;
+	_reportedDrops = 0;
+	for(int i = 0; i < CALLLOG_MEMBERS; i++)
+		_limit[i] = _last[i] = _held[i] = 0;
+	_sink = NULL;
+	_context = NULL;
+	_names = NULL;
+	_drainMs = 0;
+	_running = false;
+	_stop = false;
+#ifdef _WIN32
+	_hThread = NULL;
+	_hWake = NULL;
+#else
+	pthread_mutex_init(&_mutex, NULL);
+	pthread_cond_init(&_wake, NULL);
+	_kick = false;
+#endif
+}
+
+CallLog::~CallLog()
+{
+	Stop();
+	delete[] _slots;
+#ifndef _WIN32
+	pthread_cond_destroy(&_wake);
+	pthread_mutex_destroy(&_mutex);
+#endif
+}
+
+// -----------
+// TickCount()
+// -----------
+//
+unsigned long CallLog::TickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000);
+#endif
+}
+
+// -------
+// Start()
+// -------
+//
+// capacity is rounded up to a power of two. The log thread wakes every
+// drainMs, or sooner if the ring is half full.
+//
+bool CallLog::Start(int capacity, Sink sink, void *context, NameFunc names, unsigned long drainMs)
+{
+	int size = 16;
+
+	if(_running || sink == NULL)
+		return false;
+	while(size < capacity)
+		size <<= 1;
+	delete[] _slots;
+	_slots = new Slot[size];
+	_mask = size - 1;
+	for(int i = 0; i < size; i++)
+		_slots[i].seq = i;
+	_enqueue = _dequeue = 0;
+	_posted = _dropped = _suppressed = 0;
+	_written = 0;
+	_reportedDrops = 0;
+	_sink = sink;
+	_context = context;
+	_names = names;
+	_drainMs = drainMs;
+	_stop = false;
+
+#ifdef _WIN32
+	_hWake = CreateEvent(NULL, FALSE, FALSE, NULL);
+	if(_hWake == NULL)
+		return false;
+	_hThread = (HANDLE)_beginthreadex(NULL, 0, ThreadProc, this, 0, NULL);
+	if(_hThread == NULL)
+	{
+		CloseHandle(_hWake);
+		_hWake = NULL;
+		return false;
+	}
+#else
+	_kick = false;
+	if(pthread_create(&_thread, NULL, ThreadProc, this) != 0)
+		return false;
+#endif
+	_running = true;
+	return true;
+}
+
+// ------
+// Stop()
+// ------
+//
+// Everything posted before the call is written out first. Posts made
+// after Stop() starts are dropped; the ring itself is kept until the
+// log is destroyed, so a late post is harmless.
+//
+void CallLog::Stop()
+{
+	if(!_running)
+		return;
+	_running = false;
+	_stop = true;
+	Wake();
+#ifdef _WIN32
+	WaitForSingleObject(_hThread, INFINITE);
+	CloseHandle(_hThread);
+	CloseHandle(_hWake);
+	_hThread = NULL;
+	_hWake = NULL;
+#else
+	pthread_join(_thread, NULL);
+#endif
+}
+
+// -------
+// Flush()
+// -------
+//
+// Wait until everything posted before the call has been handed to the
+// sink, for example before writing an error synchronously. Do not call
+// from the sink.
+//
+bool CallLog::Flush(unsigned long timeoutMs)
+{
+	long target = _enqueue;
+	unsigned long start = TickCount();
+
+	if(!_running)
+		return false;
+	Wake();
+	while(diff(_dequeue, target) < 0)
+	{
+		if(TickCount() - start >= timeoutMs)
+			return false;
+		CL_SLEEP1();
+	}
+	return true;
+}
+
+// --------------
+// SetRateLimit()
+// --------------
+//
+// Log at most one read of this member per interval. The reads in between
+// are counted and the count is shown on the next one logged. Sets and
+// calls are never limited.
+//
+void CallLog::SetRateLimit(int member, unsigned long intervalMs)
+{
+	if(member < 0 || member >= CALLLOG_MEMBERS)
+		return;
+	_limit[member] = (long)intervalMs;
+	_last[member] = 0;
+	_held[member] = 0;
+}
+
+// ---------
+// Limited()
+// ---------
+//
+// True if this read falls inside the member's interval. Otherwise claims
+// the interval and returns the number held back since the last one.
+//
+bool CallLog::Limited(int member, unsigned long now, unsigned long &suppressed)
+{
+	long limit, last, stamp;
+
+	suppressed = 0;
+	if(member < 0 || member >= CALLLOG_MEMBERS)
+		return false;
+	limit = _limit[member];
+	if(limit == 0)
+		return false;
+	last = _last[member];
+	stamp = (now != 0 ? (long)now : 1);							// 0 means "never logged"
+	if((last != 0 && diff(stamp, last) < limit) ||
+			CL_CAS(&_last[member], stamp, last) != last)		// Another thread just logged it
+	{
+		CL_INC(&_held[member]);
+		CL_INC(&_suppressed);
+		return true;
+	}
+	suppressed = (unsigned long)CL_XCHG(&_held[member], 0);
+	return false;
+}
+
+// ----------
+// PostRead()
+// ----------
+//
+// Post() for a read that passed Limited(). If the ring is full the record
+// is dropped, so the count it carried is held back again for the next.
+//
+bool CallLog::PostRead(CallLogRecord &rec)
+{
+	if(Post(rec))
+		return true;
+	if(rec.suppressed != 0)
+		CL_ADD(&_held[rec.member], (long)rec.suppressed);
+	return false;
+}
+
+// ------
+// Post()
+// ------
+//
+// Bounded multi-producer ring (after D. Vyukov). Each slot's seq is the
+// ticket that may fill it next; a producer claims a ticket by advancing
+// _enqueue, fills the slot and publishes it by bumping seq. If the slot
+// for the next ticket has not been emptied yet, the ring is full and the
+// record is dropped.
+//
+bool CallLog::Post(CallLogRecord &rec)
+{
+	Slot *slot;
+	long pos, seq, d;
+
+	if(!_running)
+		return false;
+	pos = _enqueue;
+	for(;;)
+	{
+		slot = &_slots[pos & _mask];
+		seq = slot->seq;
+		CL_BARRIER();
+		d = diff(seq, pos);
+		if(d == 0)
+		{
+			if(CL_CAS(&_enqueue, add(pos, 1), pos) == pos)
+				break;
+			pos = _enqueue;
+		}
+		else if(d < 0)
+		{
+			CL_INC(&_dropped);
+			return false;
+		}
+		else
+			pos = _enqueue;
+	}
+	slot->rec = rec;
+	CL_BARRIER();
+	slot->seq = add(pos, 1);
+	CL_INC(&_posted);
+	if(diff(pos, _dequeue) == (_mask >> 1))
+		Wake();													// Half full, don't wait for the timer
+	return true;
+}
+
+// ------
+// Take()
+// ------
+//
+// Log thread only.
+//
+bool CallLog::Take(CallLogRecord &rec)
+{
+	long pos = _dequeue;
+	Slot *slot = &_slots[pos & _mask];
+	long seq = slot->seq;
+
+	CL_BARRIER();
+	if(seq != add(pos, 1))
+		return false;											// Empty, or still being filled
+	rec = slot->rec;
+	CL_BARRIER();
+	slot->seq = add(pos, _mask + 1);							// Free for the ticket one lap on
+	_dequeue = add(pos, 1);
+	return true;
+}
+
+// --------
+// Format()
+// --------
+//
+// The line for one record, in the form the bridges have always logged.
+//
+void CallLog::Format(const CallLogRecord &rec, NameFunc names, char *buf, int len)
+{
+	char num[16];
+	const char *name;
+	int n;
+
+	if(names != NULL && rec.kind != CallLogRecord::CL_MESSAGE)
+		name = names(rec.member);
+	else
+	{
+		sprintf(num, "#%d", rec.member);
+		name = num;
+	}
+
+	switch(rec.kind)
+	{
+		case CallLogRecord::CL_GETINT:
+			n = CL_SNPRINTF(buf, len, "Get %s <- %i", name, rec.intVal);
+			break;
+		case CallLogRecord::CL_GETDOUBLE:
+			n = CL_SNPRINTF(buf, len, "Get %s <- %0.7f", name, rec.dbl1);
+			break;
+		case CallLogRecord::CL_GETBOOL:
+			n = CL_SNPRINTF(buf, len, "Get %s <- %s", name, (rec.intVal ? "true" : "false"));
+			break;
+		case CallLogRecord::CL_GETSTRING:
+			n = CL_SNPRINTF(buf, len, "Get %s <- %s", name, rec.text);
+			break;
+		case CallLogRecord::CL_SETDOUBLE:
+			n = CL_SNPRINTF(buf, len, "Set %s -> %0.7f", name, rec.dbl1);
+			break;
+		case CallLogRecord::CL_SETBOOL:
+			n = CL_SNPRINTF(buf, len, "Set %s -> %s", name, (rec.intVal ? "true" : "false"));
+			break;
+		case CallLogRecord::CL_CALL:
+			n = CL_SNPRINTF(buf, len, "%s()", name);
+			break;
+		case CallLogRecord::CL_CALLRADEC:
+			n = CL_SNPRINTF(buf, len, "%s(%0.7f, %0.7f)", name, rec.dbl1, rec.dbl2);
+			break;
+		default:
+			n = CL_SNPRINTF(buf, len, "%s", rec.text);
+			break;
+	}
+	buf[len - 1] = '\0';										// _snprintf may not terminate
+	if(rec.suppressed > 0 && n >= 0 && n < len - 1)
+		CL_SNPRINTF(buf + n, len - n, " (+%lu)", rec.suppressed);
+	buf[len - 1] = '\0';
+}
+
+// -------
+// Drain()
+// -------
+//
+void CallLog::Drain()
+{
+	CallLogRecord rec;
+	char buf[256];
+	long dropped;
+
+	while(Take(rec))
+	{
+		Format(rec, _names, buf, sizeof(buf));
+		_sink(_context, buf);
+		_written++;
+	}
+	dropped = _dropped;											// After the records that made it in
+	if(dropped != _reportedDrops)
+	{
+		sprintf(buf, "== %ld log records dropped ==", diff(dropped, _reportedDrops));
+		_reportedDrops = dropped;
+		_sink(_context, buf);
+		_written++;
+	}
+}
+
+void CallLog::Wake()
+{
+#ifdef _WIN32
+	if(_hWake != NULL)
+		SetEvent(_hWake);
+#else
+	pthread_mutex_lock(&_mutex);
+	_kick = true;
+	pthread_cond_signal(&_wake);
+	pthread_mutex_unlock(&_mutex);
+#endif
+}
+
+void CallLog::Wait(unsigned long ms)
+{
+#ifdef _WIN32
+	WaitForSingleObject(_hWake, ms);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += ms / 1000;
+	ts.tv_nsec += (long)(ms % 1000) * 1000000L;
+	if(ts.tv_nsec >= 1000000000L)
+	{
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	pthread_mutex_lock(&_mutex);
+	while(!_kick)
+	{
+		if(pthread_cond_timedwait(&_wake, &_mutex, &ts) == ETIMEDOUT)
+			break;
+	}
+	_kick = false;
+	pthread_mutex_unlock(&_mutex);
+#endif
+}
+
+void CallLog::Run()
+{
+	while(!_stop)
+	{
+		Wait(_drainMs);
+		Drain();
+	}
+	Drain();													// Whatever came in before Stop()
+}
+
+#ifdef _WIN32
+unsigned __stdcall CallLog::ThreadProc(void *param)
+{
+	((CallLog *)param)->Run();
+	return 0;
+}
+#else
+void *CallLog::ThreadProc(void *param)
+{
+	((CallLog *)param)->Run();
+	return NULL;
+}
+#endif
+
+// ------------------
+// Typed entry points
+// ------------------
+//
+// Each fills a record and posts it; false if it was rate limited,
+// dropped, or the log is not running.
+//
+static void init_record(CallLogRecord &rec, short kind, int member, unsigned long now)
+{
+	rec.tick = now;
+	rec.kind = kind;
+	rec.member = (short)member;
+	rec.suppressed = 0;
+	rec.intVal = 0;
+	rec.dbl1 = rec.dbl2 = 0.0;
+	rec.text[0] = '\0';
+}
+
+static void copy_text(char *dst, const char *src)
+{
+	size_t len = (src != NULL ? strlen(src) : 0);
+
+	if(len < CALLLOG_TEXT)
+	{
+		memcpy(dst, (src != NULL ? src : ""), len + 1);
+		return;
+	}
+	memcpy(dst, src, CALLLOG_TEXT - 4);
+	strcpy(dst + CALLLOG_TEXT - 4, "...");
+}
+
+bool CallLog::GetInteger(int member, int val)
+{
+	CallLogRecord rec;
+	unsigned long now = TickCount();
+
+	init_record(rec, CallLogRecord::CL_GETINT, member, now);
+	if(Limited(member, now, rec.suppressed))
+		return false;
+	rec.intVal = val;
+	return PostRead(rec);
+}
+
+bool CallLog::GetDouble(int member, double val)
+{
+	CallLogRecord rec;
+	unsigned long now = TickCount();
+
+	init_record(rec, CallLogRecord::CL_GETDOUBLE, member, now);
+	if(Limited(member, now, rec.suppressed))
+		return false;
+	rec.dbl1 = val;
+	return PostRead(rec);
+}
+
+bool CallLog::GetBool(int member, bool val)
+{
+	CallLogRecord rec;
+	unsigned long now = TickCount();
+
+	init_record(rec, CallLogRecord::CL_GETBOOL, member, now);
+	if(Limited(member, now, rec.suppressed))
+		return false;
+	rec.intVal = (val ? 1 : 0);
+	return PostRead(rec);
+}
+
+bool CallLog::GetString(int member, const char *val)
+{
+	CallLogRecord rec;
+	unsigned long now = TickCount();
+
+	init_record(rec, CallLogRecord::CL_GETSTRING, member, now);
+	if(Limited(member, now, rec.suppressed))
+		return false;
+	copy_text(rec.text, val);
+	return PostRead(rec);
+}
+
+bool CallLog::SetDouble(int member, double val)
+{
+	CallLogRecord rec;
+
+	init_record(rec, CallLogRecord::CL_SETDOUBLE, member, TickCount());
+	rec.dbl1 = val;
+	return Post(rec);
+}
+
+bool CallLog::SetBool(int member, bool val)
+{
+	CallLogRecord rec;
+
+	init_record(rec, CallLogRecord::CL_SETBOOL, member, TickCount());
+	rec.intVal = (val ? 1 : 0);
+	return Post(rec);
+}
+
+bool CallLog::Call(int member)
+{
+	CallLogRecord rec;
+
+	init_record(rec, CallLogRecord::CL_CALL, member, TickCount());
+	return Post(rec);
+}
+
+bool CallLog::CallWithRaDec(int member, double dRA, double dDec)
+{
+	CallLogRecord rec;
+
+	init_record(rec, CallLogRecord::CL_CALLRADEC, member, TickCount());
+	rec.dbl1 = dRA;
+	rec.dbl2 = dDec;
+	return Post(rec);
+}
+
+bool CallLog::Message(const char *text)
+{
+	CallLogRecord rec;
+
+	init_record(rec, CallLogRecord::CL_MESSAGE, 0, TickCount());
+	copy_text(rec.text, text);
+	return Post(rec);
+}
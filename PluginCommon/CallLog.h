@@ -0,0 +1,162 @@
+//========================================================================
+//
+// TITLE:		CallLog.h
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Non-blocking log of driver calls. Callers post fixed-size
+//				binary records into a lock-free ring; a background thread
+//				formats them and hands the lines to the host's logger. A
+//				full ring drops records (and counts them) rather than
+//				making the caller wait, and polled properties can be rate
+//				limited so a 10 Hz RA/Dec poll does not flood the log.
+//
+// USING:		Portable C++, Win32 or pthreads, no COM. Member numbers
+//				are the bridge's own (e.g. DriverMember in the X2 plug-in);
+//				the name function turns them into text at format time.
+//				CallLogTest.cpp tests and benchmarks it on Linux.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef CALLLOG_H
+#define CALLLOG_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define CALLLOG_TEXT 88											// Text carried per record, with the NUL
+#define CALLLOG_MEMBERS 128										// Member numbers that can be rate limited
+
+// -------------
+// CallLogRecord
+// -------------
+//
+// One call, as posted. Plain data; formatting happens on the log thread.
+//
+struct CallLogRecord
+{
+	enum
+	{
+		CL_GETINT = 0,
+		CL_GETDOUBLE,
+		CL_GETBOOL,
+		CL_GETSTRING,
+		CL_SETDOUBLE,
+		CL_SETBOOL,
+		CL_CALL,
+		CL_CALLRADEC,
+		CL_MESSAGE
+	};
+	unsigned long tick;											// CallLog::TickCount() when posted
+	short kind;
+	short member;
+	unsigned long suppressed;									// Rate-limited reads of this member since the last one logged
+	int intVal;
+	double dbl1, dbl2;
+	char text[CALLLOG_TEXT];
+};
+
+// -------
+// CallLog
+// -------
+//
+// Any number of threads post, one thread formats. Posting never blocks
+// and never formats. Lines reach the sink in posting order (per thread;
+// between threads, in the order their slots were claimed).
+//
+class CallLog
+{
+public:
+	typedef void (*Sink)(void *context, const char *line);
+	typedef const char *(*NameFunc)(int member);
+
+	CallLog();
+	~CallLog();
+
+	bool Start(int capacity, Sink sink, void *context, NameFunc names, unsigned long drainMs);
+	void Stop();												// Formats what is left, then returns
+	bool Flush(unsigned long timeoutMs);						// Wait until everything posted so far is out
+	bool IsRunning() const { return _running; }
+
+	void SetRateLimit(int member, unsigned long intervalMs);	// 0 = log every read
+
+	bool GetInteger(int member, int val);
+	bool GetDouble(int member, double val);
+	bool GetBool(int member, bool val);
+	bool GetString(int member, const char *val);
+	bool SetDouble(int member, double val);
+	bool SetBool(int member, bool val);
+	bool Call(int member);
+	bool CallWithRaDec(int member, double dRA, double dDec);
+	bool Message(const char *text);
+
+	unsigned long Posted() const { return (unsigned long)_posted; }
+	unsigned long Dropped() const { return (unsigned long)_dropped; }
+	unsigned long Suppressed() const { return (unsigned long)_suppressed; }
+	unsigned long Written() const { return _written; }
+
+	static void Format(const CallLogRecord &rec, NameFunc names, char *buf, int len);
+	static unsigned long TickCount();
+
+protected:
+	struct Slot
+	{
+		volatile long seq;										// Slot ticket, see Post()
+		CallLogRecord rec;
+	};
+
+	bool Limited(int member, unsigned long now, unsigned long &suppressed);
+	bool Post(CallLogRecord &rec);
+	bool PostRead(CallLogRecord &rec);
+	bool Take(CallLogRecord &rec);
+	void Drain();
+	void Wake();
+	void Wait(unsigned long ms);
+	void Run();
+
+	Slot *_slots;
+	long _mask;
+	volatile long _enqueue;										// Next ticket to claim (producers)
+	volatile long _dequeue;										// Next ticket to format (log thread)
+	volatile long _posted;
+	volatile long _dropped;
+	volatile long _suppressed;
+	unsigned long _written;
+	long _reportedDrops;
+
+	volatile long _limit[CALLLOG_MEMBERS];						// ms, 0 = none
+	volatile long _last[CALLLOG_MEMBERS];						// Tick of the last read logged
+	volatile long _held[CALLLOG_MEMBERS];						// Reads suppressed since then
+
+	Sink _sink;
+	void *_context;
+	NameFunc _names;
+	unsigned long _drainMs;
+	bool _running;
+	volatile bool _stop;
+
+#ifdef _WIN32
+	static unsigned __stdcall ThreadProc(void *param);
+	HANDLE _hThread;
+	HANDLE _hWake;
+#else
+	static void *ThreadProc(void *param);
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _wake;
+	bool _kick;
+#endif
+};
+
+#endif
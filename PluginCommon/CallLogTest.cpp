@@ -0,0 +1,360 @@
+//========================================================================
+//
+// TITLE:		CallLogTest.cpp
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Test and benchmark for CallLog. Not part of any plug-in
+//				build; on Linux:
+//
+//				g++ -O2 -o CallLogTest CallLog.cpp CallLogTest.cpp -lpthread
+//				./CallLogTest
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		PASS/FAIL reporting from TestCheck.h
+//========================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include "CallLog.h"
+#include "TestCheck.h"
+
+static double now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+static const char *names(int member)
+{
+	static const char *table[] = { "RightAscension", "Declination", "Tracking", "SlewToCoordinatesAsync", "Name", "AbortSlew" };
+
+	return (member >= 0 && member < 6 ? table[member] : "?");
+}
+
+enum { M_RA = 0, M_DEC, M_TRACKING, M_SLEW, M_NAME, M_ABORT };
+
+// -------
+// Capture
+// -------
+//
+// Sink that keeps the lines. The gate lets a test stall the log thread.
+//
+struct Capture
+{
+	pthread_mutex_t gate;
+	int count;
+	int cap;
+	char **lines;
+
+	Capture(int n)
+	{
+		pthread_mutex_init(&gate, NULL);
+		count = 0;
+		cap = n;
+		lines = new char *[n];
+	}
+
+	~Capture()
+	{
+		for(int i = 0; i < count; i++)
+			free(lines[i]);
+		delete[] lines;
+	}
+
+	static void sink(void *context, const char *line)
+	{
+		Capture *c = (Capture *)context;
+
+		pthread_mutex_lock(&c->gate);
+		if(c->count < c->cap)
+			c->lines[c->count++] = strdup(line);
+		pthread_mutex_unlock(&c->gate);
+	}
+};
+
+static void null_sink(void *, const char *)
+{
+}
+
+//
+// Producer thread: member = thread number, value = sequence
+//
+struct Producer
+{
+	CallLog *log;
+	int id;
+	int count;
+	double ns;
+};
+
+static void *produce(void *param)
+{
+	Producer *p = (Producer *)param;
+	double start = now_ns();
+
+	for(int n = 0; n < p->count; n++)
+	{
+		while(!p->log->SetDouble(p->id, (double)n))
+			usleep(50);											// Test wants them all; callers would not retry
+	}
+	p->ns = (now_ns() - start) / p->count;
+	return NULL;
+}
+
+int main()
+{
+	CallLogRecord rec;
+	char buf[256];
+	int n;
+
+	//
+	// Lines look the way the bridges have always logged them
+	//
+	memset(&rec, 0, sizeof(rec));
+	rec.kind = CallLogRecord::CL_GETDOUBLE;
+	rec.member = M_RA;
+	rec.dbl1 = 12.5;
+	CallLog::Format(rec, names, buf, sizeof(buf));
+	check(strcmp(buf, "Get RightAscension <- 12.5000000") == 0, "format: get double");
+	rec.kind = CallLogRecord::CL_SETBOOL;
+	rec.member = M_TRACKING;
+	rec.intVal = 1;
+	CallLog::Format(rec, names, buf, sizeof(buf));
+	check(strcmp(buf, "Set Tracking -> true") == 0, "format: set bool");
+	rec.kind = CallLogRecord::CL_CALLRADEC;
+	rec.member = M_SLEW;
+	rec.dbl1 = 5.5;
+	rec.dbl2 = -45.0;
+	CallLog::Format(rec, names, buf, sizeof(buf));
+	check(strcmp(buf, "SlewToCoordinatesAsync(5.5000000, -45.0000000)") == 0, "format: call with ra/dec");
+	rec.kind = CallLogRecord::CL_GETDOUBLE;
+	rec.member = M_DEC;
+	rec.dbl1 = 1.0;
+	rec.suppressed = 42;
+	CallLog::Format(rec, names, buf, sizeof(buf));
+	check(strcmp(buf, "Get Declination <- 1.0000000 (+42)") == 0, "format: suppressed count");
+
+	//
+	// Posted records come out in order, on the log thread
+	//
+	{
+		CallLog log;
+		Capture cap(1000);
+
+		log.Start(256, Capture::sink, &cap, names, 50);
+		log.Call(M_ABORT);
+		log.GetBool(M_TRACKING, false);
+		log.GetInteger(M_NAME, 7);
+		log.GetString(M_NAME, "Simulator");
+		log.Message("== ERROR FROM DRIVER ==");
+		check(log.Flush(1000) && cap.count == 5, "flush: all lines out");
+		check(cap.count == 5 && strcmp(cap.lines[0], "AbortSlew()") == 0 &&
+				strcmp(cap.lines[1], "Get Tracking <- false") == 0 &&
+				strcmp(cap.lines[2], "Get Name <- 7") == 0 &&
+				strcmp(cap.lines[3], "Get Name <- Simulator") == 0 &&
+				strcmp(cap.lines[4], "== ERROR FROM DRIVER ==") == 0, "order: single thread");
+
+		char longText[300];
+		memset(longText, 'x', sizeof(longText) - 1);
+		longText[sizeof(longText) - 1] = '\0';
+		log.GetString(M_NAME, longText);
+		log.Flush(1000);
+		check(cap.count == 6 && strlen(cap.lines[5]) < 100 && strcmp(cap.lines[5] + strlen(cap.lines[5]) - 3, "...") == 0,
+				"text: long strings truncated");
+		log.Stop();
+		check(!log.Call(M_ABORT), "stop: posts after Stop() are refused");
+	}
+
+	//
+	// Several producers: nothing lost or reordered within a thread
+	//
+	{
+		CallLog log;
+		Capture cap(4 * 20000 + 10000);						// Room for drop reports
+		Producer prod[4];
+		pthread_t th[4];
+		int next[4] = { 0, 0, 0, 0 };
+		bool ordered = true;
+
+		log.Start(1024, Capture::sink, &cap, NULL, 5);
+		for(n = 0; n < 4; n++)
+		{
+			prod[n].log = &log;
+			prod[n].id = n;
+			prod[n].count = 20000;
+			pthread_create(&th[n], NULL, produce, &prod[n]);
+		}
+		for(n = 0; n < 4; n++)
+			pthread_join(th[n], NULL);
+		log.Stop();
+		for(n = 0; n < cap.count; n++)
+		{
+			int id, val;
+			if(cap.lines[n][0] == '=')
+				continue;										// Drop report
+			if(sscanf(cap.lines[n], "Set #%d -> %d", &id, &val) != 2 || id < 0 || id > 3 || val != next[id])
+			{
+				ordered = false;
+				break;
+			}
+			next[id]++;
+		}
+		check(log.Posted() == 80000, "mpsc: every record posted");
+		check(ordered && next[0] == 20000 && next[1] == 20000 && next[2] == 20000 && next[3] == 20000,
+				"mpsc: all written, in order per thread");
+	}
+
+	//
+	// A stalled log thread makes posts drop, never wait
+	//
+	{
+		CallLog log;
+		Capture cap(1000);
+		double start, worst = 0.0, t;
+		int posted = 0;
+
+		log.Start(16, Capture::sink, &cap, names, 1);
+		pthread_mutex_lock(&cap.gate);							// Sink blocks on the first line
+		log.Message("first");
+		usleep(20000);
+		for(n = 0; n < 200; n++)
+		{
+			start = now_ns();
+			if(log.GetDouble(M_RA, n))
+				posted++;
+			t = now_ns() - start;
+			if(t > worst)
+				worst = t;
+		}
+		check(posted == 16 && log.Dropped() == 184, "full: extra records dropped and counted");
+		check(worst < 1.0e6, "full: post never waits for the log thread");
+		pthread_mutex_unlock(&cap.gate);
+		log.Stop();
+		check(cap.count == 18 && strcmp(cap.lines[16], "Get RightAscension <- 15.0000000") == 0 &&
+				strcmp(cap.lines[17], "== 184 log records dropped ==") == 0, "full: drops reported after the records kept");
+	}
+
+	//
+	// Polled reads are rate limited per member; commands are not
+	//
+	{
+		CallLog log;
+		Capture cap(1000);
+		int logged = 0;
+
+		log.SetRateLimit(M_RA, 100);
+		log.Start(1024, Capture::sink, &cap, names, 5);
+		for(n = 0; n < 500; n++)
+		{
+			if(log.GetDouble(M_RA, 1.0))
+				logged++;
+			log.GetDouble(M_DEC, 2.0);							// Not limited
+		}
+		log.SetDouble(M_RA, 3.0);								// Sets are never limited
+		usleep(120000);
+		log.GetDouble(M_RA, 4.0);
+		log.Flush(1000);
+		check(logged == 1 && log.Suppressed() == 499, "rate: one read per interval");
+		check(cap.count == 1 + 500 + 1 + 1 && strcmp(cap.lines[cap.count - 2], "Set RightAscension -> 3.0000000") == 0,
+				"rate: other members and sets unaffected");
+		check(strcmp(cap.lines[cap.count - 1], "Get RightAscension <- 4.0000000 (+499)") == 0,
+				"rate: next line carries the count");
+		log.Stop();
+	}
+
+	//
+	// A limited read dropped by a full ring hands its count on
+	//
+	{
+		CallLog log;
+		Capture cap(1000);
+
+		log.SetRateLimit(M_RA, 50);
+		log.Start(16, Capture::sink, &cap, names, 1);
+		pthread_mutex_lock(&cap.gate);							// Sink blocks on the first line
+		log.Message("first");
+		usleep(20000);
+		for(n = 0; n < 16; n++)
+			log.Call(M_ABORT);									// Fill the ring
+		log.GetDouble(M_RA, 1.0);								// Claims the interval, dropped
+		for(n = 0; n < 3; n++)
+			log.GetDouble(M_RA, 2.0);							// Held back
+		usleep(60000);
+		check(!log.GetDouble(M_RA, 3.0), "held: read with a count dropped by the full ring");
+		pthread_mutex_unlock(&cap.gate);
+		log.Flush(1000);
+		usleep(60000);
+		log.GetDouble(M_RA, 4.0);
+		log.Stop();
+		for(n = 0; n < cap.count; n++)
+			if(strncmp(cap.lines[n], "Get RightAscension", 18) == 0)
+				break;
+		check(n < cap.count && strcmp(cap.lines[n], "Get RightAscension <- 4.0000000 (+3)") == 0,
+				"held: count carried past the dropped record");
+	}
+
+	//
+	// Cost on the calling thread: posting against formatting and writing
+	// a line synchronously under a lock, as the bridges did
+	//
+	{
+		CallLog log;
+		FILE *fp = fopen("/dev/null", "w");
+		pthread_mutex_t mx;
+		double start, post, sync;
+		const int N = 50000;									// Fits the ring: no drops
+
+		pthread_mutex_init(&mx, NULL);
+		log.Start(65536, null_sink, NULL, names, 5);
+		start = now_ns();
+		for(n = 0; n < N; n++)
+			log.GetDouble(M_RA, n * 0.001);
+		post = (now_ns() - start) / N;
+		log.Stop();
+
+		start = now_ns();
+		for(n = 0; n < N; n++)
+		{
+			pthread_mutex_lock(&mx);
+			sprintf(buf, "Get %s <- %0.7f", names(M_RA), n * 0.001);
+			fputs(buf, fp);
+			fputc('\n', fp);
+			fflush(fp);
+			pthread_mutex_unlock(&mx);
+		}
+		sync = (now_ns() - start) / N;
+		fclose(fp);
+		printf("      post %.0f ns/record, synchronous format+write %.0f ns/line (%lu dropped)\n",
+				post, sync, log.Dropped());
+
+		Producer prod[4];
+		pthread_t th[4];
+		log.Start(65536, null_sink, NULL, names, 5);
+		start = now_ns();
+		for(n = 0; n < 4; n++)
+		{
+			prod[n].log = &log;
+			prod[n].id = n;
+			prod[n].count = 250000;
+			pthread_create(&th[n], NULL, produce, &prod[n]);
+		}
+		for(n = 0; n < 4; n++)
+			pthread_join(th[n], NULL);
+		printf("      4 producers: %.1f M records/s\n", 1.0e6 / (now_ns() - start) * 1.0e3);
+		log.Stop();
+		check(post < sync, "bench: posting is cheaper than logging in line");
+	}
+
+	return check_summary();
+}
@@ -0,0 +1,448 @@
+//========================================================================
+//
+// TITLE:		PointingPredictor.cpp
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Dead reckoning of the mount's RA/Dec between driver reads.
+//				See PointingPredictor.h.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		Stop() services COM while waiting for the worker
+//========================================================================
+
+#include <math.h>
+#include <string.h>
+#include "PointingPredictor.h"
+
+#ifdef _WIN32
+#include <process.h>
+#include <objbase.h>
+#else
+#include <time.h>
+#endif
+
+#define SIDEREAL_RATE 1.00273790935									// Sidereal seconds per SI second
+
+#ifdef _WIN32
+//
+// Stop() is called on the planetarium's UI thread while the worker may be
+// reading an apartment-threaded driver through its proxy, or releasing
+// it. CoWaitForMultipleHandles services COM while it waits; off an
+// apartment it is a plain wait.
+//
+static void WaitPumping(HANDLE h)
+{
+	DWORD index;
+
+	if(FAILED(CoWaitForMultipleHandles(0, INFINITE, 1, &h, &index)))
+		WaitForSingleObject(h, INFINITE);
+}
+#endif
+
+//
+// Milliseconds from then to now on the 32 bit tick count. A fix stamped
+// on another thread just after now was taken counts as age 0.
+//
+static inline unsigned long age(unsigned long now, unsigned long then)
+{
+	unsigned long d = (now - then) & 0xFFFFFFFFUL;
+
+	return (d & 0x80000000UL) ? 0 : d;
+}
+
+PointingPredictor::PointingPredictor()
+{
+	_source = NULL;
+	_maxAge = 0;
+	_resync = 0;
+	_running = false;
+	_stop = false;
+	memset(&_fix, 0, sizeof(_fix));
+	_haveFix = false;
+	_generation = 0;
+	_pending = false;
+	_lastTry = 0;
+	_predictions = _misses = _resyncs = 0;
+#ifdef _WIN32
+	InitializeCriticalSection(&_cs);
+	_hThread = NULL;
+	_hWake = NULL;
+#else
+	pthread_mutex_init(&_lock, NULL);
+	pthread_mutex_init(&_mutex, NULL);
+	pthread_cond_init(&_wake, NULL);
+	_kick = false;
+#endif
+}
+
+PointingPredictor::~PointingPredictor()
+{
+	Stop();
+#ifdef _WIN32
+	DeleteCriticalSection(&_cs);
+#else
+	pthread_cond_destroy(&_wake);
+	pthread_mutex_destroy(&_mutex);
+	pthread_mutex_destroy(&_lock);
+#endif
+}
+
+// -----------
+// TickCount()
+// -----------
+//
+// Milliseconds, wrapping. Only differences are used.
+//
+unsigned long PointingPredictor::TickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000);
+#endif
+}
+
+// -------
+// Start()
+// -------
+//
+// A fix older than maxAgeMs is not extrapolated; one older than resyncMs
+// is still used but the worker is asked for a new one. With a NULL
+// source there is no worker and fixes come only from Update().
+//
+bool PointingPredictor::Start(PointingSource *source, unsigned long maxAgeMs, unsigned long resyncMs)
+{
+	if(_running)
+		return false;
+	_source = source;
+	SetLimits(maxAgeMs, resyncMs);
+	_stop = false;
+	Invalidate();
+	_pending = false;
+	_predictions = _misses = _resyncs = 0;
+
+	if(_source != NULL)
+	{
+#ifdef _WIN32
+		_hWake = CreateEvent(NULL, FALSE, FALSE, NULL);
+		if(_hWake == NULL)
+			return false;
+		_hThread = (HANDLE)_beginthreadex(NULL, 0, ThreadProc, this, 0, NULL);
+		if(_hThread == NULL)
+		{
+			CloseHandle(_hWake);
+			_hWake = NULL;
+			return false;
+		}
+#else
+		_kick = false;
+		if(pthread_create(&_thread, NULL, ThreadProc, this) != 0)
+			return false;
+#endif
+	}
+	_running = true;
+	return true;
+}
+
+// ------
+// Stop()
+// ------
+//
+// Returns once the worker has finished any read in progress and detached
+// from the source. Safe to call when not running. On Windows COM calls
+// are serviced while waiting, so this may be re-entered.
+//
+void PointingPredictor::Stop()
+{
+	if(!_running)
+		return;
+	_stop = true;
+	if(_source != NULL)
+	{
+#ifdef _WIN32
+		SetEvent(_hWake);
+		WaitPumping(_hThread);
+		if(!_running)
+			return;												// A nested Stop() has finished
+		CloseHandle(_hThread);
+		CloseHandle(_hWake);
+		_hThread = NULL;
+		_hWake = NULL;
+#else
+		pthread_mutex_lock(&_mutex);
+		_kick = true;
+		pthread_cond_signal(&_wake);
+		pthread_mutex_unlock(&_mutex);
+		pthread_join(_thread, NULL);
+#endif
+	}
+	_running = false;
+	Invalidate();
+}
+
+// -----------
+// SetLimits()
+// -----------
+//
+void PointingPredictor::SetLimits(unsigned long maxAgeMs, unsigned long resyncMs)
+{
+	Lock();
+	_maxAge = maxAgeMs;
+	_resync = (resyncMs < maxAgeMs ? resyncMs : maxAgeMs);
+	Unlock();
+}
+
+// -----------
+// Predict()
+// -----------
+//
+// Position now, carried forward from the last fix. False if there is no
+// fix with motion, it is too old, or the mount is slewing; the caller
+// then reads the driver itself. Either way the worker is asked for a new
+// fix if the one held is getting old.
+//
+bool PointingPredictor::Predict(unsigned long now, double &ra, double &dec)
+{
+	bool ok = false;
+	bool kick = false;
+	unsigned long a = 0;
+
+	if(!_running)
+		return false;
+	Lock();
+	if(_haveFix)
+	{
+		a = age(now, _fix.tick);
+		if(a <= _maxAge)
+			ok = Extrapolate(_fix, a / 1000.0, ra, dec);
+	}
+	if(ok)
+		_predictions++;
+	else
+		_misses++;
+	if(_source != NULL && !_pending && (!ok || a >= _resync) &&
+			(_lastTry == 0 || age(now, _lastTry) >= _resync))		// Don't hammer a failing driver
+	{
+		_pending = true;
+		_lastTry = (now ? now : 1);
+		kick = true;
+	}
+	Unlock();
+	if(kick)
+		Kick();
+	return ok;
+}
+
+// --------
+// Update()
+// --------
+//
+// A reading taken outside the worker: the bridge's own poller, or a
+// synchronous read after Predict() said no.
+//
+void PointingPredictor::Update(const PointingFix &fix)
+{
+	Lock();
+	Apply(fix);
+	Unlock();
+}
+
+// ------------
+// Invalidate()
+// ------------
+//
+// Call after anything that moves the mount other than tracking (slew,
+// sync, abort, park). The fix is dropped, and a resync already under way
+// is thrown away when it lands.
+//
+void PointingPredictor::Invalidate()
+{
+	Lock();
+	_generation++;
+	_haveFix = false;
+	_lastTry = 0;
+	Unlock();
+}
+
+// ---------------
+// Extrapolate()
+// ---------------
+//
+// Carry a fix forward dt seconds. Tracking follows the rate offsets; a
+// mount that is not tracking sees the sky drift past at the sidereal
+// rate. There is nothing to go on during a slew.
+//
+bool PointingPredictor::Extrapolate(const PointingFix &fix, double dt, double &ra, double &dec)
+{
+	if((fix.valid & (PointingFix::PF_POSITION | PointingFix::PF_MOTION)) !=
+			(PointingFix::PF_POSITION | PointingFix::PF_MOTION) || fix.slewing)
+		return false;
+
+	if(fix.tracking)
+	{
+		ra = fix.ra + ((fix.raRate * SIDEREAL_RATE / 3600.0) * dt);
+		dec = fix.dec + ((fix.decRate / 3600.0) * dt);
+	}
+	else
+	{
+		ra = fix.ra + ((SIDEREAL_RATE / 3600.0) * dt);
+		dec = fix.dec;
+	}
+
+	ra = fmod(ra, 24.0);
+	if(ra < 0.0)
+		ra += 24.0;
+	if(dec > 90.0)
+		dec = 90.0;
+	else if(dec < -90.0)
+		dec = -90.0;
+	return true;
+}
+
+// -------
+// Apply()
+// -------
+//
+// Take a fix, lock held. A position-only fix keeps the motion already
+// known. An older fix than the one held is ignored.
+//
+void PointingPredictor::Apply(const PointingFix &fix)
+{
+	PointingFix f = fix;
+
+	if((f.valid & PointingFix::PF_POSITION) == 0)
+		return;
+	if(_haveFix)
+	{
+		unsigned long d = (f.tick - _fix.tick) & 0xFFFFFFFFUL;
+		if(d & 0x80000000UL)
+			return;													// Older than what we have
+		if((f.valid & PointingFix::PF_MOTION) == 0 && (_fix.valid & PointingFix::PF_MOTION))
+		{
+			f.tracking = _fix.tracking;
+			f.slewing = _fix.slewing;
+			f.raRate = _fix.raRate;
+			f.decRate = _fix.decRate;
+			f.valid |= PointingFix::PF_MOTION;
+		}
+	}
+	_fix = f;
+	_haveFix = true;
+}
+
+// ------
+// Lock()
+// Unlock()
+// ------
+//
+void PointingPredictor::Lock()
+{
+#ifdef _WIN32
+	EnterCriticalSection(&_cs);
+#else
+	pthread_mutex_lock(&_lock);
+#endif
+}
+
+void PointingPredictor::Unlock()
+{
+#ifdef _WIN32
+	LeaveCriticalSection(&_cs);
+#else
+	pthread_mutex_unlock(&_lock);
+#endif
+}
+
+// ------
+// Kick()
+// ------
+//
+void PointingPredictor::Kick()
+{
+#ifdef _WIN32
+	SetEvent(_hWake);
+#else
+	pthread_mutex_lock(&_mutex);
+	_kick = true;
+	pthread_cond_signal(&_wake);
+	pthread_mutex_unlock(&_mutex);
+#endif
+}
+
+// ------
+// Wait()
+// ------
+//
+bool PointingPredictor::Wait()
+{
+#ifdef _WIN32
+	WaitForSingleObject(_hWake, INFINITE);
+#else
+	pthread_mutex_lock(&_mutex);
+	while(!_kick)
+		pthread_cond_wait(&_wake, &_mutex);
+	_kick = false;
+	pthread_mutex_unlock(&_mutex);
+#endif
+	return !_stop;
+}
+
+// -----
+// Run()
+// -----
+//
+// The worker. Sleeps until Predict() asks for a fix. The generation is
+// taken before the read, so a command issued while the driver is being
+// read makes the result stale rather than letting it through.
+//
+void PointingPredictor::Run()
+{
+	_source->Attach();
+	while(Wait())
+	{
+		PointingFix fix;
+		unsigned long gen;
+		bool ok;
+
+		Lock();
+		gen = _generation;
+		Unlock();
+		memset(&fix, 0, sizeof(fix));
+		fix.tick = TickCount();
+		ok = _source->Read(fix);
+		Lock();
+		if(ok && gen == _generation)
+		{
+			_resyncs++;
+			Apply(fix);
+		}
+		_pending = false;
+		Unlock();
+	}
+	_source->Detach();
+}
+
+#ifdef _WIN32
+unsigned __stdcall PointingPredictor::ThreadProc(void *param)
+{
+	((PointingPredictor *)param)->Run();
+	return 0;
+}
+#else
+void *PointingPredictor::ThreadProc(void *param)
+{
+	((PointingPredictor *)param)->Run();
+	return NULL;
+}
+#endif
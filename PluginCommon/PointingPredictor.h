@@ -0,0 +1,149 @@
+//========================================================================
+//
+// TITLE:		PointingPredictor.h
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Dead reckoning of the mount's RA/Dec between driver reads.
+//				Keeps the last timestamped position with the tracking state
+//				and RightAscensionRate/DeclinationRate, and answers the
+//				host's position requests by carrying it forward, as long as
+//				it is no older than a configurable limit. When the fix gets
+//				old a resync is requested from a worker thread, so the
+//				host's redraw loop never waits on a slow serial mount.
+//
+// USING:		Portable C++, Win32 or pthreads, no COM. The driver side
+//				is a PointingSource in the bridge's DriverInterface.cpp; a
+//				bridge that already polls in the background feeds fixes in
+//				with Update() and runs without a worker.
+//				PointingPredictorTest.cpp tests it on simulated time.
+//
+// ENVIRONMENT:	Microsoft Windows XP/Vista/7
+//				Developed under Microsoft Visual C++ 9 (VS2008)
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef POINTINGPREDICTOR_H
+#define POINTINGPREDICTOR_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// -----------
+// PointingFix
+// -----------
+//
+// One reading. RA in hours, Dec in degrees, rates as the ASCOM driver
+// reports them (RightAscensionRate in seconds of RA per sidereal second,
+// DeclinationRate in arcseconds per SI second, both offsets from
+// sidereal). Without PF_MOTION only the position was read; the predictor
+// keeps the motion it already had.
+//
+struct PointingFix
+{
+	enum
+	{
+		PF_POSITION = 0x01,
+		PF_MOTION = 0x02											// tracking, slewing and rates are valid
+	};
+	unsigned valid;
+	unsigned long tick;												// PointingPredictor::TickCount() when read
+	double ra, dec;
+	bool tracking;
+	bool slewing;
+	double raRate, decRate;
+};
+
+// --------------
+// PointingSource
+// --------------
+//
+// Reads one fix from the driver. Called only on the worker thread.
+// Attach() and Detach() bracket the thread's life so the source can set
+// up per-thread state (COM apartment, its own proxy).
+//
+class PointingSource
+{
+public:
+	virtual void Attach() {}
+	virtual void Detach() {}
+	virtual bool Read(PointingFix &fix) = 0;
+};
+
+// -----------------
+// PointingPredictor
+// -----------------
+//
+// Any thread may call Predict(), Update() and Invalidate(). The fix is
+// guarded by a lock that is never held across a driver call.
+//
+class PointingPredictor
+{
+public:
+	PointingPredictor();
+	~PointingPredictor();
+
+	bool Start(PointingSource *source, unsigned long maxAgeMs, unsigned long resyncMs);
+	void Stop();
+	bool IsRunning() const { return _running; }
+	void SetLimits(unsigned long maxAgeMs, unsigned long resyncMs);
+
+	bool Predict(unsigned long now, double &ra, double &dec);		// false = read the driver
+	void Update(const PointingFix &fix);
+	void Invalidate();												// Commanded; the fix no longer holds
+
+	unsigned long Predictions() const { return _predictions; }
+	unsigned long Misses() const { return _misses; }
+	unsigned long Resyncs() const { return _resyncs; }
+
+	static bool Extrapolate(const PointingFix &fix, double dt, double &ra, double &dec);
+	static unsigned long TickCount();
+
+protected:
+	void Lock();
+	void Unlock();
+	void Apply(const PointingFix &fix);
+	void Kick();
+	bool Wait();													// false when stopping
+	void Run();
+
+	PointingSource *_source;
+	unsigned long _maxAge;
+	unsigned long _resync;
+	bool _running;
+	volatile bool _stop;
+
+	PointingFix _fix;
+	bool _haveFix;
+	unsigned long _generation;										// Invalidate() count
+	bool _pending;													// Worker has a resync to do
+	unsigned long _lastTry;											// Tick the last resync was asked for
+
+	unsigned long _predictions;
+	unsigned long _misses;
+	unsigned long _resyncs;
+
+#ifdef _WIN32
+	static unsigned __stdcall ThreadProc(void *param);
+	CRITICAL_SECTION _cs;
+	HANDLE _hThread;
+	HANDLE _hWake;
+#else
+	static void *ThreadProc(void *param);
+	pthread_mutex_t _lock;
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _wake;
+	bool _kick;
+#endif
+};
+
+#endif
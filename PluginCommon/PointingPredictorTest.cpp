@@ -0,0 +1,253 @@
+//========================================================================
+//
+// TITLE:		PointingPredictorTest.cpp
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	Test for PointingPredictor. The dead reckoning runs on
+//				simulated time; the resync worker against a slow mock
+//				mount in real time. Not part of any plug-in build; on
+//				Linux:
+//
+//				g++ -O2 -o PointingPredictorTest PointingPredictor.cpp PointingPredictorTest.cpp -lpthread
+//				./PointingPredictorTest
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		PASS/FAIL reporting from TestCheck.h
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <time.h>
+#include "PointingPredictor.h"
+#include "TestCheck.h"
+
+#define SIDEREAL_RATE 1.00273790935
+
+static bool near(double a, double b, double tol)
+{
+	return fabs(a - b) <= tol;
+}
+
+static double now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1.0e9 + ts.tv_nsec;
+}
+
+static PointingFix fix(unsigned long tick, double ra, double dec, bool tracking, double raRate, double decRate)
+{
+	PointingFix f;
+
+	memset(&f, 0, sizeof(f));
+	f.valid = PointingFix::PF_POSITION | PointingFix::PF_MOTION;
+	f.tick = tick;
+	f.ra = ra;
+	f.dec = dec;
+	f.tracking = tracking;
+	f.raRate = raRate;
+	f.decRate = decRate;
+	return f;
+}
+
+// ---------
+// SlowMount
+// ---------
+//
+// Mock driver: every read takes delayMs, as a slow serial mount would.
+// The mount tracks a fixed RA/Dec (sidereal, no offsets).
+//
+class SlowMount : public PointingSource
+{
+public:
+	int delayMs;
+	volatile int reads;
+	volatile bool attached;
+	volatile double ra;
+
+	SlowMount(int ms) : delayMs(ms), reads(0), attached(false), ra(10.0) {}
+
+	void Attach() { attached = true; }
+	void Detach() { attached = false; }
+
+	bool Read(PointingFix &f)
+	{
+		usleep(delayMs * 1000);
+		f.valid = PointingFix::PF_POSITION | PointingFix::PF_MOTION;
+		f.ra = ra;
+		f.dec = 45.0;
+		f.tracking = true;
+		f.slewing = false;
+		f.raRate = f.decRate = 0.0;
+		reads++;
+		return true;
+	}
+};
+
+int main()
+{
+	double ra, dec;
+
+	//
+	// Extrapolation
+	//
+	{
+		PointingFix f = fix(0, 5.0, 20.0, true, 0.0, 0.0);
+
+		check(PointingPredictor::Extrapolate(f, 60.0, ra, dec) && ra == 5.0 && dec == 20.0,
+				"extrapolate: sidereal tracking holds still");
+		f.raRate = 1.5;
+		f.decRate = -30.0;
+		check(PointingPredictor::Extrapolate(f, 10.0, ra, dec) &&
+				near(ra, 5.0 + 15.0 * SIDEREAL_RATE / 3600.0, 1e-12) && near(dec, 20.0 - 300.0 / 3600.0, 1e-12),
+				"extrapolate: rate offsets");
+		f = fix(0, 23.999, 89.999, false, 0.0, 0.0);
+		check(PointingPredictor::Extrapolate(f, 60.0, ra, dec) &&
+				near(ra, 23.999 + 60.0 * SIDEREAL_RATE / 3600.0 - 24.0, 1e-9) && dec == 89.999,
+				"extrapolate: not tracking drifts at sidereal, wraps 24h");
+		f = fix(0, 1.0, 89.99, true, 0.0, 100.0);
+		check(PointingPredictor::Extrapolate(f, 10.0, ra, dec) && dec == 90.0, "extrapolate: dec clamped at the pole");
+		f.slewing = true;
+		check(!PointingPredictor::Extrapolate(f, 1.0, ra, dec), "extrapolate: not while slewing");
+		f.slewing = false;
+		f.valid = PointingFix::PF_POSITION;
+		check(!PointingPredictor::Extrapolate(f, 1.0, ra, dec), "extrapolate: not without motion");
+	}
+
+	//
+	// Fed by Update(), simulated time: answers within the limit only
+	//
+	{
+		PointingPredictor p;
+
+		p.Start(NULL, 2000, 500);
+		check(!p.Predict(1000, ra, dec), "passive: nothing before the first fix");
+		p.Update(fix(1000, 12.0, -10.0, true, 0.5, 2.0));
+		check(p.Predict(2500, ra, dec) && near(ra, 12.0 + 0.75 * SIDEREAL_RATE / 3600.0, 1e-12) &&
+				near(dec, -10.0 + 3.0 / 3600.0, 1e-12), "passive: carried forward");
+		check(p.Predict(3000, ra, dec) && !p.Predict(3001, ra, dec), "passive: staleness limit");
+		check(p.Predictions() == 2 && p.Misses() == 2, "passive: counted");
+
+		PointingFix pos = fix(3000, 12.1, -9.0, false, 0.0, 0.0);
+		pos.valid = PointingFix::PF_POSITION;				// A plain RA/Dec read
+		p.Update(pos);
+		check(p.Predict(4000, ra, dec) && near(ra, 12.1 + 0.5 * SIDEREAL_RATE / 3600.0, 1e-12),
+				"passive: position-only fix keeps the motion");
+		p.Update(fix(2000, 1.0, 1.0, true, 0.0, 0.0));		// Late, from another thread
+		check(p.Predict(4000, ra, dec) && near(ra, 12.1 + 0.5 * SIDEREAL_RATE / 3600.0, 1e-12),
+				"passive: older fix ignored");
+
+		p.Invalidate();
+		check(!p.Predict(4000, ra, dec), "passive: nothing after Invalidate()");
+		pos.tick = 4000;
+		p.Update(pos);
+		check(!p.Predict(4100, ra, dec), "passive: position alone is not enough after Invalidate()");
+		p.Stop();
+	}
+
+	//
+	// Tick count wrap
+	//
+	{
+		PointingPredictor p;
+		unsigned long t0 = 0xFFFFFFFFUL - 500UL;
+
+		p.Start(NULL, 2000, 500);
+		p.Update(fix(t0, 6.0, 0.0, false, 0.0, 0.0));
+		check(p.Predict(499UL, ra, dec) && near(ra, 6.0 + SIDEREAL_RATE / 3600.0, 1e-12),
+				"wrap: age across the wrap");
+		check(p.Predict(t0 - 10UL, ra, dec) && ra == 6.0, "wrap: fix newer than now is age 0");
+		p.Stop();
+	}
+
+	//
+	// An hour of simulated host polling at 10 Hz against a mount with
+	// comet rates, fixes arriving every 2 sec: position error stays at
+	// rounding level and the driver sees a twentieth of the reads.
+	//
+	{
+		PointingPredictor p;
+		double mra = 3.0, mdec = 30.0;
+		double worst = 0.0;
+		unsigned long t, fixes = 0, asks = 0;
+
+		p.Start(NULL, 5000, 2000);
+		for(t = 0; t < 3600000UL; t += 100)
+		{
+			if(t % 2000 == 0)
+			{
+				p.Update(fix(t, mra, mdec, true, 0.3, -4.0));
+				fixes++;
+			}
+			asks++;
+			if(p.Predict(t, ra, dec))
+			{
+				double e = sqrt(pow((ra - mra) * 15.0 * cos(mdec * 3.14159265358979 / 180.0), 2.0) +
+								pow(dec - mdec, 2.0)) * 3600.0;
+				if(e > worst)
+					worst = e;
+			}
+			mra += 0.3 * SIDEREAL_RATE / 3600.0 * 0.1;
+			mdec += -4.0 / 3600.0 * 0.1;
+		}
+		printf("      1 hour at 10 Hz: %lu host reads, %lu driver fixes, worst error %.2g arcsec\n",
+				asks, fixes, worst);
+		check(p.Misses() == 0 && worst < 0.001, "sim: every host read answered from the fix");
+	}
+
+	//
+	// Worker: a slow mount never makes Predict() wait, resyncs happen in
+	// the background, commands during a read drop its result
+	//
+	{
+		PointingPredictor p;
+		SlowMount m(200);
+		double start, worst = 0.0;
+		int answered = 0, n;
+
+		p.Start(&m, 1000, 300);
+		usleep(20000);
+		check(m.attached, "worker: source attached on its thread");
+		for(n = 0; n < 100; n++)									// 1.5 sec of 15 ms host polls
+		{
+			unsigned long now = PointingPredictor::TickCount();
+			start = now_ns();
+			if(p.Predict(now, ra, dec))
+				answered++;
+			double t = now_ns() - start;
+			if(t > worst)
+				worst = t;
+			usleep(15000);
+		}
+		printf("      worker: %d of 100 host reads answered, %d driver reads, worst Predict() %.1f us\n",
+				answered, (int)m.reads, worst / 1000.0);
+		check(worst < 10.0e6, "worker: Predict() never waits for the mount");
+		check(answered > 80 && m.reads >= 3 && m.reads < 10, "worker: resyncs in the background");
+
+		int before = m.reads;
+		m.ra = 11.0;
+		p.Invalidate();												// A slew: forget 10h
+		check(!p.Predict(PointingPredictor::TickCount(), ra, dec), "worker: miss right after a command");
+		unsigned long resyncs = p.Resyncs();
+		usleep(50000);
+		p.Invalidate();												// Another command while the read is out
+		usleep(250000);
+		check(p.Resyncs() == resyncs && !p.Predict(PointingPredictor::TickCount(), ra, dec),
+				"worker: read that straddled a command is dropped");
+		usleep(250000);
+		check(p.Predict(PointingPredictor::TickCount(), ra, dec) && near(ra, 11.0, 1e-9) && m.reads > before,
+				"worker: new position after the resync");
+		p.Stop();
+		check(!m.attached && !p.IsRunning(), "worker: stop detaches");
+	}
+
+	return check_summary();
+}
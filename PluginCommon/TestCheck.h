@@ -0,0 +1,41 @@
+//========================================================================
+//
+// TITLE:		TestCheck.h
+//
+// FACILITY:	ASCOM planetarium bridge plug-ins (X2, TeleAPI, Starry Night)
+//
+// ABSTRACT:	PASS/FAIL reporting shared by the stand-alone test programs
+//				of the bridge plug-ins. Each program includes it once,
+//				calls check() for every condition and returns
+//				check_summary() from main().
+//
+// USING:		Portable C++, no Windows or COM dependencies.
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 18-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef TESTCHECK_H
+#define TESTCHECK_H
+
+#include <stdio.h>
+
+static int _failures = 0;
+
+static void check(bool ok, const char *what)
+{
+	printf("%s  %s\n", (ok ? "PASS" : "FAIL"), what);
+	if(!ok)
+		_failures++;
+}
+
+static int check_summary()
+{
+	printf(_failures ? "\n%d check(s) FAILED\n" : "\nAll checks passed\n", _failures);
+	return (_failures != 0);
+}
+
+#endif // TESTCHECK_H
@@ -0,0 +1,199 @@
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Incremental refresh of the iauApco13 astrometry context for control loops that transform at 10-100Hz. */
+
+/* iauApco13 rebuilds the whole context (Earth ephemeris, bias-precession-nutation, CIO locator, Earth rotation, */
+/* refraction constants) for every UTC. Between nearby times only the Earth rotation angle changes appreciably, */
+/* so steps shorter than a configurable threshold just re-apply the ERA through iauAper, as SOFA intends, and   */
+/* report the error that leaves in the frozen parts. Longer steps, or steps across a UTC day boundary (where a */
+/* leap second may fall), rebuild the context in full.                                                          */
+
+/* Default threshold for an Earth rotation only update (s) */
+#define MAXDT_DEFAULT 1.0
+
+/* Earth rotation rate (radians/s) and equatorial radius (m) */
+#define OMEGA 7.292115e-5
+#define REQ 6378137.0
+
+/* Rates of change of the parts an Earth rotation update leaves frozen (radians/s, upper bounds):      */
+/*   annual aberration: Earth's orbital acceleration / c = 2pi * 1.02e-4 / 1 year                     */
+/*   bias-precession-nutation: 50.3"/yr precession plus the summed rates of the largest nutation terms */
+#define ANNUAL_RATE 2.1e-11
+#define BPN_RATE 2.0e-11
+
+int ascomApco13Init(double maxdt, double utc1, double utc2, double dut1,
+                    double elong, double phi, double hm, double xp, double yp,
+                    double phpa, double tc, double rh, double wl,
+                    ascomASTROMCTX *ctx, double *eo)
+/*
+**  - - - - - - - - - - - - - - - -
+**   a s c o m A p c o 1 3 I n i t
+**  - - - - - - - - - - - - - - - -
+**
+**  Set up an incremental astrometry context: a full iauApco13 at the
+**  given UTC, plus the site and ambient parameters for later calls to
+**  ascomApco13Advance.
+**
+**  Given:
+**     maxdt  double     largest step (s) that ascomApco13Advance serves
+**                       with an Earth rotation update only (Note 1)
+**     utc1   double     UTC as a 2-part quasi Julian Date
+**     utc2   double
+**     dut1   double     UT1-UTC (seconds)
+**     elong  double     longitude (radians, east +ve)
+**     phi    double     geodetic latitude (radians)
+**     hm     double     height above ellipsoid (m, geodetic)
+**     xp,yp  double     polar motion coordinates (radians)
+**     phpa   double     pressure at the observer (hPa = mB)
+**     tc     double     ambient temperature at the observer (deg C)
+**     rh     double     relative humidity at the observer (range 0-1)
+**     wl     double     wavelength (micrometers)
+**
+**  Returned:
+**     ctx    ascomASTROMCTX*  context; ctx->astrom is ready for
+**                       iauAtciq, iauAtioq etc.
+**     eo     double*    equation of the origins (ERA-GST)
+**
+**  Returned (function value):
+**            int        status, as iauApco13:
+**                          +1 = dubious year
+**                           0 = OK
+**                          -1 = unacceptable date
+**
+**  Notes:
+**
+**  1) A maxdt of zero or less selects the default of 1 second.  The
+**     error an Earth rotation update incurs grows linearly with the
+**     step and is below 2.5e-10 radians (0.05 mas) per second; see
+**     ascomApco13Advance.
+**
+**  2) The parameters are as for iauApco13, which see.
+**
+**  Called:
+**     iauApco13    astrometry parameters, ICRS-observed, 2013
+**     iauUtcut1    UTC to UT1
+*/
+{
+   int j;
+
+   ctx->dut1 = dut1;
+   ctx->elong = elong;
+   ctx->phi = phi;
+   ctx->hm = hm;
+   ctx->xp = xp;
+   ctx->yp = yp;
+   ctx->phpa = phpa;
+   ctx->tc = tc;
+   ctx->rh = rh;
+   ctx->wl = wl;
+   ctx->maxdt = (maxdt > 0.0) ? maxdt : MAXDT_DEFAULT;
+   ctx->nfull = 0;
+   ctx->nera = 0;
+
+/* Diurnal aberration (Omega * r cos(phi) / c) turns with the Earth; the rest is frozen. */
+   ctx->rate = ANNUAL_RATE + BPN_RATE +
+               OMEGA * OMEGA * (REQ + hm) * fabs(cos(phi)) / CMPS;
+
+/* Full rebuild. */
+   j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &ctx->astrom, &ctx->eo);
+   if ( j < 0 ) return j;
+   if ( iauUtcut1(utc1, utc2, dut1, &ctx->ut11, &ctx->ut12) ) return -1;
+   ctx->utc1 = utc1;
+   ctx->utc2 = utc2;
+   ctx->pmt0 = ctx->astrom.pmt;
+   ctx->status = j;
+   ctx->nfull++;
+   *eo = ctx->eo;
+
+   return j;
+}
+
+int ascomApco13Advance(double utc1, double utc2, ascomASTROMCTX *ctx,
+                       double *eo, double *err)
+/*
+**  - - - - - - - - - - - - - - - - - - -
+**   a s c o m A p c o 1 3 A d v a n c e
+**  - - - - - - - - - - - - - - - - - - -
+**
+**  Bring an incremental astrometry context to a new UTC.  Within maxdt
+**  seconds of the last full rebuild only the Earth rotation angle (and
+**  the proper motion time interval) is updated; otherwise the context is
+**  rebuilt with iauApco13.
+**
+**  Given:
+**     utc1   double     UTC as a 2-part quasi Julian Date
+**     utc2   double
+**
+**  Given and returned:
+**     ctx    ascomASTROMCTX*  context from ascomApco13Init
+**
+**  Returned:
+**     eo     double*    equation of the origins (ERA-GST), as at the
+**                       last full rebuild (Note 1)
+**     err    double*    bound on the error in ctx->astrom, as an angle on
+**                       the sky (radians); zero after a full rebuild
+**
+**  Returned (function value):
+**            int        status, as iauApco13:
+**                          +1 = dubious year
+**                           0 = OK
+**                          -1 = unacceptable date
+**
+**  Notes:
+**
+**  1) An Earth rotation update leaves the Earth's position and velocity,
+**     the bias-precession-nutation matrix and the CIO locator as they
+**     were at the last full rebuild.  The dominant error is the diurnal
+**     aberration (part of the observer's velocity in astrom.v), which
+**     turns with the Earth; then the annual aberration and precession-
+**     nutation.  The bound returned is the sum of their rates times the
+**     time since the last full rebuild.  The equation of the origins is
+**     also held; it drifts by about 1e-11 radians per second.
+**
+**  2) A step that crosses a UTC day boundary is always a full rebuild, so
+**     that a leap second is never straddled by the UT1 offset.
+**
+**  3) Time may go backwards; the step is taken as an absolute value.
+**
+**  Called:
+**     iauApco13    astrometry parameters, ICRS-observed, 2013
+**     iauUtcut1    UTC to UT1
+**     iauAper13    astrometry parameters: update ERA, 2013
+*/
+{
+   int j;
+   double dt;
+
+/* Step since the last full rebuild (days), and whether it changed UTC day. */
+   dt = (utc1 - ctx->utc1) + (utc2 - ctx->utc2);
+   if ( fabs(dt) * DAYSEC <= ctx->maxdt &&
+        floor(utc1 - 0.5 + utc2) == floor(ctx->utc1 - 0.5 + ctx->utc2) ) {
+
+   /* Earth rotation only: same-day UT1 keeps the offset from UTC. */
+      iauAper13(ctx->ut11, ctx->ut12 + dt, &ctx->astrom);
+      ctx->astrom.pmt = ctx->pmt0 + dt / DJY;
+      ctx->nera++;
+      *eo = ctx->eo;
+      *err = ctx->rate * fabs(dt) * DAYSEC;
+      return ctx->status;
+   }
+
+/* Full rebuild. */
+   j = iauApco13(utc1, utc2, ctx->dut1, ctx->elong, ctx->phi, ctx->hm,
+                 ctx->xp, ctx->yp, ctx->phpa, ctx->tc, ctx->rh, ctx->wl,
+                 &ctx->astrom, &ctx->eo);
+   if ( j < 0 ) return j;
+   if ( iauUtcut1(utc1, utc2, ctx->dut1, &ctx->ut11, &ctx->ut12) ) return -1;
+   ctx->utc1 = utc1;
+   ctx->utc2 = utc2;
+   ctx->pmt0 = ctx->astrom.pmt;
+   ctx->status = j;
+   ctx->nfull++;
+   *eo = ctx->eo;
+   *err = 0.0;
+
+   return j;
+}
@@ -0,0 +1,391 @@
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Array forms of the SOFA "13" astrometry routines (iauAtco13, iauAtci13, iauAtio13 and their inverses) for a */
+/* list of targets at one date and site, so that a caller across a foreign function boundary (P/Invoke from     */
+/* SOFA.vb) crosses it once per list rather than once per target.                                              */
+
+/* Each SOFA routine builds the star-independent context (iauApco13, iauApci13 or iauApio13) and then applies   */
+/* the quick routine. Here the context is built once for the whole list and the quick routine applied to each   */
+/* target, which is what the SOFA routine does for one target, so the results are identical to calling it      */
+/* target by target. Building the context dominates the scalar call (Earth ephemeris, precession-nutation,     */
+/* CIO locator), so beyond the boundary saving each further target costs only the quick transformation.        */
+
+int ascomAtco13v(int n, const double rc[], const double dc[],
+                 const double pr[], const double pd[],
+                 const double px[], const double rv[],
+                 double utc1, double utc2, double dut1,
+                 double elong, double phi, double hm, double xp, double yp,
+                 double phpa, double tc, double rh, double wl,
+                 double aob[], double zob[], double hob[],
+                 double dob[], double rob[], double *eo)
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t c o 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  ICRS RA,Dec to observed place for an array of stars at one date and
+**  site:  as iauAtco13.
+**
+**  Given:
+**     n      int        number of stars
+**     rc,dc  double[n]  ICRS RA,Dec at J2000.0 (radians)
+**     pr,pd  double[n]  proper motions (radians/year); may be NULL
+**     px     double[n]  parallax (arcsec); may be NULL
+**     rv     double[n]  radial velocity (km/s, +ve if receding); may be
+**                       NULL
+**     utc1   double     UTC as a 2-part...
+**     utc2   double     ...quasi Julian Date
+**     dut1   double     UT1-UTC (seconds)
+**     elong  double     longitude (radians, east +ve)
+**     phi    double     latitude (geodetic, radians)
+**     hm     double     height above ellipsoid (m, geodetic)
+**     xp,yp  double     polar motion coordinates (radians)
+**     phpa   double     pressure at the observer (hPa = mB)
+**     tc     double     ambient temperature at the observer (deg C)
+**     rh     double     relative humidity at the observer (range 0-1)
+**     wl     double     wavelength (micrometers)
+**
+**  Returned:
+**     aob    double[n]  observed azimuth (radians: N=0,E=90)
+**     zob    double[n]  observed zenith distance (radians)
+**     hob    double[n]  observed hour angle (radians)
+**     dob    double[n]  observed declination (radians)
+**     rob    double[n]  observed right ascension (CIO-based, radians)
+**     eo     double*    equation of the origins (ERA-GST)
+**
+**  Returned (function value):
+**            int        status, as iauAtco13:
+**                       +1 = dubious year
+**                        0 = OK
+**                       -1 = unacceptable date (nothing returned)
+**
+**  Notes:
+**
+**  1) A NULL pr, pd, px or rv array stands for zeros for every star.
+**
+**  2) The results are those of iauAtco13 called for each star in turn,
+**     which see.
+**
+**  Called:
+**     iauApco13    astrometry parameters, ICRS-observed, 2013
+**     iauAtciq     quick ICRS to CIRS
+**     iauAtioq     quick CIRS to observed
+*/
+{
+   int j, i;
+   iauASTROM astrom;
+   double ri, di;
+
+
+/* Star-independent astrometry parameters, once. */
+   j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom, eo);
+
+/* Abort if bad UTC. */
+   if ( j < 0 ) return j;
+
+   for ( i = 0; i < n; i++ ) {
+
+   /* Transform ICRS to CIRS. */
+      iauAtciq(rc[i], dc[i],
+               pr ? pr[i] : 0.0, pd ? pd[i] : 0.0,
+               px ? px[i] : 0.0, rv ? rv[i] : 0.0,
+               &astrom, &ri, &di);
+
+   /* Transform CIRS to observed. */
+      iauAtioq(ri, di, &astrom, &aob[i], &zob[i], &hob[i], &dob[i], &rob[i]);
+   }
+
+/* Return OK/warning status. */
+   return j;
+
+}
+
+void ascomAtci13v(int n, const double rc[], const double dc[],
+                  const double pr[], const double pd[],
+                  const double px[], const double rv[],
+                  double date1, double date2,
+                  double ri[], double di[], double *eo)
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t c i 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  ICRS RA,Dec to CIRS for an array of stars at one date:  as
+**  iauAtci13.
+**
+**  Given:
+**     n      int        number of stars
+**     rc,dc  double[n]  ICRS RA,Dec at J2000.0 (radians)
+**     pr,pd  double[n]  proper motions (radians/year); may be NULL
+**     px     double[n]  parallax (arcsec); may be NULL
+**     rv     double[n]  radial velocity (km/s, +ve if receding); may be
+**                       NULL
+**     date1  double     TDB as a 2-part...
+**     date2  double     ...Julian Date
+**
+**  Returned:
+**     ri,di  double[n]  CIRS geocentric RA,Dec (radians)
+**     eo     double*    equation of the origins (ERA-GST)
+**
+**  Notes:
+**
+**  1) A NULL pr, pd, px or rv array stands for zeros for every star.
+**
+**  2) The results are those of iauAtci13 called for each star in turn,
+**     which see.
+**
+**  Called:
+**     iauApci13    astrometry parameters, ICRS-CIRS, 2013
+**     iauAtciq     quick ICRS to CIRS
+*/
+{
+   int i;
+   iauASTROM astrom;
+
+
+/* The transformation parameters, once. */
+   iauApci13(date1, date2, &astrom, eo);
+
+/* ICRS (epoch J2000.0) to CIRS. */
+   for ( i = 0; i < n; i++ ) {
+      iauAtciq(rc[i], dc[i],
+               pr ? pr[i] : 0.0, pd ? pd[i] : 0.0,
+               px ? px[i] : 0.0, rv ? rv[i] : 0.0,
+               &astrom, &ri[i], &di[i]);
+   }
+
+}
+
+int ascomAtio13v(int n, const double ri[], const double di[],
+                 double utc1, double utc2, double dut1,
+                 double elong, double phi, double hm, double xp, double yp,
+                 double phpa, double tc, double rh, double wl,
+                 double aob[], double zob[], double hob[],
+                 double dob[], double rob[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t i o 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  CIRS RA,Dec to observed place for an array of points at one date
+**  and site:  as iauAtio13.
+**
+**  Given:
+**     n      int        number of points
+**     ri,di  double[n]  CIRS right ascension, declination (radians)
+**     utc1..wl          as ascomAtco13v
+**
+**  Returned:
+**     aob..rob          as ascomAtco13v
+**
+**  Returned (function value):
+**            int        status, as iauAtio13:
+**                       +1 = dubious year
+**                        0 = OK
+**                       -1 = unacceptable date (nothing returned)
+**
+**  Note:
+**
+**     The results are those of iauAtio13 called for each point in
+**     turn, which see.
+**
+**  Called:
+**     iauApio13    astrometry parameters, CIRS-observed, 2013
+**     iauAtioq     quick CIRS to observed
+*/
+{
+   int j, i;
+   iauASTROM astrom;
+
+
+/* Star-independent astrometry parameters for CIRS->observed, once. */
+   j = iauApio13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom);
+
+/* Abort if bad UTC. */
+   if ( j < 0 ) return j;
+
+/* Transform CIRS to observed. */
+   for ( i = 0; i < n; i++ ) {
+      iauAtioq(ri[i], di[i], &astrom,
+               &aob[i], &zob[i], &hob[i], &dob[i], &rob[i]);
+   }
+
+/* Return OK/warning status. */
+   return j;
+
+}
+
+int ascomAtoc13v(int n, const char *type,
+                 const double ob1[], const double ob2[],
+                 double utc1, double utc2, double dut1,
+                 double elong, double phi, double hm, double xp, double yp,
+                 double phpa, double tc, double rh, double wl,
+                 double rc[], double dc[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t o c 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  Observed place to ICRS astrometric RA,Dec for an array of points at
+**  one date and site:  as iauAtoc13.
+**
+**  Given:
+**     n      int        number of points
+**     type   char[]     type of coordinates, for every point:  "R", "H"
+**                       or "A" (as iauAtoc13)
+**     ob1    double[n]  observed Az, HA or RA (radians; Az is N=0,E=90)
+**     ob2    double[n]  observed ZD or Dec (radians)
+**     utc1..wl          as ascomAtco13v
+**
+**  Returned:
+**     rc,dc  double[n]  ICRS astrometric RA,Dec (radians)
+**
+**  Returned (function value):
+**            int        status, as iauAtoc13:
+**                       +1 = dubious year
+**                        0 = OK
+**                       -1 = unacceptable date (nothing returned)
+**
+**  Note:
+**
+**     The results are those of iauAtoc13 called for each point in
+**     turn, which see.
+**
+**  Called:
+**     iauApco13    astrometry parameters, ICRS-observed, 2013
+**     iauAtoiq     quick observed to CIRS
+**     iauAticq     quick CIRS to ICRS
+*/
+{
+   int j, i;
+   iauASTROM astrom;
+   double eo, ri, di;
+
+
+/* Star-independent astrometry parameters, once. */
+   j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom, &eo);
+
+/* Abort if bad UTC. */
+   if ( j < 0 ) return j;
+
+   for ( i = 0; i < n; i++ ) {
+
+   /* Transform observed to CIRS. */
+      iauAtoiq(type, ob1[i], ob2[i], &astrom, &ri, &di);
+
+   /* Transform CIRS to ICRS. */
+      iauAticq(ri, di, &astrom, &rc[i], &dc[i]);
+   }
+
+/* Return OK/warning status. */
+   return j;
+
+}
+
+void ascomAtic13v(int n, const double ri[], const double di[],
+                  double date1, double date2,
+                  double rc[], double dc[], double *eo)
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t i c 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  CIRS RA,Dec to ICRS for an array of points at one date:  as
+**  iauAtic13.
+**
+**  Given:
+**     n      int        number of points
+**     ri,di  double[n]  CIRS geocentric RA,Dec (radians)
+**     date1  double     TDB as a 2-part...
+**     date2  double     ...Julian Date
+**
+**  Returned:
+**     rc,dc  double[n]  ICRS astrometric RA,Dec (radians)
+**     eo     double*    equation of the origins (ERA-GST)
+**
+**  Note:
+**
+**     The results are those of iauAtic13 called for each point in
+**     turn, which see.
+**
+**  Called:
+**     iauApci13    astrometry parameters, ICRS-CIRS, 2013
+**     iauAticq     quick CIRS to ICRS
+*/
+{
+   int i;
+   iauASTROM astrom;
+
+
+/* Star-independent astrometry parameters, once. */
+   iauApci13(date1, date2, &astrom, eo);
+
+/* CIRS to ICRS astrometric. */
+   for ( i = 0; i < n; i++ ) {
+      iauAticq(ri[i], di[i], &astrom, &rc[i], &dc[i]);
+   }
+
+}
+
+int ascomAtoi13v(int n, const char *type,
+                 const double ob1[], const double ob2[],
+                 double utc1, double utc2, double dut1,
+                 double elong, double phi, double hm, double xp, double yp,
+                 double phpa, double tc, double rh, double wl,
+                 double ri[], double di[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m A t o i 1 3 v
+**  - - - - - - - - - - - - -
+**
+**  Observed place to CIRS for an array of points at one date and site:
+**  as iauAtoi13.
+**
+**  Given:
+**     n      int        number of points
+**     type..ob2         as ascomAtoc13v
+**     utc1..wl          as ascomAtco13v
+**
+**  Returned:
+**     ri,di  double[n]  CIRS right ascension, declination (radians)
+**
+**  Returned (function value):
+**            int        status, as iauAtoi13:
+**                       +1 = dubious year
+**                        0 = OK
+**                       -1 = unacceptable date (nothing returned)
+**
+**  Note:
+**
+**     The results are those of iauAtoi13 called for each point in
+**     turn, which see.
+**
+**  Called:
+**     iauApio13    astrometry parameters, CIRS-observed, 2013
+**     iauAtoiq     quick observed to CIRS
+*/
+{
+   int j, i;
+   iauASTROM astrom;
+
+
+/* Star-independent astrometry parameters for CIRS->observed, once. */
+   j = iauApio13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom);
+
+/* Abort if bad UTC. */
+   if ( j < 0 ) return j;
+
+/* Transform observed to CIRS. */
+   for ( i = 0; i < n; i++ ) {
+      iauAtoiq(type, ob1[i], ob2[i], &astrom, &ri[i], &di[i]);
+   }
+
+/* Return OK/warning status. */
+   return j;
+
+}
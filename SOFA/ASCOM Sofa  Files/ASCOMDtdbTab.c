@@ -0,0 +1,288 @@
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* TDB-TT from a table over an interval, for time stamping streams of samples (e.g. occultation video frames). */
+
+/* ascomDtdb sums 787 terms for every date. The table holds TDB-TT over a chosen interval as Chebyshev series on */
+/* equal segments: one for the geocentric part (the Fairhead & Bretagnon series, the JPL mass adjustments and  */
+/* the site's terms in v), and one each for the slowly varying factors of the sine and cosine of local solar    */
+/* time that make up the site's terms in u. A date then costs three short Chebyshev sums and one sine and       */
+/* cosine. The segments are halved until the table, checked against ascomDtdb, meets the tolerance.             */
+
+/* Longest segment tried (days) */
+#define SEGMAX 32.0
+
+/* Points checked per segment, ends included */
+#define NCHECK (4*ASCOM_DTDB_NCOEF+1)
+
+/* Default tolerance (s) */
+#define TOL_DEFAULT 1e-10
+
+static void parts(double date1, double date2, double u, double v, double p[3])
+/*
+**  The three tabulated parts of TDB-TT at one date, from ascomDtdb and the
+**  topocentric terms of iauDtdb:  p[0] the geocentric part plus the terms
+**  in v, p[1] and p[2] the factors of sin and cos of local solar time in
+**  the terms in u.
+*/
+{
+   double t, w, elsun, emsun, d, elj, els;
+
+
+/* Time since J2000.0 in Julian millennia, with deg/arcsec factor. */
+   t = ((date1 - DJ00) + date2) / DJM;
+   w = t / 3600.0;
+
+/* Fundamental arguments, as iauDtdb. */
+   elsun = fmod(280.46645683 + 1296027711.03429 * w, 360.0) * DD2R;
+   emsun = fmod(357.52910918 + 1295965810.481 * w, 360.0) * DD2R;
+   d = fmod(297.85019547 + 16029616012.090 * w, 360.0) * DD2R;
+   elj = fmod(34.35151874 + 109306899.89453 * w, 360.0) * DD2R;
+   els = fmod(50.07744430 + 44046398.47038 * w, 360.0) * DD2R;
+
+/* Geocentric part, and the terms in v. */
+   p[0] = ascomDtdb(date1, date2, 0.0, 0.0, 0.0, 0.0)
+          -  0.02200e-10 * v * cos(elsun + emsun)
+          -  1.31840e-10 * v * cos(elsun);
+
+/* Terms in u:  u * a * sin(tsol + x) = sin(tsol) * u*a*cos(x) + cos(tsol) * u*a*sin(x). */
+   p[1] = u * (  0.00029e-10 * cos(elsun - els)
+               + 0.00100e-10 * cos(2.0 * emsun)
+               + 0.00133e-10 * cos(d)
+               + 0.00133e-10 * cos(elsun - elj)
+               - 0.00229e-10 * cos(2.0 * elsun + emsun)
+               + 0.05312e-10 * cos(emsun)
+               - 0.13677e-10 * cos(2.0 * elsun)
+               + 3.17679e-10 );
+   p[2] = u * (  0.00029e-10 * sin(elsun - els)
+               - 0.00100e-10 * sin(2.0 * emsun)
+               - 0.00133e-10 * sin(d)
+               + 0.00133e-10 * sin(elsun - elj)
+               - 0.00229e-10 * sin(2.0 * elsun + emsun)
+               - 0.05312e-10 * sin(emsun)
+               - 0.13677e-10 * sin(2.0 * elsun) );
+
+}
+
+static void cheb(const double c[3][ASCOM_DTDB_NCOEF], double x, double q[3])
+/*
+**  Evaluate the three Chebyshev series of a segment at x (-1 to +1), by
+**  Clenshaw's recurrence.
+*/
+{
+   int i, j;
+   double b0, b1, b2;
+
+
+   for ( i = 0; i < 3; i++ ) {
+      b0 = b1 = 0.0;
+      for ( j = ASCOM_DTDB_NCOEF - 1; j > 0; j-- ) {
+         b2 = b1;
+         b1 = b0;
+         b0 = 2.0 * x * b1 - b2 + c[i][j];
+      }
+      q[i] = x * b0 - b1 + c[i][0];
+   }
+
+}
+
+int ascomDtdbTabInit(double date1, double date2, double days, double tol,
+                     double elong, double u, double v, ascomDTDBTAB *tab)
+/*
+**  - - - - - - - - - - - - - - - - -
+**   a s c o m D t d b T a b I n i t
+**  - - - - - - - - - - - - - - - - -
+**
+**  Build a table of TDB-TT for one site over an interval, for
+**  ascomDtdbTab and ascomDtdbTabv.
+**
+**  Given:
+**     date1,date2  double  start of the interval, TDB (Note 1)
+**     days         double  length of the interval (days)
+**     tol          double  largest error allowed (seconds; zero or less
+**                          selects the default of 1e-10, Note 2)
+**     elong        double  longitude (east positive, radians)
+**     u            double  distance from Earth spin axis (km)
+**     v            double  distance north of equatorial plane (km)
+**
+**  Returned:
+**     tab          ascomDTDBTAB*  the table
+**
+**  Returned (function value):
+**                  int     status:  0 = OK
+**                                  -1 = days not positive
+**                                  -2 = tolerance not met within
+**                                       ASCOM_DTDB_MAXSEG segments
+**
+**  Notes:
+**
+**  1) The dates and the site are as for iauDtdb, which see.
+**
+**  2) The table is checked against ascomDtdb at 4*ASCOM_DTDB_NCOEF+1
+**     evenly spaced dates in each segment, ends included, and
+**     tab->err is set to the largest error found, for the worst local
+**     solar time.  The segments start at 32 days and are halved until
+**     that error is within the tolerance:  16 days for the default,
+**     for which the error found is a few times 1e-12 seconds.  An
+**     interval of up to 2048 days then fits in one table.
+**
+**  3) Building the table takes about 61 calls of ascomDtdb per
+**     segment, for each segment length tried.
+**
+**  Called:
+**     ascomDtdb    TDB-TT
+*/
+{
+   int nseg, k, i, j, m;
+   double seg, x, e, err, f[3][ASCOM_DTDB_NCOEF], p[3], q[3];
+
+
+   if ( days <= 0.0 ) return -1;
+
+   tab->date1 = date1;
+   tab->date2 = date2;
+   tab->days = days;
+   tab->elong = elong;
+   tab->u = u;
+   tab->v = v;
+   tab->tol = (tol > 0.0) ? tol : TOL_DEFAULT;
+
+/* Halve the segments until the table meets the tolerance. */
+   seg = (days < SEGMAX) ? days : SEGMAX;
+   for ( ; ; ) {
+      nseg = (int) ceil(days / seg);
+      if ( nseg > ASCOM_DTDB_MAXSEG ) return -2;
+      tab->seg = seg;
+      tab->nseg = nseg;
+
+      err = 0.0;
+      for ( k = 0; k < nseg && err <= tab->tol; k++ ) {
+
+      /* Fit:  the parts at the Chebyshev nodes of the segment. */
+         for ( j = 0; j < ASCOM_DTDB_NCOEF; j++ ) {
+            x = cos(DPI * (j + 0.5) / ASCOM_DTDB_NCOEF);
+            parts(date1, date2 + seg * (k + 0.5 * (x + 1.0)), u, v, p);
+            for ( i = 0; i < 3; i++ ) f[i][j] = p[i];
+         }
+         for ( i = 0; i < 3; i++ ) {
+            for ( j = 0; j < ASCOM_DTDB_NCOEF; j++ ) {
+               tab->coef[k][i][j] = 0.0;
+               for ( m = 0; m < ASCOM_DTDB_NCOEF; m++ ) {
+                  tab->coef[k][i][j] += f[i][m] *
+                     cos(DPI * j * (m + 0.5) / ASCOM_DTDB_NCOEF);
+               }
+               tab->coef[k][i][j] *= (j ? 2.0 : 1.0) / ASCOM_DTDB_NCOEF;
+            }
+         }
+
+      /* Check:  the worst case over local solar time of the u terms. */
+         for ( j = 0; j < NCHECK; j++ ) {
+            x = (double) j / (NCHECK - 1);
+            parts(date1, date2 + seg * (k + x), u, v, p);
+            cheb(tab->coef[k], 2.0 * x - 1.0, q);
+            e = fabs(q[0] - p[0]) + sqrt((q[1] - p[1]) * (q[1] - p[1]) +
+                                         (q[2] - p[2]) * (q[2] - p[2]));
+            if ( e > err ) err = e;
+         }
+      }
+      if ( err <= tab->tol ) break;
+      seg /= 2.0;
+   }
+   tab->err = err;
+
+   return 0;
+
+}
+
+int ascomDtdbTab(const ascomDTDBTAB *tab, double date1, double date2,
+                 double ut, double *dtdb)
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m D t d b T a b
+**  - - - - - - - - - - - - -
+**
+**  TDB-TT at the site of a table:  as ascomDtdb, from the table where
+**  the date is within its interval.
+**
+**  Given:
+**     tab          ascomDTDBTAB*  table from ascomDtdbTabInit
+**     date1,date2  double  date, TDB
+**     ut           double  universal time (UT1, fraction of one day)
+**
+**  Returned:
+**     dtdb         double* TDB-TT (seconds)
+**
+**  Returned (function value):
+**                  int     0 = from the table
+**                          1 = outside the interval, from ascomDtdb
+**
+**  Note:
+**
+**     The table is not changed, so it may be shared between threads.
+**
+**  Called:
+**     ascomDtdb    TDB-TT
+*/
+{
+   int k;
+   double x, q[3], tsol;
+
+
+/* Days into the interval. */
+   x = (date1 - tab->date1) + (date2 - tab->date2);
+   if ( !(x >= 0.0 && x <= tab->days) ) {
+      *dtdb = ascomDtdb(date1, date2, ut, tab->elong, tab->u, tab->v);
+      return 1;
+   }
+
+/* Segment, and the parts there. */
+   k = (int) (x / tab->seg);
+   if ( k >= tab->nseg ) k = tab->nseg - 1;
+   cheb(tab->coef[k], 2.0 * (x - k * tab->seg) / tab->seg - 1.0, q);
+
+/* Local solar time, and the sum. */
+   tsol = fmod(ut, 1.0) * D2PI + tab->elong;
+   *dtdb = q[0] + q[1] * sin(tsol) + q[2] * cos(tsol);
+
+   return 0;
+
+}
+
+int ascomDtdbTabv(const ascomDTDBTAB *tab, int n, const double date1[],
+                  const double date2[], const double ut[], double dtdb[])
+/*
+**  - - - - - - - - - - - - - -
+**   a s c o m D t d b T a b v
+**  - - - - - - - - - - - - - -
+**
+**  TDB-TT at the site of a table for an array of dates:  as
+**  ascomDtdbTab.
+**
+**  Given:
+**     tab          ascomDTDBTAB*  table from ascomDtdbTabInit
+**     n            int        number of dates
+**     date1,date2  double[n]  dates, TDB
+**     ut           double[n]  universal time (UT1, fraction of one day)
+**
+**  Returned:
+**     dtdb         double[n]  TDB-TT (seconds)
+**
+**  Returned (function value):
+**                  int        number of dates outside the interval of
+**                             the table (from ascomDtdb)
+**
+**  Called:
+**     ascomDtdbTab TDB-TT from a table
+*/
+{
+   int i, nout;
+
+
+   nout = 0;
+   for ( i = 0; i < n; i++ ) {
+      nout += ascomDtdbTab(tab, date1[i], date2[i], ut[i], &dtdb[i]);
+   }
+   return nout;
+
+}
@@ -0,0 +1,154 @@
+#include <stddef.h>
+#include "ASCOMSofa.h"
+#include "ASCOMSeries.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* iauEect00 on the ASCOM series evaluator (ASCOMSeries.c). */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under  */
+/* license, and is not itself software provided by or endorsed by SOFA. The two series for the equation of */
+/* the equinoxes complementary terms are those of the SOFA 2018-01-30 iauEect00, held by columns in one    */
+/* table and summed in one pass of ascomSeries with compensated summation.                                 */
+
+/* Terms of order t^0 and t^1:  first term, one past the last */
+#define NE0 0
+#define NE1 33
+#define NE 34
+
+/* Multipliers of l, l', F, D, Om, LVe, LE, pA */
+static const signed char m[8][NE] = {
+
+   /* l */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,
+        2,  1,  0,  1,  0,  0,  1,  1,  0 },
+
+   /* l' */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0 },
+
+   /* F */
+   {    0,  0,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  2,  2,  4,  1,  2,  2,  2,  2,  2, -2, -2,  0,  0,
+       -2,  0,  2,  0,  4,  2, -2, -2,  0 },
+
+   /* D */
+   {    0,  0, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0, -2, -2, -4, -1,  0,  0,  0,  0, -2,  2,  2,  0,  2,
+        0, -2, -2, -2, -2, -2,  0,  0,  0 },
+
+   /* Om */
+   {    1,  2,  3,  1,  2,  3,  1,  3,  1, -1, -1,  1,  3,  1,  4,  1,  0,  2,  3,  1,  0, -3, -1,  0,  0,
+       -1,  1,  2, -1,  4,  4, -3, -1,  1 },
+
+   /* LVe */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* LE */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,-13,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* pA */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 }
+};
+
+/* Sine coefficients */
+static const double es[NE] = {
+
+   /* 1-34 */
+      2640.96e-6,   63.52e-6,   11.75e-6,   11.21e-6,   -4.55e-6,    2.02e-6,    1.98e-6,
+        -1.72e-6,   -1.41e-6,   -1.26e-6,   -0.63e-6,   -0.63e-6,    0.46e-6,    0.45e-6,
+         0.36e-6,   -0.24e-6,    0.32e-6,    0.28e-6,    0.27e-6,    0.26e-6,   -0.21e-6,
+         0.19e-6,    0.18e-6,   -0.10e-6,    0.15e-6,   -0.14e-6,    0.14e-6,   -0.14e-6,
+         0.14e-6,    0.13e-6,   -0.11e-6,    0.11e-6,    0.11e-6,   -0.87e-6
+};
+
+/* Cosine coefficients */
+static const double ec[NE] = {
+
+   /* 1-34 */
+      -0.39e-6, -0.02e-6,  0.01e-6,  0.01e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6, -0.01e-6,
+      -0.01e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6, -0.12e-6,  0.00e-6,  0.00e-6,
+       0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.05e-6,  0.00e-6,  0.00e-6,  0.00e-6,
+       0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6,  0.00e-6
+};
+
+/* s0, s1 */
+static const ascomSERIES E = {
+   NE, 8, &m[0][0], 13, NULL, NULL, 2,
+   { { NE0, NE1, es + NE0, ec + NE0 },
+     { NE1, NE,  es + NE1, ec + NE1 } }
+};
+
+double ascomEect00(double date1, double date2)
+/*
+**  - - - - - - - - - - - -
+**   a s c o m E e c t 0 0
+**  - - - - - - - - - - - -
+**
+**  Equation of the equinoxes complementary terms, consistent with
+**  IAU 2000 resolutions:  as iauEect00.
+**
+**  Given:
+**     date1,date2  double   TT as a 2-part Julian Date
+**
+**  Returned (function value):
+**                  double   complementary terms (radians)
+**
+**  Notes:
+**
+**  1) The model and the date conventions are those of iauEect00, which
+**     see.
+**
+**  2) The series are summed by ascomSeries, with compensated summation.
+**     The result agrees with iauEect00 to its rounding error.
+**
+**  Called:
+**     iauFal03     mean anomaly of the Moon
+**     iauFalp03    mean anomaly of the Sun
+**     iauFaf03     mean argument of the latitude of the Moon
+**     iauFad03     mean elongation of the Moon from the Sun
+**     iauFaom03    mean longitude of the Moon's ascending node
+**     iauFave03    mean longitude of Venus
+**     iauFae03     mean longitude of Earth
+**     iauFapa03    general accumulated precession in longitude
+**     ascomSeries  evaluate a Poisson/Fourier series
+*/
+{
+   double t, fa[8], w[2];
+
+
+/* Interval between fundamental epoch J2000.0 and current date (JC). */
+   t = ((date1 - DJ00) + date2) / DJC;
+
+/* Fundamental Arguments (from IERS Conventions 2003) */
+
+/* Mean anomaly of the Moon. */
+   fa[0] = iauFal03(t);
+
+/* Mean anomaly of the Sun. */
+   fa[1] = iauFalp03(t);
+
+/* Mean longitude of the Moon minus that of the ascending node. */
+   fa[2] = iauFaf03(t);
+
+/* Mean elongation of the Moon from the Sun. */
+   fa[3] = iauFad03(t);
+
+/* Mean longitude of the ascending node of the Moon. */
+   fa[4] = iauFaom03(t);
+
+/* Mean longitude of Venus. */
+   fa[5] = iauFave03(t);
+
+/* Mean longitude of Earth. */
+   fa[6] = iauFae03(t);
+
+/* General precession in longitude. */
+   fa[7] = iauFapa03(t);
+
+/* Evaluate the EE complementary terms. */
+   ascomSeries(&E, fa, 0.0, w);
+
+   return (w[0] + w[1] * t) * DAS2R;
+
+}
@@ -0,0 +1,263 @@
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Ecliptic, equatorial (ICRS) and galactic coordinates for arrays of directions, with the matrices cached by epoch. */
+
+/* iauEqec06, iauEceq06, iauLteqec and iauLteceq build their rotation matrix (iauEcm06, iauLtecm) for every point. */
+/* Here the matrix taking ICRS to each frame is held in a caller's cache keyed by frame and date, the matrix for   */
+/* a pair of frames is formed from those once per call, and the array is then rotated with s2c, the 3x3 product   */
+/* and c2s written out inline, with selects in place of the SOFA branches so the loop vectorizes.                 */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under  */
+/* license, and is not itself software provided by or endorsed by SOFA. The ICRS to galactic matrix is that */
+/* of the SOFA 2018-01-30 iauIcrs2g; the spherical/Cartesian conversions and range reductions follow iauS2c, */
+/* iauC2s, iauAnp and iauAnpm step by step.                                                                 */
+
+/* ICRS to galactic (iauIcrs2g) */
+static double gal[3][3] = { { -0.054875560416215368492398900454,
+                                    -0.873437090234885048760383168409,
+                                    -0.483835015548713226831774175116 },
+                                  { +0.494109427875583673525222371358,
+                                    -0.444829629960011178146614061616,
+                                    +0.746982244497218890527388004556 },
+                                  { -0.867666149019004701181616534570,
+                                    -0.198076373431201528180486091412,
+                                    +0.455983776175066922272100478348 } };
+
+static int tomat(ascomFRAMECACHE *cache, int frame, double date1, double date2,
+                 double rm[3][3])
+/*
+**  The matrix taking ICRS to a frame, from the cache where it is held.
+**  Returns 0 = the ICRS itself (rm is the identity), 1 = otherwise,
+**  -1 = unknown frame.
+*/
+{
+   int i;
+
+
+   switch ( frame ) {
+   case ASCOM_FRAME_ICRS:
+      iauIr(rm);
+      return 0;
+   case ASCOM_FRAME_GAL:
+      iauCr(gal, rm);
+      return 1;
+   case ASCOM_FRAME_ECL06:
+   case ASCOM_FRAME_LTECL:
+      break;
+   default:
+      return -1;
+   }
+
+/* Held? */
+   for ( i = 0; i < cache->n; i++ ) {
+      if ( cache->m[i].frame == frame &&
+           cache->m[i].date1 == date1 && cache->m[i].date2 == date2 ) {
+         iauCr(cache->m[i].rm, rm);
+         cache->hits++;
+         return 1;
+      }
+   }
+
+/* No:  build it, in the next free entry or over the oldest. */
+   if ( frame == ASCOM_FRAME_ECL06 ) {
+      iauEcm06(date1, date2, rm);
+   } else {
+      iauLtecm(iauEpj(date1, date2), rm);
+   }
+   i = cache->next;
+   cache->m[i].frame = frame;
+   cache->m[i].date1 = date1;
+   cache->m[i].date2 = date2;
+   iauCr(rm, cache->m[i].rm);
+   cache->next = (i + 1) % ASCOM_FRAME_CACHE;
+   if ( cache->n < ASCOM_FRAME_CACHE ) cache->n++;
+   cache->misses++;
+
+   return 1;
+
+}
+
+void ascomFrameInit(ascomFRAMECACHE *cache)
+/*
+**  - - - - - - - - - - - - - - -
+**   a s c o m F r a m e I n i t
+**  - - - - - - - - - - - - - - -
+**
+**  Empty a frame matrix cache, for ascomFrameMat and ascomFramev.
+**
+**  Returned:
+**     cache   ascomFRAMECACHE*  the cache
+*/
+{
+   cache->n = 0;
+   cache->next = 0;
+   cache->hits = 0;
+   cache->misses = 0;
+
+}
+
+int ascomFrameMat(ascomFRAMECACHE *cache, int from, int to,
+                  double date1, double date2, double rm[3][3])
+/*
+**  - - - - - - - - - - - - - -
+**   a s c o m F r a m e M a t
+**  - - - - - - - - - - - - - -
+**
+**  Rotation matrix from one of the frames ICRS, ecliptic of date (IAU
+**  2006 or long-term) and galactic to another.
+**
+**  Given:
+**     from    int     frame of the given directions (Note 1)
+**     to      int     frame wanted
+**     date1   double  TT as a 2-part Julian Date (Note 2)
+**     date2   double
+**
+**  Given and returned:
+**     cache   ascomFRAMECACHE*  matrix cache (Note 3)
+**
+**  Returned:
+**     rm      double[3][3]  rotation matrix, from to to
+**
+**  Returned (function value):
+**             int     status:  0 = OK
+**                             -1 = unknown frame
+**
+**  Notes:
+**
+**  1) The frames are:
+**
+**        ASCOM_FRAME_ICRS    ICRS RA,Dec (equatorial)
+**        ASCOM_FRAME_ECL06   ecliptic of date, IAU 2006 precession and
+**                            obliquity (as iauEqec06)
+**        ASCOM_FRAME_LTECL   ecliptic of date, long-term precession
+**                            model (as iauLteqec)
+**        ASCOM_FRAME_GAL     galactic (as iauIcrs2g)
+**
+**  2) The date is used only by the ecliptic frames.  For the long-term
+**     model it is converted to a Julian epoch by iauEpj.
+**
+**  3) The cache holds the matrix taking ICRS to an ecliptic frame for
+**     the last ASCOM_FRAME_CACHE frames and dates asked for; a date is
+**     found only if both parts match exactly.  A cache must be set up
+**     by ascomFrameInit before first use.  It must not be shared
+**     between threads without a lock; each thread may have its own.
+**
+**  4) The matrix between two frames other than the ICRS is the product
+**     of the two matrices through the ICRS.
+**
+**  Called:
+**     iauEcm06     J2000.0 to ecliptic rotation matrix, IAU 2006
+**     iauLtecm     ICRS-ecliptic rotation matrix, long term
+**     iauEpj       Julian Date to Julian Epoch
+**     iauIr        initialize r-matrix to identity
+**     iauCr        copy r-matrix
+**     iauTr        transpose r-matrix
+**     iauRxr       product of two r-matrices
+*/
+{
+   int jf, jt;
+   double rf[3][3], rt[3][3];
+
+
+   if ( (jf = tomat(cache, from, date1, date2, rf)) < 0 ) return -1;
+   if ( (jt = tomat(cache, to, date1, date2, rt)) < 0 ) return -1;
+
+/* to <- ICRS <- from. */
+   if ( jf == 0 ) {
+      iauCr(rt, rm);
+   } else {
+      iauTr(rf, rf);
+      if ( jt == 0 ) {
+         iauCr(rf, rm);
+      } else {
+         iauRxr(rt, rf, rm);
+      }
+   }
+
+   return 0;
+
+}
+
+int ascomFramev(ascomFRAMECACHE *cache, int from, int to,
+                double date1, double date2, int n,
+                const double a1[], const double b1[], double a2[], double b2[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m F r a m e v
+**  - - - - - - - - - - - -
+**
+**  Transform an array of directions between the frames ICRS, ecliptic
+**  of date (IAU 2006 or long-term) and galactic:  as iauEqec06,
+**  iauEceq06, iauLteqec, iauLteceq, iauIcrs2g and iauG2icrs.
+**
+**  Given:
+**     from    int        frame of the given directions (see
+**                        ascomFrameMat)
+**     to      int        frame wanted
+**     date1   double     TT as a 2-part Julian Date (see ascomFrameMat)
+**     date2   double
+**     n       int        number of directions
+**     a1      double[n]  longitude or right ascension (radians)
+**     b1      double[n]  latitude or declination (radians)
+**
+**  Given and returned:
+**     cache   ascomFRAMECACHE*  matrix cache (see ascomFrameMat)
+**
+**  Returned:
+**     a2      double[n]  longitude or right ascension (radians, 0-2pi)
+**     b2      double[n]  latitude or declination (radians, +/-pi/2)
+**
+**  Returned (function value):
+**             int        status:  0 = OK
+**                                -1 = unknown frame (no output)
+**
+**  Notes:
+**
+**  1) Between the ICRS and another frame the arithmetic is that of the
+**     SOFA routine, so the results agree with it to the last bit or
+**     two.  Between two frames other than the ICRS the one rotation
+**     replaces the two of the SOFA routines, a difference of rounding
+**     only.
+**
+**  2) The output arrays may be the input arrays.
+**
+**  Called:
+**     ascomFrameMat  rotation matrix between frames
+*/
+{
+   int i;
+   double rm[3][3], cb, x1, y1, z1, x, y, z, d2, a, b, w;
+
+
+   if ( ascomFrameMat(cache, from, to, date1, date2, rm) ) return -1;
+
+   for ( i = 0; i < n; i++ ) {
+
+   /* Spherical to Cartesian (iauS2c). */
+      cb = cos(b1[i]);
+      x1 = cos(a1[i]) * cb;
+      y1 = sin(a1[i]) * cb;
+      z1 = sin(b1[i]);
+
+   /* Rotate (iauRxp). */
+      x = rm[0][0]*x1 + rm[0][1]*y1 + rm[0][2]*z1;
+      y = rm[1][0]*x1 + rm[1][1]*y1 + rm[1][2]*z1;
+      z = rm[2][0]*x1 + rm[2][1]*y1 + rm[2][2]*z1;
+
+   /* Cartesian to spherical (iauC2s). */
+      d2 = x*x + y*y;
+      a = (d2 == 0.0) ? 0.0 : atan2(y, x);
+      b = (z == 0.0) ? 0.0 : atan2(z, sqrt(d2));
+
+   /* Express in conventional ranges (iauAnp, iauAnpm). */
+      w = fmod(a, D2PI);
+      a2[i] = (w < 0) ? w + D2PI : w;
+      w = fmod(b, D2PI);
+      b2[i] = (fabs(w) >= DPI) ? w - dsign(D2PI, b) : w;
+   }
+
+   return 0;
+
+}
@@ -0,0 +1,316 @@
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Array forms of iauGc2gd, iauGc2gde, iauGd2gc and iauGd2gce for site networks and satellite passes. */
+
+/* The ellipsoid is fixed for the whole array, so it is looked up (iauEform) and its derived constants formed   */
+/* once. iauGc2gde is already closed form (one Halley step after Fukushima, no iteration); here its pole and    */
+/* sign branches become selects, with the general path fed a harmless value at the pole, so the loop has no     */
+/* data-dependent branches and the compiler can vectorize it. The arithmetic is that of the SOFA routines, so   */
+/* results agree with them to the last bit or two.                                                            */
+
+int ascomGc2gdv(int n, int nell, const double xyz[][3],
+                double elong[], double phi[], double height[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m G c 2 g d v
+**  - - - - - - - - - - - -
+**
+**  Geocentric to geodetic for an array of points on one reference
+**  ellipsoid:  as iauGc2gd.
+**
+**  Given:
+**     n       int          number of points
+**     nell    int          ellipsoid identifier (as iauEform)
+**     xyz     double[n][3] geocentric vectors (meters)
+**
+**  Returned:
+**     elong   double[n]    longitude (radians, east +ve)
+**     phi     double[n]    geodetic latitude (radians)
+**     height  double[n]    geodetic height above ellipsoid (meters)
+**
+**  Returned (function value):
+**             int          status:  0 = OK
+**                                  -1 = illegal identifier
+**                                  -2 = internal error
+**
+**  Notes:
+**
+**  1) The ellipsoids and conventions are those of iauGc2gd, which see.
+**
+**  2) On error all the points are set to -1e9, as iauGc2gd does for
+**     its one point.
+**
+**  Called:
+**     iauEform     Earth reference ellipsoids
+**     ascomGc2gdev geocentric to geodetic, arrays, given ellipsoid
+*/
+{
+   int i, j;
+   double a, f;
+
+
+/* Obtain reference ellipsoid parameters. */
+   j = iauEform(nell, &a, &f);
+
+/* If OK, transform the points. */
+   if ( j == 0 ) {
+      j = ascomGc2gdev(n, a, f, xyz, elong, phi, height);
+      if ( j < 0 ) j = -2;
+   }
+
+/* Deal with any errors. */
+   if ( j < 0 ) {
+      for ( i = 0; i < n; i++ ) {
+         elong[i] = -1e9;
+         phi[i] = -1e9;
+         height[i] = -1e9;
+      }
+   }
+
+   return j;
+
+}
+
+int ascomGc2gdev(int n, double a, double f, const double xyz[][3],
+                 double elong[], double phi[], double height[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m G c 2 g d e v
+**  - - - - - - - - - - - - -
+**
+**  Geocentric to geodetic for an array of points on an ellipsoid of
+**  given parameters:  as iauGc2gde.
+**
+**  Given:
+**     n       int          number of points
+**     a       double       equatorial radius (Note 1)
+**     f       double       flattening (Note 2)
+**     xyz     double[n][3] geocentric vectors (Note 1)
+**
+**  Returned:
+**     elong   double[n]    longitude (radians, east +ve)
+**     phi     double[n]    geodetic latitude (radians)
+**     height  double[n]    geodetic height above ellipsoid (Note 1)
+**
+**  Returned (function value):
+**             int          status:  0 = OK
+**                                  -1 = illegal f
+**                                  -2 = illegal a
+**
+**  Notes:
+**
+**  1) The units, conventions and method are those of iauGc2gde, which
+**     see.  On error the outputs are not changed.
+**
+**  2) The output arrays must not overlap the input array.
+**
+**  Called:  (none; see iauGc2gde)
+*/
+{
+   int i, polar;
+   double aeps2, e2, e4t, ec2, ec, b, x, y, z, p2, absz, p, s0, pn, zc,
+          c0, c02, c03, s02, s03, a02, a0, a03, d0, f0, b0, s1,
+          cc, s12, cc2, ph, h;
+
+
+/* Validate ellipsoid parameters. */
+   if ( f < 0.0 || f >= 1.0 ) return -1;
+   if ( a <= 0.0 ) return -2;
+
+/* Functions of ellipsoid parameters (with further validation of f). */
+   aeps2 = a*a * 1e-32;
+   e2 = (2.0 - f) * f;
+   e4t = e2*e2 * 1.5;
+   ec2 = 1.0 - e2;
+   if ( ec2 <= 0.0 ) return -1;
+   ec = sqrt(ec2);
+   b = a * ec;
+
+   for ( i = 0; i < n; i++ ) {
+
+   /* Cartesian components. */
+      x = xyz[i][0];
+      y = xyz[i][1];
+      z = xyz[i][2];
+
+   /* Distance from polar axis squared. */
+      p2 = x*x + y*y;
+
+   /* Longitude. */
+      elong[i] = p2 > 0.0 ? atan2(y, x) : 0.0;
+
+   /* Unsigned z-coordinate. */
+      absz = fabs(z);
+
+   /* At the pole, run the general case on a point off it, and discard it. */
+      polar = !(p2 > aeps2);
+      p = sqrt(polar ? a*a : p2);
+
+   /* Normalization. */
+      s0 = absz / a;
+      pn = p / a;
+      zc = ec * s0;
+
+   /* Prepare Newton correction factors. */
+      c0 = ec * pn;
+      c02 = c0 * c0;
+      c03 = c02 * c0;
+      s02 = s0 * s0;
+      s03 = s02 * s0;
+      a02 = c02 + s02;
+      a0 = sqrt(a02);
+      a03 = a02 * a0;
+      d0 = zc*a03 + e2*s03;
+      f0 = pn*a03 - e2*c03;
+
+   /* Prepare Halley correction factor. */
+      b0 = e4t * s02 * c02 * pn * (a0 - ec);
+      s1 = d0*f0 - b0*s0;
+      cc = ec * (f0*f0 - b0*c0);
+
+   /* Evaluate latitude and height. */
+      ph = atan(s1/cc);
+      s12 = s1 * s1;
+      cc2 = cc * cc;
+      h = (p*cc + absz*s1 - a * sqrt(ec2*s12 + cc2)) / sqrt(s12 + cc2);
+
+   /* Exception: pole. */
+      ph = polar ? DPI / 2.0 : ph;
+      height[i] = polar ? absz - b : h;
+
+   /* Restore sign of latitude. */
+      phi[i] = z < 0 ? -ph : ph;
+   }
+
+   return 0;
+
+}
+
+int ascomGd2gcv(int n, int nell, const double elong[], const double phi[],
+                const double height[], double xyz[][3])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m G d 2 g c v
+**  - - - - - - - - - - - -
+**
+**  Geodetic to geocentric for an array of points on one reference
+**  ellipsoid:  as iauGd2gc.
+**
+**  Given:
+**     n       int          number of points
+**     nell    int          ellipsoid identifier (as iauEform)
+**     elong   double[n]    longitude (radians, east +ve)
+**     phi     double[n]    latitude (geodetic, radians)
+**     height  double[n]    height above ellipsoid (geodetic, meters)
+**
+**  Returned:
+**     xyz     double[n][3] geocentric vectors (meters)
+**
+**  Returned (function value):
+**             int          status:  0 = OK
+**                                  -1 = illegal identifier
+**                                  -2 = illegal case
+**
+**  Notes:
+**
+**  1) The ellipsoids and conventions are those of iauGd2gc, which see.
+**
+**  2) On error all the vectors are set to zero, as iauGd2gc does for
+**     its one point.
+**
+**  Called:
+**     iauEform     Earth reference ellipsoids
+**     ascomGd2gcev geodetic to geocentric, arrays, given ellipsoid
+*/
+{
+   int i, j;
+   double a, f;
+
+
+/* Obtain reference ellipsoid parameters. */
+   j = iauEform(nell, &a, &f);
+
+/* If OK, transform the points. */
+   if ( j == 0 ) {
+      j = ascomGd2gcev(n, a, f, elong, phi, height, xyz);
+      if ( j != 0 ) j = -2;
+   }
+
+/* Deal with any errors. */
+   if ( j != 0 ) {
+      for ( i = 0; i < n; i++ ) iauZp(xyz[i]);
+   }
+
+   return j;
+
+}
+
+int ascomGd2gcev(int n, double a, double f, const double elong[],
+                 const double phi[], const double height[], double xyz[][3])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m G d 2 g c e v
+**  - - - - - - - - - - - - -
+**
+**  Geodetic to geocentric for an array of points on an ellipsoid of
+**  given parameters:  as iauGd2gce.
+**
+**  Given:
+**     n       int          number of points
+**     a       double       equatorial radius (Note 1)
+**     f       double       flattening (Note 1)
+**     elong   double[n]    longitude (radians, east +ve)
+**     phi     double[n]    latitude (geodetic, radians)
+**     height  double[n]    height above ellipsoid (geodetic, Note 1)
+**
+**  Returned:
+**     xyz     double[n][3] geocentric vectors (Note 1)
+**
+**  Returned (function value):
+**             int          status:  0 = OK
+**                                  -1 = illegal case (Note 2)
+**
+**  Notes:
+**
+**  1) The units and conventions are those of iauGd2gce, which see.
+**
+**  2) iauGd2gce fails only at a pole of an ellipsoid of flattening 1.
+**     Here any flattening of 1 is refused, before any point is
+**     transformed, so the loop needs no test; on error the outputs
+**     are not changed.
+**
+**  3) The output array must not overlap the input arrays.
+**
+**  Called:  (none; see iauGd2gce)
+*/
+{
+   int i;
+   double w, sp, cp, d, ac, as, r;
+
+
+/* Function of the flattening. */
+   w = 1.0 - f;
+   w = w * w;
+   if ( w <= 0.0 ) return -1;
+
+   for ( i = 0; i < n; i++ ) {
+
+   /* Functions of geodetic latitude. */
+      sp = sin(phi[i]);
+      cp = cos(phi[i]);
+      d = cp*cp + w*sp*sp;
+      ac = a / sqrt(d);
+      as = w * ac;
+
+   /* Geocentric vector. */
+      r = (ac + height[i]) * cp;
+      xyz[i][0] = r * cos(elong[i]);
+      xyz[i][1] = r * sin(elong[i]);
+      xyz[i][2] = (as + height[i]) * sp;
+   }
+
+   return 0;
+
+}
@@ -0,0 +1,156 @@
+#include <stddef.h>
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Array forms of iauHd2ae, iauAe2hd and iauHd2pa for dome slaving, rotator tables and horizon checks along a trajectory. */
+
+/* The site latitude is fixed for the whole array, so its sine and cosine are taken once. The loops are branch free  */
+/* (the zero tests of the SOFA routines become selects) and each point shares its hour angle and declination trig     */
+/* between the azimuth/elevation and the parallactic angle. The arithmetic is that of the SOFA routines, so results   */
+/* agree with them to the last bit or two.                                                                            */
+
+void ascomHd2aev(int n, double phi, const double ha[], const double dec[],
+                 double az[], double el[], double pa[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m H d 2 a e v
+**  - - - - - - - - - - - -
+**
+**  Equatorial to horizon coordinates, and parallactic angle, for an
+**  array of points at one site:  as iauHd2ae and iauHd2pa.
+**
+**  Given:
+**     n      int       number of points
+**     phi    double    site latitude (radians)
+**     ha     double[n] hour angle (local, radians)
+**     dec    double[n] declination (radians)
+**
+**  Returned:
+**     az     double[n] azimuth (radians, 0-2pi, N=0, E=90 degrees)
+**     el     double[n] altitude (informally, elevation; radians)
+**     pa     double[n] parallactic angle (radians, -pi to +pi); may be
+**                      NULL if not wanted
+**
+**  Notes:
+**
+**  1) The conventions, and the treatment of points at the pole and the
+**     zenith, are those of iauHd2ae and iauHd2pa, which see.
+**
+**  2) The output arrays must not overlap the input arrays.
+**
+**  Called:  (none; see iauHd2ae, iauHd2pa)
+*/
+{
+   int i;
+   double sp, cp, sh, ch, sd, cd, x, y, z, r, a, sqsz, cqsz;
+
+
+/* Site trig, once. */
+   sp = sin(phi);
+   cp = cos(phi);
+
+   if ( pa == NULL ) {
+      for ( i = 0; i < n; i++ ) {
+         sh = sin(ha[i]);
+         ch = cos(ha[i]);
+         sd = sin(dec[i]);
+         cd = cos(dec[i]);
+
+      /* Az,Alt unit vector. */
+         x = - ch*cd*sp + sd*cp;
+         y = - sh*cd;
+         z = ch*cd*cp + sd*sp;
+
+      /* To spherical. */
+         r = sqrt(x*x + y*y);
+         a = (r != 0.0) ? atan2(y,x) : 0.0;
+         az[i] = (a < 0.0) ? a+D2PI : a;
+         el[i] = atan2(z,r);
+      }
+   } else {
+      for ( i = 0; i < n; i++ ) {
+         sh = sin(ha[i]);
+         ch = cos(ha[i]);
+         sd = sin(dec[i]);
+         cd = cos(dec[i]);
+
+      /* Az,Alt unit vector. */
+         x = - ch*cd*sp + sd*cp;
+         y = - sh*cd;
+         z = ch*cd*cp + sd*sp;
+
+      /* To spherical. */
+         r = sqrt(x*x + y*y);
+         a = (r != 0.0) ? atan2(y,x) : 0.0;
+         az[i] = (a < 0.0) ? a+D2PI : a;
+         el[i] = atan2(z,r);
+
+      /* Parallactic angle from the same trig. */
+         sqsz = cp*sh;
+         cqsz = sp*cd - cp*sd*ch;
+         pa[i] = ( sqsz != 0.0 || cqsz != 0.0 ) ? atan2(sqsz,cqsz) : 0.0;
+      }
+   }
+
+/* Finished. */
+
+}
+
+void ascomAe2hdv(int n, double phi, const double az[], const double el[],
+                 double ha[], double dec[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m A e 2 h d v
+**  - - - - - - - - - - - -
+**
+**  Horizon to equatorial coordinates for an array of points at one
+**  site:  as iauAe2hd.
+**
+**  Given:
+**     n      int       number of points
+**     phi    double    site latitude (radians)
+**     az     double[n] azimuth (radians, N=0, E=90 degrees)
+**     el     double[n] altitude (informally, elevation; radians)
+**
+**  Returned:
+**     ha     double[n] hour angle (local, radians)
+**     dec    double[n] declination (radians)
+**
+**  Notes:
+**
+**  1) The conventions are those of iauAe2hd, which see.
+**
+**  2) The output arrays must not overlap the input arrays.
+**
+**  Called:  (none; see iauAe2hd)
+*/
+{
+   int i;
+   double sp, cp, sa, ca, se, ce, x, y, z, r;
+
+
+/* Site trig, once. */
+   sp = sin(phi);
+   cp = cos(phi);
+
+   for ( i = 0; i < n; i++ ) {
+      sa = sin(az[i]);
+      ca = cos(az[i]);
+      se = sin(el[i]);
+      ce = cos(el[i]);
+
+   /* HA,Dec unit vector. */
+      x = - ca*ce*sp + se*cp;
+      y = - sa*ce;
+      z = ca*ce*cp + se*sp;
+
+   /* To spherical. */
+      r = sqrt(x*x + y*y);
+      ha[i] = (r != 0.0) ? atan2(y,x) : 0.0;
+      dec[i] = atan2(z,r);
+   }
+
+/* Finished. */
+
+}
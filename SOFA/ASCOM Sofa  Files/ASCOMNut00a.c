@@ -0,0 +1,1827 @@
+#include <stddef.h>
+#include "ASCOMSofa.h"
+#include "ASCOMSeries.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* iauNut00a on the ASCOM series evaluator (ASCOMSeries.c). */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under    */
+/* license, and is not itself software provided by or endorsed by SOFA. The luni-solar and planetary tables  */
+/* below are those of the SOFA 2018-01-30 iauNut00a, term for term, held by columns rather than by rows, and  */
+/* the fundamental arguments are computed exactly as there. It differs from iauNut00a only in the summation:  */
+/* ascomSeries takes the terms a block at a time and adds them with compensated summation, instead of one at  */
+/* a time largest last into plain doubles, so results differ from iauNut00a by no more than the rounding of   */
+/* the latter.                                                                                                */
+
+/* ------------------------- */
+/* Luni-Solar nutation model */
+/* ------------------------- */
+
+/* Number of terms */
+#define NLS 678
+
+/* Multipliers of l, l', F, D, Om */
+static const signed char mls[5][NLS] = {
+
+   /* l */
+   {    0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0, -1, -1,  1, -1, -1,  1, -2,  0,  0,  0, -2,  2,  1, -1,
+        2,  0,  0, -1,  0,  0,  1,  0, -1,  0,  1, -2,  0,  0,  0,  0,  1,  2, -2,  2,  0,  0, -1,  2,  1,
+        0,  1, -2,  3,  0,  1,  0, -1, -1,  0, -2,  1,  2, -1,  1,  1, -1,  1, -1,  0, -1, -1,  0,  1, -2,
+       -1,  1, -2, -1,  2,  2,  1,  3,  3,  0,  0,  0,  0, -1,  2, -2, -1, -1,  0,  0,  0,  0,  0, -2,  1,
+       -1, -1,  1,  1, -1,  3,  0, -1,  0, -1,  0,  1, -1,  0,  2,  0,  1, -1,  0,  0,  0,  0, -1,  2,  1,
+        1,  2,  1, -1,  0,  0, -1,  0, -1,  1,  1,  0,  1,  0,  1, -1,  1,  1,  0, -1, -2,  4,  2,  2,  0,
+        1, -1,  0, -2,  2,  1, -1, -1,  2,  0, -1,  2,  0,  0,  0,  0,  0,  0, -1,  1, -2, -2, -2, -1,  0,
+        3, -2,  1,  0, -2, -3,  1,  0,  3, -1,  2,  0,  2, -1,  0,  0,  2,  4,  2,  0,  1,  0, -3, -1, -1,
+       -1, -2,  1, -2, -2,  2, -3, -2, -1,  0, -1,  0, -1,  2,  0, -2, -1, -1,  3, -1,  2,  0,  0,  2,  0,
+       -1,  0,  1,  1, -1,  1, -2, -1, -2,  0,  1,  2,  1,  4,  2,  3, -2,  1,  1, -1,  0,  0, -2, -2, -1,
+        1,  0, -1,  1,  1,  2,  1,  2, -2,  1,  0,  1, -2,  1,  1,  1,  2,  3,  4, -2,  0,  1,  0,  2, -1,
+        1,  0,  0, -1,  0, -2, -1,  2,  0,  0, -1, -2,  1, -3, -3, -2,  2, -2,  1,  0, -1,  0,  1,  1, -1,
+        3,  0,  2,  0,  2, -1,  1,  1,  0, -1,  3, -1,  1, -2,  2, -1,  1,  2,  1, -3,  2, -1, -4, -1,  0,
+        1,  0, -2,  0, -2, -2,  0,  1,  3, -1,  1,  1, -3, -3, -2,  0, -3, -1,  0,  2,  0,  1, -2, -2, -4,
+        1, -1,  0,  0, -3, -3,  1, -1,  1,  1,  0, -1,  1,  0, -1,  1, -1,  1, -1, -1,  3,  1,  1, -2,  0,
+       -2, -2,  2,  1,  0,  1, -2,  2,  0,  0,  0,  0, -3, -1,  1, -1, -1, -1,  1,  0, -2,  0,  0, -1, -1,
+       -2,  1,  0,  3,  2,  1,  0,  1,  3,  3,  2,  1,  0,  1, -2,  0, -2,  0,  0, -1, -2,  2,  2, -1,  3,
+        4, -1, -1, -3, -1,  3,  3,  3,  1,  5,  0,  2,  0,  1,  3,  3,  5,  0,  4,  0, -1,  0,  1,  2, -1,
+       -1, -1, -2, -1, -4, -3, -2,  1,  2, -4, -3, -1,  0,  0, -3, -2, -1, -4,  2,  2,  0, -1, -2,  1,  1,
+        0,  1, -1, -2, -2, -2, -2,  1,  1, -1,  2, -1,  0, -1, -1,  0, -2,  1,  1, -3, -1, -1, -3, -3,  2,
+        0,  2, -2,  0,  0, -1,  2, -4, -1,  0, -3, -1, -2,  0, -2,  1, -1,  1,  2,  2,  0,  0, -1, -1, -1,
+       -2,  0, -2,  0, -3,  1, -1,  1,  0,  0,  0, -1,  0, -2,  2,  3,  1,  1,  2, -1, -2,  0,  0, -1, -2,
+       -1,  2,  1, -1,  0, -1, -1, -1,  0, -2,  2,  1,  1,  1,  0,  2,  0,  0,  0,  4,  2,  2, -1, -1, -3,
+       -3, -1, -3, -3,  0, -2, -4, -1, -3,  0, -1,  1,  0, -1,  0, -2, -1,  3,  2,  2,  0,  0,  0, -1, -1,
+        1,  3,  1, -2,  0, -2, -2,  0,  0, -1, -2,  2,  1,  0,  0,  1,  0,  1, -1, -2,  2,  2,  2,  1,  0,
+        2,  3,  1,  1,  1,  0,  2,  2,  4, -1, -3, -1, -3,  1,  1, -2,  1,  3,  1,  0, -1,  0, -1,  2,  5,
+        2,  1,  3,  3, -2,  0,  0, -2,  2,  2,  2,  0,  1,  4,  2,  0,  4,  3,  2,  4, -1, -1,  1,  1,  3,
+        5,  2,  2 },
+
+   /* l' */
+   {    0,  0,  0,  0,  1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,
+        0,  0,  1,  0,  2,  0,  0, -1,  0,  2,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0, -1,  0, -1,  0,  0,
+        1, -1,  0,  0, -1, -1,  0, -1,  0, -1,  0,  1,  0,  1,  1,  0,  0,  0,  0,  0,  0,  1, -2,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0, -1,  0,  1,  0, -1,  0,  0, -1,  1,
+        1,  1, -1, -1,  1,  0,  1,  0,  1, -1, -1,  0,  0, -1, -1,  0, -1,  1,  1, -1,  3,  0,  0,  1,  1,
+        1,  0,  0,  0,  1,  1,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0, -1,  1,  1,
+        0, -1,  1,  0,  0,  0,  0,  0,  0,  0, -2,  1,  0,  0,  3,  0, -1,  0, -1,  0,  2, -1,  0, -1,  0,
+        0, -1,  0, -2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  1,  0, -2,  0,  0,  0,  2,  0,  2,  0,  1, -1,
+       -2, -1, -1,  1,  1,  1,  0,  0,  1, -1,  0, -2,  0,  0,  0,  0,  0,  1,  0,  0, -1,  1, -1, -1,  2,
+       -1, -2,  0, -1, -1, -1, -1,  0, -1,  2,  1,  0,  0,  0,  1, -1,  2,  0,  1, -1, -1, -1,  0,  0,  0,
+       -2,  1,  2, -1,  2, -1,  0,  1,  0, -2,  1,  0,  0,  1,  0,  0,  0,  1,  0, -1,  1,  0, -1, -1,  0,
+        0,  1,  0,  0,  0,  1,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0, -1,  1,  1,  1,  1,  0, -1,  1,  2,
+        1, -1, -1,  0,  0, -1,  0, -2,  0,  1,  0,  0,  1,  0,  1,  0,  0,  0,  1,  1,  0,  0,  0, -1,  0,
+        0, -1,  1,  0, -2,  0, -2,  2,  0,  1, -1,  1,  0,  0,  0,  0,  0, -1,  1,  1,  2,  0,  0, -1,  0,
+        1,  0,  0,  3, -1,  0, -1, -1, -2, -1,  0, -1, -2, -1,  0,  1,  1,  2,  2,  0,  0,  2,  0, -1, -1,
+        1, -1,  0,  0,  1, -1,  0,  1,  1, -1,  0,  2,  0, -1, -2,  0, -2,  0,  0,  0,  0,  0,  0,  1, -1,
+        0,  0, -1, -1,  0, -1,  0,  0,  1, -1,  0,  1,  0,  2,  0, -1, -1, -2, -1,  0,  1,  0, -2,  1,  0,
+        0,  0, -2,  0,  0,  0, -1,  0,  0,  0, -1, -1,  1, -1, -1,  0,  0,  0,  0, -1,  0, -2,  0, -2,  0,
+        0, -1,  2,  0,  1,  0, -1,  0, -1,  0,  1,  0, -2, -2,  0, -1,  0,  0,  1, -1,  0,  2,  1,  1,  0,
+        2, -1,  1,  0,  0, -2,  0,  2,  1,  2,  0,  2,  0, -1,  1,  0,  1, -2,  0,  1,  1, -1,  0, -1,  0,
+        1,  0,  1, -1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  0, -1,  0,  0,  0,  1,  1,  1,  1, -1, -3,  0,
+       -1,  0,  0, -1,  0,  1,  1, -2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  2,  0,  1, -2, -3,  0, -1,  0,
+        0, -2, -1,  0, -2,  0,  1, -1, -1,  1, -2,  1,  0,  0,  2, -1, -1,  0,  1,  0,  2,  0, -2, -3,  0,
+        0, -1,  0,  0,  1,  1,  0,  0,  0,  0,  1, -2,  1,  0,  0,  0,  1,  0,  1, -1,  0,  0,  0,  2,  0,
+        2,  1,  1, -1, -2,  0, -2, -3,  0, -1,  0, -1,  0,  1,  1, -1,  0,  0,  0,  0,  1,  1, -1,  0,  1,
+        0,  0,  0,  0,  1,  2,  1,  0,  1, -1, -1,  0,  0, -1, -1,  0, -2, -1, -1,  0,  1,  1,  0,  0,  0,
+        1,  0,  1,  0, -1,  0, -2,  0,  0,  0, -2,  0,  0,  0,  0,  0, -1,  0,  1,  1, -1,  0, -1,  1,  1,
+        0, -1,  0 },
+
+   /* F */
+   {    0,  2,  2,  0,  0,  2,  0,  2,  2,  2,  2,  2,  0,  0,  0,  2,  2,  2,  0,  2,  2,  0,  2,  2,  2,
+        0,  2,  0,  0,  2, -2,  0,  0,  2,  0,  2,  2,  2,  2,  2,  0,  2,  2,  0,  2,  2,  0,  0,  0,  0,
+        2,  0,  2,  2,  0,  2,  0,  2,  2,  2,  0,  2,  0,  0,  0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  2,
+        0,  2,  2,  4,  2,  2,  0,  0,  2,  4,  2, -2,  2,  0, -2,  0,  0,  0,  0, -2,  2,  2,  2,  0,  0,
+        0,  0,  0,  2,  2,  2, -2,  0,  2,  2,  0,  2, -2,  2,  2,  0,  2,  2,  0, -2,  2,  0,  2,  2,  0,
+        2,  0, -2,  0,  0,  0,  2,  0,  0,  2,  0,  0,  2,  2,  0,  2, -2,  2,  2,  2,  2,  2,  0,  2,  2,
+        4,  0,  0,  2,  2,  0,  0,  4,  2,  2,  0,  0,  4,  0,  0,  2,  0,  0,  2,  2,  0,  2,  0,  2,  4,
+        2,  0,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0,  2,  0,  2,  2,  0,  2,  0,  0,  0,  2,  0,  2,  0,
+        2,  2,  2,  0,  2,  0,  2,  2,  0,  2,  4,  2,  2,  0,  2,  4, -2,  2,  0,  2,  2,  2,  2,  2, -2,
+        2,  0,  2,  0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  0,  2,  2,  0,  2,  2,  2,  0,  0,  0, -2, -2,
+        0,  0,  0,  2,  2,  2,  2,  2,  0,  2,  2,  4,  4,  2,  0,  2,  2,  2,  2,  2, -2, -2, -2,  0,  2,
+        2,  2,  2, -2,  2,  0,  0,  2,  4,  4,  0,  0, -2,  2,  2,  2,  0,  2,  0,  4,  0,  0,  0,  0,  2,
+        2,  0,  0,  4,  4,  2,  0,  2,  2,  2,  0,  4,  2,  2,  2,  2,  2,  2, -2,  2, -2,  0,  2,  0, -2,
+        0,  2,  2,  2,  0, -2, -2,  0,  0,  2,  2,  0,  2,  2,  0, -2,  0, -2,  2,  0,  0,  0,  2,  0,  0,
+        0,  2,  4,  2,  0,  0, -2,  0,  0,  0,  0,  2,  2,  2,  2,  0,  2,  0,  2,  4,  2,  2,  4,  0,  0,
+        0,  2, -2,  0,  0,  2,  4,  0,  2,  4,  4,  2,  0,  0,  0,  0,  2,  0, -2, -2, -2,  0,  0,  0,  2,
+        2,  0,  2,  0,  0,  2,  2,  2,  0,  2,  2,  2,  4,  2,  0,  0,  2,  2,  2,  2,  2,  0,  2,  2,  2,
+        2,  0,  2,  2,  2,  0,  2,  2,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  1,  2, -1,  0,  1,
+        1,  2,  0,  1,  2,  2,  2, -2, -2,  2,  0, -1,  0,  0,  0,  0, -2,  0, -2,  0,  1,  0,  2,  0,  1,
+        0,  2,  2,  4,  4,  0, -2,  2,  2,  2,  0,  0,  0,  2,  0,  0,  0,  0, -2,  0, -2,  0,  0,  0,  2,
+        2,  0,  2,  2,  0,  0, -2,  2,  0, -2,  0, -2, -2, -4, -2,  2,  2,  0,  2,  2,  4,  4, -2,  0, -2,
+        0, -2,  0,  0,  2, -2,  0,  2,  1,  1,  1,  0,  2,  2,  0,  0,  2,  0,  2,  4,  0,  0, -2,  0,  0,
+        0,  0,  0,  0,  2,  1,  0,  2,  2,  2,  2,  0,  1,  1,  0,  2,  4,  4,  4,  2,  2,  4,  0,  2,  2,
+        2,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  2,  2,  2,  0,  0,  2,  2,  3,  3,  2,  4,
+        2,  2,  4,  0,  0,  0,  2,  2,  0,  2,  2,  0,  0,  0,  0,  2,  2,  2,  2,  4,  0,  0,  2,  2,  2,
+        2,  2,  2,  3,  2,  2,  2,  4,  2,  0,  2,  0,  2,  0,  0,  2,  2,  0,  2,  2,  2,  2,  4,  2,  0,
+        2,  4,  2,  4,  2,  0,  2,  2,  0,  0,  2,  2,  2,  0,  2,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+        2,  2,  2 },
+
+   /* D */
+   {    0, -2,  0,  0,  0, -2,  0,  0,  0, -2, -2,  0,  2,  0,  0,  2,  0,  0,  2,  2, -2,  2,  0, -2,  0,
+        0,  0,  0,  2, -2,  2, -2,  0,  2,  0,  2,  0,  0,  2,  0,  2, -2, -2,  2,  0, -2, -2,  2, -2,  2,
+       -2,  0,  0,  0,  2,  0,  1,  2,  0,  2,  0,  0,  0,  1,  0,  0, -2,  0,  1,  1,  4,  1, -2,  2,  2,
+        0, -2,  4,  0, -2,  2,  2,  0, -2, -2,  0,  2, -2,  4,  0,  4,  2,  1,  0,  0,  0, -1,  4,  2, -2,
+        2,  1,  0,  2,  2,  0,  2, -2,  2,  2,  0, -4,  2,  2,  0,  2,  0,  0,  2,  2, -2,  1,  2,  0,  0,
+        0,  2,  2,  2,  1, -2, -2, -1,  0, -1,  2,  4,  1,  1, -2,  4,  0, -2,  2, -1,  2,  0,  0, -2,  1,
+       -2,  0,  2,  4,  0,  1,  4,  0,  2, -3,  2,  0,  0,  0,  0, -4,  2,  4,  4,  4,  2,  0,  2,  0, -2,
+       -2,  2, -1,  2,  4,  0,  2,  4,  2, -2, -4, -2, -4,  2, -1,  2,  2, -2, -2,  0, -4, -2,  4,  0,  4,
+        2,  4,  2,  2,  0, -2,  0, -2,  2, -1, -2,  0,  1,  0,  0,  0,  0,  2,  0,  3,  0,  2,  4,  2,  2,
+       -1,  0, -4, -2,  0, -2,  4,  3,  2,  0,  2, -1,  1,  0,  0,  0,  2, -3, -4, -2, -1, -2,  0,  2,  4,
+        0,  1,  2, -2, -2, -2, -1, -2, -2,  0,  1, -2,  2,  1,  4,  2,  1,  0,  0,  0,  2,  1,  2, -2, -1,
+       -3, -2, -3,  2, -4,  0, -1, -4, -4, -4,  2,  3,  2,  2,  2,  2,  0,  2,  1, -2, -2, -4,  2,  2,  2,
+       -2,  4,  2,  0, -2,  4,  4,  2,  3,  4,  2,  2,  2,  6,  2,  6,  4,  4,  1,  1,  0,  1,  2,  1,  2,
+       -1, -2,  0, -2,  2,  4,  2, -2, -4, -2, -4, -2,  0,  0,  1,  1,  2,  2, -4, -4, -2, -3, -2,  0,  2,
+       -4, -4, -4, -2,  4,  4,  2,  2,  0,  0,  1,  0, -2, -1,  0,  0,  0,  0,  0, -2, -4, -2, -4,  4,  2,
+        4,  2,  2,  1,  2, -1,  0,  0,  0, -2, -2,  0,  6,  4,  2,  4,  2, -2, -2, -2,  0,  3,  3,  4,  2,
+        3,  2,  1,  0,  1,  0,  1,  0,  0, -2, -1,  0, -1,  0,  6,  4,  4,  2,  2,  3,  4,  2,  0,  3, -1,
+       -2,  6,  4,  6,  4,  2,  0,  0,  0, -2,  4,  2,  4,  4,  2,  2,  0,  6,  2, -1,  0, -2,  0, -2,  0,
+        0, -1,  2,  0,  2,  1,  0,  1,  0,  2,  3,  2,  0,  0,  3,  2,  3,  4,  0, -2, -1,  1,  0, -1, -2,
+        0, -3, -1, -2, -2,  2,  4, -4, -4, -2, -3,  0, -2, -2,  0, -1,  1, -2,  0,  2,  2,  0,  2,  2, -6,
+       -4, -4, -2, -4, -2, -2, -2,  0, -1,  0,  1,  1,  2,  2,  2, -6, -4, -4, -4, -4, -4, -4,  4,  2,  4,
+        3,  3,  3,  1,  2,  2,  2, -2,  0,  0,  0,  2,  0,  0, -1, -2, -2,  0, -3, -2,  4,  2,  4,  3,  4,
+        3,  0,  1,  2,  0,  2,  3,  1,  0,  2, -2,  1,  0,  0,  2, -2, -2, -2, -2, -4, -2, -4,  4,  2,  4,
+       -2, -2,  0,  2, -4, -2,  0, -4, -2,  3,  4,  0,  3,  2,  2,  2,  2,  0,  1, -1,  0,  0,  0,  2,  0,
+        0, -2, -2,  6,  4,  6,  4,  2,  4,  3,  4,  2,  3,  4,  4,  1,  2,  2,  2,  2,  2,  2,  0,  1,  2,
+        0,  0,  0,  0,  1,  2,  0, -2, -2,  6,  6,  6,  6,  4,  4,  5,  2,  2,  2,  3,  4,  3,  2,  1,  0,
+        1,  0,  0, -2,  6,  6,  4,  6,  4,  4,  2,  4,  3,  2,  2,  2,  0,  1,  2,  0,  6,  6,  4,  4,  2,
+        0,  4,  4 },
+
+   /* Om */
+   {    1,  2,  2,  2,  0,  2,  0,  1,  2,  2,  1,  2,  0,  1,  1,  2,  1,  1,  0,  2,  2,  0,  2,  2,  1,
+        0,  0,  1,  1,  2,  0,  1,  1,  1,  0,  2,  0,  2,  1,  2,  1,  1,  2,  1,  1,  1,  1,  0,  1,  0,
+        1,  0,  2,  2,  0,  2,  0,  2,  0,  2,  1,  2,  1,  0,  0,  0,  1,  2,  0,  2,  2,  1,  1,  1,  2,
+        2,  2,  2,  2,  1,  2,  1,  0,  2,  2,  1,  1,  3,  0,  1,  0,  1,  1,  2,  1,  1,  2,  2,  0,  1,
+        0,  2,  1,  2,  2,  1,  0,  1,  2,  1,  2,  1,  0,  1,  2,  2,  1,  2,  0,  0,  2,  1,  0,  2,  1,
+        1,  0,  0,  2,  0,  1,  2,  1,  1,  2,  0,  0,  2,  1,  2,  1,  1,  1,  0,  1,  1,  2,  0,  2,  2,
+        2,  1,  1,  1,  0,  0,  1,  1,  1,  2,  0,  0,  2,  3,  0,  1,  1,  1,  2,  2,  0,  1,  2,  2,  1,
+        1,  1,  1,  0,  1,  1,  2,  1,  2,  1,  1,  2,  1,  1,  1,  2,  1,  2,  2,  1,  1,  1,  0,  1,  0,
+        2,  2,  1,  0,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  3,  2,  1,  1,  1,  2,  1,  1,  2,  2,  0,
+        1,  1,  2,  1,  1,  2,  0,  0,  2,  2,  0,  2,  1,  0,  1,  2,  1,  1,  1,  1,  1,  1,  2,  0,  0,
+        0,  1,  0,  1,  2,  2,  1,  1,  1,  2,  1,  1,  2,  2,  0,  0,  2,  2,  1,  0,  1,  0,  1,  1,  2,
+        2,  3,  1,  1,  2,  1,  1,  2,  4,  2,  1,  0,  1,  2,  1,  0,  1,  2,  0,  2,  1,  1,  1,  1,  2,
+        2,  0,  0,  1,  2,  1,  1,  2,  2,  2,  0,  2,  1,  2,  2,  2,  1,  2,  0,  2,  2,  2,  1,  0,  2,
+        2,  3,  0,  4,  0,  0,  0,  1,  1,  2,  1,  2,  0,  2,  0,  0,  1,  0,  1,  1,  1,  1,  2,  1,  0,
+        1,  1,  1,  2,  0,  1,  0,  2,  1,  2,  2,  0,  2,  1,  3,  2,  0,  0,  2,  1,  2,  1,  2,  1,  2,
+        0,  1,  0,  1,  2,  2,  1,  1,  0,  2,  4,  1,  0,  1,  0,  2,  1,  2,  1,  1,  1,  1,  0,  0,  0,
+        2,  2,  2,  0,  0,  0,  0,  3,  0,  2,  1,  0,  2,  2,  0,  1,  1,  1,  0,  1,  2,  2,  2,  2,  2,
+        1,  0,  2,  2,  0,  1,  1,  0,  2,  2,  1,  1,  2,  2,  2,  1,  2,  2,  2,  1,  3,  3,  1,  1,  2,
+        1,  2,  2,  0,  2,  1,  2,  1,  1,  0,  0,  0,  2,  2,  0,  2,  0,  0,  1,  2,  0,  0,  2,  1,  1,
+        2,  1,  1,  2,  1,  1,  0,  1,  2,  1,  1,  1,  0,  2,  2,  2,  0,  1,  2,  0,  0,  2,  0,  0,  1,
+        2,  2,  1,  1,  2,  0,  1,  1,  1,  2,  0,  0,  1,  0,  0,  1,  2,  2,  2,  1,  4,  2,  0,  0,  1,
+        0,  0,  1,  0,  0,  0,  2,  1,  2,  1,  0,  1,  2,  2,  1,  1,  3,  1,  2,  2,  0,  0,  0,  0,  2,
+        1,  0,  0,  0,  1,  1,  0,  2,  0,  1,  2,  1,  1,  0,  0,  1,  1,  3,  1,  2,  2,  2,  0,  2,  2,
+        1,  1,  2,  0,  1,  1,  1,  1,  1,  2,  1,  1,  0,  3,  2,  2,  0,  2,  0,  2,  1,  3,  2,  1,  0,
+        1,  1,  2,  0,  0,  1,  2,  2,  2,  2,  0,  1,  0,  1,  0,  2,  3,  2,  2,  1,  1,  0,  0,  0,  0,
+        3,  2,  2,  3,  1,  2,  0,  1,  2,  0,  2,  1,  1,  1,  0,  2,  1,  0,  0,  1,  1,  2,  1,  1,  0,
+        2,  1,  1,  2,  2,  0,  2,  1,  1,  0,  2,  0,  2,  0,  0,  2,  2,  2,  1,  2,  2,  1,  1,  2,  2,
+        1,  2,  1 }
+};
+
+/* Longitude sin coefficients */
+static const double sp[NLS] = {
+
+   /* 1-48 */
+      -172064161.0,  -13170906.0,   -2276413.0,    2074554.0,    1475877.0,    -516821.0,
+          711159.0,    -387298.0,    -301461.0,     215829.0,     128227.0,     123457.0,
+          156994.0,      63110.0,     -57976.0,     -59641.0,     -51613.0,      45893.0,
+           63384.0,     -38571.0,      32481.0,     -47722.0,     -31046.0,      28593.0,
+           20441.0,      29243.0,      25887.0,     -14053.0,      15164.0,     -15794.0,
+           21783.0,     -12873.0,     -12654.0,     -10204.0,      16707.0,      -7691.0,
+          -11024.0,       7566.0,      -6637.0,      -7141.0,      -6302.0,       5800.0,
+            6443.0,      -5774.0,      -5350.0,      -4752.0,      -4940.0,       7350.0,
+
+   /* 49-96 */
+            4065.0,       6579.0,       3579.0,       4725.0,      -3075.0,      -2904.0,
+            4348.0,      -2878.0,      -4230.0,      -2819.0,      -4056.0,      -2647.0,
+           -2294.0,       2481.0,       2179.0,       3276.0,      -3389.0,       3339.0,
+           -1987.0,      -1981.0,       4026.0,       1660.0,      -1521.0,       1314.0,
+           -1283.0,      -1331.0,       1383.0,       1405.0,       1290.0,      -1214.0,
+            1146.0,       1019.0,      -1100.0,       -970.0,       1575.0,        934.0,
+             922.0,        815.0,        834.0,       1248.0,       1338.0,        716.0,
+            1282.0,        742.0,       1020.0,        715.0,       -666.0,       -667.0,
+
+   /* 97-144 */
+            -704.0,       -694.0,      -1014.0,       -585.0,       -949.0,       -595.0,
+             528.0,       -590.0,        570.0,       -502.0,       -875.0,       -492.0,
+             535.0,       -467.0,        591.0,       -453.0,        766.0,       -446.0,
+            -488.0,       -468.0,       -421.0,        463.0,       -673.0,        658.0,
+            -438.0,       -390.0,        639.0,        412.0,       -361.0,        360.0,
+             588.0,       -578.0,       -396.0,        565.0,       -335.0,        357.0,
+             321.0,       -301.0,       -334.0,        493.0,        494.0,        337.0,
+             280.0,        309.0,       -263.0,        253.0,        245.0,        416.0,
+
+   /* 145-192 */
+            -229.0,        231.0,       -259.0,        375.0,        252.0,       -245.0,
+             243.0,        208.0,        199.0,       -208.0,        335.0,       -325.0,
+            -187.0,        197.0,       -192.0,       -188.0,        276.0,       -286.0,
+             186.0,       -219.0,        276.0,       -153.0,       -156.0,       -154.0,
+            -174.0,       -163.0,       -228.0,         91.0,        175.0,       -159.0,
+             141.0,        147.0,       -132.0,        159.0,        213.0,        123.0,
+            -118.0,        144.0,       -121.0,       -134.0,       -105.0,       -102.0,
+             120.0,        101.0,       -113.0,       -106.0,       -129.0,       -114.0,
+
+   /* 193-240 */
+             113.0,       -102.0,        -94.0,       -100.0,         87.0,        161.0,
+              96.0,        151.0,       -104.0,       -110.0,       -100.0,         92.0,
+              82.0,         82.0,        -78.0,        -77.0,          2.0,         94.0,
+             -93.0,        -83.0,         83.0,        -91.0,        128.0,        -79.0,
+             -83.0,         84.0,         83.0,         91.0,        -77.0,         84.0,
+             -92.0,        -92.0,        -94.0,         68.0,        -61.0,         71.0,
+              62.0,        -63.0,        -73.0,        115.0,       -103.0,         63.0,
+              74.0,       -103.0,        -69.0,         57.0,         94.0,         64.0,
+
+   /* 241-288 */
+             -63.0,        -38.0,        -43.0,        -45.0,         47.0,        -48.0,
+              45.0,         56.0,         88.0,        -75.0,         85.0,         49.0,
+             -74.0,        -39.0,         45.0,         51.0,        -40.0,         41.0,
+             -42.0,        -51.0,        -42.0,         39.0,         46.0,        -53.0,
+              82.0,         81.0,         47.0,         53.0,        -45.0,        -44.0,
+             -33.0,        -61.0,         28.0,        -38.0,        -33.0,        -60.0,
+              48.0,         27.0,         38.0,         31.0,        -29.0,         28.0,
+             -32.0,         45.0,        -44.0,         28.0,        -51.0,        -36.0,
+
+   /* 289-336 */
+              44.0,         26.0,        -60.0,         35.0,        -27.0,         47.0,
+              36.0,        -36.0,        -35.0,        -37.0,         32.0,         35.0,
+              32.0,         65.0,         47.0,         32.0,         37.0,        -30.0,
+             -32.0,        -31.0,         37.0,         31.0,         49.0,         32.0,
+              23.0,        -43.0,         26.0,        -32.0,        -29.0,        -27.0,
+              30.0,        -11.0,        -21.0,        -34.0,        -10.0,        -36.0,
+              -9.0,        -12.0,        -21.0,        -29.0,        -15.0,        -20.0,
+              28.0,         17.0,        -22.0,        -14.0,         24.0,         11.0,
+
+   /* 337-384 */
+              14.0,         24.0,         18.0,        -38.0,        -31.0,        -16.0,
+              29.0,        -18.0,        -10.0,        -17.0,          9.0,         16.0,
+              22.0,         20.0,        -13.0,        -17.0,        -14.0,          0.0,
+              14.0,         19.0,        -34.0,        -20.0,          9.0,        -18.0,
+              13.0,         17.0,        -12.0,         15.0,        -11.0,         13.0,
+             -18.0,        -35.0,          9.0,        -19.0,        -26.0,          8.0,
+             -10.0,         10.0,        -21.0,        -15.0,          9.0,        -29.0,
+             -19.0,         12.0,         22.0,        -10.0,        -20.0,        -20.0,
+
+   /* 385-432 */
+             -17.0,         15.0,          8.0,         14.0,        -12.0,         25.0,
+             -13.0,        -14.0,         13.0,        -17.0,        -12.0,        -10.0,
+              10.0,        -15.0,        -22.0,         28.0,         15.0,         23.0,
+              12.0,         29.0,        -25.0,         22.0,        -18.0,         15.0,
+             -23.0,         12.0,         -8.0,        -19.0,        -10.0,         21.0,
+              23.0,        -16.0,        -19.0,        -22.0,         27.0,         16.0,
+              19.0,          9.0,         -9.0,         -9.0,         -8.0,         18.0,
+              16.0,        -10.0,        -23.0,         16.0,        -12.0,         -8.0,
+
+   /* 433-480 */
+              30.0,         24.0,         10.0,        -16.0,        -16.0,         17.0,
+             -24.0,        -12.0,        -24.0,        -23.0,        -13.0,        -15.0,
+               0.0,          0.0,         -4.0,          0.0,          5.0,          0.0,
+               0.0,         -3.0,          4.0,          0.0,          5.0,          3.0,
+              -3.0,         -5.0,          3.0,          3.0,          3.0,          0.0,
+               0.0,          4.0,          6.0,          5.0,         -7.0,        -12.0,
+               5.0,          3.0,         -5.0,          3.0,         -7.0,          7.0,
+               0.0,          4.0,          3.0,         -3.0,         -7.0,         -4.0,
+
+   /* 481-528 */
+              -3.0,          0.0,         -3.0,          7.0,         -4.0,          4.0,
+              -5.0,          5.0,         -5.0,          5.0,         -8.0,          9.0,
+               6.0,         -5.0,          3.0,         -7.0,         -3.0,          5.0,
+               3.0,         -3.0,          4.0,          3.0,         -5.0,          4.0,
+               9.0,          4.0,          4.0,         -3.0,         -4.0,          9.0,
+              -4.0,         -4.0,          3.0,          8.0,          3.0,         -3.0,
+               3.0,          3.0,         -3.0,          6.0,          3.0,         -3.0,
+              -7.0,          9.0,         -3.0,         -3.0,         -4.0,         -5.0,
+
+   /* 529-576 */
+             -13.0,         -7.0,         10.0,          3.0,         10.0,          0.0,
+               0.0,          0.0,         -7.0,         -4.0,          4.0,          5.0,
+               5.0,         -3.0,         -3.0,         -4.0,         -5.0,          6.0,
+               9.0,          5.0,         -7.0,         -3.0,         -4.0,          7.0,
+              -4.0,          4.0,         -6.0,          0.0,         11.0,          3.0,
+              11.0,         -3.0,         -1.0,          4.0,          0.0,          3.0,
+              -7.0,          5.0,         -3.0,          3.0,          5.0,         -7.0,
+               8.0,         -4.0,         11.0,         -3.0,          3.0,         -4.0,
+
+   /* 577-624 */
+               8.0,          3.0,         11.0,         -6.0,         -4.0,         -8.0,
+              -7.0,         -4.0,          3.0,          6.0,         -6.0,          6.0,
+               6.0,          5.0,         -5.0,         -4.0,         -4.0,          4.0,
+               6.0,         -4.0,          0.0,          0.0,          5.0,        -13.0,
+               3.0,          4.0,          7.0,          4.0,          5.0,         -3.0,
+              -6.0,         -5.0,         -7.0,          5.0,         13.0,         -4.0,
+              -3.0,          5.0,        -11.0,          5.0,          4.0,          4.0,
+              -4.0,          6.0,          3.0,        -12.0,          4.0,         -3.0,
+
+   /* 625-672 */
+              -4.0,          3.0,          3.0,         -3.0,          0.0,         -7.0,
+               6.0,         -3.0,          5.0,          3.0,          3.0,         -3.0,
+              -5.0,         -3.0,         -3.0,         12.0,          3.0,         -4.0,
+               4.0,          6.0,          5.0,          4.0,         -6.0,          4.0,
+               6.0,          6.0,         -6.0,          3.0,          7.0,          4.0,
+              -5.0,          5.0,         -6.0,         -6.0,         -4.0,         10.0,
+              -4.0,          7.0,          7.0,          4.0,         11.0,          5.0,
+              -6.0,          4.0,          3.0,          5.0,         -4.0,         -4.0,
+
+   /* 673-678 */
+              -3.0,          4.0,          3.0,         -3.0,         -3.0,         -3.0
+};
+
+/* Longitude t*sin coefficients */
+static const double spt[NLS] = {
+
+   /* 1-48 */
+      -174666.0,   -1675.0,    -234.0,     207.0,   -3633.0,    1226.0,      73.0,    -367.0,
+          -36.0,    -494.0,     137.0,      11.0,      10.0,      63.0,     -63.0,     -11.0,
+          -42.0,      50.0,      11.0,      -1.0,       0.0,       0.0,      -1.0,       0.0,
+           21.0,       0.0,       0.0,     -25.0,      10.0,      72.0,       0.0,     -10.0,
+           11.0,       0.0,     -85.0,       0.0,       0.0,     -21.0,     -11.0,      21.0,
+          -11.0,      10.0,       0.0,     -11.0,       0.0,     -11.0,     -11.0,       0.0,
+
+   /* 49-96 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 97-144 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,     -11.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 145-192 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 193-240 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 241-288 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 289-336 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 337-384 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 385-432 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 433-480 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 481-528 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 529-576 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 577-624 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 625-672 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+
+   /* 673-678 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0
+};
+
+/* Longitude cos coefficients */
+static const double cp[NLS] = {
+
+   /* 1-45 */
+       33386.0, -13696.0,   2796.0,   -698.0,  11817.0,   -524.0,   -872.0,    380.0,    816.0,
+         111.0,    181.0,     19.0,   -168.0,     27.0,   -189.0,    149.0,    129.0,     31.0,
+        -150.0,    158.0,      0.0,    -18.0,    131.0,     -1.0,     10.0,    -74.0,    -66.0,
+          79.0,     11.0,    -16.0,     13.0,    -37.0,     63.0,     25.0,    -10.0,     44.0,
+         -14.0,    -11.0,     25.0,      8.0,      2.0,      2.0,     -7.0,    -15.0,     21.0,
+
+   /* 46-90 */
+          -3.0,    -21.0,     -8.0,      6.0,    -24.0,      5.0,     -6.0,     -2.0,     15.0,
+         -10.0,      8.0,      5.0,      7.0,      5.0,     11.0,    -10.0,     -7.0,     -2.0,
+           1.0,      5.0,    -13.0,     -6.0,      0.0,   -353.0,     -5.0,      9.0,      0.0,
+           0.0,      8.0,     -2.0,      4.0,      0.0,      5.0,     -3.0,     -1.0,      9.0,
+           2.0,     -6.0,     -3.0,     -1.0,     -1.0,      2.0,      0.0,     -5.0,     -2.0,
+
+   /* 91-135 */
+          -3.0,      1.0,    -25.0,     -4.0,     -3.0,      1.0,      0.0,      5.0,     -1.0,
+          -2.0,      1.0,      0.0,      0.0,      4.0,     -2.0,      3.0,      1.0,     -3.0,
+          -2.0,      1.0,      0.0,     -1.0,      1.0,      2.0,      2.0,      0.0,      1.0,
+           0.0,      2.0,      0.0,      0.0,      0.0,     -2.0,     -2.0,      0.0,     -1.0,
+          -3.0,      1.0,      0.0,     -1.0,     -1.0,      1.0,      1.0,     -1.0,      0.0,
+
+   /* 136-180 */
+          -2.0,     -2.0,     -1.0,     -1.0,      1.0,      2.0,      1.0,      0.0,     -2.0,
+           0.0,      0.0,      2.0,     -1.0,      0.0,      1.0,     -1.0,      1.0,      0.0,
+           1.0,     -2.0,      1.0,      0.0,     -1.0,      2.0,      0.0,      0.0,      1.0,
+          -1.0,      0.0,      0.0,     -1.0,      0.0,      1.0,      1.0,      2.0,      0.0,
+          -4.0,      0.0,      0.0,      0.0,      0.0,      0.0,    -28.0,      0.0,      0.0,
+
+   /* 181-225 */
+          -1.0,     -1.0,      1.0,      1.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      1.0,      0.0,     -1.0,      0.0,      0.0,     -1.0,      0.0,      0.0,
+           0.0,     -1.0,      0.0,      0.0,      1.0,     -5.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,     10.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      1.0,      1.0,      0.0,
+
+   /* 226-270 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,     -3.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+          -3.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,     -1.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 271-315 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 316-360 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 361-405 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 406-450 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,  -1988.0,    -63.0,      0.0,      5.0,      0.0,    364.0,
+
+   /* 451-495 */
+       -1044.0,      0.0,      0.0,    330.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      5.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,    -12.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 496-540 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,     13.0,     30.0,   -162.0,     75.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 541-585 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,     -3.0,     -3.0,      0.0,      0.0,
+           0.0,      0.0,      3.0,      0.0,    -13.0,      6.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 586-630 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,    -26.0,    -10.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,     -5.0,      0.0,
+
+   /* 631-675 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 676-678 */
+           0.0,      0.0,      0.0
+};
+
+/* Obliquity cos coefficients */
+static const double ce[NLS] = {
+
+   /* 1-49 */
+      92052331.0,  5730336.0,   978459.0,  -897492.0,    73871.0,   224386.0,    -6750.0,
+        200728.0,   129025.0,   -95929.0,   -68982.0,   -53311.0,    -1235.0,   -33228.0,
+         31429.0,    25543.0,    26366.0,   -24236.0,    -1220.0,    16452.0,   -13870.0,
+           477.0,    13238.0,   -12338.0,   -10758.0,     -609.0,     -550.0,     8551.0,
+         -8001.0,     6850.0,     -167.0,     6953.0,     6415.0,     5222.0,      168.0,
+          3268.0,      104.0,    -3250.0,     3353.0,     3070.0,     3272.0,    -3045.0,
+         -2768.0,     3041.0,     2695.0,     2719.0,     2720.0,      -51.0,    -2206.0,
+
+   /* 50-98 */
+          -199.0,    -1900.0,      -41.0,     1313.0,     1233.0,      -81.0,     1232.0,
+           -20.0,     1207.0,       40.0,     1129.0,     1266.0,    -1062.0,    -1129.0,
+            -9.0,       35.0,     -107.0,     1073.0,      854.0,     -553.0,     -710.0,
+           647.0,     -700.0,      672.0,      663.0,     -594.0,     -610.0,     -556.0,
+           518.0,     -490.0,     -527.0,      465.0,      496.0,      -50.0,     -399.0,
+          -395.0,     -422.0,     -440.0,     -170.0,      -39.0,     -389.0,      -23.0,
+          -391.0,     -495.0,     -326.0,      369.0,      346.0,      304.0,      294.0,
+
+   /* 99-147 */
+             4.0,      316.0,        8.0,      258.0,     -279.0,      252.0,     -244.0,
+           250.0,       29.0,      275.0,     -228.0,      240.0,     -253.0,      244.0,
+             9.0,      225.0,      207.0,      201.0,      216.0,     -200.0,       14.0,
+            -2.0,      188.0,      205.0,      -19.0,     -176.0,      189.0,     -185.0,
+           -24.0,        5.0,      171.0,       -6.0,      184.0,     -154.0,     -174.0,
+           162.0,      144.0,      -15.0,      -19.0,     -143.0,     -144.0,     -134.0,
+           131.0,     -138.0,     -128.0,      -17.0,      128.0,     -120.0,      109.0,
+
+   /* 148-196 */
+            -8.0,     -108.0,      104.0,     -104.0,     -112.0,     -102.0,      105.0,
+           -14.0,        7.0,       96.0,     -100.0,       94.0,       83.0,       -2.0,
+             6.0,      -79.0,       43.0,        2.0,       84.0,       81.0,       78.0,
+            75.0,       69.0,        1.0,      -54.0,      -75.0,       69.0,      -72.0,
+           -75.0,       69.0,      -54.0,       -4.0,      -64.0,       66.0,      -61.0,
+            60.0,       56.0,       57.0,       56.0,      -52.0,      -54.0,       59.0,
+            61.0,       55.0,       57.0,      -49.0,       44.0,       51.0,       56.0,
+
+   /* 197-245 */
+           -47.0,       -1.0,      -50.0,       -5.0,       44.0,       48.0,       50.0,
+            12.0,      -45.0,      -45.0,       41.0,       43.0,       54.0,      -40.0,
+            40.0,       40.0,      -36.0,       39.0,       -1.0,       34.0,       47.0,
+           -44.0,      -43.0,      -39.0,       39.0,      -43.0,       39.0,       39.0,
+             0.0,      -36.0,       32.0,      -31.0,      -34.0,       33.0,       32.0,
+            -2.0,        2.0,      -28.0,      -32.0,        3.0,       30.0,      -29.0,
+            -4.0,      -33.0,       26.0,       20.0,       24.0,       23.0,      -24.0,
+
+   /* 246-294 */
+            25.0,      -26.0,      -25.0,        2.0,        0.0,        0.0,      -26.0,
+            -1.0,       21.0,      -20.0,      -22.0,       21.0,      -21.0,       24.0,
+            22.0,       22.0,      -21.0,      -18.0,       22.0,       -4.0,       -4.0,
+           -19.0,      -23.0,       22.0,       -2.0,       16.0,        1.0,      -15.0,
+            19.0,       21.0,        0.0,      -10.0,      -14.0,      -20.0,      -13.0,
+            15.0,      -15.0,       15.0,       -8.0,       19.0,      -15.0,        0.0,
+            20.0,      -19.0,      -14.0,        2.0,      -18.0,       11.0,       -1.0,
+
+   /* 295-343 */
+           -15.0,       20.0,       19.0,       19.0,      -16.0,      -14.0,      -13.0,
+            -2.0,       -1.0,      -16.0,      -16.0,       15.0,       16.0,       13.0,
+           -16.0,      -13.0,       -2.0,      -13.0,      -12.0,       18.0,      -11.0,
+            14.0,       14.0,       12.0,        0.0,        5.0,       10.0,       15.0,
+             6.0,        0.0,        4.0,        5.0,        5.0,       -1.0,        3.0,
+             0.0,        0.0,        0.0,       12.0,        7.0,      -11.0,       -6.0,
+            -6.0,        0.0,       -8.0,        0.0,        0.0,        8.0,        0.0,
+
+   /* 344-392 */
+            10.0,        5.0,       10.0,       -4.0,       -6.0,      -12.0,        0.0,
+             6.0,        9.0,        8.0,       -7.0,        0.0,      -10.0,        0.0,
+             8.0,       -5.0,        7.0,       -6.0,        0.0,        5.0,       -8.0,
+             3.0,       -5.0,        0.0,        0.0,       -4.0,       10.0,       11.0,
+            -4.0,        4.0,       -6.0,        9.0,        0.0,       -5.0,        0.0,
+            10.0,       -5.0,       -9.0,        5.0,       11.0,        0.0,        7.0,
+            -3.0,       -4.0,        0.0,        6.0,        0.0,        6.0,        8.0,
+
+   /* 393-441 */
+            -5.0,        9.0,        6.0,        5.0,       -6.0,        0.0,        0.0,
+            -1.0,       -7.0,      -10.0,       -5.0,       -1.0,        1.0,        0.0,
+             0.0,        3.0,        0.0,       -5.0,        4.0,        0.0,        4.0,
+            -9.0,       -1.0,        8.0,        9.0,       10.0,       -1.0,       -8.0,
+            -8.0,       -4.0,        4.0,        4.0,        4.0,       -9.0,       -1.0,
+             4.0,        9.0,       -1.0,        6.0,        4.0,       -2.0,      -10.0,
+            -4.0,        7.0,        7.0,       -7.0,       10.0,        5.0,       11.0,
+
+   /* 442-490 */
+             9.0,        5.0,        7.0,        0.0,        0.0,        0.0,        0.0,
+            -3.0,        0.0,        0.0,        1.0,       -2.0,        0.0,       -2.0,
+            -2.0,        1.0,        2.0,       -1.0,        0.0,        0.0,        0.0,
+             1.0,       -2.0,        0.0,       -2.0,        0.0,        0.0,       -3.0,
+            -1.0,        0.0,        0.0,        3.0,       -4.0,        0.0,       -2.0,
+            -2.0,        2.0,        3.0,        2.0,        1.0,        0.0,        1.0,
+            -3.0,        2.0,       -2.0,        3.0,        0.0,        2.0,       -2.0,
+
+   /* 491-539 */
+             3.0,        0.0,       -3.0,        2.0,        0.0,        0.0,        1.0,
+             0.0,        0.0,        2.0,       -2.0,       -1.0,        2.0,       -2.0,
+            -3.0,        0.0,       -2.0,        2.0,        2.0,       -3.0,        0.0,
+             0.0,       -2.0,        0.0,        0.0,        2.0,       -1.0,       -1.0,
+             1.0,       -3.0,        0.0,        1.0,        0.0,        0.0,        2.0,
+             0.0,        0.0,        3.0,        0.0,        0.0,        0.0,       -1.0,
+             6.0,        0.0,        0.0,        0.0,        4.0,        2.0,       -2.0,
+
+   /* 540-588 */
+            -2.0,       -3.0,        0.0,        2.0,        2.0,        2.0,        0.0,
+             0.0,        0.0,        0.0,        1.0,        2.0,        0.0,        0.0,
+             0.0,        3.0,        0.0,        0.0,       -1.0,        0.0,        2.0,
+             3.0,       -2.0,        0.0,        0.0,        0.0,       -3.0,        1.0,
+             0.0,       -3.0,        3.0,       -3.0,        2.0,        0.0,        1.0,
+            -1.0,        2.0,       -4.0,       -1.0,        0.0,        3.0,        2.0,
+             4.0,        3.0,        2.0,       -1.0,       -3.0,        3.0,        0.0,
+
+   /* 589-637 */
+            -1.0,       -2.0,        2.0,        0.0,        2.0,        0.0,       -3.0,
+             2.0,        0.0,        0.0,       -3.0,        0.0,       -2.0,       -2.0,
+            -3.0,        0.0,        0.0,        2.0,        2.0,        2.0,        3.0,
+            -2.0,        0.0,        2.0,        0.0,       -2.0,        0.0,       -2.0,
+             0.0,       -2.0,        2.0,       -3.0,       -2.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,       -1.0,        1.0,        0.0,        4.0,
+            -3.0,        0.0,       -3.0,       -1.0,        0.0,        1.0,        3.0,
+
+   /* 638-678 */
+             2.0,        2.0,        0.0,       -1.0,        2.0,        0.0,        0.0,
+            -3.0,       -2.0,        3.0,       -2.0,       -3.0,        0.0,        3.0,
+            -2.0,       -4.0,       -2.0,        2.0,        0.0,        3.0,        3.0,
+             2.0,        0.0,        2.0,        0.0,       -3.0,        0.0,        0.0,
+            -2.0,        2.0,       -2.0,       -2.0,       -2.0,        2.0,        2.0,
+             2.0,       -2.0,       -1.0,        1.0,        1.0,        2.0
+};
+
+/* Obliquity t*cos coefficients */
+static const double cet[NLS] = {
+
+   /* 1-50 */
+       9086.0, -3015.0,  -485.0,   470.0,  -184.0,  -677.0,     0.0,    18.0,   -63.0,   299.0,
+         -9.0,    32.0,     0.0,     0.0,     0.0,   -11.0,     0.0,   -10.0,     0.0,   -11.0,
+          0.0,     0.0,   -11.0,    10.0,     0.0,     0.0,     0.0,    -2.0,     0.0,   -42.0,
+          0.0,     0.0,     0.0,     0.0,    -1.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 51-100 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 101-150 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 151-200 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 201-250 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 251-300 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 301-350 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 351-400 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 401-450 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 451-500 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 501-550 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 551-600 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 601-650 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 651-678 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* Obliquity sin coefficients */
+static const double se[NLS] = {
+
+   /* 1-50 */
+      15377.0, -4587.0,  1374.0,  -291.0, -1924.0,  -174.0,   358.0,   318.0,   367.0,   132.0,
+         39.0,    -4.0,    82.0,    -9.0,   -75.0,    66.0,    78.0,    20.0,    29.0,    68.0,
+          0.0,   -25.0,    59.0,    -3.0,    -3.0,    13.0,    11.0,   -45.0,    -1.0,    -5.0,
+         13.0,   -14.0,    26.0,    15.0,    10.0,    19.0,     2.0,    -5.0,    14.0,     4.0,
+          4.0,    -1.0,    -4.0,    -5.0,    12.0,    -3.0,    -9.0,     4.0,     1.0,     2.0,
+
+   /* 51-100 */
+          1.0,     3.0,    -1.0,     7.0,     2.0,     4.0,    -2.0,     3.0,    -2.0,     5.0,
+         -4.0,    -3.0,    -2.0,     0.0,    -2.0,     1.0,    -2.0,     0.0,  -139.0,    -2.0,
+          4.0,     0.0,     0.0,     4.0,    -2.0,     2.0,     0.0,     2.0,    -1.0,    -1.0,
+          4.0,     1.0,     0.0,    -1.0,    -1.0,    -1.0,     1.0,     1.0,     0.0,    -1.0,
+          1.0,     0.0,   -10.0,     2.0,    -1.0,     1.0,     0.0,     2.0,    -1.0,    -1.0,
+
+   /* 101-150 */
+         -1.0,     0.0,     0.0,     2.0,    -1.0,     2.0,     0.0,    -1.0,    -1.0,     1.0,
+          0.0,    -1.0,     0.0,     1.0,     1.0,     0.0,     1.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,    -1.0,     0.0,    -1.0,     0.0,     0.0,     0.0,     0.0,
+         -1.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -1.0,     0.0,     0.0,
+          1.0,     0.0,     0.0,     0.0,     0.0,     0.0,     1.0,     0.0,     0.0,     0.0,
+
+   /* 151-200 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     1.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     1.0,
+          0.0,    -2.0,     0.0,     0.0,     0.0,     0.0,     0.0,    11.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     1.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 201-250 */
+          0.0,     0.0,     0.0,    -2.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,    -2.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,    -1.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 251-300 */
+          0.0,     0.0,    -1.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 301-350 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+         -2.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 351-400 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 401-450 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0, -1679.0,   -27.0,     0.0,     4.0,     0.0,   176.0,
+
+   /* 451-500 */
+       -891.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,   -10.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 501-550 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,    -5.0,    14.0,  -138.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 551-600 */
+          0.0,     0.0,     0.0,     0.0,     1.0,    -2.0,     0.0,     0.0,     0.0,     0.0,
+         -1.0,     0.0,   -11.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,   -11.0,    -5.0,     0.0,     0.0,
+
+   /* 601-650 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -2.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 651-678 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* dpsi = sum0 + sum1*t, deps = sum2 + sum3*t (0.1 microarcsec) */
+static const ascomSERIES LS = {
+   NLS, 5, &mls[0][0], 6, NULL, NULL, 4,
+   { { 0, NLS, sp, cp },
+     { 0, NLS, spt, NULL },
+     { 0, NLS, se, ce },
+     { 0, NLS, NULL, cet } }
+};
+
+/* ------------------------ */
+/* Planetary nutation model */
+/* ------------------------ */
+
+/* Number of terms */
+#define NPL 687
+
+/* Multipliers of l, F, D, Om, the planetary longitudes Me to Ne, and pA */
+static const signed char mpl[13][NPL] = {
+
+   /* l */
+   {    0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  0,  1,
+        0, -2,  0,  0, -2, -1, -2, -1, -1,  0,  0,  0,  0,  0,  0,  0, -2, -2, -2,  0, -2,  0,  0,  0, -1,
+       -1, -2, -2,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  1,  0, -2,  0,  0,  0,  0,  0,  0, -2,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2, -2,  2,  2, -2, -2, -2, -2, -2, -1, -1,  1,  0,  0,
+        0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  1,  1,  0,  0,  0,  0, -2, -2,
+        0,  0,  0, -1, -1,  0,  0, -2,  0,  0,  0,  1,  0, -1,  0,  0,  0,  2, -2,  0, -2,  1, -2,  0,  0,
+        0,  0,  0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -2, -2,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0, -2,  0,  0,  0,  0, -2,  0,  0,  2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,
+       -1, -1, -1,  1, -2, -1, -1, -1, -1,  1, -1, -2,  1, -1,  1, -1, -1,  0, -1, -1,  1,  1,  1,  1,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  0,  1,  0,  0, -1,  2,  1,  0, -1, -2,  0,  0,  0,  0, -1,
+        1, -1,  2,  1,  1,  1,  0,  2, -1, -1,  1,  0 },
+
+   /* F */
+   {    0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0, -1,  0,  1,  0,
+        1,  0,  0, -1,  0,  0,  1,  1,  0,  0,  2,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0, -1,  0,  1,  1,
+        0,  0,  2,  1,  0,  1,  0,  0,  0, -1,  1,  0,  0,  1,  0,  0,  1,  0, -2,  1,  0, -1, -2, -1,  0,
+        1,  0, -1,  1,  0,  0,  0,  0,  1,  0, -1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  1,  0,  0,  2,
+       -1,  0,  1,  1,  0, -2,  0,  1,  0,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, -1, -2,  0,  0,  0,
+        0, -1,  2,  0,  0,  1,  0,  1,  1,  0,  0,  0,  2,  0,  0,  0, -1, -1,  0,  0,  0,  0,  1,  1,  0,
+        0,  1,  0,  1,  0,  0,  0,  1,  1,  0,  0,  1,  0,  1,  0,  2, -1,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  1,  0,  0,  1,  0, -1,  0,  0,  0,  2,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  1,
+        0, -1, -1,  2,  1,  0,  0,  1,  0,  0,  2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  2,  0,  0,  1,  0,
+        0,  1,  0, -1,  2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  2,  0,  0, -1,  2,  0,  2,
+        1,  0,  0,  1,  0,  0, -1,  0,  0,  0,  0, -1,  2,  1, -2,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,
+        0,  0,  0, -2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0, -2,  0,  2,
+       -1,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  0,
+        0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,
+        0,  0,  2,  2,  2,  2,  0,  1,  2,  2,  1,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  2,  2,  2,
+        2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  2,  2 },
+
+   /* D */
+   {    0,  0,  0,  0,  0,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0, -1,  0, -1,  0,  0, -1, -2, -1, -1,
+       -1,  2,  0,  1,  2,  0,  1, -1,  1,  0, -2,  0, -1,  0, -1,  0,  2,  2,  2,  0,  2,  1,  0, -1,  0,
+        1,  2,  0, -1,  0, -1,  0,  0,  1,  1, -1,  0,  0, -1,  0, -2, -1,  2,  2, -1,  0,  1,  2,  1,  2,
+       -3,  0,  1, -1,  0,  0,  0,  0, -1,  0, -1, -2,  2, -2, -2,  1,  1,  2,  2,  2,  1,  1, -2,  0, -2,
+        1,  0, -1, -1, -2,  2,  0, -1,  0, -1,  0,  0, -2,  0,  2,  0,  0, -1, -1,  0,  1,  2,  0,  2,  2,
+        0,  1, -2,  1,  0, -1,  0,  1, -1,  0,  0,  0, -2,  0,  0,  0,  1, -1,  2,  0,  2,  0,  1, -1,  0,
+        0, -1,  0, -1,  0,  1,  1, -1, -1,  0,  0, -1,  0, -1,  0, -2,  1,  0,  2,  0,  2,  2, -1,  0, -1,
+        0,  0,  0, -1,  0,  0, -1,  0,  1,  0,  0, -2, -2, -2,  2,  0, -1,  0,  0,  2,  0,  0, -2, -1, -1,
+        0,  1,  1, -2, -1,  0,  0, -1,  0,  0, -2,  0,  0, -1,  0,  0, -1,  0,  0,  0, -2,  0,  0, -1,  0,
+        0, -1,  0,  1, -2,  0,  0,  0,  0, -2,  2, -2,  0,  0,  0, -1,  0,  0, -2,  0,  0,  1, -2,  0, -2,
+       -1,  0,  0, -1,  0,  0,  1,  0,  0,  0,  0,  1, -2,  1,  2,  0,  0,  0,  0, -1,  0,  0,  0, -1,  0,
+        0,  0,  0,  2,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  2,  0, -2,
+        1,  0,  0, -1,  0,  0,  0, -1,  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0, -1,  0,
+        0,  0,  0,  0,  0, -2,  0,  2,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -1, -2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2, -2, -2,
+        0,  0,  2, -2,  2,  0,  0,  0,  2,  1,  2,  0,  0, -1, -1,  0,  2,  0,  2,  2, -2, -2, -2,  0,  0,
+       -2, -2,  0,  0,  0,  0,  2,  1,  0,  0,  1,  0,  0,  0,  0, -2,  0,  1,  0,  2,  0,  0,  0,  0,  2,
+        0,  2,  0,  0,  0,  1,  0,  0,  2,  2,  0,  2 },
+
+   /* Om */
+   {    0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  1,  1,
+        1,  1,  0,  0,  1,  0,  2,  1,  1,  0,  2,  0,  1,  0,  1,  0,  1,  2,  0,  1,  0,  0,  1,  2,  1,
+        0,  0,  2,  1,  0,  1,  0,  0,  0,  0,  2,  1,  2,  1,  0,  0,  1,  1,  0,  2,  1,  0,  0,  1,  0,
+        1,  2,  1,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  1,
+        0,  1,  2,  1,  1,  1,  0,  1,  0,  1,  0,  0,  1,  1,  0,  0,  0,  1,  1,  2,  1,  0,  0,  1,  1,
+        1,  0,  1,  0,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,  1,  0,  1,  1,  2,  1,
+        0,  1,  0,  1,  0,  1,  1,  1,  1,  0,  0,  0,  1,  2,  1,  1,  0,  1,  1,  1,  1,  1,  1,  0,  1,
+        0,  0,  0,  1,  0,  0,  2,  1,  0,  0,  0,  1,  1,  1,  0,  0,  1,  0,  0,  0,  2,  2,  1,  2,  2,
+        1,  0,  0,  1,  1,  0,  0,  1,  0,  0,  2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  2,  0,  0,  1,  0,
+        0,  2,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,  0,  0,  2,  0,  1,  0,  1,  1,  1,
+        2,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  0,
+        0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  0,  0,  1,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  1,  2,  2,  0,  0,
+        0,  0,  2,  2,  2,  2,  0,  2,  2,  2,  1,  2,  2,  2,  2,  2,  1,  0,  1,  2,  2,  2,  2,  2,  2,
+        2,  2,  2,  2,  2,  1,  2,  1,  2,  2,  2,  2 },
+
+   /* Me */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ve */
+   {    0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,
+        0,  0,  3,  0,  0, 18,  0, 18,  0, -8, -8, -8, -8,  8,  8,  8,  0,  3,  0,  3,  0,  0,  0,  0,  3,
+        3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0, 17,  0,  0,  0,  0,  0,  0,  5,  5,  6,
+       -6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,-20, 20,  0,  0,
+        0,  0,  0,  0, -6,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  3,  0,  3,
+        8,  8, -8,  0, 18,  0,  3,  0,  0,  0,  0,-10,  0, 10,  0,  0,  0,  0,  0, -3,  0,-18,  0, -8, -8,
+        0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  3, -3, -3,  0, -5,  5,  5,  6,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  3,  3,  3, -3, -3, -3, -3, -3,  0,  0,  0,  0,  0,  0,  0, -5, -5, -5, -5, -5, -5,
+        5,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3, -3,  0,  0,
+       -5,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  3, -6, -6, -2, -2, -2,  2,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0,  0, -1,  0,  0,  0,  0,  1,  1,  1, -1, -1, -7, -7,  4,  0, -4,
+        4,  0, -4, -4, -4, -4, -4, -4, -4,  4,  2,  0,  1,  1,  0,  0,  0,  0, -1, -1, -1,  1,  1,  1,  0,
+        0,  0, -1,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  2, -2, -2, -2, -6, -6,  6,  0, -2,  0,  0,  3,
+        0,  0,  0, -5,  0, -3, -3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0, -8,  0,
+        0,  0,  0,  0,  0,  0,  0, -8, -8,  0,  0,  0,  0,  0, -5,  0,  0,  0,  3, -3, -3,  0, -5, -5, -5,
+        5,  0,  0,  0,  0,  0,  2,  0,  0, -2, -2,  2,  2,  0,  0,  0, -2,  0,  1, -1, -1, -1, -7, -7,  0,
+       -4, -4, -4,  4,  0,  0,  0,  1,  1, -9,  0,  0,  0,  0,  0, -2, -2, -6, -6,  6,  0,  0,  0,  0,  0,
+        0,  0, -5,  0,  0, -3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8, -3,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, -8, -8, -8,  0,  0,  3,  0,  0,  0,  0,  0, -3,  0, -5,
+       -5,  5,  5,  0,  0,  0,  2,  2,  0,  0, -1, -1, -7, -7,  0,  0, -4,  4,  4,  4,  0,  0,  1,  1,  1,
+       -9,  0,  1,  0,  0,  0, -2, -6,  6,  0,  0,  0,  0,  3,  3,  0,  0,  0,  0,  0,  0, -8,  0,  0,  0,
+        0,  0, -8, -8, -8,  0,  0, -3, -5,  5,  5,  5,  2,  2,  2,  0,  0,  0,  7,  0,  4,  1, -9, -9,  0,
+        0, -6,  6,  6,  0,  0,  3,  3,  3,  0,  0,  0,  0,  8,  5,  2,  2,  2, -7,  7,  4,  4,  4,  4,  0,
+        0,  0,  3, -8,  8,  5,  5, -9, -9, -9,  9,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  1,
+        3,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0, -3,  0,  1,  0,
+        2,  0, -2,  0, -1, -2,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  0,  2,  0,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  3,  1,  0 },
+
+   /* E */
+   {    8, -8,  8,  0, -4,  4,  3, -3,  0,  4, -5, -4,  4,  6,  0,  0, -1,  0, -1,  0,  0,  3,-21, -4, -1,
+       -1,  2, -7,  1,  2,-16,  1,-17,  2, 13, 11, 13, 12,-13,-14,-13,  2, -3,  2, -5,  2,  0, -1, -2, -5,
+       -4,  2, -5, -1,  0, -1,  0,  0,  3,  1, -1, -9,  5, -1,  0,-16, -1,  5,  9, -1,  0,  1, -6, -7, -8,
+        7,  0,  1, -1,  0,  0, -8, -8, -9,  8,  8, -5,  2, -6, -2,  1,  1,  2,  6,  2,  1, 20,-21,  8,-10,
+        1,  0, -1, -1,  8, -6,  0, -1,  0, -1,  0,  0, -9,  7,  5,  9, -9, -3,  4, -1,  0, -2, -5,  2, -3,
+      -13,-12, 11,  2,-16, -1, -7, -3, -1,  0, -4,  3, -2, -3,  4,  0,  1,  3,  2,  7,  2, 16,  1, 12, 13,
+        1,  0,  1, -2, -1, -4,  3, -1, -1,  0,  0, -6,  5,  4, -2,  6, -7, -8, -8, -8,  2,  6, -1,  0, -1,
+        0,  0,  0, -1,  0,  0, -1,  0,  1, -7,  7, -5, -8,  2,  4,  0, -1,  0,  0, -3, -4,  4, -2, -1,  0,
+        1,  2,  1, -2, -6, -5, -5,  4,  5,  5,  3,  5,  2,  1,  2, -2, -3, -2, -2,  8,  6,  8,  8,  7,  8,
+       -8, -1,  0,  1, -2, -6,  6,  4, -4,  3,  2, -7,  0,  0,  0, -1,  0,  0, -2,  0, -5, -4,  3,  2, -4,
+        7,  3, -3, -4, -3, -3, -2, -3, -5, -5,  5,  1, -2,  1, -3, 10, 10,  3,  3,  2, -3, -3,  0, -1,  0,
+        0,  4, -4,  2, -4, -4,  4,  3, -2, -5,  2,  0, -3, -3,  3, -2, -3, -2,  2,  2, 11, 11, -4,  2,  4,
+       -5,  1,  7,  6,  7,  6,  6,  5,  6, -6, -2,  0,  0, -1, -1,  1, -1, -7,  1,  1,  0, -1, -1, -2, -2,
+       -1,  1,  1, -6, -6, -3, -3, -4, -5,  5, -1, -1,  1, -4,  4,  3,  4,  9,  9, -9,  1,  2, -4,  4, -4,
+       -1,  1,  1,  9,  3,  4,  4, -4, -4,  2, -1,  1,  1, -1,  1,  1,  1,  4,  1,  2,  1, -1, -2, 14,  1,
+        5,  5, -1,  1,  3, -3,  1, 12, 12,  1,  1,  0,  0,  1,  5,  1,  1,  1, -6,  6,  6, -1,  7,  7,  6,
+       -7, -1, -1,  3,  1, -2, -2, -6,  6,  2,  1, -2, -2,  1, -5,  5,  2,  4, -3,  3,  2,  3, 10, 10,  3,
+        8,  5,  5, -5,  1, -2,  0,  0,  0, 13, -1, -2,  2, -2,  2,  5,  5,  8,  8, -8,  2, -3,  5,  5,  2,
+        2,  2, 10,  4,  4,  3, -3, -3, -3,  2, -5,  2,  2,  2,  2,  3,  3,  2, -6, 15,  9,  2, -2,  6,  2,
+        2,  2,  1,  2,  2, -6, -2, -2,  6,  2, -5, 11, 11, 11, 11,  2, -3,  4,  1, -4,  1,  2,  7,  0,  6,
+        6, -6, -6,  2, -1,  7, -1, -1,  6,  5,  4,  4,  9,  9,  4,  3,  4, -4, -4, -4,  2, -3,  1,  1,  1,
+       12,  3, -1,  7,  3,  3,  6,  7, -7,  6,  3,  3,  5, -2, -2,  3,  3,  3,  4,  3,  1, 16,  3,  7, -5,
+        3, -1, 10, 10, 10,  2,  3,  8,  5, -5, -5, -5,  0,  0,  0,  7,  7,  6, -8,  5, -3,  2, 11, 11,  4,
+        4,  6, -6, -6,  4,  6, -1, -1, -1,  4,  4,  5,  4, -9, -4,  1,  1,  1,  7, -7, -2, -2, -2, -2,  5,
+        5,  5,  0,  8, -8, -3, -3,  9,  9,  9, -9, -4,  6,  6,  6,  6,  6,  6,  6,  6,  0,  2, -2,  1, -1,
+       -3,  2,  4,  4,  4,  2,  1, -1, -2,  1,  2,  2,  4, -1, -1,  4,  2,  2,  2, -3, -2,  3, -2, -1,  1,
+       -2,  1,  2, -1,  1,  3,  2,  1,  1, -3,  1,  1,  4, -4, -4, -2, -2,  1,  1,  2, -3, -1,  1, -2, -1,
+        1,  2,  2, -4,  4,  1,  1,  1,  2, -3, -1,  2 },
+
+   /* Ma */
+   {  -16, 16,-16,  0,  8, -8, -8,  0,  0, -8,  8,  8, -8,  4,  0,  0,  0,  0,  0,  0,  0, -7,  3,  0,  0,
+        0,  0,  4,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,
+        0,  0,  9,  0,  0,  0,  0,  0, -4,  0,  0, 17,  0,  0,  0,  0,  0, -6,-13,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, 15, 15, 15,-15,-15,  0,  0,  8,  0,  0,  0,  0, -8,  0,  0,  0,  0,-15, 15,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,-13, -6,-17, 17,  4,  0,  2,  2,  0,  0,  0,  0,
+        0,  0,  0, -2,  0,  0,  4,  7,  0,  0,  8,  0,  0,  0, -8,  0,  0, -7,  0, -4,  0,  0,  0,  0,  0,
+       -2, -2, -2,  2,  2,  0, -4,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0, 15,  0, -8,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, 13,-13,  6, 11,  0, -4,  0,  0,  0,  0,  0,  8, -8,  0,  0, -2,
+       -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4, -4, -4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, 11,-11,  0,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  4,
+        0, -6,  6,  6,  6,  6,  0,  0,  9,  9, -9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -8,  8,  0,  7,  7, -7,  0,  0, 10,  0,  0,  5,  5, -5,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,
+        0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, -3,  3, 12,  0,  0,  0,  0,  0,  0,  5,
+        0,  0,  0, 10, 10,  0,  7,  0,  8, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6, -6,  0,
+        0,  0,  0,  0, -4,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  2,  0,  0,
+       -8, -8,  0,  0, -8,  8,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+        0,  0,  0,  0,  0,  6,  0,  9, -9,  0,  0,  0,  0,  0,  7, -7,  0, -5,  0,  0,  0,  0,  0,  0, -3,
+        0,  0,  0,  0,  1,  0,  3,  0,  0,  0,  5,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  9, -6, -6,  0,
+        0,  0,  0, -4, -4,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0, -2, -2,  0, 15,  0, -4,  0,  8, -8,  0,
+        0,  0,  0,  0,  0, 16,  8,  8, -8,  0,  4,  0,  0,  0,  0,  0,  0, -8,  0,  8,  2,  0,  0,  4,  0,
+        0,  0,  0,  0,  6, -9,  0,  0, -7, -5,  0,  0,  0,  0, -3, -1,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0, -8,  0,  0,  0,  0,  0, -6,  0,  0, -4,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0, -8, 16,
+        0,  8,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -7, -7, -5,  0, -3,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -8, -8, -8,  0,  0,  0,  0,  0,  0,  0, -8,  0,  0, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  8, -8,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ju */
+   {    4, -4,  4,  0, -1,  3,  3,  0, -2,  3, -3, -3,  1,  0,  2,  2,  2,  2, -2, -2, -2,  0,  0, -3,  2,
+       -4,  0,  0,  1, -2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0, -3,  2, -4,  0,  0,  0,  0,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  1, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  3, -3, -3, -3,  0, -1, -1,  0,  0,  0,  0,
+        1,  1,  1, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -3,  0,
+        0,  0,  0,  0,  0, -1,  0,  0, -2, -2, -3,  0,  0,  0,  3,  2,  2,  0,  0,  0, -2,  0, -2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  1,  3, -1,
+       -1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0, -3,  3,  2,  2,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -1, -1, -1,  1,  0,  0,  0,  0,  0,  0,  0,  4,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,
+        3,  0,  0, -2,  0,  0,  0,  0,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        4, -4,  0,  0,  0,  3,  0,  0,  0,  0,  3,  3, -3,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,
+        2, -2, -1,  0,  0,  0,  0,  0,  0,  0,  2,  0,  1,  1, -1, -1, -3,  0,  0,  0,  0,  1,  0,  0,  2,
+        3,  3,  0,  0,  3, -3, -2,  0,  0,  1,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  4, -4,  0, -3,  0,  0,  0,  0,  0, -2,  0,  0,  0, -2,
+       -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  2, -1,  3,  0,
+        0,  0,  0,  0,  0, -4, -3, -3,  1, -2,  0,  0,  0,  0,  0,  0,  2,  3,  0, -3,  0,  1,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+        0, -4,  0,  0, -3, -3,  0,  0,  0,  0, -2, -2,  0,  0,  0, -1, -1,  0,  0,  0, -1,  0,  2,  3, -4,
+        0, -3,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,
+       -3,  0,  0,  0, -2,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,
+       -3, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -1,  0,
+        0, -2,  3,  3,  3, -3, -1,  0,  0,  0, -3, -3,  3,  0,  0,  3, -2, -2, -2,  0,  2,  0,  2,  0, -1,
+        0, -1,  0,  1,  0,  0, -2,  0,  0,  0,  0,  0,  3, -3, -3,  3,  3,  0,  0, -2,  0,  0, -1,  0,  1,
+        0, -3, -3, -3,  3,  0,  0,  0, -2,  0,  0, -2 },
+
+   /* Sa */
+   {    5, -5,  5,  0, -5,  0,  0,  0,  6,  0,  0,  0,  5,  0, -5, -5, -5, -5,  5,  5,  5,  0,  0,  0,  0,
+       10, -5,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  1,  0,  3,  0,  0,  0,  0,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  2, -2,  0, -3,  0,  0,  1,  1,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0,
+        0,  0,  0,  4,  0,  0, -1, -1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  5,  5,  0,  0,  0,  0,  0, -5, -5,  0, -5,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,
+        0,  0,  0,  0,  0,  0, -1, -1, -1,  0,  0,  0,  0,  0,  0, -2,  3,  3,  3,  0,  0,  0,  0,  0,  0,
+        0,  0, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -5,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -5,  0,  0,  0,  5,  0, -2,  0, -1,  0,  0,  0, -5,
+        0,  0,  0,  0,  0,  0,  5,  0,  0, -2,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0, -2, -2,  0,  0, -1,  0,  0,  0, -5, -5,  0,  0,
+        0,  0,  0,  0,  0, -5,  0,  0,  5,  5,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -1,  0,  0, -5,  0, -5,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ur */
+   {    0,  0,  0, -1,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ne */
+   {    0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* pA */
+   {    0,  2,  2,  2,  2,  1,  0,  0,  2,  0,  0,  1,  2,  2,  2,  1,  0,  0,  0,  1,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  1,  0,  1,  2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  1,  2,  0,  2,  1,  0,  0,  1,  0,  1,  2,  2,  0,  2,  1,  0,  1,
+        0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,  0,  2,  0,  1,  0,  1,  2,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  1,  2,  0,  0,  2,  1,  0,  0,  0,  0,  0,  1,  2,  2,  1,  0,  0,  1,  1,  0,  1,
+        2,  0,  2,  0,  2,  1,  0,  0,  0,  2,  0,  2,  2,  1,  0,  1,  0,  0,  1,  2,  2,  1,  0,  0,  0,
+        0,  0,  1,  0,  2,  2,  1,  0,  1,  0,  0,  0,  0,  0,  2,  0,  2,  2,  2,  1,  0,  0,  1,  0,  2,
+        2,  0,  0,  2,  0,  0,  2,  0,  2,  0,  2,  1,  0,  0,  1,  0,  2,  2,  1,  0,  0,  0,  2,  0,  0,
+        2,  0,  0,  2,  0,  2,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+        0,  2,  1,  0,  0,  2,  2,  2,  0,  0,  2,  0,  2,  2,  0,  0,  1,  2,  0,  1,  2,  2,  2,  1,  0,
+        0,  0,  0,  2,  2,  2,  0,  2,  0,  1,  0,  0,  1,  2,  2,  0,  0,  0,  0,  1,  0,  2,  2,  1,  0,
+        2,  2,  1,  0,  2,  2,  2,  0,  2,  2,  2,  2,  0,  2,  0,  1,  2,  2,  1,  0,  0,  2,  0,  2,  0,
+        1,  2,  2,  0,  2,  1,  0,  1,  2,  0,  2,  0,  2,  0,  1,  0,  2,  2,  2,  2,  2,  2,  2,  2,  0,
+        0,  1,  0,  1,  2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  0,  0,  0,  2,  2,  2,  2,  2,
+        1,  0,  2,  2,  2,  2,  0,  2,  2,  2,  1,  2,  2,  1,  2,  2,  1,  0,  1,  2,  2,  2,  0,  1,  2,
+        2,  0,  0,  2,  0,  2,  2,  1,  0,  2,  0,  2,  2,  0,  2,  2,  2,  2,  2,  2,  0,  2,  2,  2,  2,
+        2,  2,  2,  1,  2,  2,  2,  2,  1,  0,  1,  2,  0,  1,  2,  2,  2,  2,  0,  2,  2,  2,  2,  1,  2,
+        2,  1,  0,  1,  2,  2,  0,  1,  2,  2,  2,  2,  0,  0,  2,  2,  1,  1,  1,  0,  1,  2,  0,  0,  2,
+        2,  2,  2,  1,  0,  1,  2,  1,  1,  1,  0,  1,  2,  0,  0,  1,  2,  0,  1,  2,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+};
+
+/* Longitude sin coefficients */
+static const double psp[NPL] = {
+
+   /* 1-50 */
+       1440.0,    56.0,   125.0,     0.0,     3.0,     3.0,  -114.0,  -219.0,    -3.0,  -462.0,
+         99.0,    -3.0,     0.0,     3.0,   -12.0,    14.0,    31.0,  -491.0, -3084.0, -1444.0,
+         11.0,    26.0,   103.0,     0.0,   -26.0,     9.0,    12.0,    -7.0,     0.0,   284.0,
+        226.0,     0.0,     0.0,     5.0,   -41.0,     0.0,   425.0,  1200.0,   235.0,    11.0,
+          5.0,    -5.0,     6.0,    15.0,    13.0,    -6.0,   266.0,  -460.0,     0.0,    -3.0,
+
+   /* 51-100 */
+          0.0,     4.0,     0.0,     0.0,     0.0,   -17.0,    -9.0,    -6.0,   -16.0,     0.0,
+         11.0,    -3.0,     3.0,     0.0,     0.0,     0.0,     0.0,    -6.0,    -3.0,    -5.0,
+          4.0,   -42.0,   -10.0,    -3.0,    78.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+         -7.0,   -14.0,     0.0,     0.0,    45.0,    -3.0,     0.0,     0.0,     3.0,    89.0,
+          0.0,    -3.0,  -349.0,   -15.0,    -3.0,   -53.0,     5.0,     0.0,    15.0,    -3.0,
+
+   /* 101-150 */
+        -21.0,    20.0,     0.0,     5.0,   -17.0,     0.0,    32.0,   174.0,    11.0,   -66.0,
+         47.0,     0.0,    10.0,    -3.0,   -24.0,     5.0,     3.0,     4.0,     0.0,    -5.0,
+          8.0,     0.0,    10.0,     3.0,    -5.0,    46.0,   -14.0,     0.0,    -5.0,   -68.0,
+          0.0,    10.0,    -5.0,    -3.0,    76.0,    84.0,     3.0,    -3.0,    -3.0,   -82.0,
+        -73.0,    -9.0,     3.0,    -3.0,    -9.0,  -439.0,    57.0,     0.0,    -4.0,   -40.0,
+
+   /* 151-200 */
+         23.0,   273.0,  -449.0,    -8.0,     6.0,     0.0,    -3.0,     3.0,   -48.0,    51.0,
+       -133.0,     0.0,   -21.0,     0.0,   -11.0,   -18.0,    35.0,     0.0,    11.0,    -5.0,
+        -53.0,     0.0,     4.0,     0.0,   -50.0,   -13.0,   -91.0,     6.0,    -6.0,     0.0,
+         52.0,    -3.0,     0.0,    -4.0,    -4.0,    10.0,     3.0,     0.0,     0.0,    -4.0,
+         -4.0,    -8.0,     8.0,     0.0,  -138.0,     0.0,     0.0,    54.0,     0.0,    -7.0,
+
+   /* 201-250 */
+        -37.0,     0.0,    -4.0,     8.0,    -9.0,    -3.0,  -145.0,   -10.0,    11.0, -2150.0,
+        -12.0,    85.0,     4.0,     3.0,   -86.0,    -6.0,     9.0,    -8.0,   -51.0,   -11.0,
+          0.0,     0.0,    31.0,   140.0,    57.0,   -14.0,     0.0,     4.0,     0.0,    -3.0,
+          0.0,     9.0,    -4.0,     5.0,    16.0,    -3.0,     0.0,     7.0,   -25.0,    42.0,
+        -27.0,     9.0, -1166.0,    -5.0,    -6.0,    -8.0,     0.0,   117.0,    -4.0,     3.0,
+
+   /* 251-300 */
+         -5.0,     0.0,    -5.0,     4.0,    -4.0,   -24.0,     3.0,     0.0,     8.0,     3.0,
+          7.0,    -3.0,    50.0,     0.0,    13.0,     0.0,    24.0,     5.0,    30.0,    18.0,
+          8.0,     3.0,     6.0,    -3.0,     0.0,  -127.0,     3.0,    -6.0,     5.0,    16.0,
+          3.0,     0.0,     0.0,     7.0,     0.0,     0.0,    -9.0,    17.0,     0.0,   -20.0,
+        -10.0,    -4.0,    22.0,    -4.0,    -3.0,   -16.0,     0.0,     4.0,   -68.0,    27.0,
+
+   /* 301-350 */
+          0.0,   -25.0,   -12.0,     3.0,     3.0,   490.0,   -22.0,    -7.0,    -3.0,   -46.0,
+         -5.0,     2.0,     0.0,   -28.0,     5.0,     0.0,   -11.0,     0.0,    -3.0,    25.0,
+          5.0,  1485.0,    -7.0,     0.0,    -6.0,    30.0,    -4.0,   -19.0,     0.0,     0.0,
+          4.0,     0.0,    -3.0,     5.0,     0.0,   118.0,     0.0,   -28.0,     5.0,    14.0,
+          0.0,  -458.0,     0.0,     9.0,     0.0,     0.0,    11.0,     6.0,   -16.0,     0.0,
+
+   /* 351-400 */
+         -5.0,  -166.0,    15.0,    10.0,   -78.0,     0.0,     7.0,    -5.0,     3.0,     5.0,
+          0.0,    -3.0,    -3.0,     0.0, -1223.0,     0.0,     3.0,     0.0,    -6.0,  -368.0,
+        -75.0,    11.0,     3.0,    -3.0,   -13.0,    21.0,    -3.0,    -4.0,     8.0,   -19.0,
+         -4.0,     0.0,    -6.0,    -8.0,    -1.0,   -14.0,     6.0,   -74.0,     0.0,     4.0,
+          8.0,     0.0,  -262.0,     0.0,    -7.0,     0.0,   -19.0,   202.0,    -8.0,     0.0,
+
+   /* 401-450 */
+         16.0,     5.0,     0.0,     1.0,   -35.0,    -3.0,     6.0,     3.0,     0.0,    12.0,
+          0.0,  -598.0,    -3.0,    -5.0,     3.0,     5.0,     4.0,    16.0,     8.0,     8.0,
+          0.0,   113.0,     0.0,     4.0,    27.0,    -3.0,     0.0,     5.0,     0.0,   -13.0,
+          5.0,   -18.0,    -4.0,    -5.0,    -3.0,    -5.0,    17.0,    11.0,     0.0,    83.0,
+         -4.0,     0.0,   117.0,    -5.0,    -3.0,    -3.0,     0.0,     3.0,     0.0,   393.0,
+
+   /* 451-500 */
+         -4.0,    -6.0,    -3.0,     8.0,    18.0,     8.0,    89.0,     3.0,    54.0,     0.0,
+          3.0,     0.0,  -154.0,    15.0,     0.0,     0.0,    80.0,     0.0,    11.0,    61.0,
+         14.0,   -11.0,     0.0,   123.0,     0.0,    -5.0,     7.0,     0.0,     0.0,   -89.0,
+          0.0,     0.0,  -123.0,     0.0,    12.0,   -13.0,     0.0,     3.0,   -62.0,   -11.0,
+          0.0,    -3.0,     0.0,     0.0,     0.0,   -85.0,   163.0,   -63.0,   -21.0,     0.0,
+
+   /* 501-550 */
+          3.0,     0.0,     3.0,     3.0,     0.0,     0.0,     6.0,     5.0,     0.0,     7.0,
+         -3.0,     3.0,    74.0,    -3.0,    26.0,    19.0,     6.0,    83.0,     0.0,    11.0,
+          3.0,     3.0,    -4.0,     5.0,  -339.0,     0.0,     5.0,     3.0,     0.0,    18.0,
+          9.0,    -8.0,     3.0,     0.0,     6.0,    -4.0,    67.0,    30.0,     0.0,     0.0,
+          0.0,   517.0,     0.0,   143.0,    29.0,    -4.0,    -6.0,     5.0,   -25.0,    -3.0,
+
+   /* 551-600 */
+          0.0,   -22.0,    50.0,     0.0,     0.0,    -4.0,    -5.0,     0.0,     4.0,    59.0,
+          0.0,    -8.0,    -3.0,     4.0,   370.0,     0.0,     0.0,    -6.0,     0.0,   -10.0,
+          0.0,     4.0,    34.0,     0.0,    -5.0,   -37.0,     3.0,    40.0,     0.0,  -184.0,
+         -3.0,    -3.0,     0.0,    31.0,    -3.0,    -7.0,     0.0,     3.0,     0.0,     0.0,
+         19.0,     0.0,     0.0,     0.0,    28.0,     0.0,     8.0,     0.0,     0.0,    -3.0,
+
+   /* 601-650 */
+         -9.0,     3.0,    17.0,     0.0,    19.0,     0.0,    14.0,     0.0,     0.0,     0.0,
+         13.0,     0.0,     2.0,     0.0,     8.0,     0.0,     6.0,     6.0,     0.0,     5.0,
+          3.0,    -3.0,     6.0,     7.0,    -4.0,     4.0,     6.0,     0.0,     0.0,     5.0,
+         -3.0,     4.0,    -5.0,     4.0,     0.0,    13.0,    21.0,     0.0,     0.0,     0.0,
+          0.0,    -3.0,    20.0,   -34.0,   -19.0,     3.0,    -3.0,    -6.0,    -4.0,     3.0,
+
+   /* 651-687 */
+          3.0,     4.0,     3.0,     6.0,    -8.0,     0.0,    -3.0,     0.0,   126.0,    -5.0,
+         -3.0,     5.0,     0.0,     0.0,  -126.0,     3.0,    21.0,     0.0,   -21.0,    -3.0,
+          0.0,     8.0,    -6.0,    -3.0,     3.0,    -3.0,    -5.0,    24.0,     0.0,     0.0,
+          0.0,   -24.0,     4.0,    13.0,     7.0,     3.0,     3.0
+};
+
+/* Longitude cos coefficients */
+static const double pcp[NPL] = {
+
+   /* 1-50 */
+         0.0, -117.0,  -43.0,    5.0,   -7.0,    0.0,    0.0,   89.0,    0.0, 1604.0,
+         0.0,    0.0,    6.0,    0.0,    0.0, -218.0, -481.0,  128.0, 5123.0, 2409.0,
+       -24.0,   -9.0,  -60.0,  -13.0,  -29.0,  -27.0,    0.0,    0.0,   24.0,    0.0,
+       101.0,   -8.0,   -6.0,    0.0,  175.0,   15.0,  212.0,  598.0,  334.0,  -12.0,
+        -6.0,    0.0,    0.0,    0.0,    0.0,   -9.0,  -78.0, -435.0,   15.0,    0.0,
+
+   /* 51-100 */
+       131.0,    0.0,    3.0,    4.0,    3.0,  -19.0,  -11.0,    0.0,    8.0,    3.0,
+        24.0,   -4.0,    0.0,   -8.0,    3.0,    5.0,    3.0,    4.0,   -5.0,    0.0,
+        24.0,   20.0,  233.0,    0.0,  -18.0,    3.0,   -3.0,   -4.0,   -8.0,   -5.0,
+         0.0,    8.0,    8.0,   19.0,  -22.0,    0.0,   -3.0,    3.0,    5.0,  -16.0,
+         3.0,    7.0,  -62.0,   22.0,    0.0,    0.0,    0.0,   -8.0,   -7.0,    0.0,
+
+   /* 101-150 */
+       -78.0,  -70.0,    6.0,    3.0,   -4.0,    6.0,   15.0,   84.0,   56.0,  -12.0,
+         8.0,    8.0,  -22.0,    0.0,   12.0,   -6.0,    0.0,    3.0,   29.0,   -4.0,
+        -3.0,   -3.0,    0.0,    0.0,    0.0,   66.0,    7.0,    3.0,    0.0,  -34.0,
+        14.0,   -6.0,   -4.0,    5.0,   17.0,  298.0,    0.0,    0.0,    0.0,  292.0,
+        17.0,  -16.0,    0.0,    0.0,   -5.0,    0.0,  -28.0,   -6.0,    0.0,   57.0,
+
+   /* 151-200 */
+         7.0,   80.0,  430.0,  -47.0,   47.0,   23.0,    0.0,   -4.0, -110.0,  114.0,
+         0.0,    4.0,   -6.0,   -3.0,  -21.0, -436.0,   -7.0,    5.0,   -3.0,   -3.0,
+        -9.0,    3.0,    0.0,   -4.0,  194.0,   52.0,  248.0,   49.0,  -47.0,    5.0,
+        23.0,    0.0,    5.0,    0.0,    8.0,    0.0,    0.0,    8.0,    8.0,    0.0,
+         0.0,    4.0,   -4.0,   15.0,    0.0,   -7.0,   -7.0,    0.0,   10.0,    0.0,
+
+   /* 201-250 */
+        35.0,    4.0,    9.0,    0.0,  -14.0,   -9.0,   47.0,   40.0,  -49.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,  153.0,    9.0,  -13.0,   12.0,    0.0, -268.0,
+        12.0,    7.0,    6.0,   27.0,   11.0,  -39.0,   -6.0,   15.0,    4.0,    0.0,
+        11.0,    6.0,   10.0,    3.0,    0.0,    0.0,    3.0,    0.0,   22.0,  223.0,
+      -143.0,   49.0,    0.0,    0.0,    0.0,    0.0,   -4.0,    0.0,    8.0,    0.0,
+
+   /* 251-300 */
+         0.0,   31.0,    0.0,    0.0,    0.0,  -13.0,    0.0,  -32.0,   12.0,    0.0,
+        13.0,   16.0,    0.0,   -5.0,    0.0,    5.0,    5.0,  -11.0,   -3.0,    0.0,
+       614.0,   -3.0,   17.0,   -9.0,    6.0,   21.0,    5.0,  -10.0,    0.0,    9.0,
+         0.0,   22.0,   19.0,    0.0,   -5.0,    3.0,    3.0,    0.0,   -3.0,   34.0,
+         0.0,    0.0,  -87.0,    0.0,   -6.0,   -3.0,   -3.0,    0.0,   39.0,    0.0,
+
+   /* 301-350 */
+        -4.0,    0.0,   -3.0,    0.0,   66.0,    0.0,   93.0,   28.0,   13.0,   14.0,
+         0.0,    1.0,   -3.0,    0.0,    0.0,    3.0,    0.0,    3.0,    0.0,  106.0,
+        21.0,    0.0,  -32.0,    5.0,   -3.0,   -6.0,    4.0,    0.0,    4.0,    3.0,
+         0.0,   -3.0,    0.0,    3.0,   11.0,    0.0,   -5.0,   36.0,   -5.0,  -59.0,
+         9.0,    0.0,  -45.0,    0.0,   -3.0,   -4.0,    0.0,    0.0,   23.0,   -4.0,
+
+   /* 351-400 */
+         0.0,  269.0,    0.0,    0.0,   45.0,   -5.0,    0.0,  328.0,    0.0,    0.0,
+         3.0,    0.0,    0.0,   -4.0,  -26.0,    7.0,    0.0,    3.0,   20.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,  -30.0,    3.0,    0.0,    0.0,  -27.0,  -11.0,
+         0.0,    5.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,   -3.0,    0.0,
+        11.0,    3.0,    0.0,   -4.0,    0.0,  -27.0,   -8.0,    0.0,   35.0,    4.0,
+
+   /* 401-450 */
+        -5.0,    0.0,   -3.0,    0.0,  -48.0,   -5.0,    0.0,    0.0,   -5.0,   55.0,
+         5.0,    0.0,  -13.0,   -7.0,    0.0,   -7.0,    0.0,   -6.0,   -3.0,  -31.0,
+         3.0,    0.0,  -24.0,    0.0,    0.0,    0.0,   -4.0,    0.0,   -3.0,    0.0,
+         0.0,  -10.0,  -28.0,    6.0,    0.0,   -9.0,    0.0,    4.0,   -6.0,   15.0,
+         0.0, -114.0,    0.0,   19.0,    0.0,    0.0,   -3.0,    0.0,   -6.0,    3.0,
+
+   /* 451-500 */
+        21.0,    0.0,    8.0,    0.0,  -29.0,   34.0,    0.0,   12.0,  -15.0,    3.0,
+         0.0,   35.0,  -30.0,    0.0,    4.0,    9.0,  -71.0,  -20.0,    5.0,  -96.0,
+         9.0,   -6.0,   -3.0, -415.0,    0.0,    0.0,  -32.0,   -9.0,   -4.0,    0.0,
+       -86.0,    0.0, -416.0,   -3.0,   -6.0,    9.0,  -15.0,    0.0,  -97.0,    5.0,
+       -19.0,    0.0,    4.0,    3.0,    4.0,  -70.0,  -12.0,  -16.0,  -32.0,   -3.0,
+
+   /* 501-550 */
+         0.0,    8.0,   10.0,    0.0,   -7.0,   -4.0,   19.0, -173.0,   -7.0,  -12.0,
+         0.0,   -4.0,    0.0,   12.0,  -14.0,    0.0,   24.0,    0.0,  -10.0,   -3.0,
+         0.0,    0.0,    0.0,  -23.0,    0.0,  -10.0,    0.0,    0.0,   -4.0,   -3.0,
+       -11.0,    0.0,    0.0,    9.0,   -9.0,  -12.0,  -91.0,  -18.0,    0.0, -114.0,
+         0.0,   16.0,   -7.0,   -3.0,    0.0,    0.0,    0.0,   12.0,    0.0,    0.0,
+
+   /* 551-600 */
+         4.0,   12.0,    0.0,    7.0,    3.0,    4.0,  -11.0,    4.0,   17.0,    0.0,
+        -4.0,    0.0,    0.0,  -15.0,   -8.0,    0.0,    3.0,    3.0,    6.0,    0.0,
+         9.0,   17.0,    0.0,    5.0,    0.0,   -7.0,   13.0,    0.0,   -3.0,   -3.0,
+         0.0,    0.0,  -10.0,   -6.0,  -32.0,    0.0,   -8.0,   -4.0,    4.0,    3.0,
+       -23.0,    0.0,    3.0,    9.0,    0.0,   -7.0,   -4.0,    0.0,    3.0,    0.0,
+
+   /* 601-650 */
+         0.0,   12.0,   -3.0,    7.0,    0.0,   -5.0,   -3.0,    0.0,    0.0,    5.0,
+         0.0,   -3.0,    9.0,    0.0,    0.0,    4.0,    0.0,    0.0,    3.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,   -4.0,   -4.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,    3.0,    0.0,   11.0,   -5.0,   -5.0,    5.0,
+        -5.0,    0.0,   10.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,
+
+   /* 651-687 */
+         0.0,    0.0,    0.0,    0.0,    0.0,    3.0,    0.0,   -3.0,  -63.0,    0.0,
+        28.0,    0.0,    9.0,    9.0,  -63.0,    0.0,  -11.0,   -4.0,  -11.0,    0.0,
+         3.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,  -12.0,    3.0,    3.0,
+         3.0,  -12.0,    0.0,    0.0,    0.0,    0.0,    0.0
+};
+
+/* Obliquity sin coefficients */
+static const double pse[NPL] = {
+
+   /* 1-50 */
+          0.0,   -42.0,     0.0,     0.0,    -3.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     2.0,     0.0,     0.0,   117.0,  -257.0,     0.0,  2735.0, -1286.0,
+        -11.0,     0.0,     0.0,    -7.0,   -16.0,   -14.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,    -2.0,    -3.0,     0.0,    76.0,     6.0,  -133.0,   319.0,     0.0,    -7.0,
+          3.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,  -232.0,     7.0,     0.0,
+
+   /* 51-100 */
+          0.0,     0.0,     0.0,     2.0,     0.0,   -10.0,     6.0,     0.0,     0.0,     0.0,
+         11.0,    -2.0,     0.0,    -4.0,     0.0,     0.0,     2.0,     2.0,     0.0,     0.0,
+         13.0,     0.0,     0.0,     0.0,     0.0,     1.0,    -1.0,    -2.0,    -4.0,     3.0,
+          0.0,     3.0,    -4.0,    10.0,     0.0,     0.0,     0.0,     0.0,     3.0,    -9.0,
+          0.0,     4.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -4.0,     0.0,
+
+   /* 101-150 */
+          0.0,   -37.0,     3.0,     2.0,    -2.0,     3.0,    -8.0,    45.0,     0.0,    -6.0,
+          4.0,     4.0,   -12.0,     0.0,     0.0,     0.0,     0.0,     1.0,    15.0,    -2.0,
+         -1.0,     0.0,     0.0,     0.0,     0.0,    35.0,     0.0,     2.0,     0.0,   -18.0,
+          7.0,    -3.0,    -2.0,     2.0,     9.0,   159.0,     0.0,     0.0,     0.0,   156.0,
+          9.0,     0.0,    -1.0,     0.0,    -3.0,     0.0,   -15.0,    -3.0,     0.0,    30.0,
+
+   /* 151-200 */
+          3.0,    43.0,     0.0,   -25.0,    25.0,    13.0,     0.0,    -2.0,   -59.0,    61.0,
+          0.0,     0.0,    -3.0,    -1.0,   -11.0,  -233.0,     0.0,     3.0,    -1.0,    -1.0,
+         -5.0,     2.0,     0.0,     0.0,   103.0,    28.0,     0.0,    26.0,   -25.0,     3.0,
+         10.0,     0.0,     3.0,     0.0,     3.0,     0.0,     0.0,     4.0,     4.0,     0.0,
+          0.0,     2.0,    -2.0,     7.0,     0.0,    -3.0,    -3.0,     0.0,     4.0,     0.0,
+
+   /* 201-250 */
+         19.0,     0.0,     0.0,     0.0,    -8.0,    -5.0,     0.0,    21.0,   -26.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     5.0,    -7.0,     6.0,     0.0,  -116.0,
+          5.0,     3.0,     3.0,    14.0,     6.0,     0.0,    -2.0,     8.0,     0.0,     0.0,
+          5.0,     0.0,     4.0,     0.0,     0.0,     0.0,     2.0,     0.0,     0.0,   119.0,
+        -77.0,    26.0,     0.0,     0.0,     0.0,     1.0,     0.0,     0.0,     4.0,     0.0,
+
+   /* 251-300 */
+          0.0,     0.0,     1.0,     0.0,     0.0,    -6.0,     0.0,   -17.0,     5.0,     0.0,
+          0.0,     0.0,     0.0,    -3.0,     0.0,     3.0,     2.0,    -5.0,    -2.0,     0.0,
+          0.0,    -1.0,     9.0,    -5.0,     3.0,     9.0,     0.0,    -4.0,     0.0,     4.0,
+          0.0,     0.0,    10.0,     0.0,    -2.0,     1.0,     1.0,     0.0,    -2.0,     0.0,
+          1.0,     0.0,     0.0,     0.0,    -2.0,    -1.0,    -2.0,     0.0,     0.0,     0.0,
+
+   /* 301-350 */
+          0.0,     0.0,    -2.0,     0.0,    29.0,     0.0,    49.0,    15.0,     7.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     1.0,     0.0,    57.0,
+         11.0,     0.0,   -17.0,     3.0,    -2.0,    -2.0,     0.0,     0.0,     2.0,     0.0,
+          0.0,    -1.0,     0.0,     1.0,     0.0,     0.0,    -3.0,     0.0,     0.0,   -31.0,
+          5.0,     0.0,   -20.0,     0.0,     0.0,    -2.0,     0.0,     0.0,     0.0,    -2.0,
+
+   /* 351-400 */
+          0.0,     0.0,     0.0,     0.0,     0.0,    -2.0,     0.0,     0.0,     0.0,     0.0,
+          1.0,     0.0,     0.0,    -2.0,     0.0,     3.0,     0.0,     2.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     2.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -1.0,     0.0,
+          0.0,     2.0,     0.0,     0.0,     0.0,   -12.0,    -4.0,     0.0,    19.0,     2.0,
+
+   /* 401-450 */
+          0.0,     0.0,     0.0,     0.0,   -21.0,    -2.0,     0.0,     0.0,     0.0,    29.0,
+          3.0,     0.0,    -7.0,    -3.0,     0.0,     0.0,     0.0,     0.0,     0.0,   -16.0,
+          1.0,     0.0,   -10.0,     0.0,     0.0,     0.0,    -2.0,     0.0,     0.0,     0.0,
+          0.0,    -4.0,     0.0,     3.0,     0.0,    -4.0,     0.0,     0.0,    -2.0,     0.0,
+          0.0,   -49.0,     0.0,    10.0,     0.0,     0.0,    -1.0,     0.0,    -2.0,     0.0,
+
+   /* 451-500 */
+         11.0,    -1.0,     4.0,     0.0,   -13.0,    18.0,     0.0,     6.0,    -7.0,     0.0,
+          0.0,     0.0,   -13.0,     0.0,     2.0,     0.0,   -31.0,    -9.0,     2.0,   -42.0,
+          4.0,    -3.0,    -1.0,  -180.0,     0.0,     0.0,   -17.0,    -5.0,     2.0,     0.0,
+        -19.0,   -19.0,  -180.0,    -1.0,    -3.0,     4.0,    -7.0,     0.0,   -42.0,     2.0,
+         -8.0,     0.0,     2.0,     0.0,     2.0,   -31.0,    -5.0,    -7.0,   -14.0,    -1.0,
+
+   /* 501-550 */
+          0.0,     0.0,     4.0,     0.0,    -3.0,    -2.0,     0.0,   -75.0,    -3.0,    -5.0,
+          0.0,    -2.0,     0.0,     6.0,    -6.0,     0.0,    13.0,     0.0,    -5.0,    -1.0,
+          1.0,     0.0,     0.0,   -12.0,     0.0,    -5.0,     0.0,     0.0,    -2.0,     0.0,
+         -5.0,     0.0,     0.0,     0.0,    -4.0,     0.0,   -39.0,    -8.0,     0.0,   -50.0,
+          0.0,     7.0,    -3.0,    -1.0,     0.0,     0.0,     0.0,     5.0,     0.0,     0.0,
+
+   /* 551-600 */
+          2.0,     5.0,     0.0,     4.0,     1.0,     2.0,    -5.0,     2.0,     9.0,     0.0,
+         -2.0,     0.0,     0.0,    -8.0,     0.0,    -3.0,     1.0,     1.0,     0.0,     0.0,
+          4.0,     7.0,     0.0,     3.0,     0.0,    -3.0,     7.0,     0.0,    -2.0,    -1.0,
+          0.0,     0.0,    -6.0,     0.0,   -14.0,     0.0,    -4.0,     0.0,     0.0,     1.0,
+        -10.0,     0.0,     2.0,     5.0,     0.0,    -4.0,     0.0,    -2.0,     0.0,     0.0,
+
+   /* 601-650 */
+          1.0,     5.0,    -1.0,     4.0,     0.0,    -3.0,     0.0,    -1.0,     0.0,     3.0,
+          0.0,    -2.0,     4.0,     0.0,     0.0,     2.0,     0.0,     0.0,     1.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -2.0,     3.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 651-687 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     1.0,     0.0,    -2.0,   -27.0,     1.0,
+         15.0,     1.0,     4.0,     4.0,   -27.0,     0.0,    -6.0,     0.0,    -6.0,     0.0,
+          1.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,    -5.0,     1.0,     1.0,
+          2.0,    -5.0,    -1.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* Obliquity cos coefficients */
+static const double pce[NPL] = {
+
+   /* 1-50 */
+         0.0,  -40.0,  -54.0,    0.0,    0.0,   -2.0,   61.0,    0.0,    0.0,    0.0,
+       -53.0,    2.0,    0.0,    0.0,    0.0,    8.0,  -17.0,    0.0, 1647.0, -771.0,
+        -9.0,    0.0,    0.0,    0.0,   14.0,   -5.0,   -6.0,    0.0,    0.0, -151.0,
+         0.0,    0.0,    0.0,   -3.0,   17.0,    0.0,  269.0, -641.0,    0.0,   -6.0,
+         3.0,    3.0,   -3.0,    0.0,   -7.0,    0.0,    0.0,  246.0,    0.0,    2.0,
+
+   /* 51-100 */
+         0.0,    0.0,    0.0,    0.0,    0.0,    9.0,   -5.0,    3.0,    0.0,    0.0,
+        -5.0,    1.0,   -1.0,    0.0,    0.0,    0.0,    0.0,    3.0,    0.0,    2.0,
+        -2.0,    0.0,    0.0,    1.0,    0.0,    0.0,    0.0,    1.0,   -1.0,    0.0,
+         3.0,    6.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,   -2.0,  -48.0,
+         0.0,    2.0,    0.0,    0.0,    0.0,    0.0,   -3.0,    0.0,   -8.0,    1.0,
+
+   /* 101-150 */
+         0.0,  -11.0,    0.0,   -2.0,    9.0,    0.0,   17.0,  -93.0,    0.0,   35.0,
+       -25.0,    0.0,   -5.0,    2.0,    0.0,    0.0,   -2.0,   -2.0,    0.0,    2.0,
+        -5.0,    0.0,    0.0,   -2.0,    3.0,  -25.0,    0.0,    0.0,    0.0,   36.0,
+         0.0,   -5.0,    3.0,    1.0,  -41.0,  -45.0,   -1.0,    2.0,    1.0,   44.0,
+        39.0,    0.0,   -2.0,    0.0,    5.0,    0.0,  -30.0,    0.0,    2.0,   21.0,
+
+   /* 151-200 */
+       -13.0, -146.0,    0.0,    4.0,   -3.0,    0.0,    2.0,   -2.0,   26.0,  -27.0,
+        57.0,    0.0,   11.0,    0.0,    6.0,    9.0,    0.0,    0.0,   -6.0,    3.0,
+        28.0,    1.0,   -2.0,    0.0,   27.0,    7.0,    0.0,   -3.0,    3.0,    0.0,
+       -23.0,    1.0,    0.0,    0.0,    2.0,    0.0,   -2.0,    0.0,    1.0,    0.0,
+         0.0,    4.0,   -4.0,    0.0,    0.0,    0.0,    0.0,  -29.0,    0.0,    3.0,
+
+   /* 201-250 */
+        20.0,    0.0,    0.0,   -4.0,    5.0,    3.0,    0.0,    5.0,   -7.0,  932.0,
+         5.0,  -37.0,   -2.0,   -2.0,    0.0,    3.0,   -5.0,    4.0,   22.0,    5.0,
+         0.0,    0.0,  -17.0,  -75.0,  -30.0,    0.0,    0.0,   -2.0,    0.0,    1.0,
+         0.0,    0.0,    2.0,    0.0,   -9.0,    0.0,   -1.0,   -3.0,    0.0,  -22.0,
+        14.0,   -5.0,  505.0,    2.0,    3.0,    4.0,    0.0,  -63.0,    2.0,   -2.0,
+
+   /* 251-300 */
+         2.0,    0.0,    3.0,   -2.0,    2.0,   10.0,    0.0,    0.0,   -3.0,   -1.0,
+         0.0,    0.0,  -27.0,    0.0,    0.0,    1.0,  -11.0,   -2.0,  -16.0,   -9.0,
+         0.0,   -2.0,   -3.0,    2.0,   -1.0,   55.0,    0.0,    3.0,    0.0,   -7.0,
+        -2.0,    0.0,    0.0,   -4.0,    0.0,    0.0,    4.0,   -7.0,   -1.0,    0.0,
+         5.0,    2.0,    0.0,    2.0,    1.0,    7.0,    0.0,    0.0,    0.0,  -14.0,
+
+   /* 301-350 */
+         0.0,    0.0,    6.0,   -1.0,   -1.0, -213.0,   12.0,    4.0,    2.0,    0.0,
+         0.0,    0.0,    0.0,   15.0,   -2.0,    0.0,    5.0,    0.0,    1.0,  -13.0,
+        -3.0,    0.0,    4.0,    0.0,    3.0,  -13.0,    0.0,   10.0,   -1.0,    0.0,
+        -2.0,    0.0,    0.0,   -2.0,    0.0,  -52.0,    0.0,    0.0,    0.0,   -8.0,
+         1.0,  198.0,    0.0,   -5.0,    0.0,   -1.0,   -6.0,   -2.0,    0.0,    0.0,
+
+   /* 351-400 */
+         2.0,    0.0,   -8.0,   -4.0,    0.0,    0.0,   -4.0,    0.0,   -2.0,   -2.0,
+         0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,
+         0.0,   -6.0,   -2.0,    1.0,    0.0,    0.0,    1.0,    2.0,    0.0,    0.0,
+         2.0,    0.0,    2.0,    0.0,    0.0,    6.0,    0.0,   32.0,    0.0,   -2.0,
+         0.0,    0.0,  114.0,    0.0,    4.0,    0.0,    8.0,  -87.0,    5.0,    0.0,
+
+   /* 401-450 */
+         0.0,   -3.0,    0.0,    0.0,   15.0,    1.0,   -3.0,   -1.0,    0.0,   -6.0,
+         0.0,    0.0,    1.0,    2.0,   -1.0,    0.0,   -2.0,    0.0,    0.0,   -4.0,
+         0.0,  -49.0,    0.0,   -2.0,    0.0,    1.0,    0.0,   -2.0,    0.0,    6.0,
+        -2.0,    8.0,    0.0,    2.0,    1.0,    2.0,   -7.0,    0.0,    0.0,    0.0,
+         2.0,    0.0,  -51.0,    2.0,    0.0,    2.0,    0.0,    0.0,    0.0,    0.0,
+
+   /* 451-500 */
+         2.0,    3.0,    1.0,    0.0,   -8.0,   -4.0,    0.0,   -1.0,  -24.0,    0.0,
+        -1.0,    0.0,   67.0,    0.0,    0.0,    0.0,  -35.0,    0.0,   -5.0,  -27.0,
+        -6.0,    5.0,    0.0,  -53.0,  -35.0,    0.0,   -4.0,    0.0,    0.0,   38.0,
+        -6.0,    6.0,   53.0,    0.0,   -5.0,    6.0,    0.0,   -1.0,   27.0,    5.0,
+         0.0,    1.0,    0.0,    0.0,    0.0,   37.0,  -72.0,   28.0,    9.0,    0.0,
+
+   /* 501-550 */
+        -2.0,    0.0,   -1.0,   -1.0,    0.0,    0.0,    0.0,   -2.0,    0.0,   -3.0,
+         2.0,   -1.0,  -32.0,    2.0,  -11.0,   -8.0,   -3.0,    0.0,    0.0,   -5.0,
+        -1.0,   -1.0,    0.0,   -3.0,  147.0,    0.0,    0.0,   -1.0,    0.0,    0.0,
+        -4.0,    4.0,   -1.0,    0.0,   -2.0,    0.0,  -29.0,  -13.0,    0.0,    0.0,
+        23.0, -224.0,    0.0,  -62.0,  -13.0,    2.0,    3.0,   -2.0,   11.0,    1.0,
+
+   /* 551-600 */
+         0.0,   10.0,  -22.0,    0.0,    0.0,    2.0,    2.0,    0.0,   -2.0,    0.0,
+         0.0,    4.0,    0.0,   -2.0, -160.0,    0.0,    0.0,    3.0,    0.0,    4.0,
+         0.0,   -2.0,  -15.0,    0.0,    2.0,   16.0,   -2.0,    0.0,    0.0,   80.0,
+         1.0,    0.0,   -1.0,  -13.0,    1.0,    3.0,    0.0,    0.0,    0.0,    0.0,
+         2.0,  -10.0,    0.0,   -1.0,    0.0,    0.0,   -4.0,    0.0,    0.0,    1.0,
+
+   /* 601-650 */
+         4.0,   -1.0,    0.0,    0.0,    0.0,    0.0,   -1.0,    0.0,   -5.0,    0.0,
+         0.0,    0.0,    3.0,   -4.0,    0.0,    0.0,   -3.0,    0.0,    0.0,   -2.0,
+        -1.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,
+         0.0,    2.0,    0.0,    0.0,    0.0,   -2.0,    1.0,    3.0,    0.0,    0.0,
+
+   /* 651-687 */
+         0.0,    0.0,   -1.0,   -3.0,    3.0,    0.0,    0.0,    0.0,  -55.0,    2.0,
+         2.0,   -2.0,    1.0,   -1.0,   55.0,   -1.0,  -11.0,    0.0,   11.0,    1.0,
+         0.0,   -4.0,    3.0,    1.0,   -1.0,    1.0,    2.0,  -11.0,    0.0,    0.0,
+         0.0,   10.0,   -2.0,   -6.0,   -3.0,   -1.0,   -1.0
+};
+
+/* dpsi = sum0, deps = sum1 (0.1 microarcsec) */
+static const ascomSERIES PL = {
+   NPL, 13, &mpl[0][0], 21, NULL, NULL, 2,
+   { { 0, NPL, psp, pcp },
+     { 0, NPL, pse, pce } }
+};
+
+void ascomNut00a(double date1, double date2, double *dpsi, double *deps)
+/*
+**  - - - - - - - - - - - -
+**   a s c o m N u t 0 0 a
+**  - - - - - - - - - - - -
+**
+**  Nutation, IAU 2000A model (MHB2000 luni-solar and planetary nutation
+**  with free core nutation omitted):  as iauNut00a.
+**
+**  Given:
+**     date1,date2   double   TT as a 2-part Julian Date
+**
+**  Returned:
+**     dpsi,deps     double   nutation, luni-solar + planetary
+**
+**  Notes:
+**
+**  1) The model, the date conventions and the units are those of
+**     iauNut00a, which see.
+**
+**  2) The series are summed by ascomSeries, with compensated summation.
+**     The results agree with iauNut00a to its rounding error.
+**
+**  Called:
+**     iauFal03     mean anomaly of the Moon
+**     iauFaf03     mean argument of the latitude of the Moon
+**     iauFaom03    mean longitude of the Moon's ascending node
+**     iauFame03    mean longitude of Mercury
+**     iauFave03    mean longitude of Venus
+**     iauFae03     mean longitude of Earth
+**     iauFama03    mean longitude of Mars
+**     iauFaju03    mean longitude of Jupiter
+**     iauFasa03    mean longitude of Saturn
+**     iauFaur03    mean longitude of Uranus
+**     iauFapa03    general accumulated precession in longitude
+**     ascomSeries  evaluate a Poisson/Fourier series
+*/
+{
+   double t, fa[13], w[4];
+
+/* Units of 0.1 microarcsecond to radians */
+   const double U2R = DAS2R / 1e7;
+
+
+/* Interval between fundamental date J2000.0 and given date (JC). */
+   t = ((date1 - DJ00) + date2) / DJC;
+
+/* ------------------- */
+/* LUNI-SOLAR NUTATION */
+/* ------------------- */
+
+/* Fundamental (Delaunay) arguments, as iauNut00a. */
+
+/* Mean anomaly of the Moon (IERS 2003). */
+   fa[0] = iauFal03(t);
+
+/* Mean anomaly of the Sun (MHB2000). */
+   fa[1] = fmod(1287104.79305  +
+              t * (129596581.0481  +
+              t * (-0.5532  +
+              t * (0.000136  +
+              t * (-0.00001149)))), TURNAS) * DAS2R;
+
+/* Mean longitude of the Moon minus that of the ascending node */
+/* (IERS 2003). */
+   fa[2] = iauFaf03(t);
+
+/* Mean elongation of the Moon from the Sun (MHB2000). */
+   fa[3] = fmod(1072260.70369  +
+              t * (1602961601.2090  +
+              t * (-6.3706  +
+              t * (0.006593  +
+              t * (-0.00003169)))), TURNAS) * DAS2R;
+
+/* Mean longitude of the ascending node of the Moon (IERS 2003). */
+   fa[4] = iauFaom03(t);
+
+/* Sum the series and convert from 0.1 microarcsec units to radians. */
+   ascomSeries(&LS, fa, 0.0, w);
+   *dpsi = (w[0] + w[1] * t) * U2R;
+   *deps = (w[2] + w[3] * t) * U2R;
+
+/* ------------------ */
+/* PLANETARY NUTATION */
+/* ------------------ */
+
+/* Arguments as iauNut00a:  MHB2000 Delaunay arguments, IERS 2003 */
+/* planetary longitudes Mercury to Uranus, MHB2000 Neptune. */
+
+/* Mean anomaly of the Moon (MHB2000). */
+   fa[0] = fmod(2.35555598 + 8328.6914269554 * t, D2PI);
+
+/* Mean longitude of the Moon minus that of the ascending node */
+/* (MHB2000). */
+   fa[1] = fmod(1.627905234 + 8433.466158131 * t, D2PI);
+
+/* Mean elongation of the Moon from the Sun (MHB2000). */
+   fa[2] = fmod(5.198466741 + 7771.3771468121 * t, D2PI);
+
+/* Mean longitude of the ascending node of the Moon (MHB2000). */
+   fa[3] = fmod(2.18243920 - 33.757045 * t, D2PI);
+
+/* Planetary longitudes, Mercury through Uranus (IERS 2003). */
+   fa[4] = iauFame03(t);
+   fa[5] = iauFave03(t);
+   fa[6] = iauFae03(t);
+   fa[7] = iauFama03(t);
+   fa[8] = iauFaju03(t);
+   fa[9] = iauFasa03(t);
+   fa[10] = iauFaur03(t);
+
+/* Neptune longitude (MHB2000). */
+   fa[11] = fmod(5.321159000 + 3.8127774000 * t, D2PI);
+
+/* General accumulated precession in longitude (IERS 2003). */
+   fa[12] = iauFapa03(t);
+
+/* Sum the series and add luni-solar and planetary components. */
+   ascomSeries(&PL, fa, 0.0, w);
+   *dpsi += w[0] * U2R;
+   *deps += w[1] * U2R;
+
+}
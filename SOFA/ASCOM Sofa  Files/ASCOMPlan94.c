@@ -0,0 +1,394 @@
+#include <stddef.h>
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* iauPlan94 for all eight planets over an array of dates. */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under       */
+/* license, and is not itself software provided by or endorsed by SOFA. The tables and the arithmetic are those */
+/* of the SOFA 2018-01-30 iauPlan94. It differs from iauPlan94 in that:                                         */
+/*                                                                                                              */
+/*  - the dates are taken in blocks and each stage runs across the block, so the compiler can vectorize it;     */
+/*  - the sines and cosines of the 64 distinct multiples of the time argument in the perturbation tables are    */
+/*    formed once per date for all the planets, where iauPlan94 forms 19 per planet;                            */
+/*  - Kepler's equation is solved by Newton iterations across the block until every date has converged, so a    */
+/*    date may take a step or two more than in iauPlan94, a difference at the rounding level;                   */
+/*  - iauAnpm is written out inline.                                                                            */
+
+/* Dates per block (the trigonometric terms of a block stay in the L1 cache) */
+#define BLOCK 16
+
+/* Gaussian constant */
+#define GK 0.017202098950
+
+/* Sin and cos of J2000.0 mean obliquity (IAU 1976) */
+#define SINEPS 0.3977771559319137
+#define COSEPS 0.9174820620691818
+
+/* Maximum number of iterations allowed to solve Kepler's equation */
+#define KMAX 10
+
+/* Planetary inverse masses */
+static const double amas[] = { 6023600.0,       /* Mercury */
+                                408523.5,       /* Venus   */
+                                328900.5,       /* EMB     */
+                               3098710.0,       /* Mars    */
+                                  1047.355,     /* Jupiter */
+                                  3498.5,       /* Saturn  */
+                                 22869.0,       /* Uranus  */
+                                 19314.0 };     /* Neptune */
+
+/*
+** Tables giving the mean Keplerian elements, limited to t^2 terms:
+**
+**   a       semi-major axis (au)
+**   dlm     mean longitude (degree and arcsecond)
+**   e       eccentricity
+**   pi      longitude of the perihelion (degree and arcsecond)
+**   dinc    inclination (degree and arcsecond)
+**   omega   longitude of the ascending node (degree and arcsecond)
+*/
+
+static const double a[][3] = {
+    {  0.3870983098,           0.0,     0.0 },  /* Mercury */
+    {  0.7233298200,           0.0,     0.0 },  /* Venus   */
+    {  1.0000010178,           0.0,     0.0 },  /* EMB     */
+    {  1.5236793419,         3e-10,     0.0 },  /* Mars    */
+    {  5.2026032092,     19132e-10, -39e-10 },  /* Jupiter */
+    {  9.5549091915, -0.0000213896, 444e-10 },  /* Saturn  */
+    { 19.2184460618,     -3716e-10, 979e-10 },  /* Uranus  */
+    { 30.1103868694,    -16635e-10, 686e-10 }   /* Neptune */
+};
+
+static const double dlm[][3] = {
+    { 252.25090552, 5381016286.88982,  -1.92789 },
+    { 181.97980085, 2106641364.33548,   0.59381 },
+    { 100.46645683, 1295977422.83429,  -2.04411 },
+    { 355.43299958,  689050774.93988,   0.94264 },
+    {  34.35151874,  109256603.77991, -30.60378 },
+    {  50.07744430,   43996098.55732,  75.61614 },
+    { 314.05500511,   15424811.93933,  -1.75083 },
+    { 304.34866548,    7865503.20744,   0.21103 }
+};
+
+static const double e[][3] = {
+    { 0.2056317526,  0.0002040653,    -28349e-10 },
+    { 0.0067719164, -0.0004776521,     98127e-10 },
+    { 0.0167086342, -0.0004203654, -0.0000126734 },
+    { 0.0934006477,  0.0009048438,    -80641e-10 },
+    { 0.0484979255,  0.0016322542, -0.0000471366 },
+    { 0.0555481426, -0.0034664062, -0.0000643639 },
+    { 0.0463812221, -0.0002729293,  0.0000078913 },
+    { 0.0094557470,  0.0000603263,           0.0 }
+};
+
+static const double pi[][3] = {
+    {  77.45611904,  5719.11590,   -4.83016 },
+    { 131.56370300,   175.48640, -498.48184 },
+    { 102.93734808, 11612.35290,   53.27577 },
+    { 336.06023395, 15980.45908,  -62.32800 },
+    {  14.33120687,  7758.75163,  259.95938 },
+    {  93.05723748, 20395.49439,  190.25952 },
+    { 173.00529106,  3215.56238,  -34.09288 },
+    {  48.12027554,  1050.71912,   27.39717 }
+};
+
+static const double dinc[][3] = {
+    { 7.00498625, -214.25629,   0.28977 },
+    { 3.39466189,  -30.84437, -11.67836 },
+    {        0.0,  469.97289,  -3.35053 },
+    { 1.84972648, -293.31722,  -8.11830 },
+    { 1.30326698,  -71.55890,  11.95297 },
+    { 2.48887878,   91.85195, -17.66225 },
+    { 0.77319689,  -60.72723,   1.25759 },
+    { 1.76995259,    8.12333,   0.08135 }
+};
+
+static const double omega[][3] = {
+    {  48.33089304,  -4515.21727,  -31.79892 },
+    {  76.67992019, -10008.48154,  -51.32614 },
+    { 174.87317577,  -8679.27034,   15.34191 },
+    {  49.55809321, -10620.90088, -230.57416 },
+    { 100.46440702,   6362.03561,  326.52178 },
+    { 113.66550252,  -9240.19942,  -66.23743 },
+    {  74.00595701,   2669.15033,  145.93964 },
+    { 131.78405702,   -221.94322,   -0.78728 }
+};
+
+/* Tables for trigonometric terms to be added to the mean elements of */
+/* the semi-major axes */
+
+static const double ca[][9] = {
+ {       4,    -13,    11,   -9,    -9,   -3,     -1,     4,     0 },
+ {    -156,     59,   -42,    6,    19,  -20,    -10,   -12,     0 },
+ {      64,   -152,    62,   -8,    32,  -41,     19,   -11,     0 },
+ {     124,    621,  -145,  208,    54,  -57,     30,    15,     0 },
+ {  -23437,  -2634,  6601, 6259, -1507,-1821,   2620, -2115, -1489 },
+ {   62911,-119919, 79336,17814,-24241,12068,   8306, -4893,  8902 },
+ {  389061,-262125,-44088, 8387,-22976,-2093,   -615, -9720,  6633 },
+ { -412235,-157046,-31430,37817, -9740,  -13,  -7449,  9644,     0 }
+};
+
+static const double sa[][9] = {
+ {     -29,    -1,     9,     6,    -6,     5,     4,     0,     0 },
+ {     -48,  -125,   -26,   -37,    18,   -13,   -20,    -2,     0 },
+ {    -150,   -46,    68,    54,    14,    24,   -28,    22,     0 },
+ {    -621,   532,  -694,   -20,   192,   -94,    71,   -73,     0 },
+ {  -14614,-19828, -5869,  1881, -4372, -2255,   782,   930,   913 },
+ {  139737,     0, 24667, 51123, -5102,  7429, -4095, -1976, -9566 },
+ { -138081,     0, 37205,-49039,-41901,-33872,-27037,-12474, 18797 },
+ {       0, 28492,133236, 69654, 52322,-49577,-26430, -3593,     0 }
+};
+
+/* Tables giving the trigonometric terms to be added to the mean */
+/* elements of the mean longitudes */
+
+static const double cl[][10] = {
+ {      21,   -95, -157,   41,   -5,   42,  23,  30,      0,     0 },
+ {    -160,  -313, -235,   60,  -74,  -76, -27,  34,      0,     0 },
+ {    -325,  -322,  -79,  232,  -52,   97,  55, -41,      0,     0 },
+ {    2268,  -979,  802,  602, -668,  -33, 345, 201,    -55,     0 },
+ {    7610, -4997,-7689,-5841,-2617, 1115,-748,-607,   6074,   354 },
+ {  -18549, 30125,20012, -730,  824,   23,1289,-352, -14767, -2062 },
+ { -135245,-14594, 4197,-4030,-5630,-2898,2540,-306,   2939,  1986 },
+ {   89948,  2103, 8963, 2695, 3682, 1648, 866,-154,  -1963,  -283 }
+};
+
+static const double sl[][10] = {
+ {   -342,   136,  -23,   62,   66,  -52, -33,    17,     0,     0 },
+ {    524,  -149,  -35,  117,  151,  122, -71,   -62,     0,     0 },
+ {   -105,  -137,  258,   35, -116,  -88,-112,   -80,     0,     0 },
+ {    854,  -205, -936, -240,  140, -341, -97,  -232,   536,     0 },
+ { -56980,  8016, 1012, 1448,-3024,-3710, 318,   503,  3767,   577 },
+ { 138606,-13478,-4964, 1441,-1319,-1482, 427,  1236, -9167, -1918 },
+ {  71234,-41116, 5334,-4935,-1848,   66, 434, -1748,  3780,  -701 },
+ { -47645, 11647, 2166, 3194,  679,    0,-244,  -419, -2531,    48 }
+};
+
+/* The distinct multipliers of dmu in the SOFA kp and kq tables; ip and iq give each entry of kp (with */
+/* ca, sa) and kq (with cl, sl) as an index into km.                                                   */
+#define NK 64
+static const double km[NK] = {
+         0,      4,      8,     10,     12,     19,     31,     38,     73,     98,
+       102,    106,    177,    200,    204,    208,    287,    306,    385,    487,
+       532,    574,    880,   1107,   1167,   1265,   1367,   1454,   1473,   1760,
+      2047,   2157,   2640,   2658,   3086,   4387,   4872,   6345,   7077,   7818,
+      8184,  10931,  12661,  14163,  14529,  15318,  15636,  15746,  16002,  16368,
+     21863,  26250,  26934,  28939,  32004,  32794,  43725,  53867,  59899,  69613,
+     71087,  75645,  88306, 142173
+};
+
+static const int ip[][9] = {
+   { 59, 61, 62, 58, 47, 60, 63, 34,  0 },
+   { 50, 55, 52, 41, 51, 56, 57, 53,  0 },
+   { 48, 50, 54, 41, 44, 49, 45, 55,  0 },
+   { 37, 39, 46, 38, 40, 43, 23, 36,  0 },
+   { 29, 27, 24, 22, 16, 32,  5, 30, 27 },
+   { 21,  0, 22, 16,  5, 29, 24, 17, 21 },
+   { 14,  0, 12, 25,  1, 18, 13, 15, 14 },
+   {  0, 10, 11,  1,  9, 26, 19, 14,  0 }
+};
+
+static const int iq[][10] = {
+   { 34, 47, 59, 58, 61, 62, 42, 33,  0,  0 },
+   { 50, 55, 41,  8, 35, 52, 28, 31,  0,  0 },
+   {  3, 48, 50, 41, 28, 54, 35,  8,  0,  0 },
+   {  3, 37, 39, 23, 46, 38, 40, 20,  3,  0 },
+   {  5, 29, 27, 16, 24, 22, 21, 32,  5, 27 },
+   {  5, 21, 16, 17, 29,  4,  6,  7,  5, 21 },
+   {  1, 14, 12,  2,  6, 13, 25, 10,  1, 14 },
+   {  1, 10, 11,  2,  9, 26, 19, 14,  1, 10 }
+};
+
+int ascomPlan94v(int n, const double date1[], const double date2[],
+                 double pv[], int status[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m P l a n 9 4 v
+**  - - - - - - - - - - - - -
+**
+**  Approximate heliocentric position and velocity of all eight major
+**  planets (Mercury, Venus, EMB, Mars, Jupiter, Saturn, Uranus and
+**  Neptune) for an array of dates:  as iauPlan94.
+**
+**  Given:
+**     n       int        number of dates
+**     date1   double[n]  TDB date part A (as iauPlan94)
+**     date2   double[n]  TDB date part B
+**
+**  Returned:
+**     pv      double[48*n]  planet p,v (heliocentric, J2000.0, au,
+**                           au/d; Note 1)
+**     status  int[n]     status for each date (may be NULL):
+**                           0 = OK
+**                          +1 = warning: year outside 1000-3000
+**                          +2 = warning: failed to converge (any
+**                               planet)
+**
+**  Returned (function value):
+**             int        the largest status of any date
+**
+**  Notes:
+**
+**  1) The results are held by component (structure of arrays):
+**     component c (0-2 x,y,z, 3-5 xdot,ydot,zdot) of planet np (1-8,
+**     numbered as iauPlan94) at date i is pv[(6*(np-1)+c)*n+i].
+**
+**  2) The model, frame, accuracy and date conventions are those of
+**     iauPlan94, which see.  For np=3 the result is for the Earth-Moon
+**     barycenter.
+**
+**  3) The results agree with iauPlan94 to rounding error.
+**
+**  Called:  (none; see iauPlan94)
+*/
+{
+   int i0, nb, b, np, k, it, conv, worst;
+   int st[BLOCK];
+   double t[BLOCK], dmu[BLOCK], da[BLOCK], dl[BLOCK],
+          de[BLOCK], dp[BLOCK], di[BLOCK], dom[BLOCK], am[BLOCK],
+          ae[BLOCK], dae[BLOCK], sk[NK][BLOCK], ck[NK][BLOCK], *p;
+   double w, arg, ae2, at, r, v, si2, xq, xp, tl, xsw, xcw, xm2, xf,
+          ci2, xms, xmc, xpxq2, x, y, z;
+
+
+   worst = 0;
+   for ( i0 = 0; i0 < n; i0 += BLOCK ) {
+      nb = (n - i0 < BLOCK) ? n - i0 : BLOCK;
+
+   /* Time: Julian millennia since J2000.0; OK status unless remote date. */
+      for ( b = 0; b < nb; b++ ) {
+         t[b] = ((date1[i0+b] - DJ00) + date2[i0+b]) / DJM;
+         dmu[b] = 0.35953620 * t[b];
+         st[b] = fabs(t[b]) <= 1.0 ? 0 : 1;
+      }
+
+   /* The trigonometric terms, for all the planets. */
+      for ( k = 0; k < NK; k++ ) {
+         for ( b = 0; b < nb; b++ ) {
+            arg = km[k] * dmu[b];
+            sk[k][b] = sin(arg);
+            ck[k][b] = cos(arg);
+         }
+      }
+
+      for ( np = 0; np < 8; np++ ) {
+
+      /* Compute the mean elements. */
+         for ( b = 0; b < nb; b++ ) {
+            da[b] = a[np][0] +
+                   (a[np][1] +
+                    a[np][2] * t[b]) * t[b];
+            dl[b] = (3600.0 * dlm[np][0] +
+                             (dlm[np][1] +
+                              dlm[np][2] * t[b]) * t[b]) * DAS2R;
+            de[b] = e[np][0] +
+                  ( e[np][1] +
+                    e[np][2] * t[b]) * t[b];
+            w = fmod((3600.0 * pi[np][0] +
+                              (pi[np][1] +
+                               pi[np][2] * t[b]) * t[b]) * DAS2R, D2PI);
+            dp[b] = (fabs(w) >= DPI) ? w - dsign(D2PI, w) : w;
+            di[b] = (3600.0 * dinc[np][0] +
+                             (dinc[np][1] +
+                              dinc[np][2] * t[b]) * t[b]) * DAS2R;
+            w = fmod((3600.0 * omega[np][0] +
+                              (omega[np][1] +
+                               omega[np][2] * t[b]) * t[b]) * DAS2R, D2PI);
+            dom[b] = (fabs(w) >= DPI) ? w - dsign(D2PI, w) : w;
+         }
+
+      /* Apply the trigonometric terms. */
+         for ( k = 0; k < 8; k++ ) {
+            for ( b = 0; b < nb; b++ ) {
+               da[b] += (ca[np][k] * ck[ip[np][k]][b] +
+                         sa[np][k] * sk[ip[np][k]][b]) * 1e-7;
+               dl[b] += (cl[np][k] * ck[iq[np][k]][b] +
+                         sl[np][k] * sk[iq[np][k]][b]) * 1e-7;
+            }
+         }
+         for ( b = 0; b < nb; b++ ) {
+            da[b] += t[b] * (ca[np][8] * ck[ip[np][8]][b] +
+                             sa[np][8] * sk[ip[np][8]][b]) * 1e-7;
+         }
+         for ( k = 8; k < 10; k++ ) {
+            for ( b = 0; b < nb; b++ ) {
+               dl[b] += t[b] * (cl[np][k] * ck[iq[np][k]][b] +
+                                sl[np][k] * sk[iq[np][k]][b]) * 1e-7;
+            }
+         }
+
+      /* Starting value for the eccentric anomaly. */
+         for ( b = 0; b < nb; b++ ) {
+            dl[b] = fmod(dl[b], D2PI);
+            am[b] = dl[b] - dp[b];
+            ae[b] = am[b] + de[b] * sin(am[b]);
+         }
+
+      /* Newton iterations for Kepler's equation, until all have converged. */
+         for ( it = 0; it < KMAX; it++ ) {
+            conv = 1;
+            for ( b = 0; b < nb; b++ ) {
+               dae[b] = (am[b] - ae[b] + de[b] * sin(ae[b])) /
+                                              (1.0 - de[b] * cos(ae[b]));
+               ae[b] += dae[b];
+               conv &= (fabs(dae[b]) <= 1e-12);
+            }
+            if ( conv ) break;
+         }
+
+         p = pv + (size_t) (6 * np) * n + i0;
+         for ( b = 0; b < nb; b++ ) {
+            if ( !(fabs(dae[b]) <= 1e-12) ) st[b] = 2;
+
+         /* True anomaly. */
+            ae2 = ae[b] / 2.0;
+            at = 2.0 * atan2(sqrt((1.0 + de[b]) / (1.0 - de[b])) * sin(ae2),
+                                                                cos(ae2));
+
+         /* Distance (au) and speed (radians per day). */
+            r = da[b] * (1.0 - de[b] * cos(ae[b]));
+            v = GK * sqrt((1.0 + 1.0 / amas[np]) / (da[b] * da[b] * da[b]));
+
+            si2 = sin(di[b] / 2.0);
+            xq = si2 * cos(dom[b]);
+            xp = si2 * sin(dom[b]);
+            tl = at + dp[b];
+            xsw = sin(tl);
+            xcw = cos(tl);
+            xm2 = 2.0 * (xp * xcw - xq * xsw);
+            xf = da[b] / sqrt(1  -  de[b] * de[b]);
+            ci2 = cos(di[b] / 2.0);
+            xms = (de[b] * sin(dp[b]) + xsw) * xf;
+            xmc = (de[b] * cos(dp[b]) + xcw) * xf;
+            xpxq2 = 2 * xp * xq;
+
+         /* Position (J2000.0 ecliptic x,y,z in au), rotated to equatorial. */
+            x = r * (xcw - xm2 * xp);
+            y = r * (xsw + xm2 * xq);
+            z = r * (-xm2 * ci2);
+            p[b] = x;
+            p[n+b] = y * COSEPS - z * SINEPS;
+            p[2*n+b] = y * SINEPS + z * COSEPS;
+
+         /* Velocity (J2000.0 ecliptic xdot,ydot,zdot in au/d), rotated to equatorial. */
+            x = v * (( -1.0 + 2.0 * xp * xp) * xms + xpxq2 * xmc);
+            y = v * ((  1.0 - 2.0 * xq * xq) * xmc - xpxq2 * xms);
+            z = v * (2.0 * ci2 * (xp * xms + xq * xmc));
+            p[3*n+b] = x;
+            p[4*n+b] = y * COSEPS - z * SINEPS;
+            p[5*n+b] = y * SINEPS + z * COSEPS;
+         }
+      }
+
+   /* Status. */
+      for ( b = 0; b < nb; b++ ) {
+         if ( status != NULL ) status[i0+b] = st[b];
+         if ( st[b] > worst ) worst = st[b];
+      }
+   }
+
+   return worst;
+
+}
@@ -0,0 +1,202 @@
+#include <stddef.h>
+#include "ASCOMSofa.h"
+#include "ASCOMSeries.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* iauS06 on the ASCOM series evaluator (ASCOMSeries.c). */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under   */
+/* license, and is not itself software provided by or endorsed by SOFA. The polynomial and the five series  */
+/* for s+XY/2 are those of the SOFA 2018-01-30 iauS06; the series are held by columns, one after another in */
+/* one table, and summed in one pass of ascomSeries with compensated summation in place of iauS06's plain   */
+/* term by term sums.                                                                                       */
+
+/* Polynomial coefficients */
+static const double sp[] = {
+
+/* 1-6 */
+       94.00e-6,
+     3808.65e-6,
+     -122.68e-6,
+   -72574.11e-6,
+       27.98e-6,
+       15.62e-6
+};
+
+/* Terms of order t^0 to t^4:  first term, one past the last */
+#define NS0 0
+#define NS1 33
+#define NS2 36
+#define NS3 61
+#define NS4 65
+#define NS 66
+
+/* Multipliers of l, l', F, D, Om, LVe, LE, pA */
+static const signed char m[8][NS] = {
+
+   /* l */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,
+        2,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  0,  1,  0,  1,  0,
+        1,  1,  1,  1,  2,  2,  0,  2,  2,  1,  0,  0,  0,  0,  0,  0 },
+
+   /* l' */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* F */
+   {    0,  0,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  2,  2,  4,  1,  2,  2,  2,  2,  2, -2, -2,  0,  0,
+       -2,  2,  0,  0,  4,  2, -2, -2,  0,  0,  2,  0,  2,  2,  0,  0,  0,  2,  2,  2, -2,  0,  2, -2,  0,
+        0, -2,  0,  2,  0, -2,  2,  2,  0,  2,  2,  0,  2,  2,  0,  0 },
+
+   /* D */
+   {    0,  0, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0, -2, -2, -4, -1,  0,  0,  0,  0, -2,  2,  2,  0,  2,
+        0, -2, -2, -2, -2, -2,  0,  0,  0,  0, -2,  0, -2,  0,  0,  0,  0, -2,  0,  0,  2, -2, -2,  0,  2,
+        0, -2,  0,  0, -2,  0,  2,  0,  0, -2,  0,  0, -2,  0,  0,  0 },
+
+   /* Om */
+   {    1,  2,  3,  1,  2,  3,  1,  3,  1, -1, -1,  1,  3,  1,  4,  1,  0,  2,  3,  1,  0, -3, -1,  0,  0,
+       -1,  2,  1, -1,  4,  4, -3, -1,  2,  1,  3,  1,  2,  2,  2,  0,  0,  2,  1,  2, -2,  0,  1, -2,  0,
+        1, -2, -1,  1,  0, -1,  2,  2,  0,  2,  0,  1,  2,  2,  2,  1 },
+
+   /* LVe */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0,  0,  8,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* LE */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,-13,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* pA */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+};
+
+/* Sine coefficients */
+static const double ss[NS] = {
+
+   /* 1-48 */
+      -2640.73e-6,   -63.53e-6,   -11.75e-6,   -11.21e-6,     4.57e-6,    -2.02e-6,
+         -1.98e-6,     1.72e-6,     1.41e-6,     1.26e-6,     0.63e-6,     0.63e-6,
+         -0.46e-6,    -0.45e-6,    -0.36e-6,     0.24e-6,    -0.32e-6,    -0.28e-6,
+         -0.27e-6,    -0.26e-6,     0.21e-6,    -0.19e-6,    -0.18e-6,     0.10e-6,
+         -0.15e-6,     0.14e-6,     0.14e-6,    -0.14e-6,    -0.14e-6,    -0.13e-6,
+          0.11e-6,    -0.11e-6,    -0.11e-6,    -0.07e-6,     1.73e-6,     0.00e-6,
+        743.52e-6,    56.91e-6,     9.84e-6,    -8.85e-6,    -6.38e-6,    -3.07e-6,
+          2.23e-6,     1.67e-6,     1.30e-6,     0.93e-6,     0.68e-6,    -0.55e-6,
+
+   /* 49-66 */
+          0.53e-6,    -0.27e-6,    -0.27e-6,    -0.26e-6,    -0.25e-6,     0.22e-6,
+         -0.21e-6,     0.20e-6,     0.17e-6,     0.13e-6,    -0.13e-6,    -0.12e-6,
+         -0.11e-6,     0.30e-6,    -0.03e-6,    -0.01e-6,     0.00e-6,    -0.26e-6
+};
+
+/* Cosine coefficients */
+static const double sc[NS] = {
+
+   /* 1-48 */
+        0.39e-6,   0.02e-6,  -0.01e-6,  -0.01e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,
+        0.01e-6,   0.01e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.12e-6,
+        0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,  -0.05e-6,
+        0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,
+        0.00e-6,   3.57e-6,  -0.03e-6,   0.48e-6,  -0.17e-6,   0.06e-6,  -0.01e-6,   0.01e-6,
+       -0.05e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,
+
+   /* 49-66 */
+        0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,
+        0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6,   0.00e-6, -23.42e-6,  -1.46e-6,  -0.25e-6,
+        0.23e-6,  -0.01e-6
+};
+
+/* w0 to w4 */
+static const ascomSERIES S = {
+   NS, 8, &m[0][0], 13, NULL, NULL, 5,
+   { { NS0, NS1, ss + NS0, sc + NS0 },
+     { NS1, NS2, ss + NS1, sc + NS1 },
+     { NS2, NS3, ss + NS2, sc + NS2 },
+     { NS3, NS4, ss + NS3, sc + NS3 },
+     { NS4, NS,  ss + NS4, sc + NS4 } }
+};
+
+double ascomS06(double date1, double date2, double x, double y)
+/*
+**  - - - - - - - - -
+**   a s c o m S 0 6
+**  - - - - - - - - -
+**
+**  The CIO locator s, given the CIP's X,Y coordinates, compatible with
+**  IAU 2006/2000A precession-nutation:  as iauS06.
+**
+**  Given:
+**     date1,date2   double    TT as a 2-part Julian Date
+**     x,y           double    CIP coordinates
+**
+**  Returned (function value):
+**                   double    the CIO locator s in radians
+**
+**  Notes:
+**
+**  1) The model and the date conventions are those of iauS06, which
+**     see.
+**
+**  2) The series are summed by ascomSeries, with compensated summation.
+**     The result agrees with iauS06 to its rounding error.
+**
+**  Called:
+**     iauFal03     mean anomaly of the Moon
+**     iauFalp03    mean anomaly of the Sun
+**     iauFaf03     mean argument of the latitude of the Moon
+**     iauFad03     mean elongation of the Moon from the Sun
+**     iauFaom03    mean longitude of the Moon's ascending node
+**     iauFave03    mean longitude of Venus
+**     iauFae03     mean longitude of Earth
+**     iauFapa03    general accumulated precession in longitude
+**     ascomSeries  evaluate a Poisson/Fourier series
+*/
+{
+   double t, fa[8], w[5];
+
+
+/* Interval between fundamental epoch J2000.0 and current date (JC). */
+   t = ((date1 - DJ00) + date2) / DJC;
+
+/* Fundamental Arguments (from IERS Conventions 2003) */
+
+/* Mean anomaly of the Moon. */
+   fa[0] = iauFal03(t);
+
+/* Mean anomaly of the Sun. */
+   fa[1] = iauFalp03(t);
+
+/* Mean longitude of the Moon minus that of the ascending node. */
+   fa[2] = iauFaf03(t);
+
+/* Mean elongation of the Moon from the Sun. */
+   fa[3] = iauFad03(t);
+
+/* Mean longitude of the ascending node of the Moon. */
+   fa[4] = iauFaom03(t);
+
+/* Mean longitude of Venus. */
+   fa[5] = iauFave03(t);
+
+/* Mean longitude of Earth. */
+   fa[6] = iauFae03(t);
+
+/* General precession in longitude. */
+   fa[7] = iauFapa03(t);
+
+/* Evaluate s. */
+   ascomSeries(&S, fa, 0.0, w);
+
+   return (sp[0] + w[0] +
+          (sp[1] + w[1] +
+          (sp[2] + w[2] +
+          (sp[3] + w[3] +
+          (sp[4] + w[4] +
+           sp[5] * t) * t) * t) * t) * t) * DAS2R - x*y/2.0;
+
+}
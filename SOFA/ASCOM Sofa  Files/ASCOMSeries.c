@@ -0,0 +1,245 @@
+#include <stddef.h>
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "ASCOMSeries.h"
+
+/* Series evaluator for the ASCOM ports of the long SOFA series (nutation, CIP X,Y, s, the equation of the */
+/* equinoxes complementary terms, TDB-TT).                                                                 */
+
+/* The SOFA routines each walk their table term by term: build the argument, call sin and cos, add into a   */
+/* plain double. Here the tables are held by columns and taken a block of terms at a time. The arguments   */
+/* for the block are built one fundamental argument at a time (a multiply-add across the block per         */
+/* argument), then the sines and cosines for the block in one loop, so the compiler can use vector (and    */
+/* fused sin/cos) library calls. The terms of a sum within a block are added pairwise, and the block sums  */
+/* are accumulated with Neumaier's compensated summation, so the result hardly depends on the order of the */
+/* terms and keeps the bits a plain sum of several hundred terms of mixed size drops, while the            */
+/* summation stays cheap beside the terms themselves.                                                      */
+
+/* In the harmonics mode a series with integer multipliers only (all but TDB-TT) makes no trigonometric     */
+/* calls per term. The sines and cosines of k times each fundamental argument, up to the largest multiplier */
+/* in the table, are built once per call by the angle-addition recurrence from one sine and cosine per      */
+/* argument, and each term's sine and cosine is the product, by angle addition, of the harmonics its        */
+/* multipliers select. The error of a term grows with the sum of its multipliers, to around 1e-14 of its    */
+/* amplitude at worst, far below the 1e-14 radians allowed against the library path.                        */
+
+/* Terms per block (the working set stays in the L1 cache) */
+#define BLOCK 64
+
+/* Current mode (ascomSeriesMode) */
+static int mode = ASCOM_SERIES_LIBM;
+
+int ascomSeriesMode(int newmode)
+/*
+**  - - - - - - - - - - - - - - - -
+**   a s c o m S e r i e s M o d e
+**  - - - - - - - - - - - - - - - -
+**
+**  Select how the series of ascomNut00a, ascomXy06, ascomS06 and
+**  ascomEect00 are evaluated.
+**
+**  Given:
+**     newmode  int   ASCOM_SERIES_LIBM:  sin and cos of each term's
+**                    argument (the default)
+**                    ASCOM_SERIES_HARMONICS:  each term built from
+**                    harmonics of the fundamental arguments
+**                    anything else:  no change
+**
+**  Returned (function value):
+**              int   the mode before the call
+**
+**  Notes:
+**
+**  1) The two modes agree to far better than 1e-14 radians.  The
+**     harmonics mode is the faster where sin and cos are not
+**     vectorized.
+**
+**  2) The mode is global to the library.  Set it before the series
+**     routines are used from more than one thread.
+**
+**  3) ascomDtdb is unaffected:  its frequencies are not integer
+**     combinations of a few arguments.
+*/
+{
+   int old = mode;
+
+
+   if ( newmode == ASCOM_SERIES_LIBM || newmode == ASCOM_SERIES_HARMONICS ) mode = newmode;
+   return old;
+
+}
+
+void ascomSeries(const ascomSERIES *ser, const double fa[], double x, double sum[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m S e r i e s
+**  - - - - - - - - - - - -
+**
+**  Evaluate a Poisson/Fourier series held in an ascomSERIES table.
+**
+**  Given:
+**     ser    ascomSERIES*  the series (see ASCOMSeries.h)
+**     fa     double[]      fundamental arguments (radians, ser->nfa of
+**                          them; may be NULL if ser->nfa is zero)
+**     x      double        multiplier of the frequencies (e.g. time)
+**
+**  Returned:
+**     sum    double[]      the ser->nout sums
+**
+**  Notes:
+**
+**  1) The argument of each term is built without reduction to 0-2pi;
+**     the multipliers and fundamental arguments of the SOFA series keep
+**     it within a few hundred radians, where the sine and cosine lose
+**     nothing to the reduction.
+**
+**  2) A sum is the Neumaier compensated sum of pairwise sums of its
+**     terms, a block at a time.
+**
+**  3) In the harmonics mode (see ascomSeriesMode), a series with
+**     multipliers but no frequencies or phases, and within the limits
+**     ASCOM_SERIES_MAXFA and ASCOM_SERIES_MAXK, has its sines and
+**     cosines built from harmonics of the fundamental arguments.
+*/
+{
+   int n, i0, nb, b, j, k, lo, hi, np, h, needs, needc, harm, nz;
+   const signed char *m;
+   const double *s, *c, *hsj, *hcj;
+   double *hsk, *hck;
+   double f, t, arg[BLOCK], sa[BLOCK], ca[BLOCK], p[BLOCK];
+   double acc[ASCOM_SERIES_MAXOUT], cmp[ASCOM_SERIES_MAXOUT];
+   double hs[ASCOM_SERIES_MAXFA][2*ASCOM_SERIES_MAXK+1],
+          hc[ASCOM_SERIES_MAXFA][2*ASCOM_SERIES_MAXK+1];
+
+
+   n = ser->n;
+
+/* Harmonics sin(k*fa), cos(k*fa) for k = -kmax to +kmax, if used. */
+   harm = ( mode == ASCOM_SERIES_HARMONICS && ser->m != NULL &&
+            ser->fr == NULL && ser->ph == NULL &&
+            ser->nfa <= ASCOM_SERIES_MAXFA && ser->kmax <= ASCOM_SERIES_MAXK );
+   if ( harm ) {
+      for ( j = 0; j < ser->nfa; j++ ) {
+         hsk = hs[j] + ASCOM_SERIES_MAXK;
+         hck = hc[j] + ASCOM_SERIES_MAXK;
+         hsk[0] = 0.0;
+         hck[0] = 1.0;
+         if ( ser->kmax > 0 ) {
+            hsk[1] = sin(fa[j]);
+            hck[1] = cos(fa[j]);
+         }
+         for ( k = 2; k <= ser->kmax; k++ ) {
+            hsk[k] = hsk[k-1] * hck[1] + hck[k-1] * hsk[1];
+            hck[k] = hck[k-1] * hck[1] - hsk[k-1] * hsk[1];
+         }
+         for ( k = 1; k <= ser->kmax; k++ ) {
+            hsk[-k] = -hsk[k];
+            hck[-k] = hck[k];
+         }
+      }
+   }
+
+   needs = needc = 0;
+   for ( k = 0; k < ser->nout; k++ ) {
+      acc[k] = 0.0;
+      cmp[k] = 0.0;
+      if ( ser->out[k].s != NULL ) needs = 1;
+      if ( ser->out[k].c != NULL ) needc = 1;
+   }
+
+   for ( i0 = 0; i0 < n; i0 += BLOCK ) {
+      nb = (n - i0 < BLOCK) ? n - i0 : BLOCK;
+
+   /* Harmonics mode:  angle addition, one fundamental argument at a */
+   /* time across the block, skipping arguments the block never uses. */
+      if ( harm ) {
+         for ( b = 0; b < nb; b++ ) {
+            sa[b] = 0.0;
+            ca[b] = 1.0;
+         }
+         for ( j = 0; j < ser->nfa; j++ ) {
+            m = ser->m + (size_t) j * n + i0;
+            nz = 0;
+            for ( b = 0; b < nb; b++ ) nz |= m[b];
+            if ( !nz ) continue;
+            hsj = hs[j] + ASCOM_SERIES_MAXK;
+            hcj = hc[j] + ASCOM_SERIES_MAXK;
+            for ( b = 0; b < nb; b++ ) {
+               t = sa[b] * hcj[m[b]] + ca[b] * hsj[m[b]];
+               ca[b] = ca[b] * hcj[m[b]] - sa[b] * hsj[m[b]];
+               sa[b] = t;
+            }
+         }
+      } else {
+
+      /* Arguments, one fundamental argument at a time across the block. */
+         if ( ser->ph != NULL ) {
+            for ( b = 0; b < nb; b++ ) arg[b] = ser->ph[i0+b];
+         } else {
+            for ( b = 0; b < nb; b++ ) arg[b] = 0.0;
+         }
+         if ( ser->fr != NULL ) {
+            for ( b = 0; b < nb; b++ ) arg[b] += ser->fr[i0+b] * x;
+         }
+         if ( ser->m != NULL ) {
+            for ( j = 0; j < ser->nfa; j++ ) {
+               m = ser->m + (size_t) j * n + i0;
+               f = fa[j];
+               for ( b = 0; b < nb; b++ ) arg[b] += (double) m[b] * f;
+            }
+         }
+
+      /* Sines and cosines together, or only the one used. */
+         if ( needs && needc ) {
+            for ( b = 0; b < nb; b++ ) {
+               sa[b] = sin(arg[b]);
+               ca[b] = cos(arg[b]);
+            }
+         } else if ( needs ) {
+            for ( b = 0; b < nb; b++ ) sa[b] = sin(arg[b]);
+         } else {
+            for ( b = 0; b < nb; b++ ) ca[b] = cos(arg[b]);
+         }
+      }
+
+   /* The terms of each sum that fall in this block. */
+      for ( k = 0; k < ser->nout; k++ ) {
+         lo = ser->out[k].i1 - i0;
+         hi = ser->out[k].i2 - i0;
+         if ( lo < 0 ) lo = 0;
+         if ( hi > nb ) hi = nb;
+         if ( lo >= hi ) continue;
+         np = hi - lo;
+         j = i0 - ser->out[k].i1 + lo;
+         s = ser->out[k].s;
+         c = ser->out[k].c;
+         if ( s != NULL && c != NULL ) {
+            for ( b = 0; b < np; b++ ) p[b] = s[j+b] * sa[lo+b] + c[j+b] * ca[lo+b];
+         } else if ( s != NULL ) {
+            for ( b = 0; b < np; b++ ) p[b] = s[j+b] * sa[lo+b];
+         } else if ( c != NULL ) {
+            for ( b = 0; b < np; b++ ) p[b] = c[j+b] * ca[lo+b];
+         } else {
+            continue;
+         }
+
+      /* Pairwise sum of these terms. */
+         while ( np > 1 ) {
+            h = np / 2;
+            for ( b = 0; b < h; b++ ) p[b] += p[np-h+b];
+            np -= h;
+         }
+
+      /* Neumaier summation of the block sums. */
+         t = acc[k] + p[0];
+         if ( fabs(acc[k]) >= fabs(p[0]) ) {
+            cmp[k] += (acc[k] - t) + p[0];
+         } else {
+            cmp[k] += (p[0] - t) + acc[k];
+         }
+         acc[k] = t;
+      }
+   }
+
+   for ( k = 0; k < ser->nout; k++ ) sum[k] = acc[k] + cmp[k];
+
+}
@@ -0,0 +1,36 @@
+/* Series evaluator shared by the ASCOM ports of the SOFA series routines (ASCOMSeries.c) */
+
+/* Internal to the SOFA DLLs: not exported. */
+
+#pragma once
+
+/* Most sums from one series */
+#define ASCOM_SERIES_MAXOUT 10
+
+/* Most fundamental arguments, and largest multiplier, for the harmonics mode */
+#define ASCOM_SERIES_MAXFA 14
+#define ASCOM_SERIES_MAXK 24
+
+/* A Poisson/Fourier series held by columns (structure of arrays). The argument of term i is      */
+/*                                                                                                */
+/*    ph[i] + fr[i]*x + m[0][i]*fa[0] + m[1][i]*fa[1] + ... + m[nfa-1][i]*fa[nfa-1]              */
+/*                                                                                                */
+/* and sum k adds s[k][i]*sin(argument) + c[k][i]*cos(argument) over terms i1 to i2-1. Any of the */
+/* ph, fr, m, s and c arrays may be NULL if not used; s and c are indexed from term i1. kmax is    */
+/* the largest multiplier (in absolute value) in m.                                               */
+typedef struct {
+   int n;                       /* number of terms */
+   int nfa;                     /* number of fundamental arguments */
+   const signed char *m;        /* multipliers, nfa rows of n */
+   int kmax;                    /* largest multiplier */
+   const double *fr;            /* frequencies (multiply x) */
+   const double *ph;            /* phases */
+   int nout;                    /* number of sums */
+   struct {
+      int i1, i2;               /* terms in this sum */
+      const double *s;          /* sine amplitudes */
+      const double *c;          /* cosine amplitudes */
+   } out[ASCOM_SERIES_MAXOUT];
+} ascomSERIES;
+
+void ascomSeries(const ascomSERIES *ser, const double fa[], double x, double sum[]);
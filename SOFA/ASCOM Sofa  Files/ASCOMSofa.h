@@ -0,0 +1,183 @@
+/* Header for the ASCOM additions to the SOFA library */
+
+/* These routines are ASCOM's own, not part of the IAU SOFA release. They are built into the SOFA DLLs */
+/* alongside the SOFA routines and call only published SOFA functions, so they carry over unchanged  */
+/* when a new SOFA release is dropped into the "Currrent Source Code" folder.                         */
+
+#pragma once
+#include "..\Currrent Source Code\sofa.h"
+
+/* Incremental star-independent astrometry context (ASCOMApco13.c) */
+typedef struct {
+   iauASTROM astrom;  /* current astrometry parameters */
+   double utc1;       /* UTC of the last full rebuild (quasi JD, part 1) */
+   double utc2;       /* UTC of the last full rebuild (quasi JD, part 2) */
+   double ut11;       /* UT1 of the last full rebuild (JD, part 1) */
+   double ut12;       /* UT1 of the last full rebuild (JD, part 2) */
+   double pmt0;       /* astrom.pmt at the last full rebuild (Julian years) */
+   double eo;         /* equation of the origins (ERA-GST, radians) */
+   double dut1;       /* site and ambient parameters as given to iauApco13 */
+   double elong;
+   double phi;
+   double hm;
+   double xp;
+   double yp;
+   double phpa;
+   double tc;
+   double rh;
+   double wl;
+   double maxdt;      /* largest step with only an Earth rotation update (s) */
+   double rate;       /* error growth of an Earth rotation update (radians/s) */
+   int status;        /* iauApco13 status at the last full rebuild */
+   int nfull;         /* number of full rebuilds */
+   int nera;          /* number of Earth rotation updates */
+} ascomASTROMCTX;
+
+EXPORT int ascomApco13Init(double maxdt, double utc1, double utc2, double dut1,
+                           double elong, double phi, double hm, double xp, double yp,
+                           double phpa, double tc, double rh, double wl,
+                           ascomASTROMCTX *ctx, double *eo);
+EXPORT int ascomApco13Advance(double utc1, double utc2, ascomASTROMCTX *ctx,
+                              double *eo, double *err);
+
+/* Horizon/equatorial arrays at one site (ASCOMHd2ae.c) */
+EXPORT void ascomHd2aev(int n, double phi, const double ha[], const double dec[],
+                        double az[], double el[], double pa[]);
+EXPORT void ascomAe2hdv(int n, double phi, const double az[], const double el[],
+                        double ha[], double dec[]);
+
+/* Geocentric/geodetic arrays on one ellipsoid (ASCOMGc2gd.c) */
+EXPORT int ascomGc2gdv(int n, int nell, const double xyz[][3],
+                       double elong[], double phi[], double height[]);
+EXPORT int ascomGc2gdev(int n, double a, double f, const double xyz[][3],
+                        double elong[], double phi[], double height[]);
+EXPORT int ascomGd2gcv(int n, int nell, const double elong[], const double phi[],
+                       const double height[], double xyz[][3]);
+EXPORT int ascomGd2gcev(int n, double a, double f, const double elong[],
+                        const double phi[], const double height[], double xyz[][3]);
+
+/* Ecliptic, equatorial and galactic arrays, matrices cached by epoch (ASCOMFrames.c) */
+#define ASCOM_FRAME_ICRS 0   /* ICRS RA,Dec */
+#define ASCOM_FRAME_ECL06 1  /* ecliptic of date, IAU 2006 (iauEqec06) */
+#define ASCOM_FRAME_LTECL 2  /* ecliptic of date, long-term model (iauLteqec) */
+#define ASCOM_FRAME_GAL 3    /* galactic (iauIcrs2g) */
+#define ASCOM_FRAME_CACHE 8  /* matrices held by a cache */
+typedef struct {
+   struct {
+      int frame;             /* ASCOM_FRAME_ECL06 or ASCOM_FRAME_LTECL */
+      double date1;          /* TT (JD, part 1) */
+      double date2;          /* TT (JD, part 2) */
+      double rm[3][3];       /* ICRS to the frame */
+   } m[ASCOM_FRAME_CACHE];
+   int n;                    /* entries in use */
+   int next;                 /* entry to fill next (the oldest when full) */
+   long hits;                /* matrices found in the cache */
+   long misses;              /* matrices built */
+} ascomFRAMECACHE;
+
+EXPORT void ascomFrameInit(ascomFRAMECACHE *cache);
+EXPORT int ascomFrameMat(ascomFRAMECACHE *cache, int from, int to,
+                         double date1, double date2, double rm[3][3]);
+EXPORT int ascomFramev(ascomFRAMECACHE *cache, int from, int to,
+                       double date1, double date2, int n,
+                       const double a1[], const double b1[], double a2[], double b2[]);
+
+/* The "13" astrometry routines for lists of targets at one date and site (ASCOMAtco13.c) */
+EXPORT int ascomAtco13v(int n, const double rc[], const double dc[],
+                        const double pr[], const double pd[],
+                        const double px[], const double rv[],
+                        double utc1, double utc2, double dut1,
+                        double elong, double phi, double hm, double xp, double yp,
+                        double phpa, double tc, double rh, double wl,
+                        double aob[], double zob[], double hob[],
+                        double dob[], double rob[], double *eo);
+EXPORT void ascomAtci13v(int n, const double rc[], const double dc[],
+                         const double pr[], const double pd[],
+                         const double px[], const double rv[],
+                         double date1, double date2,
+                         double ri[], double di[], double *eo);
+EXPORT int ascomAtio13v(int n, const double ri[], const double di[],
+                        double utc1, double utc2, double dut1,
+                        double elong, double phi, double hm, double xp, double yp,
+                        double phpa, double tc, double rh, double wl,
+                        double aob[], double zob[], double hob[],
+                        double dob[], double rob[]);
+EXPORT int ascomAtoc13v(int n, const char *type,
+                        const double ob1[], const double ob2[],
+                        double utc1, double utc2, double dut1,
+                        double elong, double phi, double hm, double xp, double yp,
+                        double phpa, double tc, double rh, double wl,
+                        double rc[], double dc[]);
+EXPORT void ascomAtic13v(int n, const double ri[], const double di[],
+                         double date1, double date2,
+                         double rc[], double dc[], double *eo);
+EXPORT int ascomAtoi13v(int n, const char *type,
+                        const double ob1[], const double ob2[],
+                        double utc1, double utc2, double dut1,
+                        double elong, double phi, double hm, double xp, double yp,
+                        double phpa, double tc, double rh, double wl,
+                        double ri[], double di[]);
+
+/* Time scale arrays (ASCOMUtctt.c) */
+EXPORT int ascomDtf2dv(const char *scale, int n, const int iy[], const int im[],
+                       const int id[], const int ihr[], const int imn[],
+                       const double sec[], double d1[], double d2[], int j[]);
+EXPORT int ascomUtcttv(int n, const double utc1[], const double utc2[],
+                       double tt1[], double tt2[], int j[]);
+EXPORT int ascomTtutcv(int n, const double tt1[], const double tt2[],
+                       double utc1[], double utc2[], int j[]);
+
+/* Approximate planetary positions, all planets over arrays of dates (ASCOMPlan94.c) */
+EXPORT int ascomPlan94v(int n, const double date1[], const double date2[],
+                        double pv[], int status[]);
+
+/* Catalog proper motion (ASCOMStarpm.c) */
+#define ASCOM_PM_SAFE 1    /* guard small parallaxes, as iauPmsafe */
+#define ASCOM_PM_LINEAR 2  /* linear model in RA and Dec */
+EXPORT int ascomStarpmv(int n, int flags, int nthreads,
+                        const double ra1[], const double dec1[],
+                        const double pmr1[], const double pmd1[],
+                        const double px1[], const double rv1[],
+                        double ep1a, double ep1b, double ep2a, double ep2b,
+                        double ra2[], double dec2[],
+                        double pmr2[], double pmd2[],
+                        double px2[], double rv2[], int status[]);
+
+/* SOFA series routines on a compensated-summation series evaluator (ASCOMSeries.c) */
+#define ASCOM_SERIES_LIBM 0       /* sin and cos of every term's argument */
+#define ASCOM_SERIES_HARMONICS 1  /* terms built from harmonics of the fundamental arguments */
+EXPORT int ascomSeriesMode(int mode);
+EXPORT void ascomNut00a(double date1, double date2, double *dpsi, double *deps);
+EXPORT void ascomXy06(double date1, double date2, double *x, double *y);
+EXPORT double ascomS06(double date1, double date2, double x, double y);
+EXPORT double ascomEect00(double date1, double date2);
+EXPORT double ascomDtdb(double date1, double date2,
+                        double ut, double elong, double u, double v);
+
+/* TDB-TT for arrays of dates (ASCOMDtdb.c), and from a table over an interval (ASCOMDtdbTab.c) */
+#define ASCOM_DTDB_NCOEF 12    /* Chebyshev coefficients per series and segment */
+#define ASCOM_DTDB_MAXSEG 128  /* most segments in a table */
+typedef struct {
+   double date1;      /* start of the interval (TDB, JD part 1) */
+   double date2;      /* start of the interval (TDB, JD part 2) */
+   double days;       /* length of the interval (days) */
+   double seg;        /* length of a segment (days) */
+   double elong;      /* site, as given to ascomDtdb */
+   double u;
+   double v;
+   double tol;        /* largest error allowed (s) */
+   double err;        /* largest error found when the table was checked (s) */
+   int nseg;          /* number of segments */
+   double coef[ASCOM_DTDB_MAXSEG][3][ASCOM_DTDB_NCOEF];  /* per segment: geocentric part and v terms, */
+                                                       /* sin and cos factors of the u terms        */
+} ascomDTDBTAB;
+
+EXPORT void ascomDtdbv(int n, const double date1[], const double date2[],
+                       const double ut[], double elong, double u, double v,
+                       double dtdb[]);
+EXPORT int ascomDtdbTabInit(double date1, double date2, double days, double tol,
+                            double elong, double u, double v, ascomDTDBTAB *tab);
+EXPORT int ascomDtdbTab(const ascomDTDBTAB *tab, double date1, double date2,
+                        double ut, double *dtdb);
+EXPORT int ascomDtdbTabv(const ascomDTDBTAB *tab, int n, const double date1[],
+                         const double date2[], const double ut[], double dtdb[]);
@@ -0,0 +1,480 @@
+#include <math.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Catalog-level proper motion: iauStarpm / iauPmsafe for whole arrays of stars between one pair of epochs. */
+
+/* The stars are taken in blocks. Each stage of the SOFA chain (iauStarpv, the light-time corrected move along */
+/* track, iauPvstar) runs across the block in structure-of-arrays form with selects in place of branches, so    */
+/* the compiler can vectorize it; only the relativistic iteration of iauStarpv, which stops on convergence,    */
+/* runs star by star. The arithmetic follows the SOFA routines step by step. Large arrays are split into chunks */
+/* over worker threads.                                                                                         */
+
+/* Stars per block (the working set stays in the L1 cache) */
+#define BLOCK 64
+
+/* Fewest stars worth handing to a thread */
+#define MINCHUNK 4096
+
+/* Most threads used */
+#define MAXTHREADS 64
+
+/* As iauStarpv: smallest allowed parallax, largest allowed speed (fraction of c), most iterations */
+#define PXMIN 1e-7
+#define VMAX 0.5
+#define IMAX 100
+
+/* As iauPmsafe: smallest parallax (arcsec), and factor giving a transverse speed of about 1% c */
+#define SAFE_PXMIN 5e-7
+#define SAFE_F 326.0
+
+/* One chunk of work */
+typedef struct {
+   int n;
+   int flags;
+   const double *ra1, *dec1, *pmr1, *pmd1, *px1, *rv1;
+   double dt;
+   double *ra2, *dec2, *pmr2, *pmd2, *px2, *rv2;
+   int *status;
+   int nbad;
+} CHUNK;
+
+static void linear(CHUNK *c)
+/*
+**  Linear model: RA and Dec move at their catalog rates, everything
+**  else is unchanged.
+*/
+{
+   int i;
+   double dty, a, w;
+
+
+   dty = c->dt / DJY;
+   for ( i = 0; i < c->n; i++ ) {
+      a = c->ra1[i] + c->pmr1[i] * dty;
+      w = fmod(a, D2PI);
+      c->ra2[i] = (w < 0.0) ? w + D2PI : w;
+      c->dec2[i] = c->dec1[i] + c->pmd1[i] * dty;
+      c->pmr2[i] = c->pmr1[i];
+      c->pmd2[i] = c->pmd1[i];
+      c->px2[i] = c->px1[i];
+      c->rv2[i] = c->rv1[i];
+      c->status[i] = 0;
+   }
+   c->nbad = 0;
+}
+
+static void block(CHUNK *c, int i0, int nb)
+/*
+**  Full space motion model for stars i0 to i0+nb-1 (nb <= BLOCK), as
+**  iauStarpm, or iauPmsafe if ASCOM_PM_SAFE is set.
+*/
+{
+   double px[BLOCK], p0[BLOCK], p1[BLOCK], p2[BLOCK],
+          v0[BLOCK], v1[BLOCK], v2[BLOCK],
+          x0[BLOCK], x1[BLOCK], x2[BLOCK],
+          betsr[BLOCK], betst[BLOCK], d[BLOCK], del[BLOCK];
+   int jpx[BLOCK], iwarn[BLOCK];
+   int i, k, safe;
+   double dt, w, r, rd, rad, decd, st, ct, sp, cp, rcp, x, y, z, rpd, v,
+          vsr, vst, u0, u1, u2, bett, betr, dd, ddel, odd, oddel, od, odel,
+          tl1, tl2, q0, q1, q2, r2, rdv, vv, c2mv2, vr, vt, a0, a1, a2,
+          ss, cs, xd, yd, zd, rxy2, rxy, rtrue, rw, xyp, theta, phi, td, pd;
+   const double *ra1, *dec1, *pmr1, *pmd1, *px1, *rv1;
+
+
+   ra1 = c->ra1 + i0;
+   dec1 = c->dec1 + i0;
+   pmr1 = c->pmr1 + i0;
+   pmd1 = c->pmd1 + i0;
+   px1 = c->px1 + i0;
+   rv1 = c->rv1 + i0;
+   safe = (c->flags & ASCOM_PM_SAFE) != 0;
+   dt = c->dt;
+
+/* iauPmsafe: override small parallaxes (iauSeps of one year's motion, inline). */
+   for ( i = 0; i < nb; i++ ) {
+      cp = cos(dec1[i]);
+      a0 = cos(ra1[i]) * cp;
+      a1 = sin(ra1[i]) * cp;
+      a2 = sin(dec1[i]);
+      cp = cos(dec1[i] + pmd1[i]);
+      u0 = cos(ra1[i] + pmr1[i]) * cp;
+      u1 = sin(ra1[i] + pmr1[i]) * cp;
+      u2 = sin(dec1[i] + pmd1[i]);
+      q0 = a1*u2 - a2*u1;
+      q1 = a2*u0 - a0*u2;
+      q2 = a0*u1 - a1*u0;
+      ss = sqrt(q0*q0 + q1*q1 + q2*q2);
+      cs = a0*u0 + a1*u1 + a2*u2;
+      w = ((ss != 0.0) || (cs != 0.0)) ? atan2(ss, cs) : 0.0;
+      w *= SAFE_F;
+      k = 0;
+      px[i] = px1[i];
+      if (px[i] < w) {k = 1; px[i] = w;}
+      if (px[i] < SAFE_PXMIN) {k = 1; px[i] = SAFE_PXMIN;}
+      jpx[i] = safe ? k : 0;
+      px[i] = safe ? px[i] : px1[i];
+   }
+
+/* iauStarpv: catalog to pv-vector, and its radial and transverse parts. */
+   for ( i = 0; i < nb; i++ ) {
+      iwarn[i] = (px[i] >= PXMIN) ? 0 : 1;
+      w = (px[i] >= PXMIN) ? px[i] : PXMIN;
+      r = DR2AS / w;
+      rd = DAYSEC * rv1[i] * 1e3 / DAU;
+      rad = pmr1[i] / DJY;
+      decd = pmd1[i] / DJY;
+
+   /* iauS2pv. */
+      st = sin(ra1[i]);
+      ct = cos(ra1[i]);
+      sp = sin(dec1[i]);
+      cp = cos(dec1[i]);
+      rcp = r * cp;
+      x = rcp * ct;
+      y = rcp * st;
+      rpd = r * decd;
+      w = rpd*sp - cp*rd;
+      p0[i] = x;
+      p1[i] = y;
+      p2[i] = r * sp;
+      v0[i] = -y*rad - w*ct;
+      v1[i] =  x*rad - w*st;
+      v2[i] = rpd*cp + sp*rd;
+
+   /* If excessive velocity, arbitrarily set it to zero. */
+      v = sqrt(v0[i]*v0[i] + v1[i]*v1[i] + v2[i]*v2[i]);
+      k = (v / DC > VMAX);
+      v0[i] = k ? 0.0 : v0[i];
+      v1[i] = k ? 0.0 : v1[i];
+      v2[i] = k ? 0.0 : v2[i];
+      iwarn[i] += k ? 2 : 0;
+
+   /* Radial and transverse components of the velocity (iauPn etc.). */
+      w = sqrt(p0[i]*p0[i] + p1[i]*p1[i] + p2[i]*p2[i]);
+      r = (w != 0.0) ? 1.0/w : 0.0;
+      x0[i] = r * p0[i];
+      x1[i] = r * p1[i];
+      x2[i] = r * p2[i];
+      vsr = x0[i]*v0[i] + x1[i]*v1[i] + x2[i]*v2[i];
+      u0 = v0[i] - vsr*x0[i];
+      u1 = v1[i] - vsr*x1[i];
+      u2 = v2[i] - vsr*x2[i];
+      vst = sqrt(u0*u0 + u1*u1 + u2*u2);
+      betsr[i] = vsr / DC;
+      betst[i] = vst / DC;
+   }
+
+/* iauStarpv: inertial-to-observed relativistic correction, star by star. */
+   for ( i = 0; i < nb; i++ ) {
+      bett = betst[i];
+      betr = betsr[i];
+      dd = odd = oddel = od = odel = 0.0;
+      for (k = 0; k < IMAX; k++) {
+         d[i] = 1.0 + betr;
+         w = betr*betr + bett*bett;
+         del[i] = - w / (sqrt(1.0 - w) + 1.0);
+         betr = d[i] * betsr[i] + del[i];
+         bett = d[i] * betst[i];
+         if (k > 0) {
+            dd = fabs(d[i] - od);
+            ddel = fabs(del[i] - odel);
+            if ((k > 1) && (dd >= odd) && (ddel >= oddel)) break;
+            odd = dd;
+            oddel = ddel;
+         }
+         od = d[i];
+         odel = del[i];
+      }
+      if (k >= IMAX) iwarn[i] += 4;
+   }
+
+/* iauStarpv inertial velocity, iauStarpm move along track, iauPvstar back to catalog form. */
+   for ( i = 0; i < nb; i++ ) {
+
+   /* Inertial space velocity. */
+      w = (betsr[i] != 0.0) ? d[i] + del[i] / betsr[i] : 1.0;
+      vsr = x0[i]*v0[i] + x1[i]*v1[i] + x2[i]*v2[i];
+      u0 = vsr*x0[i];
+      u1 = vsr*x1[i];
+      u2 = vsr*x2[i];
+      a0 = w*u0 + d[i]*(v0[i] - u0);
+      a1 = w*u1 + d[i]*(v1[i] - u1);
+      a2 = w*u2 + d[i]*(v2[i] - u2);
+
+   /* Light time when observed (days). */
+      tl1 = sqrt(p0[i]*p0[i] + p1[i]*p1[i] + p2[i]*p2[i]) / DC;
+
+   /* Geometric position at the "after" epoch, and the light time from it. */
+      q0 = p0[i] + (dt + tl1)*a0;
+      q1 = p1[i] + (dt + tl1)*a1;
+      q2 = p2[i] + (dt + tl1)*a2;
+      r2 = q0*q0 + q1*q1 + q2*q2;
+      rdv = q0*a0 + q1*a1 + q2*a2;
+      vv = a0*a0 + a1*a1 + a2*a2;
+      c2mv2 = DC*DC - vv;
+      k = (c2mv2 <= 0.0);
+      c2mv2 = k ? 1.0 : c2mv2;
+      tl2 = (-rdv + sqrt(rdv*rdv + c2mv2*r2)) / c2mv2;
+
+   /* Observed place at the "after" epoch. */
+      q0 = p0[i] + (dt + (tl1 - tl2))*a0;
+      q1 = p1[i] + (dt + (tl1 - tl2))*a1;
+      q2 = p2[i] + (dt + (tl1 - tl2))*a2;
+
+   /* iauPvstar: radial and transverse parts of the inertial velocity. */
+      r = sqrt(q0*q0 + q1*q1 + q2*q2);
+      w = (r != 0.0) ? 1.0/r : 0.0;
+      x = w*q0;
+      y = w*q1;
+      z = w*q2;
+      vr = x*a0 + y*a1 + z*a2;
+      u0 = vr*x;
+      u1 = vr*y;
+      u2 = vr*z;
+      a0 -= u0;
+      a1 -= u1;
+      a2 -= u2;
+      vt = sqrt(a0*a0 + a1*a1 + a2*a2);
+      bett = vt / DC;
+      betr = vr / DC;
+      dd = 1.0 + betr;
+      w = betr*betr + bett*bett;
+      k = k || (dd == 0.0) || (w > 1.0);
+      rw = (dd == 0.0 || w > 1.0) ? 0.0 : w;
+      ddel = - rw / (sqrt(1.0-rw) + 1.0);
+      w = (betr != 0) ? (betr - ddel) / (betr * dd) : 1.0;
+      rw = (dd != 0.0) ? 1.0/dd : 0.0;
+      xd = w*u0 + rw*a0;
+      yd = w*u1 + rw*a1;
+      zd = w*u2 + rw*a2;
+
+   /* iauPv2s. */
+      x = q0;
+      y = q1;
+      z = q2;
+      rxy2 = x*x + y*y;
+      r2 = rxy2 + z*z;
+      rtrue = sqrt(r2);
+      rw = rtrue;
+      x = (rtrue == 0.0) ? xd : x;
+      y = (rtrue == 0.0) ? yd : y;
+      z = (rtrue == 0.0) ? zd : z;
+      rxy2 = (rtrue == 0.0) ? x*x + y*y : rxy2;
+      r2 = (rtrue == 0.0) ? rxy2 + z*z : r2;
+      rw = (rtrue == 0.0) ? sqrt(r2) : rw;
+      rxy = sqrt(rxy2);
+      xyp = x*xd + y*yd;
+      theta = (rxy2 != 0.0) ? atan2(y, x) : 0.0;
+      phi = (rxy2 != 0.0 || z != 0.0) ? atan2(z, rxy) : 0.0;
+      td = (rxy2 != 0.0) ? (x*yd - y*xd) / rxy2 : 0.0;
+      pd = (rxy2 != 0.0) ? (zd*rxy2 - z*xyp) / (r2*rxy) : 0.0;
+      rd = (rw != 0.0) ? (xyp + z*zd) / rw : 0.0;
+
+   /* Catalog form (iauAnp for RA). */
+      w = fmod(theta, D2PI);
+      c->ra2[i0+i] = (w < 0) ? w + D2PI : w;
+      c->dec2[i0+i] = phi;
+      c->pmr2[i0+i] = td * DJY;
+      c->pmd2[i0+i] = pd * DJY;
+      c->px2[i0+i] = (rtrue != 0.0) ? DR2AS / rtrue : 0.0;
+      c->rv2[i0+i] = 1e-3 * rd * DAU / DAYSEC;
+
+   /* Status, as iauStarpm then iauPmsafe. */
+      k = (k || rtrue == 0.0) ? -1 : iwarn[i];
+      c->status[i0+i] = (k == -1) ? -1 : k + jpx[i];
+   }
+}
+
+static void chunk(CHUNK *c)
+/*
+**  One chunk, block by block.
+*/
+{
+   int i, nb;
+
+
+   if ( c->flags & ASCOM_PM_LINEAR ) {
+      linear(c);
+      return;
+   }
+   c->nbad = 0;
+   for ( i = 0; i < c->n; i += BLOCK ) {
+      nb = (c->n - i < BLOCK) ? c->n - i : BLOCK;
+      block(c, i, nb);
+   }
+   for ( i = 0; i < c->n; i++ ) {
+      c->nbad += (c->status[i] != 0);
+   }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker(LPVOID p)
+{
+   chunk((CHUNK *)p);
+   return 0;
+}
+#else
+static void *worker(void *p)
+{
+   chunk((CHUNK *)p);
+   return NULL;
+}
+#endif
+
+int ascomStarpmv(int n, int flags, int nthreads,
+                 const double ra1[], const double dec1[],
+                 const double pmr1[], const double pmd1[],
+                 const double px1[], const double rv1[],
+                 double ep1a, double ep1b, double ep2a, double ep2b,
+                 double ra2[], double dec2[],
+                 double pmr2[], double pmd2[],
+                 double px2[], double rv2[], int status[])
+/*
+**  - - - - - - - - - - - - -
+**   a s c o m S t a r p m v
+**  - - - - - - - - - - - - -
+**
+**  Star proper motion for an array of stars:  update the star catalog
+**  data for space motion from one epoch to another, as iauStarpm or
+**  iauPmsafe, or by a linear approximation.
+**
+**  Given:
+**     n       int        number of stars
+**     flags   int        ASCOM_PM_SAFE: guard small parallaxes, as
+**                        iauPmsafe (otherwise as iauStarpm);
+**                        ASCOM_PM_LINEAR: linear model (Note 3)
+**     nthreads int       threads to use: 0 = one per processor,
+**                        1 = the caller's thread only
+**     ra1     double[n]  right ascension (radians), before
+**     dec1    double[n]  declination (radians), before
+**     pmr1    double[n]  RA proper motion (radians/year), before
+**     pmd1    double[n]  Dec proper motion (radians/year), before
+**     px1     double[n]  parallax (arcseconds), before
+**     rv1     double[n]  radial velocity (km/s, +ve = receding), before
+**     ep1a    double     "before" epoch, part A (TDB, as iauStarpm)
+**     ep1b    double     "before" epoch, part B
+**     ep2a    double     "after" epoch, part A
+**     ep2b    double     "after" epoch, part B
+**
+**  Returned:
+**     ra2     double[n]  right ascension (radians), after
+**     dec2    double[n]  declination (radians), after
+**     pmr2    double[n]  RA proper motion (radians/year), after
+**     pmd2    double[n]  Dec proper motion (radians/year), after
+**     px2     double[n]  parallax (arcseconds), after
+**     rv2     double[n]  radial velocity (km/s, +ve = receding), after
+**     status  int[n]     status of each star, as iauStarpm or
+**                        iauPmsafe:
+**                          -1 = system error (should not occur)
+**                           0 = no warnings or errors
+**                           1 = distance overridden
+**                           2 = excessive velocity
+**                           4 = solution didn't converge
+**                        else = binary logical OR of the above warnings
+**
+**  Returned (function value):
+**             int        number of stars with a nonzero status
+**
+**  Notes:
+**
+**  1) Each star gets the results iauStarpm (or iauPmsafe) would give it,
+**     to within a few units in the last place; see t_ascom_sofa.  Where
+**     those routines leave the "after" values unset (status -1) the
+**     values returned here are not meaningful.
+**
+**  2) The output arrays must not overlap the input arrays.
+**
+**  3) The linear model moves RA and Dec at their catalog rates and
+**     leaves the other values unchanged, with status 0.  It ignores
+**     radial velocity, perspective acceleration and light time, and
+**     should be used only for short intervals and for stars away from
+**     the poles.
+**
+**  4) If worker threads cannot be started, the work is done on the
+**     caller's thread.
+**
+**  Called:  (none; see iauStarpm, iauPmsafe)
+*/
+{
+   CHUNK c[MAXTHREADS];
+   int i, nt, per, nbad;
+#ifdef _WIN32
+   HANDLE th[MAXTHREADS];
+   SYSTEM_INFO si;
+#else
+   pthread_t th[MAXTHREADS];
+   int started[MAXTHREADS];
+#endif
+
+
+/* How many threads. */
+   nt = nthreads;
+   if ( nt <= 0 ) {
+#ifdef _WIN32
+      GetSystemInfo(&si);
+      nt = (int)si.dwNumberOfProcessors;
+#else
+      nt = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+   }
+   if ( nt > n / MINCHUNK ) nt = n / MINCHUNK;
+   if ( nt > MAXTHREADS ) nt = MAXTHREADS;
+   if ( nt < 1 ) nt = 1;
+
+/* Split into chunks. */
+   per = (n + nt - 1) / nt;
+   for ( i = 0; i < nt; i++ ) {
+      int i0 = i * per;
+      c[i].n = (n - i0 < per) ? n - i0 : per;
+      c[i].flags = flags;
+      c[i].ra1 = ra1 + i0;
+      c[i].dec1 = dec1 + i0;
+      c[i].pmr1 = pmr1 + i0;
+      c[i].pmd1 = pmd1 + i0;
+      c[i].px1 = px1 + i0;
+      c[i].rv1 = rv1 + i0;
+      c[i].dt = (ep2a - ep1a) + (ep2b - ep1b);
+      c[i].ra2 = ra2 + i0;
+      c[i].dec2 = dec2 + i0;
+      c[i].pmr2 = pmr2 + i0;
+      c[i].pmd2 = pmd2 + i0;
+      c[i].px2 = px2 + i0;
+      c[i].rv2 = rv2 + i0;
+      c[i].status = status + i0;
+      c[i].nbad = 0;
+   }
+
+/* The first chunk on this thread, the rest on workers (or here if they fail). */
+   for ( i = 1; i < nt; i++ ) {
+#ifdef _WIN32
+      th[i] = CreateThread(NULL, 0, worker, &c[i], 0, NULL);
+      if ( th[i] == NULL ) chunk(&c[i]);
+#else
+      started[i] = (pthread_create(&th[i], NULL, worker, &c[i]) == 0);
+      if ( !started[i] ) chunk(&c[i]);
+#endif
+   }
+   if ( n > 0 ) chunk(&c[0]);
+   nbad = c[0].nbad;
+   for ( i = 1; i < nt; i++ ) {
+#ifdef _WIN32
+      if ( th[i] != NULL ) {
+         WaitForSingleObject(th[i], INFINITE);
+         CloseHandle(th[i]);
+      }
+#else
+      if ( started[i] ) pthread_join(th[i], NULL);
+#endif
+      nbad += c[i].nbad;
+   }
+
+   return nbad;
+}
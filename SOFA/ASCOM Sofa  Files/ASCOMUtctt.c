@@ -0,0 +1,154 @@
+#include <stddef.h>
+#include "ASCOMSofa.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* Array forms of the time scale steps SOFA.vb takes one date at a time (iauDtf2d, and UTC to TT and back       */
+/* through TAI), so that a list of time stamps crosses the P/Invoke boundary once. Each date is converted by the */
+/* SOFA routines exactly as a scalar call would, so the results are identical; the status of each date is       */
+/* returned beside it and the function value summarises them.                                                    */
+
+static int worst(int a, int b)
+/*
+**  The more serious of two SOFA status values:  the most negative if
+**  either is an error, otherwise the largest warning.
+*/
+{
+   if ( a < 0 || b < 0 ) return (a < b) ? a : b;
+   return (a > b) ? a : b;
+}
+
+int ascomDtf2dv(const char *scale, int n, const int iy[], const int im[],
+                const int id[], const int ihr[], const int imn[],
+                const double sec[], double d1[], double d2[], int j[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m D t f 2 d v
+**  - - - - - - - - - - - -
+**
+**  Calendar dates and times to 2-part Julian Dates for an array of
+**  dates in one time scale:  as iauDtf2d.
+**
+**  Given:
+**     scale  char[]     time scale ID (as iauDtf2d)
+**     n      int        number of dates
+**     iy,im,id int[n]   year, month, day in Gregorian calendar
+**     ihr,imn  int[n]   hour, minute
+**     sec    double[n]  seconds
+**
+**  Returned:
+**     d1,d2  double[n]  2-part Julian Date (unchanged for a date with an
+**                       error status)
+**     j      int[n]     status of each date, as iauDtf2d; may be NULL
+**
+**  Returned (function value):
+**            int        the most negative (error) status of any date,
+**                       or if none is negative the largest (warning)
+**
+**  Called:
+**     iauDtf2d     calendar date and time to 2-part Julian Date
+*/
+{
+   int i, js, jw;
+
+
+   jw = 0;
+   for ( i = 0; i < n; i++ ) {
+      js = iauDtf2d(scale, iy[i], im[i], id[i], ihr[i], imn[i], sec[i],
+                    &d1[i], &d2[i]);
+      if ( j != NULL ) j[i] = js;
+      jw = worst(jw, js);
+   }
+   return jw;
+
+}
+
+int ascomUtcttv(int n, const double utc1[], const double utc2[],
+                double tt1[], double tt2[], int j[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m U t c t t v
+**  - - - - - - - - - - - -
+**
+**  UTC to TT for an array of dates:  as iauUtctai followed by
+**  iauTaitt.
+**
+**  Given:
+**     n      int        number of dates
+**     utc1   double[n]  UTC as a 2-part quasi Julian Date (as
+**     utc2   double[n]  iauUtctai)
+**
+**  Returned:
+**     tt1    double[n]  TT as a 2-part Julian Date (unchanged for a
+**     tt2    double[n]  date with an error status)
+**     j      int[n]     status of each date, as iauUtctai:  +1 dubious
+**                       year, 0 OK, -1 unacceptable date; may be NULL
+**
+**  Returned (function value):
+**            int        -1 if any date is unacceptable, otherwise +1
+**                       if any year is dubious, otherwise 0
+**
+**  Called:
+**     iauUtctai    UTC to TAI
+**     iauTaitt     TAI to TT
+*/
+{
+   int i, js, jw;
+   double tai1, tai2;
+
+
+   jw = 0;
+   for ( i = 0; i < n; i++ ) {
+      js = iauUtctai(utc1[i], utc2[i], &tai1, &tai2);
+      if ( js >= 0 ) iauTaitt(tai1, tai2, &tt1[i], &tt2[i]);
+      if ( j != NULL ) j[i] = js;
+      jw = worst(jw, js);
+   }
+   return jw;
+
+}
+
+int ascomTtutcv(int n, const double tt1[], const double tt2[],
+                double utc1[], double utc2[], int j[])
+/*
+**  - - - - - - - - - - - -
+**   a s c o m T t u t c v
+**  - - - - - - - - - - - -
+**
+**  TT to UTC for an array of dates:  as iauTttai followed by
+**  iauTaiutc.
+**
+**  Given:
+**     n      int        number of dates
+**     tt1    double[n]  TT as a 2-part Julian Date
+**     tt2    double[n]
+**
+**  Returned:
+**     utc1   double[n]  UTC as a 2-part quasi Julian Date (as
+**     utc2   double[n]  iauTaiutc; unchanged for a date with an error
+**                       status)
+**     j      int[n]     status of each date, as iauTaiutc:  +1 dubious
+**                       year, 0 OK, -1 unacceptable date; may be NULL
+**
+**  Returned (function value):
+**            int        -1 if any date is unacceptable, otherwise +1
+**                       if any year is dubious, otherwise 0
+**
+**  Called:
+**     iauTttai     TT to TAI
+**     iauTaiutc    TAI to UTC
+*/
+{
+   int i, js, jw;
+   double tai1, tai2;
+
+
+   jw = 0;
+   for ( i = 0; i < n; i++ ) {
+      iauTttai(tt1[i], tt2[i], &tai1, &tai2);
+      js = iauTaiutc(tai1, tai2, &utc1[i], &utc2[i]);
+      if ( j != NULL ) j[i] = js;
+      jw = worst(jw, js);
+   }
+   return jw;
+
+}
@@ -0,0 +1,2153 @@
+#include <stddef.h>
+#include "ASCOMSofa.h"
+#include "ASCOMSeries.h"
+#include "..\Currrent Source Code\sofam.h"
+
+/* iauXy06 on the ASCOM series evaluator (ASCOMSeries.c). */
+
+/* This is a derived work: it uses routines and computations derived from software provided by SOFA under     */
+/* license, and is not itself software provided by or endorsed by SOFA. The polynomials, frequencies and      */
+/* amplitudes are those of the SOFA 2018-01-30 iauXy06, rearranged for ascomSeries. iauXy06 keeps a list of    */
+/* luni-solar and a list of planetary frequencies, with a variable number of amplitudes per frequency found    */
+/* through a pointer table. Here the 1309 frequencies are one table with all 14 fundamental-argument           */
+/* multipliers (zero for the planetary arguments of the luni-solar terms), in order of decreasing number of    */
+/* amplitudes, and the amplitudes are one column per X or Y, sine or cosine and power of t. A frequency with   */
+/* no amplitude in a column has zero there; a column for a power of t covers only the frequencies that have    */
+/* amplitudes of that power, which are at the start of the table. The luni-solar and planetary sums of         */
+/* iauXy06 become one compensated sum per column.                                                              */
+
+/* Maximum power of T in the polynomials for X and Y */
+#define MAXPT 5
+
+/* Polynomial coefficients (arcsec, X then Y). */
+static const double xyp[2][MAXPT+1] = {
+
+   {    -0.016617,
+      2004.191898,
+        -0.4297829,
+        -0.19861834,
+         0.000007578,
+         0.0000059285
+   },
+   {    -0.006951,
+        -0.025896,
+       -22.4072747,
+         0.00190059,
+         0.001112526,
+         0.0000001358
+   }
+};
+
+/* Number of frequencies; those with amplitudes in t^1, t^2, t^3, t^4 */
+#define NF 1309
+#define NF1 305
+#define NF2 38
+#define NF3 5
+#define NF4 1
+
+/* Multipliers of l, l', F, D, Om, the planetary longitudes Me to Ne, and pA */
+static const signed char m[14][NF] = {
+
+   /* l */
+   {    0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  1,  1,  1,  1,  2,  0,  0,  2,  1,  1,  0,  1,  0,  1,
+        0,  0,  0,  1,  1,  1,  0,  2,  2,  0,  0,  0,  2,  1,  0,  0,  2,  2,  2,  0,  1,  1,  1,  0,  0,
+        1,  3,  1,  1,  2,  0,  1,  1,  1,  1,  1,  1,  1,  2,  3,  1,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  1,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  1,  0,  2,  0,  2,  0,  1,  2,  1,  1,  0,  1,  0,  1,  2,  1,  2,  1,  2,  1,
+        0,  3,  0,  1,  0,  1,  2,  0,  0,  0,  0,  0,  1,  1,  1,  0,  1,  1,  1,  3,  0,  1,  1,  0,  2,
+        0,  1,  1,  0,  1,  0,  2,  1,  1,  1,  0,  1,  1,  1,  1,  0,  1,  1,  1,  1,  4,  2,  0,  1,  2,
+        1,  3,  2,  0,  0,  0,  0,  0,  2,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  1,  1,  2,  2,  1,  0,
+        1,  0,  0,  2,  1,  0,  0,  0,  1,  0,  1,  2,  2,  1,  2,  2,  1,  0,  1,  1,  2,  0,  1,  0,  0,
+        0,  2,  1,  0,  0,  3,  1,  0,  2,  2,  0,  1,  3,  2,  0,  0,  1,  2,  0,  4,  3,  1,  2,  0,  0,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  1,  2,  1,  2,  2,  1,  1,  0,  1,  2,  0,  1,
+        2,  2,  1,  1,  0,  0,  1,  2,  1,  0,  1,  0,  0,  1,  2,  1,  1,  0,  1,  0,  2,  1,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  1,
+        0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,
+        0,  0,  0,  2,  0,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  1,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+        1,  0,  1,  1,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2,  2,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  1,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  3,  1,  2,  2,  3,  2,  1,  2,
+        1,  0,  1,  1,  2,  1,  1,  1,  2,  0,  4,  2,  1,  3,  2,  2,  1,  0,  0,  0,  3,  1,  1,  2,  1,
+        1,  2,  1,  4,  0,  1,  2,  2,  1,  1,  1,  0,  3,  0,  2,  2,  1,  2,  1,  1,  1,  2,  1,  2,  0,
+        2,  2,  0,  0,  0,  1,  1,  0,  1,  1,  3,  2,  1,  1,  2,  2,  0,  1,  1,  3,  1,  1,  1,  1,  0,
+        0,  2,  3,  2,  0,  2,  3,  2,  1,  2,  1,  3,  1,  1,  1,  2,  1,  0,  2,  5,  3,  1,  3,  1,  1,
+        0,  1,  0,  0,  3,  2,  3,  2,  4,  1,  1,  1,  1,  2,  3,  0,  3,  1,  0,  0,  1,  1,  0,  0,  0,
+        2,  0,  4,  2,  2,  1,  3,  2,  1,  1,  1,  0,  3,  1,  0,  1,  1,  0,  4,  2,  0,  1,  3,  3,  1,
+        1,  0,  0,  3,  1,  1,  2,  2,  2,  2,  1,  5,  1,  1,  0,  2,  2,  1,  1,  1,  0,  4,  3,  3,  2,
+        1,  1,  0,  3,  1,  1,  1,  0,  0,  2,  0,  4,  2,  2,  1,  1,  1,  1,  0,  2,  2,  2,  2,  2,  2,
+        1,  1,  1,  0,  0,  0,  0,  3,  2,  2,  2,  2,  2,  1,  1,  1,  0,  0,  4,  2,  4,  4,  2,  2,  2,
+        2,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  3,  3,  3,  3,  3,  3,  2,  2,  2,  2,  2,  2,  2,  2,
+        2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  4,  3,  3,  2,  2,  2,  2,  2,  2,  2,
+        1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  2,  2,  1,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,  2,  2,  1,  1,
+        0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  2,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  1,  0,
+        0,  0,  1,  1,  1,  1,  2,  1,  2,  1,  1,  1,  0,  1,  2,  1,  2,  1,  3,  3,  1,  1,  4,  2,  0,
+        1,  1,  0,  1,  0,  2,  0,  3,  3,  2,  1,  0,  4,  2,  1,  3,  2,  1,  1,  0,  0,  2,  1,  2,  1,
+        0,  0,  3,  2,  1,  1,  1,  1,  0,  0,  5,  3,  2,  1,  0,  3,  0,  0,  0,  0,  4,  3,  3,  2,  2,
+        2,  1,  1,  1,  0,  0,  5,  4,  4,  3,  3,  3,  3,  3,  3,  3,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+        2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,  0,
+        2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  1,  0,  2,  2,  1,  1,  0,  0,  2,  2,  1,  1,
+        1,  1,  1,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* l' */
+   {    0,  0,  0,  0,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0,  2,  0,
+        1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0, -1,  1,  1,
+        0,  0, -1,  1,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  1,  0,  0, -1,  2,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  1, -1, -1,  1, -1,  0, -1,  0,  1,  1,  0,  1, -1,
+        0, -1, -1,  0,  0,  3,  1,  1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  1,  0,  1,  1,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  1, -1,  1,
+        0,  1,  1,  0,  0,  1,  1,  0, -1,  0,  0,  0, -1,  1,  0,  0,  0,  1,  0,  0,  1,  0,  2,  3,  0,
+        0,  0,  1,  1,  0,  0,  1,  0, -2,  1,  2,  1,  0,  0,  0,  2, -1,  0,  0,  0,  0,  1,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  1, -1, -1,  2,  2,  0,  2,  0,
+        1, -1, -1, -1,  0,  2,  1, -1,  0,  0, -2,  0,  0,  0,  0,  0, -2,  0,  0,  2, -2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0, -1,  0,  0,
+        1,  2, -1, -1,  1,  0,  1,  0,  0,  2,  0,  1,  0, -1,  0,  0,  0,  1,  1,  1,  1,  1,  1, -1, -2,
+        0,  0,  1,  0,  1,  2,  0,  1,  0,  0, -1,  1,  0,  0,  0, -2,  0,  0,  0,  0, -1, -1, -1,  0,  0,
+       -1,  0,  0,  1,  1,  1,  0,  0,  0, -2,  0,  0,  1,  0, -1, -1,  1,  2,  0,  1,  0,  0, -2, -1,  0,
+        0,  1,  0,  0,  0, -1,  0,  1,  1,  1,  2,  0, -1,  0, -1,  1,  0,  2,  0,  0,  0, -1,  0,  0,  0,
+        1,  2,  1,  2,  0,  1, -1, -1,  0,  0,  0,  1,  1, -1,  0,  1,  0,  0,  1,  1, -1,  2,  0,  1,  1,
+       -1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  1,  0, -1,  1,  0,  0,  1,  0,  0, -1, -1,  0,
+       -2,  1,  1, -1,  0,  0,  1,  0,  0,  1, -2,  0,  2,  0,  0,  0, -2,  0, -2, -1,  0,  0,  0, -1,  0,
+        2,  1,  2,  1,  1,  1, -2,  1,  0,  2,  0,  0,  0, -1,  1,  1,  0,  0,  0,  1,  1,  0,  0,  0, -1,
+       -2, -2, -1,  2,  2,  1,  1,  0,  1,  0,  0, -2, -1,  0, -2, -2,  1,  0, -1,  2,  1, -1,  1,  1,  0,
+       -1,  1,  1,  0,  0, -1, -1, -1,  3,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2,
+       -1, -1,  1,  1,  1,  1,  0,  0,  0, -2, -2, -1,  2,  1,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0, -1,
+        2,  2,  0,  0,  0, -1, -1, -1, -1,  1,  2,  1,  2, -1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  2, -2,  0,  0,  0,  0,  1,  0,  1,  2, -1,  0,  1,  0,  1,  0, -2,  0,  1, -1, -1,  0,  2,  1,
+        1, -1,  0,  1,  2, -1,  0,  1,  0,  0,  0,  1,  0,  1, -1,  0,  0,  2, -1,  1,  1,  0,  1, -1,  3,
+        3,  0,  0, -2,  1,  1,  0, -1,  2,  0,  0,  0,  2, -1,  1,  0,  2,  0,  0,  0,  0,  0, -1,  1,  1,
+       -1,  0, -1, -1,  1,  0,  0,  1,  0,  1,  1,  1,  0,  0, -1, -1,  1,  1,  1,  1,  1,  0,  0,  0, -1,
+       -1,  3,  1,  1,  1,  1,  0,  0,  0,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* F */
+   {    0,  2,  2,  0,  0,  2,  0,  2,  2, -2,  2, -2,  0,  0,  2, -2,  2, -2,  2,  2, -2,  0,  0,  2,  0,
+        0,  2,  1, -2, -2,  0,  0,  0,  0,  2,  2,  0, -2,  2,  2, -2,  0,  2,  2,  0,  0,  0,  0, -1,  0,
+        0,  2,  2, -2,  0, -2,  2, -2,  2, -1, -2,  2,  0,  2,  0, -1,  1, -1,  0,  0,  1,  0,  0,  0,  0,
+        1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,
+        0,  0,  1,  0,  1,  0,  2,  0,  2,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2, -2,  0,  2, -2,  0, -2,  0,  0,  0,  2,  0, -2,  0, -2,  2, -2, -4,  2,  0,
+        2,  2,  4,  0,  2,  0, -2,  2, -2,  0,  2,  2,  0,  0,  0,  0,  2,  0, -2,  2,  2, -2,  2, -2,  2,
+        0,  2, -2,  0, -2,  2,  2,  0,  2,  0,  0, -2,  0,  2,  2,  2,  0, -2, -2,  2,  2,  2,  2,  4,  2,
+        2,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+        2,  0,  2,  0, -2,  0,  0,  0,  0,  2, -2, -2,  0,  0,  2, -2,  0,  0, -4,  0,  0,  2,  0,  0,  4,
+        2,  0, -2,  0,  0,  2, -2,  4,  0,  0,  0,  2,  0,  0,  2, -2,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0,  0,  2, -2,  0,  0,  2, -2,  2, -2,  0, -2,  0,  2,  2,
+        0, -2, -2,  0,  1, -2,  0,  0, -1,  2,  0,  1,  3,  1,  2,  1,  2,  3, -1, -2,  2,  3, -1,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  2,  2,  0,  1,  0,
+        0,  0,  2, -2,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  0,  1,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,
+        0,  0,  1,  1,  0,  0,  0,  1,  0,  0,  1,  0,  2,  2,  0, -1,  0,  0,  0,  2,  1,  0,  2,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,
+        2,  1,  0, -1,  0,  1,  0, -1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  1,  0,  0,
+        0,  0, -2,  0,  0, -1,  0,  0,  0,  0,  2,  1,  0,  0,  2,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  2,  0,  1,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  2, -2,  2,
+        2,  1,  1,  1,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+       -1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        1,  1,  1,  1,  1,  0,  0,  0,  1,  0,  0, -2, -1,  2,  2, -1,  2,  1,  1,  1,  1,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -4,  2,  0, -2,  0, -2, -2,  2, -2, -4,
+       -2,  2,  2,  0,  2,  2, -2,  0,  2,  0,  0, -2,  2,  2,  2,  0,  0,  0,  0,  0,  2,  2, -2,  2,  2,
+        2,  0,  2,  2,  2,  2,  2,  2,  2,  4,  2,  0, -2,  4, -4,  0,  2, -2, -2, -2,  0,  0,  0, -2,  0,
+        0,  4,  2,  4, -2,  0,  0,  4,  0, -2,  0,  2, -2, -2,  0,  0,  2,  0,  0,  2, -4,  2,  2, -2,  2,
+        2, -2, -2,  2,  0, -2,  2,  2,  2,  0,  0,  2, -2,  4,  2,  0,  0, -2, -2,  2, -2,  2,  0,  0, -4,
+        2,  2,  0,  0,  2, -2,  0, -2,  2, -2, -2,  0, -2, -2, -2, -2,  0, -2,  0, -2,  0, -2,  4,  2, -4,
+        2, -2,  2, -2,  0,  2,  0, -2,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2, -2,  0,  0,  0,  2,  2,  0,
+        2,  0, -2, -2,  0, -2,  0,  2, -4, -2,  0,  2, -2,  4,  4,  0,  2,  0, -2, -2,  2,  0,  2,  2,  2,
+        2,  0,  2,  2,  2,  0,  0,  0,  2,  2,  0,  2, -4, -2,  4,  2,  2,  0,  0,  2,  2,  2, -4, -2,  2,
+        2,  0,  0,  2, -2,  2,  0,  0, -2,  4,  0,  0,  2,  0,  0, -2,  4,  2,  2, -2,  2, -2,  0, -2,  0,
+       -2, -2, -2, -2, -2,  2,  0, -4, -2,  0,  4,  2,  4,  2,  0,  0, -2,  4,  2,  0,  0, -4, -2,  2,  0,
+        0,  0,  2,  0,  0, -2,  0, -4, -2,  2, -2, -2,  0,  2, -2, -2, -2, -2,  2,  0,  2,  2,  2,  0, -2,
+        2,  0,  4,  2,  2,  2,  2,  0, -2,  2,  0, -2,  0, -2,  2,  4,  0, -2,  0,  0,  0,  0,  0,  2,  0,
+        0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  2,  0,  2,  0,  0,  0,  0,  0,
+        2,  2,  0,  0,  2,  0,  0,  2, -2,  1,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0, -1,
+        2,  0,  0, -2,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  1,  1,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  0, -1,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  2,
+        2, -2,  0,  2, -2,  2,  0,  0,  0,  0,  0, -2,  2, -2, -2,  2,  0,  0, -2,  0,  2,  0,  0,  0,  2,
+        2, -2,  2, -2,  2,  0,  0,  0,  0, -2, -4,  0,  0,  0,  0,  2,  2,  0,  0,  0, -2,  0, -2,  0,  0,
+        0,  4, -2,  0,  2,  0,  2,  2,  0,  2,  0,  0,  0,  2,  0,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,
+        2,  2,  0, -2,  2,  2,  2,  2, -2,  2,  0, -2,  0, -2,  0,  0,  2,  2,  2,  0, -2,  0,  0, -2,  2,
+        0, -2,  0,  0, -2, -2,  2,  0,  0, -2,  0, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  1,  0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0, -2, -1,  2,  2,  2,  2,
+        1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* D */
+   {    0, -2,  0,  0,  0, -2,  0,  0,  0,  2, -2,  0,  0,  0,  0,  0,  2,  2,  0, -2,  0,  0, -2, -2, -2,
+        0,  0, -1, -2, -2, -2,  2, -2,  0,  0, -2,  0,  0,  2,  2,  0, -2, -2,  0,  2, -2,  2,  0,  1, -2,
+       -1,  0,  0, -2,  0, -2,  0,  2,  0,  0, -4,  2, -1,  2,  0,  0,  0,  0, -1,  0, -1,  0,  0,  0,  0,
+       -1, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, -2, -1,  0, -1,  0, -1,  0,  0,
+        0,  0, -1,  0, -1,  0, -2,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -1, -2,  0,  2, -2,  2, -2, -2,  0,  1,  0,  0,  0,  0,  1, -1,  2,  0, -2, -2, -4,  0, -2,  2,
+       -2, -2, -2, -4,  0, -2,  0,  0,  0,  0, -1,  4, -2, -1,  0,  0,  2,  2, -2,  0,  2, -2, -4, -2,  0,
+        2,  0,  0,  1, -2, -2,  0,  0,  0, -2,  1,  2,  0,  1, -1,  1, -2,  0, -4, -2,  0, -2,  1, -2,  2,
+        4,  2,  0,  0,  0,  0,  0,  0, -2,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0, -1, -4, -2, -2,  2,
+       -2,  2, -2,  2,  2, -2,  1,  4,  2,  2,  1, -2,  0,  0,  0, -4,  1,  2,  0, -4,  0, -3, -2,  0,  0,
+       -4, -2, -4, -2,  4, -2,  0, -2, -2, -2, -2,  2,  0, -4,  4, -2, -2,  2,  2, -2, -4, -4, -4,  0,  0,
+        0, -2,  0,  0,  0, -2,  0, -1,  0,  0,  0, -2, -1,  2, -4, -4, -4, -4,  2,  0,  0, -2, -2, -2,  0,
+       -2,  0, -2, -2, -1,  0,  2, -2,  0, -2, -2,  0,  0,  0, -4, -2, -2,  0,  0,  0, -2,  0, -2, -1,  0,
+        0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0, -1,  0, -1,  0,  0, -1,  0, -1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -1,  0, -1,  1, -1,  0,  0,  0, -1,  0,  0,  0,  0, -2,  0,  0, -1, -1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0, -2,  0, -1, -1,  0,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0, -1,  0, -1,  0, -2,  0,  0,  0,  0,  0,
+        0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0, -1,  0,  0,  0, -1,  0,  0,
+        0,  0, -1, -1,  0,  0,  0, -1,  0,  0, -1,  0,  0,  0,  0, -1,  0,  0,  0, -2, -1,  0, -2, -1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -1, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  1,
+       -2, -1,  0, -1,  0, -1,  0, -1, -1, -1, -1,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,  0, -1,  0,  0,
+        0, -1,  0,  0,  0,  1,  0,  0,  0,  0,  0, -1,  0,  0, -2, -2, -1, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -2, -1, -2,  0,  1, -2,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -4,  0,
+        2,  0,  0, -2,  0,  0, -1, -2,  0,  0,  0,  0, -1,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+       -1, -2, -2, -1,  0,  0,  0,  0,  0,  0, -1,  0, -1,  0,  0,  0, -1, -1,  0,  0,  0,  0,  0,  0,  0,
+       -2,  0, -1,  0,  0,  0,  0, -2,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0, -2,  0,  0,  0, -2, -2,  1,
+       -1, -1, -1, -1, -1,  0,  0,  0, -3, -2, -2,  0, -1,  0,  0,  1, -2, -1, -1, -1, -1, -1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  2,  0, -3,  0,  2,  0,  0, -1,  0,
+        1,  0, -2, -2,  0, -4,  0, -3, -1,  0,  0, -2,  1,  0, -2,  0,  4,  1,  2,  1,  0,  1,  2, -2,  0,
+       -3,  2, -4,  0,  1, -2,  1, -2, -1, -2, -2, -4, -2, -4, -2, -2, -2, -6,  1,  2,  2, -2,  2, -2,  4,
+        0, -2,  3, -2,  2,  2,  4,  0, -1, -2,  2, -4, -4, -6,  0,  2, -2, -2,  1, -2, -2,  4,  2, -4, -4,
+       -3,  0, -2,  4,  0, -2, -4,  2,  2,  0, -2,  2,  2,  0,  4,  0,  2, -2,  0,  0, -6, -1, -4,  1,  2,
+       -4,  0, -2, -2,  0, -4,  0,  0, -2,  4, -2, -2, -2, -4,  0, -2, -2, -3, -4,  1,  0, -2, -4,  4,  2,
+        2, -4,  2, -3, -6,  0, -4,  2, -2, -4, -4,  1,  2, -4,  2, -4,  0,  6, -2, -4,  3,  2,  2, -2, -1,
+       -2,  2, -1, -1, -6, -4, -4,  0,  0, -2,  0, -2, -4, -4, -1,  2,  0, -3,  0, -3, -2,  0, -1,  0, -1,
+       -2,  2,  0,  0,  1, -1, -2, -2,  0, -2,  1, -4,  2,  0, -2, -4,  3,  4,  4,  1, -4,  1, -2, -6, -1,
+        0, -2, -4,  2, -4,  3, -4, -2,  0, -2, -3, -2, -2, -6,  0, -2, -2,  3,  0, -4,  0, -2, -2, -6, -1,
+        2,  2, -3,  1,  0,  1,  0,  2, -2,  4,  2, -2, -2,  1,  2,  0,  2, -4, -3,  4, -3,  2, -2,  2, -2,
+        2,  2,  4,  1,  1, -6, -3, -2, -6,  2,  2, -4,  0, -4,  4,  0, -6, -1,  2,  2,  4, -6, -2, -6, -2,
+        0,  0,  0, -6, -4,  4, -3,  4,  1, -2,  0,  2, -2,  0, -4, -4,  3,  0,  0,  0,  0, -2,  0, -2,  0,
+        0,  0, -2,  0,  0,  0, -1, -2,  0,  0,  0,  0,  0,  0, -2,  0, -2, -2,  0, -2,  0,  0,  0,  0,  0,
+        0, -2,  0,  0, -2,  0,  0,  0, -2, -1,  0,  0,  0, -2, -2,  0,  0,  0,  0,  0,  0, -2, -2, -1, -1,
+       -2,  0,  0, -2, -2, -1, -1,  0,  0,  0,  0,  0,  0, -1, -2, -2, -2, -1, -1,  0,  0,  0,  0,  0,  0,
+        0, -1, -2, -2, -2, -2, -1,  0, -2, -2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  2,  0, -4,  1, -3, -3,  1, -1, -1,  0,  2, -1,  1,  2, -2,  1,  2,  0,  0,  0, -4, -2, -2,  0,
+        0,  0,  1,  0, -2, -4,  3, -4, -6, -4,  0, -1, -4,  2,  4, -2,  2, -4, -3,  4,  0,  4,  2, -1, -2,
+       -2, -2, -2,  0, -4, -3, -3, -2,  2,  4,  0, -3, -4,  2,  3, -2, -4, -4, -1,  6,  2, -1,  2,  1, -6,
+        0, -1,  1, -2,  2, -3,  0, -2, -2,  2, -2, -6,  0, -4, -3, -2,  0, -4, -2, -3,  0, -4, -4, -5,  4,
+       -2, -2,  0, -6,  1, -1,  1,  3, -4,  4, -1,  2, -4,  0,  0,  0,  0, -1,  0, -2,  0,  0,  0, -2,  0,
+       -2,  0, -2, -2,  0,  0,  0,  0,  0,  0, -2,  0,  0, -2,  0, -2, -2,  0, -1, -2,  0, -2, -2,  0,  0,
+        0, -2, -2, -2, -1,  2,  0,  0, -2, -2, -2, -2, -2,  0,  0, -2,  0,  0, -2, -2, -1,  2, -2, -2, -2,
+       -1, -1, -1, -1,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Om */
+   {    1,  2,  2,  2,  0,  2,  0,  1,  2, -2,  1, -2,  1, -1,  1, -1,  2, -2,  2,  2, -1,  1, -1,  2,  1,
+       -1,  2,  1, -2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1, -2, -1,  2,  1, -1,  0,  0,  0, -1,  0,
+        0,  2,  2, -2, -1, -2,  2, -1,  0, -1, -2,  1, -1,  2,  0, -2,  1,  0,  1,  0,  1,  0,  0,  1,  0,
+        1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,
+        0,  0,  1,  0,  1,  0,  0,  0,  2,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  1, -1,  1,  1, -2,  0,  0,  1,  0,  2,  2, -1, -1, -2, -2,  2, -2, -2,  1,  1,
+       -1,  2,  2,  0,  1, -1,  1, -1, -1,  2,  2,  2,  1, -2,  1, -2,  2, -1, -2,  1,  2, -1,  1, -1,  2,
+        2,  1, -2,  1,  0,  2,  2,  1,  1, -2, -1, -2, -1,  2,  2,  1,  2,  1, -1,  1,  2,  2,  2,  2,  1,
+        2,  2, -1,  0,  0,  0,  0,  0, -1,  0,  0,  1,  0,  1,  1, -1,  1,  1,  1,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  0, -1, -1,  0, -1,  0, -1,  0,  1, -1, -1,  0,  2,  0,  0,  2,
+        1, -2, -2, -1,  1,  1, -2,  1,  0, -1,  0,  2, -1, -1,  1, -2, -1,  1, -2,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  1, -1,  1,  1,  1, -2,  1, -1,  1, -2,  2,  1, -1,
+        1, -1, -1, -2,  1, -2,  0,  0, -3,  3,  0,  2,  3,  1,  0,  1,  1,  2,  1, -1,  2,  3, -1,  1,  0,
+        0,  0,  0,  0,  0,  0, -1,  0,  1,  0,  0,  0,  1,  0,  1,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  1,  0,  1,  1,  1,  0,  0,  0,  1,  0,  0,  0,  1,  1,  2,  0,  2, -1,
+        0,  0,  1, -1,  1,  0,  0,  2,  0,  0,  1,  1,  0,  0,  0,  1,  1,  0,  0,  0,  1,  0,  1,  1,  1,
+        0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  1,  0,  1,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,
+        0,  0,  1, -1,  0,  0,  0,  1,  1,  0,  2,  0,  2,  2,  0, -1,  0,  0,  0,  1,  1,  1,  1,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -1,  0, -1,  1,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  1, -1, -1,
+       -1,  2,  2, -2,  0,  1,  0, -1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  1,  2,  0,  0,  2,  0,  0,
+        0,  1, -2,  1,  0, -1,  0,  0,  0,  0,  1, -1,  1,  0,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,
+        0,  0, -1,  1,  1,  0,  1,  1,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  1,  2, -2,  3,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0, -2,  0,  2,  2,  0,  0,  2,  1,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2,  1,  1, -2,  2, -1, -1,  1, -2, -2,
+       -1,  2,  2,  1,  1,  2, -1,  0,  2, -1,  0, -2,  1,  2,  0, -2,  0,  1, -1, -1,  2,  2, -1,  2,  2,
+        1, -1,  1,  1,  1,  2,  2,  1,  1,  1,  1,  0, -2,  2, -2, -1, -1, -2, -2,  1, -1,  1,  1,  0, -1,
+        1,  2,  2,  2,  1,  1,  1,  1, -2, -2,  0,  2, -1, -2, -1,  0, -1, -1, -1,  2, -2,  1,  2, -2,  2,
+        1,  0, -1,  2,  3, -2,  2,  2,  1, -1,  1,  1, -2,  2,  2,  1,  2, -1,  2,  2, -2,  2, -1,  1, -1,
+        1,  2, -2,  1,  0, -1,  0,  0,  1, -1,  1, -2,  0, -2, -2,  0, -1, -1, -1, -1,  2, -1,  1,  2, -2,
+        1, -1,  2, -2,  0,  3,  1, -2,  2,  1, -2,  2,  1, -1, -1,  1,  2,  2, -1, -1,  1, -2,  2,  2,  2,
+        2,  2, -2, -2,  0,  0,  1, -1, -1, -1,  1,  2, -2,  2,  2,  2,  2,  1, -2, -2, -2, -1,  2,  1,  1,
+        1, -1,  1,  1,  1,  1, -1,  2, -2,  2, -2,  2, -2, -2,  2,  2,  2, -1,  2,  2,  1,  1, -1, -1,  2,
+        1,  1, -1,  2, -2,  2,  1,  1,  1,  1, -1,  1,  1, -1, -1, -1,  1,  1,  2, -2,  2, -2, -2, -2,  1,
+       -1, -2, -2,  1,  2,  2, -2, -2, -2,  1,  2,  1,  2,  2, -1,  2, -1,  2,  2,  1,  1, -1,  1,  2, -2,
+        1, -1,  2,  1, -1, -2, -1, -1, -1,  1, -1, -1,  2,  2, -1, -1, -1, -1,  1,  1,  1,  1, -1, -1, -1,
+        1,  1,  1,  1, -1,  1,  1,  1, -1,  3, -2, -3, -1,  1,  1,  2,  2, -3,  0,  0,  0,  1,  0,  1,  0,
+        0,  1,  1,  0,  0,  1,  1,  1,  0,  1,  0,  0,  1,  0, -2,  0, -1,  1,  1,  2,  0,  0,  0,  0,  0,
+        2,  1,  0,  0,  1,  0,  0,  2, -2,  2,  0,  0,  0, -2,  2,  2,  2,  1,  0,  0,  0, -1, -1, -1, -1,
+        1,  0,  0, -2,  2,  2,  2,  1,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,
+        0,  2,  1, -1,  1, -1, -1, -1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0, -2,  1, -1,  2,
+        2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  2,  0,  2,  0, -2, -2, -2,  0,  0,  0,  2,  0,  0, -2,  2, -2, -2,  2,
+        2, -2, -2,  0, -2, -2,  0,  0,  2, -2,  0, -1,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0, -2,  0,  2,  1,  1,  1,
+        2,  1,  0, -1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Me */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ve */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,  0,  0,  8,
+        0, -5,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  8,  5,  0,  0,  0,  3,  0,  0,  0,  8,  0,
+        2,-18,  0,  0, -5,-10, -5,  0,  0,  0,  0,  0,  0,  8,  0,  0,  1,  4,  0,  3,  8,  2,  0,  0,  0,
+        3, -3, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  3,  0,  4,  2,  1,  0,  0,  0,  0,  5,  8,  0,-18,  0,  0, -8,-18,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        2,  0,  0,  5,  0, -3,  0,  0,  0,  6,  1, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+        0,  4,  3,  2,  0,  0,  0,  0,  0,  0,  3,  3,  0,  0,  0,  0,  8, -3,  6,  0,  5,  0,  3,  0,  0,
+        1,  0,  2,  1,  0,  0,  2, -4,  0, -3,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  3,  0, -3,
+        0,  0,  0,  0,  0,  2,  1,  0,  0,  6, -3, -1,  0,  7,  6,  0, -2,  0,  0,  0, -6,  5,  3,  8,  0,
+        0,  0,  0,  0,  2,  2,  1,  3,  0,  7,  3,  0,  0,  0,  6,  0,  2,  2,  0, -8,  0,  0,  7,  4,  0,
+        3,  0,  0, -6,  0,  3,  3,  2,  0,  0,  0, -3,  0,  3, -5,  4,  0,  0,  0,  1,  9,  4, -2,  7,  0,
+        0,  0,  0,  0,  0,  5,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  5,  8,  0,  0,  3,  0,  0,  0,
+        0,  0,  0,  0,  8,  8,  4,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,-18,
+       -5,  0,  0,  0,  6,  0,  0,  0,  0,  1, -2,  5,  0,  9,  5,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,-10,  0,  1,  0,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, -5,  3,  5,  4,  3,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -8,  0,  0, -3,  7,  6,  6,  4,  0,  0,  0,  2, -2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0,  0, -6,  0,  0,  0,  4,  0,  0,  3,  5,  0, -5,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  3,  0,  5,  0, -8,  0,  5,  0,  4,  0,  0,  0,
+        0,  0,  0,  6,  0,  0,  1, 20,  5,  0,  2,  7,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,
+        3,  0,  0, -4, -3,  8,  3,  0, -6,  2,  0,  0,  0,  0,  0,  0,  0, -3, -1,  0,  0, -1, -1,  6,  5,
+        5,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+        9,  1, -4,  0,  0, -1, -2, -3,  0,  0,  0,  0,  3,  0,  0,  0,  0, -2,  0, -3,  0,  0,  6,  5,  0,
+        1,  0,  5,  2,  0,  3,  3, -1, -3,  0,  0,  0,  0, -3,  0,  0,  0,  2,  8,  0,  0,  0, -3,  0, 20,
+        0,  8,  0,  0,  0,  0, -5,  0,  4,  0,  0,  0,  0,  0,  0,  0, -5,  1,  0, -2,  7,  2,  1,  0,  0,
+        0, -8,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  5,  3,  1,  0,  0,  0,  0,  0,-10,-10,  2,
+       -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  4,  0,  5,  0,  6,  0,  7,  0,  0, -3,  8,
+        0,  0,  0, -3,  9,  0,  3,  0,  8,  0,  0,  3,  0,  2,  0,  0, -2, -1,  0,  0,  0,  0,  0,  1,  0,
+       -3,  1, -2, -4,  0,  0,  1,  0,  0,  0,  0,  0, -4,  1, -1, -3,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0, -4, -2, -5,  0, -2, -3,  9,  8,  8,  6,  6,  5,  4,  3,  3,  2,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* E */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  4,  1, -1,-13,
+       -1,  6,  3,  2,  6,  1, -3,  0, -4,  4,  0,  0,  0,  2,-13, -8,  0, -2, -1, -4, -1,  1,  0,-13,  0,
+       -1, 16, -1,  2,  7,  3,  6,  2,  1,  0,  4, -1,  8,-11,  0,  8, -1, -6,  2, -2,-15, -5,  3,  1,  3,
+       -5,  4,-21,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -5,  0, -6, -4,  1, -2,  1,  4, -2, -8,-13,  0, 16,  0,  0, 13, 16,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  8,
+       -2, -2,  2, -7,  4,  3,  0,  3,  1, -8, -3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -4,
+        6, -7, -7, -2,  0,  0, -2,  1,  1,  0, -5, -3, -2,  0, -1,  1,-10,  4, -9, -1, -7,  0, -3,  0,  4,
+       -1,  2, -3, -3,  5,  4, -3,  5,  4,  4,  1, -1,  1,  0,  4, -1, -4,  2,  1,  0, -9,  2, -6, -1,  4,
+        3,  0, -2, -1, -2,  1,  1,  1,  1,-10,  5,  0,  2,-10, -8, -9,  3,  1,  0,  2,  8, -5, -6,-14,  8,
+        2,  4, -3,  0,  0,  1,  2, -9,  0,-11, -5,  8, -2,  0, -6, -1, -2, -4,  3, 11,  5,  5, -9, -7,  2,
+       -3,  6,  2,  8,  3, -7, -1, -3, 11,  6,  3,  7,  5, -5,  6, -4,  4,  6, -1, -2,-12, -4,  3, -7,  3,
+        6, -4,  1,  0,  1, -6, -9, -1,  2,  0, -1,  0,  4, -4,  5, -1, -3,-10,-13,  2, -1, -5, -8, -1,  8,
+        5,  0,  7,  1, -8,-10, -2,  0, -5,  2,  3, -6,  4,  6,  4, -4,  6,  6,  3,  1,  1,  2, -8, -1, 17,
+        6, -1, -1, -1,-10, -1,  2, -1, -1, -2,  1, -8,  0,-11, -3,  1,  0, -2, -1, -1,  5,  2, -1,  5,  4,
+        2, -3,  3, -9, -4,  1, -4,  5,  1, -3,  1, -1,  1,  6,  4, -4, -1,  6, -4, -5, -5, -8,  7,  7,  3,
+        2,  1, -6,  3, -7,  3,  1, 11,  1, -1,  4,-11, -6, -4, -2,  7,  1,  2, -3,  3,  0, -1,  0,  0,  0,
+        0,  0,  0,  0, -2,  2, -1,  8,  2,  0,  8, -6, -1,  1, -1, -8,  3,  7,  2,  0,  1,  3,  0,  1,  4,
+        3, -6, -5, -1, -2,  4,  3,  5,  1, -1, -1,  3, -3,  0,  4, -7, -1, 12,  5, -3,  1, -2,  3,  2,  5,
+       -2,  6, -1, -7,  3,  5, -3,-21, -6,  9, -4, -8, -9, -4,  4,  1,  4, -4,-16,  6,  4,  0,  4, -4,  1,
+       -6, -2, -1,  5,  4, -9, -6,  0,  7, -5, -2,  5, -1,  4, -4,  1,  2,  4,  2,  1, -1,  0,  2, -9, -6,
+       -4, -5,  7,  6,  6,  3,  3,  2,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -9,  0, -2,  2, -2,  2,
+      -11, -1,  4,  3,  7,  1,  2,  3,  3,  1,  3,  2, -5,  1, -2,  1, -2,  2, -1,  3,  6,  1, -9, -9,  5,
+       -1, -2, -5, -6, -2, -6, -4,  1,  3,  0,  4,  0,  0,  3, -2,  1, -1, -2,-16,  0,  0, -2,  3, -2,-20,
+       -1,-12,  4, -2, -2, -1,  7,  2, -5,  4,  2,  1,  1, -1,  1, -3,  5, -3, -4,  2,-10, -5, -2,  3,  2,
+        1, 12, -5, -2, -2, -2, -3,  5, -4, -2,  1,  7,  2, -2, -6, -4, -4,  9,  4,  4,  4, -2,  3,  3, -2,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -4,  1, -5, -1, -6, -2, -7,  3,  1,  3, -8,
+       -2,  2, -2,  3, -9,  0, -5,  7,-12,  4,  1, -7, -2, -2,  0, -4,  2,  1, -2, -2,  3, -4, -2, -1, -1,
+        3, -1,  2,  4, -1, -1,  1,  0, -2, -2, -2, -2,  4, -1,  1,  3,  1, -2,  2,  1,  8,  2, -1, -2,-10,
+       -1,  6,  2,  7,  2,  2,  5,-13,-14,-11, -8, -7, -6, -8, -3, -1,  0, -1,  6,  6,  5,  5,  5,  5,  5,
+        5,  5,  3,  2,  1,  1,  1,  0,  0 },
+
+   /* Ma */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,  2,  0,
+        0,  0,  0, -8, -8, -2,  0,  0,  8, -8,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,  0,-16,  0,  0,-16,  0,  0, -4,  0,  0,  0,  0,  2, -2,
+        0,  0,  3, -4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,-16,
+        0,  0, -2,  0,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      -16,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  2,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+        0,  0,  0,  0, -4, -4,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0, -4, -2,  0, 13,  0,  0,  0,  0,
+       -6,  0,  0,  0,  4,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0, 15,  0, -4,  3,  0,  0,  0,  0,  0,-15,
+        0, -7,  4,  0,  0,  0,  0,  4,  0,  0,  4,-15,  2,  0,  0,  0,  0,  0,  0,  0, -9, -5,  0,  0,  0,
+        0,  0,  0,  0,  0,  4,  0,  0,  0,-15,  0, -4,  0,  0,  0,  0, -8,-11,  0,  0,  0,  0,  0,  0, -6,
+       -6,  0,  0, -2, -5,  0,  0,  0, -4,  0,  0,  0, -8,  8,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,-15,
+       -2,  0,-13,  0,  0,  0,  0,  0,  6, -5, -7,  8, -8, -5, -8,  8,  0, -7,  0,  0, -6,  0, 15,  0,  0,
+        0,  0,  2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8, -6,  0, -6, -8,
+       -7,  4,  0, 17,  0,  0,  0,-10,  0,  0,  0,  0,  0,-10, -8,  8,  0,  0,  0,  0,  0,  0, -9, -8,  0,
+        0,  0,  8, -7,  9, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0, -7,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -3,  0,-15,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0, -6,  0,  0, -6,
+       -7,  8,  6,  0,  0, -7, -8, -8,  0,  0,  0,  0,  4,  0, -5,  0,  0,  0, -9,  0,  0,  0,  0,  0, -8,
+        0,-11,  0,  0, -2, -7,  0,  0,  0,-17,  0,  0, 13,  0, -8,  0, -8,  8,  0, -9,  0,  0, -8,  8,  0,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -9,  0, -8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,-12, -8,-10, -9, -7,  0, -8,  0, -3,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, -4,
+        0,  0,  0,  0, -8,  0,  0,  0, -1,  0, -5,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0, -3,  0,  0, -3,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+        0,  0, -6,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0, -8, -4,
+        0,  0,  6,  0,  0,  0,  4,  0,  4,  0, -4,-13,  0,  2,  0,  0,  0,-17, -8, -8, -7,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,-13,  0, -4,  0,  4,  0,  0,  2,  8,  0,  0,  2,  0,  0,  4,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,-15,  0,  0,  0, 15,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0, -9, -4,  0, -9, -8, -7, -6,
+      -16,-13,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* Ju */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  3, -1,  0,  0,
+        2,  0, -1,  3,  3,  0,  0,  0, -3,  3,  2,  0,  2, -2,  0,  0,  2,  3, -1,  0,  0, -2,  0,  0,  1,
+        0,  0,  2,  1,  0,  0,  0, -1,  0,  0,  3,  0,  4,  0,  3,  4,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  2,  0,  0,  0,  2,  1,  0,  3,  0,  0, -2,  0,  2,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
+        0,  2,  0,  0, -2,  0,  0,  3, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        4,  0,  0,  0,  1,  1,  3,  2,  0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  2,  0,  0,  0,  0, -3,
+        0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0, -4, -4,  2,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,
+        0,  3,  3,  0,  0,  0,  0,  0,  3,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0, -3, -3,  0,  0,  0,  0,  0, -2,
+        0,  0,  2,  0,  2,  0,  0,  0,  0,  0,  1,  0, -2,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  4,  3, -3, -3,  3,  0,  0,  0,  0,  0,  0,  0, -1,  0,
+        0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  3, -3,  0,  0,  0, -1,  0, -2,  0,  2,  0,
+        0,  1,  0,  2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0, -2,  0,  0, -1,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0, -1, -2,  0,  3, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  2,  0,  0,  0,
+        0,  0,  0,  0,  0, -3, -1,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0, -1,  2,  2,  0,  0,  0,  0,
+        0,  0,  0, -1,  3,  0,  3,  3,  0,  0, -2, -3,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0, -2, -4,  0,
+        4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  3, -3, -2,  0,  0,  0,  3, -3,  0,
+        0,  0,  1,  0,  0,  0,  0,  3,  0,  0,  5,  0,  3,  3, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,
+        0,  0,  0,  0,  3,  0,  0,  0,  0, -1,  0, -4,  2,  0,  2,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  4,  0,  0,  2, -1,  1,  0,  0,  0,  0,  4,  0,  0,  0,
+        1,  0,  0,  3,  2,  0,  0,  0,  0, -4, -5, -5, -2,  1, -1,  3,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+        0,  0,  0,  3,  2,  2,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  3,  3,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  0,  0,  0,  0,
+        3,  0,  3,  0,  0,  2,  2,  0,  0,  0, -1,  0,  2,  0,  0, -3,  0,  0,  0,  2, -4,  0,  2,  0,  1,
+        0,  0,  0,  0,  0,  1,  0,  2,  3,  1,  0,  0,  0,  0,  0,  0, -1,  3, -2, -1,  0, -2,  0,  1,  0,
+        0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0, -4,  0,  3,  0,  0,
+        4,  0, -5,  2,  1,  0, -3,  2,  0 },
+
+   /* Sa */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0,
+       -5,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0, -5,  0,  0,  0, -1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,
+        0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0, -5,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  5,
+        0,  0, -5,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  3,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0, -2,  5,  0,  0,  0,  0,  5,
+        0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -2,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0, -2,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -3,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -5,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,
+        0,  0,  0,  5,  0,  0,  0, -3,  5,  2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0, -2, -5,  0,  0,  0,  0,  0,  0,  0,  5,  0, -5,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -1, -2,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+        0,  0,  0,  0,  1,  0,  0, -2,  0,  5,  5,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        5,  0,  0,  0, -5, -3,  5, -6,  0 },
+
+   /* Ur */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  3,  0 },
+
+   /* Ne */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0 },
+
+   /* pA */
+   {    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0, -1,
+        0,  0,  2, -2,  2,  0,  0,  2,  0,  0,  0,  0,  1,  0,  0, -2,  1,  0,  0,  0,  0,  0,  0, -2,  0,
+        2,  0,  0,  2,  0,  0,  0,  2,  0,  1,  0,  0, -2, -2,  2,  2, -1, -1,  0,  2, -2, -2,  2,  2,  2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -2,  2, -2, -2,  2,  0,  2,  2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -2,  2,  0,  2,  0, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+       -2, -2, -2, -1,  1, -1,  0,  2,  0,  2, -1,  2,  0,  1,  0, -1, -2,  0, -2,  0, -1, -1, -1,  2,  2,
+        1,  1,  0, -1,  2,  2, -1,  0,  2,  0,  0,  0, -2, -2,  2,  0, -1, -1,  1,  0,  0,  0, -2,  0,  0,
+       -2,  1,  0,  0,  0,  2,  1,  0, -2, -2,  0,  0,  1, -2, -1,  0,  0, -2,  2,  2,  0, -1,  0,  0,  0,
+        2, -2,  0,  0,  1,  1,  2, -2,  1, -2,  2, -2,  0,  2, -1,  0,  1,  0,  2,  0, -2,  2, -1, -1,  2,
+        1,  2,  2,  0,  2,  0,  1, -2,  2, -2,  2,  0,  2,  1,  0,  2, -2, -2,  0,  1, -2,  1,  0, -1, -1,
+        2, -2,  0,  0, -2,  2, -1,  0,  0,  1,  0,  2,  0,  0,  2,  0,  2, -2,  1,  0,  0,  0,  0,  0, -1,
+        2,  2, -2,  2, -1, -1,  1,  2,  0, -2,  0,  0, -2,  2,  0,  0,  1,  2,  2,  1, -2,  2,  0,  0,  0,
+        0,  0,  0,  0, -1,  0,  2,  0,  0,  0,  0,  0,  0, -1,  1, -1,  1, -2,  0,  0, -2, -2,  0,  2,  2,
+       -2,  0,  0,  0, -2,  0, -2, -2,  2,  1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  1, -2, -2,  2,  2,  2,
+        1, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0, -1,  1,  1,  0,  2,  1,  2,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+        2,  0, -2,  2,  0, -2, -2,  0, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -2,  2,  0,  0,  0, -2,
+       -2,  0,  0,  2,  2,  0,  0,  0,  2,  0, -2, -2,  0,  2,  0,  2,  0,  0,  0,  0,  0, -2, -1, -2,  2,
+        0,  0,  2, -2,  0, -1, -1,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0, -2,  2,  2,  0,  0,  0,  0,
+        0, -2, -2,  0,  0,  0,  0,  0, -1,  2, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0, -1, -1, -1, -2,  1,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  1, -1, -2,  1, -1, -1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2, -2, -1,  0, -1, -2, -2,  2,  0,  0, -2, -2,  2,  2, -1,  2, -2,  0,
+       -2, -2, -2,  2,  0,  0,  0, -2,  2 }
+};
+
+/* X, sin, t^0 */
+static const double xs0[NF] = {
+
+   /* 1-48 */
+      -6844318.44,  -523908.04,   -90552.22,    82168.76,    58707.02,   -20557.78,
+         28288.28,   -15406.85,   -11991.74,    -8584.95,     5095.50,    -4910.93,
+          2511.85,     2307.58,    -2053.16,    -1825.49,    -1534.09,    -1292.02,
+         -1234.96,     1137.48,     -813.13,     -556.26,     -603.52,     -628.24,
+          -512.37,      506.65,      300.99,     -122.67,     2372.58,      405.91,
+         -6245.02,     2521.07,     1898.27,     1163.22,     1029.70,     -866.48,
+           664.57,      438.51,     -305.78,     -264.02,      284.09,      229.78,
+           256.30,     -212.82,      196.64,     -292.37,      261.54,      187.95,
+
+   /* 49-96 */
+             0.00,     -172.95,     -160.15,     -115.40,     -114.49,      112.14,
+            91.31,      105.29,       98.69,       79.03,      132.81,        0.00,
+            60.50,      -52.95,      -40.58,      -43.76,       62.65,        0.00,
+             0.00,        0.00,        6.32,       57.44,       47.73,      -18.38,
+           -48.65,      -18.30,      -16.91,        1.23,       -0.72,       20.57,
+             4.89,        4.89,      -17.86,        0.32,       14.72,        3.34,
+            -3.26,      -19.53,       10.86,        2.03,       16.43,        9.35,
+             0.44,        0.56,       13.88,       -1.99,       -0.20,        6.92,
+
+   /* 97-144 */
+            -6.60,      -10.58,        1.63,       -3.62,        0.20,       -8.99,
+            -1.07,        6.48,        5.57,        8.71,        0.40,       -6.13,
+             5.21,        2.03,        5.01,       -1.91,       -2.23,        2.47,
+            -5.05,        4.97,       -0.99,        0.99,       -3.42,        0.00,
+            -2.43,        0.00,        2.67,       -3.38,        3.18,       -5.77,
+             0.00,        4.10,       -3.10,     -250.54,      230.72,      188.95,
+           161.79,      142.16,      121.98,     -168.26,      161.34,       86.74,
+          -134.81,      -78.56,       66.03,      -52.27,       51.02,      -55.66,
+
+   /* 145-192 */
+           -54.81,       51.32,       48.29,      -45.59,       40.54,      -38.57,
+           -33.22,       37.15,       36.68,      -53.22,       32.43,      -29.53,
+            28.50,       26.54,       26.54,       28.35,      -28.00,      -27.61,
+           -23.28,       23.66,       21.01,      -23.49,      -23.47,       19.58,
+           -22.67,      -19.97,       21.28,       18.58,      -18.02,       17.74,
+           -19.41,      -18.64,      -16.75,      -18.42,      -15.52,      -25.42,
+           -17.42,       16.39,      -14.37,       14.32,       15.69,      -12.78,
+           -14.10,       11.98,       13.41,      -13.29,       11.14,       12.24,
+
+   /* 193-240 */
+            10.07,       10.46,        9.75,      -10.30,       10.02,       -9.75,
+             9.67,       -7.64,       -6.48,       -5.33,       -3.62,       82.14,
+           -46.38,      -19.49,       18.22,      -13.48,      -11.30,      -10.42,
+             5.69,        3.54,       -3.50,        1.83,        3.02,        2.70,
+            -2.90,        0.80,       -1.59,        2.27,     -130.31,      -51.00,
+            40.33,       37.75,      -34.81,      -30.47,      -26.77,      -26.17,
+            23.39,      -22.99,      -13.33,       22.47,       19.65,       19.61,
+            16.55,        9.11,       -9.19,       14.92,       -8.28,       13.32,
+
+   /* 241-288 */
+             8.27,      -12.93,        7.91,       -7.84,        7.44,      -11.38,
+            -7.48,      -10.98,       10.98,        7.40,       -6.09,       -6.94,
+             6.92,        6.20,       -6.12,        5.85,        6.32,        5.61,
+             9.07,        5.25,       -8.47,        5.73,        4.70,       -4.90,
+            -4.81,        5.13,        4.50,       -4.53,       -4.75,        4.49,
+            -6.40,       -6.01,       -4.57,       59.07,       57.28,      -23.79,
+            17.46,      -14.64,       -8.04,       -7.32,        4.65,       -5.29,
+            -4.53,       -4.69,       -4.65,       -4.49,        5.49,       -4.22,
+
+   /* 289-336 */
+             4.18,       -4.06,       -3.98,        4.02,        4.38,       -3.98,
+            -3.82,       -3.71,        4.14,       -4.04,        3.45,        3.31,
+             3.26,       -3.26,       -3.34,       -0.20,        3.94,        3.30,
+            -4.10,       -3.66,        0.00,        0.74,        2.94,        0.00,
+             0.00,        0.00,       -1.11,        0.00,        0.40,        0.00,
+             0.00,        0.24,       -0.04,        0.00,        0.00,       -2.63,
+            -0.56,        0.00,       -0.12,        2.51,       -0.48,        0.24,
+             0.52,        2.11,       -1.39,       -1.47,        2.07,       -0.44,
+
+   /* 337-384 */
+             2.15,       -0.32,        1.87,       -0.24,       -0.24,       -1.99,
+            -0.40,        0.00,       -1.03,        0.32,       -1.27,       -0.32,
+            -0.84,       -1.47,       -0.28,        0.28,        0.00,       -0.32,
+             1.19,        0.72,       -1.19,       -0.28,       -0.12,        0.00,
+            -0.12,        0.36,       -1.19,       -0.44,        1.03,       -0.68,
+            -0.24,        0.56,        0.91,        0.16,        0.40,        0.95,
+             0.00,        0.44,        0.00,        0.95,        0.24,        0.84,
+             0.84,       -0.44,        0.76,        0.20,       -0.95,        0.88,
+
+   /* 385-432 */
+            -0.95,       -0.84,        0.20,       -0.16,        0.00,        0.20,
+             0.00,        0.00,        0.76,       -0.72,        0.00,       -0.68,
+            -0.16,       -0.36,        0.44,        0.60,        0.00,       -0.64,
+             0.36,        0.16,        0.16,        0.00,        0.16,       -0.56,
+            -0.36,        0.64,       -0.52,        0.56,        0.00,        0.00,
+            -0.12,        0.00,       -0.12,        0.00,        0.36,        0.00,
+            -0.32,        0.28,        0.12,        0.48,        0.48,        0.12,
+             0.52,       -0.44,       -0.44,        0.20,        0.40,        0.00,
+
+   /* 433-480 */
+            -0.20,       -0.44,       -0.44,       -0.20,       -0.36,        0.12,
+            -0.12,        0.00,        0.44,        0.24,        0.00,       -0.12,
+            -0.40,        0.00,        0.00,        0.00,        0.00,        0.36,
+             0.24,        0.16,        0.00,       -0.32,        0.20,        0.12,
+             0.00,       -0.32,       -0.16,        0.32,        0.00,       -0.36,
+             0.00,        0.00,       -0.36,        0.12,        0.00,        0.12,
+             0.20,        0.00,        0.00,       -0.32,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.16,       -0.20,        0.00,
+
+   /* 481-528 */
+             0.00,        0.00,       -0.20,        0.24,        0.24,        0.20,
+             0.12,       -0.12,       -0.24,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,       -0.24,       -0.20,
+             0.00,        0.00,        0.00,        0.00,       -0.20,        0.00,
+             0.00,        0.20,       -0.16,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.12,        0.12,       -0.13,       -0.20,        0.12,
+             0.00,        0.00,        0.00,        0.00,        0.16,        0.20,
+
+   /* 529-576 */
+            -0.12,       -0.12,        0.00,        0.00,        0.00,        0.00,
+             0.12,        0.16,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.12,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.12,        0.00,        0.00,
+             0.00,        0.00,       -3.66,        3.66,       -3.30,        3.22,
+
+   /* 577-624 */
+             0.00,        0.12,        0.00,        0.88,        3.30,        0.84,
+            -3.10,       -2.70,        0.44,        1.79,       -1.83,        1.67,
+            -1.11,        1.23,       -0.56,       -0.80,       -1.39,        0.00,
+            -0.99,       -0.52,        0.00,       -0.16,        0.32,       -0.64,
+             1.03,        0.60,        0.95,        0.00,       -0.84,        0.00,
+            -0.76,        0.84,       -0.24,        0.24,        0.36,        0.72,
+             0.64,        0.68,        0.64,        0.64,        0.12,        0.56,
+             0.28,        0.56,        0.32,        0.32,       -0.16,        0.44,
+
+   /* 625-672 */
+             0.00,        0.24,        0.36,        0.16,        0.00,        0.00,
+             0.20,        0.32,        0.00,        0.00,        0.20,        0.20,
+             0.00,        0.12,        0.20,        0.12,       -0.16,        0.00,
+             0.00,        0.00,        0.00,        0.12,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+
+   /* 673-720 */
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.00,        0.00,
+             0.00,        0.00,        0.00,        0.00,        0.08,       -3.74,
+             3.70,        3.34,        3.30,       -3.62,       -3.61,        3.06,
+             3.10,       -3.06,       -3.30,        3.14,       -2.70,        2.94,
+            -2.90,        2.47,        2.55,        2.80,        2.51,        4.10,
+            -2.74,        2.46,        3.74,       -2.51,        2.27,       -2.51,
+            -3.50,       -2.22,        3.26,        1.95,       -1.79,        1.91,
+
+   /* 721-768 */
+             2.11,       -2.11,       -1.87,        2.03,       -2.03,       -1.71,
+             1.67,       -1.79,       -1.79,       -1.67,        1.79,        1.87,
+             1.63,       -1.59,        1.55,       -1.55,       -2.59,       -1.75,
+            -1.75,       -1.83,        1.51,       -1.51,        1.71,        1.31,
+            -1.43,        1.43,       -1.51,       -1.47,        2.39,        1.39,
+             1.39,        1.47,        1.47,        1.43,       -1.31,        1.27,
+            -1.27,        1.27,        1.35,       -1.39,        1.95,       -1.27,
+             1.19,        1.27,        1.15,        1.87,       -1.12,       -1.11,
+
+   /* 769-816 */
+            -1.11,        1.27,       -1.27,       -1.15,       -1.23,       -1.23,
+             1.22,        1.07,        1.75,       -1.03,       -1.07,       -1.03,
+             1.07,       -1.03,        1.03,        0.91,       -0.88,       -0.88,
+            -0.95,       -0.95,        0.95,       -0.95,       -0.80,        0.91,
+             0.88,       -0.83,       -0.91,        0.91,        0.88,       -0.76,
+            -0.76,        0.76,       -0.72,        0.84,        0.84,       -0.68,
+             1.19,        0.76,        1.15,        1.15,        0.72,        0.68,
+            -0.68,        0.79,       -1.11,       -0.76,       -0.72,       -1.07,
+
+   /* 817-864 */
+             0.64,       -0.64,        0.64,       -0.60,       -0.71,        0.56,
+            -0.56,        0.68,        0.68,       -0.64,        0.64,       -0.60,
+            -0.60,       -0.91,       -0.51,       -0.56,       -0.63,        0.55,
+            -0.52,        0.52,        0.52,       -0.48,        0.48,        0.48,
+             0.44,        0.52,       -0.52,        0.40,       -0.40,        0.40,
+            -0.51,       -0.48,        0.48,       -0.48,       -0.48,        0.48,
+            -0.48,        0.44,       -0.64,       -0.64,       -0.40,        0.40,
+             0.40,       -0.36,        0.36,        0.40,        0.40,       -0.40,
+
+   /* 865-912 */
+            -0.40,        0.36,       -0.36,        0.36,       -0.36,        0.36,
+             0.36,        0.32,       -0.32,       -0.32,       -0.32,        0.32,
+            -0.32,        0.32,        0.28,       -0.28,        0.28,        0.28,
+             0.36,       -0.36,        0.32,        0.32,       -0.28,        0.28,
+             0.28,        0.28,        0.28,        0.28,        0.28,       -0.28,
+            -0.24,        0.24,        0.24,       -0.24,        0.24,        0.24,
+            -0.24,        0.24,       -0.24,        0.24,        0.24,       -0.24,
+            -0.24,        0.20,        0.20,        0.20,        0.20,        0.20,
+
+   /* 913-960 */
+             0.20,        0.20,        0.20,       -0.20,        0.20,        0.20,
+            -0.24,        0.24,        0.20,       -0.20,       -0.20,        0.20,
+             0.20,        0.20,        0.20,       -0.20,       -0.20,       -0.20,
+             0.20,       -0.20,        0.20,        0.20,        0.20,        0.20,
+             0.16,        0.16,        0.16,        0.16,       -0.16,        0.16,
+            -0.16,       -0.16,       -0.16,        0.16,        0.16,        0.16,
+            -0.16,       -0.16,       -0.16,        0.16,        0.16,        0.16,
+             0.16,        0.16,        0.16,       -0.16,        0.16,       -0.16,
+
+   /* 961-1008 */
+             0.16,       -0.16,        0.16,        0.16,       -0.16,        0.12,
+             0.12,       -0.12,        0.12,        0.12,       -0.12,       -0.12,
+            -0.12,        0.12,        0.12,        0.12,       -0.12,        0.12,
+            -0.12,        0.12,       -0.12,        0.12,       -0.12,        0.12,
+             0.00,       -0.16,        0.00,        0.12,        0.12,       -0.12,
+            -0.12,        0.12,        0.00,       -3.54,       -2.94,       -2.94,
+             2.15,       -0.20,        1.99,        2.03,       -1.35,       -1.11,
+             1.07,        1.15,       -0.99,       -0.76,        0.72,        0.64,
+
+   /* 1009-1056 */
+             0.76,        0.59,       -0.68,       -0.68,        0.52,       -0.56,
+            -0.52,       -0.52,       -0.48,        0.44,        0.44,       -0.48,
+             0.56,        0.44,       -0.36,       -0.40,       -0.40,        0.32,
+             0.32,       -0.32,        0.32,        0.28,        0.28,       -0.28,
+            -0.32,       -0.28,       -0.28,       -0.28,        0.28,       -0.28,
+            -0.24,       -0.24,       -0.24,        0.24,        0.24,        0.24,
+            -0.24,       -0.24,        0.20,        0.20,       -0.20,       -0.20,
+             0.20,        0.24,       -0.24,        0.20,       -0.20,       -0.20,
+
+   /* 1057-1104 */
+            -0.20,        0.20,       -0.20,       -0.20,       -0.20,       -0.20,
+             0.20,        0.16,       -0.16,        0.16,        0.16,       -0.16,
+             0.16,        0.16,       -0.16,        0.16,        0.16,        0.16,
+             0.16,        0.16,       -0.15,        0.12,       -0.12,        0.12,
+             0.12,        0.12,        0.12,        0.12,       -0.12,        0.12,
+            -0.12,       -0.12,        0.12,       -0.12,        0.12,        0.12,
+            -0.12,        0.12,        0.12,       -0.12,        0.12,        0.12,
+             0.12,       -0.12,        0.12,       -3.74,        3.38,        2.98,
+
+   /* 1105-1152 */
+            -2.43,       -2.39,        2.03,        1.87,        1.51,        1.43,
+            -1.39,       -1.35,        1.23,        1.19,       -1.15,       -1.15,
+            -0.99,        0.99,       -0.95,       -0.91,        0.88,        0.88,
+            -0.80,        0.80,       -0.80,       -0.76,        0.72,       -0.72,
+            -0.68,       -0.68,        0.60,       -0.60,       -0.56,       -0.56,
+            -0.52,        0.52,        0.52,        0.48,       -0.48,        0.48,
+            -0.44,        0.44,       -0.44,       -0.44,       -0.44,       -0.44,
+             0.40,        0.40,       -0.36,       -0.36,       -0.36,       -0.32,
+
+   /* 1153-1200 */
+             0.28,        0.28,        0.28,        0.28,        0.28,        0.28,
+            -0.28,        0.28,        0.24,       -0.24,       -0.24,        0.24,
+             0.24,       -0.20,       -0.20,       -0.20,       -0.20,        0.20,
+             0.16,        0.16,        0.16,        0.16,       -0.16,        0.16,
+             0.16,       -0.16,        0.16,       -0.16,        0.16,       -0.12,
+             0.12,       -0.12,        0.12,       -0.12,        0.12,       -0.12,
+            -0.12,       -0.12,       -0.12,       -0.12,       -0.12,       -0.12,
+             0.12,        0.12,        0.12,        0.12,       -0.12,       -0.12,
+
+   /* 1201-1248 */
+             0.12,        0.12,        0.12,       -0.12,        0.12,       -0.12,
+            -0.12,       -0.12,        0.12,       -0.12,       -0.12,        0.12,
+             0.11,        3.54,        3.30,       -2.98,        2.35,        2.11,
+             1.59,        1.35,        1.11,        1.07,       -0.99,        0.76,
+             0.76,       -0.60,        0.60,       -0.52,       -0.52,        0.52,
+            -0.48,        0.40,        0.40,        0.32,        0.32,        0.28,
+            -0.28,       -0.24,        0.24,        0.24,       -0.20,        0.20,
+             0.20,        0.20,       -0.20,        0.20,        0.16,       -0.16,
+
+   /* 1249-1296 */
+            -0.16,       -0.16,       -0.16,       -0.16,       -0.16,       -0.16,
+             0.16,       -0.16,       -0.16,       -0.16,        0.12,        0.12,
+             0.12,        0.12,        0.12,        0.12,       -0.12,       -0.12,
+             0.12,        0.12,       -0.12,       -0.12,       -0.12,        0.12,
+             0.12,       -0.12,       -0.12,       -0.12,        0.12,       -0.12,
+             0.12,       -0.12,       -0.12,        0.12,        0.12,        0.12,
+            -0.12,       -0.12,       -0.12,       -0.12,        0.12,       -0.12,
+            -0.12,       -0.12,        0.12,       -0.12,       -0.12,       -0.12,
+
+   /* 1297-1309 */
+            -0.12,       -0.12,       -0.12,        0.12,        0.12,       -0.12,
+            -0.12,        0.12,       -0.12,       -0.12,        0.12,        0.12,
+             0.12
+};
+
+/* X, cos, t^0 */
+static const double xc0[NF] = {
+
+   /* 1-50 */
+      1328.67, -544.75,  111.23,  -27.64,  470.05,  -20.84,  -34.69,   15.12,   32.46,    4.42,
+         7.19,    0.76,    1.07,   -7.52,    5.13,    1.23,    6.29,    0.00,    5.21,   -0.04,
+         0.40,    3.16,    0.44,   -0.64,   -1.47,    2.54,   -0.44,  203.78,    5.93,    0.99,
+        -6.68,   -5.97,   -0.72,   -2.94,   -2.63,    0.52,   -0.40,   -0.56,    1.75,    0.99,
+         0.32,   -0.60,   -0.28,    0.84,   -0.84,   -0.32,   -0.95,   -0.24,  -79.08,   -0.40,
+
+   /* 51-100 */
+       -14.04,    0.60,    0.32,    0.28,   -0.40,    0.44,   -0.28,   -0.24,   -0.52,  -41.53,
+         0.36,    0.32,   -1.00,    0.36,   -0.24,   14.47,   -6.44,   13.13,   -1.11,   95.82,
+        23.79,   63.80,   -1.15,  -17.30,    8.43,  -19.13,  -17.34,    0.64,  -16.55,  -16.51,
+        17.10,   24.42,   -0.32,   11.86,   11.62,    5.09,    3.18,   10.82,    0.52,   13.29,
+       -10.38,   -8.67,   -2.47,    7.72,   13.05,    3.34,   10.70,   -3.10,    6.96,    9.86,
+
+   /* 101-150 */
+        -6.88,    4.02,   -5.69,   -0.48,    1.07,    3.54,    9.27,   -1.19,   -2.51,    4.53,
+        -2.51,   -4.38,   -4.65,   -4.46,    0.84,   -1.71,    4.22,    4.22,    6.09,   -4.53,
+        -3.82,   -4.53,   -3.62,   -2.78,   -2.82,    1.87,    5.21,   -2.39,    1.79,    0.08,
+         0.08,   -0.12,    0.24,    0.20,   -0.08,    0.20,    0.20,   -0.08,    0.20,    0.00,
+        -0.20,    0.00,    0.00,    0.16,   -0.08,    0.00,    0.20,   -0.12,   -0.04,    0.08,
+
+   /* 151-200 */
+         0.08,   -0.12,   -0.04,   -0.20,   -0.04,    0.04,   -0.08,   -0.12,    0.04,   -0.16,
+         0.00,    0.20,   -0.08,    0.00,    0.00,    0.00,    0.16,   -0.12,   -0.08,    0.12,
+        -0.08,    0.04,   -0.04,    0.08,    0.08,    0.00,    0.04,    0.00,    0.00,   -0.08,
+         0.00,   -0.08,    0.00,   -0.04,    0.00,    0.04,    0.04,   -0.04,   -0.04,    0.00,
+        -0.04,    0.04,    0.04,    0.08,    0.00,    0.08,    0.00,    0.04,   -0.04,    0.08,
+
+   /* 201-250 */
+         0.08,    0.04,   -0.16,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+        -0.12,   -0.64,    0.68,    2.63,    0.68,   -1.35,    0.68,   -2.78,    2.27,   -1.11,
+         0.04,   -0.12,   -0.04,    0.04,    0.04,    0.04,    0.08,    0.00,   -0.12,    0.04,
+        -0.04,   -0.04,   -0.08,   -0.08,   -0.08,    0.00,    0.00,   -0.04,    0.04,   -0.08,
+         0.04,    0.04,    0.00,   -0.04,    0.00,    0.04,    0.00,    0.00,    0.00,   -0.04,
+
+   /* 251-300 */
+        -0.04,    0.00,    0.04,    0.00,    0.04,    0.00,    0.00,    0.00,    0.00,    0.00,
+         0.00,   -0.04,   -0.04,    0.00,    0.04,    0.04,    0.00,    0.00,    0.00,   -0.04,
+         0.00,   -0.04,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,   -0.12,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+        -0.04,    0.00,    0.00,    0.04,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+
+   /* 301-350 */
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.40,   -0.12,   -0.20,   -2.50,   -0.04,
+        -0.12,    1.19,   -1.03,   -0.52,    0.00,   -0.48,    0.52,   -0.40,    0.20,   -0.12,
+         0.12,   -0.20,   -0.12,   -0.48,   -2.35,   -3.42,    2.63,   -0.64,    2.19,    2.15,
+         2.07,   -0.36,   -1.91,    1.39,    0.91,   -1.95,   -0.60,   -1.87,    0.32,   -1.87,
+         1.87,    0.12,    1.59,   -1.79,   -1.15,    1.39,    0.60,    1.35,   -1.27,   -0.28,
+
+   /* 351-400 */
+        -1.27,   -1.43,   -1.27,   -1.23,   -0.72,   -1.15,   -0.12,    1.11,   -1.27,    1.15,
+         1.11,   -1.07,   -0.24,   -0.95,   -0.56,   -0.76,    0.95,    0.84,    0.28,    0.95,
+        -0.88,   -0.48,   -1.07,    0.95,    0.92,   -0.52,    0.91,   -0.44,   -0.44,   -0.84,
+        -0.91,   -0.91,   -0.48,    0.48,    0.20,   -0.24,    0.84,    0.84,   -0.95,    0.76,
+         0.76,    0.76,   -0.32,   -0.40,   -0.80,   -0.16,    0.68,   -0.56,   -0.48,   -0.28,
+
+   /* 401-450 */
+        -0.76,    0.36,   -0.52,    0.60,   -0.60,    0.12,    0.68,    0.36,   -0.44,   -0.12,
+         0.36,    0.32,    0.60,    0.60,    0.52,    0.56,   -0.52,   -0.52,   -0.44,    0.60,
+         0.48,   -0.48,    0.48,   -0.12,   -0.24,    0.48,    0.36,   -0.24,   -0.12,    0.48,
+        -0.24,   -0.40,   -0.44,    0.20,    0.20,   -0.44,   -0.20,    0.48,   -0.36,    0.48,
+        -0.12,   -0.40,    0.44,   -0.36,    0.00,   -0.40,   -0.40,    0.36,    0.36,    0.00,
+
+   /* 451-500 */
+        -0.36,    0.40,   -0.36,   -0.12,   -0.36,    0.40,    0.20,    0.16,    0.32,   -0.16,
+         0.40,    0.12,    0.36,    0.36,    0.00,    0.28,    0.36,    0.32,   -0.24,    0.32,
+        -0.32,    0.00,    0.32,   -0.32,    0.32,   -0.32,    0.32,    0.32,   -0.28,    0.28,
+         0.28,   -0.28,    0.24,    0.16,   -0.12,   -0.16,    0.20,   -0.28,    0.12,   -0.28,
+        -0.28,    0.28,   -0.28,   -0.28,    0.28,   -0.28,    0.00,   -0.12,   -0.24,   -0.24,
+
+   /* 501-550 */
+         0.24,    0.24,   -0.16,   -0.32,    0.20,    0.12,    0.16,   -0.20,    0.20,    0.20,
+         0.20,    0.20,    0.20,    0.20,   -0.20,   -0.20,   -0.20,   -0.24,   -0.16,    0.22,
+         0.12,   -0.20,   -0.24,   -0.24,    0.24,   -0.24,    0.12,    0.00,   -0.16,   -0.16,
+        -0.20,   -0.20,   -0.20,    0.20,   -0.12,    0.00,   -0.16,   -0.16,    0.16,    0.16,
+         0.16,    0.16,    0.16,   -0.16,   -0.16,   -0.16,    0.16,   -0.16,   -0.16,    0.16,
+
+   /* 551-600 */
+         0.16,   -0.16,    0.12,    0.00,    0.12,   -0.12,    0.12,    0.12,   -0.12,    0.12,
+         0.12,   -0.12,   -0.12,   -0.12,    0.12,    0.12,    0.12,    0.00,    0.12,    0.12,
+        -0.12,    0.12,    0.04,    0.04,    0.01,   -0.04,    2.98,    0.24,    0.20,   -3.46,
+         0.60,   -3.10,   -0.72,    1.55,    2.23,   -0.88,    0.56,    0.80,    1.43,   -0.24,
+        -1.55,    1.35,   -0.28,    1.39,    0.88,   -1.19,    1.23,   -1.11,   -1.07,    0.91,
+
+   /* 601-650 */
+        -0.36,    0.88,    0.48,    0.95,    0.44,    0.88,   -0.44,    0.12,    0.80,    0.76,
+        -0.64,   -0.12,    0.32,   -0.12,   -0.24,   -0.20,    0.64,    0.28,    0.52,   -0.12,
+         0.44,   -0.16,   -0.48,    0.16,    0.44,   -0.36,    0.24,    0.36,    0.36,    0.36,
+        -0.28,   -0.12,   -0.32,    0.32,   -0.24,   -0.20,    0.24,   -0.20,    0.12,    0.20,
+         0.16,   -0.20,   -0.20,    0.20,   -0.20,   -0.16,    0.20,   -0.16,   -0.16,   -0.16,
+
+   /* 651-700 */
+         0.16,    0.16,    0.16,   -0.16,   -0.16,    0.16,   -0.16,   -0.16,    0.12,   -0.12,
+         0.12,    0.12,    0.12,    0.12,    0.12,    0.12,   -0.12,   -0.12,    0.12,    0.12,
+         0.12,   -0.12,    0.12,   -0.12,   -0.12,    0.12,   -0.12,    0.12,   -0.12,    0.12,
+        -0.12,   -0.12,    0.12,   -0.12,   -0.12,    0.12,    0.12,    0.12,    0.04,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 701-750 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 751-800 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 801-850 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 851-900 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 901-950 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 951-1000 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1001-1050 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1051-1100 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1101-1150 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1151-1200 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1201-1250 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1251-1300 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1301-1309 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* Y, sin, t^0 */
+static const double ys0[NF] = {
+
+   /* 1-50 */
+      1538.18, -458.66,  137.41,  -29.05, -192.40,  -17.40,   35.80,   31.80,   36.70,  -13.20,
+         3.92,    0.40,   -0.90,    7.50,    7.80,   -2.00,    6.80,    0.00,    5.90,   -0.30,
+         0.30,   -4.48,    0.10,   -0.50,   -1.40,   -2.62,   -0.50,  273.50,   -6.60,   -1.50,
+        -8.20,    2.90,    2.50,    1.30,    1.10,   -1.30,    1.00,   -0.20,    1.90,    1.40,
+        -0.40,    0.50,   -0.40,    1.20,    0.90,   -0.40,    0.20,    0.30,  167.90,   -0.20,
+
+   /* 51-100 */
+        13.90,    0.70,    0.40,   -0.30,    0.40,   -0.50,   -0.30,    0.20,    0.10,   89.10,
+        -0.40,    0.40,    1.00,    0.40,    0.00,  -17.60,  -13.80,    0.00,    1.10,  128.60,
+        31.90,    0.00,    0.00,  -23.20,   13.30,  -25.70,  -23.30,    0.70,   19.90,  -18.00,
+         0.00,    0.00,    0.00,   15.90,   15.60,    0.00,    4.30,   14.50,    0.00,    0.00,
+        11.30,   11.70,    0.00,   10.30,    0.00,    4.50,    0.00,    0.00,   -7.60,    0.00,
+
+   /* 101-150 */
+        -7.50,    0.00,   -7.70,   -0.50,    1.40,    0.00,    0.00,   -1.30,   -2.60,    6.10,
+         2.70,   -5.90,    4.20,    4.90,    0.90,    0.00,   -5.70,   -5.60,    0.00,   -5.00,
+         4.20,    4.90,   -3.90,   -3.10,   -3.10,    0.00,    0.00,    0.00,    0.00,    0.40,
+        -0.10,    0.30,    0.10,    0.10,    0.10,   -0.20,    0.20,   -0.20,   -0.20,    0.00,
+        -0.20,    0.00,    0.00,   -0.20,    0.20,    0.00,   -0.20,    0.10,   -0.10,    0.10,
+
+   /* 151-200 */
+        -0.10,   -0.10,   -0.10,    0.00,   -0.10,    0.00,   -0.10,    0.10,   -0.10,    0.20,
+         0.00,    0.20,   -0.10,    0.00,    0.00,    0.00,    0.20,    0.10,    0.10,    0.20,
+        -0.10,   -0.10,   -0.10,   -0.10,    0.10,    0.00,    0.10,    0.00,    0.00,    0.00,
+         0.00,   -0.10,    0.00,   -0.10,    0.00,    0.00,    0.00,    0.00,   -0.10,    0.00,
+         0.00,    0.00,    0.00,   -0.10,    0.00,    0.10,    0.00,    0.00,    0.00,    0.10,
+
+   /* 201-250 */
+         0.10,    0.10,    0.20,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+        -0.10,   -0.90,   -0.90,    3.50,    0.90,    1.80,    0.90,   -3.70,    3.00,   -1.50,
+         0.00,   -0.10,    0.10,    0.10,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+        -0.10,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+
+   /* 251-300 */
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,   -0.10,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,    0.00,
+
+   /* 301-350 */
+         0.00,    0.00,    0.00,    0.00,    0.00,    0.20,   -0.10,    0.20,    2.70,    0.08,
+         0.10,    1.40,   -1.10,   -1.10,    0.20,   -1.00,   -0.50,   -0.50,    0.40,   -0.10,
+        -0.10,   -0.20,    0.20,   -0.60,    3.10,    1.90,   -2.90,    0.70,   -2.90,    2.90,
+        -2.80,    0.50,   -2.10,    1.90,    1.00,    2.60,   -0.70,   -2.50,    0.40,   -2.50,
+        -2.50,   -0.10,    2.10,    2.00,   -1.60,   -1.90,    0.80,   -1.80,   -1.40,   -0.30,
+
+   /* 351-400 */
+        -1.70,   -1.50,   -1.70,    1.60,   -0.80,   -1.30,    0.20,    1.50,   -1.40,    1.50,
+         1.50,   -1.40,    0.20,    1.10,   -0.60,   -1.00,   -1.30,   -1.10,    0.30,    1.30,
+        -1.20,   -0.50,    1.20,    1.10,   -1.30,    0.60,    1.20,   -0.60,    0.60,   -1.10,
+        -1.00,   -1.20,   -0.50,   -0.50,   -0.20,   -0.30,    1.10,    1.10,    1.00,   -1.00,
+         1.00,    1.00,    0.40,   -0.40,   -0.90,   -0.20,   -0.90,   -0.80,   -0.70,   -0.40,
+
+   /* 401-450 */
+        -0.80,   -0.40,   -0.70,    0.80,   -0.80,    0.20,    0.70,   -0.40,    0.60,    0.10,
+         0.40,   -0.30,    0.70,    0.70,   -0.70,    0.70,   -0.70,   -0.70,   -0.50,    0.60,
+        -0.50,   -0.50,   -0.60,    0.20,   -0.30,    0.60,    0.40,   -0.30,    0.10,    0.50,
+        -0.30,   -0.60,    0.50,    0.20,   -0.20,   -0.50,   -0.30,    0.50,   -0.50,    0.50,
+        -0.10,    0.40,   -0.50,   -0.50,    0.10,    0.50,   -0.50,    0.50,   -0.50,   -0.10,
+
+   /* 451-500 */
+        -0.40,   -0.40,   -0.50,    0.10,    0.40,    0.40,   -0.20,    0.20,    0.40,   -0.20,
+         0.40,    0.10,    0.40,    0.40,    0.10,   -0.40,    0.40,   -0.40,    0.30,    0.40,
+        -0.40,    0.10,    0.40,   -0.40,    0.40,   -0.40,    0.40,   -0.30,   -0.30,   -0.40,
+        -0.40,   -0.40,    0.30,   -0.20,    0.20,    0.20,    0.30,    0.30,    0.10,   -0.30,
+        -0.30,    0.30,   -0.30,   -0.30,    0.30,    0.30,   -0.10,   -0.10,    0.30,    0.30,
+
+   /* 501-550 */
+        -0.30,    0.30,   -0.20,    0.20,   -0.30,    0.20,    0.20,    0.30,    0.30,    0.30,
+         0.30,    0.30,    0.30,   -0.30,   -0.30,    0.30,    0.30,    0.20,   -0.20,    0.21,
+        -0.10,    0.20,   -0.20,   -0.20,    0.20,    0.20,    0.10,   -0.10,   -0.20,    0.20,
+         0.20,    0.20,    0.20,    0.20,   -0.10,   -0.10,    0.20,   -0.20,   -0.20,    0.20,
+         0.20,    0.20,    0.20,   -0.20,   -0.20,    0.20,   -0.20,   -0.20,   -0.20,    0.20,
+
+   /* 551-600 */
+         0.20,    0.20,   -0.20,   -0.10,    0.20,    0.20,    0.20,    0.20,   -0.20,    0.20,
+         0.20,    0.20,   -0.20,   -0.20,   -0.20,   -0.20,    0.20,    0.10,    0.10,    0.10,
+        -0.10,    0.10,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 601-650 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 651-700 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 701-750 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 751-800 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 801-850 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 851-900 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 901-950 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 951-1000 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1001-1050 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1051-1100 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1101-1150 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1151-1200 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1201-1250 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1251-1300 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 1301-1309 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* Y, cos, t^0 */
+static const double yc0[NF] = {
+
+   /* 1-49 */
+      9205236.26,  573033.42,   97846.69,  -89618.24,    7387.02,   22438.42,    -674.99,
+        20069.50,   12902.66,   -9592.72,   -6918.22,   -5331.13,   -3323.89,    3143.98,
+         2636.13,   -2423.59,    1645.01,   -1387.00,    1323.81,   -1233.89,   -1075.60,
+          852.85,    -800.34,     684.99,     695.54,     643.75,    -325.03,     164.70,
+         2554.51,     522.11,    -123.48,    -122.28,      47.70,     -60.90,     -55.55,
+          -16.26,      16.81,      10.47,     326.60,     335.24,     307.03,     304.17,
+         -276.81,     269.45,     272.05,      -5.10,     -19.94,      -4.11,       0.00,
+
+   /* 50-98 */
+           -8.11,     -55.30,     123.20,     123.20,     120.70,     126.64,     112.90,
+         -106.20,     107.31,     -10.77,       0.00,      64.70,      66.29,     -49.51,
+           46.50,      -5.00,       0.00,       0.00,       0.00,      -5.39,     -77.10,
+          -64.10,       0.00,       0.00,      24.60,      26.90,      -1.70,       0.90,
+          -20.10,       5.90,      -5.30,       0.00,       0.00,     -16.00,      -4.50,
+            4.40,       0.00,     -14.60,      -2.70,       0.00,       0.00,       0.50,
+            0.80,       0.00,       2.70,       0.00,      -9.30,       0.00,       0.00,
+
+   /* 99-147 */
+            1.70,       0.00,      -0.20,       0.00,       1.40,      -7.20,      -7.50,
+            0.00,       0.00,       6.70,      -5.70,      -2.70,       5.50,       2.60,
+           -4.00,       2.70,       5.50,      -5.40,      -1.30,       1.40,       0.00,
+            0.00,      -2.70,       0.00,      -2.90,       3.70,      -3.50,       0.00,
+            0.00,       0.00,       0.00,     327.11,    -304.46,     272.22,    -220.67,
+         -190.79,     131.04,      -2.00,       4.03,    -112.94,       3.51,      85.32,
+          -71.00,     -70.01,      67.25,     -60.92,     -59.20,     -55.60,      51.80,
+
+   /* 148-196 */
+          -49.00,     -52.69,      49.59,     -44.04,     -39.90,     -39.50,      -3.91,
+          -42.19,     -39.11,     -38.92,      36.95,      34.59,     -32.55,      30.40,
+           29.40,      31.61,      25.80,     -27.91,     -25.31,      25.20,      27.50,
+          -24.40,      25.00,     -22.80,      24.00,      24.40,      22.50,      20.70,
+           20.11,      21.60,     -20.00,      20.51,      -1.91,      18.10,     -17.60,
+           18.91,     -18.50,      17.08,     -17.41,     -15.31,      16.21,     -14.30,
+           14.40,     -14.40,     -13.38,     -13.81,      13.10,     -12.80,      10.90,
+
+   /* 197-245 */
+          -10.80,      10.40,     -10.40,       9.40,       6.90,       5.60,      -5.40,
+           89.50,      50.50,     -21.30,      19.80,      14.70,     -15.10,      11.40,
+           -6.20,      -4.80,      -4.70,      -2.50,      -4.10,       3.60,       3.90,
+           -1.10,       2.10,      -3.00,      -0.90,      -2.30,       0.40,       0.80,
+            2.89,       0.91,       1.41,      -0.19,      -2.40,       0.50,      18.40,
+           -0.60,      -1.90,      -1.50,      -1.71,      12.80,     -12.00,      -0.80,
+          -11.20,      -1.41,      10.50,       0.70,     -10.20,     -10.00,       9.60,
+
+   /* 246-294 */
+            0.60,       8.30,      -0.20,       0.20,      -7.90,       8.40,      -7.49,
+            7.50,       8.09,       7.80,      -7.50,       6.90,      -7.20,       0.00,
+            6.90,      -0.40,      -6.10,       6.60,      -6.40,       6.00,       5.50,
+            5.90,       5.70,      -5.19,      -4.90,      -0.10,      -0.50,      -0.20,
+            0.00,       0.00,       0.00,       0.00,       0.00,      -8.70,       8.00,
+           -6.30,       5.70,       6.10,      -5.20,      -5.10,      -4.90,       0.00,
+            6.10,       5.70,       5.60,       5.60,      -5.40,       4.80,       5.00,
+
+   /* 295-343 */
+           -5.00,       5.07,       4.40,       4.39,      -4.72,       4.71,      -4.50,
+           -4.50,      -4.40,       5.30,      -5.30,       4.00,       0.30,       1.20,
+            0.00,       3.05,      -0.10,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.60,       0.00,       0.00,       0.30,       0.30,       0.00,
+            0.00,       3.50,      -0.80,      -0.60,      -0.10,       2.80,      -0.60,
+           -0.30,       0.70,       2.80,       1.50,       2.00,      -2.30,      -0.70,
+           -2.40,       0.40,      -2.50,       0.30,      -0.30,      -2.20,       0.50,
+
+   /* 344-392 */
+            0.00,       1.40,       0.50,       1.70,      -0.40,       0.90,       1.60,
+            0.40,      -0.40,       0.00,      -0.40,      -1.30,      -0.80,      -1.60,
+            0.40,       0.10,       0.00,       0.20,      -0.50,      -1.30,      -0.90,
+           -1.10,       0.90,      -0.30,       0.70,      -1.30,      -0.20,      -0.50,
+           -1.10,       0.00,      -0.50,       0.00,       1.00,      -0.40,      -1.10,
+            1.10,       0.60,       0.20,      -0.30,       1.00,       1.00,      -1.10,
+            1.10,      -0.30,       0.20,       0.00,       0.20,       0.00,       0.00,
+
+   /* 393-441 */
+            0.80,       0.80,       0.00,       0.90,      -0.20,       0.50,      -0.60,
+           -0.80,       0.00,      -0.70,      -0.50,      -0.20,      -0.20,      -1.00,
+           -0.20,      -0.60,      -0.50,       0.70,       0.60,       0.60,       0.00,
+            0.00,      -0.20,       0.00,       0.10,       0.00,      -0.40,       0.00,
+           -0.30,      -0.30,       0.20,       0.60,      -0.50,      -0.10,      -0.20,
+            0.50,      -0.60,      -0.20,      -0.50,      -0.10,      -0.20,       0.50,
+           -0.50,       0.20,       0.50,      -0.10,       0.30,       0.00,      -0.50,
+
+   /* 442-490 */
+            0.30,       0.00,       0.20,       0.50,       0.00,       0.00,       0.10,
+           -0.10,       0.50,      -0.20,       0.20,       0.00,      -0.50,       0.20,
+           -0.10,      -0.50,       0.40,       0.20,      -0.40,       0.00,       0.40,
+            0.10,      -0.10,       0.40,       0.20,       0.00,       0.10,       0.30,
+            0.10,      -0.10,       0.40,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.20,       0.20,       0.00,       0.00,       0.00,       0.20,
+            0.30,       0.30,       0.30,      -0.20,       0.00,       0.30,       0.00,
+
+   /* 491-539 */
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.30,
+            0.30,       0.00,       0.00,       0.00,       0.00,       0.20,       0.00,
+            0.10,      -0.20,       0.20,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.10,
+           -0.20,       0.10,      -0.20,       0.10,       0.00,       0.00,       0.00,
+            0.00,      -0.20,       0.20,       0.10,      -0.10,       0.00,       0.00,
+            0.00,       0.00,      -0.20,      -0.20,       0.10,      -0.10,      -0.10,
+
+   /* 540-588 */
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.10,
+           -0.20,      -0.10,      -0.10,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+           -0.10,       0.00,       0.00,       0.00,       0.00,       3.90,       3.90,
+            3.36,      -0.40,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+
+   /* 589-637 */
+            0.00,      -1.30,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,      -0.40,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+
+   /* 638-686 */
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+            0.00,       0.00,       0.00,       0.00,       0.00,       0.00,       0.00,
+
+   /* 687-735 */
+            0.00,       0.00,       0.00,      -4.00,       4.00,      -4.30,      -4.30,
+           -3.90,       3.90,       4.30,       4.10,       3.90,      -3.60,       3.40,
+           -3.60,      -3.20,       3.20,      -3.40,      -3.30,      -3.08,       3.30,
+            0.20,       3.00,       3.23,      -0.40,      -2.80,      -2.90,       2.60,
+            0.20,      -2.50,      -0.40,      -2.60,      -2.60,       2.50,      -2.30,
+            2.20,      -2.40,      -2.20,       2.20,       2.40,       2.40,       2.30,
+            2.20,       2.20,      -2.00,      -1.90,      -2.10,       2.10,      -2.10,
+
+   /* 736-784 */
+            2.10,      -0.20,      -1.90,       1.90,      -1.80,       2.00,      -2.00,
+            1.80,       2.10,       2.00,       2.00,       1.90,       1.90,       0.20,
+            1.90,      -1.80,      -1.60,      -1.60,      -1.50,       1.60,      -1.60,
+            1.60,      -1.60,       1.50,      -1.40,      -0.20,       1.49,       1.50,
+            1.40,       1.50,      -0.10,      -1.50,      -1.50,      -1.50,      -1.30,
+           -1.30,       1.40,       1.30,      -1.30,      -1.29,      -1.40,      -0.20,
+           -1.40,       1.20,       1.15,       1.10,       1.10,      -1.10,      -1.20,
+
+   /* 785-833 */
+           -1.20,       1.20,       1.10,      -1.10,      -1.00,       1.00,       1.10,
+           -1.00,       1.00,       1.00,       0.90,       0.90,      -0.90,      -1.00,
+            1.00,       1.00,       1.00,      -0.90,       0.90,       1.00,      -0.20,
+            0.90,      -0.10,      -0.10,      -0.90,       0.90,       0.90,       0.80,
+           -0.10,      -0.80,      -0.80,      -0.10,       0.80,      -0.80,       0.80,
+           -0.80,       0.70,       0.80,       0.80,      -0.70,       0.70,       0.70,
+            0.70,       0.70,      -0.70,      -0.10,       0.76,       0.70,      -0.60,
+
+   /* 834-882 */
+           -0.60,       0.60,       0.60,      -0.60,       0.60,       0.60,       0.60,
+           -0.60,      -0.50,       0.50,       0.60,      -0.60,      -0.60,      -0.50,
+            0.50,      -0.50,       0.50,       0.50,      -0.50,      -0.50,       0.50,
+           -0.10,      -0.10,       0.50,       0.50,       0.50,      -0.50,      -0.50,
+           -0.40,       0.40,       0.40,       0.40,      -0.40,       0.40,      -0.40,
+           -0.40,       0.40,       0.40,       0.40,       0.40,       0.40,       0.40,
+           -0.40,      -0.40,      -0.40,      -0.40,       0.40,      -0.40,       0.40,
+
+   /* 883-931 */
+           -0.30,      -0.30,      -0.30,       0.30,       0.30,       0.30,       0.30,
+           -0.30,      -0.30,      -0.30,       0.30,       0.30,       0.30,      -0.30,
+           -0.30,      -0.30,       0.30,      -0.30,       0.30,      -0.30,      -0.30,
+           -0.30,       0.30,       0.30,       0.30,      -0.30,      -0.30,      -0.30,
+            0.30,      -0.30,      -0.30,       0.30,       0.30,      -0.30,      -0.30,
+           -0.30,       0.20,       0.20,      -0.20,      -0.20,      -0.20,       0.20,
+           -0.20,       0.20,       0.20,      -0.20,       0.20,       0.20,      -0.20,
+
+   /* 932-980 */
+           -0.20,       0.20,       0.20,      -0.20,      -0.20,      -0.20,      -0.20,
+           -0.20,       0.20,       0.20,       0.20,       0.20,       0.20,       0.20,
+           -0.20,       0.20,      -0.20,       0.20,      -0.20,       0.20,       0.20,
+           -0.20,      -0.20,       0.20,       0.20,       0.20,      -0.20,       0.20,
+            0.20,       0.20,      -0.20,      -0.20,      -0.20,      -0.20,       0.20,
+            0.20,      -0.20,      -0.20,      -0.20,       0.20,       0.20,      -0.20,
+            0.20,       0.20,      -0.20,       0.20,      -0.20,       0.20,       0.20,
+
+   /* 981-1029 */
+            0.20,      -0.20,       0.20,       0.20,      -0.21,      -0.10,       0.17,
+            0.10,      -0.10,       0.10,       0.10,      -0.10,       0.11,       3.80,
+           -3.20,       3.20,      -2.90,      -3.50,      -2.70,       2.20,      -1.50,
+            1.50,      -1.40,      -1.30,       1.10,       1.00,      -0.90,      -0.90,
+           -0.80,      -0.80,      -0.70,      -0.70,      -0.70,       0.60,      -0.60,
+            0.60,      -0.60,      -0.60,      -0.60,       0.50,      -0.40,       0.50,
+           -0.50,      -0.40,       0.40,      -0.40,      -0.40,       0.40,       0.40,
+
+   /* 1030-1078 */
+           -0.40,       0.40,      -0.40,       0.30,      -0.30,       0.30,       0.30,
+           -0.30,       0.30,      -0.30,       0.30,       0.30,      -0.30,      -0.30,
+            0.30,       0.30,       0.30,       0.30,       0.30,      -0.30,      -0.30,
+           -0.30,       0.20,      -0.20,       0.20,       0.20,       0.20,       0.20,
+           -0.20,      -0.20,       0.20,      -0.20,      -0.20,       0.20,      -0.20,
+            0.20,      -0.20,      -0.20,       0.20,      -0.20,      -0.20,      -0.20,
+            0.20,       0.20,       0.20,      -0.20,       0.20,       0.20,      -0.20,
+
+   /* 1079-1127 */
+           -0.20,      -0.20,       0.20,       0.20,       0.20,      -0.20,       0.20,
+           -0.20,       0.20,       0.20,      -0.20,      -0.20,      -0.20,       0.20,
+           -0.20,      -0.20,       0.20,      -0.20,       0.10,      -0.10,       0.10,
+            0.10,      -0.10,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+
+   /* 1128-1176 */
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+
+   /* 1177-1225 */
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+
+   /* 1226-1274 */
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+
+   /* 1275-1309 */
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             0.0,        0.0,        0.0,        0.0,        0.0,        0.0,        0.0
+};
+
+/* X, sin, t^1 */
+static const double xs1[NF1] = {
+
+   /* 1-45 */
+      -3309.73,   198.97,    41.44,   -36.07,  -179.73,    59.20,   -11.19,    -5.77,     5.70,
+         23.87,     2.86,     2.16,     1.16,     1.46,    -0.42,    -1.07,     0.92,     0.68,
+          0.74,    -0.61,    -0.40,    -0.81,    -0.08,     3.18,    -0.16,    -0.77,    -1.01,
+          6.18,    -0.96,    -0.25,     2.71,    -0.82,    -0.94,    -0.58,    -0.52,     0.43,
+         -3.71,    -0.24,     0.20,    -0.27,    -0.99,     0.33,    -0.14,     0.14,     0.35,
+
+   /* 46-90 */
+          0.14,    -0.13,    -0.09,     3.75,     0.09,     0.40,     0.08,     0.07,    -0.07,
+         -0.04,    -0.07,    -0.06,    -0.04,    -0.07,     1.99,    -0.04,     0.04,     0.04,
+          0.03,    -0.03,    -0.39,    -0.31,     0.00,     0.02,     2.85,     0.69,     0.00,
+          0.00,    -0.51,     0.31,    -0.58,    -0.52,     0.00,     0.44,    -0.41,     0.00,
+          0.00,    -0.01,     0.35,     0.35,     0.00,     0.09,     0.32,     0.00,     0.00,
+
+   /* 91-135 */
+          0.25,     0.26,     0.00,     0.23,     0.00,     0.10,     0.00,     0.00,    -0.17,
+          0.00,    -0.17,     0.00,    -0.17,    -0.01,     0.03,     0.00,     0.00,    -0.03,
+         -0.06,     0.14,     0.06,    -0.13,     0.10,     0.11,     0.02,     0.00,    -0.13,
+         -0.13,     0.00,    -0.11,     0.10,     0.11,    -0.09,    -0.07,    -0.07,     0.00,
+          0.00,     0.00,     0.00,    -0.30,     0.27,     0.34,    -0.08,    -0.07,    -0.06,
+
+   /* 136-180 */
+          0.08,    -0.08,    -0.05,     0.07,     0.04,    -0.04,     0.03,    -0.03,     0.03,
+          0.03,    -0.03,    -0.03,     0.03,    -0.02,     0.02,     0.02,    -0.02,    -0.02,
+          0.03,    -0.02,     0.02,    -0.02,    -0.01,    -0.02,    -0.01,     0.01,     0.02,
+          0.01,    -0.01,    -0.01,     0.01,     0.02,    -0.01,     0.01,     0.01,    -0.01,
+         -0.01,     0.01,    -0.01,     0.01,     0.01,     0.01,     0.01,     0.01,     0.45,
+
+   /* 181-225 */
+          0.01,    -0.01,     0.01,    -0.01,    -0.01,     0.01,     0.01,    -0.01,    -0.01,
+          0.01,    -0.01,    -0.01,    -0.01,    -0.01,    -0.01,     0.01,    -0.01,     0.01,
+         -0.01,     0.01,     0.01,     0.01,     0.01,    -0.04,     0.02,     0.01,    -0.01,
+          0.01,     0.01,     0.01,    -0.01,    -0.02,    -0.02,     0.08,     0.02,     0.04,
+          0.02,    -0.08,     0.07,    -0.03,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 226-270 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+
+   /* 271-305 */
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0
+};
+
+/* X, cos, t^1 */
+static const double xc1[NF1] = {
+
+   /* 1-48 */
+      205833.11,  12814.01,   2187.91,  -2004.36,    164.33,    501.82,    -15.07,    448.76,
+         288.49,   -214.50,   -154.91,   -119.21,    -74.33,     70.31,     58.94,    -54.19,
+          36.78,    -31.01,     29.60,    -27.59,    -24.05,     19.06,    -17.90,     15.32,
+          15.55,     14.40,     -7.27,      3.58,     57.12,     11.67,     -2.76,     -2.73,
+           1.07,     -1.36,     -1.25,     -0.36,      0.38,      0.24,      7.30,      7.49,
+           6.87,      6.80,     -6.19,      6.02,      6.08,     -0.11,     -0.45,     -0.09,
+
+   /* 49-96 */
+           0.04,     -0.18,     -1.23,      2.75,      2.75,      2.70,      2.83,      2.52,
+          -2.37,      2.40,     -0.24,      0.02,      1.45,      1.48,     -1.11,      1.04,
+          -0.11,     -0.01,      0.00,      0.00,     -0.12,     -1.77,     -1.45,      0.00,
+           0.00,      0.56,      0.60,     -0.03,      0.03,     -0.45,      0.14,     -0.11,
+           0.00,      0.00,     -0.36,     -0.11,      0.09,      0.00,     -0.33,     -0.07,
+           0.00,      0.00,      0.02,      0.02,      0.00,      0.06,      0.00,     -0.21,
+
+   /* 97-144 */
+           0.00,      0.00,      0.03,      0.00,      0.00,      0.00,      0.03,     -0.16,
+          -0.17,      0.00,      0.00,      0.15,     -0.13,     -0.06,      0.12,      0.06,
+          -0.09,      0.06,      0.12,     -0.12,     -0.03,      0.03,      0.00,      0.00,
+          -0.06,      0.00,     -0.06,      0.08,     -0.08,      0.00,      0.00,      0.00,
+           0.00,      7.31,     -6.81,      6.09,     -4.93,     -4.27,      2.93,     -0.04,
+           0.09,     -2.53,      0.08,      1.91,     -1.59,     -1.57,      1.50,     -1.36,
+
+   /* 145-192 */
+          -1.32,     -1.24,      1.16,     -1.10,     -1.18,      1.11,     -0.98,     -0.89,
+          -0.88,     -0.09,     -0.94,     -0.87,     -0.87,      0.83,      0.77,     -0.73,
+           0.68,      0.66,      0.71,      0.58,     -0.62,     -0.57,      0.56,      0.62,
+          -0.55,      0.56,     -0.51,      0.54,      0.55,      0.50,      0.46,      0.45,
+           0.48,     -0.45,      0.46,     -0.04,      0.40,     -0.39,      0.42,     -0.41,
+           0.38,     -0.39,     -0.34,      0.36,     -0.32,      0.32,     -0.32,     -0.30,
+
+   /* 193-240 */
+          -0.31,      0.29,     -0.29,      0.24,     -0.24,      0.23,     -0.23,      0.21,
+           0.15,      0.13,     -0.12,      2.00,      1.13,     -0.48,      0.44,      0.33,
+          -0.34,      0.25,     -0.14,     -0.11,     -0.11,     -0.06,     -0.09,      0.08,
+           0.09,     -0.02,      0.05,     -0.07,      0.00,      0.00,      0.00,      0.00,
+           0.00,      0.00,      0.00,      0.00,      0.00,      0.00,      0.41,      0.00,
+           0.00,      0.00,      0.00,      0.29,     -0.27,      0.00,     -0.25,      0.00,
+
+   /* 241-288 */
+           0.23,      0.00,     -0.23,     -0.22,      0.21,      0.00,      0.19,      0.00,
+           0.00,     -0.18,      0.19,     -0.17,      0.17,      0.18,      0.17,     -0.17,
+           0.15,     -0.16,      0.00,      0.15,      0.00,     -0.14,      0.15,     -0.14,
+           0.13,      0.12,      0.13,      0.13,     -0.12,     -0.11,      0.00,      0.00,
+           0.00,      0.00,      0.00,      0.00,      0.00,      0.00,     -0.19,      0.18,
+          -0.14,      0.13,      0.14,     -0.12,     -0.11,     -0.11,      0.00,      0.14,
+
+   /* 289-305 */
+           0.13,      0.13,      0.13,     -0.12,      0.11,      0.11,     -0.11,      0.11,
+           0.10,      0.10,     -0.11,      0.11,     -0.10,     -0.10,     -0.10,      0.12,
+          -0.12
+};
+
+/* Y, sin, t^1 */
+static const double ys1[NF1] = {
+
+   /* 1-48 */
+      153041.79,  11714.49,   2024.68,  -1837.32,  -1312.21,    459.68,   -632.54,    344.50,
+         268.14,    192.06,   -113.94,    109.81,    -56.17,    -51.60,     45.91,     40.82,
+          34.30,     28.89,     27.61,    -25.43,     18.18,     12.44,     13.49,     14.05,
+          11.46,    -11.33,     -6.73,      2.74,    -53.05,     -9.08,    139.64,    -56.37,
+         -42.45,    -26.01,    -23.02,     19.37,    -14.86,     -9.81,      6.84,      5.90,
+          -6.35,     -5.14,     -5.73,      4.76,     -4.40,      6.54,     -5.85,     -4.20,
+
+   /* 49-96 */
+           0.00,      3.87,      3.58,      2.58,      2.56,     -2.51,     -2.04,     -2.35,
+          -2.21,     -1.77,     -2.97,      0.00,     -1.35,      1.18,      0.91,      0.98,
+          -1.40,      0.00,      0.00,      0.00,     -0.14,     -1.28,     -1.07,      0.41,
+           1.09,      0.41,      0.38,     -0.03,      0.02,     -0.46,     -0.11,     -0.11,
+           0.40,     -0.01,     -0.33,     -0.07,      0.07,      0.44,     -0.24,     -0.05,
+          -0.37,     -0.21,     -0.01,     -0.01,     -0.31,      0.04,      0.00,     -0.15,
+
+   /* 97-144 */
+           0.15,      0.24,     -0.04,      0.08,      0.00,      0.20,      0.02,     -0.14,
+          -0.12,     -0.19,     -0.01,      0.14,     -0.12,     -0.05,     -0.11,      0.04,
+           0.05,     -0.06,      0.11,     -0.11,      0.02,     -0.02,      0.08,      0.00,
+           0.05,      0.00,     -0.06,      0.08,     -0.07,      0.13,      0.00,     -0.09,
+           0.07,      5.60,     -5.16,     -4.22,     -3.62,     -3.18,     -2.73,      3.76,
+          -3.61,     -1.94,      3.01,      1.76,     -1.48,      1.17,     -1.14,      1.24,
+
+   /* 145-192 */
+           1.23,     -1.15,     -1.08,      1.02,     -0.91,      0.86,      0.74,     -0.83,
+          -0.82,      1.19,     -0.73,      0.66,     -0.64,     -0.59,     -0.59,     -0.63,
+           0.63,      0.62,      0.52,     -0.53,     -0.47,      0.53,      0.52,     -0.44,
+           0.51,      0.45,     -0.48,     -0.42,      0.40,     -0.40,      0.43,      0.42,
+           0.37,      0.41,      0.35,      0.57,      0.39,     -0.37,      0.32,     -0.32,
+          -0.35,      0.29,      0.32,     -0.27,     -0.30,      0.30,     -0.25,     -0.27,
+
+   /* 193-240 */
+          -0.23,     -0.23,     -0.22,      0.23,     -0.22,      0.22,     -0.22,      0.17,
+           0.14,      0.12,      0.00,     -1.84,      1.04,      0.44,     -0.41,      0.30,
+           0.25,      0.23,     -0.13,      0.00,      0.00,      0.00,      0.00,      0.00,
+           0.00,      0.00,      0.00,      0.00,      2.91,      1.14,     -0.90,     -0.84,
+           0.78,      0.68,      0.60,      0.59,     -0.52,      0.51,      0.30,     -0.50,
+          -0.44,     -0.44,     -0.37,     -0.20,      0.21,     -0.33,      0.19,     -0.30,
+
+   /* 241-288 */
+          -0.19,      0.29,     -0.18,      0.18,     -0.17,      0.25,      0.17,      0.25,
+          -0.25,     -0.17,      0.14,      0.16,     -0.15,     -0.14,      0.14,     -0.13,
+          -0.14,     -0.13,     -0.20,     -0.12,      0.19,     -0.13,     -0.11,      0.11,
+           0.11,     -0.11,     -0.10,      0.10,      0.11,     -0.10,      0.14,      0.13,
+           0.10,     -1.32,     -1.28,      0.53,     -0.39,      0.33,      0.18,      0.16,
+          -0.10,      0.12,      0.10,      0.10,      0.10,      0.10,     -0.12,       0.0,
+
+   /* 289-305 */
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+            0.0
+};
+
+/* Y, cos, t^1 */
+static const double yc1[NF1] = {
+
+   /* 1-50 */
+       853.32, -290.91,  -51.26,   48.00,  -28.93,  -67.30,    0.78,    1.41,   -7.06,   29.83,
+        -1.04,    3.20,   -0.01,    0.16,   -0.12,   -1.02,   -1.25,    0.00,   -1.22,    1.00,
+        -0.01,   -0.27,   -0.01,   -4.19,    0.03,   -0.06,    0.01,   -4.56,   -1.24,   -0.02,
+         0.15,    0.13,    0.02,    0.07,    0.06,   -0.01,   -0.09,    0.01,   -0.04,   -0.02,
+        -0.01,    0.01,    0.01,   -0.02,    0.02,    0.01,    0.02,    0.01,    1.77,    0.01,
+
+   /* 51-100 */
+         0.31,   -0.01,   -0.01,   -0.01,    0.01,   -0.01,    0.01,    0.01,    0.01,    0.93,
+        -0.01,   -0.01,    0.02,   -0.01,    0.01,   -0.32,    0.14,   -0.29,    0.02,   -2.14,
+        -0.53,   -1.43,    0.03,    0.39,   -0.19,    0.43,    0.39,   -0.01,    0.37,    0.37,
+        -0.38,   -0.55,    0.01,   -0.27,   -0.26,   -0.11,   -0.07,   -0.24,   -0.01,   -0.30,
+         0.23,    0.19,    0.06,   -0.17,   -0.29,   -0.07,   -0.24,    0.07,   -0.16,   -0.22,
+
+   /* 101-150 */
+         0.15,   -0.09,    0.13,    0.01,   -0.02,   -0.08,   -0.21,    0.03,    0.06,   -0.10,
+         0.06,    0.10,    0.10,    0.10,   -0.02,    0.04,   -0.09,   -0.09,   -0.14,    0.10,
+         0.09,    0.10,    0.08,    0.06,    0.06,   -0.04,   -0.12,    0.05,   -0.04,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 151-200 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 201-250 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 251-300 */
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+          0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,     0.0,
+
+   /* 301-305 */
+          0.0,     0.0,     0.0,     0.0,     0.0
+};
+
+/* X, sin, t^2 */
+static const double xs2[NF2] = {
+
+   /* 1-38 */
+      2037.98,  155.74,   26.92,  -24.43,  -17.36,    6.08,   -8.41,    4.59,    3.57,    2.54,
+        -1.52,    1.46,   -0.75,   -0.69,    0.61,    0.54,    0.46,    0.38,    0.37,   -0.34,
+         0.24,    0.17,    0.18,    0.19,    0.15,   -0.15,    0.00,    0.00,   -0.71,   -0.12,
+         1.86,   -0.75,   -0.56,   -0.35,   -0.31,    0.26,   -0.20,   -0.13
+};
+
+/* X, cos, t^2 */
+static const double xc2[NF2] = {
+
+   /* 1-38 */
+      81.46, -2.75, -0.46,  0.47, -0.50, -1.36,  0.01,  0.17, -0.06,  0.60,
+      -0.07,  0.04, -0.02,  0.02,  0.02, -0.04, -0.02, -0.01, -0.02,  0.01,
+      -0.01,  0.00, -0.01, -0.09,  0.01,  0.00,  0.00,  0.00, -0.01,   0.0,
+        0.0,   0.0,   0.0,   0.0,   0.0,   0.0,   0.0,   0.0
+};
+
+/* Y, sin, t^2 */
+static const double ys2[NF2] = {
+
+   /* 1-38 */
+      120.56,  -1.03,  -0.28,   0.24,   3.57,  -1.19,   0.07,   0.24,  -0.04,  -0.48,
+       -0.10,  -0.02,  -0.04,  -0.05,   0.03,   0.04,  -0.01,  -0.01,  -0.01,   0.01,
+        0.01,   0.02,   0.01,  -0.07,   0.01,   0.01,   0.02,  -0.07,    0.0,    0.0,
+         0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0,    0.0
+};
+
+/* Y, cos, t^2 */
+static const double yc2[NF2] = {
+
+   /* 1-38 */
+      -2301.27,  -143.27,   -24.46,    22.41,    -1.83,    -5.61,     0.17,    -5.02,    -3.23,
+          2.40,     1.73,     1.33,     0.83,    -0.79,    -0.66,     0.61,    -0.41,     0.35,
+         -0.33,     0.31,     0.27,    -0.21,     0.20,    -0.17,    -0.17,    -0.16,     0.08,
+         -0.04,    -0.64,    -0.13,      0.0,      0.0,      0.0,      0.0,      0.0,      0.0,
+           0.0,      0.0
+};
+
+/* X, sin, t^3 */
+static const double xs3[NF3] = {
+
+   /* 1-5 */
+      1.73, 0.00,  0.0,  0.0,  0.0
+};
+
+/* X, cos, t^3 */
+static const double xc3[NF3] = {
+
+   /* 1-5 */
+      -20.39,  -1.27,  -0.22,   0.20,   0.00
+};
+
+/* Y, sin, t^3 */
+static const double ys3[NF3] = {
+
+   /* 1-5 */
+      -15.22,  -1.16,  -0.20,   0.18,   0.13
+};
+
+/* Y, cos, t^3 */
+static const double yc3[NF3] = {
+
+   /* 1-5 */
+      -1.61, -0.01,   0.0,   0.0,   0.0
+};
+
+/* X, sin, t^4 */
+static const double xs4[NF4] = {
+
+   /* 1-1 */
+      -0.10
+};
+
+/* X, cos, t^4 */
+static const double xc4[NF4] = {
+
+   /* 1-1 */
+      -0.02
+};
+
+/* Y, sin, t^4 */
+static const double ys4[NF4] = {
+
+   /* 1-1 */
+      -0.02
+};
+
+/* Y, cos, t^4 */
+static const double yc4[NF4] = {
+
+   /* 1-1 */
+      0.11
+};
+
+/* X then Y, for t^0 to t^4 (microarcsec) */
+static const ascomSERIES XY = {
+   NF, 14, &m[0][0], 21, NULL, NULL, 10,
+   { { 0, NF,  xs0, xc0 },
+     { 0, NF,  ys0, yc0 },
+     { 0, NF1, xs1, xc1 },
+     { 0, NF1, ys1, yc1 },
+     { 0, NF2, xs2, xc2 },
+     { 0, NF2, ys2, yc2 },
+     { 0, NF3, xs3, xc3 },
+     { 0, NF3, ys3, yc3 },
+     { 0, NF4, xs4, xc4 },
+     { 0, NF4, ys4, yc4 } }
+};
+
+void ascomXy06(double date1, double date2, double *x, double *y)
+/*
+**  - - - - - - - - - -
+**   a s c o m X y 0 6
+**  - - - - - - - - - -
+**
+**  X,Y coordinates of celestial intermediate pole from series based
+**  on IAU 2006 precession and IAU 2000A nutation:  as iauXy06.
+**
+**  Given:
+**     date1,date2  double     TT as a 2-part Julian Date
+**
+**  Returned:
+**     x,y          double     CIP X,Y coordinates
+**
+**  Notes:
+**
+**  1) The model and the date conventions are those of iauXy06, which
+**     see.
+**
+**  2) The series are summed by ascomSeries, with compensated summation.
+**     The results agree with iauXy06 to its rounding error.
+**
+**  Called:
+**     iauFal03     mean anomaly of the Moon
+**     iauFalp03    mean anomaly of the Sun
+**     iauFaf03     mean argument of the latitude of the Moon
+**     iauFad03     mean elongation of the Moon from the Sun
+**     iauFaom03    mean longitude of the Moon's ascending node
+**     iauFame03    mean longitude of Mercury
+**     iauFave03    mean longitude of Venus
+**     iauFae03     mean longitude of Earth
+**     iauFama03    mean longitude of Mars
+**     iauFaju03    mean longitude of Jupiter
+**     iauFasa03    mean longitude of Saturn
+**     iauFaur03    mean longitude of Uranus
+**     iauFane03    mean longitude of Neptune
+**     iauFapa03    general accumulated precession in longitude
+**     ascomSeries  evaluate a Poisson/Fourier series
+*/
+{
+   int j, jxy;
+   double t, fa[14], w[10], xypr[2], xyn[2];
+
+
+/* Interval between fundamental date J2000.0 and given date (JC). */
+   t = ((date1 - DJ00) + date2) / DJC;
+
+/* --------------------------------- */
+/* Fundamental arguments (IERS 2003) */
+/* --------------------------------- */
+
+/* Mean anomaly of the Moon. */
+   fa[0] = iauFal03(t);
+
+/* Mean anomaly of the Sun. */
+   fa[1] = iauFalp03(t);
+
+/* Mean argument of the latitude of the Moon. */
+   fa[2] = iauFaf03(t);
+
+/* Mean elongation of the Moon from the Sun. */
+   fa[3] = iauFad03(t);
+
+/* Mean longitude of the ascending node of the Moon. */
+   fa[4] = iauFaom03(t);
+
+/* Planetary longitudes, Mercury through Neptune. */
+   fa[5] = iauFame03(t);
+   fa[6] = iauFave03(t);
+   fa[7] = iauFae03(t);
+   fa[8] = iauFama03(t);
+   fa[9] = iauFaju03(t);
+   fa[10] = iauFasa03(t);
+   fa[11] = iauFaur03(t);
+   fa[12] = iauFane03(t);
+
+/* General accumulated precession in longitude. */
+   fa[13] = iauFapa03(t);
+
+/* ------------------------------------------------ */
+/* Polynomial part and nutation periodic terms, by  */
+/* powers of T                                      */
+/* ------------------------------------------------ */
+
+   ascomSeries(&XY, fa, 0.0, w);
+   for (jxy = 0; jxy < 2; jxy++) {
+      xypr[jxy] = xyp[jxy][MAXPT];
+      xyn[jxy] = 0.0;
+      for (j = MAXPT-1; j >= 0; j--) {
+         xypr[jxy] = xypr[jxy] * t + xyp[jxy][j];
+         xyn[jxy] = xyn[jxy] * t + w[2*j+jxy];
+      }
+   }
+
+/* ------------------------------------ */
+/* Results:  CIP unit vector components */
+/* ------------------------------------ */
+
+   *x = DAS2R * (xypr[0] + xyn[0] / 1e6);
+   *y = DAS2R * (xypr[1] + xyn[1] / 1e6);
+
+}
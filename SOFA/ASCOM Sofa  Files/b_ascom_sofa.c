@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include "ASCOMSofa.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/*
+**  - - - - - - - - - - - - -
+**   b _ a s c o m _ s o f a
+**  - - - - - - - - - - - - -
+**
+**  Time the array entry points of the ASCOM SOFA additions against the
+**  scalar SOFA routines they stand in for, called element by element,
+**  and report the cost per element for lists of several lengths.
+**
+**  Not part of either project.  Link it as t_ascom_sofa.c.  Build it
+**  optimized (Release); the timings are of the native code alone, so
+**  the P/Invoke marshalling that SOFA.vb adds to every call comes on
+**  top of the scalar figures, once per element, and of the array
+**  figures once per list.
+*/
+
+static double now(void)
+/*
+**  Monotonic time (s).
+*/
+{
+#ifdef _WIN32
+   LARGE_INTEGER f, c;
+
+   QueryPerformanceFrequency(&f);
+   QueryPerformanceCounter(&c);
+   return (double) c.QuadPart / (double) f.QuadPart;
+#else
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#endif
+}
+
+#define NMAX 1000
+
+/* Targets and results */
+static double rc[NMAX], dc[NMAX], aob[NMAX], zob[NMAX], hob[NMAX],
+              dob[NMAX], rob[NMAX], ri[NMAX], di[NMAX], u1[NMAX],
+              u2[NMAX], t1[NMAX], t2[NMAX];
+
+/* Site and conditions, as t_sofa_c */
+#define SITE 0.1550675, -0.527800806, -1.2345856, 2738.0, \
+             2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55
+
+/* Keeps the results live */
+static double sink = 0.0;
+
+int main(void)
+{
+   static const int len[] = { 1, 10, 100, 1000 };
+   int k, n, i, r, reps;
+   double utc1, utc2, date1, date2, eo, a1, a2, t0, ts, tv;
+
+
+   utc1 = 2456384.5;
+   utc2 = 0.969254051;
+   date1 = 2456165.5;
+   date2 = 0.401182685;
+   for ( i = 0; i < NMAX; i++ ) {
+      rc[i] = 0.0063 * i;
+      dc[i] = -1.2 + 0.0024 * i;
+      u1[i] = 2451545.0 + 9.37 * i;
+      u2[i] = 0.123;
+   }
+
+   printf("ns per element      n   scalar    array\n");
+   for ( k = 0; k < (int) (sizeof len / sizeof len[0]); k++ ) {
+      n = len[k];
+      reps = 20000 / n + 2;
+
+   /* ICRS to observed. */
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         for ( i = 0; i < n; i++ ) {
+            iauAtco13(rc[i], dc[i], 0.0, 0.0, 0.0, 0.0, utc1, utc2, SITE,
+                      &aob[i], &zob[i], &hob[i], &dob[i], &rob[i], &eo);
+         }
+         sink += aob[0];
+      }
+      ts = (now() - t0) / (reps * (double) n);
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         ascomAtco13v(n, rc, dc, NULL, NULL, NULL, NULL, utc1, utc2, SITE,
+                      aob, zob, hob, dob, rob, &eo);
+         sink += aob[0];
+      }
+      tv = (now() - t0) / (reps * (double) n);
+      printf("Atco13       %6d %8.0f %8.0f\n", n, ts * 1e9, tv * 1e9);
+
+   /* ICRS to CIRS. */
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         for ( i = 0; i < n; i++ ) {
+            iauAtci13(rc[i], dc[i], 0.0, 0.0, 0.0, 0.0, date1, date2,
+                      &ri[i], &di[i], &eo);
+         }
+         sink += ri[0];
+      }
+      ts = (now() - t0) / (reps * (double) n);
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         ascomAtci13v(n, rc, dc, NULL, NULL, NULL, NULL, date1, date2,
+                      ri, di, &eo);
+         sink += ri[0];
+      }
+      tv = (now() - t0) / (reps * (double) n);
+      printf("Atci13       %6d %8.0f %8.0f\n", n, ts * 1e9, tv * 1e9);
+
+   /* CIRS to ICRS. */
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         for ( i = 0; i < n; i++ ) {
+            iauAtic13(ri[i], di[i], date1, date2, &rob[i], &dob[i], &eo);
+         }
+         sink += rob[0];
+      }
+      ts = (now() - t0) / (reps * (double) n);
+      t0 = now();
+      for ( r = 0; r < reps; r++ ) {
+         ascomAtic13v(n, ri, di, date1, date2, rob, dob, &eo);
+         sink += rob[0];
+      }
+      tv = (now() - t0) / (reps * (double) n);
+      printf("Atic13       %6d %8.0f %8.0f\n", n, ts * 1e9, tv * 1e9);
+
+   /* UTC to TT. */
+      t0 = now();
+      for ( r = 0; r < 20 * reps; r++ ) {
+         for ( i = 0; i < n; i++ ) {
+            iauUtctai(u1[i], u2[i], &a1, &a2);
+            iauTaitt(a1, a2, &t1[i], &t2[i]);
+         }
+         sink += t2[0];
+      }
+      ts = (now() - t0) / (20 * reps * (double) n);
+      t0 = now();
+      for ( r = 0; r < 20 * reps; r++ ) {
+         ascomUtcttv(n, u1, u2, t1, t2, NULL);
+         sink += t2[0];
+      }
+      tv = (now() - t0) / (20 * reps * (double) n);
+      printf("Utctai+Taitt %6d %8.0f %8.0f\n", n, ts * 1e9, tv * 1e9);
+   }
+
+   return ( sink == 0.0 );
+
+}
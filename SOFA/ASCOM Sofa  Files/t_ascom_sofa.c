@@ -0,0 +1,934 @@
+#include <stdio.h>
+#include <math.h>
+#include "ASCOMSofa.h"
+
+static int verbose = 0;
+
+/*
+**  - - - - - - - - - - - - -
+**   t _ a s c o m _ s o f a
+**  - - - - - - - - - - - - -
+**
+**  Validate the ASCOM additions to the SOFA library against the SOFA
+**  routines they stand in for, in the manner of t_sofa_c.
+**
+**  Not part of the Sofa Test Application build.  Link it with the same
+**  sources as the Sofa Library project: everything in this folder and
+**  in "Currrent Source Code" except t_sofa_c.c and dat.c (and, other
+**  than on Windows, the pthreads library).
+**
+**  All messages go to stdout; any command-line argument selects verbose
+**  reporting.
+*/
+
+static void viv(int ival, int ivalok,
+                const char *func, const char *test, int *status)
+/*
+**  Validate an integer result (as t_sofa_c).
+*/
+{
+   if (ival != ivalok) {
+      *status = 1;
+      printf("%s failed: %s want %d got %d\n",
+             func, test, ivalok, ival);
+   } else if (verbose) {
+      printf("%s passed: %s want %d got %d\n",
+                    func, test, ivalok, ival);
+   }
+
+}
+
+static void vvd(double val, double valok, double dval,
+                const char *func, const char *test, int *status)
+/*
+**  Validate a double result (as t_sofa_c).
+*/
+{
+   double a, f;   /* absolute and fractional error */
+
+
+   a = val - valok;
+   if (a != 0.0 && fabs(a) > fabs(dval)) {
+      f = fabs(valok / a);
+      *status = 1;
+      printf("%s failed: %s want %.20g got %.20g (1/%.3g)\n",
+             func, test, valok, val, f);
+   } else if (verbose) {
+      printf("%s passed: %s want %.20g got %.20g\n",
+             func, test, valok, val);
+   }
+
+}
+
+static void t_ascomApco13(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m A p c o 1 3
+**  - - - - - - - - - - - - - - -
+**
+**  Test ascomApco13Init and ascomApco13Advance: Earth rotation updates
+**  stay within their reported bound of a full iauApco13, long steps and
+**  steps across a UTC day rebuild in full.
+**
+**  Called:  ascomApco13Init, ascomApco13Advance, iauApco13, iauAtciq,
+**           iauAtioq, iauSeps, viv, vvd
+*/
+{
+   ascomASTROMCTX ctx;
+   iauASTROM full;
+   double utc1, utc2, eo, eo2, err, worst, ri, di, a, z, h1, d1, h2, d2, r;
+   int i, k, j, nera;
+
+
+   utc1 = 2458849.5;
+   utc2 = 0.3;
+   j = ascomApco13Init(1.0, utc1, utc2, 0.2, -2.0, 0.6, 100.0, 1e-7, 2e-7,
+                       1000.0, 10.0, 0.5, 0.55, &ctx, &eo);
+   viv(j, 0, "ascomApco13Init", "j", status);
+   viv(ctx.nfull, 1, "ascomApco13Init", "nfull", status);
+
+/* Earth rotation updates over one second, checked against full rebuilds. */
+   worst = 0.0;
+   for (i = 1; i < 100; i++) {
+      j = ascomApco13Advance(utc1, utc2 + i * 0.01 / 86400.0, &ctx, &eo, &err);
+      iauApco13(utc1, utc2 + i * 0.01 / 86400.0, 0.2, -2.0, 0.6, 100.0,
+                1e-7, 2e-7, 1000.0, 10.0, 0.5, 0.55, &full, &eo2);
+      for (k = 0; k < 20; k++) {
+         iauAtciq(k * 0.3, -1.2 + k * 0.12, 0.0, 0.0, 0.0, 0.0, &ctx.astrom, &ri, &di);
+         iauAtioq(ri, di, &ctx.astrom, &a, &z, &h1, &d1, &r);
+         iauAtciq(k * 0.3, -1.2 + k * 0.12, 0.0, 0.0, 0.0, 0.0, &full, &ri, &di);
+         iauAtioq(ri, di, &full, &a, &z, &h2, &d2, &r);
+         if (iauSeps(h1, d1, h2, d2) - err > worst)
+            worst = iauSeps(h1, d1, h2, d2) - err;
+      }
+   }
+   viv(ctx.nfull, 1, "ascomApco13Advance", "nfull", status);
+   viv(ctx.nera, 99, "ascomApco13Advance", "nera", status);
+   vvd(eo, eo2, 1e-10, "ascomApco13Advance", "eo", status);
+   vvd(worst, 0.0, 0.0, "ascomApco13Advance", "within bound", status);
+
+/* A long step rebuilds. */
+   nera = ctx.nera;
+   j = ascomApco13Advance(utc1, utc2 + 2.0 / 86400.0, &ctx, &eo, &err);
+   viv(ctx.nfull, 2, "ascomApco13Advance", "long step", status);
+   viv(ctx.nera, nera, "ascomApco13Advance", "long step nera", status);
+   vvd(err, 0.0, 0.0, "ascomApco13Advance", "long step err", status);
+
+/* So does a short step across a UTC day. */
+   ascomApco13Init(1.0, 2458849.5, 0.99999, 0.2, -2.0, 0.6, 100.0, 0.0, 0.0,
+                   0.0, 0.0, 0.0, 0.55, &ctx, &eo);
+   ascomApco13Advance(2458849.5, 1.00001, &ctx, &eo, &err);
+   viv(ctx.nfull, 2, "ascomApco13Advance", "day boundary", status);
+
+}
+
+static void t_ascomHd2aev(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m H d 2 a e v
+**  - - - - - - - - - - - - - - -
+**
+**  Test ascomHd2aev and ascomAe2hdv against iauHd2ae, iauHd2pa and
+**  iauAe2hd over the sky, the pole and the zenith.
+**
+**  Called:  ascomHd2aev, ascomAe2hdv, iauHd2ae, iauHd2pa, iauAe2hd, vvd
+*/
+{
+   enum { N = 200 };
+   double ha[N], dec[N], az[N], el[N], pa[N], ha2[N], dec2[N];
+   double phi, a, e, dh, dd, dz, de, dp;
+   int i;
+
+
+   phi = 0.9;
+   for (i = 0; i < N; i++) {
+      ha[i] = -3.1 + i * 0.031;
+      dec[i] = -1.5 + i * 0.015;
+   }
+   ha[0] = 0.0;                  /* zenith */
+   dec[0] = phi;
+   ha[1] = 1.0;                  /* pole */
+   dec[1] = 1.5707963267948966;
+
+   ascomHd2aev(N, phi, ha, dec, az, el, pa);
+   ascomAe2hdv(N, phi, az, el, ha2, dec2);
+   dz = de = dp = dh = dd = 0.0;
+   for (i = 0; i < N; i++) {
+      iauHd2ae(ha[i], dec[i], phi, &a, &e);
+      if (fabs(az[i] - a) > dz) dz = fabs(az[i] - a);
+      if (fabs(el[i] - e) > de) de = fabs(el[i] - e);
+      if (fabs(pa[i] - iauHd2pa(ha[i], dec[i], phi)) > dp)
+         dp = fabs(pa[i] - iauHd2pa(ha[i], dec[i], phi));
+      iauAe2hd(az[i], el[i], phi, &a, &e);
+      if (fabs(ha2[i] - a) > dh) dh = fabs(ha2[i] - a);
+      if (fabs(dec2[i] - e) > dd) dd = fabs(dec2[i] - e);
+   }
+   vvd(dz, 0.0, 1e-14, "ascomHd2aev", "az", status);
+   vvd(de, 0.0, 1e-14, "ascomHd2aev", "el", status);
+   vvd(dp, 0.0, 1e-14, "ascomHd2aev", "pa", status);
+   vvd(dh, 0.0, 1e-14, "ascomAe2hdv", "ha", status);
+   vvd(dd, 0.0, 1e-14, "ascomAe2hdv", "dec", status);
+
+/* Without the parallactic angle. */
+   ascomHd2aev(N, phi, ha, dec, ha2, dec2, NULL);
+   vvd(ha2[N-1], az[N-1], 0.0, "ascomHd2aev", "az, no pa", status);
+   vvd(dec2[N-1], el[N-1], 0.0, "ascomHd2aev", "el, no pa", status);
+
+}
+
+static void t_ascomGc2gdv(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m G c 2 g d v
+**  - - - - - - - - - - - - - - -
+**
+**  Test the geocentric/geodetic arrays against iauGd2gc and iauGc2gd
+**  for each ellipsoid, at latitudes from pole to pole and heights from
+**  -10 km to 100000 km, and at the poles and the geocenter.
+**
+**  Called:  ascomGd2gcv, ascomGc2gdv, ascomGc2gdev, iauGd2gc, iauGc2gd,
+**           viv, vvd
+*/
+{
+#define NGC 1107
+   static double el[NGC], ph[NGC], ht[NGC], xyz[NGC][3],
+                 el2[NGC], ph2[NGC], ht2[NGC];
+   double v[3], e, p, h, ex, ee, ep, eh;
+   int nell, i, j, k;
+
+
+   for (nell = 1; nell <= 3; nell++) {
+
+   /* Latitude by height grid, then the poles and the geocenter. */
+      i = 0;
+      for (j = 0; j <= 180; j++) {
+         for (k = 0; k < 6; k++) {
+            el[i] = 0.1 * i - 3.0;
+            ph[i] = (j - 90) / 57.295779513082321;
+            ht[i] = -1e4 + k * k * k * 8e5;
+            i++;
+         }
+      }
+      for (k = 0; i < NGC - 1; k++, i++) {
+         el[i] = 0.5 * k;
+         ph[i] = (k % 2 ? -1.0 : 1.0) * 1.5707963267948966;
+         ht[i] = (k - 10) * 1e6;
+      }
+      el[i] = ph[i] = ht[i] = 0.0;
+
+   /* Geodetic to geocentric. */
+      viv(ascomGd2gcv(NGC, nell, el, ph, ht, xyz), 0,
+          "ascomGd2gcv", "status", status);
+      ex = 0.0;
+      for (i = 0; i < NGC - 1; i++) {
+         iauGd2gc(nell, el[i], ph[i], ht[i], v);
+         for (k = 0; k < 3; k++) {
+            if (fabs(xyz[i][k] - v[k]) > ex) ex = fabs(xyz[i][k] - v[k]);
+         }
+      }
+      vvd(ex, 0.0, 1e-8, "ascomGd2gcv", "vs iauGd2gc", status);
+      xyz[NGC-1][0] = xyz[NGC-1][1] = xyz[NGC-1][2] = 0.0;
+
+   /* Geocentric to geodetic. */
+      viv(ascomGc2gdv(NGC, nell, xyz, el2, ph2, ht2), 0,
+          "ascomGc2gdv", "status", status);
+      ee = ep = eh = 0.0;
+      for (i = 0; i < NGC; i++) {
+         iauGc2gd(nell, xyz[i], &e, &p, &h);
+         if (fabs(el2[i] - e) > ee) ee = fabs(el2[i] - e);
+         if (fabs(ph2[i] - p) > ep) ep = fabs(ph2[i] - p);
+         if (fabs(ht2[i] - h) > eh) eh = fabs(ht2[i] - h);
+      }
+      vvd(ee, 0.0, 1e-15, "ascomGc2gdv", "vs iauGc2gd elong", status);
+      vvd(ep, 0.0, 1e-15, "ascomGc2gdv", "vs iauGc2gd phi", status);
+      vvd(eh, 0.0, 1e-8, "ascomGc2gdv", "vs iauGc2gd height", status);
+   }
+
+/* Errors. */
+   viv(ascomGc2gdv(1, 0, xyz, el2, ph2, ht2), -1,
+       "ascomGc2gdv", "bad identifier", status);
+   vvd(ph2[0], -1e9, 0.0, "ascomGc2gdv", "bad identifier phi", status);
+   viv(ascomGc2gdev(1, 6378137.0, 1.0, xyz, el2, ph2, ht2), -1,
+       "ascomGc2gdev", "bad f", status);
+   viv(ascomGc2gdev(1, 0.0, 0.0, xyz, el2, ph2, ht2), -2,
+       "ascomGc2gdev", "bad a", status);
+   viv(ascomGd2gcv(1, 4, el, ph, ht, xyz), -1,
+       "ascomGd2gcv", "bad identifier", status);
+   vvd(xyz[0][2], 0.0, 0.0, "ascomGd2gcv", "bad identifier z", status);
+   viv(ascomGd2gcev(1, 6378137.0, 1.0, el, ph, ht, xyz), -1,
+       "ascomGd2gcev", "f of 1", status);
+#undef NGC
+
+}
+
+static void t_ascomFramev(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m F r a m e v
+**  - - - - - - - - - - - - - - -
+**
+**  Test the frame conversion arrays against iauEqec06, iauEceq06,
+**  iauLteqec, iauLteceq, iauIcrs2g and iauG2icrs over the sphere at
+**  three epochs, and the matrix cache.
+**
+**  Called:  ascomFrameInit, ascomFramev, ascomFrameMat, iauEqec06,
+**           iauEceq06, iauLteqec, iauLteceq, iauIcrs2g, iauG2icrs,
+**           iauEpj, viv, vvd
+*/
+{
+#define NFR 703
+   static ascomFRAMECACHE cache;
+   static double a1[NFR], b1[NFR], a2[NFR], b2[NFR];
+   double rm[3][3], a, b, c, d, e[7], date2;
+   int i, j, k;
+
+
+   ascomFrameInit(&cache);
+   for (i = 0; i < NFR; i++) {
+      a1[i] = 0.0179 * i;
+      b1[i] = -1.5707963267948966 + 0.0044684 * i;
+   }
+   b1[0] = 0.0;                    /* on the equator */
+   b1[1] = 1.5707963267948966;     /* at the pole */
+
+   for (k = 0; k < 7; k++) e[k] = 0.0;
+   for (j = 0; j < 3; j++) {
+      date2 = -36525.0 + 36525.0 * j + 0.25;
+      ascomFramev(&cache, ASCOM_FRAME_ICRS, ASCOM_FRAME_ECL06,
+                  2451545.0, date2, NFR, a1, b1, a2, b2);
+      for (i = 0; i < NFR; i++) {
+         iauEqec06(2451545.0, date2, a1[i], b1[i], &a, &b);
+         if (fabs(a2[i] - a) > e[0]) e[0] = fabs(a2[i] - a);
+         if (fabs(b2[i] - b) > e[0]) e[0] = fabs(b2[i] - b);
+      }
+      ascomFramev(&cache, ASCOM_FRAME_ECL06, ASCOM_FRAME_ICRS,
+                  2451545.0, date2, NFR, a1, b1, a2, b2);
+      for (i = 0; i < NFR; i++) {
+         iauEceq06(2451545.0, date2, a1[i], b1[i], &a, &b);
+         if (fabs(a2[i] - a) > e[1]) e[1] = fabs(a2[i] - a);
+         if (fabs(b2[i] - b) > e[1]) e[1] = fabs(b2[i] - b);
+      }
+      ascomFramev(&cache, ASCOM_FRAME_ICRS, ASCOM_FRAME_LTECL,
+                  2451545.0, date2, NFR, a1, b1, a2, b2);
+      for (i = 0; i < NFR; i++) {
+         iauLteqec(iauEpj(2451545.0, date2), a1[i], b1[i], &a, &b);
+         if (fabs(a2[i] - a) > e[2]) e[2] = fabs(a2[i] - a);
+         if (fabs(b2[i] - b) > e[2]) e[2] = fabs(b2[i] - b);
+      }
+      ascomFramev(&cache, ASCOM_FRAME_LTECL, ASCOM_FRAME_ICRS,
+                  2451545.0, date2, NFR, a1, b1, a2, b2);
+      for (i = 0; i < NFR; i++) {
+         iauLteceq(iauEpj(2451545.0, date2), a1[i], b1[i], &a, &b);
+         if (fabs(a2[i] - a) > e[3]) e[3] = fabs(a2[i] - a);
+         if (fabs(b2[i] - b) > e[3]) e[3] = fabs(b2[i] - b);
+      }
+      ascomFramev(&cache, ASCOM_FRAME_ECL06, ASCOM_FRAME_GAL,
+                  2451545.0, date2, NFR, a1, b1, a2, b2);
+      for (i = 0; i < NFR; i++) {
+         iauEceq06(2451545.0, date2, a1[i], b1[i], &c, &d);
+         iauIcrs2g(c, d, &a, &b);
+         if (fabs(iauAnpm(a2[i] - a)) > e[6]) e[6] = fabs(iauAnpm(a2[i] - a));
+         if (fabs(b2[i] - b) > e[6]) e[6] = fabs(b2[i] - b);
+      }
+   }
+   ascomFramev(&cache, ASCOM_FRAME_ICRS, ASCOM_FRAME_GAL,
+               0.0, 0.0, NFR, a1, b1, a2, b2);
+   for (i = 0; i < NFR; i++) {
+      iauIcrs2g(a1[i], b1[i], &a, &b);
+      if (fabs(a2[i] - a) > e[4]) e[4] = fabs(a2[i] - a);
+      if (fabs(b2[i] - b) > e[4]) e[4] = fabs(b2[i] - b);
+   }
+   ascomFramev(&cache, ASCOM_FRAME_GAL, ASCOM_FRAME_ICRS,
+               0.0, 0.0, NFR, a1, b1, a2, b2);
+   for (i = 0; i < NFR; i++) {
+      iauG2icrs(a1[i], b1[i], &a, &b);
+      if (fabs(a2[i] - a) > e[5]) e[5] = fabs(a2[i] - a);
+      if (fabs(b2[i] - b) > e[5]) e[5] = fabs(b2[i] - b);
+   }
+   vvd(e[0], 0.0, 1e-15, "ascomFramev", "vs iauEqec06", status);
+   vvd(e[1], 0.0, 1e-15, "ascomFramev", "vs iauEceq06", status);
+   vvd(e[2], 0.0, 1e-15, "ascomFramev", "vs iauLteqec", status);
+   vvd(e[3], 0.0, 1e-15, "ascomFramev", "vs iauLteceq", status);
+   vvd(e[4], 0.0, 1e-15, "ascomFramev", "vs iauIcrs2g", status);
+   vvd(e[5], 0.0, 1e-15, "ascomFramev", "vs iauG2icrs", status);
+   vvd(e[6], 0.0, 1e-14, "ascomFramev", "ecliptic to galactic", status);
+
+/* Cache:  one build for each ecliptic and epoch. */
+   viv((int) cache.misses, 6, "ascomFramev", "cache misses", status);
+   viv((int) cache.hits, 9, "ascomFramev", "cache hits", status);
+   viv(ascomFrameMat(&cache, ASCOM_FRAME_ICRS, 4, 0.0, 0.0, rm), -1,
+       "ascomFrameMat", "unknown frame", status);
+   viv(ascomFramev(&cache, -1, ASCOM_FRAME_GAL, 0.0, 0.0, 1, a1, b1, a2, b2), -1,
+       "ascomFramev", "unknown frame", status);
+#undef NFR
+
+}
+
+static void t_ascomPlan94v(int *status)
+/*
+**  - - - - - - - - - - - - - - - -
+**   t _ a s c o m P l a n 9 4 v
+**  - - - - - - - - - - - - - - - -
+**
+**  Test ascomPlan94v against iauPlan94 for all the planets over dates
+**  from 1000 to 3000, with remote dates, and a count that is not a
+**  whole number of blocks.
+**
+**  Called:  ascomPlan94v, iauPlan94, viv, vvd
+*/
+{
+#define NPL 733
+   static double d1[NPL], d2[NPL], pv[48*NPL];
+   static int st[NPL];
+   double p[2][3], ep, ev;
+   int i, np, c, j, bad;
+
+
+   for (i = 0; i < NPL; i++) {
+      d1[i] = 2451545.0;
+      d2[i] = -365250.0 + 999.0 * i + 0.3;
+   }
+   d2[NPL-2] = -400000.0;          /* before 1000 */
+   d2[NPL-1] = 400000.0;           /* after 3000 */
+
+   viv(ascomPlan94v(NPL, d1, d2, pv, st), 1, "ascomPlan94v", "j", status);
+   ep = ev = 0.0;
+   bad = 0;
+   for (np = 1; np <= 8; np++) {
+      for (i = 0; i < NPL; i++) {
+         j = iauPlan94(d1[i], d2[i], np, p);
+         if (j != st[i]) bad++;
+         for (c = 0; c < 3; c++) {
+            if (fabs(pv[(6*(np-1)+c)*NPL+i] - p[0][c]) > ep)
+               ep = fabs(pv[(6*(np-1)+c)*NPL+i] - p[0][c]);
+            if (fabs(pv[(6*(np-1)+c+3)*NPL+i] - p[1][c]) > ev)
+               ev = fabs(pv[(6*(np-1)+c+3)*NPL+i] - p[1][c]);
+         }
+      }
+   }
+   viv(bad, 0, "ascomPlan94v", "status vs iauPlan94", status);
+   viv(st[NPL-1], 1, "ascomPlan94v", "remote date", status);
+   vvd(ep, 0.0, 1e-14, "ascomPlan94v", "p vs iauPlan94", status);
+   vvd(ev, 0.0, 1e-16, "ascomPlan94v", "v vs iauPlan94", status);
+
+/* No dates. */
+   viv(ascomPlan94v(0, d1, d2, pv, NULL), 0, "ascomPlan94v", "n=0", status);
+#undef NPL
+
+}
+
+static void t_ascomAtco13v(int *status)
+/*
+**  - - - - - - - - - - - - - - - -
+**   t _ a s c o m A t c o 1 3 v
+**  - - - - - - - - - - - - - - - -
+**
+**  Test the array forms of the "13" astrometry routines against the
+**  SOFA routines called star by star, with and without the space
+**  motion arrays, and a bad date.
+**
+**  Called:  ascomAtco13v, ascomAtci13v, ascomAtio13v, ascomAtoc13v,
+**           ascomAtic13v, ascomAtoi13v, iauAtco13, iauAtci13,
+**           iauAtio13, iauAtoc13, iauAtic13, iauAtoi13, viv, vvd
+*/
+{
+#define NAT 57
+   static double rc[NAT], dc[NAT], pr[NAT], pd[NAT], px[NAT], rv[NAT],
+                 aob[NAT], zob[NAT], hob[NAT], dob[NAT], rob[NAT],
+                 ri[NAT], di[NAT], r2[NAT], d2[NAT];
+   double utc1, utc2, dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+          date1, date2, eo, eo1, a, z, h, d, r;
+   const char *type[3] = { "A", "H", "R" };
+   int i, k, j, bad;
+
+
+   utc1 = 2456384.5;
+   utc2 = 0.969254051;
+   dut1 = 0.1550675;
+   elong = -0.527800806;
+   phi = -1.2345856;
+   hm = 2738.0;
+   xp = 2.47230737e-7;
+   yp = 1.82640464e-6;
+   phpa = 731.0;
+   tc = 12.8;
+   rh = 0.59;
+   wl = 0.55;
+   date1 = 2456165.5;
+   date2 = 0.401182685;
+   for (i = 0; i < NAT; i++) {
+      rc[i] = 0.11 * i;
+      dc[i] = -1.5 + 0.053 * i;
+      pr[i] = -0.354e-6 + 1e-8 * i;
+      pd[i] = 0.595e-8 * i;
+      px[i] = 0.0013 * i;
+      rv[i] = -50.0 + 2.0 * i;
+   }
+
+/* ICRS to observed, with and without space motion. */
+   j = ascomAtco13v(NAT, rc, dc, pr, pd, px, rv, utc1, utc2, dut1,
+                    elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                    aob, zob, hob, dob, rob, &eo);
+   viv(j, 0, "ascomAtco13v", "j", status);
+   bad = 0;
+   for (i = 0; i < NAT; i++) {
+      iauAtco13(rc[i], dc[i], pr[i], pd[i], px[i], rv[i], utc1, utc2, dut1,
+                elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                &a, &z, &h, &d, &r, &eo1);
+      if (aob[i] != a || zob[i] != z || hob[i] != h ||
+          dob[i] != d || rob[i] != r || eo != eo1) bad++;
+   }
+   j = ascomAtco13v(NAT, rc, dc, NULL, NULL, NULL, NULL, utc1, utc2, dut1,
+                    elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                    aob, zob, hob, dob, rob, &eo);
+   for (i = 0; i < NAT; i++) {
+      iauAtco13(rc[i], dc[i], 0.0, 0.0, 0.0, 0.0, utc1, utc2, dut1,
+                elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                &a, &z, &h, &d, &r, &eo1);
+      if (aob[i] != a || zob[i] != z || hob[i] != h ||
+          dob[i] != d || rob[i] != r) bad++;
+   }
+   viv(bad, 0, "ascomAtco13v", "vs iauAtco13", status);
+
+/* ICRS to CIRS and back. */
+   ascomAtci13v(NAT, rc, dc, pr, pd, px, rv, date1, date2, ri, di, &eo);
+   bad = 0;
+   for (i = 0; i < NAT; i++) {
+      iauAtci13(rc[i], dc[i], pr[i], pd[i], px[i], rv[i], date1, date2,
+                &r, &d, &eo1);
+      if (ri[i] != r || di[i] != d || eo != eo1) bad++;
+   }
+   viv(bad, 0, "ascomAtci13v", "vs iauAtci13", status);
+   ascomAtic13v(NAT, ri, di, date1, date2, r2, d2, &eo);
+   bad = 0;
+   for (i = 0; i < NAT; i++) {
+      iauAtic13(ri[i], di[i], date1, date2, &r, &d, &eo1);
+      if (r2[i] != r || d2[i] != d || eo != eo1) bad++;
+   }
+   viv(bad, 0, "ascomAtic13v", "vs iauAtic13", status);
+
+/* CIRS to observed. */
+   j = ascomAtio13v(NAT, ri, di, utc1, utc2, dut1,
+                    elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                    aob, zob, hob, dob, rob);
+   viv(j, 0, "ascomAtio13v", "j", status);
+   bad = 0;
+   for (i = 0; i < NAT; i++) {
+      iauAtio13(ri[i], di[i], utc1, utc2, dut1,
+                elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                &a, &z, &h, &d, &r);
+      if (aob[i] != a || zob[i] != z || hob[i] != h ||
+          dob[i] != d || rob[i] != r) bad++;
+   }
+   viv(bad, 0, "ascomAtio13v", "vs iauAtio13", status);
+
+/* Observed to ICRS and to CIRS, each type of coordinates. */
+   bad = 0;
+   for (k = 0; k < 3; k++) {
+      j = ascomAtoc13v(NAT, type[k], k ? hob : aob, k ? dob : zob,
+                       utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                       phpa, tc, rh, wl, r2, d2);
+      if (j != 0) bad++;
+      for (i = 0; i < NAT; i++) {
+         iauAtoc13(type[k], k ? hob[i] : aob[i], k ? dob[i] : zob[i],
+                   utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                   phpa, tc, rh, wl, &r, &d);
+         if (r2[i] != r || d2[i] != d) bad++;
+      }
+      j = ascomAtoi13v(NAT, type[k], k ? hob : aob, k ? dob : zob,
+                       utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                       phpa, tc, rh, wl, r2, d2);
+      if (j != 0) bad++;
+      for (i = 0; i < NAT; i++) {
+         iauAtoi13(type[k], k ? hob[i] : aob[i], k ? dob[i] : zob[i],
+                   utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                   phpa, tc, rh, wl, &r, &d);
+         if (r2[i] != r || d2[i] != d) bad++;
+      }
+   }
+   viv(bad, 0, "ascomAtoc13v", "vs iauAtoc13, iauAtoi13", status);
+
+/* Bad date. */
+   aob[0] = -1.0;
+   j = ascomAtco13v(1, rc, dc, NULL, NULL, NULL, NULL, -1e9, 0.0, dut1,
+                    elong, phi, hm, xp, yp, phpa, tc, rh, wl,
+                    aob, zob, hob, dob, rob, &eo);
+   viv(j, -1, "ascomAtco13v", "bad date", status);
+   vvd(aob[0], -1.0, 0.0, "ascomAtco13v", "bad date aob", status);
+#undef NAT
+
+}
+
+static void t_ascomUtcttv(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m U t c t t v
+**  - - - - - - - - - - - - - - -
+**
+**  Test the time scale arrays against the SOFA routines called date by
+**  date, across leap seconds, with a dubious year and a bad date.
+**
+**  Called:  ascomDtf2dv, ascomUtcttv, ascomTtutcv, iauDtf2d,
+**           iauUtctai, iauTaitt, iauTttai, iauTaiutc, viv
+*/
+{
+#define NUT 200
+   static int iy[NUT], im[NUT], id[NUT], ihr[NUT], imn[NUT], js[NUT];
+   static double sec[NUT], u1[NUT], u2[NUT], t1[NUT], t2[NUT],
+                 v1[NUT], v2[NUT];
+   double a1, a2, b1, b2, c1, c2;
+   int i, j, bad;
+
+
+   for (i = 0; i < NUT; i++) {
+      iy[i] = 1961 + i / 3;
+      im[i] = (i % 2) ? 12 : 6;
+      id[i] = (i % 2) ? 31 : 30;
+      ihr[i] = 23;
+      imn[i] = 59;
+      sec[i] = 59.0 + 0.0037 * i;
+   }
+   iy[NUT-2] = 2090;               /* dubious */
+   im[NUT-1] = 13;                 /* bad month */
+
+   viv(ascomDtf2dv("UTC", NUT, iy, im, id, ihr, imn, sec, u1, u2, js), -2,
+       "ascomDtf2dv", "j", status);
+   bad = 0;
+   for (i = 0; i < NUT - 1; i++) {
+      j = iauDtf2d("UTC", iy[i], im[i], id[i], ihr[i], imn[i], sec[i],
+                   &a1, &a2);
+      if (j != js[i] || a1 != u1[i] || a2 != u2[i]) bad++;
+   }
+   viv(bad, 0, "ascomDtf2dv", "vs iauDtf2d", status);
+   viv(js[NUT-2], 1, "ascomDtf2dv", "dubious year", status);
+   viv(js[NUT-1], -2, "ascomDtf2dv", "bad month", status);
+
+   u1[NUT-1] = -1e9;               /* unacceptable */
+   u2[NUT-1] = 0.0;
+   viv(ascomUtcttv(NUT, u1, u2, t1, t2, js), -1,
+       "ascomUtcttv", "j", status);
+   bad = 0;
+   for (i = 0; i < NUT - 1; i++) {
+      j = iauUtctai(u1[i], u2[i], &a1, &a2);
+      iauTaitt(a1, a2, &b1, &b2);
+      if (j != js[i] || b1 != t1[i] || b2 != t2[i]) bad++;
+   }
+   viv(bad, 0, "ascomUtcttv", "vs iauUtctai, iauTaitt", status);
+   viv(js[NUT-1], -1, "ascomUtcttv", "unacceptable date", status);
+
+   viv(ascomTtutcv(NUT - 1, t1, t2, v1, v2, NULL), 1,
+       "ascomTtutcv", "j", status);
+   bad = 0;
+   for (i = 0; i < NUT - 1; i++) {
+      iauTttai(t1[i], t2[i], &a1, &a2);
+      iauTaiutc(a1, a2, &c1, &c2);
+      if (c1 != v1[i] || c2 != v2[i]) bad++;
+   }
+   viv(bad, 0, "ascomTtutcv", "vs iauTttai, iauTaiutc", status);
+#undef NUT
+
+}
+
+static void t_ascomStarpmv(int *status)
+/*
+**  - - - - - - - - - - - - - - - -
+**   t _ a s c o m S t a r p m v
+**  - - - - - - - - - - - - - - - -
+**
+**  Test ascomStarpmv against iauStarpm and iauPmsafe star by star,
+**  including zero parallax, excessive speed and stars at the pole,
+**  split over several threads; and the linear model.
+**
+**  Called:  ascomStarpmv, iauStarpm, iauPmsafe, viv, vvd
+*/
+{
+   enum { N = 10000 };
+   static double in[6][N], out[6][N], ref[6];
+   static int st[N];
+   double worst, e;
+   int i, k, f, j, bad, nbad, nref;
+
+
+   for (i = 0; i < N; i++) {
+      in[0][i] = fmod(i * 0.7853, 6.2831853);
+      in[1][i] = -1.5 + fmod(i * 0.3217, 3.0);
+      in[2][i] = ((i % 13) - 6) * 1e-6;
+      in[3][i] = ((i % 7) - 3) * 2e-6;
+      in[4][i] = (i % 11) * 0.01;
+      in[5][i] = ((i % 17) - 8) * 20.0;
+      if (i % 101 == 0) in[2][i] = 1e-1;                    /* too fast */
+      if (i % 103 == 0) in[1][i] = 1.5707963267948966;      /* pole */
+   }
+
+   for (f = 0; f < 2; f++) {
+      nbad = ascomStarpmv(N, f ? ASCOM_PM_SAFE : 0, 3,
+                          in[0], in[1], in[2], in[3], in[4], in[5],
+                          2451545.0, 0.0, 2451545.0, 9131.25,
+                          out[0], out[1], out[2], out[3], out[4], out[5], st);
+      bad = nref = 0;
+      worst = 0.0;
+      for (i = 0; i < N; i++) {
+         j = f ? iauPmsafe(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i], in[5][i],
+                           2451545.0, 0.0, 2451545.0, 9131.25,
+                           &ref[0], &ref[1], &ref[2], &ref[3], &ref[4], &ref[5])
+               : iauStarpm(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i], in[5][i],
+                           2451545.0, 0.0, 2451545.0, 9131.25,
+                           &ref[0], &ref[1], &ref[2], &ref[3], &ref[4], &ref[5]);
+         bad += (j != st[i]);
+         nref += (j != 0);
+         for (k = 0; k < 6; k++) {
+            e = fabs(out[k][i] - ref[k]) / (fabs(ref[k]) > 1.0 ? fabs(ref[k]) : 1.0);
+            if (e > worst) worst = e;
+         }
+      }
+      viv(bad, 0, "ascomStarpmv", f ? "safe status" : "status", status);
+      viv(nbad, nref, "ascomStarpmv", f ? "safe count" : "count", status);
+      vvd(worst, 0.0, 1e-14, "ascomStarpmv", f ? "safe values" : "values", status);
+   }
+
+/* Linear model: ten years at the catalog rates. */
+   ascomStarpmv(N, ASCOM_PM_LINEAR, 1, in[0], in[1], in[2], in[3], in[4], in[5],
+                2451545.0, 0.0, 2451545.0, 3652.5,
+                out[0], out[1], out[2], out[3], out[4], out[5], st);
+   vvd(out[0][1], in[0][1] + 10.0 * in[2][1], 1e-15, "ascomStarpmv", "linear ra", status);
+   vvd(out[1][1], in[1][1] + 10.0 * in[3][1], 1e-15, "ascomStarpmv", "linear dec", status);
+   vvd(out[4][1], in[4][1], 0.0, "ascomStarpmv", "linear px", status);
+   viv(st[1], 0, "ascomStarpmv", "linear status", status);
+
+}
+
+static void t_ascomSeries(int *status)
+/*
+**  - - - - - - - - - - - - - - -
+**   t _ a s c o m S e r i e s
+**  - - - - - - - - - - - - - - -
+**
+**  Test the ports of the SOFA series routines to the series evaluator:
+**  the t_sofa_c cases with the t_sofa_c tolerances, then agreement with
+**  the SOFA routines every 73 days over 1800-2200.
+**
+**  Called:  ascomNut00a, ascomXy06, ascomS06, ascomEect00, ascomDtdb,
+**           iauNut00a, iauXy06, iauS06, iauEect00, iauDtdb, vvd
+*/
+{
+   double dpsi, deps, x, y, d, r1, r2, e[7];
+   int i, k;
+
+
+/* The t_sofa_c cases. */
+   ascomNut00a(2400000.5, 53736.0, &dpsi, &deps);
+   vvd(dpsi, -0.9630909107115518431e-5, 1e-13, "ascomNut00a", "dpsi", status);
+   vvd(deps,  0.4063239174001678710e-4, 1e-13, "ascomNut00a", "deps", status);
+
+   ascomXy06(2400000.5, 53736.0, &x, &y);
+   vvd(x, 0.5791308486706010975e-3, 1e-15, "ascomXy06", "x", status);
+   vvd(y, 0.4020579816732958141e-4, 1e-16, "ascomXy06", "y", status);
+
+   vvd(ascomS06(2400000.5, 53736.0, 0.5791308486706011000e-3,
+                0.4020579816732961219e-4),
+       -0.1220032213076463117e-7, 1e-18, "ascomS06", "", status);
+
+   vvd(ascomEect00(2400000.5, 53736.0), 0.2046085004885125264e-8, 1e-20,
+       "ascomEect00", "", status);
+
+   vvd(ascomDtdb(2448939.5, 0.123, 0.76543, 5.0123, 5525.242, 3190.0),
+       -0.1280368005936998991e-2, 1e-15, "ascomDtdb", "", status);
+
+/* Against the SOFA routines:  worst differences. */
+   for (k = 0; k < 7; k++) e[k] = 0.0;
+   for (i = 0; i <= 2000; i++) {
+      d = -73000.0 + 73.0 * i + 0.3;
+
+      ascomNut00a(2451545.0, d, &dpsi, &deps);
+      iauNut00a(2451545.0, d, &r1, &r2);
+      if (fabs(dpsi - r1) > e[0]) e[0] = fabs(dpsi - r1);
+      if (fabs(deps - r2) > e[1]) e[1] = fabs(deps - r2);
+
+      ascomXy06(2451545.0, d, &x, &y);
+      iauXy06(2451545.0, d, &r1, &r2);
+      if (fabs(x - r1) > e[2]) e[2] = fabs(x - r1);
+      if (fabs(y - r2) > e[3]) e[3] = fabs(y - r2);
+
+      r1 = fabs(ascomS06(2451545.0, d, x, y) - iauS06(2451545.0, d, x, y));
+      if (r1 > e[4]) e[4] = r1;
+
+      r1 = fabs(ascomEect00(2451545.0, d) - iauEect00(2451545.0, d));
+      if (r1 > e[5]) e[5] = r1;
+
+      r1 = fabs(ascomDtdb(2451545.0, d, 0.3, 0.1, 5000.0, 3000.0) -
+                iauDtdb(2451545.0, d, 0.3, 0.1, 5000.0, 3000.0));
+      if (r1 > e[6]) e[6] = r1;
+   }
+   vvd(e[0], 0.0, 1e-18, "ascomNut00a", "vs iauNut00a dpsi", status);
+   vvd(e[1], 0.0, 1e-18, "ascomNut00a", "vs iauNut00a deps", status);
+   vvd(e[2], 0.0, 1e-17, "ascomXy06", "vs iauXy06 x", status);
+   vvd(e[3], 0.0, 1e-17, "ascomXy06", "vs iauXy06 y", status);
+   vvd(e[4], 0.0, 1e-20, "ascomS06", "vs iauS06", status);
+   vvd(e[5], 0.0, 1e-22, "ascomEect00", "vs iauEect00", status);
+   vvd(e[6], 0.0, 1e-18, "ascomDtdb", "vs iauDtdb", status);
+
+}
+
+static void t_ascomSeriesMode(int *status)
+/*
+**  - - - - - - - - - - - - - - - - - - -
+**   t _ a s c o m S e r i e s M o d e
+**  - - - - - - - - - - - - - - - - - - -
+**
+**  Test the selection of the series evaluation mode, and that the
+**  harmonics mode agrees with the library mode every 73 days over
+**  1800-2200.
+**
+**  Called:  ascomSeriesMode, ascomNut00a, ascomXy06, ascomS06,
+**           ascomEect00, viv, vvd
+*/
+{
+   double d, a[6], h[6], e[6];
+   int i, k;
+
+
+/* Mode selection. */
+   viv(ascomSeriesMode(ASCOM_SERIES_HARMONICS), ASCOM_SERIES_LIBM,
+       "ascomSeriesMode", "default", status);
+   viv(ascomSeriesMode(-1), ASCOM_SERIES_HARMONICS,
+       "ascomSeriesMode", "set", status);
+   viv(ascomSeriesMode(ASCOM_SERIES_LIBM), ASCOM_SERIES_HARMONICS,
+       "ascomSeriesMode", "invalid", status);
+
+/* Harmonics against library:  worst differences. */
+   for (k = 0; k < 6; k++) e[k] = 0.0;
+   for (i = 0; i <= 2000; i++) {
+      d = -73000.0 + 73.0 * i + 0.3;
+
+      ascomNut00a(2451545.0, d, &a[0], &a[1]);
+      ascomXy06(2451545.0, d, &a[2], &a[3]);
+      a[4] = ascomS06(2451545.0, d, a[2], a[3]);
+      a[5] = ascomEect00(2451545.0, d);
+
+      ascomSeriesMode(ASCOM_SERIES_HARMONICS);
+      ascomNut00a(2451545.0, d, &h[0], &h[1]);
+      ascomXy06(2451545.0, d, &h[2], &h[3]);
+      h[4] = ascomS06(2451545.0, d, a[2], a[3]);
+      h[5] = ascomEect00(2451545.0, d);
+      ascomSeriesMode(ASCOM_SERIES_LIBM);
+
+      for (k = 0; k < 6; k++) {
+         if (fabs(h[k] - a[k]) > e[k]) e[k] = fabs(h[k] - a[k]);
+      }
+   }
+   vvd(e[0], 0.0, 1e-18, "ascomNut00a", "harmonics dpsi", status);
+   vvd(e[1], 0.0, 1e-18, "ascomNut00a", "harmonics deps", status);
+   vvd(e[2], 0.0, 1e-17, "ascomXy06", "harmonics x", status);
+   vvd(e[3], 0.0, 1e-17, "ascomXy06", "harmonics y", status);
+   vvd(e[4], 0.0, 1e-20, "ascomS06", "harmonics", status);
+   vvd(e[5], 0.0, 1e-22, "ascomEect00", "harmonics", status);
+
+}
+
+static void t_ascomDtdbTab(int *status)
+/*
+**  - - - - - - - - - - - - - - - -
+**   t _ a s c o m D t d b T a b
+**  - - - - - - - - - - - - - - - -
+**
+**  Test the array form of ascomDtdb, and the TDB-TT table against
+**  ascomDtdb at 2001 dates and local solar times over a year.
+**
+**  Called:  ascomDtdbv, ascomDtdbTabInit, ascomDtdbTab, ascomDtdbTabv,
+**           ascomDtdb, viv, vvd
+*/
+{
+   static ascomDTDBTAB tab;
+   double d1[3], d2[3], ut[3], w[3], e, r;
+   int i, j;
+
+
+/* Array form. */
+   for (i = 0; i < 3; i++) {
+      d1[i] = 2448939.5;
+      d2[i] = 0.123 + 1000.0 * i;
+      ut[i] = 0.76543 - 0.1 * i;
+   }
+   ascomDtdbv(3, d1, d2, ut, 5.0123, 5525.242, 3190.0, w);
+   for (i = 0; i < 3; i++) {
+      vvd(w[i], ascomDtdb(d1[i], d2[i], ut[i], 5.0123, 5525.242, 3190.0),
+          0.0, "ascomDtdbv", "", status);
+   }
+
+/* A year's table, default tolerance. */
+   j = ascomDtdbTabInit(2460000.5, 0.25, 365.0, 0.0,
+                        5.0123, 5525.242, 3190.0, &tab);
+   viv(j, 0, "ascomDtdbTabInit", "status", status);
+   vvd(tab.tol, 1e-10, 0.0, "ascomDtdbTabInit", "tol", status);
+   vvd(tab.err, 0.0, 1e-10, "ascomDtdbTabInit", "err", status);
+
+   e = 0.0;
+   for (i = 0; i <= 2000; i++) {
+      r = 0.25 + 365.0 * i / 2000.0;
+      j = ascomDtdbTab(&tab, 2460000.5, r, 0.377 * i, &w[0]);
+      if (j) viv(j, 0, "ascomDtdbTab", "in range", status);
+      w[1] = ascomDtdb(2460000.5, r, 0.377 * i, 5.0123, 5525.242, 3190.0);
+      if (fabs(w[0] - w[1]) > e) e = fabs(w[0] - w[1]);
+   }
+   vvd(e, 0.0, 1e-10, "ascomDtdbTab", "vs ascomDtdb", status);
+
+/* Outside the interval:  the series itself. */
+   d1[0] = d1[1] = d1[2] = 2460000.5;
+   d2[0] = 0.2;
+   d2[1] = 100.0;
+   d2[2] = 365.3;
+   viv(ascomDtdbTabv(&tab, 3, d1, d2, ut, w), 2,
+       "ascomDtdbTabv", "outside", status);
+   vvd(w[0], ascomDtdb(d1[0], d2[0], ut[0], 5.0123, 5525.242, 3190.0),
+       0.0, "ascomDtdbTabv", "before", status);
+   vvd(w[2], ascomDtdb(d1[2], d2[2], ut[2], 5.0123, 5525.242, 3190.0),
+       0.0, "ascomDtdbTabv", "after", status);
+
+/* Errors. */
+   viv(ascomDtdbTabInit(2460000.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, &tab), -1,
+       "ascomDtdbTabInit", "no interval", status);
+   viv(ascomDtdbTabInit(2460000.5, 0.0, 5000.0, 0.0, 0.0, 0.0, 0.0, &tab), -2,
+       "ascomDtdbTabInit", "too long", status);
+
+}
+
+int main(int argc, char *argv[])
+/*
+**  - - - - -
+**   m a i n
+**  - - - - -
+*/
+{
+   int status;
+
+
+/* If any command-line argument, switch to verbose reporting. */
+   if (argc > 1) {
+      verbose = 1;
+      argv[0][0] += 0;    /* to avoid compiler warnings */
+   }
+
+/* Preset the &status to FALSE = success. */
+   status = 0;
+
+/* Test the ASCOM additions. */
+   t_ascomApco13(&status);
+   t_ascomHd2aev(&status);
+   t_ascomGc2gdv(&status);
+   t_ascomFramev(&status);
+   t_ascomPlan94v(&status);
+   t_ascomAtco13v(&status);
+   t_ascomUtcttv(&status);
+   t_ascomStarpmv(&status);
+   t_ascomSeries(&status);
+   t_ascomSeriesMode(&status);
+   t_ascomDtdbTab(&status);
+
+/* Report, set up an appropriate exit status, and finish. */
+   if (status) {
+      printf("t_ascom_sofa validation failed!\n");
+   } else {
+      printf("t_ascom_sofa validation successful\n");
+   }
+   return status;
+}
@@ -60,14 +60,22 @@
 //						expanded telescope interface)
 // 23-Nov-05	MK		Added bV10Flag and made sure that RefreshTelescopePanel 
 //						and SlewLimits are called only if SNP V5 and above is used
+// 17-Oct-26	asc		Replace the fixed 1 second doIdle() update with
+//						IdleScheduler: read rate follows the mount state,
+//						crosshair predicted from the tracking rates between
+//						reads. Reset it after every scope command.
 //========================================================================
 #include "AscomScope.h"
 #pragma hdrstop
 #include <math.h>
 #include <time.h>
+#include "IdleScheduler.h"
 
-#define FAST_UPDATE_MS 1000				// Update interval when scope is alive
+#define SLEW_UPDATE_MS 500				// Position interval while slewing or being moved
+#define TRACK_UPDATE_MS 3000			// Position interval while tracking or stopped
+#define PARK_UPDATE_MS 10000			// Park state interval while parked
 #define SLOW_UPDATE_MS 5000				// Slow item update interval
+#define REDRAW_DEG 0.003				// Redraw when the crosshair moves 10 arcsec
 
 //
 // wID values for right-click menus we add
@@ -137,6 +145,8 @@ SPSPROC _psn_SetPluginStatusText;
 NOARGPROC _psn_RefreshPanel;
 CBPBPROC _psn_GetAreCoordinatesWithinUserSlewLimits;
 
+static IdleScheduler _sched;			// When doIdle() reads the driver
+
 // ==========
 // MAIN ENTRY
 // ==========
@@ -222,6 +232,7 @@ static short initPlugin(PInitialize* p)
 //	p->fWantsAllEvents = true;			// Wa want mouse clix in window	(Abort on click, see below)
 
 	InitDrivers();
+	_sched.SetIntervals(SLEW_UPDATE_MS, TRACK_UPDATE_MS, PARK_UPDATE_MS, SLOW_UPDATE_MS);
 
 	return(0);
 }
@@ -478,16 +489,129 @@ static void doFOV(PIndicator *p)
 	p->fHorizontal = 0.0;
 }
 
+// ---------
+// autoTrack
+// ---------
+//
+// Auto-track logic (or start-up centering), for a new scope position
+// in _dScopeRA/_dScopeDec, whether read or predicted.
+//
+static void autoTrack(PEvent *p)
+{
+	if(_bAutoTrack || _bStartCenter)
+	{
+		static PCentreAction pc;			// WARNING! Not thread safe!
+		double dr;
+		double dd;
+		double d;
+
+		//
+		// Algorithm: If the cursor has moved more than 1/4
+		// of the "minimum" FOV (in _dMinFOV, deg.) then
+		// we recenter. NOTE: This is a POOR approximation
+		// for wide gazes, where the mapping from RA/Dec to 
+		// gaze alt/az is REALLY curved. Therefore, if the 
+		// gazeFOV is > 30, we just step every 15 deg. The 
+		// angular motion of RA is 15 deg/hr at the celestial 
+		// equator, reduce by the cos(dec). Use the midpoint
+		// of the old and new dec.
+		//
+		// Panning: If the delta position is "small" then pan,
+		// otherwise jump.
+		//
+		// Always move to center on startup if _bStartCenter
+		//
+		dr = ((_dScopeRA - _dRAPrev) * 15.0) * 
+						cos(((_dScopeDec + _dDecPrev) / 2.0) * RAD_PER_DEG);
+		dd = (_dScopeDec - _dDecPrev);
+		d = sqrt((dr * dr) + (dd * dd));	// Distance moved
+		if(_bStartCenter || (d > (_dMinFOV / 4.0)))	 // If starting or moved to auto-center distance
+		{									// ... then re-center
+			_bStartCenter = false;			// (no more start centering)
+			pc.fRightAscension = _dScopeRA * RAD_PER_HR;// New centre point coords
+			pc.fDeclination = _dScopeDec * RAD_PER_DEG;
+			pc.fUseCustomPan = true;		// Override SN ...
+			if(_bStartCenter || (d > (_dMinFOV / 2.0)))	// If starting or large jump
+				pc.fPan = false;			// No panning, jump
+			else							// Small jump
+				pc.fPan = true;				// pan for beauty
+			pc.fAdjustFOV = false;			// Never change FOV
+			//pc.fNewFOV = _dGazeFOVRad;
+			p->fOutOperation = out_CentrePoint;
+			p->fOutParams = &pc;
+			_dRAPrev = _dScopeRA;
+			_dDecPrev = _dScopeDec;
+		}
+		else if(d > REDRAW_DEG)				// If moved more than 10 arcsec,
+		{
+			p->fOutOperation = out_Update;	// Update to draw telrad
+		}
+	}
+	else									// Not auto-track, draw telrad
+	{
+		_dRAPrev	= coordinate_NotAvailable;	// (also reset auto-track tests)
+		_dDecPrev	= coordinate_NotAvailable;
+		p->fOutOperation = out_Update;		// Force screen update for telrad
+	}
+}
+
+// ----------
+// readStatus
+// ----------
+//
+// The slow items: park state, tracking and the tracking rates. Tracking
+// and the rates are optional.
+//
+static void readStatus(DWORD t, char *buf, char *buf2)
+{
+	bool bParked = (_bScopeCanPark && GetParked());
+	bool bTracking = true;
+	double dRARate = 0.0;
+	double dDecRate = 0.0;
+
+	if(bParked)
+	{
+		cToPstr("Telescope is parked.", (unsigned char*)buf);
+		cToPstr( "The telescope is currently parked. To move the telescope click 'Unpark'.", (unsigned char*)buf2);
+		
+		(*_psn_SetPluginStatusText)((unsigned char*)buf, (unsigned char*)buf2, coordinate_NotAvailable, coordinate_NotAvailable);
+	}
+	else
+	{
+		__try
+		{
+			bTracking = GetTracking();
+			if(bTracking)
+			{
+				dRARate = GetRightAscensionRate();
+				dDecRate = GetDeclinationRate();
+			}
+		}
+		__except(EXCEPTION_EXECUTE_HANDLER)
+		{
+			if(GetExceptionCode() != EXCEP_NOTIMPL)	
+				ABORT;								// Signal an error
+		}
+	}
+	_sched.Status(t, bParked, bTracking, dRARate, dDecRate);
+}
+
 // ------
 // doIdle
 // ------
 //
+// _sched decides when the driver is read: every SLEW_UPDATE_MS while
+// slewing or being moved, every TRACK_UPDATE_MS while tracking or
+// stopped, park and tracking state every SLOW_UPDATE_MS. In between,
+// the crosshair follows the predicted position and the window is only
+// redrawn when that has moved REDRAW_DEG.
+//
 static short doIdle(PEvent *p)
 {
-	static DWORD tn = 0;							// Tix for next update (0 = force update)
-	static DWORD tnSlow = 0;						// Tix 
 	DWORD t = GetTickCount();
 	short iRes = 0;									// Assume success (our retval)
+	double dRA;
+	double dDec;
 	char buf[256];
 	char buf2[256];
 
@@ -623,178 +747,134 @@ static short doIdle(PEvent *p)
 		sn_SetOrientation(_pWnd, kOrientationLocal);
 		//sn_SaveAsWindow(_pWnd, 0, 0, (unsigned char *)buf2);
 		sn_ImmediateUpdateWindow(_pWnd);
-		tn = 0;										// Force update stuff below
+		_sched.Reset();								// Read everything below
 	}
 
 
 	//
-	// FAST UPDATE ITEMS
+	// SCHEDULED UPDATES
 	//
-	// We control the rate of updating here! If time stepping (or real time)
-	// is on, Starry Night issues an update at the step rate. BUT if neither
-	// is active, we need to force updates here in order to properly display
-	// the telrad.
+	// If time stepping (or real time) is on, Starry Night issues an update
+	// at the step rate. BUT if neither is active, we need to force updates
+	// here in order to properly display the telrad.
 	//
-	if((t > tn))	//&& (p->fInWindow == _pWnd))			// If update interval has elapsed
+	__try
 	{
-		__try
+		if(_sched.StatusDue(t))
+			readStatus(t, buf, buf2);
+		if(_sched.State() == IdleScheduler::IS_PARKED)
+			return(0);								// Nothing moves while parked
+
+		if(!_sched.PositionDue(t))
 		{
+			//
+			// Between reads. Move the crosshair along the predicted path,
+			// but only bother Starry Night when it has visibly moved.
+			//
+			double dr;
+			double dd;
+
+			if((_dScopeRA == coordinate_NotAvailable) || !_sched.Predict(t, dRA, dDec))
+				return(0);
+			dr = (dRA - _dScopeRA) * 15.0;
+			if(dr > 180.0)							// Across 0h
+				dr -= 360.0;
+			else if(dr < -180.0)
+				dr += 360.0;
+			dr *= cos(dDec * RAD_PER_DEG);
+			dd = dDec - _dScopeDec;
+			if(sqrt((dr * dr) + (dd * dd)) < REDRAW_DEG)
+				return(0);
+			_dScopeRA = dRA;
+			_dScopeDec = dDec;
+			autoTrack(p);
+			return(0);
+		}
 
-			//If the telescope was slewing and it's status changed then refresh the panel
-			if (_bIsSlewing && (!IsSlewing()))
-			{
-				_bIsSlewing = false; //changed the slewing status flag since staus has just changed
-				if (_bV10Plugin)
-					(*_psn_RefreshPanel)();
-			}
+		//If the telescope was slewing and it's status changed then refresh the panel
+		if (_bIsSlewing && (!IsSlewing()))
+		{
+			_bIsSlewing = false; //changed the slewing status flag since staus has just changed
+			if (_bV10Plugin)
+				(*_psn_RefreshPanel)();
+		}
+
+		if(_bScopeHasEqu)						// If we can get RA/Dec
+		{
+			//make sure that while scope is being asked for info no other queries are taking place
+			_bScopeActive = false;
+			_dScopeRA = GetRightAscension();	// Get it!
+			_dScopeDec = GetDeclination();
+			_bScopeActive = true;
+		}
+		else									// Can only get Alt/Az ...
+		{										// Convert using the SN window location			
+			PSphericalCoordinates sphereCoords;
+			PSphericalCoordinates raDec;
+			PXYZCoordinates xyzAltAzCoords;
+			PXYZCoordinates xyzRaDecCoords;
+
+			if(sn_RealWorldAzimuth2Mathematical((GetAzimuth() * RAD_PER_DEG), 
+												&sphereCoords.ra) != snNoErr)
+				drvFail("Azimuth conversion failed", NULL, true);
+			sphereCoords.dec = GetAltitude() * RAD_PER_DEG;
+			sphereCoords.radius = 1.0;
+			if(sn_SphericalToXYZ(sphereCoords, &xyzAltAzCoords) != snNoErr)
+				drvFail("Spherical to XYZ conversion failed", NULL, true);
+			if(sn_CoordinateConversion(_pWnd, 
+											kSNAltAzSystem,
+											kSNCelestialJNowSystem, 
+											xyzAltAzCoords, 
+											&xyzRaDecCoords) != snNoErr)
+				drvFail("Local to Equatorial coordinate conversion failed", NULL, true);
+			if(sn_XYZToSpherical(xyzRaDecCoords, &raDec) != snNoErr)
+				drvFail("XYZ to spherical conversion failed", NULL, true);
+			_dScopeRA = raDec.ra * HR_PER_RAD;
+			_dScopeDec = raDec.dec * DEG_PER_RAD;
+		}
+		_sched.Position(t, _dScopeRA, _dScopeDec, _bIsSlewing);
 
-			//update parked information
-			if (_bScopeCanPark && GetParked())
+		//
+		// Refresh the V4 status window.
+		//
+		if(_bV8Plugin)								// Fill in status box on SNP V4
+		{
+			if ((_dScopeRA == coordinate_NotAvailable) && (_dScopeDec == coordinate_NotAvailable))
 			{
-				cToPstr("Telescope is parked.", (unsigned char*)&buf);
-				cToPstr( "The telescope is currently parked. To move the telescope click 'Unpark'.", (unsigned char*)&buf2);
-				
-				(*_psn_SetPluginStatusText)((unsigned char*)&buf, (unsigned char*)&buf2, coordinate_NotAvailable, coordinate_NotAvailable);
+				cToPstr("Cannot communicate with the telescope", (unsigned char*)&buf);
+				cToPstr( "Couldn't get the telescope position! Check your system to make sure no cables got unplugged, your interface is turned on, and your batteries are okay.", (unsigned char*)&buf2);
+				(*_psn_SetPluginStatusText)((unsigned char*)&buf, (unsigned char*)&buf2, 
+													_dScopeRA, 
+													_dScopeDec);
 			}
 			else
 			{
-				if(_bScopeHasEqu)						// If we can get RA/Dec
-				{
-					//make sure that while scope is being asked for info no other queries are taking place
-					_bScopeActive = false;
-					_dScopeRA = GetRightAscension();	// Get it!
-					_dScopeDec = GetDeclination();
-					_bScopeActive = true;
-				}
-				else									// Can only get Alt/Az ...
-				{										// Convert using the SN window location			
-					PSphericalCoordinates sphereCoords;
-					PSphericalCoordinates raDec;
-					PXYZCoordinates xyzAltAzCoords;
-					PXYZCoordinates xyzRaDecCoords;
-
-					if(sn_RealWorldAzimuth2Mathematical((GetAzimuth() * RAD_PER_DEG), 
-														&sphereCoords.ra) != snNoErr)
-						drvFail("Azimuth conversion failed", NULL, true);
-					sphereCoords.dec = GetAltitude() * RAD_PER_DEG;
-					sphereCoords.radius = 1.0;
-					if(sn_SphericalToXYZ(sphereCoords, &xyzAltAzCoords) != snNoErr)
-						drvFail("Spherical to XYZ conversion failed", NULL, true);
-					if(sn_CoordinateConversion(_pWnd, 
-													kSNAltAzSystem,
-													kSNCelestialJNowSystem, 
-													xyzAltAzCoords, 
-													&xyzRaDecCoords) != snNoErr)
-						drvFail("Local to Equatorial coordinate conversion failed", NULL, true);
-					if(sn_XYZToSpherical(xyzRaDecCoords, &raDec) != snNoErr)
-						drvFail("XYZ to spherical conversion failed", NULL, true);
-					_dScopeRA = raDec.ra * HR_PER_RAD;
-					_dScopeDec = raDec.dec * DEG_PER_RAD;
-				}
-
-				//
-				// Refresh the V4 status window.
-				//
-				if(_bV8Plugin)								// Fill in status box on SNP V4
-				{
-					if ((_dScopeRA == coordinate_NotAvailable) && (_dScopeDec == coordinate_NotAvailable))
-					{
-						cToPstr("Cannot communicate with the telescope", (unsigned char*)&buf);
-						cToPstr( "Couldn't get the telescope position! Check your system to make sure no cables got unplugged, your interface is turned on, and your batteries are okay.", (unsigned char*)&buf2);
-						(*_psn_SetPluginStatusText)((unsigned char*)&buf, (unsigned char*)&buf2, 
-															_dScopeRA, 
-															_dScopeDec);
-					}
-					else
-					{
-						if(_bIsSlewing)
-						{
-							cToPstr("Telescope is moving...", (unsigned char*)&buf);
-							cToPstr( "The telescope is currently moving to the new sky location. If the view is not centered on the location you intended, check the alignment, date/time, and location settings of your telescope.", (unsigned char*)&buf2);
-						}
-						else 
-						{
-							cToPstr("Telescope is tracking the sky.", (unsigned char*)&buf);
-							cToPstr("The telescope is currently tracking the motion of the Earth, keeping the current view of the sky still in the eyepiece or camera. If objects are moving in the field of view, check the alignment of your telescope.", (unsigned char*)&buf2);
-						}
-						(*_psn_SetPluginStatusText)((unsigned char*)&buf, (unsigned char*)&buf2, 
-															_dScopeRA * RAD_PER_HR, 
-															_dScopeDec * RAD_PER_DEG);
-					}
-				}
-
-				//
-				// Auto-track logic (or start-up centering)
-				//
-				if(_bAutoTrack || _bStartCenter)
+				if(_bIsSlewing)
 				{
-					static PCentreAction pc;			// WARNING! Not thread safe!
-					double dr;
-					double dd;
-					double d;
-
-					//
-					// Algorithm: If the cursor has moved more than 1/4
-					// of the "minimum" FOV (in _dMinFOV, deg.) then
-					// we recenter. NOTE: This is a POOR approximation
-					// for wide gazes, where the mapping from RA/Dec to 
-					// gaze alt/az is REALLY curved. Therefore, if the 
-					// gazeFOV is > 30, we just step every 15 deg. The 
-					// angular motion of RA is 15 deg/hr at the celestial 
-					// equator, reduce by the cos(dec). Use the midpoint
-					// of the old and new dec.
-					//
-					// Panning: If the delta position is "small" then pan,
-					// otherwise jump.
-					//
-					// Always move to center on startup if _bStartCenter
-					//
-					dr = ((_dScopeRA - _dRAPrev) * 15.0) * 
-									cos(((_dScopeDec + _dDecPrev) / 2.0) * RAD_PER_DEG);
-					dd = (_dScopeDec - _dDecPrev);
-					d = sqrt((dr * dr) + (dd * dd));	// Distance moved
-					if(_bStartCenter || (d > (_dMinFOV / 4.0)))	 // If starting or moved to auto-center distance
-					{									// ... then re-center
-						_bStartCenter = false;			// (no more start centering)
-						pc.fRightAscension = _dScopeRA * RAD_PER_HR;// New centre point coords
-						pc.fDeclination = _dScopeDec * RAD_PER_DEG;
-						pc.fUseCustomPan = true;		// Override SN ...
-						if(_bStartCenter || (d > (_dMinFOV / 2.0)))	// If starting or large jump
-							pc.fPan = false;			// No panning, jump
-						else							// Small jump
-							pc.fPan = true;				// pan for beauty
-						pc.fAdjustFOV = false;			// Never change FOV
-						//pc.fNewFOV = _dGazeFOVRad;
-						p->fOutOperation = out_CentrePoint;
-						p->fOutParams = &pc;
-						_dRAPrev = _dScopeRA;
-						_dDecPrev = _dScopeDec;
-					}
-					else if(d > 0.003)					// If moved more than 10 arcsec,
-					{
-						p->fOutOperation = out_Update;	// Update to draw telrad
-					}
+					cToPstr("Telescope is moving...", (unsigned char*)&buf);
+					cToPstr( "The telescope is currently moving to the new sky location. If the view is not centered on the location you intended, check the alignment, date/time, and location settings of your telescope.", (unsigned char*)&buf2);
 				}
-				else									// Not auto-track, draw telrad
+				else 
 				{
-					_dRAPrev	= coordinate_NotAvailable;	// (also reset auto-track tests)
-					_dDecPrev	= coordinate_NotAvailable;
-					p->fOutOperation = out_Update;		// Force screen update for telrad
+					cToPstr("Telescope is tracking the sky.", (unsigned char*)&buf);
+					cToPstr("The telescope is currently tracking the motion of the Earth, keeping the current view of the sky still in the eyepiece or camera. If objects are moving in the field of view, check the alignment of your telescope.", (unsigned char*)&buf2);
 				}
+				(*_psn_SetPluginStatusText)((unsigned char*)&buf, (unsigned char*)&buf2, 
+													_dScopeRA * RAD_PER_HR, 
+													_dScopeDec * RAD_PER_DEG);
 			}
-
-			tn = t + FAST_UPDATE_MS;				// Next interval
-		}
-		__except(EXCEPTION_EXECUTE_HANDLER)
-		{
-			p->fOutOperation = out_Update;			// Just do screen update
-			iRes = -1;								// But note failure and bail
 		}
+
+		autoTrack(p);
+	}
+	__except(EXCEPTION_EXECUTE_HANDLER)
+	{
+		p->fOutOperation = out_Update;			// Just do screen update
+		iRes = -1;								// But note failure and bail
 	}
 	return(iRes);
 }
 
-
 // =============================
 // MAIN FUNCTION FOR STARRYNIGHT
 // =============================
@@ -841,6 +921,7 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 			case op_TelescopeOpen:					// NULL
 				_bScopeBusy = true;					// Stop doIdle()
 				outErr = InitScope();
+				_sched.Reset();
 				SetForegroundWindow(_hWndMain);		// Bring ourself to the front
 				break;
 
@@ -870,6 +951,7 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 			case op_DoContextualPopup:				// PDoContext*
 				_bScopeBusy = true;					// Stop doIdle() (for Slew and Sync)
 				doContextMenu((PDoContext *)ioParams);
+				_sched.Reset();						// (may have slewed or synced)
 				SetForegroundWindow(_hWndMain);		// Bring ourself to the front
 				break;
 
@@ -936,16 +1018,19 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 					PGaze *p = (PGaze*)ioParams;
 					outErr = SlewScope((p->fGazeRa * HR_PER_RAD), // Could be async or sync
 										(p->fGazeDec * DEG_PER_RAD));
+					_sched.Reset();
 				}
 				SetForegroundWindow(_hWndMain);		// Bring ourself to the front
 				break;
 
 			case op_TelescopePark:					// 
 				ParkScope();
+				_sched.Reset();
 				break;
 
 			case op_TelescopeUnpark:				// 
 				UnparkScope();
+				_sched.Reset();
 				break;
 
 			case op_TelescopeSetParkPosition:		// 
@@ -954,6 +1039,7 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 
 			case op_TelescopeGoHome:				// 
 				FindHomeScope();
+				_sched.Reset();
 				break;
 
 			case op_TelescopeMotion:				// PScopeMotion*
@@ -974,6 +1060,7 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 					{
 						_bScopeBusy = true;				// Stop doIdle()
 						outErr = SlewScope( (PScopeMotion*) ioParams );
+						_sched.Reset();
 						SetForegroundWindow(_hWndMain);		// Bring ourself to the front
 					}
 				}
@@ -985,6 +1072,7 @@ SNCall short DoOperation(OperationT inOperation, void* ioParams)
 					PGaze *p = (PGaze*)ioParams;
 					outErr = SyncScope((p->fGazeRa * HR_PER_RAD), 
 											(p->fGazeDec * DEG_PER_RAD));
+					_sched.Reset();
 				}
 				SetForegroundWindow(_hWndMain);		// Bring ourself to the front
 				break;
@@ -74,6 +74,9 @@ extern bool GetCanPark(void);
 extern bool GetCanUnpark(void);
 extern bool GetCanSetPark(void);
 extern bool GetParked(void);
+extern bool GetTracking(void);
+extern double GetRightAscensionRate(void);
+extern double GetDeclinationRate(void);
 extern bool GetCanFindHome(void);
 extern bool GetCanMoveAxis(void);
 extern double GetRightAscension(void);
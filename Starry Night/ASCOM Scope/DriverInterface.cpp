@@ -47,6 +47,8 @@
 //						expanded telescope interface)
 // 23-Nov-05	MK		Added bV10Flag and made sure that RefreshTelescopePanel 
 //						and SlewLimits are called only if SNP V5 and above is used
+// 17-Oct-26	asc		Add GetTracking() and the tracking rate getters for
+//						the idle scheduler's crosshair prediction.
 //========================================================================
 #include "AscomScope.h"
 #pragma hdrstop
@@ -580,6 +582,73 @@ bool GetParked(void)
 	return get_bool(L"Atpark");
 }
 
+// -------------
+// GetTracking()
+// -------------
+//
+// Old drivers without the property are assumed to track.
+//
+bool GetTracking(void)
+{
+	OLECHAR *name = L"Tracking";
+	DISPID dispid;
+
+	if(FAILED(_p_DrvDisp->GetIDsOfNames(
+		IID_NULL, 
+		&name,
+		1, 
+		LOCALE_USER_DEFAULT,
+		&dispid)))
+		return true;
+
+	return get_bool(L"Tracking");
+}
+
+// -----------------------
+// GetRightAscensionRate()
+// -----------------------
+//
+// Offset from sidereal, seconds of RA per sidereal second. 0 if the
+// driver doesn't have it.
+//
+double GetRightAscensionRate(void)
+{
+	OLECHAR *name = L"RightAscensionRate";
+	DISPID dispid;
+
+	if(FAILED(_p_DrvDisp->GetIDsOfNames(
+		IID_NULL, 
+		&name,
+		1, 
+		LOCALE_USER_DEFAULT,
+		&dispid)))
+		return 0.0;
+
+	return get_double(L"RightAscensionRate");
+}
+
+// --------------------
+// GetDeclinationRate()
+// --------------------
+//
+// Arcseconds per SI second. 0 if the driver doesn't have it.
+//
+double GetDeclinationRate(void)
+{
+	OLECHAR *name = L"DeclinationRate";
+	DISPID dispid;
+
+	if(FAILED(_p_DrvDisp->GetIDsOfNames(
+		IID_NULL, 
+		&name,
+		1, 
+		LOCALE_USER_DEFAULT,
+		&dispid)))
+		return 0.0;
+
+	return get_double(L"DeclinationRate");
+}
+
 // -----------------
 // GetRightAscension
 // -----------------
@@ -0,0 +1,277 @@
+//========================================================================
+//
+// TITLE:		IDLESCHEDULER.CPP
+//
+// FACILITY:	StarryNight V5 Plug-In DLL ASCOM Telescope Control
+//
+// ABSTRACT:	Adaptive driver polling and crosshair prediction for
+//				doIdle(). See IdleScheduler.h.
+//
+// ENVIRONMENT:	Microsoft Windows Windows 95/98/NT/2000/XP
+//				Developed under Microsoft Visual C++ Version 7
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+#include <math.h>
+#include "IdleScheduler.h"
+
+#define SIDEREAL_RATE 1.00273790935			// Sidereal seconds per SI second
+#define MISS_DEG 0.01						// Read this far off the prediction means the mount is being moved
+#define RAD_PER_DEG_IS (3.14159265358979 / 180.0)
+
+//
+// Milliseconds between two GetTickCount() values, across the 49.7 day
+// wrap (unsigned long may be wider than the tick count off Windows)
+//
+static inline unsigned long elapsed(unsigned long now, unsigned long then)
+{
+	return (now - then) & 0xFFFFFFFFUL;
+}
+
+IdleScheduler::IdleScheduler()
+{
+	_slewMs = 500;							// 2Hz, the most the slow handsets take
+	_trackMs = 3000;
+	_parkMs = 10000;
+	_statusMs = 5000;
+	_raRate = 0.0;
+	_decRate = 0.0;
+	_ra = 0.0;
+	_dec = 0.0;
+	_raVel = 0.0;
+	_decVel = 0.0;
+	_reads = 0;
+	Reset();
+}
+
+// --------------
+// SetIntervals()
+// --------------
+//
+// Position read interval while slewing or being moved, while tracking or
+// stopped, and the status interval while parked; then the status
+// (park/tracking/rates) interval otherwise.
+//
+void IdleScheduler::SetIntervals(unsigned long slewMs, unsigned long trackMs,
+									unsigned long parkMs, unsigned long statusMs)
+{
+	_slewMs = slewMs;
+	_trackMs = trackMs;
+	_parkMs = parkMs;
+	_statusMs = statusMs;
+}
+
+// -------
+// Reset()
+// -------
+//
+// Forget everything. Call when the scope connects and after any command
+// (slew, sync, park...) so the next idle reads the driver.
+//
+void IdleScheduler::Reset()
+{
+	_state = IS_UNKNOWN;
+	_haveStatus = false;
+	_havePos = false;
+	_haveVel = false;
+	_parked = false;
+	_tracking = true;						// Until the driver says otherwise
+	_slewing = false;
+	_tPos = 0;
+	_tStatus = 0;
+}
+
+// ----------
+// Interval()
+// ----------
+//
+unsigned long IdleScheduler::Interval() const
+{
+	switch(_state)
+	{
+		case IS_SLEWING:
+		case IS_MOVING:
+			return _slewMs;
+		case IS_TRACKING:
+		case IS_STOPPED:
+			return _trackMs;
+		case IS_PARKED:
+			return _parkMs;
+		default:
+			return 0;
+	}
+}
+
+// -------------
+// PositionDue()
+// -------------
+//
+bool IdleScheduler::PositionDue(unsigned long now) const
+{
+	if(_state == IS_PARKED)
+		return false;
+	if(!_havePos)
+		return true;
+	return elapsed(now, _tPos) >= Interval();
+}
+
+// -----------
+// StatusDue()
+// -----------
+//
+bool IdleScheduler::StatusDue(unsigned long now) const
+{
+	if(!_haveStatus)
+		return true;
+	return elapsed(now, _tStatus) >= (_parked ? _parkMs : _statusMs);
+}
+
+// --------
+// Status()
+// --------
+//
+// Record a read of AtPark, Tracking and the rates. Unparking (seen here)
+// makes the position due at once.
+//
+void IdleScheduler::Status(unsigned long now, bool parked, bool tracking, double raRate, double decRate)
+{
+	_tStatus = now;
+	_haveStatus = true;
+	_tracking = tracking;
+	_raRate = (tracking ? raRate : 0.0);
+	_decRate = (tracking ? decRate : 0.0);
+	if(parked)
+	{
+		_parked = true;
+		_state = IS_PARKED;
+		_havePos = false;
+		_haveVel = false;
+		return;
+	}
+	_parked = false;
+	if(_state == IS_PARKED || _state == IS_UNKNOWN || _state == IS_TRACKING || _state == IS_STOPPED)
+		_state = (tracking ? IS_TRACKING : IS_STOPPED);
+}
+
+// ----------
+// Position()
+// ----------
+//
+// Record a position read. The read is checked against where the rates
+// alone would have put the mount; a miss means something else is moving
+// it, so it is read at the slewing rate until it settles.
+//
+void IdleScheduler::Position(unsigned long now, double ra, double dec, bool slewing)
+{
+	int rest = (_tracking ? IS_TRACKING : IS_STOPPED);
+	bool moved = false;
+
+	if(_havePos && now != _tPos)
+	{
+		double dt = elapsed(now, _tPos) / 1000.0;
+		double dra = ra - _ra;
+		double pra, pdec;
+
+		if(dra > 12.0)						// Across 0h
+			dra -= 24.0;
+		else if(dra < -12.0)
+			dra += 24.0;
+		_raVel = dra / dt;
+		_decVel = (dec - _dec) / dt;
+		_haveVel = true;
+
+		if(_state != IS_SLEWING && Model(rest, dt, pra, pdec))
+		{
+			double er = ra - pra;
+			if(er > 12.0)
+				er -= 24.0;
+			else if(er < -12.0)
+				er += 24.0;
+			er = er * 15.0 * cos(dec * RAD_PER_DEG_IS);
+			moved = (sqrt((er * er) + ((dec - pdec) * (dec - pdec))) > MISS_DEG);
+		}
+	}
+	else if(!_havePos)
+		_haveVel = false;
+
+	_ra = ra;
+	_dec = dec;
+	_tPos = now;
+	_havePos = true;
+	_slewing = slewing;
+	_reads++;
+
+	if(_parked)
+		return;								// Status() decides when that ends
+	if(slewing)
+		_state = IS_SLEWING;
+	else if(moved)
+		_state = IS_MOVING;
+	else
+		_state = rest;
+}
+
+// ---------
+// Predict()
+// ---------
+//
+// Where the crosshair should be now. False if there is nothing to go on
+// (no read yet, parked, or slewing with only one read).
+//
+bool IdleScheduler::Predict(unsigned long now, double &ra, double &dec) const
+{
+	if(!_havePos)
+		return false;
+	return Model(_state, elapsed(now, _tPos) / 1000.0, ra, dec);
+}
+
+// -------
+// Model()
+// -------
+//
+// Carry the last read forward dt seconds as if the mount were in the
+// given state. Slews are extrapolated from the last two reads, but no
+// further than one read interval, so a slew that has stopped does not
+// carry the crosshair past its target for long.
+//
+bool IdleScheduler::Model(int state, double dt, double &ra, double &dec) const
+{
+	double lim;
+
+	switch(state)
+	{
+		case IS_SLEWING:
+		case IS_MOVING:
+			if(!_haveVel)
+				return false;
+			lim = _slewMs / 1000.0;
+			if(dt > lim)
+				dt = lim;
+			ra = _ra + (_raVel * dt);
+			dec = _dec + (_decVel * dt);
+			break;
+		case IS_TRACKING:
+			ra = _ra + ((_raRate * SIDEREAL_RATE / 3600.0) * dt);
+			dec = _dec + ((_decRate / 3600.0) * dt);
+			break;
+		case IS_STOPPED:
+			ra = _ra + ((SIDEREAL_RATE / 3600.0) * dt);
+			dec = _dec;
+			break;
+		default:
+			return false;
+	}
+
+	ra = fmod(ra, 24.0);
+	if(ra < 0.0)
+		ra += 24.0;
+	if(dec > 90.0)
+		dec = 90.0;
+	else if(dec < -90.0)
+		dec = -90.0;
+	return true;
+}
@@ -0,0 +1,95 @@
+//========================================================================
+//
+// TITLE:		IDLESCHEDULER.H
+//
+// FACILITY:	StarryNight V5 Plug-In DLL ASCOM Telescope Control
+//
+// ABSTRACT:	Decides, on each Starry Night idle event, whether the scope
+//				driver needs to be read, and where the crosshair is between
+//				reads. The read interval follows the mount: quick while it
+//				slews or moves unexpectedly, slow while it tracks, stopped
+//				or parked. Between reads the position is carried forward
+//				from the tracking rates (or the measured motion while
+//				slewing), so the crosshair keeps moving without driver
+//				traffic.
+//
+// USING:		Portable C++, no Windows or Starry Night headers. Times are
+//				GetTickCount() milliseconds passed in by the caller, so
+//				IdleSchedulerTest.cpp can run it on simulated time.
+//
+// ENVIRONMENT:	Microsoft Windows Windows 95/98/NT/2000/XP
+//				Developed under Microsoft Visual C++ Version 7
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+//========================================================================
+
+#ifndef IDLESCHEDULER_H
+#define IDLESCHEDULER_H
+
+// -------------
+// IdleScheduler
+// -------------
+//
+// RA in hours, Dec in degrees. Rates as the ASCOM driver reports them:
+// RightAscensionRate in seconds of RA per sidereal second,
+// DeclinationRate in arcseconds per SI second, both offsets from
+// sidereal tracking.
+//
+class IdleScheduler
+{
+public:
+	enum
+	{
+		IS_UNKNOWN = 0,											// Nothing read yet
+		IS_SLEWING,												// Slew in progress
+		IS_MOVING,												// Last read was off the prediction (hand paddle, guiding)
+		IS_TRACKING,											// Tracking, position follows the rates
+		IS_STOPPED,												// Not tracking, sky drifts past
+		IS_PARKED												// Parked, position not read
+	};
+
+	IdleScheduler();
+
+	void SetIntervals(unsigned long slewMs, unsigned long trackMs,
+						unsigned long parkMs, unsigned long statusMs);
+	void Reset();												// Read everything on the next idle
+
+	bool PositionDue(unsigned long now) const;
+	bool StatusDue(unsigned long now) const;					// Park, tracking and rates
+
+	void Status(unsigned long now, bool parked, bool tracking, double raRate, double decRate);
+	void Position(unsigned long now, double ra, double dec, bool slewing);
+	bool Predict(unsigned long now, double &ra, double &dec) const;
+
+	int State() const { return _state; }
+	unsigned long Interval() const;								// Position read interval for the state
+	unsigned long Reads() const { return _reads; }
+
+protected:
+	bool Model(int state, double dt, double &ra, double &dec) const;
+
+	unsigned long _slewMs;
+	unsigned long _trackMs;
+	unsigned long _parkMs;
+	unsigned long _statusMs;
+
+	int _state;
+	bool _haveStatus;
+	bool _havePos;
+	bool _haveVel;
+	bool _parked;
+	bool _tracking;
+	bool _slewing;
+	double _raRate, _decRate;
+	double _ra, _dec;											// Last read
+	double _raVel, _decVel;										// Measured, hours/sec and deg/sec
+	unsigned long _tPos;										// Tick of the last position read
+	unsigned long _tStatus;										// Tick of the last status read
+	unsigned long _reads;
+};
+
+#endif
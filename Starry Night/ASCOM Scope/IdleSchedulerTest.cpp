@@ -0,0 +1,278 @@
+//========================================================================
+//
+// TITLE:		IDLESCHEDULERTEST.CPP
+//
+// FACILITY:	StarryNight V5 Plug-In DLL ASCOM Telescope Control
+//
+// ABSTRACT:	Test for IdleScheduler on simulated time. Not part of the
+//				plug-in build; on Linux:
+//
+//				g++ -O2 -o IdleSchedulerTest IdleScheduler.cpp IdleSchedulerTest.cpp
+//				./IdleSchedulerTest
+//
+// Edit Log:
+//
+// When			Who		What
+//----------	---		--------------------------------------------------
+// 17-Oct-26	asc		Initial edit
+// 18-Oct-26	asc		PASS/FAIL reporting from TestCheck.h
+//========================================================================
+
+#include <stdio.h>
+#include <math.h>
+#include "IdleScheduler.h"
+#include "../../PluginCommon/TestCheck.h"
+
+#define SIDEREAL_RATE 1.00273790935
+
+static bool near(double a, double b, double tol)
+{
+	return fabs(a - b) <= tol;
+}
+
+//
+// Separation in arcseconds, RA hours and Dec degrees
+//
+static double sep(double ra1, double dec1, double ra2, double dec2)
+{
+	double dr = ra1 - ra2;
+
+	if(dr > 12.0)
+		dr -= 24.0;
+	else if(dr < -12.0)
+		dr += 24.0;
+	dr = dr * 15.0 * cos(dec1 * 3.14159265358979 / 180.0);
+	return sqrt((dr * dr) + ((dec1 - dec2) * (dec1 - dec2))) * 3600.0;
+}
+
+// -----
+// Mount
+// -----
+//
+// Simulated mount. Tracks with offset rates, or slews at a fixed speed
+// to a target.
+//
+struct Mount
+{
+	double ra, dec;
+	double raRate, decRate;
+	bool tracking;
+	bool slewing;
+	double tRa, tDec;
+
+	void Step(double dt)
+	{
+		if(slewing)
+		{
+			double step = 2.0 * dt;										// 2 deg/sec
+			double dd = tDec - dec;
+			double dr = (tRa - ra) * 15.0;
+			double d = sqrt((dd * dd) + (dr * dr));
+			if(d <= step)
+			{
+				ra = tRa;
+				dec = tDec;
+				slewing = false;
+			}
+			else
+			{
+				ra += (dr / d) * step / 15.0;
+				dec += (dd / d) * step;
+			}
+			return;
+		}
+		if(tracking)
+		{
+			ra += raRate * SIDEREAL_RATE / 3600.0 * dt;
+			dec += decRate / 3600.0 * dt;
+		}
+		else
+			ra += SIDEREAL_RATE / 3600.0 * dt;
+	}
+};
+
+int main()
+{
+	double ra, dec;
+
+	//
+	// Nothing read yet: everything due, nothing to predict
+	//
+	{
+		IdleScheduler s;
+
+		check(s.PositionDue(0) && s.StatusDue(0) && !s.Predict(0, ra, dec), "fresh: read at once");
+	}
+
+	//
+	// Tracking at sidereal: slow reads, crosshair stays put
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(1000, false, true, 0.0, 0.0);
+		s.Position(1000, 5.0, 20.0, false);
+		check(s.State() == IdleScheduler::IS_TRACKING, "tracking: state");
+		check(!s.PositionDue(3999) && s.PositionDue(4000), "tracking: read every 3 sec");
+		check(!s.StatusDue(5999) && s.StatusDue(6000), "tracking: status every 5 sec");
+		check(s.Predict(3000, ra, dec) && near(ra, 5.0, 1e-12) && near(dec, 20.0, 1e-12),
+				"tracking: no motion at sidereal");
+
+		s.Status(6000, false, true, 0.5, -10.0);					// Comet rates
+		check(s.Predict(11000, ra, dec) && near(ra, 5.0 + 0.5 * SIDEREAL_RATE * 10.0 / 3600.0, 1e-12) &&
+				near(dec, 20.0 - 100.0 / 3600.0, 1e-12), "tracking: offsets carried forward");
+	}
+
+	//
+	// Not tracking: the sky drifts at the sidereal rate
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(0, false, false, 0.0, 0.0);
+		s.Position(0, 23.99, 0.0, false);
+		check(s.State() == IdleScheduler::IS_STOPPED, "stopped: state");
+		check(s.Predict(60000, ra, dec) && near(ra, fmod(23.99 + 60.0 * SIDEREAL_RATE / 3600.0, 24.0), 1e-9),
+				"stopped: drift wraps past 24h");
+		s.Position(3000, 23.99 + 3.0 * SIDEREAL_RATE / 3600.0, 0.0, false);
+		check(s.State() == IdleScheduler::IS_STOPPED, "stopped: read on the prediction stays slow");
+	}
+
+	//
+	// Slewing: fast reads, extrapolated between them, but not past one
+	// interval
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(0, false, true, 0.0, 0.0);
+		s.Position(0, 1.0, 10.0, true);
+		check(s.State() == IdleScheduler::IS_SLEWING && !s.PositionDue(499) && s.PositionDue(500),
+				"slew: read at 2Hz");
+		check(!s.Predict(250, ra, dec), "slew: no prediction from one read");
+		s.Position(500, 1.1, 11.0, true);
+		check(s.Predict(750, ra, dec) && near(ra, 1.15, 1e-9) && near(dec, 11.5, 1e-9), "slew: extrapolated");
+		check(s.Predict(5000, ra, dec) && near(ra, 1.2, 1e-9) && near(dec, 12.0, 1e-9), "slew: extrapolation capped");
+		s.Position(1000, 1.2, 12.0, false);
+		check(s.State() == IdleScheduler::IS_TRACKING, "slew: done, back to tracking");
+	}
+
+	//
+	// Moved by something other than tracking (hand paddle): read fast
+	// until a read lands on the prediction again
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(0, false, true, 0.0, 0.0);
+		s.Position(0, 6.0, 30.0, false);
+		s.Position(3000, 6.0, 30.2, false);
+		check(s.State() == IdleScheduler::IS_MOVING && s.Interval() == 500, "paddle: off prediction goes fast");
+		s.Position(3500, 6.0, 30.3, false);
+		check(s.State() == IdleScheduler::IS_MOVING, "paddle: still moving");
+		s.Position(4000, 6.0, 30.3, false);
+		check(s.State() == IdleScheduler::IS_TRACKING && s.Interval() == 3000, "paddle: settles");
+	}
+
+	//
+	// Parked: no position reads, status slowly, unpark reads at once
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(0, true, false, 0.0, 0.0);
+		check(s.State() == IdleScheduler::IS_PARKED && !s.PositionDue(100000), "park: no position reads");
+		check(!s.StatusDue(9999) && s.StatusDue(10000), "park: status every 10 sec");
+		check(!s.Predict(1000, ra, dec), "park: no crosshair");
+		s.Status(10000, false, true, 0.0, 0.0);
+		check(s.PositionDue(10000) && s.State() == IdleScheduler::IS_TRACKING, "park: unpark reads position");
+	}
+
+	//
+	// GetTickCount() wrap
+	//
+	{
+		IdleScheduler s;
+		unsigned long t0 = 0xFFFFFFFFUL - 1000UL;
+		unsigned long t2 = 999UL;									// t0 + 2000, wrapped
+		unsigned long t3 = 1999UL;
+
+		s.Status(t0, false, false, 0.0, 0.0);
+		s.Position(t0, 3.0, 0.0, false);
+		check(!s.PositionDue(t2) && s.PositionDue(t3), "wrap: interval across the wrap");
+		check(s.Predict(t2, ra, dec) && near(ra, 3.0 + 2.0 * SIDEREAL_RATE / 3600.0, 1e-12), "wrap: predict across the wrap");
+	}
+
+	//
+	// Reset() after a command reads everything again
+	//
+	{
+		IdleScheduler s;
+
+		s.Status(0, false, true, 0.0, 0.0);
+		s.Position(0, 3.0, 0.0, false);
+		s.Reset();
+		check(s.PositionDue(1) && s.StatusDue(1), "reset: read at once");
+	}
+
+	//
+	// An hour of idle events every 50ms against a simulated mount that
+	// tracks a comet, slews, and tracks again. Compare driver reads and
+	// crosshair error with reading every second as doIdle() used to.
+	//
+	{
+		IdleScheduler s;
+		Mount m = { 2.0, 15.0, 0.2, 3.0, true, false, 0.0, 0.0 };
+		const double step = 0.05;
+		double worstTrack = 0.0, worstFixed = 0.0;
+		double fixedRa = m.ra, fixedDec = m.dec;
+		unsigned long reads = 0, statusReads = 0, fixedReads = 0;
+		unsigned long t;
+
+		for(t = 0; t <= 3600000UL; t += 50)
+		{
+			if(t == 1800000UL)
+			{
+				m.slewing = true;
+				m.tRa = 4.0;
+				m.tDec = 40.0;
+				s.Reset();											// As DoOperation() does after a slew
+			}
+			if(s.StatusDue(t))
+			{
+				s.Status(t, false, m.tracking, m.raRate, m.decRate);
+				statusReads++;
+			}
+			if(s.PositionDue(t))
+			{
+				s.Position(t, m.ra, m.dec, m.slewing);
+				reads++;
+			}
+			if(t % 1000 == 0)
+			{
+				fixedRa = m.ra;
+				fixedDec = m.dec;
+				fixedReads++;
+			}
+			bool settled = (t < 1800000UL || t > 1860000UL);		// Fixed polling lags the end of the slew
+			if(settled && !m.slewing && s.State() == IdleScheduler::IS_TRACKING && s.Predict(t, ra, dec))
+			{
+				double e = sep(ra, dec, m.ra, m.dec);
+				if(e > worstTrack)
+					worstTrack = e;
+				e = sep(fixedRa, fixedDec, m.ra, m.dec);
+				if(e > worstFixed)
+					worstFixed = e;
+			}
+			m.Step(step);
+		}
+		printf("      1 hour: %lu position + %lu status reads, fixed 1 sec polling %lu reads\n",
+				reads, statusReads, fixedReads);
+		printf("      worst crosshair error while tracking %.3f arcsec (fixed polling %.3f arcsec)\n",
+				worstTrack, worstFixed);
+		check(reads + statusReads < fixedReads, "sim: fewer driver reads than fixed polling");
+		check(worstTrack < 0.01 && worstTrack < worstFixed, "sim: crosshair follows the rates between reads");
+	}
+
+	return check_summary();
+}